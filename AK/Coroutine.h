@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Assertions.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/StdLibExtras.h>
+#include <coroutine>
+#include <stdlib.h>
+
+namespace AK {
+
+namespace Detail {
+
+struct CoroutineFreeFrame {
+    CoroutineFreeFrame* next { nullptr };
+};
+
+struct CoroutineFreeList {
+    CoroutineFreeFrame* head { nullptr };
+    size_t count { 0 };
+};
+
+// Coroutine frames are allocated every time a coroutine is called, so instead of going back to malloc for each one,
+// the frames of finished coroutines are kept on small per-thread free lists and handed out again to coroutines of a
+// similar size.
+class CoroutineFrameAllocator {
+public:
+    static void* allocate(size_t size)
+    {
+        auto size_class = size_class_for(size);
+        if (!size_class.has_value())
+            return checked_malloc(size);
+
+        auto& free_list = s_free_lists.lists[*size_class];
+        if (free_list.head) {
+            auto* frame = free_list.head;
+            free_list.head = frame->next;
+            --free_list.count;
+            return frame;
+        }
+        return checked_malloc(smallest_size_class << *size_class);
+    }
+
+    static void deallocate(void* pointer, size_t size)
+    {
+        auto size_class = size_class_for(size);
+        if (!size_class.has_value()) {
+            free(pointer);
+            return;
+        }
+
+        auto& free_list = s_free_lists.lists[*size_class];
+        if (free_list.count == maximum_cached_frames_per_size_class) {
+            free(pointer);
+            return;
+        }
+        auto* frame = static_cast<CoroutineFreeFrame*>(pointer);
+        frame->next = free_list.head;
+        free_list.head = frame;
+        ++free_list.count;
+    }
+
+private:
+    static constexpr size_t smallest_size_class = 128;
+    static constexpr size_t size_class_count = 6;
+    static constexpr size_t maximum_cached_frames_per_size_class = 16;
+
+    static Optional<size_t> size_class_for(size_t size)
+    {
+        for (size_t size_class = 0; size_class < size_class_count; ++size_class) {
+            if (size <= (smallest_size_class << size_class))
+                return size_class;
+        }
+        return {};
+    }
+
+    static void* checked_malloc(size_t size)
+    {
+        auto* pointer = malloc(size);
+        VERIFY(pointer);
+        return pointer;
+    }
+
+    struct FreeLists {
+        ~FreeLists()
+        {
+            for (auto& free_list : lists) {
+                while (free_list.head) {
+                    auto* next = free_list.head->next;
+                    free(free_list.head);
+                    free_list.head = next;
+                }
+            }
+        }
+
+        Array<CoroutineFreeList, size_class_count> lists;
+    };
+
+    static inline thread_local FreeLists s_free_lists;
+};
+
+template<typename T>
+class CoroutinePromiseBase {
+public:
+    template<typename U = T>
+    void return_value(U&& value)
+    {
+        m_return_value = forward<U>(value);
+    }
+
+    T take_return_value() { return m_return_value.release_value(); }
+
+private:
+    Optional<T> m_return_value;
+};
+
+template<>
+class CoroutinePromiseBase<void> {
+public:
+    void return_void() { }
+    void take_return_value() { }
+};
+
+}
+
+// A coroutine that starts running as soon as it is called, and that another coroutine can co_await to suspend until
+// it has finished. Destroying a Coroutine destroys its frame, even if it is still suspended.
+template<typename T>
+class [[nodiscard]] Coroutine {
+    AK_MAKE_NONCOPYABLE(Coroutine);
+
+public:
+    using ReturnType = T;
+
+    struct promise_type : public Detail::CoroutinePromiseBase<T> {
+        Coroutine get_return_object() { return Coroutine { std::coroutine_handle<promise_type>::from_promise(*this) }; }
+
+        std::suspend_never initial_suspend() { return {}; }
+
+        struct FinalAwaiter {
+            bool await_ready() const noexcept { return false; }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+            {
+                auto& promise = handle.promise();
+                if (promise.m_is_detached) {
+                    handle.destroy();
+                    return std::noop_coroutine();
+                }
+                if (promise.m_awaiter)
+                    return promise.m_awaiter;
+                return std::noop_coroutine();
+            }
+
+            void await_resume() const noexcept { }
+        };
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        void unhandled_exception() { VERIFY_NOT_REACHED(); }
+
+        static void* operator new(size_t size) { return Detail::CoroutineFrameAllocator::allocate(size); }
+        static void operator delete(void* pointer, size_t size) { Detail::CoroutineFrameAllocator::deallocate(pointer, size); }
+
+        std::coroutine_handle<> m_awaiter;
+        bool m_is_detached { false };
+    };
+
+    Coroutine(Coroutine&& other)
+        : m_handle(AK::exchange(other.m_handle, {}))
+    {
+    }
+
+    Coroutine& operator=(Coroutine&& other)
+    {
+        if (this != &other) {
+            destroy();
+            m_handle = AK::exchange(other.m_handle, {});
+        }
+        return *this;
+    }
+
+    ~Coroutine() { destroy(); }
+
+    bool is_done() const
+    {
+        VERIFY(m_handle);
+        return m_handle.done();
+    }
+
+    // Lets the coroutine run to completion on its own; its frame is freed once it finishes.
+    void detach() &&
+    {
+        VERIFY(m_handle);
+        auto handle = AK::exchange(m_handle, {});
+        if (handle.done())
+            handle.destroy();
+        else
+            handle.promise().m_is_detached = true;
+    }
+
+    T take_return_value()
+    {
+        VERIFY(is_done());
+        return m_handle.promise().take_return_value();
+    }
+
+    bool await_ready() const { return is_done(); }
+    void await_suspend(std::coroutine_handle<> awaiter) { m_handle.promise().m_awaiter = awaiter; }
+    T await_resume() { return take_return_value(); }
+
+private:
+    explicit Coroutine(std::coroutine_handle<promise_type> handle)
+        : m_handle(handle)
+    {
+    }
+
+    void destroy()
+    {
+        if (m_handle)
+            m_handle.destroy();
+        m_handle = {};
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::Coroutine;
+#endif
@@ -4,8 +4,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
+#include <AK/Atomic.h>
 #include <AK/FlyString.h>
 #include <AK/HashTable.h>
+#include <AK/ScopeGuard.h>
 #include <AK/Singleton.h>
 #include <AK/String.h>
 #include <AK/StringData.h>
@@ -19,10 +22,57 @@ struct FlyStringTableHashTraits : public Traits<Detail::StringData const*> {
     static bool equals(Detail::StringData const* a, Detail::StringData const* b) { return *a == *b; }
 };
 
+// The table of all fly strings is split into shards by hash, each with a lock of its own, so that threads interning
+// different strings rarely contend with each other. A shard's lock is only ever held for a single hash table lookup,
+// insertion or removal, which is why spinning beats going to the kernel.
+// FIXME: StringData's reference count is not atomic, so the same fly string still can't be used by multiple threads.
+class FlyStringTableShard {
+public:
+    template<typename Callback>
+    decltype(auto) with_locked_table(Callback callback)
+    {
+        while (m_locked.exchange(true, AK::memory_order_acquire))
+            sched_yield();
+        ScopeGuard unlock = [&] { m_locked.store(false, AK::memory_order_release); };
+        return callback(m_table);
+    }
+
+private:
+    Atomic<bool> m_locked { false };
+    HashTable<Detail::StringData const*, FlyStringTableHashTraits> m_table;
+};
+
+static constexpr size_t fly_string_table_shard_count = 16;
+
 static auto& all_fly_strings()
 {
-    static Singleton<HashTable<Detail::StringData const*, FlyStringTableHashTraits>> table;
-    return *table;
+    static Singleton<Array<FlyStringTableShard, fly_string_table_shard_count>> shards;
+    return *shards;
+}
+
+static FlyStringTableShard& fly_string_table_shard(u32 hash)
+{
+    // NOTE: The low bits of the hash select the bucket within a shard's table, so we use the high bits here.
+    static_assert(fly_string_table_shard_count == 16);
+    return all_fly_strings()[hash >> 28];
+}
+
+// NOTE: A string whose last reference has just been dropped stays in the table until its destructor has taken the
+//       shard's lock to remove it, so lookups must skip strings that no longer have any references.
+static bool is_alive(Detail::StringData const& string_data)
+{
+    return string_data.ref_count() > 0;
+}
+
+static RefPtr<Detail::StringData const> find_fly_string(StringView string)
+{
+    auto hash = string.hash();
+    return fly_string_table_shard(hash).with_locked_table([&](auto& table) -> RefPtr<Detail::StringData const> {
+        auto it = table.find(hash, [&](auto& entry) { return entry->bytes_as_string_view() == string; });
+        if (it == table.end() || !is_alive(**it))
+            return nullptr;
+        return *it;
+    });
 }
 
 ErrorOr<FlyString> FlyString::from_utf8(StringView string)
@@ -31,8 +81,8 @@ ErrorOr<FlyString> FlyString::from_utf8(StringView string)
         return FlyString {};
     if (string.length() <= Detail::MAX_SHORT_STRING_BYTE_COUNT)
         return FlyString { TRY(String::from_utf8(string)) };
-    if (auto it = all_fly_strings().find(string.hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end())
-        return FlyString { Detail::StringBase(**it) };
+    if (auto existing = find_fly_string(string))
+        return FlyString { Detail::StringBase(existing.release_nonnull()) };
     return FlyString { TRY(String::from_utf8(string)) };
 }
 
@@ -42,8 +92,8 @@ FlyString FlyString::from_utf8_without_validation(ReadonlyBytes string)
         return FlyString {};
     if (string.size() <= Detail::MAX_SHORT_STRING_BYTE_COUNT)
         return FlyString { String::from_utf8_without_validation(string) };
-    if (auto it = all_fly_strings().find(StringView(string).hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end())
-        return FlyString { Detail::StringBase(**it) };
+    if (auto existing = find_fly_string(StringView { string }))
+        return FlyString { Detail::StringBase(existing.release_nonnull()) };
     return FlyString { String::from_utf8_without_validation(string) };
 }
 
@@ -61,15 +111,32 @@ FlyString::FlyString(String const& string)
         return;
     }
 
-    auto it = all_fly_strings().find(string.m_impl.data);
-    if (it == all_fly_strings().end()) {
+    auto const* string_data = string.m_impl.data;
+    fly_string_table_shard(string_data->hash()).with_locked_table([&](auto& table) {
+        auto it = table.find(string_data);
+        if (it != table.end() && is_alive(**it)) {
+            m_data.m_impl.data = *it;
+            m_data.m_impl.data->ref();
+            return;
+        }
+
         m_data = string;
-        all_fly_strings().set(string.m_impl.data);
-        string.m_impl.data->set_fly_string(true);
-    } else {
-        m_data.m_impl.data = *it;
-        m_data.m_impl.data->ref();
-    }
+        table.set(string_data, HashSetExistingEntryBehavior::Replace);
+        string_data->set_fly_string(true);
+    });
+}
+
+FlyString FlyString::from_static_string_data(Detail::StringData const& string_data)
+{
+    return fly_string_table_shard(string_data.hash()).with_locked_table([&](auto& table) {
+        auto it = table.find(&string_data);
+        if (it != table.end() && is_alive(**it))
+            return FlyString { Detail::StringBase(**it) };
+
+        table.set(&string_data);
+        string_data.set_fly_string(true);
+        return FlyString { Detail::StringBase(string_data) };
+    });
 }
 
 FlyString& FlyString::operator=(String const& string)
@@ -116,7 +183,10 @@ Detail::StringBase FlyString::data(Badge<String>) const
 
 size_t FlyString::number_of_fly_strings()
 {
-    return all_fly_strings().size();
+    size_t count = 0;
+    for (auto& shard : all_fly_strings())
+        count += shard.with_locked_table([](auto& table) { return table.size(); });
+    return count;
 }
 
 unsigned Traits<FlyString>::hash(FlyString const& fly_string)
@@ -208,7 +278,11 @@ namespace Detail {
 
 void did_destroy_fly_string_data(Badge<Detail::StringData>, Detail::StringData const& string_data)
 {
-    all_fly_strings().remove(&string_data);
+    fly_string_table_shard(string_data.hash()).with_locked_table([&](auto& table) {
+        // NOTE: Another string with the same contents may have replaced this one in the table while it was dying.
+        if (auto it = table.find(&string_data); it != table.end() && *it == &string_data)
+            table.remove(it);
+    });
 }
 
 }
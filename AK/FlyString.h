@@ -32,6 +32,9 @@ public:
     FlyString(String const&);
     FlyString& operator=(String const&);
 
+    // Interns string data that lives in static storage, which is what the _fly_string literal is made of.
+    static FlyString from_static_string_data(Detail::StringData const&);
+
     [[nodiscard]] bool is_empty() const { return m_data.byte_count() == 0; }
     [[nodiscard]] unsigned hash() const { return m_data.hash(); }
     [[nodiscard]] u32 ascii_case_insensitive_hash() const;
@@ -214,10 +217,35 @@ struct ASCIICaseInsensitiveFlyStringTraits : public Traits<String> {
 
 }
 
-[[nodiscard]] ALWAYS_INLINE AK::FlyString operator""_fly_string(char const* cstring, size_t length)
+namespace AK::Detail {
+
+template<size_t Size>
+struct FlyStringLiteral {
+    constexpr FlyStringLiteral(char const (&string)[Size])
+    {
+        for (size_t i = 0; i < Size; ++i)
+            characters[i] = string[i];
+    }
+
+    static constexpr size_t byte_count = Size - 1;
+    char characters[Size] {};
+};
+
+}
+
+// OPTIMIZATION: The data of a long enough fly string literal is built at compile time, hash included, so creating the
+//               fly string neither allocates nor hashes. All uses of the same literal share that data.
+template<AK::Detail::FlyStringLiteral literal>
+[[nodiscard]] ALWAYS_INLINE AK::FlyString operator""_fly_string()
 {
-    ASSERT(Utf8View(AK::StringView(cstring, length)).validate());
-    return AK::FlyString::from_utf8_without_validation({ cstring, length });
+    ASSERT(Utf8View(AK::StringView(literal.characters, literal.byte_count)).validate());
+
+    if constexpr (literal.byte_count <= AK::Detail::MAX_SHORT_STRING_BYTE_COUNT) {
+        return AK::FlyString::from_utf8_without_validation({ literal.characters, literal.byte_count });
+    } else {
+        static constinit AK::Detail::StaticStringData<literal.byte_count> string_data { literal.characters };
+        return AK::FlyString::from_static_string_data(string_data.data());
+    }
 }
 
 #if USING_AK_GLOBALLY
@@ -96,12 +96,18 @@ class HashTable;
 template<typename T, typename TraitsForT = Traits<T>>
 using OrderedHashTable = HashTable<T, TraitsForT, true>;
 
-template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>, bool IsOrdered = false>
+template<typename T, typename TraitsForT = Traits<T>, bool IsOrdered = false>
+class SwissHashTable;
+
+template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>, bool IsOrdered = false, template<typename, typename, bool> typename TableType = HashTable>
 class HashMap;
 
 template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>>
 using OrderedHashMap = HashMap<K, V, KeyTraits, ValueTraits, true>;
 
+template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>>
+using SwissHashMap = HashMap<K, V, KeyTraits, ValueTraits, false, SwissHashTable>;
+
 template<typename T>
 class Badge;
 
@@ -195,6 +201,8 @@ using AK::Stream;
 using AK::String;
 using AK::StringBuilder;
 using AK::StringView;
+using AK::SwissHashMap;
+using AK::SwissHashTable;
 using AK::TrailingCodePointTransformation;
 using AK::Traits;
 using AK::UnixDateTime;
@@ -187,7 +187,7 @@ LineTrackingLexer::Position LineTrackingLexer::position_for(size_t index) const
     }
 
     line += m_first_line_start_position.line;
-    return { index, line, column };
+    return { m_first_line_start_position.offset + index, line, column };
 }
 
 template ErrorOr<u8> GenericLexer::consume_decimal_integer<u8>();
@@ -17,7 +17,8 @@ namespace AK {
 // A map datastructure, mapping keys K to values V, based on a hash table with closed hashing.
 // HashMap can optionally provide ordered iteration based on the order of keys when IsOrdered = true.
 // HashMap is based on HashTable, which should be used instead if just a set datastructure is required.
-template<typename K, typename V, typename KeyTraits, typename ValueTraits, bool IsOrdered>
+// The table can be swapped out for another one with the same interface, see SwissHashMap.
+template<typename K, typename V, typename KeyTraits, typename ValueTraits, bool IsOrdered, template<typename, typename, bool> typename TableType>
 class HashMap {
 private:
     struct Entry {
@@ -93,7 +94,7 @@ public:
         });
     }
 
-    using HashTableType = HashTable<Entry, EntryTraits, IsOrdered>;
+    using HashTableType = TableType<Entry, EntryTraits, IsOrdered>;
     using IteratorType = typename HashTableType::Iterator;
     using ConstIteratorType = typename HashTableType::ConstIterator;
 
@@ -307,9 +308,9 @@ public:
     }
 
     template<typename NewKeyTraits = KeyTraits, typename NewValueTraits = ValueTraits, bool NewIsOrdered = IsOrdered>
-    ErrorOr<HashMap<K, V, NewKeyTraits, NewValueTraits, NewIsOrdered>> clone() const
+    ErrorOr<HashMap<K, V, NewKeyTraits, NewValueTraits, NewIsOrdered, TableType>> clone() const
     {
-        HashMap<K, V, NewKeyTraits, NewValueTraits, NewIsOrdered> hash_map_clone;
+        HashMap<K, V, NewKeyTraits, NewValueTraits, NewIsOrdered, TableType> hash_map_clone;
         TRY(hash_map_clone.try_ensure_capacity(size()));
         for (auto const& [key, value] : *this)
             hash_map_clone.set(key, value);
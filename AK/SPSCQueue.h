@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/StdLibExtras.h>
+
+namespace AK {
+
+// A bounded queue for handing values from exactly one producer thread to exactly one consumer thread, without locks.
+// Both enqueueing and dequeueing are wait-free and never allocate, so this is safe to use from real-time threads.
+template<typename T, size_t Capacity>
+class SPSCQueue {
+    AK_MAKE_NONCOPYABLE(SPSCQueue);
+    AK_MAKE_NONMOVABLE(SPSCQueue);
+
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SPSCQueue capacity must be a power of two");
+
+public:
+    SPSCQueue() = default;
+
+    ~SPSCQueue()
+    {
+        while (try_dequeue().has_value())
+            ;
+    }
+
+    size_t capacity() const { return Capacity; }
+
+    // Must only be called from the producer thread. Returns false (and drops nothing) if the queue is full.
+    template<typename U = T>
+    [[nodiscard]] bool try_enqueue(U&& value)
+    {
+        auto tail = m_tail.load(AK::MemoryOrder::memory_order_relaxed);
+        if (tail - m_head.load(AK::MemoryOrder::memory_order_acquire) == Capacity)
+            return false;
+
+        new (&elements()[tail % Capacity]) T(forward<U>(value));
+        m_tail.store(tail + 1, AK::MemoryOrder::memory_order_release);
+        return true;
+    }
+
+    // Must only be called from the consumer thread.
+    Optional<T> try_dequeue()
+    {
+        auto head = m_head.load(AK::MemoryOrder::memory_order_relaxed);
+        if (head == m_tail.load(AK::MemoryOrder::memory_order_acquire))
+            return {};
+
+        auto& slot = elements()[head % Capacity];
+        T value = move(slot);
+        slot.~T();
+        m_head.store(head + 1, AK::MemoryOrder::memory_order_release);
+        return value;
+    }
+
+    // Only a snapshot, the other thread may change the answer at any time.
+    bool is_empty() const
+    {
+        return m_head.load(AK::MemoryOrder::memory_order_acquire) == m_tail.load(AK::MemoryOrder::memory_order_acquire);
+    }
+
+    // Only a snapshot, but from the producer thread a queue that isn't full is guaranteed to stay that way.
+    bool is_full() const
+    {
+        return m_tail.load(AK::MemoryOrder::memory_order_acquire) - m_head.load(AK::MemoryOrder::memory_order_acquire) == Capacity;
+    }
+
+private:
+    T* elements() { return reinterpret_cast<T*>(m_storage); }
+
+    // The producer and consumer each write to one of these, so keep them on separate cache lines.
+    alignas(64) Atomic<size_t> m_head { 0 };
+    alignas(64) Atomic<size_t> m_tail { 0 };
+    alignas(T) u8 m_storage[sizeof(T) * Capacity];
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::SPSCQueue;
+#endif
@@ -73,6 +73,9 @@ public:
     static ErrorOr<String> from_utf16_le_with_replacement_character(ReadonlyBytes);
     static ErrorOr<String> from_utf16_be_with_replacement_character(ReadonlyBytes);
 
+    // Creates a new String from a sequence of ISO-8859-1 encoded code points, which map one to one onto U+0000 to U+00FF.
+    static ErrorOr<String> from_latin1(ReadonlyBytes);
+
     // Creates a new String by reading byte_count bytes from a UTF-8 encoded Stream.
     static ErrorOr<String> from_stream(Stream&, size_t byte_count);
 
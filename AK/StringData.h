@@ -16,6 +16,8 @@ namespace AK::Detail {
 static constexpr size_t MAX_SHORT_STRING_BYTE_COUNT = sizeof(StringData*) - sizeof(u8);
 
 class StringData;
+template<size_t ByteCount>
+class StaticStringData;
 
 void did_destroy_fly_string_data(Badge<StringData>, StringData const&);
 
@@ -112,6 +114,9 @@ public:
     size_t byte_count() const { return m_byte_count; }
 
 private:
+    template<size_t ByteCount>
+    friend class StaticStringData;
+
     static constexpr size_t allocation_size_for_string_data(size_t length)
     {
         return sizeof(StringData) + (sizeof(char) * length);
@@ -122,6 +127,13 @@ private:
     {
     }
 
+    constexpr StringData(size_t byte_count, unsigned hash)
+        : m_byte_count(byte_count)
+        , m_hash(hash)
+        , m_has_hash(true)
+    {
+    }
+
     StringData(StringData const& superstring, size_t start, size_t byte_count)
         : m_byte_count(byte_count)
         , m_substring(true)
@@ -152,4 +164,32 @@ private:
     alignas(SubstringData) u8 m_bytes_or_substring_data[0];
 };
 
+// The string data of a string literal, laid out the same way as a heap allocated StringData with its bytes right
+// behind it. It is initialized at compile time, and it is never destroyed, so the reference it starts out with keeps
+// it alive forever.
+template<size_t ByteCount>
+class StaticStringData {
+public:
+    constexpr StaticStringData(char const (&characters)[ByteCount + 1])
+        : m_data(ByteCount, string_hash(characters, ByteCount))
+    {
+        for (size_t i = 0; i < ByteCount; ++i)
+            m_bytes[i] = static_cast<u8>(characters[i]);
+    }
+
+    ~StaticStringData() { }
+
+    StringData const& data() const
+    {
+        ASSERT(m_data.bytes().data() == m_bytes);
+        return m_data;
+    }
+
+private:
+    union {
+        StringData m_data;
+    };
+    u8 m_bytes[ByteCount] {};
+};
+
 }
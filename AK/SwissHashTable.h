@@ -0,0 +1,494 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/BitCast.h>
+#include <AK/BuiltinWrappers.h>
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/SIMD.h>
+#include <AK/StdLibExtras.h>
+#include <AK/kmalloc.h>
+
+namespace AK {
+
+namespace Detail {
+
+// The control bytes of a SwissHashTable describe its slots: a control byte is either empty, deleted, or holds the low
+// seven bits of the hash of the value in a full slot. Lookups compare a whole group of control bytes at once, and only
+// look at the slots whose control byte matches.
+class SwissHashTableGroup {
+public:
+    static constexpr size_t size = 16;
+
+    static constexpr u8 empty = 0x80;
+    static constexpr u8 deleted = 0xFE;
+
+    static constexpr bool is_full(u8 control) { return (control & 0x80) == 0; }
+
+    ALWAYS_INLINE explicit SwissHashTableGroup(u8 const* control)
+    {
+        __builtin_memcpy(&m_control, control, size);
+    }
+
+    // The result of all of these is a bit mask with every bit set whose control byte matched.
+    ALWAYS_INLINE u32 match(u8 hash_bits) const { return bit_mask(m_control == hash_bits); }
+    ALWAYS_INLINE u32 match_empty() const { return bit_mask(m_control == empty); }
+    ALWAYS_INLINE u32 match_empty_or_deleted() const { return bit_mask(bit_cast<SIMD::i8x16>(m_control) < 0); }
+
+private:
+    template<typename MaskType>
+    ALWAYS_INLINE static u32 bit_mask(MaskType mask)
+    {
+#if defined(__SSE2__)
+        return static_cast<u32>(__builtin_ia32_pmovmskb128(bit_cast<SIMD::c8x16>(mask)));
+#else
+        u32 bits = 0;
+        for (size_t i = 0; i < size; ++i)
+            bits |= static_cast<u32>(mask[i] & 1) << i;
+        return bits;
+#endif
+    }
+
+    SIMD::u8x16 m_control;
+};
+
+}
+
+template<typename TableType, typename T>
+class SwissHashTableIterator {
+    friend TableType;
+
+public:
+    bool operator==(SwissHashTableIterator const& other) const { return m_index == other.m_index; }
+    bool operator!=(SwissHashTableIterator const& other) const { return m_index != other.m_index; }
+    T& operator*() { return m_table->m_slots[m_index]; }
+    T* operator->() { return &m_table->m_slots[m_index]; }
+    void operator++()
+    {
+        m_index = m_table->next_full_slot(m_index + 1);
+    }
+
+private:
+    SwissHashTableIterator(TableType* table, size_t index)
+        : m_table(table)
+        , m_index(index)
+    {
+    }
+
+    TableType* m_table { nullptr };
+    size_t m_index { 0 };
+};
+
+// A set datastructure based on a hash table with open addressing, modeled after Abseil's SwissTable.
+// Unlike HashTable, the state of the slots is kept apart from the slots themselves, so that a lookup can check a whole
+// group of candidate slots with a single SIMD comparison before it touches any of the values. This makes it a good fit
+// for large tables that are mostly looked up in. Iteration order is unspecified, and insertion order isn't tracked.
+// For a map datastructure with key-value entries, see SwissHashMap.
+template<typename T, typename TraitsForT, bool IsOrdered>
+class SwissHashTable {
+    static_assert(!IsOrdered, "SwissHashTable does not keep track of insertion order");
+
+    using Group = Detail::SwissHashTableGroup;
+
+    static constexpr size_t minimum_capacity = Group::size;
+
+public:
+    SwissHashTable() = default;
+
+    explicit SwissHashTable(size_t capacity)
+    {
+        ensure_capacity(capacity);
+    }
+
+    ~SwissHashTable()
+    {
+        clear();
+    }
+
+    SwissHashTable(SwissHashTable const& other)
+    {
+        if (other.is_empty())
+            return;
+        ensure_capacity(other.size());
+        for (auto& value : other)
+            insert_new_value(TraitsForT::hash(value), value);
+    }
+
+    SwissHashTable& operator=(SwissHashTable const& other)
+    {
+        SwissHashTable temporary(other);
+        swap(*this, temporary);
+        return *this;
+    }
+
+    SwissHashTable(SwissHashTable&& other) noexcept
+        : m_slots(exchange(other.m_slots, nullptr))
+        , m_control(exchange(other.m_control, nullptr))
+        , m_capacity(exchange(other.m_capacity, 0))
+        , m_size(exchange(other.m_size, 0))
+        , m_growth_left(exchange(other.m_growth_left, 0))
+    {
+    }
+
+    SwissHashTable& operator=(SwissHashTable&& other) noexcept
+    {
+        SwissHashTable temporary { move(other) };
+        swap(*this, temporary);
+        return *this;
+    }
+
+    friend void swap(SwissHashTable& a, SwissHashTable& b) noexcept
+    {
+        AK::swap(a.m_slots, b.m_slots);
+        AK::swap(a.m_control, b.m_control);
+        AK::swap(a.m_capacity, b.m_capacity);
+        AK::swap(a.m_size, b.m_size);
+        AK::swap(a.m_growth_left, b.m_growth_left);
+    }
+
+    [[nodiscard]] bool is_empty() const { return m_size == 0; }
+    [[nodiscard]] size_t size() const { return m_size; }
+    [[nodiscard]] size_t capacity() const { return m_capacity; }
+
+    ErrorOr<void> try_ensure_capacity(size_t capacity)
+    {
+        auto new_capacity = capacity_for_size(capacity);
+        if (new_capacity <= m_capacity)
+            return {};
+        return try_rehash(new_capacity);
+    }
+
+    void ensure_capacity(size_t capacity)
+    {
+        MUST(try_ensure_capacity(capacity));
+    }
+
+    [[nodiscard]] bool contains(T const& value) const
+    {
+        return find(value) != end();
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] bool contains(K const& value) const
+    {
+        return find(value) != end();
+    }
+
+    using Iterator = SwissHashTableIterator<SwissHashTable, T>;
+    using ConstIterator = SwissHashTableIterator<SwissHashTable const, T const>;
+
+    [[nodiscard]] Iterator begin() { return Iterator(this, next_full_slot(0)); }
+    [[nodiscard]] Iterator end() { return Iterator(this, m_capacity); }
+    [[nodiscard]] ConstIterator begin() const { return ConstIterator(this, next_full_slot(0)); }
+    [[nodiscard]] ConstIterator end() const { return ConstIterator(this, m_capacity); }
+
+    void clear()
+    {
+        if (!m_slots)
+            return;
+        destroy_values();
+        kfree_sized(m_slots, allocation_size(m_capacity));
+        m_slots = nullptr;
+        m_control = nullptr;
+        m_capacity = 0;
+        m_size = 0;
+        m_growth_left = 0;
+    }
+
+    void clear_with_capacity()
+    {
+        if (!m_slots)
+            return;
+        destroy_values();
+        __builtin_memset(m_control, Group::empty, control_size(m_capacity));
+        m_size = 0;
+        m_growth_left = max_load(m_capacity);
+    }
+
+    template<typename U = T>
+    ErrorOr<HashSetResult> try_set(U&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace)
+    {
+        auto hash = TraitsForT::hash(value);
+        auto index = find_index(hash, [&](auto& other) { return TraitsForT::equals(other, static_cast<T const&>(value)); });
+        if (index != m_capacity) {
+            if (existing_entry_behavior == HashSetExistingEntryBehavior::Replace) {
+                m_slots[index] = forward<U>(value);
+                return HashSetResult::ReplacedExistingEntry;
+            }
+            return HashSetResult::KeptExistingEntry;
+        }
+
+        // A deleted slot can be reused without taking up any more of the table, but an empty one needs room to grow.
+        if (m_capacity == 0 || (m_growth_left == 0 && m_control[find_insertion_index(hash)] == Group::empty))
+            TRY(try_rehash(capacity_for_insertion()));
+
+        insert_new_value(hash, forward<U>(value));
+        return HashSetResult::InsertedNewEntry;
+    }
+
+    template<typename U = T>
+    HashSetResult set(U&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace)
+    {
+        return MUST(try_set(forward<U>(value), existing_entry_behavior));
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] Iterator find(unsigned hash, TUnaryPredicate predicate)
+    {
+        return Iterator(this, find_index(hash, predicate));
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] ConstIterator find(unsigned hash, TUnaryPredicate predicate) const
+    {
+        return ConstIterator(this, find_index(hash, predicate));
+    }
+
+    [[nodiscard]] Iterator find(T const& value)
+    {
+        return find(TraitsForT::hash(value), [&](auto& other) { return TraitsForT::equals(value, other); });
+    }
+
+    [[nodiscard]] ConstIterator find(T const& value) const
+    {
+        return find(TraitsForT::hash(value), [&](auto& other) { return TraitsForT::equals(value, other); });
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] Iterator find(K const& value)
+    {
+        return find(Traits<K>::hash(value), [&](auto& other) { return Traits<T>::equals(other, value); });
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] ConstIterator find(K const& value) const
+    {
+        return find(Traits<K>::hash(value), [&](auto& other) { return Traits<T>::equals(other, value); });
+    }
+
+    bool remove(T const& value)
+    {
+        auto it = find(value);
+        if (it == end())
+            return false;
+        remove(it);
+        return true;
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) bool remove(K const& value)
+    {
+        auto it = find(value);
+        if (it == end())
+            return false;
+        remove(it);
+        return true;
+    }
+
+    void remove(Iterator const& iterator)
+    {
+        VERIFY(iterator.m_index < m_capacity);
+        remove_at(iterator.m_index);
+    }
+
+    template<typename TUnaryPredicate>
+    bool remove_all_matching(TUnaryPredicate const& predicate)
+    {
+        bool has_removed_anything = false;
+        for (size_t i = next_full_slot(0); i < m_capacity; i = next_full_slot(i + 1)) {
+            if (predicate(m_slots[i])) {
+                remove_at(i);
+                has_removed_anything = true;
+            }
+        }
+        return has_removed_anything;
+    }
+
+private:
+    friend Iterator;
+    friend ConstIterator;
+
+    // Groups are visited at triangular offsets, which visits every group once when the number of groups is a power of two.
+    class ProbeSequence {
+    public:
+        ProbeSequence(size_t hash, size_t mask)
+            : m_mask(mask)
+            , m_offset(hash & mask)
+        {
+        }
+
+        size_t offset() const { return m_offset; }
+        size_t offset(size_t i) const { return (m_offset + i) & m_mask; }
+
+        void next()
+        {
+            m_index += Group::size;
+            m_offset = (m_offset + m_index) & m_mask;
+        }
+
+    private:
+        size_t m_mask { 0 };
+        size_t m_offset { 0 };
+        size_t m_index { 0 };
+    };
+
+    // The high bits of the hash select where to start probing, and the low seven bits are kept in the control bytes.
+    static size_t probe_start(unsigned hash) { return hash >> 7; }
+    static u8 control_for_hash(unsigned hash) { return hash & 0x7F; }
+
+    // We never fill more than 7/8 of the table, so that there always are empty slots to stop lookups.
+    static constexpr size_t max_load(size_t capacity) { return capacity - capacity / 8; }
+
+    static constexpr size_t capacity_for_size(size_t size)
+    {
+        size_t capacity = minimum_capacity;
+        while (max_load(capacity) < size)
+            capacity *= 2;
+        return capacity;
+    }
+
+    // The control bytes of the first group are repeated after the last slot, so that any group can be loaded starting
+    // at any slot without having to wrap around.
+    static constexpr size_t control_size(size_t capacity) { return capacity + Group::size - 1; }
+    static constexpr size_t allocation_size(size_t capacity) { return capacity * sizeof(T) + control_size(capacity); }
+
+    size_t capacity_for_insertion() const
+    {
+        // If most of the table is taken up by deleted slots, clearing those out makes enough room.
+        if (m_capacity != 0 && m_size + 1 <= max_load(m_capacity) / 2)
+            return m_capacity;
+        return capacity_for_size(m_size + 1);
+    }
+
+    size_t next_full_slot(size_t index) const
+    {
+        while (index < m_capacity && !Group::is_full(m_control[index]))
+            ++index;
+        return index;
+    }
+
+    template<typename TUnaryPredicate>
+    size_t find_index(unsigned hash, TUnaryPredicate const& predicate) const
+    {
+        if (m_size == 0)
+            return m_capacity;
+
+        auto control = control_for_hash(hash);
+        for (ProbeSequence probe(probe_start(hash), m_capacity - 1);; probe.next()) {
+            Group group { m_control + probe.offset() };
+            for (auto matches = group.match(control); matches != 0; matches &= matches - 1) {
+                auto index = probe.offset(count_trailing_zeroes(matches));
+                if (predicate(m_slots[index]))
+                    return index;
+            }
+            if (group.match_empty() != 0)
+                return m_capacity;
+        }
+    }
+
+    size_t find_insertion_index(unsigned hash) const
+    {
+        for (ProbeSequence probe(probe_start(hash), m_capacity - 1);; probe.next()) {
+            Group group { m_control + probe.offset() };
+            if (auto candidates = group.match_empty_or_deleted(); candidates != 0)
+                return probe.offset(count_trailing_zeroes(candidates));
+        }
+    }
+
+    template<typename U>
+    void insert_new_value(unsigned hash, U&& value)
+    {
+        auto index = find_insertion_index(hash);
+        if (m_control[index] == Group::empty)
+            --m_growth_left;
+        new (&m_slots[index]) T(forward<U>(value));
+        set_control(index, control_for_hash(hash));
+        ++m_size;
+    }
+
+    void remove_at(size_t index)
+    {
+        m_slots[index].~T();
+        // If this slot was never part of a full group, no lookup can have probed past it, so it can become empty again.
+        auto index_before = (index - Group::size) & (m_capacity - 1);
+        auto empty_after = Group { m_control + index }.match_empty();
+        auto empty_before = Group { m_control + index_before }.match_empty();
+        bool was_never_full = empty_before != 0 && empty_after != 0
+            && (count_trailing_zeroes(empty_after) + count_leading_zeroes(empty_before << 16)) < Group::size;
+        if (was_never_full) {
+            set_control(index, Group::empty);
+            ++m_growth_left;
+        } else {
+            set_control(index, Group::deleted);
+        }
+        --m_size;
+    }
+
+    void set_control(size_t index, u8 control)
+    {
+        m_control[index] = control;
+        // This writes the repeated control byte for the first slots, and writes the same byte again for all others.
+        m_control[((index - (Group::size - 1)) & (m_capacity - 1)) + (Group::size - 1)] = control;
+    }
+
+    void destroy_values()
+    {
+        if constexpr (!IsTriviallyDestructible<T>) {
+            for (size_t i = next_full_slot(0); i < m_capacity; i = next_full_slot(i + 1))
+                m_slots[i].~T();
+        }
+    }
+
+    ErrorOr<void> try_rehash(size_t new_capacity)
+    {
+        VERIFY(new_capacity >= minimum_capacity && is_power_of_two(new_capacity));
+        VERIFY(max_load(new_capacity) >= m_size);
+
+        auto* new_allocation = static_cast<u8*>(kmalloc(allocation_size(new_capacity)));
+        if (!new_allocation)
+            return Error::from_errno(ENOMEM);
+
+        auto* old_slots = m_slots;
+        auto* old_control = m_control;
+        auto old_capacity = m_capacity;
+
+        m_slots = reinterpret_cast<T*>(new_allocation);
+        m_control = new_allocation + new_capacity * sizeof(T);
+        m_capacity = new_capacity;
+        m_growth_left = max_load(new_capacity) - m_size;
+        __builtin_memset(m_control, Group::empty, control_size(new_capacity));
+
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (!Group::is_full(old_control[i]))
+                continue;
+            auto& value = old_slots[i];
+            auto hash = TraitsForT::hash(value);
+            auto index = find_insertion_index(hash);
+            new (&m_slots[index]) T(move(value));
+            set_control(index, control_for_hash(hash));
+            value.~T();
+        }
+
+        if (old_slots)
+            kfree_sized(old_slots, allocation_size(old_capacity));
+        return {};
+    }
+
+    T* m_slots { nullptr };
+    u8* m_control { nullptr };
+    size_t m_capacity { 0 };
+    size_t m_size { 0 };
+    size_t m_growth_left { 0 };
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::SwissHashMap;
+using AK::SwissHashTable;
+#endif
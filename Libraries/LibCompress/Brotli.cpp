@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCompress/Brotli.h>
+
+#include <brotli/decode.h>
+#include <brotli/encode.h>
+
+namespace Compress {
+
+ErrorOr<NonnullOwnPtr<BrotliDecompressor>> BrotliDecompressor::create(MaybeOwned<Stream> stream)
+{
+    auto buffer = TRY(AK::FixedArray<u8>::create(16 * 1024));
+    auto* state = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+    if (!state)
+        return Error::from_errno(ENOMEM);
+    return adopt_nonnull_own_or_enomem(new (nothrow) BrotliDecompressor(move(buffer), move(stream), state));
+}
+
+ErrorOr<ByteBuffer> BrotliDecompressor::decompress_all(ReadonlyBytes bytes)
+{
+    return ::Compress::decompress_all<BrotliDecompressor>(bytes);
+}
+
+BrotliDecompressor::BrotliDecompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, BrotliDecoderState* state)
+    : m_stream(move(stream))
+    , m_state(state)
+    , m_buffer(move(buffer))
+{
+}
+
+BrotliDecompressor::~BrotliDecompressor()
+{
+    BrotliDecoderDestroyInstance(m_state);
+}
+
+ErrorOr<Bytes> BrotliDecompressor::read_some(Bytes bytes)
+{
+    return decompress_some(bytes, InputIsComplete::Yes);
+}
+
+ErrorOr<Bytes> BrotliDecompressor::read_some_available(Bytes bytes)
+{
+    return decompress_some(bytes, InputIsComplete::No);
+}
+
+ErrorOr<Bytes> BrotliDecompressor::decompress_some(Bytes bytes, InputIsComplete input_is_complete)
+{
+    if (m_eof)
+        return bytes.trim(0);
+
+    size_t available_out = bytes.size();
+    u8* next_out = bytes.data();
+
+    while (true) {
+        if (m_input.is_empty())
+            m_input = TRY(m_stream->read_some(m_buffer.span()));
+
+        size_t available_in = m_input.size();
+        u8 const* next_in = m_input.data();
+        auto result = BrotliDecoderDecompressStream(m_state, &available_in, &next_in, &available_out, &next_out, nullptr);
+        m_input = m_input.slice(m_input.size() - available_in);
+
+        auto decompressed = bytes.trim(bytes.size() - available_out);
+        switch (result) {
+        case BROTLI_DECODER_RESULT_ERROR:
+            return Error::from_string_literal("Brotli data error");
+        case BROTLI_DECODER_RESULT_SUCCESS:
+            m_eof = true;
+            return decompressed;
+        case BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT:
+            return decompressed;
+        case BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT:
+            if (!decompressed.is_empty())
+                return decompressed;
+            if (!m_stream->is_eof())
+                continue;
+            if (input_is_complete == InputIsComplete::No)
+                return decompressed;
+            return Error::from_string_literal("Brotli data ended unexpectedly");
+        }
+        VERIFY_NOT_REACHED();
+    }
+}
+
+ErrorOr<size_t> BrotliDecompressor::write_some(ReadonlyBytes)
+{
+    return Error::from_errno(EBADF);
+}
+
+bool BrotliDecompressor::is_eof() const
+{
+    return m_eof;
+}
+
+bool BrotliDecompressor::is_open() const
+{
+    return m_stream->is_open();
+}
+
+void BrotliDecompressor::close()
+{
+}
+
+static u32 to_brotli_quality(GenericZlibCompressionLevel compression_level)
+{
+    // NOTE: Brotli's own default is its best quality, which is far too slow for compressing data on the fly.
+    switch (compression_level) {
+    case GenericZlibCompressionLevel::Fastest:
+        return 1;
+    case GenericZlibCompressionLevel::Default:
+        return 5;
+    case GenericZlibCompressionLevel::Best:
+        return BROTLI_MAX_QUALITY;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+ErrorOr<NonnullOwnPtr<BrotliCompressor>> BrotliCompressor::create(MaybeOwned<Stream> stream, GenericZlibCompressionLevel compression_level)
+{
+    auto buffer = TRY(AK::FixedArray<u8>::create(16 * 1024));
+    auto* state = BrotliEncoderCreateInstance(nullptr, nullptr, nullptr);
+    if (!state)
+        return Error::from_errno(ENOMEM);
+    if (!BrotliEncoderSetParameter(state, BROTLI_PARAM_QUALITY, to_brotli_quality(compression_level))) {
+        BrotliEncoderDestroyInstance(state);
+        return Error::from_string_literal("Unable to set Brotli compression quality");
+    }
+    return adopt_nonnull_own_or_enomem(new (nothrow) BrotliCompressor(move(buffer), move(stream), state));
+}
+
+ErrorOr<ByteBuffer> BrotliCompressor::compress_all(ReadonlyBytes bytes, GenericZlibCompressionLevel compression_level)
+{
+    auto output_stream = TRY(try_make<AllocatingMemoryStream>());
+    auto brotli_stream = TRY(BrotliCompressor::create(MaybeOwned { *output_stream }, compression_level));
+
+    TRY(brotli_stream->write_until_depleted(bytes));
+    TRY(brotli_stream->finish());
+
+    auto buffer = TRY(ByteBuffer::create_uninitialized(output_stream->used_buffer_size()));
+    TRY(output_stream->read_until_filled(buffer.bytes()));
+
+    return buffer;
+}
+
+BrotliCompressor::BrotliCompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, BrotliEncoderState* state)
+    : m_stream(move(stream))
+    , m_state(state)
+    , m_buffer(move(buffer))
+{
+}
+
+BrotliCompressor::~BrotliCompressor()
+{
+    BrotliEncoderDestroyInstance(m_state);
+}
+
+ErrorOr<void> BrotliCompressor::compress(ReadonlyBytes bytes, bool finish)
+{
+    auto operation = finish ? BROTLI_OPERATION_FINISH : BROTLI_OPERATION_PROCESS;
+    size_t available_in = bytes.size();
+    u8 const* next_in = bytes.data();
+
+    // The encoder has to be called until it has consumed all input and has no more output pending, and when finishing,
+    // until the stream has been finished.
+    while (true) {
+        size_t available_out = m_buffer.size();
+        u8* next_out = m_buffer.data();
+        if (!BrotliEncoderCompressStream(m_state, operation, &available_in, &next_in, &available_out, &next_out, nullptr))
+            return Error::from_string_literal("Brotli compression failed");
+
+        TRY(m_stream->write_until_depleted(m_buffer.span().trim(m_buffer.size() - available_out)));
+
+        if (available_in != 0 || BrotliEncoderHasMoreOutput(m_state))
+            continue;
+        if (!finish || BrotliEncoderIsFinished(m_state))
+            return {};
+    }
+}
+
+ErrorOr<Bytes> BrotliCompressor::read_some(Bytes)
+{
+    return Error::from_errno(EBADF);
+}
+
+ErrorOr<size_t> BrotliCompressor::write_some(ReadonlyBytes bytes)
+{
+    TRY(compress(bytes, false));
+    return bytes.size();
+}
+
+bool BrotliCompressor::is_eof() const
+{
+    return false;
+}
+
+bool BrotliCompressor::is_open() const
+{
+    return m_stream->is_open();
+}
+
+void BrotliCompressor::close()
+{
+}
+
+ErrorOr<void> BrotliCompressor::finish()
+{
+    return compress({}, true);
+}
+
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/FixedArray.h>
+#include <AK/MaybeOwned.h>
+#include <AK/Stream.h>
+#include <LibCompress/GenericZlib.h>
+
+extern "C" {
+typedef struct BrotliDecoderStateStruct BrotliDecoderState;
+typedef struct BrotliEncoderStateStruct BrotliEncoderState;
+}
+
+namespace Compress {
+
+class BrotliDecompressor final : public Stream {
+    AK_MAKE_NONCOPYABLE(BrotliDecompressor);
+
+public:
+    static ErrorOr<NonnullOwnPtr<BrotliDecompressor>> create(MaybeOwned<Stream>);
+    static ErrorOr<ByteBuffer> decompress_all(ReadonlyBytes);
+
+    ~BrotliDecompressor() override;
+
+    virtual ErrorOr<Bytes> read_some(Bytes) override;
+    virtual ErrorOr<size_t> write_some(ReadonlyBytes) override;
+    virtual bool is_eof() const override;
+    virtual bool is_open() const override;
+    virtual void close() override;
+
+    // See GenericZlibDecompressor::read_some_available().
+    ErrorOr<Bytes> read_some_available(Bytes);
+
+private:
+    BrotliDecompressor(AK::FixedArray<u8>, MaybeOwned<Stream>, BrotliDecoderState*);
+
+    enum class InputIsComplete {
+        No,
+        Yes,
+    };
+    ErrorOr<Bytes> decompress_some(Bytes, InputIsComplete);
+
+    MaybeOwned<Stream> m_stream;
+    BrotliDecoderState* m_state { nullptr };
+
+    bool m_eof { false };
+
+    AK::FixedArray<u8> m_buffer;
+    ReadonlyBytes m_input;
+};
+
+class BrotliCompressor final : public Stream {
+    AK_MAKE_NONCOPYABLE(BrotliCompressor);
+
+public:
+    static ErrorOr<NonnullOwnPtr<BrotliCompressor>> create(MaybeOwned<Stream>, GenericZlibCompressionLevel = GenericZlibCompressionLevel::Default);
+    static ErrorOr<ByteBuffer> compress_all(ReadonlyBytes, GenericZlibCompressionLevel = GenericZlibCompressionLevel::Default);
+
+    ~BrotliCompressor() override;
+
+    virtual ErrorOr<Bytes> read_some(Bytes) override;
+    virtual ErrorOr<size_t> write_some(ReadonlyBytes) override;
+    virtual bool is_eof() const override;
+    virtual bool is_open() const override;
+    virtual void close() override;
+    ErrorOr<void> finish();
+
+private:
+    BrotliCompressor(AK::FixedArray<u8>, MaybeOwned<Stream>, BrotliEncoderState*);
+
+    ErrorOr<void> compress(ReadonlyBytes, bool finish);
+
+    MaybeOwned<Stream> m_stream;
+    BrotliEncoderState* m_state { nullptr };
+
+    AK::FixedArray<u8> m_buffer;
+};
+
+}
@@ -69,6 +69,8 @@ private:
 
 class DeflateCompressor final : public GenericZlibCompressor {
 public:
+    static constexpr GenericZlibFormat format = GenericZlibFormat::Deflate;
+
     static ErrorOr<NonnullOwnPtr<DeflateCompressor>> create(MaybeOwned<Stream>, GenericZlibCompressionLevel = GenericZlibCompressionLevel::Default);
     static ErrorOr<ByteBuffer> compress_all(ReadonlyBytes, GenericZlibCompressionLevel = GenericZlibCompressionLevel::Default);
 
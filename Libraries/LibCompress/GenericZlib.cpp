@@ -4,7 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
+#include <AK/Endian.h>
+#include <AK/ScopeGuard.h>
 #include <LibCompress/GenericZlib.h>
+#include <LibCore/System.h>
+#include <LibThreading/Thread.h>
 
 #include <zlib.h>
 
@@ -68,6 +73,16 @@ GenericZlibDecompressor::~GenericZlibDecompressor()
 }
 
 ErrorOr<Bytes> GenericZlibDecompressor::read_some(Bytes bytes)
+{
+    return decompress_some(bytes, InputIsComplete::Yes);
+}
+
+ErrorOr<Bytes> GenericZlibDecompressor::read_some_available(Bytes bytes)
+{
+    return decompress_some(bytes, InputIsComplete::No);
+}
+
+ErrorOr<Bytes> GenericZlibDecompressor::decompress_some(Bytes bytes, InputIsComplete input_is_complete)
 {
     m_zstream->avail_out = bytes.size();
     m_zstream->next_out = bytes.data();
@@ -85,8 +100,11 @@ ErrorOr<Bytes> GenericZlibDecompressor::read_some(Bytes bytes)
 
     // We got Z_BUF_ERROR (no progress was possible), no more input, stream is EOF and no output was produced.
     // There is no way to get out of this loop, error out.
-    if (ret == Z_BUF_ERROR && m_zstream->avail_in == 0 && m_stream->is_eof() && bytes.size() == m_zstream->avail_out)
+    if (ret == Z_BUF_ERROR && m_zstream->avail_in == 0 && m_stream->is_eof() && bytes.size() == m_zstream->avail_out) {
+        if (input_is_complete == InputIsComplete::No)
+            return bytes.trim(0);
         return Error::from_string_literal("No decompression progress on EOF stream");
+    }
 
     if (ret == Z_STREAM_END) {
         inflateReset(m_zstream);
@@ -123,6 +141,19 @@ GenericZlibCompressor::GenericZlibCompressor(AK::FixedArray<u8> buffer, MaybeOwn
 {
 }
 
+static int to_zlib_level(GenericZlibCompressionLevel compression_level)
+{
+    switch (compression_level) {
+    case GenericZlibCompressionLevel::Fastest:
+        return Z_BEST_SPEED;
+    case GenericZlibCompressionLevel::Default:
+        return Z_DEFAULT_COMPRESSION;
+    case GenericZlibCompressionLevel::Best:
+        return Z_BEST_COMPRESSION;
+    }
+    VERIFY_NOT_REACHED();
+}
+
 ErrorOr<z_stream*> GenericZlibCompressor::new_z_stream(int window_bits, GenericZlibCompressionLevel compression_level)
 {
     auto zstream = new (nothrow) z_stream {};
@@ -134,20 +165,7 @@ ErrorOr<z_stream*> GenericZlibCompressor::new_z_stream(int window_bits, GenericZ
     zstream->zfree = nullptr;
     zstream->opaque = nullptr;
 
-    int level = [&] {
-        switch (compression_level) {
-        case GenericZlibCompressionLevel::Fastest:
-            return Z_BEST_SPEED;
-        case GenericZlibCompressionLevel::Default:
-            return Z_DEFAULT_COMPRESSION;
-        case GenericZlibCompressionLevel::Best:
-            return Z_BEST_COMPRESSION;
-        default:
-            VERIFY_NOT_REACHED();
-        }
-    }();
-
-    if (auto ret = deflateInit2(zstream, level, Z_DEFLATED, window_bits, MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY); ret != Z_OK)
+    if (auto ret = deflateInit2(zstream, to_zlib_level(compression_level), Z_DEFLATED, window_bits, MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY); ret != Z_OK)
         return handle_zlib_error(ret);
 
     return zstream;
@@ -225,4 +243,166 @@ ErrorOr<void> GenericZlibCompressor::finish()
     }
 }
 
+// Blocks are compressed independently of each other, so the smaller they are the more threads can work on them at once,
+// but the more often deflate has to start over with fresh Huffman tables.
+static constexpr size_t parallel_compression_block_size = 128 * KiB;
+
+// The largest distance a deflate back reference can reach, and so the most of the previous block a block can refer to.
+static constexpr size_t deflate_window_size = 32 * KiB;
+
+struct CompressedBlock {
+    ByteBuffer data;
+    u32 checksum { 0 };
+};
+
+static ErrorOr<CompressedBlock> compress_block(ReadonlyBytes input, ReadonlyBytes dictionary, GenericZlibFormat format, GenericZlibCompressionLevel compression_level, bool is_last_block)
+{
+    z_stream zstream {};
+    if (auto ret = deflateInit2(&zstream, to_zlib_level(compression_level), Z_DEFLATED, -MAX_WBITS, MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY); ret != Z_OK)
+        return handle_zlib_error(ret);
+    ScopeGuard end_zstream = [&] { deflateEnd(&zstream); };
+
+    // Priming the block with the end of the previous one lets it use back references into it, exactly like a single
+    // deflate stream would. The decompressor has that data in its window already, so it doesn't need to know.
+    if (!dictionary.is_empty()) {
+        if (auto ret = deflateSetDictionary(&zstream, dictionary.data(), dictionary.size()); ret != Z_OK)
+            return handle_zlib_error(ret);
+    }
+
+    // A sync flush ends every block but the last one with an empty stored block, which leaves the output on a byte
+    // boundary so that the next block can simply be appended to it.
+    auto flush = is_last_block ? Z_FINISH : Z_SYNC_FLUSH;
+    auto output = TRY(ByteBuffer::create_uninitialized(deflateBound(&zstream, input.size()) + 16));
+    size_t output_size = 0;
+
+    zstream.next_in = const_cast<u8*>(input.data());
+    zstream.avail_in = input.size();
+    while (true) {
+        if (output_size == output.size())
+            TRY(output.try_resize(output.size() * 2));
+        zstream.next_out = output.data() + output_size;
+        zstream.avail_out = output.size() - output_size;
+
+        auto ret = deflate(&zstream, flush);
+        if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR)
+            return handle_zlib_error(ret);
+
+        output_size = output.size() - zstream.avail_out;
+        if (is_last_block ? ret == Z_STREAM_END : zstream.avail_out != 0)
+            break;
+    }
+    output.trim(output_size, false);
+
+    u32 checksum = 0;
+    if (format == GenericZlibFormat::Zlib)
+        checksum = adler32(adler32(0, nullptr, 0), input.data(), input.size());
+    else if (format == GenericZlibFormat::Gzip)
+        checksum = crc32(crc32(0, nullptr, 0), input.data(), input.size());
+
+    return CompressedBlock { move(output), checksum };
+}
+
+static ErrorOr<void> write_header(ByteBuffer& output, GenericZlibFormat format, GenericZlibCompressionLevel compression_level)
+{
+    switch (format) {
+    case GenericZlibFormat::Deflate:
+        return {};
+    case GenericZlibFormat::Zlib: {
+        // CMF: deflate with a 32 KiB window, and FLG: the compression level and a check value.
+        u8 level_flags = 0;
+        switch (compression_level) {
+        case GenericZlibCompressionLevel::Fastest:
+            level_flags = 0;
+            break;
+        case GenericZlibCompressionLevel::Default:
+            level_flags = 2;
+            break;
+        case GenericZlibCompressionLevel::Best:
+            level_flags = 3;
+            break;
+        }
+        u8 cmf = 0x78;
+        u8 flg = level_flags << 6;
+        flg |= (31 - ((cmf << 8) | flg) % 31) % 31;
+        return output.try_append(Array<u8, 2> { cmf, flg });
+    }
+    case GenericZlibFormat::Gzip: {
+        u8 extra_flags = 0;
+        if (compression_level == GenericZlibCompressionLevel::Best)
+            extra_flags = 2;
+        else if (compression_level == GenericZlibCompressionLevel::Fastest)
+            extra_flags = 4;
+        // ID1, ID2, deflate, no flags, no modification time, extra flags, unknown operating system.
+        return output.try_append(Array<u8, 10> { 0x1f, 0x8b, 0x08, 0, 0, 0, 0, 0, extra_flags, 0xff });
+    }
+    }
+    VERIFY_NOT_REACHED();
+}
+
+ErrorOr<ByteBuffer> compress_all_in_parallel(ReadonlyBytes bytes, GenericZlibFormat format, GenericZlibCompressionLevel compression_level)
+{
+    auto block_count = max(ceil_div(bytes.size(), parallel_compression_block_size), 1uz);
+    auto block_input = [&](size_t block) {
+        auto offset = block * parallel_compression_block_size;
+        return bytes.slice(offset, min(parallel_compression_block_size, bytes.size() - offset));
+    };
+
+    Vector<Optional<ErrorOr<CompressedBlock>>> blocks;
+    TRY(blocks.try_resize(block_count));
+
+    Atomic<size_t> next_block { 0 };
+    auto compress_blocks = [&]() -> intptr_t {
+        while (true) {
+            auto block = next_block.fetch_add(1, AK::memory_order_relaxed);
+            if (block >= block_count)
+                return 0;
+
+            ReadonlyBytes dictionary;
+            if (block > 0)
+                dictionary = bytes.slice(block * parallel_compression_block_size - deflate_window_size, deflate_window_size);
+            blocks[block] = compress_block(block_input(block), dictionary, format, compression_level, block == block_count - 1);
+        }
+    };
+
+    // This thread does its share of the work too.
+    Vector<NonnullRefPtr<Threading::Thread>> threads;
+    for (size_t i = 1; i < min(static_cast<size_t>(Core::System::hardware_concurrency()), block_count); ++i) {
+        auto thread = Threading::Thread::try_create([&] { return compress_blocks(); }, "Compressor"sv);
+        if (thread.is_error())
+            break;
+        thread.value()->start();
+        threads.append(thread.release_value());
+    }
+
+    compress_blocks();
+
+    for (auto& thread : threads)
+        (void)thread->join();
+
+    ByteBuffer output;
+    TRY(write_header(output, format, compression_level));
+
+    u32 checksum = format == GenericZlibFormat::Zlib ? adler32(0, nullptr, 0) : crc32(0, nullptr, 0);
+    for (size_t block = 0; block < block_count; ++block) {
+        auto compressed_block = TRY(blocks[block].release_value());
+        TRY(output.try_append(compressed_block.data));
+
+        auto input_size = static_cast<z_off_t>(block_input(block).size());
+        if (format == GenericZlibFormat::Zlib)
+            checksum = adler32_combine(checksum, compressed_block.checksum, input_size);
+        else if (format == GenericZlibFormat::Gzip)
+            checksum = crc32_combine(checksum, compressed_block.checksum, input_size);
+    }
+
+    if (format == GenericZlibFormat::Zlib) {
+        BigEndian<u32> trailer = checksum;
+        TRY(output.try_append(&trailer, sizeof(trailer)));
+    } else if (format == GenericZlibFormat::Gzip) {
+        Array<LittleEndian<u32>, 2> trailer { checksum, static_cast<u32>(bytes.size()) };
+        TRY(output.try_append(trailer.data(), sizeof(trailer)));
+    }
+
+    return output;
+}
+
 }
@@ -24,6 +24,12 @@ enum class GenericZlibCompressionLevel : u8 {
     Best,
 };
 
+enum class GenericZlibFormat : u8 {
+    Deflate,
+    Zlib,
+    Gzip,
+};
+
 class GenericZlibDecompressor : public Stream {
     AK_MAKE_NONCOPYABLE(GenericZlibDecompressor);
 
@@ -36,12 +42,22 @@ public:
     virtual bool is_open() const override;
     virtual void close() override;
 
+    // Like read_some(), but for input that is still arriving: running out of input without reaching the end of the
+    // compressed data is not an error, and just returns an empty span until more input has been written to the stream.
+    ErrorOr<Bytes> read_some_available(Bytes);
+
 protected:
     GenericZlibDecompressor(AK::FixedArray<u8>, MaybeOwned<Stream>, z_stream*);
 
     static ErrorOr<z_stream*> new_z_stream(int window_bits);
 
 private:
+    enum class InputIsComplete {
+        No,
+        Yes,
+    };
+    ErrorOr<Bytes> decompress_some(Bytes, InputIsComplete);
+
     MaybeOwned<Stream> m_stream;
     z_stream* m_zstream;
 
@@ -83,9 +99,19 @@ ErrorOr<ByteBuffer> decompress_all(ReadonlyBytes bytes)
     return TRY(deflate_stream->read_until_eof(4096));
 }
 
+// Inputs at least this large are split into blocks that are compressed on several threads at once.
+static constexpr size_t minimum_size_for_parallel_compression = 1 * MiB;
+
+// Compresses the input as independent blocks on as many threads as there are cores, each block using the end of the
+// previous one as its dictionary, and stitches them back together into a single stream in the given format.
+ErrorOr<ByteBuffer> compress_all_in_parallel(ReadonlyBytes, GenericZlibFormat, GenericZlibCompressionLevel);
+
 template<class T>
 ErrorOr<ByteBuffer> compress_all(ReadonlyBytes bytes, GenericZlibCompressionLevel compression_level)
 {
+    if (bytes.size() >= minimum_size_for_parallel_compression)
+        return compress_all_in_parallel(bytes, T::format, compression_level);
+
     auto output_stream = TRY(try_make<AllocatingMemoryStream>());
     auto gzip_stream = TRY(T::create(MaybeOwned { *output_stream }, compression_level));
 
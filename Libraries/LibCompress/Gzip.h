@@ -28,6 +28,8 @@ private:
 
 class GzipCompressor final : public GenericZlibCompressor {
 public:
+    static constexpr GenericZlibFormat format = GenericZlibFormat::Gzip;
+
     static ErrorOr<NonnullOwnPtr<GzipCompressor>> create(MaybeOwned<Stream>, GenericZlibCompressionLevel = GenericZlibCompressionLevel::Default);
     static ErrorOr<ByteBuffer> compress_all(ReadonlyBytes, GenericZlibCompressionLevel = GenericZlibCompressionLevel::Default);
 
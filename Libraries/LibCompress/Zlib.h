@@ -28,6 +28,8 @@ private:
 
 class ZlibCompressor final : public GenericZlibCompressor {
 public:
+    static constexpr GenericZlibFormat format = GenericZlibFormat::Zlib;
+
     static ErrorOr<NonnullOwnPtr<ZlibCompressor>> create(MaybeOwned<Stream>, GenericZlibCompressionLevel = GenericZlibCompressionLevel::Default);
     static ErrorOr<ByteBuffer> compress_all(ReadonlyBytes, GenericZlibCompressionLevel = GenericZlibCompressionLevel::Default);
 
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCompress/Zstd.h>
+
+#include <string.h>
+#include <zstd.h>
+
+namespace Compress {
+
+static Error zstd_error(size_t result)
+{
+    // NOTE: zstd's error names are string literals, so they outlive the error.
+    auto const* name = ZSTD_getErrorName(result);
+    return Error::from_string_view({ name, strlen(name) });
+}
+
+ErrorOr<NonnullOwnPtr<ZstdDecompressor>> ZstdDecompressor::create(MaybeOwned<Stream> stream)
+{
+    auto buffer = TRY(AK::FixedArray<u8>::create(ZSTD_DStreamInSize()));
+    auto* context = ZSTD_createDCtx();
+    if (!context)
+        return Error::from_errno(ENOMEM);
+    return adopt_nonnull_own_or_enomem(new (nothrow) ZstdDecompressor(move(buffer), move(stream), context));
+}
+
+ErrorOr<ByteBuffer> ZstdDecompressor::decompress_all(ReadonlyBytes bytes)
+{
+    return ::Compress::decompress_all<ZstdDecompressor>(bytes);
+}
+
+ZstdDecompressor::ZstdDecompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, ZSTD_DCtx* context)
+    : m_stream(move(stream))
+    , m_context(context)
+    , m_buffer(move(buffer))
+{
+}
+
+ZstdDecompressor::~ZstdDecompressor()
+{
+    ZSTD_freeDCtx(m_context);
+}
+
+ErrorOr<Bytes> ZstdDecompressor::read_some(Bytes bytes)
+{
+    return decompress_some(bytes, InputIsComplete::Yes);
+}
+
+ErrorOr<Bytes> ZstdDecompressor::read_some_available(Bytes bytes)
+{
+    return decompress_some(bytes, InputIsComplete::No);
+}
+
+ErrorOr<Bytes> ZstdDecompressor::decompress_some(Bytes bytes, InputIsComplete input_is_complete)
+{
+    if (m_eof)
+        return bytes.trim(0);
+
+    ZSTD_outBuffer output { bytes.data(), bytes.size(), 0 };
+
+    while (true) {
+        if (m_input.is_empty())
+            m_input = TRY(m_stream->read_some(m_buffer.span()));
+
+        // NOTE: Calling the decoder again after a frame has ended would start a new one, so between frames we only carry on
+        //       once there is more input.
+        if (m_input.is_empty() && !m_frame_in_progress) {
+            if (!m_stream->is_eof())
+                continue;
+            if (input_is_complete == InputIsComplete::Yes)
+                m_eof = true;
+            break;
+        }
+
+        // NOTE: Within a frame, this is called even without new input, as the decoder may still have output left over from the last call.
+        ZSTD_inBuffer input { m_input.data(), m_input.size(), 0 };
+        auto result = ZSTD_decompressStream(m_context, &output, &input);
+        if (ZSTD_isError(result))
+            return zstd_error(result);
+        m_input = m_input.slice(input.pos);
+
+        // A result of 0 means that a frame was completely decoded and flushed.
+        m_frame_in_progress = result != 0;
+
+        if (output.pos != 0)
+            break;
+        if (!m_frame_in_progress || !m_input.is_empty() || !m_stream->is_eof())
+            continue;
+        if (input_is_complete == InputIsComplete::No)
+            break;
+        return Error::from_string_literal("zstd data ended unexpectedly");
+    }
+
+    return bytes.trim(output.pos);
+}
+
+ErrorOr<size_t> ZstdDecompressor::write_some(ReadonlyBytes)
+{
+    return Error::from_errno(EBADF);
+}
+
+bool ZstdDecompressor::is_eof() const
+{
+    return m_eof;
+}
+
+bool ZstdDecompressor::is_open() const
+{
+    return m_stream->is_open();
+}
+
+void ZstdDecompressor::close()
+{
+}
+
+static int to_zstd_level(GenericZlibCompressionLevel compression_level)
+{
+    switch (compression_level) {
+    case GenericZlibCompressionLevel::Fastest:
+        return 1;
+    case GenericZlibCompressionLevel::Default:
+        return ZSTD_CLEVEL_DEFAULT;
+    case GenericZlibCompressionLevel::Best:
+        // NOTE: The levels above this one need a lot more memory to decompress, so they are not used by default by
+        //       the reference implementation either.
+        return 19;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+ErrorOr<NonnullOwnPtr<ZstdCompressor>> ZstdCompressor::create(MaybeOwned<Stream> stream, GenericZlibCompressionLevel compression_level)
+{
+    auto buffer = TRY(AK::FixedArray<u8>::create(ZSTD_CStreamOutSize()));
+    auto* context = ZSTD_createCCtx();
+    if (!context)
+        return Error::from_errno(ENOMEM);
+    if (auto result = ZSTD_CCtx_setParameter(context, ZSTD_c_compressionLevel, to_zstd_level(compression_level)); ZSTD_isError(result)) {
+        ZSTD_freeCCtx(context);
+        return zstd_error(result);
+    }
+    return adopt_nonnull_own_or_enomem(new (nothrow) ZstdCompressor(move(buffer), move(stream), context));
+}
+
+ErrorOr<ByteBuffer> ZstdCompressor::compress_all(ReadonlyBytes bytes, GenericZlibCompressionLevel compression_level)
+{
+    auto output_stream = TRY(try_make<AllocatingMemoryStream>());
+    auto zstd_stream = TRY(ZstdCompressor::create(MaybeOwned { *output_stream }, compression_level));
+
+    TRY(zstd_stream->write_until_depleted(bytes));
+    TRY(zstd_stream->finish());
+
+    auto buffer = TRY(ByteBuffer::create_uninitialized(output_stream->used_buffer_size()));
+    TRY(output_stream->read_until_filled(buffer.bytes()));
+
+    return buffer;
+}
+
+ZstdCompressor::ZstdCompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, ZSTD_CCtx* context)
+    : m_stream(move(stream))
+    , m_context(context)
+    , m_buffer(move(buffer))
+{
+}
+
+ZstdCompressor::~ZstdCompressor()
+{
+    ZSTD_freeCCtx(m_context);
+}
+
+ErrorOr<Bytes> ZstdCompressor::read_some(Bytes)
+{
+    return Error::from_errno(EBADF);
+}
+
+ErrorOr<size_t> ZstdCompressor::write_some(ReadonlyBytes bytes)
+{
+    ZSTD_inBuffer input { bytes.data(), bytes.size(), 0 };
+
+    while (input.pos != input.size) {
+        ZSTD_outBuffer output { m_buffer.data(), m_buffer.size(), 0 };
+        auto result = ZSTD_compressStream2(m_context, &output, &input, ZSTD_e_continue);
+        if (ZSTD_isError(result))
+            return zstd_error(result);
+        TRY(m_stream->write_until_depleted(m_buffer.span().trim(output.pos)));
+    }
+
+    return bytes.size();
+}
+
+bool ZstdCompressor::is_eof() const
+{
+    return false;
+}
+
+bool ZstdCompressor::is_open() const
+{
+    return m_stream->is_open();
+}
+
+void ZstdCompressor::close()
+{
+}
+
+ErrorOr<void> ZstdCompressor::finish()
+{
+    ZSTD_inBuffer input { nullptr, 0, 0 };
+
+    // A result of 0 means that the frame has been ended and everything has been flushed.
+    while (true) {
+        ZSTD_outBuffer output { m_buffer.data(), m_buffer.size(), 0 };
+        auto result = ZSTD_compressStream2(m_context, &output, &input, ZSTD_e_end);
+        if (ZSTD_isError(result))
+            return zstd_error(result);
+        TRY(m_stream->write_until_depleted(m_buffer.span().trim(output.pos)));
+        if (result == 0)
+            return {};
+    }
+}
+
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/FixedArray.h>
+#include <AK/MaybeOwned.h>
+#include <AK/Stream.h>
+#include <LibCompress/GenericZlib.h>
+
+extern "C" {
+typedef struct ZSTD_CCtx_s ZSTD_CCtx;
+typedef struct ZSTD_DCtx_s ZSTD_DCtx;
+}
+
+namespace Compress {
+
+class ZstdDecompressor final : public Stream {
+    AK_MAKE_NONCOPYABLE(ZstdDecompressor);
+
+public:
+    static ErrorOr<NonnullOwnPtr<ZstdDecompressor>> create(MaybeOwned<Stream>);
+    static ErrorOr<ByteBuffer> decompress_all(ReadonlyBytes);
+
+    ~ZstdDecompressor() override;
+
+    virtual ErrorOr<Bytes> read_some(Bytes) override;
+    virtual ErrorOr<size_t> write_some(ReadonlyBytes) override;
+    virtual bool is_eof() const override;
+    virtual bool is_open() const override;
+    virtual void close() override;
+
+    // See GenericZlibDecompressor::read_some_available().
+    ErrorOr<Bytes> read_some_available(Bytes);
+
+private:
+    ZstdDecompressor(AK::FixedArray<u8>, MaybeOwned<Stream>, ZSTD_DCtx*);
+
+    enum class InputIsComplete {
+        No,
+        Yes,
+    };
+    ErrorOr<Bytes> decompress_some(Bytes, InputIsComplete);
+
+    MaybeOwned<Stream> m_stream;
+    ZSTD_DCtx* m_context { nullptr };
+
+    // A zstd stream may consist of several frames. This is only false between two of them, so it starts out true as
+    // the input has to contain at least one frame.
+    bool m_frame_in_progress { true };
+    bool m_eof { false };
+
+    AK::FixedArray<u8> m_buffer;
+    ReadonlyBytes m_input;
+};
+
+class ZstdCompressor final : public Stream {
+    AK_MAKE_NONCOPYABLE(ZstdCompressor);
+
+public:
+    static ErrorOr<NonnullOwnPtr<ZstdCompressor>> create(MaybeOwned<Stream>, GenericZlibCompressionLevel = GenericZlibCompressionLevel::Default);
+    static ErrorOr<ByteBuffer> compress_all(ReadonlyBytes, GenericZlibCompressionLevel = GenericZlibCompressionLevel::Default);
+
+    ~ZstdCompressor() override;
+
+    virtual ErrorOr<Bytes> read_some(Bytes) override;
+    virtual ErrorOr<size_t> write_some(ReadonlyBytes) override;
+    virtual bool is_eof() const override;
+    virtual bool is_open() const override;
+    virtual void close() override;
+    ErrorOr<void> finish();
+
+private:
+    ZstdCompressor(AK::FixedArray<u8>, MaybeOwned<Stream>, ZSTD_CCtx*);
+
+    MaybeOwned<Stream> m_stream;
+    ZSTD_CCtx* m_context { nullptr };
+
+    AK::FixedArray<u8> m_buffer;
+};
+
+}
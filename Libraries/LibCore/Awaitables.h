@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Coroutine.h>
+#include <AK/RefPtr.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/Notifier.h>
+#include <LibCore/Timer.h>
+
+namespace Core {
+
+// Suspends the awaiting coroutine until the given number of milliseconds have passed on the current event loop.
+class [[nodiscard]] SleepAwaiter {
+public:
+    explicit SleepAwaiter(int milliseconds)
+        : m_milliseconds(milliseconds)
+    {
+    }
+
+    bool await_ready() const { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        // NOTE: Resuming destroys this awaiter and with it the timer, so that must not happen from inside its callback.
+        m_timer = Timer::create_single_shot(m_milliseconds, [handle] { deferred_invoke([handle] { handle.resume(); }); });
+        m_timer->start();
+    }
+
+    void await_resume() { }
+
+private:
+    int m_milliseconds { 0 };
+    RefPtr<Timer> m_timer;
+};
+
+// Suspends the awaiting coroutine until the file descriptor is ready for the given kind of I/O. The fd is only
+// watched while a coroutine is waiting on it, so this does not keep a notifier registered between reads or writes.
+class [[nodiscard]] NotifierAwaiter {
+public:
+    NotifierAwaiter(int fd, Notifier::Type type)
+        : m_fd(fd)
+        , m_type(type)
+    {
+    }
+
+    bool await_ready() const { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_notifier = Notifier::construct(m_fd, m_type);
+        // NOTE: Resuming destroys this awaiter and with it the notifier, so that must not happen from inside its callback.
+        m_notifier->on_activation = [notifier = m_notifier.ptr(), handle] {
+            notifier->set_enabled(false);
+            deferred_invoke([handle] { handle.resume(); });
+        };
+    }
+
+    void await_resume() { }
+
+private:
+    int m_fd { -1 };
+    Notifier::Type m_type { Notifier::Type::None };
+    RefPtr<Notifier> m_notifier;
+};
+
+inline SleepAwaiter sleep_for(int milliseconds) { return SleepAwaiter { milliseconds }; }
+inline NotifierAwaiter wait_until_readable(int fd) { return NotifierAwaiter { fd, Notifier::Type::Read }; }
+inline NotifierAwaiter wait_until_writable(int fd) { return NotifierAwaiter { fd, Notifier::Type::Write }; }
+
+}
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/BinaryHeap.h>
 #include <AK/Singleton.h>
 #include <AK/TemporaryChange.h>
@@ -20,6 +21,16 @@
 #include <sys/select.h>
 #include <unistd.h>
 
+// The kernel keeps track of which file descriptors each thread is interested in, so waiting for events only costs as
+// much as the number of file descriptors that are actually ready, rather than the number of registered notifiers.
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+#    define EVENT_LOOP_USE_EPOLL
+#    include <sys/epoll.h>
+#elif defined(AK_OS_MACOS) || defined(AK_OS_IOS) || defined(AK_OS_FREEBSD) || defined(AK_OS_NETBSD) || defined(AK_OS_OPENBSD) || defined(AK_OS_DRAGONFLY)
+#    define EVENT_LOOP_USE_KQUEUE
+#    include <sys/event.h>
+#endif
+
 namespace Core {
 
 namespace {
@@ -34,6 +45,22 @@ static pthread_rwlock_t* s_thread_data_lock = nullptr;
 thread_local pthread_t s_thread_id;
 thread_local OwnPtr<ThreadData> s_this_thread_data;
 
+bool has_flag(int value, int flag)
+{
+    return (value & flag) == flag;
+}
+
+#if defined(EVENT_LOOP_USE_EPOLL)
+u32 notification_type_to_epoll_events(NotificationType type)
+{
+    u32 events = 0;
+    if (has_flag(type, NotificationType::Read))
+        events |= EPOLLIN;
+    if (has_flag(type, NotificationType::Write))
+        events |= EPOLLOUT;
+    return events;
+}
+#elif !defined(EVENT_LOOP_USE_KQUEUE)
 short notification_type_to_poll_events(NotificationType type)
 {
     short events = 0;
@@ -43,11 +70,12 @@ short notification_type_to_poll_events(NotificationType type)
         events |= POLLOUT;
     return events;
 }
+#endif
 
-bool has_flag(int value, int flag)
-{
-    return (value & flag) == flag;
-}
+struct ReadyFileDescriptor {
+    int fd { -1 };
+    NotificationType type { NotificationType::None };
+};
 
 class EventLoopTimeout {
 public:
@@ -183,11 +211,17 @@ public:
         if (!strong_owner)
             return;
 
+        auto should_post_event = fire_when_not_visible == TimerShouldFireWhenNotVisible::Yes || strong_owner->is_visible_for_timer_purposes();
+
         if (should_reload) {
             MonotonicTime next_fire_time = m_fire_time + interval;
             if (next_fire_time <= current_time) {
                 next_fire_time = current_time + interval;
             }
+            // NOTE: Nothing observes a timer whose owner isn't visible, so line it up with every other such timer
+            //       and let the event loop wake up for all of them at once.
+            if (!should_post_event)
+                next_fire_time = coalesce_hidden_fire_time(next_fire_time);
             m_fire_time = next_fire_time;
             if (next_fire_time != current_time) {
                 timeout_set.schedule_absolute(this);
@@ -202,14 +236,24 @@ public:
         }
 
         // FIXME: While TimerShouldFireWhenNotVisible::Yes prevents the timer callback from being
-        //        called, it doesn't allow event loop to sleep since it needs to constantly check if
+        //        called, the event loop still wakes up once per coalescing interval to check if
         //        is_visible_for_timer_purposes changed. A better solution will be to unregister a
         //        timer and register it back again when needed. This also has an added benefit of
         //        making fire_when_not_visible and is_visible_for_timer_purposes obsolete.
-        if (fire_when_not_visible == TimerShouldFireWhenNotVisible::Yes || strong_owner->is_visible_for_timer_purposes())
+        if (should_post_event)
             ThreadEventQueue::current().post_event(*strong_owner, make<TimerEvent>());
     }
 
+    static MonotonicTime coalesce_hidden_fire_time(MonotonicTime fire_time)
+    {
+        auto remainder = fire_time.nanoseconds() % hidden_timer_coalescing_interval.to_nanoseconds();
+        if (remainder == 0)
+            return fire_time;
+        return fire_time + AK::Duration::from_nanoseconds(hidden_timer_coalescing_interval.to_nanoseconds() - remainder);
+    }
+
+    static constexpr AK::Duration hidden_timer_coalescing_interval = AK::Duration::from_seconds(1);
+
     AK::Duration interval;
     bool should_reload { false };
     TimerShouldFireWhenNotVisible fire_when_not_visible { TimerShouldFireWhenNotVisible::No };
@@ -265,22 +309,191 @@ struct ThreadData {
 
         wake_pipe_fds = result.release_value();
 
+#if defined(EVENT_LOOP_USE_EPOLL)
+        poller_fd = epoll_create1(EPOLL_CLOEXEC);
+#elif defined(EVENT_LOOP_USE_KQUEUE)
+        poller_fd = kqueue();
+#endif
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+        if (poller_fd < 0) {
+            warnln("\033[31;1mFailed to create event loop poller:\033[0m {}", Error::from_errno(errno));
+            VERIFY_NOT_REACHED();
+        }
+#endif
+
         // The wake pipe informs us of POSIX signals as well as manual calls to wake()
-        poll_fds.append({ .fd = wake_pipe_fds[0], .events = POLLIN, .revents = 0 });
+        watch(wake_pipe_fds[0], NotificationType::Read);
     }
 
     ~ThreadData()
     {
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+        close(poller_fd);
+#endif
+
         pthread_rwlock_wrlock(&*s_thread_data_lock);
         s_thread_data.remove(s_thread_id);
         pthread_rwlock_unlock(&*s_thread_data_lock);
     }
 
+    void watch(int fd, NotificationType type)
+    {
+#if defined(EVENT_LOOP_USE_EPOLL)
+        epoll_event event {};
+        event.events = notification_type_to_epoll_events(type);
+        event.data.fd = fd;
+        if (epoll_ctl(poller_fd, EPOLL_CTL_ADD, fd, &event) == 0)
+            return;
+
+        // NOTE: Only one notifier is tracked per file descriptor, so a newer one takes over the registration.
+        if (errno == EEXIST && epoll_ctl(poller_fd, EPOLL_CTL_MOD, fd, &event) == 0)
+            return;
+
+        // epoll doesn't support regular files and some devices, which poll() would always report as ready anyway.
+        if (errno == EPERM) {
+            always_ready_fds.set(fd);
+            return;
+        }
+
+        dbgln("EventLoopImplementationUnix: Failed to watch fd {}: {}", fd, Error::from_errno(errno));
+#elif defined(EVENT_LOOP_USE_KQUEUE)
+        struct kevent changes[2];
+        int change_count = 0;
+        if (has_flag(type, NotificationType::Read))
+            EV_SET(&changes[change_count++], fd, EVFILT_READ, EV_ADD, 0, 0, nullptr);
+        if (has_flag(type, NotificationType::Write))
+            EV_SET(&changes[change_count++], fd, EVFILT_WRITE, EV_ADD, 0, 0, nullptr);
+        if (change_count != 0 && kevent(poller_fd, changes, change_count, nullptr, 0, nullptr) < 0)
+            dbgln("EventLoopImplementationUnix: Failed to watch fd {}: {}", fd, Error::from_errno(errno));
+#else
+        poll_fds.append({ .fd = fd, .events = notification_type_to_poll_events(type), .revents = 0 });
+#endif
+    }
+
+    void unwatch(int fd)
+    {
+#if defined(EVENT_LOOP_USE_EPOLL)
+        // NOTE: This fails harmlessly if the file descriptor has already been closed, which removes it from the set.
+        if (!always_ready_fds.remove(fd))
+            (void)epoll_ctl(poller_fd, EPOLL_CTL_DEL, fd, nullptr);
+#elif defined(EVENT_LOOP_USE_KQUEUE)
+        // NOTE: Each filter is removed separately, as kevent() stops at the first change that fails.
+        for (auto filter : { EVFILT_READ, EVFILT_WRITE }) {
+            struct kevent change;
+            EV_SET(&change, fd, filter, EV_DELETE, 0, 0, nullptr);
+            (void)kevent(poller_fd, &change, 1, nullptr, 0, nullptr);
+        }
+#else
+        poll_fds.remove_all_matching([&](auto const& poll_fd) {
+            return poll_fd.fd == fd;
+        });
+#endif
+    }
+
+    ErrorOr<void> wait_for_ready_fds(int timeout)
+    {
+        ready_fds.clear_with_capacity();
+
+#if defined(EVENT_LOOP_USE_EPOLL)
+        if (!always_ready_fds.is_empty())
+            timeout = 0;
+
+        epoll_event events[64];
+        auto event_count = epoll_wait(poller_fd, events, array_size(events), timeout);
+        if (event_count < 0)
+            return Error::from_syscall("epoll_wait"sv, errno);
+
+        for (auto fd : always_ready_fds)
+            ready_fds.append({ fd, NotificationType::Read | NotificationType::Write });
+
+        for (int i = 0; i < event_count; ++i) {
+            auto revents = static_cast<int>(events[i].events);
+
+            NotificationType type = NotificationType::None;
+            if (has_flag(revents, EPOLLIN))
+                type |= NotificationType::Read;
+            if (has_flag(revents, EPOLLOUT))
+                type |= NotificationType::Write;
+            if (has_flag(revents, EPOLLHUP))
+                type |= NotificationType::Read | NotificationType::HangUp;
+            if (has_flag(revents, EPOLLERR))
+                type |= NotificationType::Error;
+
+            ready_fds.append({ events[i].data.fd, type });
+        }
+#elif defined(EVENT_LOOP_USE_KQUEUE)
+        timespec timeout_spec {};
+        timespec* timeout_pointer = nullptr;
+        if (timeout >= 0) {
+            timeout_spec.tv_sec = timeout / 1000;
+            timeout_spec.tv_nsec = (timeout % 1000) * 1'000'000;
+            timeout_pointer = &timeout_spec;
+        }
+
+        struct kevent events[64];
+        auto event_count = kevent(poller_fd, nullptr, 0, events, array_size(events), timeout_pointer);
+        if (event_count < 0)
+            return Error::from_syscall("kevent"sv, errno);
+
+        for (int i = 0; i < event_count; ++i) {
+            auto const& event = events[i];
+
+            NotificationType type = NotificationType::None;
+            if (event.filter == EVFILT_READ)
+                type |= NotificationType::Read;
+            if (event.filter == EVFILT_WRITE)
+                type |= NotificationType::Write;
+            if (has_flag(event.flags, EV_EOF))
+                type |= NotificationType::Read | NotificationType::HangUp;
+            if (has_flag(event.flags, EV_ERROR))
+                type |= NotificationType::Error;
+
+            ready_fds.append({ static_cast<int>(event.ident), type });
+        }
+#else
+        auto marked_fd_count = TRY(System::poll(poll_fds, timeout));
+        if (marked_fd_count == 0)
+            return {};
+
+        for (auto const& poll_fd : poll_fds) {
+#    ifdef AK_OS_ANDROID
+            // FIXME: Make the check work under Android, perhaps use ALooper.
+            if (poll_fd.fd != wake_pipe_fds[0]) {
+                ready_fds.append({ poll_fd.fd, NotificationType::Read | NotificationType::Write | NotificationType::HangUp | NotificationType::Error });
+                continue;
+            }
+#    endif
+            auto revents = poll_fd.revents;
+
+            NotificationType type = NotificationType::None;
+            if (has_flag(revents, POLLIN))
+                type |= NotificationType::Read;
+            if (has_flag(revents, POLLOUT))
+                type |= NotificationType::Write;
+            if (has_flag(revents, POLLHUP))
+                type |= NotificationType::Read | NotificationType::HangUp;
+            if (has_flag(revents, POLLERR))
+                type |= NotificationType::Error;
+
+            if (type != NotificationType::None)
+                ready_fds.append({ poll_fd.fd, type });
+        }
+#endif
+
+        return {};
+    }
+
     // Each thread has its own timers, notifiers and a wake pipe.
     TimeoutSet timeouts;
 
     HashMap<int, Notifier*> notifiers;
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+    int poller_fd { -1 };
+    HashTable<int> always_ready_fds;
+#else
     Vector<pollfd, 32> poll_fds;
+#endif
+    Vector<ReadyFileDescriptor, 32> ready_fds;
 
     // The wake pipe is used to notify another event loop that someone has called wake(), or a signal has been received.
     // wake() writes 0i32 into the pipe, signals write the signal number (guaranteed non-zero).
@@ -361,20 +574,24 @@ retry:
     }
 
 try_select_again:
-    // select() and wait for file system events, calls to wake(), POSIX signals, or timer expirations.
-    auto error_or_marked_fd_count = System::poll(thread_data.poll_fds, should_wait_forever ? -1 : timeout);
+    // Wait for file system events, calls to wake(), POSIX signals, or timer expirations.
+    auto result = thread_data.wait_for_ready_fds(should_wait_forever ? -1 : timeout);
     auto time_after_poll = MonotonicTime::now_coarse();
-    // Because POSIX, we might spuriously return from select() with EINTR; just select again.
-    if (error_or_marked_fd_count.is_error()) {
-        if (error_or_marked_fd_count.error().code() == EINTR)
+    // Because POSIX, we might spuriously return from waiting with EINTR; just wait again.
+    if (result.is_error()) {
+        if (result.error().code() == EINTR)
             goto try_select_again;
-        dbgln("EventLoopImplementationUnix::wait_for_events: {}", error_or_marked_fd_count.error());
+        dbgln("EventLoopImplementationUnix::wait_for_events: {}", result.error());
         VERIFY_NOT_REACHED();
     }
 
+    auto woke_up = any_of(thread_data.ready_fds, [&](auto const& ready_fd) {
+        return ready_fd.fd == thread_data.wake_pipe_fds[0] && has_flag(ready_fd.type, NotificationType::Read);
+    });
+
     // We woke up due to a call to wake() or a POSIX signal.
     // Handle signals and see whether we need to handle events as well.
-    if (has_flag(thread_data.poll_fds[0].revents, POLLIN)) {
+    if (woke_up) {
         int wake_events[8];
         ssize_t nread;
         // We might receive another signal while read()ing here. The signal will go to the handle_signal properly,
@@ -403,33 +620,18 @@ try_select_again:
             goto retry;
     }
 
-    if (error_or_marked_fd_count.value() != 0) {
-        // Handle file system notifiers by making them normal events.
-        for (auto const& poll_fd : thread_data.poll_fds.span().slice(1)) {
-            auto& notifier = *thread_data.notifiers.get(poll_fd.fd).value();
+    // Handle file system notifiers by making them normal events.
+    for (auto const& ready_fd : thread_data.ready_fds) {
+        if (ready_fd.fd == thread_data.wake_pipe_fds[0])
+            continue;
 
-#ifdef AK_OS_ANDROID
-            // FIXME: Make the check work under Android, perhaps use ALooper.
-            ThreadEventQueue::current().post_event(notifier, make<NotifierActivationEvent>(notifier.fd(), notifier.type()));
-#else
-            auto revents = poll_fd.revents;
+        auto notifier = thread_data.notifiers.get(ready_fd.fd);
+        if (!notifier.has_value())
+            continue;
 
-            NotificationType type = NotificationType::None;
-            if (has_flag(revents, POLLIN))
-                type |= NotificationType::Read;
-            if (has_flag(revents, POLLOUT))
-                type |= NotificationType::Write;
-            if (has_flag(revents, POLLHUP))
-                type |= NotificationType::Read | NotificationType::HangUp;
-            if (has_flag(revents, POLLERR))
-                type |= NotificationType::Error;
-
-            type &= notifier.type();
-
-            if (type != NotificationType::None)
-                ThreadEventQueue::current().post_event(notifier, make<NotifierActivationEvent>(notifier.fd(), type));
-#endif
-        }
+        auto type = ready_fd.type & (*notifier)->type();
+        if (type != NotificationType::None)
+            ThreadEventQueue::current().post_event(**notifier, make<NotifierActivationEvent>(ready_fd.fd, type));
     }
 
     // Handle expired timers.
@@ -651,9 +853,7 @@ void EventLoopManagerUnix::register_notifier(Notifier& notifier)
     auto& thread_data = ThreadData::the();
 
     thread_data.notifiers.set(notifier.fd(), &notifier);
-
-    auto events = notification_type_to_poll_events(notifier.type());
-    thread_data.poll_fds.append({ .fd = notifier.fd(), .events = events, .revents = 0 });
+    thread_data.watch(notifier.fd(), notifier.type());
 
     notifier.set_owner_thread(s_thread_id);
 }
@@ -665,10 +865,7 @@ void EventLoopManagerUnix::unregister_notifier(Notifier& notifier)
         return;
 
     thread_data->notifiers.remove(notifier.fd());
-
-    thread_data->poll_fds.remove_all_matching([&](auto const& poll_fd) {
-        return poll_fd.fd == notifier.fd();
-    });
+    thread_data->unwatch(notifier.fd());
 }
 
 void EventLoopManagerUnix::did_post_event()
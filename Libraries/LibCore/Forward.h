@@ -27,6 +27,8 @@ class File;
 class LocalServer;
 class LocalSocket;
 class MappedFile;
+class MemoryPressureWatcher;
+class MemoryReports;
 class MimeData;
 class NetworkJob;
 class NetworkResponse;
@@ -49,8 +51,10 @@ class TimeZoneWatcher;
 class UDPServer;
 class UDPSocket;
 
+struct MemoryReport;
 struct ProxyData;
 
+enum class MemoryPressureLevel : u8;
 enum class TimerShouldFireWhenNotVisible;
 
 #ifdef AK_OS_MACH
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/Function.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Types.h>
+
+namespace Core {
+
+enum class MemoryPressureLevel : u8 {
+    Normal,
+    Moderate,
+    Critical,
+};
+
+// Notifies the event loop it was created on whenever the system, or the cgroup this process runs in, comes under
+// memory pressure. Pressure is reported as it's detected, so the same level may be reported several times in a row.
+class MemoryPressureWatcher {
+    AK_MAKE_NONCOPYABLE(MemoryPressureWatcher);
+
+public:
+    static ErrorOr<NonnullOwnPtr<MemoryPressureWatcher>> create();
+    virtual ~MemoryPressureWatcher() = default;
+
+    Function<void(MemoryPressureLevel)> on_memory_pressure;
+
+protected:
+    MemoryPressureWatcher() = default;
+};
+
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/ByteString.h>
+#include <AK/Platform.h>
+#include <AK/ScopeGuard.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
+#include <LibCore/MemoryPressureWatcher.h>
+#include <LibCore/System.h>
+#include <pthread.h>
+
+#if !defined(AK_OS_LINUX)
+static_assert(false, "This file must only be used for Linux");
+#endif
+
+namespace Core {
+
+// Pressure stall information triggers, see https://docs.kernel.org/accounting/psi.html. Unprivileged processes may only
+// use windows that are a multiple of two seconds.
+static constexpr auto moderate_pressure_trigger = "some 200000 2000000"sv;
+static constexpr auto critical_pressure_trigger = "full 200000 2000000"sv;
+
+// The kernel only tells us when pressure rises, so we consider it to be over once it hasn't been reported for a while.
+static constexpr int pressure_relief_timeout_ms = 10'000;
+
+static ErrorOr<ByteString> pressure_file_path()
+{
+    // Prefer the pressure of our own cgroup, which is where limits on kiosks and containers apply.
+    if (auto file = File::open("/proc/self/cgroup"sv, File::OpenMode::Read); !file.is_error()) {
+        auto contents = TRY(file.value()->read_until_eof());
+
+        for (auto line : StringView { contents }.lines()) {
+            // The cgroup v2 hierarchy is listed as "0::<path>".
+            if (!line.starts_with("0::"sv))
+                continue;
+
+            auto path = ByteString::formatted("/sys/fs/cgroup{}/memory.pressure", line.substring_view(3));
+            if (!System::access(path, W_OK).is_error())
+                return path;
+        }
+    }
+
+    return ByteString { "/proc/pressure/memory"sv };
+}
+
+static ErrorOr<int> open_pressure_trigger(StringView path, StringView trigger)
+{
+    auto fd = TRY(System::open(path, O_RDWR | O_NONBLOCK | O_CLOEXEC));
+    ArmedScopeGuard close_fd = [&] { (void)System::close(fd); };
+
+    // NOTE: The kernel expects the trigger to be null-terminated.
+    auto trigger_string = ByteString { trigger };
+    TRY(System::write(fd, { reinterpret_cast<u8 const*>(trigger_string.characters()), trigger_string.length() + 1 }));
+
+    close_fd.disarm();
+    return fd;
+}
+
+class MemoryPressureWatcherImpl final : public MemoryPressureWatcher {
+public:
+    static ErrorOr<NonnullOwnPtr<MemoryPressureWatcherImpl>> create()
+    {
+        auto path = TRY(pressure_file_path());
+
+        auto moderate_fd = TRY(open_pressure_trigger(path, moderate_pressure_trigger));
+        auto critical_fd = TRY(open_pressure_trigger(path, critical_pressure_trigger));
+        auto wake_pipe = TRY(System::pipe2(O_CLOEXEC));
+
+        auto watcher = adopt_own(*new MemoryPressureWatcherImpl(moderate_fd, critical_fd, wake_pipe));
+
+        if (auto rc = pthread_create(&watcher->m_thread, nullptr, watch_for_pressure, watcher.ptr()); rc != 0)
+            return Error::from_errno(rc);
+        watcher->m_has_thread = true;
+
+        return watcher;
+    }
+
+    virtual ~MemoryPressureWatcherImpl() override
+    {
+        m_delivery->watcher = nullptr;
+
+        if (m_has_thread) {
+            u8 byte = 0;
+            (void)System::write(m_wake_pipe[1], { &byte, 1 });
+            pthread_join(m_thread, nullptr);
+        }
+
+        (void)System::close(m_moderate_fd);
+        (void)System::close(m_critical_fd);
+        (void)System::close(m_wake_pipe[0]);
+        (void)System::close(m_wake_pipe[1]);
+    }
+
+private:
+    // Reports are delivered on the event loop the watcher was created on, and are dropped if the watcher was destroyed
+    // in the meantime.
+    struct Delivery : public AtomicRefCounted<Delivery> {
+        MemoryPressureWatcherImpl* watcher { nullptr };
+    };
+
+    MemoryPressureWatcherImpl(int moderate_fd, int critical_fd, Array<int, 2> wake_pipe)
+        : m_event_loop(EventLoop::current())
+        , m_delivery(adopt_ref(*new Delivery))
+        , m_moderate_fd(moderate_fd)
+        , m_critical_fd(critical_fd)
+        , m_wake_pipe(wake_pipe)
+    {
+        m_delivery->watcher = this;
+    }
+
+    static void* watch_for_pressure(void* argument)
+    {
+        auto& watcher = *static_cast<MemoryPressureWatcherImpl*>(argument);
+        auto level = MemoryPressureLevel::Normal;
+
+        while (true) {
+            Array<pollfd, 3> fds {
+                pollfd { .fd = watcher.m_moderate_fd, .events = POLLPRI, .revents = 0 },
+                pollfd { .fd = watcher.m_critical_fd, .events = POLLPRI, .revents = 0 },
+                pollfd { .fd = watcher.m_wake_pipe[0], .events = POLLIN, .revents = 0 },
+            };
+
+            auto timeout = level == MemoryPressureLevel::Normal ? -1 : pressure_relief_timeout_ms;
+            auto result = System::poll(fds, timeout);
+            if (result.is_error()) {
+                if (result.error().code() == EINTR)
+                    continue;
+                break;
+            }
+
+            // We're being destroyed.
+            if (fds[2].revents != 0)
+                break;
+
+            // The triggers are gone, e.g. because our cgroup was removed.
+            if ((fds[0].revents | fds[1].revents) & POLLERR)
+                break;
+
+            if (result.value() == 0)
+                level = MemoryPressureLevel::Normal;
+            else if (fds[1].revents & POLLPRI)
+                level = MemoryPressureLevel::Critical;
+            else
+                level = MemoryPressureLevel::Moderate;
+
+            watcher.m_event_loop.deferred_invoke([delivery = watcher.m_delivery, level] {
+                if (delivery->watcher && delivery->watcher->on_memory_pressure)
+                    delivery->watcher->on_memory_pressure(level);
+            });
+            watcher.m_event_loop.wake();
+        }
+
+        return nullptr;
+    }
+
+    EventLoop& m_event_loop;
+    NonnullRefPtr<Delivery> m_delivery;
+
+    int m_moderate_fd { -1 };
+    int m_critical_fd { -1 };
+    Array<int, 2> m_wake_pipe;
+
+    pthread_t m_thread {};
+    bool m_has_thread { false };
+};
+
+ErrorOr<NonnullOwnPtr<MemoryPressureWatcher>> MemoryPressureWatcher::create()
+{
+    return MemoryPressureWatcherImpl::create();
+}
+
+}
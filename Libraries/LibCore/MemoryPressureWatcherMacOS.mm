@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/Platform.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/MemoryPressureWatcher.h>
+
+#if !defined(AK_OS_MACOS)
+static_assert(false, "This file must only be used for macOS");
+#endif
+
+#import <dispatch/dispatch.h>
+
+namespace Core {
+
+class MemoryPressureWatcherImpl final : public MemoryPressureWatcher {
+public:
+    static ErrorOr<NonnullOwnPtr<MemoryPressureWatcherImpl>> create()
+    {
+        auto dispatch_queue = dispatch_queue_create("Ladybird.MemoryPressureWatcher", DISPATCH_QUEUE_SERIAL);
+        if (dispatch_queue == nullptr)
+            return Error::from_errno(errno);
+
+        auto source = dispatch_source_create(DISPATCH_SOURCE_TYPE_MEMORYPRESSURE, 0, DISPATCH_MEMORYPRESSURE_NORMAL | DISPATCH_MEMORYPRESSURE_WARN | DISPATCH_MEMORYPRESSURE_CRITICAL, dispatch_queue);
+        if (source == nullptr) {
+            dispatch_release(dispatch_queue);
+            return Error::from_string_literal("Could not create a memory pressure dispatch source");
+        }
+
+        return adopt_own(*new MemoryPressureWatcherImpl(dispatch_queue, source));
+    }
+
+    virtual ~MemoryPressureWatcherImpl() override
+    {
+        m_delivery->watcher = nullptr;
+
+        dispatch_source_cancel(m_source);
+        dispatch_release(m_source);
+        dispatch_release(m_dispatch_queue);
+    }
+
+private:
+    // Reports are delivered on the event loop the watcher was created on, and are dropped if the watcher was destroyed
+    // in the meantime.
+    struct Delivery : public AtomicRefCounted<Delivery> {
+        MemoryPressureWatcherImpl* watcher { nullptr };
+    };
+
+    MemoryPressureWatcherImpl(dispatch_queue_t dispatch_queue, dispatch_source_t source)
+        : m_dispatch_queue(dispatch_queue)
+        , m_source(source)
+        , m_delivery(adopt_ref(*new Delivery))
+    {
+        m_delivery->watcher = this;
+
+        auto* event_loop = &EventLoop::current();
+        auto delivery = m_delivery;
+
+        dispatch_source_set_event_handler(m_source, ^{
+            auto level = MemoryPressureLevel::Normal;
+            auto pressure = dispatch_source_get_data(source);
+
+            if (pressure & DISPATCH_MEMORYPRESSURE_CRITICAL)
+                level = MemoryPressureLevel::Critical;
+            else if (pressure & DISPATCH_MEMORYPRESSURE_WARN)
+                level = MemoryPressureLevel::Moderate;
+
+            event_loop->deferred_invoke([delivery, level] {
+                if (delivery->watcher && delivery->watcher->on_memory_pressure)
+                    delivery->watcher->on_memory_pressure(level);
+            });
+            event_loop->wake();
+        });
+
+        dispatch_resume(m_source);
+    }
+
+    dispatch_queue_t m_dispatch_queue { nullptr };
+    dispatch_source_t m_source { nullptr };
+    NonnullRefPtr<Delivery> m_delivery;
+};
+
+ErrorOr<NonnullOwnPtr<MemoryPressureWatcher>> MemoryPressureWatcher::create()
+{
+    return MemoryPressureWatcherImpl::create();
+}
+
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <AK/NeverDestroyed.h>
+#include <LibCore/MemoryReporting.h>
+
+namespace Core::MemoryReporting {
+
+struct Registry {
+    HashMap<int, Reporter> reporters;
+    int next_id { 1 };
+};
+
+static Registry& registry()
+{
+    static NeverDestroyed<Registry> registry;
+    return *registry;
+}
+
+int register_reporter(Reporter reporter)
+{
+    auto id = registry().next_id++;
+    registry().reporters.set(id, move(reporter));
+    return id;
+}
+
+void unregister_reporter(int id)
+{
+    auto removed = registry().reporters.remove(id);
+    VERIFY(removed);
+}
+
+Vector<MemoryReport> collect_reports()
+{
+    MemoryReports reports;
+    for (auto const& [_, reporter] : registry().reporters)
+        reporter(reports);
+    return reports.take_reports();
+}
+
+}
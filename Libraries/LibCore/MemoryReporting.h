@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+
+namespace Core {
+
+struct MemoryReport {
+    // A "/"-separated path naming what the memory is used for, e.g. "gc-heap/HTMLDivElement".
+    String path;
+    u64 bytes { 0 };
+
+    // The number of objects the memory is used by, or 0 if that isn't meaningful.
+    u64 count { 0 };
+};
+
+class MemoryReports {
+public:
+    void add(String path, u64 bytes, u64 count = 0) { m_reports.append({ move(path), bytes, count }); }
+
+    Vector<MemoryReport> const& reports() const { return m_reports; }
+    Vector<MemoryReport> take_reports() { return move(m_reports); }
+
+private:
+    Vector<MemoryReport> m_reports;
+};
+
+// Subsystems register a reporter that describes the memory they're currently using. Reporters may be polled every
+// second in production, so they must only report figures they already keep track of, rather than walking their data.
+// Reporters are registered and run on the main thread.
+namespace MemoryReporting {
+
+using Reporter = Function<void(MemoryReports&)>;
+
+int register_reporter(Reporter);
+void unregister_reporter(int id);
+
+Vector<MemoryReport> collect_reports();
+
+}
+
+}
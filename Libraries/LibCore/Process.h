@@ -62,6 +62,10 @@ public:
 
     static ErrorOr<Process> spawn(ProcessSpawnOptions const& options);
     static Process current();
+#ifndef AK_OS_WINDOWS
+    // Takes over a child process that was started by some other means than spawn().
+    static Process adopt_child(pid_t pid) { return Process { pid }; }
+#endif
 
     static ErrorOr<Process> spawn(StringView path, ReadonlySpan<ByteString> arguments, ByteString working_directory = {}, KeepAsChild keep_as_child = KeepAsChild::No);
     static ErrorOr<Process> spawn(StringView path, ReadonlySpan<StringView> arguments, ByteString working_directory = {}, KeepAsChild keep_as_child = KeepAsChild::No);
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AK/Concepts.h>
+#include <AK/Coroutine.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/EventReceiver.h>
 
@@ -104,6 +105,54 @@ public:
         return m_result_or_rejection.release_value();
     }
 
+    class Awaiter {
+    public:
+        explicit Awaiter(Promise& promise)
+            : m_promise(promise)
+        {
+        }
+
+        ~Awaiter()
+        {
+            if (m_resumption)
+                m_resumption->handle = {};
+        }
+
+        bool await_ready() const { return m_promise->m_result_or_rejection.has_value(); }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            m_resumption = make_ref_counted<Resumption>(handle);
+            auto resume = [resumption = m_resumption] {
+                Core::deferred_invoke([resumption] {
+                    if (auto handle = AK::exchange(resumption->handle, {}))
+                        handle.resume();
+                });
+            };
+            m_promise->when_resolved([resume](Result&) { resume(); });
+            m_promise->when_rejected([resume](ErrorType&) { resume(); });
+        }
+
+        ErrorOr<Result, ErrorType> await_resume() { return m_promise->m_result_or_rejection.release_value(); }
+
+    private:
+        struct Resumption : public RefCounted<Resumption> {
+            explicit Resumption(std::coroutine_handle<> handle)
+                : handle(handle)
+            {
+            }
+
+            std::coroutine_handle<> handle;
+        };
+
+        NonnullRefPtr<Promise> m_promise;
+        RefPtr<Resumption> m_resumption;
+    };
+
+    // Suspends the awaiting coroutine until the promise settles. This replaces the promise's handlers, and the
+    // coroutine is resumed from the event loop rather than from within resolve() or reject().
+    Awaiter operator co_await() { return Awaiter { *this }; }
+
     // Converts a Promise<A> to a Promise<B> using a function func: A -> B
     template<typename T>
     NonnullRefPtr<Promise<T>> map(Function<T(Result&)> func)
@@ -397,32 +397,41 @@ ErrorOr<void> LocalSocket::send_fd(int fd)
 
 ErrorOr<ssize_t> LocalSocket::send_message(ReadonlyBytes data, int flags, Vector<int, 1> fds)
 {
-    size_t const num_fds = fds.size();
-    if (num_fds == 0)
+    if (fds.is_empty())
         return m_helper.write(data, flags | default_flags());
+    return send_message(ReadonlySpan<ReadonlyBytes> { &data, 1 }, flags, move(fds));
+}
+
+ErrorOr<ssize_t> LocalSocket::send_message(ReadonlySpan<ReadonlyBytes> data, int flags, Vector<int, 1> fds)
+{
+    size_t const num_fds = fds.size();
     if (num_fds > MAX_TRANSFER_FDS)
         return Error::from_string_literal("Too many file descriptors to send");
 
+    Vector<struct iovec, 64> iovs;
+    iovs.ensure_capacity(data.size());
+    for (auto const& bytes : data)
+        iovs.unchecked_append({ .iov_base = const_cast<u8*>(bytes.data()), .iov_len = bytes.size() });
+
+    struct msghdr msg = {};
+    msg.msg_iov = iovs.data();
+    msg.msg_iovlen = iovs.size();
+
     auto const fd_payload_size = num_fds * sizeof(int);
 
     alignas(struct cmsghdr) char control_buf[CMSG_SPACE(sizeof(int) * MAX_TRANSFER_FDS)] {};
 
-    // Note: We don't use designated initializers here due to weirdness with glibc's flexible array members.
-    auto* header = new (control_buf) cmsghdr {};
-    header->cmsg_len = static_cast<socklen_t>(CMSG_LEN(fd_payload_size));
-    header->cmsg_level = SOL_SOCKET;
-    header->cmsg_type = SCM_RIGHTS;
-    memcpy(CMSG_DATA(header), fds.data(), fd_payload_size);
+    if (num_fds > 0) {
+        // Note: We don't use designated initializers here due to weirdness with glibc's flexible array members.
+        auto* header = new (control_buf) cmsghdr {};
+        header->cmsg_len = static_cast<socklen_t>(CMSG_LEN(fd_payload_size));
+        header->cmsg_level = SOL_SOCKET;
+        header->cmsg_type = SCM_RIGHTS;
+        memcpy(CMSG_DATA(header), fds.data(), fd_payload_size);
 
-    struct iovec iov {
-        .iov_base = const_cast<u8*>(data.data()),
-        .iov_len = data.size(),
-    };
-    struct msghdr msg = {};
-    msg.msg_iov = &iov;
-    msg.msg_iovlen = 1;
-    msg.msg_control = header;
-    msg.msg_controllen = CMSG_LEN(fd_payload_size);
+        msg.msg_control = header;
+        msg.msg_controllen = CMSG_LEN(fd_payload_size);
+    }
 
     return TRY(Core::System::sendmsg(m_helper.fd(), &msg, default_flags() | flags));
 }
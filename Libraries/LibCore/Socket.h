@@ -337,6 +337,8 @@ public:
 
     ErrorOr<Bytes> receive_message(Bytes buffer, int flags, Vector<int>& fds);
     ErrorOr<ssize_t> send_message(ReadonlyBytes msg, int flags, Vector<int, 1> fds = {});
+    // Sends several buffers with a single sendmsg() call, as if they were one contiguous buffer.
+    ErrorOr<ssize_t> send_message(ReadonlySpan<ReadonlyBytes> msgs, int flags, Vector<int, 1> fds = {});
 
     ErrorOr<pid_t> peer_pid() const;
     ErrorOr<Bytes> read_without_waiting(Bytes buffer);
@@ -11,6 +11,7 @@
 
 #include <AK/AtomicRefCounted.h>
 #include <AK/Concepts.h>
+#include <AK/Coroutine.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/EventReceiver.h>
 #include <LibThreading/Mutex.h>
@@ -119,6 +120,57 @@ public:
         return *this;
     }
 
+    class Awaiter {
+    public:
+        explicit Awaiter(ThreadedPromise& promise)
+            : m_promise(promise)
+        {
+        }
+
+        ~Awaiter()
+        {
+            if (m_resumption)
+                m_resumption->handle = {};
+        }
+
+        bool await_ready() const { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            m_resumption = adopt_ref(*new Resumption(handle));
+            auto settle = [resumption = m_resumption, origin_event_loop = &Core::EventLoop::current()](ErrorOr<ResultType, ErrorType> result) {
+                resumption->result = move(result);
+                origin_event_loop->deferred_invoke([resumption] {
+                    if (auto handle = AK::exchange(resumption->handle, {}))
+                        handle.resume();
+                });
+                origin_event_loop->wake();
+            };
+            m_promise->when_resolved([settle](ResultType&& result) { settle(move(result)); });
+            m_promise->when_rejected([settle](ErrorType&& error) { settle(move(error)); });
+        }
+
+        ErrorOr<ResultType, ErrorType> await_resume() { return m_resumption->result.release_value(); }
+
+    private:
+        struct Resumption : public AtomicRefCounted<Resumption> {
+            explicit Resumption(std::coroutine_handle<> handle)
+                : handle(handle)
+            {
+            }
+
+            std::coroutine_handle<> handle;
+            Optional<ErrorOr<ResultType, ErrorType>> result;
+        };
+
+        NonnullRefPtr<ThreadedPromise> m_promise;
+        RefPtr<Resumption> m_resumption;
+    };
+
+    // Suspends the awaiting coroutine until the promise settles. This sets both of the promise's handlers, and the
+    // coroutine is always resumed on the event loop of the thread that started awaiting.
+    Awaiter operator co_await() { return Awaiter { *this }; }
+
     template<typename T, CallableAs<NonnullRefPtr<ThreadedPromise<T, ErrorType>>, ResultType&&> ChainedResolution>
     NonnullRefPtr<ThreadedPromise<T, ErrorType>> chain_promise(ChainedResolution chained_resolution)
     {
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/AnyOf.h>
 #include <AK/AtomicRefCounted.h>
 #include <AK/CountingStream.h>
 #include <AK/HashTable.h>
@@ -58,6 +59,11 @@ static Vector<Messages::Records::DNSKEY> s_root_zone_dnskeys = {
 
 class Resolver;
 
+struct CachedAddress {
+    Variant<IPv4Address, IPv6Address> address;
+    UnixDateTime expiration;
+};
+
 class LookupResult : public AtomicRefCounted<LookupResult>
     , public Weakable<LookupResult> {
 public:
@@ -78,6 +84,33 @@ public:
         return result;
     }
 
+    Vector<CachedAddress> cached_addresses_with_expiration() const
+    {
+        Vector<CachedAddress> result;
+        for (auto& re : m_cached_records) {
+            if (!re.expiration.has_value())
+                continue;
+            re.record.record.visit(
+                [&](Messages::Records::A const& a) { result.append({ a.address, *re.expiration }); },
+                [&](Messages::Records::AAAA const& aaaa) { result.append({ aaaa.address, *re.expiration }); },
+                [](auto&) {});
+        }
+        return result;
+    }
+
+    // Records outlive their TTL by this long, so that a lookup can still be answered from them while a fresh
+    // answer is fetched in the background.
+    // https://www.rfc-editor.org/rfc/rfc8767
+    static constexpr i64 stale_record_lifetime_seconds = 24 * 60 * 60;
+
+    bool is_stale() const
+    {
+        auto now = AK::UnixDateTime::now();
+        return any_of(m_cached_records, [&](auto const& record) {
+            return record.expiration.has_value() && record.expiration.value() < now;
+        });
+    }
+
     void check_expiration()
     {
         if (!m_valid)
@@ -86,7 +119,7 @@ public:
         auto now = AK::UnixDateTime::now();
         for (size_t i = 0; i < m_cached_records.size();) {
             auto& record = m_cached_records[i];
-            if (record.expiration.has_value() && record.expiration.value() < now) {
+            if (record.expiration.has_value() && record.expiration.value() + AK::Duration::from_seconds(stale_record_lifetime_seconds) < now) {
                 dbgln_if(DNS_DEBUG, "DNS: Removing expired record for {}", m_name.to_string());
                 m_cached_records.remove(i);
             } else {
@@ -107,6 +140,12 @@ public:
         m_cached_records.append({ move(record), move(expiration) });
     }
 
+    void add_record(Messages::ResourceRecord record, AK::UnixDateTime expiration)
+    {
+        m_valid = true;
+        m_cached_records.append({ move(record), expiration });
+    }
+
     Vector<Messages::ResourceRecord> records() const
     {
         Vector<Messages::ResourceRecord> result;
@@ -216,6 +255,7 @@ public:
     struct LookupOptions {
         bool validate_dnssec_locally { false };
         PendingLookup* repeating_lookup { nullptr };
+        bool allow_stale_records { true };
 
         static LookupOptions default_() { return {}; }
     };
@@ -266,6 +306,50 @@ public:
         m_socket.with_write_locked([&](auto& socket) { socket = {}; });
     }
 
+    // Address records that have to be looked up again once they expire, so that a cache can be carried over to a
+    // later resolver.
+    HashMap<ByteString, Vector<CachedAddress>> cached_addresses_with_expiration()
+    {
+        HashMap<ByteString, Vector<CachedAddress>> result;
+        auto collect = [&](auto& cache) {
+            for (auto const& [name, entry] : cache) {
+                if (!entry->is_done() || result.contains(name))
+                    continue;
+                if (auto addresses = entry->cached_addresses_with_expiration(); !addresses.is_empty())
+                    result.set(name, move(addresses));
+            }
+        };
+        m_cache.with_read_locked(collect);
+        m_stale_cache.with_read_locked(collect);
+        return result;
+    }
+
+    void add_cached_addresses(ByteString const& name, Vector<CachedAddress> const& addresses)
+    {
+        if (addresses.is_empty())
+            return;
+
+        m_cache.with_write_locked([&](auto& cache) {
+            if (cache.contains(name))
+                return;
+
+            auto ptr = make_ref_counted<LookupResult>(Messages::DomainName::from_string(name));
+            ptr->will_add_record_of_type(Messages::ResourceType::A);
+            ptr->will_add_record_of_type(Messages::ResourceType::AAAA);
+            for (auto const& cached_address : addresses) {
+                cached_address.address.visit(
+                    [&](IPv4Address const& address) {
+                        ptr->add_record({ .name = {}, .type = Messages::ResourceType::A, .class_ = Messages::Class::IN, .ttl = 0, .record = Messages::Records::A { address }, .raw = {} }, cached_address.expiration);
+                    },
+                    [&](IPv6Address const& address) {
+                        ptr->add_record({ .name = {}, .type = Messages::ResourceType::AAAA, .class_ = Messages::Class::IN, .ttl = 0, .record = Messages::Records::AAAA { address }, .raw = {} }, cached_address.expiration);
+                    });
+            }
+            ptr->finished_request();
+            cache.set(name, move(ptr));
+        });
+    }
+
     NonnullRefPtr<LookupResult const> expect_cached(StringView name, Messages::Class class_ = Messages::Class::IN)
     {
         return expect_cached(name, class_, Array { Messages::ResourceType::A, Messages::ResourceType::AAAA });
@@ -378,11 +462,38 @@ public:
         if (auto result = lookup_in_cache(name, class_, desired_types)) {
             dbgln_if(DNS_DEBUG, "DNS: Resolving {} from cache...", name);
             if (!options.validate_dnssec_locally || result->is_dnssec_validated()) {
-                dbgln_if(DNS_DEBUG, "DNS: Resolved {} from cache", name);
+                if (result->is_stale()) {
+                    if (!options.allow_stale_records || options.repeating_lookup) {
+                        m_cache.with_write_locked([&](auto& cache) { cache.remove(name); });
+                    } else {
+                        dbgln_if(DNS_DEBUG, "DNS: Resolved {} from stale cache entry, refreshing", name);
+                        m_cache.with_write_locked([&](auto& cache) {
+                            if (auto entry = cache.take(name); entry.has_value())
+                                m_stale_cache.with_write_locked([&](auto& stale_cache) { stale_cache.set(name, entry.release_value()); });
+                        });
+                        refresh_in_background(name, class_, desired_types, options);
+                        promise->resolve(result.release_nonnull());
+                        return promise;
+                    }
+                } else {
+                    dbgln_if(DNS_DEBUG, "DNS: Resolved {} from cache", name);
+                    promise->resolve(result.release_nonnull());
+                    return promise;
+                }
+            } else {
+                dbgln_if(DNS_DEBUG, "DNS: Cache entry for {} is not DNSSEC validated (and we expect that), re-resolving", name);
+            }
+        }
+
+        // A previous refresh of this name may still be in flight, or may have failed; keep answering from the stale
+        // records until it succeeds or they age out.
+        if (options.allow_stale_records && !options.repeating_lookup && !options.validate_dnssec_locally) {
+            if (auto result = lookup_in_stale_cache(name, desired_types)) {
+                dbgln_if(DNS_DEBUG, "DNS: Resolved {} from stale cache entry", name);
+                refresh_in_background(name, class_, desired_types, options);
                 promise->resolve(result.release_nonnull());
                 return promise;
             }
-            dbgln_if(DNS_DEBUG, "DNS: Cache entry for {} is not DNSSEC validated (and we expect that), re-resolving", name);
         }
 
         auto domain_name = Messages::DomainName::from_string(name);
@@ -1182,7 +1293,7 @@ private:
 
     void flush_cache()
     {
-        m_cache.with_write_locked([&](auto& cache) {
+        auto flush = [](auto& cache) {
             HashTable<ByteString> to_remove;
             for (auto& entry : cache) {
                 entry.value->check_expiration();
@@ -1191,10 +1302,49 @@ private:
             }
             for (auto const& key : to_remove)
                 cache.remove(key);
+        };
+        m_cache.with_write_locked(flush);
+        m_stale_cache.with_write_locked(flush);
+    }
+
+    RefPtr<LookupResult const> lookup_in_stale_cache(StringView name, Span<Messages::ResourceType const> desired_types)
+    {
+        return m_stale_cache.with_read_locked([&](auto& cache) -> RefPtr<LookupResult const> {
+            auto it = cache.find(name);
+            if (it == cache.end())
+                return {};
+
+            auto& result = *it->value;
+            for (auto const& type : desired_types) {
+                if (!result.has_record_of_type(type))
+                    return {};
+            }
+
+            return result;
         });
     }
 
+    void refresh_in_background(ByteString const& name, Messages::Class class_, Vector<Messages::ResourceType> const& desired_types, LookupOptions options)
+    {
+        auto refresh_in_flight = m_cache.with_read_locked([&](auto& cache) {
+            auto it = cache.find(name);
+            return it != cache.end() && !it->value->is_done();
+        });
+        if (refresh_in_flight)
+            return;
+
+        options.allow_stale_records = false;
+        lookup(name, class_, desired_types, options)
+            ->when_resolved([this, name](NonnullRefPtr<LookupResult const>&) {
+                m_stale_cache.with_write_locked([&](auto& cache) { cache.remove(name); });
+            })
+            .when_rejected([name](Error& error) {
+                dbgln_if(DNS_DEBUG, "DNS: Failed to refresh {}: {}", name, error);
+            });
+    }
+
     Threading::RWLockProtected<HashMap<ByteString, NonnullRefPtr<LookupResult>>> m_cache;
+    Threading::RWLockProtected<HashMap<ByteString, NonnullRefPtr<LookupResult>>> m_stale_cache;
     Threading::RWLockProtected<NonnullOwnPtr<RedBlackTree<u16, PendingLookup>>> m_pending_lookups;
     Threading::RWLockProtected<Optional<MaybeOwned<Core::Socket>>> m_socket;
     Function<ErrorOr<SocketResult>()> m_create_socket;
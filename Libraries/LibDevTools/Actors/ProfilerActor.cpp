@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObject.h>
+#include <LibDevTools/Actors/ProfilerActor.h>
+#include <LibDevTools/Actors/TabActor.h>
+#include <LibDevTools/DevToolsDelegate.h>
+#include <LibDevTools/DevToolsServer.h>
+
+namespace DevTools {
+
+NonnullRefPtr<ProfilerActor> ProfilerActor::create(DevToolsServer& devtools, String name, WeakPtr<TabActor> tab)
+{
+    return adopt_ref(*new ProfilerActor(devtools, move(name), move(tab)));
+}
+
+ProfilerActor::ProfilerActor(DevToolsServer& devtools, String name, WeakPtr<TabActor> tab)
+    : Actor(devtools, move(name))
+    , m_tab(move(tab))
+{
+}
+
+ProfilerActor::~ProfilerActor()
+{
+    if (!m_active)
+        return;
+
+    if (auto tab = m_tab.strong_ref())
+        devtools().delegate().stop_javascript_profiler(tab->description(), [](auto) { });
+}
+
+void ProfilerActor::handle_message(Message const& message)
+{
+    JsonObject response;
+
+    if (message.type == "isActive"sv) {
+        response.set("isActive"sv, m_active);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "startProfiler"sv) {
+        if (auto tab = m_tab.strong_ref()) {
+            devtools().delegate().start_javascript_profiler(tab->description());
+            m_active = true;
+        }
+
+        response.set("value"sv, m_active);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "stopProfilerAndDiscardProfile"sv) {
+        if (auto tab = m_tab.strong_ref(); tab && m_active)
+            devtools().delegate().stop_javascript_profiler(tab->description(), [](auto) { });
+        m_active = false;
+
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "getProfileAndStopProfiler"sv) {
+        auto tab = m_tab.strong_ref();
+        if (!tab || !m_active) {
+            send_response(message, move(response));
+            return;
+        }
+        m_active = false;
+
+        devtools().delegate().stop_javascript_profiler(tab->description(),
+            async_handler(message, [](auto&, auto profile, auto& response) {
+                response.set("profile"sv, move(profile));
+            }));
+        return;
+    }
+
+    send_unrecognized_packet_type_error(message);
+}
+
+}
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullRefPtr.h>
+#include <LibDevTools/Actor.h>
+
+namespace DevTools {
+
+// Drives the JavaScript sampling profiler of a tab. The packet types mirror those of Firefox's perf actor, but the
+// resulting profile is in the .cpuprofile format.
+class ProfilerActor final : public Actor {
+public:
+    static constexpr auto base_name = "profiler"sv;
+
+    static NonnullRefPtr<ProfilerActor> create(DevToolsServer&, String name, WeakPtr<TabActor>);
+    virtual ~ProfilerActor() override;
+
+private:
+    ProfilerActor(DevToolsServer&, String name, WeakPtr<TabActor>);
+
+    virtual void handle_message(Message const&) override;
+
+    WeakPtr<TabActor> m_tab;
+    bool m_active { false };
+};
+
+}
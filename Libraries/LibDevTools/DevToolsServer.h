@@ -24,6 +24,9 @@ public:
     static ErrorOr<NonnullOwnPtr<DevToolsServer>> create(DevToolsDelegate&, u16 port);
     ~DevToolsServer();
 
+    // The port we are listening on. This is chosen by the system if the server was created with port 0.
+    Optional<u16> local_port() const;
+
     RefPtr<Connection>& connection() { return m_connection; }
     DevToolsDelegate const& delegate() const { return m_delegate; }
     ActorRegistry const& actor_registry() const { return m_actor_registry; }
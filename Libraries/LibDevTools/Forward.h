@@ -23,6 +23,7 @@ class NodeActor;
 class PageStyleActor;
 class PreferenceActor;
 class ProcessActor;
+class ProfilerActor;
 class RootActor;
 class StyleSheetsActor;
 class TabActor;
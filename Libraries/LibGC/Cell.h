@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Badge.h>
 #include <AK/Format.h>
 #include <AK/Forward.h>
@@ -47,6 +48,9 @@ public:
     bool is_marked() const { return m_mark; }
     void set_marked(bool b) { m_mark = b; }
 
+    // Used by parallel marking. Returns true if this call was the one that marked the cell.
+    bool try_set_marked_atomically() { return !AK::atomic_exchange(&m_mark, true, AK::MemoryOrder::memory_order_relaxed); }
+
     enum class State : bool {
         Live,
         Dead,
@@ -55,6 +59,10 @@ public:
     State state() const { return m_state; }
     void set_state(State state) { m_state = state; }
 
+    // Whether this cell has been through a garbage collection yet. This is only used for the GC report.
+    bool has_survived_a_collection() const { return m_has_survived_a_collection; }
+    void set_has_survived_a_collection(bool b) { m_has_survived_a_collection = b; }
+
     virtual StringView class_name() const = 0;
 
     class GC_API Visitor {
@@ -191,6 +199,7 @@ private:
     bool m_mark { false };
     bool m_overrides_must_survive_garbage_collection { false };
     State m_state { State::Live };
+    bool m_has_survived_a_collection { false };
 } SWIFT_UNSAFE_REFERENCE;
 
 }
@@ -23,6 +23,12 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
     if (!m_list_node.is_in_list())
         heap.register_cell_allocator({}, *this);
 
+    if (m_usable_blocks.is_empty() && !m_empty_blocks.is_empty()) {
+        auto& block = *m_empty_blocks.first();
+        block.m_list_node.remove();
+        m_usable_blocks.append(block);
+    }
+
     if (m_usable_blocks.is_empty()) {
         auto block = HeapBlock::create_with_cell_size(heap, *this, m_cell_size, m_class_name);
         auto block_ptr = reinterpret_cast<FlatPtr>(block.ptr());
@@ -31,6 +37,7 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
         if (m_max_block_address < block_ptr)
             m_max_block_address = block_ptr;
         m_usable_blocks.append(*block.leak_ptr());
+        ++m_block_count;
     }
 
     auto& block = *m_usable_blocks.last();
@@ -44,9 +51,21 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
 void CellAllocator::block_did_become_empty(Badge<Heap>, HeapBlock& block)
 {
     block.m_list_node.remove();
-    // NOTE: HeapBlocks are managed by the BlockAllocator, so we don't want to `delete` the block here.
-    block.~HeapBlock();
-    m_block_allocator.deallocate_block(&block);
+    m_empty_blocks.append(block);
+}
+
+size_t CellAllocator::release_empty_blocks(Badge<Heap>)
+{
+    size_t released_blocks = 0;
+    while (!m_empty_blocks.is_empty()) {
+        auto& block = *m_empty_blocks.take_first();
+        // NOTE: HeapBlocks are managed by the BlockAllocator, so we don't want to `delete` the block here.
+        block.~HeapBlock();
+        m_block_allocator.deallocate_block(&block);
+        ++released_blocks;
+    }
+    m_block_count -= released_blocks;
+    return released_blocks;
 }
 
 void CellAllocator::block_did_become_usable(Badge<Heap>, HeapBlock& block)
@@ -27,6 +27,10 @@ public:
     ~CellAllocator() = default;
 
     size_t cell_size() const { return m_cell_size; }
+    char const* class_name() const { return m_class_name; }
+
+    // The number of blocks this allocator has taken from the BlockAllocator, including empty ones it's holding on to.
+    size_t block_count() const { return m_block_count; }
 
     Cell* allocate_cell(Heap&);
 
@@ -47,6 +51,9 @@ public:
     void block_did_become_empty(Badge<Heap>, HeapBlock&);
     void block_did_become_usable(Badge<Heap>, HeapBlock&);
 
+    // Returns all parked empty blocks to the BlockAllocator, which hands their pages back to the OS.
+    size_t release_empty_blocks(Badge<Heap>);
+
     IntrusiveListNode<CellAllocator> m_list_node;
     using List = IntrusiveList<&CellAllocator::m_list_node>;
 
@@ -63,6 +70,11 @@ private:
     using BlockList = IntrusiveList<&HeapBlock::m_list_node>;
     BlockList m_full_blocks;
     BlockList m_usable_blocks;
+
+    // Blocks that became empty during a collection. They are kept around (still committed) so that the next
+    // allocations can reuse them without a round-trip through the kernel, until the heap releases them.
+    BlockList m_empty_blocks;
+    size_t m_block_count { 0 };
     FlatPtr m_min_block_address { explode_byte(0xff) };
     FlatPtr m_max_block_address { 0 };
 };
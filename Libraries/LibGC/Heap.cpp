@@ -9,17 +9,21 @@
 #include <AK/Debug.h>
 #include <AK/Function.h>
 #include <AK/HashTable.h>
-#include <AK/JsonArray.h>
-#include <AK/JsonObject.h>
+#include <AK/JsonObjectSerializer.h>
+#include <AK/QuickSort.h>
 #include <AK/Platform.h>
 #include <AK/StackInfo.h>
 #include <AK/TemporaryChange.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibCore/MemoryReporting.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Heap.h>
 #include <LibGC/HeapBlock.h>
 #include <LibGC/NanBoxedValue.h>
 #include <LibGC/Root.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
 #include <setjmp.h>
 
 #ifdef HAS_ADDRESS_SANITIZER
@@ -28,6 +32,33 @@
 
 namespace GC {
 
+static StringView heap_root_type_name(HeapRoot::Type type)
+{
+    switch (type) {
+    case HeapRoot::Type::HeapFunctionCapturedPointer:
+        return "HeapFunction"sv;
+    case HeapRoot::Type::Root:
+        return "Root"sv;
+    case HeapRoot::Type::RootVector:
+        return "RootVector"sv;
+    case HeapRoot::Type::RootHashMap:
+        return "RootHashMap"sv;
+    case HeapRoot::Type::ConservativeVector:
+        return "ConservativeVector"sv;
+    case HeapRoot::Type::RegisterPointer:
+        return "RegisterPointer"sv;
+    case HeapRoot::Type::StackPointer:
+        return "StackPointer"sv;
+    case HeapRoot::Type::VM:
+        return "VM"sv;
+    case HeapRoot::Type::ExecutionContext:
+        return "ExecutionContext"sv;
+    case HeapRoot::Type::__Count:
+        break;
+    }
+    VERIFY_NOT_REACHED();
+}
+
 Heap::Heap(void* private_data, AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> gather_embedder_roots)
     : HeapBase(private_data)
     , m_gather_embedder_roots(move(gather_embedder_roots))
@@ -40,11 +71,39 @@ Heap::Heap(void* private_data, AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)>
     m_size_based_cell_allocators.append(make<CellAllocator>(512));
     m_size_based_cell_allocators.append(make<CellAllocator>(1024));
     m_size_based_cell_allocators.append(make<CellAllocator>(3072));
+
+    m_memory_reporter_id = Core::MemoryReporting::register_reporter([this](Core::MemoryReports& reports) {
+        report_memory_usage(reports);
+    });
 }
 
 Heap::~Heap()
 {
+    Core::MemoryReporting::unregister_reporter(m_memory_reporter_id);
+
     collect_garbage(CollectionType::CollectEverything);
+    release_empty_blocks();
+}
+
+void Heap::report_memory_usage(Core::MemoryReports& reports)
+{
+    // NOTE: Counting the cells in each block would be too slow to do whenever we're asked, so we report the memory
+    //       the blocks of each allocator take up instead. Cells of types without their own allocator are grouped by size.
+    for (auto& allocator : m_all_cell_allocators) {
+        if (allocator.block_count() == 0)
+            continue;
+
+        auto path = allocator.class_name()
+            ? MUST(String::formatted("gc-heap/{}", allocator.class_name()))
+            : MUST(String::formatted("gc-heap/{}-byte-cells", allocator.cell_size()));
+        reports.add(move(path), allocator.block_count() * HeapBlock::block_size);
+    }
+}
+
+void Heap::release_empty_blocks()
+{
+    for (auto& allocator : m_all_cell_allocators)
+        allocator.release_empty_blocks({});
 }
 
 void Heap::will_allocate(size_t size)
@@ -53,13 +112,47 @@ void Heap::will_allocate(size_t size)
         m_allocated_bytes_since_last_gc = 0;
         collect_garbage();
     } else if (m_allocated_bytes_since_last_gc + size > m_gc_bytes_threshold) {
-        m_allocated_bytes_since_last_gc = 0;
-        collect_garbage();
+        // Latency-sensitive work gets some slack before we interrupt it with a collection, but not an unbounded amount.
+        if (!m_gc_postponements || m_allocated_bytes_since_last_gc + size > m_gc_bytes_threshold * GC_POSTPONED_THRESHOLD_MULTIPLIER) {
+            m_allocated_bytes_since_last_gc = 0;
+            collect_garbage();
+        }
     }
 
     m_allocated_bytes_since_last_gc += size;
 }
 
+void Heap::collect_garbage_if_due_soon()
+{
+    if (m_collecting_garbage || m_gc_deferrals || m_gc_postponements)
+        return;
+    if (m_allocated_bytes_since_last_gc < m_gc_bytes_threshold / 2)
+        return;
+
+    m_allocated_bytes_since_last_gc = 0;
+    collect_garbage();
+}
+
+void Heap::set_heap_growth_factor(double factor)
+{
+    VERIFY(factor > 0);
+    m_heap_growth_factor = factor;
+    update_gc_bytes_threshold();
+}
+
+void Heap::update_gc_bytes_threshold()
+{
+    auto growth_factor = m_heap_growth_factor;
+
+    // If most of the heap survived the last collection, the program is building up data rather than churning through
+    // it. Give it more room, so that we don't keep collecting without finding much garbage.
+    if (m_heap_is_growing)
+        growth_factor *= 2;
+
+    auto threshold = static_cast<size_t>(static_cast<double>(m_live_cell_bytes_after_last_gc) * growth_factor);
+    m_gc_bytes_threshold = max(threshold, GC_MIN_BYTES_THRESHOLD);
+}
+
 static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
 {
     if constexpr (sizeof(FlatPtr*) == sizeof(NanBoxedValue)) {
@@ -111,8 +204,10 @@ static void for_each_cell_among_possible_pointers(HashTable<HeapBlock*> const& a
 
 class GraphConstructorVisitor final : public Cell::Visitor {
 public:
-    explicit GraphConstructorVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
+    explicit GraphConstructorVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots, JsonObjectSerializer<StringBuilder>& graph)
         : m_heap(heap)
+        , m_roots(roots)
+        , m_graph(graph)
     {
         m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
         m_heap.for_each_block([&](auto& block) {
@@ -121,24 +216,14 @@ public:
         });
         m_work_queue.ensure_capacity(roots.size());
 
-        for (auto& [root, root_origin] : roots) {
-            auto& graph_node = m_graph.ensure(bit_cast<FlatPtr>(root));
-            graph_node.class_name = root->class_name();
-            graph_node.root_origin = root_origin;
-
-            m_work_queue.append(*root);
-        }
+        for (auto* root : roots.keys())
+            enqueue(*root);
     }
 
     virtual void visit_impl(Cell& cell) override
     {
-        if (m_node_being_visited)
-            m_node_being_visited->edges.set(reinterpret_cast<FlatPtr>(&cell));
-
-        if (m_graph.get(reinterpret_cast<FlatPtr>(&cell)).has_value())
-            return;
-
-        m_work_queue.append(cell);
+        m_edges.set(reinterpret_cast<FlatPtr>(&cell));
+        enqueue(cell);
     }
 
     virtual void visit_possible_values(ReadonlyBytes bytes) override
@@ -150,91 +235,106 @@ public:
             add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
 
         for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
-            if (m_node_being_visited)
-                m_node_being_visited->edges.set(reinterpret_cast<FlatPtr>(cell));
-
-            if (m_graph.get(reinterpret_cast<FlatPtr>(&cell)).has_value())
-                return;
-            m_work_queue.append(*cell);
+            m_edges.set(reinterpret_cast<FlatPtr>(cell));
+            enqueue(*cell);
         });
     }
 
+    // Each node is written out as soon as its edges are known, so only the set of visited cells is kept in memory.
     void visit_all_cells()
     {
         while (!m_work_queue.is_empty()) {
             auto cell = m_work_queue.take_last();
-            m_node_being_visited = &m_graph.ensure(bit_cast<FlatPtr>(cell.ptr()));
-            m_node_being_visited->class_name = cell->class_name();
+            m_edges.clear_with_capacity();
             cell->visit_edges(*this);
-            m_node_being_visited = nullptr;
+            write_node(*cell);
         }
     }
 
-    AK::JsonObject dump()
+private:
+    void enqueue(Cell& cell)
     {
-        auto graph = AK::JsonObject();
-        for (auto& it : m_graph) {
-            AK::JsonArray edges;
-            for (auto const& value : it.value.edges) {
-                edges.must_append(MUST(String::formatted("{}", value)));
-            }
+        if (m_visited_cells.set(&cell) == HashSetResult::InsertedNewEntry)
+            m_work_queue.append(cell);
+    }
 
-            auto node = AK::JsonObject();
-            if (it.value.root_origin.has_value()) {
-                auto type = it.value.root_origin->type;
-                auto location = it.value.root_origin->location;
-                switch (type) {
-                case HeapRoot::Type::Root:
-                    node.set("root"sv, MUST(String::formatted("Root {} {}:{}", location->function_name(), location->filename(), location->line_number())));
-                    break;
-                case HeapRoot::Type::RootVector:
-                    node.set("root"sv, "RootVector"sv);
-                    break;
-                case HeapRoot::Type::RegisterPointer:
-                    node.set("root"sv, "RegisterPointer"sv);
-                    break;
-                case HeapRoot::Type::StackPointer:
-                    node.set("root"sv, "StackPointer"sv);
-                    break;
-                case HeapRoot::Type::VM:
-                    node.set("root"sv, "VM"sv);
-                    break;
-                default:
-                    VERIFY_NOT_REACHED();
-                }
+    void write_node(Cell& cell)
+    {
+        auto node = MUST(m_graph.add_object(ByteString::number(bit_cast<FlatPtr>(&cell))));
+
+        if (auto root_origin = m_roots.get(&cell); root_origin.has_value()) {
+            if (root_origin->type == HeapRoot::Type::Root) {
+                auto const* location = root_origin->location;
+                MUST(node.add("root"sv, MUST(String::formatted("Root {} {}:{}", location->function_name(), location->filename(), location->line_number()))));
+            } else {
+                MUST(node.add("root"sv, heap_root_type_name(root_origin->type)));
             }
-            node.set("class_name"sv, it.value.class_name);
-            node.set("edges"sv, edges);
-            graph.set(ByteString::number(it.key), node);
         }
 
-        return graph;
-    }
+        MUST(node.add("class_name"sv, cell.class_name()));
 
-private:
-    struct GraphNode {
-        Optional<HeapRoot> root_origin;
-        StringView class_name;
-        HashTable<FlatPtr> edges {};
-    };
+        if (auto allocation_site = m_heap.allocation_site_of(cell); allocation_site.has_value())
+            MUST(node.add("allocation_site"sv, *allocation_site));
 
-    GraphNode* m_node_being_visited { nullptr };
-    Vector<Ref<Cell>> m_work_queue;
-    HashMap<FlatPtr, GraphNode> m_graph;
+        auto edges = MUST(node.add_array("edges"sv));
+        for (auto edge : m_edges)
+            MUST(edges.add(ByteString::number(edge)));
+        MUST(edges.finish());
+
+        MUST(node.finish());
+    }
 
     Heap& m_heap;
+    HashMap<Cell*, HeapRoot> const& m_roots;
+    JsonObjectSerializer<StringBuilder>& m_graph;
+    HashTable<Cell*> m_visited_cells;
+    HashTable<FlatPtr> m_edges;
+    Vector<Ref<Cell>> m_work_queue;
     HashTable<HeapBlock*> m_all_live_heap_blocks;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
 
-AK::JsonObject Heap::dump_graph()
+void Heap::dump_graph(StringBuilder& builder)
 {
     HashMap<Cell*, HeapRoot> roots;
     gather_roots(roots);
-    GraphConstructorVisitor visitor(*this, roots);
+
+    auto graph = MUST(JsonObjectSerializer<StringBuilder>::try_create(builder));
+    GraphConstructorVisitor visitor(*this, roots, graph);
     visitor.visit_all_cells();
-    return visitor.dump();
+    MUST(graph.finish());
+}
+
+void Heap::set_allocation_site_tracker(AK::Function<Optional<String>()> tracker)
+{
+    m_allocation_site_tracker = move(tracker);
+    if (!m_allocation_site_tracker) {
+        m_allocation_sites.clear();
+        m_allocation_site_indices.clear();
+        m_allocation_site_index_of_cell.clear();
+    }
+}
+
+void Heap::record_allocation_site(Cell const& cell)
+{
+    auto allocation_site = m_allocation_site_tracker();
+    if (!allocation_site.has_value())
+        return;
+
+    auto index = m_allocation_site_indices.ensure(*allocation_site, [&] {
+        m_allocation_sites.append(*allocation_site);
+        return static_cast<u32>(m_allocation_sites.size() - 1);
+    });
+    m_allocation_site_index_of_cell.set(&cell, index);
+}
+
+Optional<String const&> Heap::allocation_site_of(Cell const& cell) const
+{
+    auto index = m_allocation_site_index_of_cell.get(&cell);
+    if (!index.has_value())
+        return {};
+    return m_allocation_sites[*index];
 }
 
 void Heap::collect_garbage(CollectionType collection_type, bool print_report)
@@ -253,8 +353,14 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
                 m_should_gc_when_deferral_ends = true;
                 return;
             }
+            release_empty_blocks();
             HashMap<Cell*, HeapRoot> roots;
             gather_roots(roots);
+            if (print_report) {
+                m_root_statistics.roots_by_type.fill(0);
+                for (auto const& it : roots)
+                    ++m_root_statistics.roots_by_type[to_underlying(it.value.type)];
+            }
             mark_live_cells(roots);
         }
         finalize_unmarked_cells();
@@ -335,7 +441,33 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
 
     auto stack_reference = bit_cast<FlatPtr>(&dummy);
 
+    Vector<ReadonlyBytes> precisely_rooted_stack_ranges;
+    if (m_gather_precisely_rooted_stack_ranges) {
+        m_gather_precisely_rooted_stack_ranges(precisely_rooted_stack_ranges);
+        quick_sort(precisely_rooted_stack_ranges, [](auto const& a, auto const& b) { return a.data() < b.data(); });
+    }
+
+    m_root_statistics.scanned_stack_words = 0;
+    m_root_statistics.skipped_stack_words = 0;
+    size_t next_precise_range_index = 0;
+
+    auto range_begin = [](ReadonlyBytes range) { return bit_cast<FlatPtr>(range.data()); };
+    auto range_end = [](ReadonlyBytes range) { return bit_cast<FlatPtr>(range.data()) + range.size(); };
+
     for (FlatPtr stack_address = stack_reference; stack_address < m_stack_info.top(); stack_address += sizeof(FlatPtr)) {
+        while (next_precise_range_index < precisely_rooted_stack_ranges.size()
+            && range_end(precisely_rooted_stack_ranges[next_precise_range_index]) <= stack_address) {
+            ++next_precise_range_index;
+        }
+        if (next_precise_range_index < precisely_rooted_stack_ranges.size()
+            && range_begin(precisely_rooted_stack_ranges[next_precise_range_index]) <= stack_address) {
+            auto end_of_range = align_up_to(range_end(precisely_rooted_stack_ranges[next_precise_range_index]), sizeof(FlatPtr));
+            m_root_statistics.skipped_stack_words += (end_of_range - stack_address) / sizeof(FlatPtr);
+            stack_address = end_of_range - sizeof(FlatPtr);
+            continue;
+        }
+
+        ++m_root_statistics.scanned_stack_words;
         auto data = *reinterpret_cast<FlatPtr*>(stack_address);
         add_possible_value(possible_pointers, data, HeapRoot { .type = HeapRoot::Type::StackPointer }, min_block_address, max_block_address);
         gather_asan_fake_stack_roots(possible_pointers, data, min_block_address, max_block_address);
@@ -414,6 +546,12 @@ public:
         }
     }
 
+    Vector<Ref<Cell>> take_work_queue() { return move(m_work_queue); }
+
+    HashTable<HeapBlock*> const& all_live_heap_blocks() const { return m_all_live_heap_blocks; }
+    FlatPtr min_block_address() const { return m_min_block_address; }
+    FlatPtr max_block_address() const { return m_max_block_address; }
+
 private:
     Heap& m_heap;
     Vector<Ref<Cell>> m_work_queue;
@@ -422,13 +560,264 @@ private:
     FlatPtr m_max_block_address;
 };
 
+// Drains the marking work queue on several threads at once. Every worker traces from its own local stack,
+// and hands half of it over to a shared pool whenever that pool runs dry, so idle workers can pick it up.
+// Marking is finished once every worker is idle and the shared pool is empty.
+class ParallelMarker {
+public:
+    ParallelMarker(HashTable<HeapBlock*> const& all_live_heap_blocks, FlatPtr min_block_address, FlatPtr max_block_address)
+        : m_all_live_heap_blocks(all_live_heap_blocks)
+        , m_min_block_address(min_block_address)
+        , m_max_block_address(max_block_address)
+    {
+    }
+
+    void mark_all_live_cells(Vector<Ref<Cell>> initial_work, ParallelMarkingThreadPool&);
+
+private:
+    friend class ParallelMarkingWorker;
+
+    bool wants_work() const { return m_shared_work_is_empty.load(AK::MemoryOrder::memory_order_relaxed); }
+    void donate_work(Vector<Ref<Cell>>& local_work);
+    bool take_work(Vector<Ref<Cell>>& local_work);
+
+    HashTable<HeapBlock*> const& m_all_live_heap_blocks;
+    FlatPtr m_min_block_address;
+    FlatPtr m_max_block_address;
+
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_work_available { m_mutex };
+    Vector<Vector<Ref<Cell>>> m_shared_work;
+    Atomic<bool> m_shared_work_is_empty { true };
+    size_t m_thread_count { 0 };
+    size_t m_idle_workers { 0 };
+    bool m_done { false };
+};
+
+class ParallelMarkingWorker final : public Cell::Visitor {
+public:
+    explicit ParallelMarkingWorker(ParallelMarker& marker)
+        : m_marker(marker)
+    {
+    }
+
+    virtual void visit_impl(Cell& cell) override
+    {
+        if (!cell.try_set_marked_atomically())
+            return;
+        m_work.append(cell);
+    }
+
+    virtual void visit_possible_values(ReadonlyBytes bytes) override
+    {
+        HashMap<FlatPtr, HeapRoot> possible_pointers;
+
+        auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
+        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
+            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_marker.m_min_block_address, m_marker.m_max_block_address);
+
+        for_each_cell_among_possible_pointers(m_marker.m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
+            if (cell->state() != Cell::State::Live)
+                return;
+            if (!cell->try_set_marked_atomically())
+                return;
+            m_work.append(*cell);
+        });
+    }
+
+    void run()
+    {
+        static constexpr size_t min_work_to_donate = 64;
+
+        for (;;) {
+            while (!m_work.is_empty()) {
+                if (m_work.size() >= min_work_to_donate * 2 && m_marker.wants_work())
+                    m_marker.donate_work(m_work);
+                m_work.take_last()->visit_edges(*this);
+            }
+            if (!m_marker.take_work(m_work))
+                return;
+        }
+    }
+
+private:
+    ParallelMarker& m_marker;
+    Vector<Ref<Cell>> m_work;
+};
+
+void ParallelMarker::donate_work(Vector<Ref<Cell>>& local_work)
+{
+    Vector<Ref<Cell>> donation;
+    auto donation_size = local_work.size() / 2;
+    donation.ensure_capacity(donation_size);
+    for (size_t i = 0; i < donation_size; ++i)
+        donation.unchecked_append(local_work[i]);
+    local_work.remove(0, donation_size);
+
+    Threading::MutexLocker locker(m_mutex);
+    m_shared_work.append(move(donation));
+    m_shared_work_is_empty.store(false, AK::MemoryOrder::memory_order_relaxed);
+    m_work_available.signal();
+}
+
+bool ParallelMarker::take_work(Vector<Ref<Cell>>& local_work)
+{
+    Threading::MutexLocker locker(m_mutex);
+    ++m_idle_workers;
+    while (m_shared_work.is_empty()) {
+        if (m_done)
+            return false;
+        if (m_idle_workers == m_thread_count) {
+            m_done = true;
+            m_work_available.broadcast();
+            return false;
+        }
+        m_work_available.wait();
+    }
+    --m_idle_workers;
+    local_work = m_shared_work.take_last();
+    m_shared_work_is_empty.store(m_shared_work.is_empty(), AK::MemoryOrder::memory_order_relaxed);
+    return true;
+}
+
+// Threads that help out with marking. They are started once, and wait for the next collection in between.
+// The collecting thread takes part in every collection as one more worker.
+class ParallelMarkingThreadPool {
+    AK_MAKE_NONCOPYABLE(ParallelMarkingThreadPool);
+    AK_MAKE_NONMOVABLE(ParallelMarkingThreadPool);
+
+public:
+    explicit ParallelMarkingThreadPool(size_t helper_thread_count)
+    {
+        m_helper_threads.ensure_capacity(helper_thread_count);
+        for (size_t i = 0; i < helper_thread_count; ++i) {
+            auto thread = Threading::Thread::construct([this]() -> intptr_t {
+                help_with_marking();
+                return 0;
+            },
+                "GC Marker"sv);
+            thread->start();
+            m_helper_threads.unchecked_append(move(thread));
+        }
+    }
+
+    ~ParallelMarkingThreadPool()
+    {
+        {
+            Threading::MutexLocker locker(m_mutex);
+            m_exiting = true;
+            m_job_available.broadcast();
+        }
+        for (auto& thread : m_helper_threads)
+            (void)thread->join();
+    }
+
+    size_t thread_count() const { return m_helper_threads.size() + 1; }
+
+    // Runs the marker on every helper thread and on the calling thread, and returns once all of them are done.
+    void run(ParallelMarker& marker)
+    {
+        {
+            Threading::MutexLocker locker(m_mutex);
+            m_job = &marker;
+            ++m_job_generation;
+            m_busy_helper_threads = m_helper_threads.size();
+            m_job_available.broadcast();
+        }
+
+        ParallelMarkingWorker worker(marker);
+        worker.run();
+
+        Threading::MutexLocker locker(m_mutex);
+        while (m_busy_helper_threads > 0)
+            m_job_finished.wait();
+        m_job = nullptr;
+    }
+
+private:
+    void help_with_marking()
+    {
+        u64 last_job_generation = 0;
+        for (;;) {
+            ParallelMarker* job = nullptr;
+            {
+                Threading::MutexLocker locker(m_mutex);
+                while (!m_exiting && m_job_generation == last_job_generation)
+                    m_job_available.wait();
+                if (m_exiting)
+                    return;
+                last_job_generation = m_job_generation;
+                job = m_job;
+            }
+
+            ParallelMarkingWorker worker(*job);
+            worker.run();
+
+            Threading::MutexLocker locker(m_mutex);
+            if (--m_busy_helper_threads == 0)
+                m_job_finished.signal();
+        }
+    }
+
+    Vector<NonnullRefPtr<Threading::Thread>> m_helper_threads;
+
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_job_available { m_mutex };
+    Threading::ConditionVariable m_job_finished { m_mutex };
+    ParallelMarker* m_job { nullptr };
+    u64 m_job_generation { 0 };
+    size_t m_busy_helper_threads { 0 };
+    bool m_exiting { false };
+};
+
+void ParallelMarker::mark_all_live_cells(Vector<Ref<Cell>> initial_work, ParallelMarkingThreadPool& thread_pool)
+{
+    auto thread_count = thread_pool.thread_count();
+    VERIFY(thread_count > 1);
+    m_thread_count = thread_count;
+
+    // Seed the shared pool with one slice of the roots' direct children per worker.
+    auto slice_size = ceil_div(initial_work.size(), thread_count);
+    for (size_t offset = 0; offset < initial_work.size(); offset += slice_size) {
+        Vector<Ref<Cell>> slice;
+        auto end = min(offset + slice_size, initial_work.size());
+        slice.ensure_capacity(end - offset);
+        for (size_t i = offset; i < end; ++i)
+            slice.unchecked_append(initial_work[i]);
+        m_shared_work.append(move(slice));
+    }
+    m_shared_work_is_empty.store(m_shared_work.is_empty(), AK::MemoryOrder::memory_order_relaxed);
+
+    thread_pool.run(*this);
+}
+
+void Heap::set_marking_thread_count(size_t count)
+{
+    VERIFY(count > 0);
+    if (count == m_marking_thread_count)
+        return;
+    m_marking_thread_count = count;
+
+    // NOTE: The pool is started again with the new number of threads by the next collection that needs it.
+    m_parallel_marking_thread_pool = nullptr;
+}
+
 void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
 {
     dbgln_if(HEAP_DEBUG, "mark_live_cells:");
 
     MarkingVisitor visitor(*this, roots);
 
-    visitor.mark_all_live_cells();
+    if (m_marking_thread_count > 1 && visitor.all_live_heap_blocks().size() >= minimum_live_blocks_for_parallel_marking) {
+        if (!m_parallel_marking_thread_pool)
+            m_parallel_marking_thread_pool = make<ParallelMarkingThreadPool>(m_marking_thread_count - 1);
+        ParallelMarker parallel_marker(visitor.all_live_heap_blocks(), visitor.min_block_address(), visitor.max_block_address());
+        parallel_marker.mark_all_live_cells(visitor.take_work_queue(), *m_parallel_marking_thread_pool);
+        m_marking_threads_used_by_last_collection = m_marking_thread_count;
+    } else {
+        visitor.mark_all_live_cells();
+        m_marking_threads_used_by_last_collection = 1;
+    }
 
     for (auto& inverse_root : m_uprooted_cells)
         inverse_root->set_marked(false);
@@ -472,6 +861,8 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     size_t live_cells = 0;
     size_t collected_cell_bytes = 0;
     size_t live_cell_bytes = 0;
+    size_t collected_new_cells = 0;
+    size_t surviving_new_cells = 0;
 
     for_each_block([&](auto& block) {
         bool block_has_live_cells = false;
@@ -479,11 +870,19 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked()) {
                 dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
+                if (!cell->has_survived_a_collection())
+                    ++collected_new_cells;
+                if (!m_allocation_site_index_of_cell.is_empty())
+                    m_allocation_site_index_of_cell.remove(cell);
                 block.deallocate(cell);
                 ++collected_cells;
                 collected_cell_bytes += block.cell_size();
             } else {
                 cell->set_marked(false);
+                if (!cell->has_survived_a_collection()) {
+                    cell->set_has_survived_a_collection(true);
+                    ++surviving_new_cells;
+                }
                 block_has_live_cells = true;
                 ++live_cells;
                 live_cell_bytes += block.cell_size();
@@ -516,7 +915,9 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         });
     }
 
-    m_gc_bytes_threshold = live_cell_bytes > GC_MIN_BYTES_THRESHOLD ? live_cell_bytes : GC_MIN_BYTES_THRESHOLD;
+    m_live_cell_bytes_after_last_gc = live_cell_bytes;
+    m_heap_is_growing = collected_cell_bytes < live_cell_bytes / 8;
+    update_gc_bytes_threshold();
 
     if (print_report) {
         AK::Duration const time_spent = measurement_timer.elapsed_time();
@@ -531,8 +932,16 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         dbgln("     Time spent: {} ms", time_spent.to_milliseconds());
         dbgln("     Live cells: {} ({} bytes)", live_cells, live_cell_bytes);
         dbgln("Collected cells: {} ({} bytes)", collected_cells, collected_cell_bytes);
+        dbgln("      New cells: {} collected, {} survived", collected_new_cells, surviving_new_cells);
         dbgln("    Live blocks: {} ({} bytes)", live_block_count, live_block_count * HeapBlock::block_size);
-        dbgln("   Freed blocks: {} ({} bytes)", empty_blocks.size(), empty_blocks.size() * HeapBlock::block_size);
+        dbgln("  Parked blocks: {} ({} bytes)", empty_blocks.size(), empty_blocks.size() * HeapBlock::block_size);
+        dbgln("  Next GC after: {} bytes allocated", m_gc_bytes_threshold);
+        dbgln("    Stack words: {} scanned, {} skipped (precisely rooted)", m_root_statistics.scanned_stack_words, m_root_statistics.skipped_stack_words);
+        dbgln("          Roots:");
+        for (size_t i = 0; i < m_root_statistics.roots_by_type.size(); ++i) {
+            if (auto count = m_root_statistics.roots_by_type[i])
+                dbgln("{:>22}: {}", heap_root_type_name(static_cast<HeapRoot::Type>(i)), count);
+        }
         dbgln("=============================================");
     }
 }
@@ -554,6 +963,17 @@ void Heap::undefer_gc()
     }
 }
 
+void Heap::postpone_gc()
+{
+    ++m_gc_postponements;
+}
+
+void Heap::unpostpone_gc()
+{
+    VERIFY(m_gc_postponements > 0);
+    --m_gc_postponements;
+}
+
 void Heap::uproot_cell(Cell* cell)
 {
     m_uprooted_cells.append(cell);
@@ -6,13 +6,17 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Badge.h>
 #include <AK/Function.h>
+#include <AK/HashMap.h>
 #include <AK/HashTable.h>
 #include <AK/IntrusiveList.h>
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
 #include <AK/StackInfo.h>
+#include <AK/String.h>
 #include <AK/Swift.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
@@ -30,6 +34,8 @@
 
 namespace GC {
 
+class ParallelMarkingThreadPool;
+
 class GC_API Heap : public HeapBase {
     AK_MAKE_NONCOPYABLE(Heap);
     AK_MAKE_NONMOVABLE(Heap);
@@ -45,6 +51,8 @@ public:
         defer_gc();
         new (memory) T(forward<Args>(args)...);
         undefer_gc();
+        if (m_allocation_site_tracker) [[unlikely]]
+            record_allocation_site(*static_cast<T*>(memory));
         return *static_cast<T*>(memory);
     }
 
@@ -54,7 +62,44 @@ public:
     };
 
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
-    AK::JsonObject dump_graph();
+
+    // Collects garbage if allocations are getting close to triggering a collection anyway, so that it happens at a
+    // convenient time instead. Embedders should call this when idle.
+    void collect_garbage_if_due_soon();
+
+    // The number of bytes that may be allocated between collections, as a multiple of the bytes that survived the last
+    // collection. Lower values trade throughput for a smaller heap, e.g. while nobody is looking at the page.
+    double heap_growth_factor() const { return m_heap_growth_factor; }
+    void set_heap_growth_factor(double);
+
+    // Hands the pages of blocks that were emptied by the last collection (and haven't been reused since) back to the OS.
+    // Embedders should call this when idle; it also happens at the start of every collection.
+    void release_empty_blocks();
+
+    // Writes the graph of all reachable cells as JSON, one node at a time, without building the whole graph in memory first.
+    void dump_graph(StringBuilder&);
+
+    // When set, the tracker is asked to describe the current allocation site (e.g. a JS source location) for every
+    // allocated cell. The description is included in dump_graph(). This is meant for memory investigations only.
+    void set_allocation_site_tracker(AK::Function<Optional<String>()>);
+    Optional<String const&> allocation_site_of(Cell const&) const;
+
+    // Stack ranges reported by this callback are rooted precisely by the embedder (e.g. interpreter frames that live
+    // on the native stack), so conservative stack scanning skips over them.
+    void set_gather_precisely_rooted_stack_ranges(AK::Function<void(Vector<ReadonlyBytes>&)> callback) { m_gather_precisely_rooted_stack_ranges = move(callback); }
+
+    // Number of threads (including the collecting thread) to use for marking. Defaults to 1, i.e. marking on the calling thread only.
+    // The helper threads are started by the first collection that marks in parallel, and are kept around for later ones.
+    // NOTE: Parallel marking requires every visit_edges() implementation reachable from this heap to be free of side effects.
+    size_t marking_thread_count() const { return m_marking_thread_count; }
+    void set_marking_thread_count(size_t);
+
+    // Marking a small heap is over before helper threads would even get to pick up work, so it stays on the collecting
+    // thread until the heap has at least this many live blocks.
+    static constexpr size_t minimum_live_blocks_for_parallel_marking = 64;
+
+    // How many threads marked live cells during the most recent collection.
+    size_t marking_threads_used_by_last_collection() const { return m_marking_threads_used_by_last_collection; }
 
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
@@ -86,11 +131,15 @@ private:
     friend class MarkingVisitor;
     friend class GraphConstructorVisitor;
     friend class DeferGC;
+    friend class PostponeGC;
     friend class ForeignCell;
 
     void defer_gc();
     void undefer_gc();
 
+    void postpone_gc();
+    void unpostpone_gc();
+
     static bool cell_must_survive_garbage_collection(Cell const&);
 
     template<typename T>
@@ -106,6 +155,9 @@ private:
     }
 
     void will_allocate(size_t);
+    void update_gc_bytes_threshold();
+    void report_memory_usage(Core::MemoryReports&);
+    void record_allocation_site(Cell const&);
 
     void find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address);
     void gather_roots(HashMap<Cell*, HeapRoot>&);
@@ -138,9 +190,22 @@ private:
     static constexpr size_t GC_MIN_BYTES_THRESHOLD { 4 * 1024 * 1024 };
     size_t m_gc_bytes_threshold { GC_MIN_BYTES_THRESHOLD };
     size_t m_allocated_bytes_since_last_gc { 0 };
+    size_t m_live_cell_bytes_after_last_gc { 0 };
+    double m_heap_growth_factor { 1.0 };
+    bool m_heap_is_growing { false };
+
+    // While collection is postponed, allocations may run this far past the threshold before we collect regardless.
+    static constexpr size_t GC_POSTPONED_THRESHOLD_MULTIPLIER { 2 };
+    size_t m_gc_postponements { 0 };
 
     bool m_should_collect_on_every_allocation { false };
 
+    int m_memory_reporter_id { 0 };
+
+    size_t m_marking_thread_count { 1 };
+    size_t m_marking_threads_used_by_last_collection { 0 };
+    OwnPtr<ParallelMarkingThreadPool> m_parallel_marking_thread_pool;
+
     Vector<NonnullOwnPtr<CellAllocator>> m_size_based_cell_allocators;
     CellAllocator::List m_all_cell_allocators;
 
@@ -158,6 +223,19 @@ private:
     bool m_collecting_garbage { false };
     StackInfo m_stack_info;
     AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> m_gather_embedder_roots;
+    AK::Function<void(Vector<ReadonlyBytes>&)> m_gather_precisely_rooted_stack_ranges;
+
+    struct RootStatistics {
+        Array<size_t, to_underlying(HeapRoot::Type::__Count)> roots_by_type {};
+        size_t scanned_stack_words { 0 };
+        size_t skipped_stack_words { 0 };
+    };
+    RootStatistics m_root_statistics;
+
+    AK::Function<Optional<String>()> m_allocation_site_tracker;
+    Vector<String> m_allocation_sites;
+    HashMap<String, u32> m_allocation_site_indices;
+    HashMap<Cell const*, u32> m_allocation_site_index_of_cell;
 
     Vector<AK::Function<void()>> m_post_gc_tasks;
 } SWIFT_IMMORTAL_REFERENCE;
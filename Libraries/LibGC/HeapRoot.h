@@ -20,6 +20,8 @@ struct GC_API HeapRoot {
         RegisterPointer,
         StackPointer,
         VM,
+        ExecutionContext,
+        __Count,
     };
 
     Type type;
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Swift.h>
+#include <LibGC/Heap.h>
+
+namespace GC {
+
+// Unlike DeferGC, this only asks the heap to avoid collecting for a while, e.g. while rendering a frame. A collection
+// still happens if allocations run too far past the threshold.
+class GC_API PostponeGC {
+public:
+    explicit PostponeGC(Heap& heap)
+        : m_heap(heap)
+    {
+        m_heap.postpone_gc();
+    }
+
+    ~PostponeGC()
+    {
+        m_heap.unpostpone_gc();
+    }
+
+private:
+    Heap& m_heap;
+} SWIFT_NONCOPYABLE;
+
+}
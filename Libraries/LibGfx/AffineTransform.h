@@ -83,6 +83,8 @@ public:
     float determinant() const;
     Optional<AffineTransform> inverse() const;
 
+    [[nodiscard]] bool operator==(AffineTransform const&) const = default;
+
 private:
     float m_values[6] { 0 };
 };
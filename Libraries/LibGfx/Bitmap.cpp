@@ -9,6 +9,7 @@
 #include <AK/Bitmap.h>
 #include <AK/Checked.h>
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/ColorConversion.h>
 #include <LibGfx/ShareableBitmap.h>
 #include <errno.h>
 
@@ -250,16 +251,18 @@ void Bitmap::set_alpha_type_destructive(AlphaType alpha_type)
     if (alpha_type == m_alpha_type)
         return;
 
+    // NOTE: Pixels without an alpha channel are opaque, which premultiplying leaves as they are.
+    if (!has_alpha_channel()) {
+        m_alpha_type = alpha_type;
+        return;
+    }
+
     if (m_alpha_type == AlphaType::Unpremultiplied) {
-        for (auto y = 0; y < height(); ++y) {
-            for (auto x = 0; x < width(); ++x)
-                set_pixel(x, y, get_pixel(x, y).to_premultiplied());
-        }
+        for (auto y = 0; y < height(); ++y)
+            premultiply_alpha({ scanline(y), static_cast<size_t>(width()) });
     } else if (m_alpha_type == AlphaType::Premultiplied) {
-        for (auto y = 0; y < height(); ++y) {
-            for (auto x = 0; x < width(); ++x)
-                set_pixel(x, y, get_pixel(x, y).to_unpremultiplied());
-        }
+        for (auto y = 0; y < height(); ++y)
+            unpremultiply_alpha({ scanline(y), static_cast<size_t>(width()) });
     } else {
         VERIFY_NOT_REACHED();
     }
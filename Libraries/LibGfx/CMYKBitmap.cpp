@@ -6,6 +6,7 @@
 
 #include <AK/Checked.h>
 #include <LibGfx/CMYKBitmap.h>
+#include <LibGfx/ColorConversion.h>
 
 namespace Gfx {
 
@@ -26,13 +27,9 @@ ErrorOr<NonnullRefPtr<Bitmap>> CMYKBitmap::to_low_quality_rgb() const
     if (!m_rgb_bitmap) {
         m_rgb_bitmap = TRY(Bitmap::create(BitmapFormat::BGRx8888, m_size));
 
-        for (int y = 0; y < m_size.height(); ++y) {
-            for (int x = 0; x < m_size.width(); ++x) {
-                auto const& cmyk = scanline(y)[x];
-                u8 k = 255 - cmyk.k;
-                m_rgb_bitmap->scanline(y)[x] = Color((255 - cmyk.c) * k / 255, (255 - cmyk.m) * k / 255, (255 - cmyk.y) * k / 255).value();
-            }
-        }
+        auto width = static_cast<size_t>(m_size.width());
+        for (int y = 0; y < m_size.height(); ++y)
+            convert_cmyk_to_bgrx({ scanline(y), width }, { m_rgb_bitmap->scanline(y), width });
     }
 
     return *m_rgb_bitmap;
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BitCast.h>
+#include <AK/Endian.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <LibGfx/ColorConversion.h>
+
+namespace Gfx {
+
+using AK::SIMD::expand4;
+using AK::SIMD::f32x4;
+using AK::SIMD::load_unaligned;
+using AK::SIMD::store_unaligned;
+using AK::SIMD::to_f32x4;
+using AK::SIMD::to_u32x4;
+using AK::SIMD::u32x4;
+
+static constexpr size_t pixels_per_vector = 4;
+
+// Divides by 255, rounding down, without a division. This is exact for every product of two 8-bit values.
+template<typename T>
+static ALWAYS_INLINE T divide_by_255(T value)
+{
+    return (value * 0x8081u) >> 23;
+}
+
+void premultiply_alpha(Span<ARGB32> pixels)
+{
+    size_t i = 0;
+    for (; i + pixels_per_vector <= pixels.size(); i += pixels_per_vector) {
+        auto pixel = load_unaligned<u32x4>(pixels.data() + i);
+        auto alpha = pixel >> 24;
+        auto channel_mask = expand4(0xffu);
+
+        auto first = divide_by_255(((pixel >> 16) & channel_mask) * alpha);
+        auto second = divide_by_255(((pixel >> 8) & channel_mask) * alpha);
+        auto third = divide_by_255((pixel & channel_mask) * alpha);
+        store_unaligned(pixels.data() + i, (alpha << 24) | (first << 16) | (second << 8) | third);
+    }
+
+    for (; i < pixels.size(); ++i)
+        pixels[i] = Color::from_argb(pixels[i]).to_premultiplied().value();
+}
+
+void unpremultiply_alpha(Span<ARGB32> pixels)
+{
+    size_t i = 0;
+    for (; i + pixels_per_vector <= pixels.size(); i += pixels_per_vector) {
+        auto pixel = load_unaligned<u32x4>(pixels.data() + i);
+        auto alpha = pixel >> 24;
+        auto channel_mask = expand4(0xffu);
+
+        // NOTE: Both operands are integers well below 2^24 and the divisor is at most 255, so a quotient that isn't an
+        //       integer is never rounded up to one. Truncating the float quotient thus matches the integer division.
+        //       Like the per-pixel conversion, channels that end up larger than the alpha value wrap around.
+        auto alpha_as_float = to_f32x4(alpha);
+        auto unpremultiply = [&](u32x4 channel) {
+            return to_u32x4(to_f32x4(channel * 255u) / alpha_as_float) & channel_mask;
+        };
+        auto first = unpremultiply((pixel >> 16) & channel_mask);
+        auto second = unpremultiply((pixel >> 8) & channel_mask);
+        auto third = unpremultiply(pixel & channel_mask);
+        auto unpremultiplied = (alpha << 24) | (first << 16) | (second << 8) | third;
+
+        // Transparent and opaque pixels are left alone.
+        auto is_unchanged = bit_cast<u32x4>((alpha == 0u) | (alpha == 255u));
+        store_unaligned(pixels.data() + i, (pixel & is_unchanged) | (unpremultiplied & ~is_unchanged));
+    }
+
+    for (; i < pixels.size(); ++i)
+        pixels[i] = Color::from_argb(pixels[i]).to_unpremultiplied().value();
+}
+
+void convert_cmyk_to_bgrx(ReadonlySpan<CMYK> source, Span<ARGB32> destination)
+{
+    VERIFY(destination.size() >= source.size());
+
+    static_assert(sizeof(CMYK) == sizeof(u32));
+    static constexpr u32 c_shift = AK::HostIsLittleEndian ? 0 : 24;
+    static constexpr u32 m_shift = AK::HostIsLittleEndian ? 8 : 16;
+    static constexpr u32 y_shift = AK::HostIsLittleEndian ? 16 : 8;
+    static constexpr u32 k_shift = AK::HostIsLittleEndian ? 24 : 0;
+
+    size_t i = 0;
+    for (; i + pixels_per_vector <= source.size(); i += pixels_per_vector) {
+        auto cmyk = load_unaligned<u32x4>(source.data() + i);
+        auto channel_mask = expand4(0xffu);
+
+        auto k = channel_mask - ((cmyk >> k_shift) & channel_mask);
+        auto red = divide_by_255((channel_mask - ((cmyk >> c_shift) & channel_mask)) * k);
+        auto green = divide_by_255((channel_mask - ((cmyk >> m_shift) & channel_mask)) * k);
+        auto blue = divide_by_255((channel_mask - ((cmyk >> y_shift) & channel_mask)) * k);
+        store_unaligned(destination.data() + i, expand4(0xff000000u) | (red << 16) | (green << 8) | blue);
+    }
+
+    for (; i < source.size(); ++i) {
+        auto const& cmyk = source[i];
+        u8 k = 255 - cmyk.k;
+        destination[i] = Color((255 - cmyk.c) * k / 255, (255 - cmyk.m) * k / 255, (255 - cmyk.y) * k / 255).value();
+    }
+}
+
+}
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Span.h>
+#include <LibGfx/CMYKBitmap.h>
+#include <LibGfx/Color.h>
+
+namespace Gfx {
+
+// Bulk conversions of whole rows or bitmaps of pixels. These work on several pixels at a time, and produce exactly the
+// same results as converting each pixel on its own with the equivalent Color functions.
+
+// The alpha channel is expected in the most significant byte, as in both BGRA8888 and RGBA8888 pixels. The order of
+// the other three channels doesn't matter.
+void premultiply_alpha(Span<ARGB32>);
+void unpremultiply_alpha(Span<ARGB32>);
+
+// Writes opaque BGRx8888 pixels. The destination must hold at least as many pixels as the source.
+void convert_cmyk_to_bgrx(ReadonlySpan<CMYK>, Span<ARGB32>);
+
+}
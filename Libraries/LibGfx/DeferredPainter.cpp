@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/DeferredPainter.h>
+
+namespace Gfx {
+
+DeferredPainter::DeferredPainter(NonnullOwnPtr<Painter> painter)
+    : m_painter(move(painter))
+{
+}
+
+DeferredPainter::~DeferredPainter() = default;
+
+void DeferredPainter::flush()
+{
+    for (auto const& command : m_commands) {
+        command.visit(
+            [&](ClearRect const& command) {
+                m_painter->clear_rect(command.rect, command.color);
+            },
+            [&](FillRect const& command) {
+                m_painter->fill_rect(command.rect, command.color);
+            },
+            [&](DrawScaledImmutableBitmap const& command) {
+                m_painter->draw_bitmap(command.dst_rect, command.bitmap, command.src_rect, command.scaling_mode, command.filter, command.global_alpha, command.compositing_and_blending_operator);
+            },
+            [&](StrokePathUsingColor const& command) {
+                if (command.blur.has_value())
+                    m_painter->stroke_path(command.path, command.color, command.thickness, command.blur->radius, command.blur->compositing_and_blending_operator);
+                else
+                    m_painter->stroke_path(command.path, command.color, command.thickness);
+            },
+            [&](StrokePathUsingPaintStyle const& command) {
+                if (auto const& line_style = command.line_style; line_style.has_value())
+                    m_painter->stroke_path(command.path, command.paint_style, command.filter, command.thickness, command.global_alpha, command.compositing_and_blending_operator, line_style->cap_style, line_style->join_style, line_style->miter_limit, line_style->dash_array, line_style->dash_offset);
+                else
+                    m_painter->stroke_path(command.path, command.paint_style, command.filter, command.thickness, command.global_alpha, command.compositing_and_blending_operator);
+            },
+            [&](FillPathUsingColor const& command) {
+                if (command.blur.has_value())
+                    m_painter->fill_path(command.path, command.color, command.winding_rule, command.blur->radius, command.blur->compositing_and_blending_operator);
+                else
+                    m_painter->fill_path(command.path, command.color, command.winding_rule);
+            },
+            [&](FillPathUsingPaintStyle const& command) {
+                m_painter->fill_path(command.path, command.paint_style, command.filter, command.global_alpha, command.compositing_and_blending_operator, command.winding_rule);
+            },
+            [&](SetTransform const& command) {
+                m_painter->set_transform(command.transform);
+            },
+            [&](Save const&) {
+                m_painter->save();
+            },
+            [&](Restore const&) {
+                m_painter->restore();
+            },
+            [&](AddClipPath const& command) {
+                m_painter->clip(command.path, command.winding_rule);
+            });
+    }
+    m_commands.clear_with_capacity();
+}
+
+void DeferredPainter::append(Command&& command)
+{
+    m_commands.append(move(command));
+    if (m_commands.size() >= maximum_pending_commands)
+        flush();
+}
+
+void DeferredPainter::clear_rect(Gfx::FloatRect const& rect, Color color)
+{
+    append(ClearRect { rect, color });
+}
+
+void DeferredPainter::fill_rect(Gfx::FloatRect const& rect, Color color)
+{
+    append(FillRect { rect, color });
+}
+
+void DeferredPainter::draw_bitmap(Gfx::FloatRect const& dst_rect, Gfx::ImmutableBitmap const& src_bitmap, Gfx::IntRect const& src_rect, Gfx::ScalingMode scaling_mode, Optional<Gfx::Filter> filter, float global_alpha, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator)
+{
+    append(DrawScaledImmutableBitmap { dst_rect, src_bitmap, src_rect, scaling_mode, move(filter), global_alpha, compositing_and_blending_operator });
+}
+
+void DeferredPainter::stroke_path(Gfx::Path const& path, Gfx::Color color, float thickness)
+{
+    append(StrokePathUsingColor { path, color, thickness, {} });
+}
+
+void DeferredPainter::stroke_path(Gfx::Path const& path, Gfx::Color color, float thickness, float blur_radius, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator)
+{
+    append(StrokePathUsingColor { path, color, thickness, Blur { blur_radius, compositing_and_blending_operator } });
+}
+
+void DeferredPainter::stroke_path(Gfx::Path const& path, Gfx::PaintStyle const& paint_style, Optional<Gfx::Filter> filter, float thickness, float global_alpha, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator)
+{
+    append(StrokePathUsingPaintStyle { path, paint_style, move(filter), thickness, global_alpha, compositing_and_blending_operator, {} });
+}
+
+void DeferredPainter::stroke_path(Gfx::Path const& path, Gfx::PaintStyle const& paint_style, Optional<Gfx::Filter> filter, float thickness, float global_alpha, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator, Gfx::Path::CapStyle const& cap_style, Gfx::Path::JoinStyle const& join_style, float miter_limit, Vector<float> const& dash_array, float dash_offset)
+{
+    append(StrokePathUsingPaintStyle { path, paint_style, move(filter), thickness, global_alpha, compositing_and_blending_operator, LineStyle { cap_style, join_style, miter_limit, dash_array, dash_offset } });
+}
+
+void DeferredPainter::fill_path(Gfx::Path const& path, Gfx::Color color, Gfx::WindingRule winding_rule)
+{
+    append(FillPathUsingColor { path, color, winding_rule, {} });
+}
+
+void DeferredPainter::fill_path(Gfx::Path const& path, Gfx::Color color, Gfx::WindingRule winding_rule, float blur_radius, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator)
+{
+    append(FillPathUsingColor { path, color, winding_rule, Blur { blur_radius, compositing_and_blending_operator } });
+}
+
+void DeferredPainter::fill_path(Gfx::Path const& path, Gfx::PaintStyle const& paint_style, Optional<Gfx::Filter> filter, float global_alpha, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator, Gfx::WindingRule winding_rule)
+{
+    append(FillPathUsingPaintStyle { path, paint_style, move(filter), global_alpha, compositing_and_blending_operator, winding_rule });
+}
+
+void DeferredPainter::set_transform(Gfx::AffineTransform const& transform)
+{
+    // OPTIMIZATION: A transform that is replaced before anything was drawn with it has no effect.
+    if (!m_commands.is_empty() && m_commands.last().has<SetTransform>()) {
+        m_commands.last().get<SetTransform>().transform = transform;
+        return;
+    }
+    append(SetTransform { transform });
+}
+
+void DeferredPainter::save()
+{
+    append(Save {});
+}
+
+void DeferredPainter::restore()
+{
+    // OPTIMIZATION: If nothing was drawn since the matching save(), the transforms and clips set in between are undone
+    //               without ever having been used, so we can drop all of them together with the save().
+    for (size_t i = m_commands.size(); i > 0; --i) {
+        auto const& command = m_commands[i - 1];
+        if (command.has<Save>()) {
+            m_commands.shrink(i - 1);
+            return;
+        }
+        if (!command.has<SetTransform>() && !command.has<AddClipPath>())
+            break;
+    }
+    append(Restore {});
+}
+
+void DeferredPainter::clip(Gfx::Path const& path, Gfx::WindingRule winding_rule)
+{
+    append(AddClipPath { path, winding_rule });
+}
+
+}
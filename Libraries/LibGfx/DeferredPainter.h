@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+#include <LibGfx/AffineTransform.h>
+#include <LibGfx/ImmutableBitmap.h>
+#include <LibGfx/Painter.h>
+
+namespace Gfx {
+
+// A painter that records the commands it is given instead of executing them, and replays them on the wrapped painter
+// when flush() is called. This lets callers that issue many small draw calls (like canvas contexts) pay for setting up
+// the actual painter once per batch rather than once per call, and drops state changes that never affect any drawing.
+// Paint styles and bitmaps are kept by reference, so they must not be modified until the commands have been flushed.
+class DeferredPainter final : public Painter {
+public:
+    explicit DeferredPainter(NonnullOwnPtr<Painter>);
+    virtual ~DeferredPainter() override;
+
+    void flush();
+    bool has_pending_commands() const { return !m_commands.is_empty(); }
+
+    virtual void clear_rect(Gfx::FloatRect const&, Color) override;
+    virtual void fill_rect(Gfx::FloatRect const&, Color) override;
+    virtual void draw_bitmap(Gfx::FloatRect const& dst_rect, Gfx::ImmutableBitmap const& src_bitmap, Gfx::IntRect const& src_rect, Gfx::ScalingMode, Optional<Gfx::Filter>, float global_alpha, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator) override;
+    virtual void stroke_path(Gfx::Path const&, Gfx::Color, float thickness) override;
+    virtual void stroke_path(Gfx::Path const&, Gfx::Color, float thickness, float blur_radius, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator) override;
+    virtual void stroke_path(Gfx::Path const&, Gfx::PaintStyle const&, Optional<Gfx::Filter>, float thickness, float global_alpha, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator) override;
+    virtual void stroke_path(Gfx::Path const&, Gfx::PaintStyle const&, Optional<Gfx::Filter>, float thickness, float global_alpha, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator, Gfx::Path::CapStyle const&, Gfx::Path::JoinStyle const&, float miter_limit, Vector<float> const&, float dash_offset) override;
+    virtual void fill_path(Gfx::Path const&, Gfx::Color, Gfx::WindingRule) override;
+    virtual void fill_path(Gfx::Path const&, Gfx::Color, Gfx::WindingRule, float blur_radius, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator) override;
+    virtual void fill_path(Gfx::Path const&, Gfx::PaintStyle const&, Optional<Gfx::Filter>, float global_alpha, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator, Gfx::WindingRule) override;
+    virtual void set_transform(Gfx::AffineTransform const&) override;
+    virtual void save() override;
+    virtual void restore() override;
+    virtual void clip(Gfx::Path const&, Gfx::WindingRule) override;
+
+private:
+    // NOTE: These mirror the commands of the same name in Web::Painting::DisplayList, but carry everything the
+    //       Painter interface accepts, like filters and compositing operators.
+    struct ClearRect {
+        FloatRect rect;
+        Color color;
+    };
+    struct FillRect {
+        FloatRect rect;
+        Color color;
+    };
+    struct DrawScaledImmutableBitmap {
+        FloatRect dst_rect;
+        NonnullRefPtr<ImmutableBitmap const> bitmap;
+        IntRect src_rect;
+        ScalingMode scaling_mode;
+        Optional<Filter> filter;
+        float global_alpha;
+        CompositingAndBlendingOperator compositing_and_blending_operator;
+    };
+    // The painter overloads without a blur radius or line style do not touch those settings at all, so we keep track
+    // of which overload was used to replay exactly the same one.
+    struct Blur {
+        float radius;
+        CompositingAndBlendingOperator compositing_and_blending_operator;
+    };
+    struct LineStyle {
+        Path::CapStyle cap_style;
+        Path::JoinStyle join_style;
+        float miter_limit;
+        Vector<float> dash_array;
+        float dash_offset;
+    };
+
+    struct StrokePathUsingColor {
+        Path path;
+        Color color;
+        float thickness;
+        Optional<Blur> blur;
+    };
+    struct StrokePathUsingPaintStyle {
+        Path path;
+        NonnullRefPtr<PaintStyle const> paint_style;
+        Optional<Filter> filter;
+        float thickness;
+        float global_alpha;
+        CompositingAndBlendingOperator compositing_and_blending_operator;
+        Optional<LineStyle> line_style;
+    };
+    struct FillPathUsingColor {
+        Path path;
+        Color color;
+        WindingRule winding_rule;
+        Optional<Blur> blur;
+    };
+    struct FillPathUsingPaintStyle {
+        Path path;
+        NonnullRefPtr<PaintStyle const> paint_style;
+        Optional<Filter> filter;
+        float global_alpha;
+        CompositingAndBlendingOperator compositing_and_blending_operator;
+        WindingRule winding_rule;
+    };
+    struct SetTransform {
+        AffineTransform transform;
+    };
+    struct Save { };
+    struct Restore { };
+    struct AddClipPath {
+        Path path;
+        WindingRule winding_rule;
+    };
+
+    using Command = Variant<
+        ClearRect,
+        FillRect,
+        DrawScaledImmutableBitmap,
+        StrokePathUsingColor,
+        StrokePathUsingPaintStyle,
+        FillPathUsingColor,
+        FillPathUsingPaintStyle,
+        SetTransform,
+        Save,
+        Restore,
+        AddClipPath>;
+
+    void append(Command&&);
+
+    // Nobody may be around to flush a painter that keeps being drawn to, so we don't let the commands pile up forever.
+    static constexpr size_t maximum_pending_commands = 16384;
+
+    NonnullOwnPtr<Painter> m_painter;
+    Vector<Command> m_commands;
+};
+
+}
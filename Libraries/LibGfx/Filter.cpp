@@ -7,8 +7,11 @@
 #include <LibGfx/Filter.h>
 #include <LibGfx/FilterImpl.h>
 #include <LibGfx/SkiaUtils.h>
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
 #include <core/SkBlendMode.h>
 #include <core/SkColorFilter.h>
+#include <core/SkData.h>
 #include <effects/SkColorMatrix.h>
 #include <effects/SkImageFilters.h>
 
@@ -222,3 +225,29 @@ Filter Filter::hue_rotate(float angle_degrees, Optional<Filter const&> input)
 }
 
 }
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder& encoder, Gfx::Filter const& filter)
+{
+    auto serialized = filter.impl().filter->serialize();
+    TRY(encoder.encode<u64>(serialized->size()));
+    TRY(encoder.append(serialized->bytes(), serialized->size()));
+    return {};
+}
+
+template<>
+ErrorOr<Gfx::Filter> decode(Decoder& decoder)
+{
+    auto size = TRY(decoder.decode<u64>());
+    auto buffer = TRY(ByteBuffer::create_uninitialized(size));
+    TRY(decoder.decode_into(buffer.bytes()));
+
+    auto filter = SkImageFilter::Deserialize(buffer.data(), buffer.size());
+    if (!filter)
+        return Error::from_string_literal("IPC: Invalid Gfx::Filter data");
+    return Gfx::Filter { Gfx::FilterImpl::create(move(filter)) };
+}
+
+}
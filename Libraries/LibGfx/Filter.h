@@ -9,6 +9,7 @@
 #include <AK/NonnullOwnPtr.h>
 #include <LibGfx/Color.h>
 #include <LibGfx/CompositingAndBlendingOperator.h>
+#include <LibIPC/Forward.h>
 
 namespace Gfx {
 
@@ -44,8 +45,21 @@ public:
     FilterImpl const& impl() const;
 
 private:
+    template<typename T>
+    friend ErrorOr<T> IPC::decode(IPC::Decoder&);
+
     Filter(NonnullOwnPtr<FilterImpl>&&);
     NonnullOwnPtr<FilterImpl> m_impl;
 };
 
 }
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder&, Gfx::Filter const&);
+
+template<>
+ErrorOr<Gfx::Filter> decode(Decoder&);
+
+}
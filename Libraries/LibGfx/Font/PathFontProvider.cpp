@@ -6,16 +6,80 @@
 
 #include <AK/Format.h>
 #include <AK/LexicalPath.h>
+#include <AK/StringBuilder.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
 #include <LibCore/Resource.h>
+#include <LibCore/System.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/PathFontProvider.h>
 #include <LibGfx/Font/WOFF/Loader.h>
 
 namespace Gfx {
 
+static constexpr auto font_index_header = "PathFontProvider index v1"sv;
+
 PathFontProvider::PathFontProvider() = default;
 PathFontProvider::~PathFontProvider() = default;
 
+static bool is_font_file(LexicalPath const& path)
+{
+    return path.has_extension(".ttf"sv) || path.has_extension(".ttc"sv) || path.has_extension(".otf"sv) || path.has_extension(".woff"sv);
+}
+
+ErrorOr<NonnullRefPtr<Typeface>> PathFontProvider::load_typeface(Core::Resource const& resource)
+{
+    auto uri = resource.uri();
+    if (LexicalPath(uri.bytes_as_string_view()).has_extension(".woff"sv))
+        return WOFF::try_load_from_resource(resource);
+    return Typeface::try_load_from_resource(resource);
+}
+
+Typeface const* PathFontProvider::ensure_loaded(TypefaceEntry& entry)
+{
+    if (entry.typeface)
+        return entry.typeface.ptr();
+    if (entry.failed_to_load)
+        return nullptr;
+
+    // NOTE: Resources from the filesystem are memory-mapped, so the pages of a font file are shared with every other
+    //       process using the same font, and only the parts that are actually read ever get paged in.
+    auto typeface_or_error = [&]() -> ErrorOr<NonnullRefPtr<Typeface>> {
+        auto resource = TRY(Core::Resource::load_from_uri(entry.uri));
+        return load_typeface(*resource);
+    }();
+    if (typeface_or_error.is_error()) {
+        dbgln("PathFontProvider: Failed to load indexed font '{}': {}", entry.uri, typeface_or_error.error());
+        entry.failed_to_load = true;
+        return nullptr;
+    }
+
+    // The index is only trusted as far as the modification time goes, so don't hand out a typeface that doesn't match.
+    auto typeface = typeface_or_error.release_value();
+    if (typeface->weight() != entry.weight || typeface->width() != entry.width || typeface->slope() != entry.slope) {
+        dbgln("PathFontProvider: Indexed font '{}' does not match its index entry", entry.uri);
+        entry.failed_to_load = true;
+        return nullptr;
+    }
+
+    entry.typeface = move(typeface);
+    return entry.typeface.ptr();
+}
+
+void PathFontProvider::add_typeface_entry(String uri, IndexEntry const& index_entry, RefPtr<Typeface> typeface)
+{
+    auto& family = m_typeface_by_family.ensure(index_entry.family, [] {
+        return Vector<TypefaceEntry> {};
+    });
+    family.append({
+        .uri = move(uri),
+        .weight = index_entry.weight,
+        .width = index_entry.width,
+        .slope = index_entry.slope,
+        .typeface = move(typeface),
+    });
+}
+
 void PathFontProvider::load_all_fonts_from_uri(StringView uri)
 {
     auto root_or_error = Core::Resource::load_from_uri(uri);
@@ -28,28 +92,121 @@ void PathFontProvider::load_all_fonts_from_uri(StringView uri)
     }
     auto root = root_or_error.release_value();
 
-    root->for_each_descendant_file([this](Core::Resource const& resource) -> IterationDecision {
+    load_font_index();
+
+    HashTable<String> seen_uris;
+
+    root->for_each_descendant_file([&](Core::Resource const& resource) -> IterationDecision {
         auto uri = resource.uri();
-        auto path = LexicalPath(uri.bytes_as_string_view());
-        if (path.has_extension(".ttf"sv) || path.has_extension(".ttc"sv) || path.has_extension(".otf"sv)) {
-            if (auto font_or_error = Typeface::try_load_from_resource(resource); !font_or_error.is_error()) {
-                auto font = font_or_error.release_value();
-                auto& family = m_typeface_by_family.ensure(font->family(), [] {
-                    return Vector<NonnullRefPtr<Typeface>> {};
-                });
-                family.append(font);
-            }
-        } else if (path.has_extension(".woff"sv)) {
-            if (auto font_or_error = WOFF::try_load_from_resource(resource); !font_or_error.is_error()) {
-                auto font = font_or_error.release_value();
-                auto& family = m_typeface_by_family.ensure(font->family(), [] {
-                    return Vector<NonnullRefPtr<Typeface>> {};
-                });
-                family.append(font);
-            }
+        if (!is_font_file(LexicalPath(uri.bytes_as_string_view())))
+            return IterationDecision::Continue;
+
+        seen_uris.set(uri);
+
+        // The same directory may be reachable through more than one of the font directories.
+        if (m_registered_uris.set(uri) != HashSetResult::InsertedNewEntry)
+            return IterationDecision::Continue;
+
+        auto modified_time = resource.modified_time().value_or(0);
+
+        // OPTIMIZATION: If we've seen this exact file before, we already know its family and style, and can put off
+        //               loading it until somebody asks for it.
+        if (auto it = m_font_index.find(uri); it != m_font_index.end() && it->value.modified_time == modified_time) {
+            if (!it->value.family.is_empty())
+                add_typeface_entry(uri, it->value, nullptr);
+            return IterationDecision::Continue;
+        }
+
+        IndexEntry index_entry { .modified_time = modified_time };
+        RefPtr<Typeface> typeface;
+        if (auto typeface_or_error = load_typeface(resource); !typeface_or_error.is_error()) {
+            typeface = typeface_or_error.release_value();
+            index_entry.family = typeface->family();
+            index_entry.weight = typeface->weight();
+            index_entry.width = typeface->width();
+            index_entry.slope = typeface->slope();
+            add_typeface_entry(uri, index_entry, typeface);
         }
+
+        m_font_index.set(uri, move(index_entry));
+        m_font_index_dirty = true;
         return IterationDecision::Continue;
     });
+
+    // Forget about the fonts that have disappeared from this directory since the index was written.
+    auto root_prefix = MUST(String::formatted("{}/", root->uri()));
+    if (m_font_index.remove_all_matching([&](auto const& uri, auto const&) { return uri.starts_with_bytes(root_prefix) && !seen_uris.contains(uri); }))
+        m_font_index_dirty = true;
+
+    save_font_index();
+}
+
+void PathFontProvider::load_font_index()
+{
+    if (m_font_index_loaded || m_font_index_path.is_empty())
+        return;
+    m_font_index_loaded = true;
+
+    auto file_or_error = Core::File::open(m_font_index_path, Core::File::OpenMode::Read);
+    if (file_or_error.is_error())
+        return;
+    auto contents_or_error = file_or_error.value()->read_until_eof();
+    if (contents_or_error.is_error())
+        return;
+
+    auto lines = StringView { contents_or_error.value() }.split_view('\n');
+    if (lines.is_empty() || lines.first() != font_index_header)
+        return;
+
+    for (auto line : lines.span().slice(1)) {
+        auto fields = line.split_view('\t', SplitBehavior::KeepEmpty);
+        if (fields.size() != 6)
+            continue;
+
+        auto uri = String::from_utf8(fields[0]);
+        auto family = FlyString::from_utf8(fields[2]);
+        auto modified_time = fields[1].to_number<time_t>();
+        auto weight = fields[3].to_number<u16>();
+        auto width = fields[4].to_number<u16>();
+        auto slope = fields[5].to_number<u8>();
+        if (uri.is_error() || family.is_error() || !modified_time.has_value() || !weight.has_value() || !width.has_value() || !slope.has_value())
+            continue;
+
+        m_font_index.set(uri.release_value(), { .modified_time = *modified_time, .family = family.release_value(), .weight = *weight, .width = *width, .slope = *slope });
+    }
+}
+
+void PathFontProvider::save_font_index()
+{
+    if (!m_font_index_dirty || m_font_index_path.is_empty())
+        return;
+    m_font_index_dirty = false;
+
+    StringBuilder builder;
+    builder.append(font_index_header);
+    builder.append('\n');
+    for (auto const& [uri, entry] : m_font_index) {
+        // Anything we couldn't read back again is simply left out, and will be loaded on every startup instead.
+        if (uri.contains('\t') || uri.contains('\n') || entry.family.bytes_as_string_view().contains('\t') || entry.family.bytes_as_string_view().contains('\n'))
+            continue;
+        builder.appendff("{}\t{}\t{}\t{}\t{}\t{}\n", uri, entry.modified_time, entry.family, entry.weight, entry.width, entry.slope);
+    }
+
+    // NOTE: Other processes may be reading or writing the index at the same time, so we write a private copy and then
+    //       atomically move it into place. Failing to write the index is not a problem (e.g. when sandboxed), fonts will
+    //       just be loaded eagerly again next time.
+    auto write_index = [&]() -> ErrorOr<void> {
+        auto index_path = LexicalPath(m_font_index_path);
+        (void)Core::Directory::create(index_path.parent(), Core::Directory::CreateDirectories::Yes);
+
+        auto temporary_path = ByteString::formatted("{}.{}", m_font_index_path, Core::System::getpid());
+        auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+        TRY(file->write_until_depleted(builder.string_view().bytes()));
+        file->close();
+        TRY(Core::System::rename(temporary_path, m_font_index_path));
+        return {};
+    };
+    (void)write_index();
 }
 
 RefPtr<Gfx::Font> PathFontProvider::get_font(FlyString const& family, float point_size, unsigned weight, unsigned width, unsigned slope)
@@ -57,8 +214,10 @@ RefPtr<Gfx::Font> PathFontProvider::get_font(FlyString const& family, float poin
     auto it = m_typeface_by_family.find(family);
     if (it == m_typeface_by_family.end())
         return nullptr;
-    for (auto const& typeface : it->value) {
-        if (typeface->weight() == weight && typeface->width() == width && typeface->slope() == slope)
+    for (auto& entry : it->value) {
+        if (entry.weight != weight || entry.width != width || entry.slope != slope)
+            continue;
+        if (auto const* typeface = ensure_loaded(entry))
             return typeface->font(point_size);
     }
     return nullptr;
@@ -69,8 +228,9 @@ void PathFontProvider::for_each_typeface_with_family_name(FlyString const& famil
     auto it = m_typeface_by_family.find(family_name);
     if (it == m_typeface_by_family.end())
         return;
-    for (auto const& typeface : it->value) {
-        callback(*typeface);
+    for (auto& entry : it->value) {
+        if (auto const* typeface = ensure_loaded(entry))
+            callback(*typeface);
     }
 }
 
@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include <AK/ByteString.h>
 #include <AK/FlyString.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/Typeface.h>
 
@@ -24,6 +26,10 @@ public:
 
     void set_name_but_fixme_should_create_custom_system_font_provider(String name) { m_name = move(name); }
 
+    // Fonts we have seen before are remembered in an index at this path, keyed by URI and modification time. This lets
+    // us register them without opening them, and only load the ones that actually get used.
+    void set_font_index_path(ByteString path) { m_font_index_path = move(path); }
+
     void load_all_fonts_from_uri(StringView);
 
     virtual RefPtr<Gfx::Font> get_font(FlyString const& family, float point_size, unsigned weight, unsigned width, unsigned slope) override;
@@ -31,7 +37,40 @@ public:
     virtual StringView name() const override { return m_name.bytes_as_string_view(); }
 
 private:
-    HashMap<FlyString, Vector<NonnullRefPtr<Typeface>>, AK::ASCIICaseInsensitiveFlyStringTraits> m_typeface_by_family;
+    struct IndexEntry {
+        time_t modified_time { 0 };
+        // NOTE: An empty family means that the file could not be loaded as a font.
+        FlyString family;
+        u16 weight { 0 };
+        u16 width { 0 };
+        u8 slope { 0 };
+    };
+
+    struct TypefaceEntry {
+        String uri;
+        u16 weight { 0 };
+        u16 width { 0 };
+        u8 slope { 0 };
+        RefPtr<Typeface> typeface;
+        bool failed_to_load { false };
+    };
+
+    static ErrorOr<NonnullRefPtr<Typeface>> load_typeface(Core::Resource const&);
+    static Typeface const* ensure_loaded(TypefaceEntry&);
+
+    void add_typeface_entry(String uri, IndexEntry const&, RefPtr<Typeface>);
+
+    void load_font_index();
+    void save_font_index();
+
+    HashMap<FlyString, Vector<TypefaceEntry>, AK::ASCIICaseInsensitiveFlyStringTraits> m_typeface_by_family;
+    HashTable<String> m_registered_uris;
+
+    ByteString m_font_index_path;
+    HashMap<String, IndexEntry> m_font_index;
+    bool m_font_index_loaded { false };
+    bool m_font_index_dirty { false };
+
     String m_name { "Path"_string };
 };
 
@@ -55,12 +55,12 @@ public:
 
     hb_face_t* harfbuzz_typeface() const;
 
-protected:
-    Typeface();
-
     virtual ReadonlyBytes buffer() const = 0;
     virtual unsigned ttc_index() const = 0;
 
+protected:
+    Typeface();
+
 private:
     OwnPtr<FontData> m_font_data;
 
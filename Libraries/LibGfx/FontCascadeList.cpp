@@ -11,31 +11,43 @@ namespace Gfx {
 void FontCascadeList::add(NonnullRefPtr<Font const> font)
 {
     m_fonts.append({ move(font), {} });
+    m_font_for_code_point_cache.clear();
 }
 
 void FontCascadeList::add(NonnullRefPtr<Font const> font, Vector<UnicodeRange> unicode_ranges)
 {
     m_fonts.append({ move(font), move(unicode_ranges) });
+    m_font_for_code_point_cache.clear();
 }
 
 void FontCascadeList::extend(FontCascadeList const& other)
 {
     m_fonts.extend(other.m_fonts);
+    m_font_for_code_point_cache.clear();
 }
 
 Gfx::Font const& FontCascadeList::font_for_code_point(u32 code_point) const
 {
-    for (auto const& entry : m_fonts) {
-        if (entry.unicode_ranges.has_value()) {
-            for (auto const& range : *entry.unicode_ranges) {
-                if (range.contains(code_point) && entry.font->contains_glyph(code_point))
-                    return entry.font;
+    // NOTE: The first font covers most text, and checking it is cheaper than a cache lookup.
+    if (!m_fonts.is_empty()) {
+        auto const& first_entry = m_fonts.first();
+        if (!first_entry.unicode_ranges.has_value() && first_entry.font->contains_glyph(code_point))
+            return first_entry.font;
+    }
+
+    return *m_font_for_code_point_cache.ensure(code_point, [&]() -> Font const* {
+        for (auto const& entry : m_fonts) {
+            if (entry.unicode_ranges.has_value()) {
+                for (auto const& range : *entry.unicode_ranges) {
+                    if (range.contains(code_point) && entry.font->contains_glyph(code_point))
+                        return entry.font.ptr();
+                }
+            } else if (entry.font->contains_glyph(code_point)) {
+                return entry.font.ptr();
             }
-        } else if (entry.font->contains_glyph(code_point)) {
-            return entry.font;
         }
-    }
-    return *m_last_resort_font;
+        return m_last_resort_font.ptr();
+    });
 }
 
 bool FontCascadeList::equals(FontCascadeList const& other) const
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/UnicodeRange.h>
 
@@ -43,11 +44,19 @@ public:
         Optional<Vector<UnicodeRange>> unicode_ranges;
     };
 
-    void set_last_resort_font(NonnullRefPtr<Font> font) { m_last_resort_font = move(font); }
+    void set_last_resort_font(NonnullRefPtr<Font> font)
+    {
+        m_last_resort_font = move(font);
+        m_font_for_code_point_cache.clear();
+    }
 
 private:
     RefPtr<Font const> m_last_resort_font;
     Vector<Entry> m_fonts;
+
+    // OPTIMIZATION: Text in scripts the first fonts don't cover (like CJK or emoji) would otherwise have every one of
+    //               its code points checked against every font in the list, each time it is shaped.
+    mutable HashMap<u32, Font const*> m_font_for_code_point_cache;
 };
 
 }
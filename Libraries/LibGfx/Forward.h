@@ -34,6 +34,8 @@ struct SystemTheme;
 template<typename T>
 class Triangle;
 
+class YUVData;
+
 template<typename T>
 class Point;
 
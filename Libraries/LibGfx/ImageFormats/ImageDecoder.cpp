@@ -47,6 +47,26 @@ static ErrorOr<OwnPtr<ImageDecoderPlugin>> probe_and_sniff_for_appropriate_plugi
     return OwnPtr<ImageDecoderPlugin> {};
 }
 
+static ErrorOr<OwnPtr<ImageDecoderPlugin>> probe_and_sniff_for_partial_decoding_plugin(ReadonlyBytes bytes)
+{
+    struct PartialImagePluginInitializer {
+        bool (*sniff)(ReadonlyBytes) = nullptr;
+        ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> (*create_for_partial_data)(ReadonlyBytes) = nullptr;
+    };
+
+    static constexpr PartialImagePluginInitializer s_initializers[] = {
+        { JPEGImageDecoderPlugin::sniff, JPEGImageDecoderPlugin::create_for_partial_data },
+        { PNGImageDecoderPlugin::sniff, PNGImageDecoderPlugin::create_for_partial_data },
+    };
+
+    for (auto& plugin : s_initializers) {
+        if (!plugin.sniff(bytes))
+            continue;
+        return TRY(plugin.create_for_partial_data(bytes));
+    }
+    return OwnPtr<ImageDecoderPlugin> {};
+}
+
 ErrorOr<ColorSpace> ImageDecoder::color_space()
 {
     auto maybe_cicp = TRY(m_plugin->cicp());
@@ -67,6 +87,14 @@ ErrorOr<RefPtr<ImageDecoder>> ImageDecoder::try_create_for_raw_bytes(ReadonlyByt
     return RefPtr<ImageDecoder> {};
 }
 
+ErrorOr<RefPtr<ImageDecoder>> ImageDecoder::try_create_for_partial_raw_bytes(ReadonlyBytes bytes)
+{
+    if (auto plugin = TRY(probe_and_sniff_for_partial_decoding_plugin(bytes)); plugin)
+        return adopt_ref_if_nonnull(new (nothrow) ImageDecoder(plugin.release_nonnull()));
+
+    return RefPtr<ImageDecoder> {};
+}
+
 ImageDecoder::ImageDecoder(NonnullOwnPtr<ImageDecoderPlugin> plugin)
     : m_plugin(move(plugin))
 {
@@ -101,6 +101,11 @@ protected:
 class ImageDecoder : public RefCounted<ImageDecoder> {
 public:
     static ErrorOr<RefPtr<ImageDecoder>> try_create_for_raw_bytes(ReadonlyBytes, Optional<ByteString> mime_type = {});
+
+    // Creates a decoder for the beginning of a still image whose remaining data hasn't arrived yet. Its only frame
+    // holds whatever the data so far decodes to, with the rest left transparent. Returns null for formats that can't
+    // be decoded partially.
+    static ErrorOr<RefPtr<ImageDecoder>> try_create_for_partial_raw_bytes(ReadonlyBytes);
     ~ImageDecoder() = default;
 
     IntSize size() const { return m_plugin->size(); }
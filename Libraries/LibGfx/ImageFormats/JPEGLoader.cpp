@@ -26,8 +26,12 @@ struct JPEGLoadingContext {
     ReadonlyBytes data;
     Vector<u8> icc_data;
 
-    JPEGLoadingContext(ReadonlyBytes data)
+    // Set if `data` is only the beginning of an image that is still being downloaded.
+    bool is_partial_data { false };
+
+    JPEGLoadingContext(ReadonlyBytes data, bool is_partial_data = false)
         : data(data)
+        , is_partial_data(is_partial_data)
     {
     }
 
@@ -85,14 +89,47 @@ ErrorOr<void> JPEGLoadingContext::decode()
         cinfo.out_color_space = JCS_CMYK;
     } else if (cinfo.jpeg_color_space == JCS_YCCK) {
         cinfo.out_color_space = JCS_YCCK;
+    } else if (is_partial_data) {
+        // NOTE: Scanlines that haven't arrived yet are left transparent, so that the image can be painted as it loads.
+        cinfo.out_color_space = JCS_EXT_BGRA;
     } else {
         cinfo.out_color_space = JCS_EXT_BGRX;
     }
 
-    jpeg_start_decompress(&cinfo);
     bool could_read_all_scanlines = true;
 
-    if (cinfo.out_color_space == JCS_EXT_BGRX) {
+    if (is_partial_data && jpeg_has_multiple_scans(&cinfo)) {
+        // Progressive JPEGs are output from the coefficients of all scans received so far. The scan that is still
+        // arriving can only be output down to where its data ends, but every scan before it covers the whole image and
+        // already includes whatever has been received of the later ones.
+        cinfo.buffered_image = TRUE;
+        if (!jpeg_start_decompress(&cinfo))
+            return Error::from_string_literal("Not enough JPEG data to start decoding");
+
+        int status = 0;
+        do {
+            status = jpeg_consume_input(&cinfo);
+        } while (status != JPEG_SUSPENDED && status != JPEG_REACHED_EOI);
+
+        auto scan_number = cinfo.input_scan_number;
+        if (status == JPEG_SUSPENDED && scan_number > 1)
+            --scan_number;
+        if (!jpeg_start_output(&cinfo, scan_number))
+            return Error::from_string_literal("Not enough JPEG data to output a scan");
+    } else {
+        jpeg_start_decompress(&cinfo);
+    }
+
+    if (cinfo.out_color_space == JCS_EXT_BGRA) {
+        rgb_bitmap = TRY(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, { static_cast<int>(cinfo.output_width), static_cast<int>(cinfo.output_height) }));
+        while (cinfo.output_scanline < cinfo.output_height) {
+            auto* row_ptr = (u8*)rgb_bitmap->scanline(cinfo.output_scanline);
+            if (jpeg_read_scanlines(&cinfo, &row_ptr, 1) == 0) {
+                could_read_all_scanlines = false;
+                break;
+            }
+        }
+    } else if (cinfo.out_color_space == JCS_EXT_BGRX) {
         rgb_bitmap = TRY(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, { static_cast<int>(cinfo.output_width), static_cast<int>(cinfo.output_height) }));
         while (cinfo.output_scanline < cinfo.output_height) {
             auto* row_ptr = (u8*)rgb_bitmap->scanline(cinfo.output_scanline);
@@ -155,7 +192,8 @@ ErrorOr<void> JPEGLoadingContext::decode()
         free(icc_data_ptr);
     }
 
-    if (could_read_all_scanlines)
+    // NOTE: Partial data never has an end to finish decoding at.
+    if (could_read_all_scanlines && !is_partial_data)
         jpeg_finish_decompress(&cinfo);
     else
         jpeg_abort_decompress(&cinfo);
@@ -200,6 +238,11 @@ ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> JPEGImageDecoderPlugin::create(Readon
     return adopt_own(*new JPEGImageDecoderPlugin(make<JPEGLoadingContext>(data)));
 }
 
+ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> JPEGImageDecoderPlugin::create_for_partial_data(ReadonlyBytes data)
+{
+    return adopt_own(*new JPEGImageDecoderPlugin(make<JPEGLoadingContext>(data, true)));
+}
+
 ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
 {
     if (index > 0)
@@ -16,6 +16,7 @@ class JPEGImageDecoderPlugin : public ImageDecoderPlugin {
 public:
     static bool sniff(ReadonlyBytes);
     static ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> create(ReadonlyBytes);
+    static ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> create_for_partial_data(ReadonlyBytes);
 
     virtual ~JPEGImageDecoderPlugin() override;
     virtual IntSize size() override;
@@ -35,6 +35,7 @@ struct PNGLoadingContext {
     OwnPtr<ExifMetadata> exif_metadata;
 
     ErrorOr<size_t> read_frames(png_structp, png_infop);
+    ErrorOr<void> read_partial_frame();
     ErrorOr<void> apply_exif_orientation();
 
     ErrorOr<void> read_all_frames()
@@ -73,6 +74,14 @@ ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> PNGImageDecoderPlugin::create(Readonl
     return decoder;
 }
 
+ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> PNGImageDecoderPlugin::create_for_partial_data(ReadonlyBytes bytes)
+{
+    auto decoder = adopt_own(*new PNGImageDecoderPlugin(bytes));
+    TRY(decoder->initialize());
+    TRY(decoder->m_context->read_partial_frame());
+    return decoder;
+}
+
 PNGImageDecoderPlugin::PNGImageDecoderPlugin(ReadonlyBytes data)
     : m_context(adopt_own(*new PNGLoadingContext))
 {
@@ -360,6 +369,41 @@ ErrorOr<size_t> PNGLoadingContext::read_frames(png_structp png_ptr, png_infop in
     return frame_count;
 }
 
+ErrorOr<void> PNGLoadingContext::read_partial_frame()
+{
+    // NOTE: Animations are only shown once they have been decoded in full, and EXIF orientation is only applied to
+    //       complete images.
+    u32 animation_frame_count = 0;
+    u32 animation_loop_count = 0;
+    if (png_get_acTL(png_ptr, info_ptr, &animation_frame_count, &animation_loop_count) || exif_metadata)
+        return Error::from_string_literal("Partial decoding is not supported for this PNG");
+
+    // NOTE: Rows that haven't arrived yet are left transparent.
+    auto bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Unpremultiplied, size));
+    Vector<u8*> row_pointers;
+    TRY(row_pointers.try_resize(size.height()));
+    for (auto i = 0; i < size.height(); ++i)
+        row_pointers[i] = bitmap->scanline_u8(i);
+
+    frame_count = 1;
+    frame_descriptors.append({ bitmap, 0 });
+
+    // NOTE: libpng reports running out of data by longjmp()ing here. Everything decoded up to that point is already in
+    //       the bitmap, which is exactly what we want to show.
+    if (setjmp(png_jmpbuf(png_ptr)))
+        return {};
+
+    png_read_update_info(png_ptr, info_ptr);
+
+    // Interlaced images are read as "display" rows, which fills in the whole rectangle covered by each pixel of an
+    // early pass. This gives a blocky preview of the entire image that sharpens with every pass.
+    auto pass_count = png_get_interlace_type(png_ptr, info_ptr) == PNG_INTERLACE_NONE ? 1 : 7;
+    for (auto pass = 0; pass < pass_count; ++pass)
+        png_read_rows(png_ptr, nullptr, row_pointers.data(), size.height());
+
+    return {};
+}
+
 PNGImageDecoderPlugin::~PNGImageDecoderPlugin() = default;
 
 bool PNGImageDecoderPlugin::sniff(ReadonlyBytes data)
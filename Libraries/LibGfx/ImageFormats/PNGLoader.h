@@ -16,6 +16,7 @@ class PNGImageDecoderPlugin final : public ImageDecoderPlugin {
 public:
     static bool sniff(ReadonlyBytes);
     static ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> create(ReadonlyBytes);
+    static ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> create_for_partial_data(ReadonlyBytes);
 
     virtual ~PNGImageDecoderPlugin() override;
 
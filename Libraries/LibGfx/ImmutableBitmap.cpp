@@ -54,7 +54,14 @@ SkImage const* ImmutableBitmap::sk_image() const
 RefPtr<Gfx::Bitmap const> ImmutableBitmap::bitmap() const
 {
     // FIXME: Implement for PaintingSurface
-    return m_impl->source.get<NonnullRefPtr<Gfx::Bitmap>>();
+    if (auto const* bitmap = m_impl->source.get_pointer<NonnullRefPtr<Gfx::Bitmap>>())
+        return *bitmap;
+    return nullptr;
+}
+
+ColorSpace const& ImmutableBitmap::color_space() const
+{
+    return m_impl->color_space;
 }
 
 Color ImmutableBitmap::get_pixel(int x, int y) const
@@ -41,6 +41,8 @@ public:
 
     RefPtr<Bitmap const> bitmap() const;
 
+    ColorSpace const& color_space() const;
+
 private:
     NonnullOwnPtr<ImmutableBitmapImpl> m_impl;
 
@@ -99,22 +99,22 @@ PaintingSurface::~PaintingSurface()
     unlock_context();
 }
 
-void PaintingSurface::read_into_bitmap(Bitmap& bitmap)
+void PaintingSurface::read_into_bitmap(Bitmap& bitmap, IntPoint source_position)
 {
     auto color_type = to_skia_color_type(bitmap.format());
     auto alpha_type = to_skia_alpha_type(bitmap.format(), bitmap.alpha_type());
     auto image_info = SkImageInfo::Make(bitmap.width(), bitmap.height(), color_type, alpha_type, SkColorSpace::MakeSRGB());
     SkPixmap const pixmap(image_info, bitmap.begin(), bitmap.pitch());
-    m_impl->surface->readPixels(pixmap, 0, 0);
+    m_impl->surface->readPixels(pixmap, source_position.x(), source_position.y());
 }
 
-void PaintingSurface::write_from_bitmap(Bitmap const& bitmap)
+void PaintingSurface::write_from_bitmap(Bitmap const& bitmap, IntPoint destination_position)
 {
     auto color_type = to_skia_color_type(bitmap.format());
     auto alpha_type = to_skia_alpha_type(bitmap.format(), bitmap.alpha_type());
     auto image_info = SkImageInfo::Make(bitmap.width(), bitmap.height(), color_type, alpha_type, SkColorSpace::MakeSRGB());
     SkPixmap const pixmap(image_info, bitmap.begin(), bitmap.pitch());
-    m_impl->surface->writePixels(pixmap, 0, 0);
+    m_impl->surface->writePixels(pixmap, destination_position.x(), destination_position.y());
 }
 
 IntSize PaintingSurface::size() const
@@ -127,6 +127,11 @@ IntRect PaintingSurface::rect() const
     return { {}, m_impl->size };
 }
 
+RefPtr<Bitmap> PaintingSurface::bitmap() const
+{
+    return m_impl->bitmap;
+}
+
 SkCanvas& PaintingSurface::canvas() const
 {
     return *m_impl->surface->getCanvas();
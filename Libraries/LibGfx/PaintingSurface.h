@@ -11,6 +11,7 @@
 #include <AK/NonnullOwnPtr.h>
 #include <AK/RefPtr.h>
 #include <LibGfx/Color.h>
+#include <LibGfx/Point.h>
 #include <LibGfx/Size.h>
 #include <LibGfx/SkiaBackendContext.h>
 
@@ -39,14 +40,19 @@ public:
     static NonnullRefPtr<PaintingSurface> create_from_iosurface(Core::IOSurfaceHandle&&, NonnullRefPtr<SkiaBackendContext>, Origin = Origin::TopLeft);
 #endif
 
-    void read_into_bitmap(Bitmap&);
-    void write_from_bitmap(Bitmap const&);
+    // These convert between the pixel formats of the bitmap and the surface as needed. Only the part of the bitmap
+    // that overlaps the surface when placed at the given position is read or written.
+    void read_into_bitmap(Bitmap&, IntPoint source_position = {});
+    void write_from_bitmap(Bitmap const&, IntPoint destination_position = {});
 
     void notify_content_will_change();
 
     IntSize size() const;
     IntRect rect() const;
 
+    // Returns the bitmap this surface paints into, if it is CPU-backed.
+    RefPtr<Bitmap> bitmap() const;
+
     SkCanvas& canvas() const;
     SkSurface& sk_surface() const;
 
@@ -14,6 +14,7 @@
 #include <LibGfx/Point.h>
 #include <LibGfx/Rect.h>
 #include <LibGfx/WindingRule.h>
+#include <LibIPC/Forward.h>
 
 namespace Gfx {
 
@@ -124,3 +125,13 @@ private:
 };
 
 }
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder&, Gfx::Path const&);
+
+template<>
+ErrorOr<Gfx::Path> decode(Decoder&);
+
+}
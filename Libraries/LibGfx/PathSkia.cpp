@@ -12,6 +12,9 @@
 #include <LibGfx/Rect.h>
 #include <LibGfx/SkiaUtils.h>
 #include <LibGfx/TextLayout.h>
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
+#include <core/SkData.h>
 #include <core/SkFont.h>
 #include <core/SkPath.h>
 #include <core/SkPathMeasure.h>
@@ -251,3 +254,30 @@ NonnullOwnPtr<PathImpl> PathImplSkia::copy_transformed(Gfx::AffineTransform cons
 }
 
 }
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder& encoder, Gfx::Path const& path)
+{
+    auto serialized = static_cast<Gfx::PathImplSkia const&>(path.impl()).sk_path().serialize();
+    TRY(encoder.encode<u64>(serialized->size()));
+    TRY(encoder.append(serialized->bytes(), serialized->size()));
+    return {};
+}
+
+template<>
+ErrorOr<Gfx::Path> decode(Decoder& decoder)
+{
+    auto size = TRY(decoder.decode<u64>());
+    auto buffer = TRY(ByteBuffer::create_uninitialized(size));
+    TRY(decoder.decode_into(buffer.bytes()));
+
+    Gfx::Path path;
+    auto& sk_path = static_cast<Gfx::PathImplSkia&>(path.impl()).sk_path();
+    if (sk_path.readFromMemory(buffer.data(), buffer.size()) != buffer.size())
+        return Error::from_string_literal("IPC: Invalid Gfx::Path data");
+    return path;
+}
+
+}
@@ -8,8 +8,11 @@
 #include <LibGfx/Filter.h>
 #include <LibGfx/FilterImpl.h>
 #include <LibGfx/SkiaUtils.h>
+#include <LibGfx/YUVData.h>
 #include <core/SkBlender.h>
+#include <core/SkImage.h>
 #include <core/SkImageFilter.h>
+#include <core/SkM44.h>
 #include <core/SkString.h>
 #include <effects/SkRuntimeEffect.h>
 
@@ -106,4 +109,82 @@ sk_sp<SkBlender> to_skia_blender(Gfx::CompositingAndBlendingOperator compositing
     }
 }
 
+sk_sp<SkShader> to_skia_shader(YUVData const& yuv_data, SkSamplingOptions const& luma_sampling, SkMatrix const& local_matrix)
+{
+    static auto const effect = [] {
+        auto [effect, error] = SkRuntimeEffect::MakeForShader(SkString(R"(
+            uniform shader y_plane;
+            uniform shader u_plane;
+            uniform shader v_plane;
+            uniform float3 sample_scale;
+            uniform float3 sample_offset;
+            uniform float4 coefficients;
+
+            half4 main(float2 coord) {
+                float3 yuv = float3(y_plane.eval(coord).a, u_plane.eval(coord).a, v_plane.eval(coord).a) * sample_scale - sample_offset;
+                float r = yuv.x + coefficients.x * yuv.z;
+                float g = yuv.x - coefficients.y * yuv.y - coefficients.z * yuv.z;
+                float b = yuv.x + coefficients.w * yuv.y;
+                return half4(half3(saturate(float3(r, g, b))), 1.0);
+            }
+        )"));
+        if (!effect) {
+            dbgln("SkSL error: {}", error.c_str());
+            VERIFY_NOT_REACHED();
+        }
+        return effect;
+    }();
+
+    // The planes are sampled as normalized values of their storage type, so first scale them back up to code values
+    // and then map those to [0, 1] for luma and [-0.5, 0.5] for chroma, according to the range.
+    float const storage_maximum = yuv_data.bit_depth() > 8 ? 65535.0f : 255.0f;
+    float const depth_scale = static_cast<float>(1u << (yuv_data.bit_depth() - 8));
+    float const code_value_maximum = static_cast<float>((1u << yuv_data.bit_depth()) - 1);
+
+    float luma_scale, luma_offset, chroma_scale, chroma_offset;
+    if (yuv_data.range() == YUVRange::Limited) {
+        luma_scale = storage_maximum / (219.0f * depth_scale);
+        luma_offset = 16.0f / 219.0f;
+        chroma_scale = storage_maximum / (224.0f * depth_scale);
+        chroma_offset = 128.0f / 224.0f;
+    } else {
+        luma_scale = storage_maximum / code_value_maximum;
+        luma_offset = 0.0f;
+        chroma_scale = storage_maximum / code_value_maximum;
+        chroma_offset = (code_value_maximum + 1.0f) / 2.0f / code_value_maximum;
+    }
+
+    float kr, kb;
+    switch (yuv_data.matrix_coefficients()) {
+    case YUVMatrixCoefficients::BT601:
+        kr = 0.299f;
+        kb = 0.114f;
+        break;
+    case YUVMatrixCoefficients::BT709:
+        kr = 0.2126f;
+        kb = 0.0722f;
+        break;
+    case YUVMatrixCoefficients::BT2020:
+        kr = 0.2627f;
+        kb = 0.0593f;
+        break;
+    default:
+        VERIFY_NOT_REACHED();
+    }
+    float const kg = 1.0f - kr - kb;
+
+    SkRuntimeShaderBuilder builder(effect);
+    builder.uniform("sample_scale") = SkV3 { luma_scale, chroma_scale, chroma_scale };
+    builder.uniform("sample_offset") = SkV3 { luma_offset, chroma_offset, chroma_offset };
+    builder.uniform("coefficients") = SkV4 { 2.0f * (1.0f - kr), 2.0f * kb * (1.0f - kb) / kg, 2.0f * kr * (1.0f - kr) / kg, 2.0f * (1.0f - kb) };
+
+    // Chroma is always interpolated, since it is upsampled whenever it was subsampled.
+    auto chroma_matrix = SkMatrix::Scale(static_cast<float>(yuv_data.width()) / static_cast<float>(yuv_data.chroma_size().width()), static_cast<float>(yuv_data.height()) / static_cast<float>(yuv_data.chroma_size().height()));
+    SkSamplingOptions const chroma_sampling(SkFilterMode::kLinear);
+    builder.child("y_plane") = yuv_data.plane_sk_image(0)->makeShader(SkTileMode::kClamp, SkTileMode::kClamp, luma_sampling);
+    builder.child("u_plane") = yuv_data.plane_sk_image(1)->makeShader(SkTileMode::kClamp, SkTileMode::kClamp, chroma_sampling, chroma_matrix);
+    builder.child("v_plane") = yuv_data.plane_sk_image(2)->makeShader(SkTileMode::kClamp, SkTileMode::kClamp, chroma_sampling, chroma_matrix);
+    return builder.makeShader(&local_matrix);
+}
+
 }
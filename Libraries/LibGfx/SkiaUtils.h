@@ -18,10 +18,12 @@
 #include <core/SkColor.h>
 #include <core/SkColorType.h>
 #include <core/SkImageFilter.h>
+#include <core/SkMatrix.h>
 #include <core/SkPaint.h>
 #include <core/SkPath.h>
 #include <core/SkPathEffect.h>
 #include <core/SkSamplingOptions.h>
+#include <core/SkShader.h>
 
 namespace Gfx {
 
@@ -136,4 +138,7 @@ SkPath to_skia_path(Path const& path);
 sk_sp<SkImageFilter> to_skia_image_filter(Gfx::Filter const& filter);
 sk_sp<SkBlender> to_skia_blender(Gfx::CompositingAndBlendingOperator compositing_and_blending_operator);
 
+// Returns a shader that draws the YUV data as RGB, with the luma plane's pixels mapped through local_matrix.
+sk_sp<SkShader> to_skia_shader(YUVData const&, SkSamplingOptions const& luma_sampling, SkMatrix const& local_matrix);
+
 }
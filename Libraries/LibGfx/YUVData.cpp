@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/FixedArray.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/SkiaUtils.h>
+#include <LibGfx/YUVData.h>
+
+#include <core/SkCanvas.h>
+#include <core/SkImage.h>
+#include <core/SkPixmap.h>
+#include <core/SkSurface.h>
+
+namespace Gfx {
+
+struct YUVDataImpl {
+    IntSize size;
+    IntSize chroma_size;
+    u8 bit_depth { 8 };
+    YUVMatrixCoefficients matrix_coefficients { YUVMatrixCoefficients::BT709 };
+    YUVRange range { YUVRange::Limited };
+    Array<FixedArray<u8>, YUVData::plane_count> planes;
+    Array<sk_sp<SkImage>, YUVData::plane_count> plane_images;
+};
+
+ErrorOr<NonnullRefPtr<YUVData>> YUVData::create(IntSize size, u8 bit_depth, bool chroma_subsampled_horizontally, bool chroma_subsampled_vertically)
+{
+    VERIFY(!size.is_empty());
+    VERIFY(bit_depth >= 8 && bit_depth <= 16);
+
+    auto impl = TRY(try_make<YUVDataImpl>());
+    impl->size = size;
+    impl->chroma_size = {
+        chroma_subsampled_horizontally ? (size.width() + 1) / 2 : size.width(),
+        chroma_subsampled_vertically ? (size.height() + 1) / 2 : size.height(),
+    };
+    impl->bit_depth = bit_depth;
+
+    size_t bytes_per_sample = bit_depth > 8 ? sizeof(u16) : sizeof(u8);
+    auto color_type = bit_depth > 8 ? kA16_unorm_SkColorType : kAlpha_8_SkColorType;
+
+    for (size_t plane = 0; plane < plane_count; ++plane) {
+        auto plane_size = plane == 0 ? impl->size : impl->chroma_size;
+        auto pitch = static_cast<size_t>(plane_size.width()) * bytes_per_sample;
+        impl->planes[plane] = TRY(FixedArray<u8>::create(pitch * plane_size.height()));
+
+        // NOTE: The images wrap the plane data without copying it, which is why the planes must not be written to
+        //       after the YUVData has been handed to anything that might draw it.
+        auto image_info = SkImageInfo::Make(plane_size.width(), plane_size.height(), color_type, kPremul_SkAlphaType);
+        SkPixmap const pixmap(image_info, impl->planes[plane].data(), pitch);
+        impl->plane_images[plane] = SkImages::RasterFromPixmap(pixmap, nullptr, nullptr);
+        if (!impl->plane_images[plane])
+            return Error::from_string_literal("Failed to create an image for a YUV plane");
+    }
+
+    return adopt_nonnull_ref_or_enomem(new (nothrow) YUVData(move(impl)));
+}
+
+YUVData::YUVData(NonnullOwnPtr<YUVDataImpl> impl)
+    : m_impl(move(impl))
+{
+}
+
+YUVData::~YUVData() = default;
+
+IntSize YUVData::size() const
+{
+    return m_impl->size;
+}
+
+IntSize YUVData::chroma_size() const
+{
+    return m_impl->chroma_size;
+}
+
+u8 YUVData::bit_depth() const
+{
+    return m_impl->bit_depth;
+}
+
+YUVMatrixCoefficients YUVData::matrix_coefficients() const
+{
+    return m_impl->matrix_coefficients;
+}
+
+void YUVData::set_matrix_coefficients(YUVMatrixCoefficients matrix_coefficients)
+{
+    m_impl->matrix_coefficients = matrix_coefficients;
+}
+
+YUVRange YUVData::range() const
+{
+    return m_impl->range;
+}
+
+void YUVData::set_range(YUVRange range)
+{
+    m_impl->range = range;
+}
+
+Bytes YUVData::plane_data(size_t plane)
+{
+    return m_impl->planes[plane].span();
+}
+
+ReadonlyBytes YUVData::plane_data(size_t plane) const
+{
+    return m_impl->planes[plane].span();
+}
+
+size_t YUVData::plane_pitch(size_t plane) const
+{
+    auto width = plane == 0 ? m_impl->size.width() : m_impl->chroma_size.width();
+    return static_cast<size_t>(width) * (m_impl->bit_depth > 8 ? sizeof(u16) : sizeof(u8));
+}
+
+SkImage const* YUVData::plane_sk_image(size_t plane) const
+{
+    return m_impl->plane_images[plane].get();
+}
+
+ErrorOr<NonnullRefPtr<Bitmap>> YUVData::to_bitmap() const
+{
+    auto bitmap = TRY(Bitmap::create(BitmapFormat::BGRx8888, size()));
+    auto image_info = SkImageInfo::Make(width(), height(), kBGRA_8888_SkColorType, kOpaque_SkAlphaType);
+    auto surface = SkSurfaces::WrapPixels(image_info, bitmap->begin(), bitmap->pitch());
+    if (!surface)
+        return Error::from_string_literal("Failed to create a surface to convert YUV data into");
+
+    SkPaint paint;
+    paint.setShader(to_skia_shader(*this, SkSamplingOptions(SkFilterMode::kNearest), SkMatrix::I()));
+    paint.setBlendMode(SkBlendMode::kSrc);
+    surface->getCanvas()->drawRect(SkRect::MakeIWH(width(), height()), paint);
+    return bitmap;
+}
+
+}
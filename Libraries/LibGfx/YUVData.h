@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/Error.h>
+#include <AK/NonnullOwnPtr.h>
+#include <LibGfx/Forward.h>
+#include <LibGfx/Rect.h>
+#include <LibGfx/Size.h>
+
+class SkImage;
+
+namespace Gfx {
+
+// The coefficients used to turn a YUV triple into RGB.
+enum class YUVMatrixCoefficients : u8 {
+    BT601,
+    BT709,
+    BT2020,
+};
+
+enum class YUVRange : u8 {
+    Limited,
+    Full,
+};
+
+struct YUVDataImpl;
+
+// Three planes of luma and (possibly subsampled) chroma samples, as produced by a video decoder. Samples wider than 8
+// bits are stored as one u16 per sample, using the low bit_depth bits. The planes are meant to be drawn through a
+// shader that converts them to RGB, so that they never have to be converted up front.
+//
+// The plane data may only be written before the YUVData is shared with anything else.
+class YUVData final : public AtomicRefCounted<YUVData> {
+public:
+    static ErrorOr<NonnullRefPtr<YUVData>> create(IntSize size, u8 bit_depth, bool chroma_subsampled_horizontally, bool chroma_subsampled_vertically);
+
+    ~YUVData();
+
+    IntSize size() const;
+    IntRect rect() const { return { {}, size() }; }
+    int width() const { return size().width(); }
+    int height() const { return size().height(); }
+    IntSize chroma_size() const;
+    u8 bit_depth() const;
+
+    YUVMatrixCoefficients matrix_coefficients() const;
+    void set_matrix_coefficients(YUVMatrixCoefficients);
+    YUVRange range() const;
+    void set_range(YUVRange);
+
+    // Plane 0 is luma (Y), planes 1 and 2 are the blue and red chroma differences (U and V).
+    static constexpr size_t plane_count = 3;
+    Bytes plane_data(size_t plane);
+    ReadonlyBytes plane_data(size_t plane) const;
+    size_t plane_pitch(size_t plane) const;
+    SkImage const* plane_sk_image(size_t plane) const;
+
+    ErrorOr<NonnullRefPtr<Bitmap>> to_bitmap() const;
+
+private:
+    explicit YUVData(NonnullOwnPtr<YUVDataImpl>);
+
+    NonnullOwnPtr<YUVDataImpl> m_impl;
+};
+
+}
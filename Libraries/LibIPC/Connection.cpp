@@ -11,6 +11,7 @@
 #include <LibCore/Timer.h>
 #include <LibIPC/Connection.h>
 #include <LibIPC/Message.h>
+#include <LibIPC/MessageStatistics.h>
 #include <LibIPC/Stub.h>
 
 namespace IPC {
@@ -39,7 +40,13 @@ bool ConnectionBase::is_open() const
 
 ErrorOr<void> ConnectionBase::post_message(Message const& message)
 {
-    return post_message(TRY(message.encode()));
+    if (!MessageStatistics::is_enabled())
+        return post_message(TRY(message.encode()));
+
+    auto start_time = MonotonicTime::now();
+    auto buffer = TRY(message.encode());
+    MessageStatistics::record_sent_message(message, buffer.data().size(), MonotonicTime::now() - start_time);
+    return post_message(move(buffer));
 }
 
 ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
@@ -67,12 +74,28 @@ void ConnectionBase::shutdown_with_error(Error const& error)
     shutdown();
 }
 
+ErrorOr<OwnPtr<MessageBuffer>> ConnectionBase::handle_message(NonnullOwnPtr<Message> message)
+{
+    if (!MessageStatistics::is_enabled())
+        return m_local_stub.handle(move(message));
+
+    auto endpoint_magic = message->endpoint_magic();
+    auto message_id = message->message_id();
+    auto const* message_name = message->message_name();
+    auto start_time = MonotonicTime::now();
+    auto queueing_latency = start_time - message->received_time().value_or(start_time);
+
+    auto handler_result = m_local_stub.handle(move(message));
+    MessageStatistics::record_handled_message(endpoint_magic, message_id, message_name, queueing_latency, MonotonicTime::now() - start_time);
+    return handler_result;
+}
+
 void ConnectionBase::handle_messages()
 {
     auto messages = move(m_unprocessed_messages);
     for (auto& message : messages) {
         if (message->endpoint_magic() == m_local_endpoint_magic) {
-            auto handler_result = m_local_stub.handle(move(message));
+            auto handler_result = handle_message(move(message));
             if (handler_result.is_error()) {
                 dbgln("IPC::ConnectionBase::handle_messages: {}", handler_result.error());
                 continue;
@@ -95,7 +118,20 @@ void ConnectionBase::wait_for_transport_to_become_readable()
 ErrorOr<void> ConnectionBase::drain_messages_from_peer()
 {
     auto schedule_shutdown = m_transport->read_as_many_messages_as_possible_without_blocking([&](auto&& raw_message) {
-        if (auto message = try_parse_message(raw_message.bytes, raw_message.fds)) {
+        OwnPtr<Message> message;
+        if (MessageStatistics::is_enabled()) {
+            auto start_time = MonotonicTime::now();
+            message = try_parse_message(raw_message.bytes, raw_message.fds);
+            if (message) {
+                auto received_time = MonotonicTime::now();
+                MessageStatistics::record_received_message(*message, raw_message.bytes.size(), received_time - start_time);
+                message->set_received_time(received_time);
+            }
+        } else {
+            message = try_parse_message(raw_message.bytes, raw_message.fds);
+        }
+
+        if (message) {
             m_unprocessed_messages.append(message.release_nonnull());
         } else {
             dbgln("Failed to parse IPC message {:hex-dump}", raw_message.bytes);
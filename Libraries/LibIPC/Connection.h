@@ -46,6 +46,7 @@ protected:
     ErrorOr<void> drain_messages_from_peer();
 
     void handle_messages();
+    ErrorOr<OwnPtr<MessageBuffer>> handle_message(NonnullOwnPtr<Message>);
 
     IPC::Stub& m_local_stub;
 
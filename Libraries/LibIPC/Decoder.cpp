@@ -9,6 +9,7 @@
 #include <AK/NumericLimits.h>
 #include <LibCore/AnonymousBuffer.h>
 #include <LibCore/DateTime.h>
+#include <LibCore/MemoryReporting.h>
 #include <LibCore/Proxy.h>
 #include <LibCore/Socket.h>
 #include <LibIPC/Decoder.h>
@@ -50,6 +51,12 @@ ErrorOr<ByteBuffer> decode(Decoder& decoder)
     if (length == 0)
         return ByteBuffer {};
 
+    if (length >= SHARED_MEMORY_PAYLOAD_THRESHOLD) {
+        auto anon_file = TRY(decoder.decode<IPC::File>());
+        auto shared_buffer = TRY(Core::AnonymousBuffer::create_from_anon_fd(anon_file.take_fd(), length));
+        return ByteBuffer::copy(shared_buffer.data<u8>(), length);
+    }
+
     auto buffer = TRY(ByteBuffer::create_uninitialized(length));
     auto bytes = buffer.bytes();
 
@@ -149,6 +156,16 @@ ErrorOr<Core::DateTime> decode(Decoder& decoder)
     return Core::DateTime::from_timestamp(static_cast<time_t>(timestamp));
 }
 
+template<>
+ErrorOr<Core::MemoryReport> decode(Decoder& decoder)
+{
+    auto path = TRY(decoder.decode<String>());
+    auto bytes = TRY(decoder.decode<u64>());
+    auto count = TRY(decoder.decode<u64>());
+
+    return Core::MemoryReport { move(path), bytes, count };
+}
+
 template<>
 ErrorOr<Core::ProxyData> decode(Decoder& decoder)
 {
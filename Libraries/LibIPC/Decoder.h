@@ -124,6 +124,9 @@ ErrorOr<Core::AnonymousBuffer> decode(Decoder&);
 template<>
 ErrorOr<Core::DateTime> decode(Decoder&);
 
+template<>
+ErrorOr<Core::MemoryReport> decode(Decoder&);
+
 template<>
 ErrorOr<Core::ProxyData> decode(Decoder&);
 
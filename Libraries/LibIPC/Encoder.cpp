@@ -16,6 +16,7 @@
 #include <AK/Time.h>
 #include <LibCore/AnonymousBuffer.h>
 #include <LibCore/DateTime.h>
+#include <LibCore/MemoryReporting.h>
 #include <LibCore/Proxy.h>
 #include <LibCore/System.h>
 #include <LibIPC/Encoder.h>
@@ -68,6 +69,15 @@ template<>
 ErrorOr<void> encode(Encoder& encoder, ByteBuffer const& value)
 {
     TRY(encoder.encode_size(value.size()));
+
+    // NOTE: The decoder knows from the size alone whether the bytes follow inline or in shared memory.
+    if (value.size() >= SHARED_MEMORY_PAYLOAD_THRESHOLD) {
+        auto buffer = TRY(Core::AnonymousBuffer::create_with_size(value.size()));
+        memcpy(buffer.data<u8>(), value.data(), value.size());
+        TRY(encoder.encode(TRY(IPC::File::clone_fd(buffer.fd()))));
+        return {};
+    }
+
     TRY(encoder.append(value.data(), value.size()));
     return {};
 }
@@ -166,6 +176,15 @@ ErrorOr<void> encode(Encoder& encoder, Core::DateTime const& datetime)
     return encoder.encode(static_cast<i64>(datetime.timestamp()));
 }
 
+template<>
+ErrorOr<void> encode(Encoder& encoder, Core::MemoryReport const& report)
+{
+    TRY(encoder.encode(report.path));
+    TRY(encoder.encode(report.bytes));
+    TRY(encoder.encode(report.count));
+    return {};
+}
+
 template<>
 ErrorOr<void> encode(Encoder& encoder, Core::ProxyData const& proxy)
 {
@@ -123,6 +123,9 @@ ErrorOr<void> encode(Encoder&, Core::AnonymousBuffer const&);
 template<>
 ErrorOr<void> encode(Encoder&, Core::DateTime const&);
 
+template<>
+ErrorOr<void> encode(Encoder&, Core::MemoryReport const&);
+
 template<>
 ErrorOr<void> encode(Encoder&, Core::ProxyData const&);
 
@@ -8,12 +8,17 @@
 #pragma once
 
 #include <AK/Error.h>
+#include <AK/Optional.h>
+#include <AK/Time.h>
 #include <AK/Vector.h>
 #include <LibIPC/AutoCloseFileDescriptor.h>
 #include <LibIPC/Transport.h>
 
 namespace IPC {
 
+// Byte buffers at least this large are handed over in shared memory rather than being copied through the socket.
+constexpr inline size_t SHARED_MEMORY_PAYLOAD_THRESHOLD = 64 * KiB;
+
 class MessageBuffer {
 public:
     MessageBuffer();
@@ -58,8 +63,15 @@ public:
     virtual char const* message_name() const = 0;
     virtual ErrorOr<MessageBuffer> encode() const = 0;
 
+    // Only set while IPC message statistics are being collected.
+    Optional<MonotonicTime> received_time() const { return m_received_time; }
+    void set_received_time(MonotonicTime time) { m_received_time = time; }
+
 protected:
     Message() = default;
+
+private:
+    Optional<MonotonicTime> m_received_time;
 };
 
 }
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/BuiltinWrappers.h>
+#include <AK/HashMap.h>
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <LibCore/Environment.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/System.h>
+#include <LibIPC/Message.h>
+#include <LibIPC/MessageStatistics.h>
+#include <LibThreading/Mutex.h>
+
+#ifndef AK_OS_WINDOWS
+#    include <signal.h>
+#endif
+
+namespace IPC {
+
+// Queueing latencies are bucketed by powers of two microseconds: bucket N counts latencies below 2^N µs, with the last
+// bucket collecting everything slower than that.
+static constexpr size_t latency_bucket_count = 20;
+
+struct MessageCounters {
+    u32 endpoint_magic { 0 };
+    int message_id { 0 };
+    char const* message_name { nullptr };
+
+    u64 sent_count { 0 };
+    u64 sent_bytes { 0 };
+    AK::Duration encode_time;
+
+    u64 received_count { 0 };
+    u64 received_bytes { 0 };
+    AK::Duration decode_time;
+
+    u64 handled_count { 0 };
+    AK::Duration queueing_latency;
+    AK::Duration handling_time;
+    Array<u64, latency_bucket_count> queueing_latency_histogram {};
+};
+
+static Threading::Mutex s_mutex;
+static HashMap<u64, MessageCounters> s_counters;
+
+static MessageCounters& counters_for(u32 endpoint_magic, int message_id, char const* message_name)
+{
+    auto key = (static_cast<u64>(endpoint_magic) << 32) | static_cast<u32>(message_id);
+    return s_counters.ensure(key, [&] {
+        return MessageCounters { .endpoint_magic = endpoint_magic, .message_id = message_id, .message_name = message_name };
+    });
+}
+
+bool MessageStatistics::is_enabled()
+{
+    static bool const enabled = [] {
+        if (!Core::Environment::has("LADYBIRD_IPC_STATISTICS"sv))
+            return false;
+
+#ifndef AK_OS_WINDOWS
+        Core::EventLoop::register_signal(SIGUSR1, [](int) { dump(); });
+#endif
+        return true;
+    }();
+    return enabled;
+}
+
+void MessageStatistics::record_sent_message(Message const& message, size_t bytes, AK::Duration encode_time)
+{
+    Threading::MutexLocker locker { s_mutex };
+    auto& counters = counters_for(message.endpoint_magic(), message.message_id(), message.message_name());
+    ++counters.sent_count;
+    counters.sent_bytes += bytes;
+    counters.encode_time += encode_time;
+}
+
+void MessageStatistics::record_received_message(Message const& message, size_t bytes, AK::Duration decode_time)
+{
+    Threading::MutexLocker locker { s_mutex };
+    auto& counters = counters_for(message.endpoint_magic(), message.message_id(), message.message_name());
+    ++counters.received_count;
+    counters.received_bytes += bytes;
+    counters.decode_time += decode_time;
+}
+
+void MessageStatistics::record_handled_message(u32 endpoint_magic, int message_id, char const* message_name, AK::Duration queueing_latency, AK::Duration handling_time)
+{
+    auto latency_in_microseconds = static_cast<u64>(max(queueing_latency.to_microseconds(), 0));
+    auto bucket = min(latency_in_microseconds == 0 ? 0 : count_required_bits(latency_in_microseconds), latency_bucket_count - 1);
+
+    Threading::MutexLocker locker { s_mutex };
+    auto& counters = counters_for(endpoint_magic, message_id, message_name);
+    ++counters.handled_count;
+    counters.queueing_latency += queueing_latency;
+    counters.handling_time += handling_time;
+    ++counters.queueing_latency_histogram[bucket];
+}
+
+static i64 average_microseconds(AK::Duration total, u64 count)
+{
+    if (count == 0)
+        return 0;
+    return total.to_microseconds() / static_cast<i64>(count);
+}
+
+void MessageStatistics::dump()
+{
+    Threading::MutexLocker locker { s_mutex };
+
+    Vector<MessageCounters const*> sorted_counters;
+    sorted_counters.ensure_capacity(s_counters.size());
+    for (auto const& it : s_counters)
+        sorted_counters.unchecked_append(&it.value);
+    quick_sort(sorted_counters, [](auto const* a, auto const* b) {
+        return a->sent_bytes + a->received_bytes > b->sent_bytes + b->received_bytes;
+    });
+
+    dbgln("IPC message statistics for pid {}:", Core::System::getpid());
+    for (auto const* counters : sorted_counters) {
+        dbgln("  {} (endpoint {:#x}, id {})", counters->message_name, counters->endpoint_magic, counters->message_id);
+        if (counters->sent_count != 0)
+            dbgln("    sent: {} messages, {} bytes, {} µs average encode", counters->sent_count, counters->sent_bytes, average_microseconds(counters->encode_time, counters->sent_count));
+        if (counters->received_count != 0)
+            dbgln("    received: {} messages, {} bytes, {} µs average decode", counters->received_count, counters->received_bytes, average_microseconds(counters->decode_time, counters->received_count));
+        if (counters->handled_count == 0)
+            continue;
+
+        dbgln("    handled: {} messages, {} µs average queueing, {} µs average handling", counters->handled_count, average_microseconds(counters->queueing_latency, counters->handled_count), average_microseconds(counters->handling_time, counters->handled_count));
+
+        StringBuilder histogram;
+        for (size_t bucket = 0; bucket < latency_bucket_count; ++bucket) {
+            auto count = counters->queueing_latency_histogram[bucket];
+            if (count == 0)
+                continue;
+            if (bucket == latency_bucket_count - 1)
+                histogram.appendff(" >={}µs:{}", 1ull << (bucket - 1), count);
+            else
+                histogram.appendff(" <{}µs:{}", 1ull << bucket, count);
+        }
+        dbgln("    queueing latency:{}", histogram.string_view());
+    }
+}
+
+}
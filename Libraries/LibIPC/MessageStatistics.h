@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Time.h>
+#include <AK/Types.h>
+#include <LibIPC/Forward.h>
+
+namespace IPC {
+
+// Per-message traffic counters for every IPC connection in this process. Nothing is recorded unless the process was
+// started with LADYBIRD_IPC_STATISTICS set in its environment. When it was, sending the process SIGUSR1 dumps the
+// counters collected so far to the debug log.
+class MessageStatistics {
+public:
+    static bool is_enabled();
+
+    static void record_sent_message(Message const&, size_t bytes, AK::Duration encode_time);
+    static void record_received_message(Message const&, size_t bytes, AK::Duration decode_time);
+    static void record_handled_message(u32 endpoint_magic, int message_id, char const* message_name, AK::Duration queueing_latency, AK::Duration handling_time);
+
+    static void dump();
+};
+
+}
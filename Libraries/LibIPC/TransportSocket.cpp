@@ -15,26 +15,31 @@ namespace IPC {
 void SendQueue::enqueue_message(Vector<u8>&& bytes, Vector<int>&& fds)
 {
     Threading::MutexLocker locker(m_mutex);
-    VERIFY(MUST(m_stream.write_some(bytes.span())) == bytes.size());
-    m_fds.append(fds.data(), fds.size());
+    m_messages.append(move(bytes));
+    m_fds.extend(move(fds));
     m_condition.signal();
 }
 
 SendQueue::Running SendQueue::block_until_message_enqueued()
 {
     Threading::MutexLocker locker(m_mutex);
-    while (m_stream.is_eof() && m_fds.is_empty() && m_running)
+    while (m_messages.is_empty() && m_fds.is_empty() && m_running)
         m_condition.wait();
     return m_running ? Running::Yes : Running::No;
 }
 
-SendQueue::BytesAndFds SendQueue::peek(size_t max_bytes)
+SendQueue::PendingData SendQueue::peek(size_t max_messages)
 {
     Threading::MutexLocker locker(m_mutex);
-    BytesAndFds result;
-    auto bytes_to_send = min(max_bytes, m_stream.used_buffer_size());
-    result.bytes.resize(bytes_to_send);
-    m_stream.peek_some(result.bytes);
+    PendingData result;
+    auto messages_to_send = min(max_messages, m_messages.size());
+    result.bytes.ensure_capacity(messages_to_send);
+    for (size_t i = 0; i < messages_to_send; ++i) {
+        auto bytes = m_messages[i].span();
+        if (i == 0)
+            bytes = bytes.slice(m_offset_in_first_message);
+        result.bytes.unchecked_append(bytes);
+    }
 
     if (m_fds.size() > 0) {
         auto fds_to_send = min(m_fds.size(), Core::LocalSocket::MAX_TRANSFER_FDS);
@@ -47,7 +52,20 @@ SendQueue::BytesAndFds SendQueue::peek(size_t max_bytes)
 void SendQueue::discard(size_t bytes_count, size_t fds_count)
 {
     Threading::MutexLocker locker(m_mutex);
-    MUST(m_stream.discard(bytes_count));
+
+    size_t fully_sent_message_count = 0;
+    while (bytes_count > 0) {
+        auto remaining_in_message = m_messages[fully_sent_message_count].size() - m_offset_in_first_message;
+        if (bytes_count < remaining_in_message) {
+            m_offset_in_first_message += bytes_count;
+            break;
+        }
+        bytes_count -= remaining_in_message;
+        m_offset_in_first_message = 0;
+        ++fully_sent_message_count;
+    }
+    m_messages.remove(0, fully_sent_message_count);
+
     m_fds.remove(0, fds_count);
 }
 
@@ -67,10 +85,8 @@ TransportSocket::TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket)
             if (send_queue->block_until_message_enqueued() == SendQueue::Running::No)
                 break;
 
-            auto [bytes, fds] = send_queue->peek(4096);
-            ReadonlyBytes remaining_bytes_to_send = bytes;
-
-            if (transfer_data(remaining_bytes_to_send, fds) == TransferState::SocketClosed)
+            auto pending_data = send_queue->peek(SendQueue::MAX_MESSAGES_PER_TRANSFER);
+            if (transfer_data(pending_data) == TransferState::SocketClosed)
                 break;
         }
 
@@ -119,11 +135,11 @@ void TransportSocket::close_after_sending_all_pending_messages()
 {
     stop_send_thread();
 
-    auto [bytes, fds] = m_send_queue->peek(NumericLimits<size_t>::max());
-    ReadonlyBytes remaining_bytes_to_send = bytes;
-
-    while (!remaining_bytes_to_send.is_empty() || !fds.is_empty()) {
-        if (transfer_data(remaining_bytes_to_send, fds) == TransferState::SocketClosed)
+    for (;;) {
+        auto pending_data = m_send_queue->peek(SendQueue::MAX_MESSAGES_PER_TRANSFER);
+        if (pending_data.is_empty())
+            break;
+        if (transfer_data(pending_data) == TransferState::SocketClosed)
             break;
     }
 
@@ -188,16 +204,10 @@ void TransportSocket::post_message(Vector<u8> const& bytes_to_write, Vector<Nonn
     m_send_queue->enqueue_message(move(message_buffer), move(raw_fds));
 }
 
-ErrorOr<void> TransportSocket::send_message(Core::LocalSocket& socket, ReadonlyBytes& bytes_to_write, Vector<int>& unowned_fds)
+ErrorOr<void> TransportSocket::send_message(Core::LocalSocket& socket, SendQueue::PendingData& data)
 {
-    auto num_fds_to_transfer = unowned_fds.size();
-    while (!bytes_to_write.is_empty()) {
-        ErrorOr<ssize_t> maybe_nwritten = 0;
-        if (num_fds_to_transfer > 0) {
-            maybe_nwritten = socket.send_message(bytes_to_write, 0, unowned_fds);
-        } else {
-            maybe_nwritten = socket.write_some(bytes_to_write);
-        }
+    while (!data.bytes.is_empty()) {
+        auto maybe_nwritten = socket.send_message(data.bytes, 0, data.fds);
 
         if (maybe_nwritten.is_error()) {
             if (auto error = maybe_nwritten.release_error(); error.is_errno() && (error.code() == EAGAIN || error.code() == EWOULDBLOCK || error.code() == EINTR)) {
@@ -207,24 +217,40 @@ ErrorOr<void> TransportSocket::send_message(Core::LocalSocket& socket, ReadonlyB
             }
         }
 
-        bytes_to_write = bytes_to_write.slice(maybe_nwritten.value());
-        num_fds_to_transfer = 0;
-        unowned_fds.clear();
+        data.fds.clear();
+
+        auto nwritten = static_cast<size_t>(maybe_nwritten.value());
+        size_t fully_written_count = 0;
+        while (fully_written_count < data.bytes.size() && nwritten >= data.bytes[fully_written_count].size()) {
+            nwritten -= data.bytes[fully_written_count].size();
+            ++fully_written_count;
+        }
+        data.bytes.remove(0, fully_written_count);
+        if (!data.bytes.is_empty())
+            data.bytes.first() = data.bytes.first().slice(nwritten);
     }
     return {};
 }
 
-TransportSocket::TransferState TransportSocket::transfer_data(ReadonlyBytes& bytes, Vector<int>& fds)
+static size_t total_size(ReadonlySpan<ReadonlyBytes> chunks)
+{
+    size_t size = 0;
+    for (auto const& chunk : chunks)
+        size += chunk.size();
+    return size;
+}
+
+TransportSocket::TransferState TransportSocket::transfer_data(SendQueue::PendingData& data)
 {
-    auto byte_count = bytes.size();
-    auto fd_count = fds.size();
+    auto byte_count = total_size(data.bytes);
+    auto fd_count = data.fds.size();
 
     Threading::RWLockLocker<Threading::LockMode::Read> lock(m_socket_rw_lock);
 
     if (!m_socket->is_open())
         return TransferState::SocketClosed;
 
-    if (auto result = send_message(*m_socket, bytes, fds); result.is_error()) {
+    if (auto result = send_message(*m_socket, data); result.is_error()) {
         if (result.error().is_errno() && result.error().code() == EPIPE) {
             // The socket is closed from the other end, we can stop sending.
             return TransferState::SocketClosed;
@@ -234,8 +260,8 @@ TransportSocket::TransferState TransportSocket::transfer_data(ReadonlyBytes& byt
         VERIFY_NOT_REACHED();
     }
 
-    auto written_byte_count = byte_count - bytes.size();
-    auto written_fd_count = fd_count - fds.size();
+    auto written_byte_count = byte_count - total_size(data.bytes);
+    auto written_fd_count = fd_count - data.fds.size();
     if (written_byte_count > 0 || written_fd_count > 0)
         m_send_queue->discard(written_byte_count, written_fd_count);
 
@@ -7,7 +7,6 @@
 
 #pragma once
 
-#include <AK/MemoryStream.h>
 #include <AK/Queue.h>
 #include <LibCore/Socket.h>
 #include <LibIPC/AutoCloseFileDescriptor.h>
@@ -28,16 +27,24 @@ public:
     Running block_until_message_enqueued();
     void stop();
 
+    static constexpr size_t MAX_MESSAGES_PER_TRANSFER = 64;
+
     void enqueue_message(Vector<u8>&& bytes, Vector<int>&& fds);
-    struct BytesAndFds {
-        Vector<u8> bytes;
+
+    // Queued messages are handed out in place rather than copied. The spans stay valid until they are discarded, as
+    // growing the queue only moves each message's heap buffer, never its contents.
+    struct PendingData {
+        Vector<ReadonlyBytes, MAX_MESSAGES_PER_TRANSFER> bytes;
         Vector<int> fds;
+
+        bool is_empty() const { return bytes.is_empty() && fds.is_empty(); }
     };
-    BytesAndFds peek(size_t max_bytes);
+    PendingData peek(size_t max_messages);
     void discard(size_t bytes_count, size_t fds_count);
 
 private:
-    AllocatingMemoryStream m_stream;
+    Vector<Vector<u8>> m_messages;
+    size_t m_offset_in_first_message { 0 };
     Vector<int> m_fds;
     Threading::Mutex m_mutex;
     Threading::ConditionVariable m_condition { m_mutex };
@@ -84,9 +91,9 @@ private:
         Continue,
         SocketClosed,
     };
-    [[nodiscard]] TransferState transfer_data(ReadonlyBytes& bytes, Vector<int>& fds);
+    [[nodiscard]] TransferState transfer_data(SendQueue::PendingData&);
 
-    static ErrorOr<void> send_message(Core::LocalSocket&, ReadonlyBytes& bytes, Vector<int>& unowned_fds);
+    static ErrorOr<void> send_message(Core::LocalSocket&, SendQueue::PendingData&);
 
     void stop_send_thread();
 
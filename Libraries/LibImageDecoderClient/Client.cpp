@@ -20,9 +20,11 @@ void Client::die()
         promise->reject(Error::from_string_literal("ImageDecoder disconnected"));
     }
     m_pending_decoded_images.clear();
+    m_animation_frame_handlers.clear();
+    m_partial_image_handlers.clear();
 }
 
-NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes encoded_data, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes encoded_data, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, DecodePriority priority)
 {
     auto promise = Core::Promise<DecodedImage>::construct();
     if (on_resolved)
@@ -45,7 +47,7 @@ NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes en
 
     memcpy(encoded_buffer.data<void>(), encoded_data.data(), encoded_data.size());
 
-    auto response = send_sync_but_allow_failure<Messages::ImageDecoderServer::DecodeImage>(move(encoded_buffer), ideal_size, mime_type);
+    auto response = send_sync_but_allow_failure<Messages::ImageDecoderServer::DecodeImage>(move(encoded_buffer), ideal_size, mime_type, priority);
     if (!response) {
         dbgln("ImageDecoder disconnected trying to decode image");
         promise->reject(Error::from_string_literal("ImageDecoder disconnected"));
@@ -57,7 +59,7 @@ NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes en
     return promise;
 }
 
-void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space)
+void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, u32 frame_count, bool decodes_frames_on_demand, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space)
 {
     auto bitmaps = move(bitmap_sequence.bitmaps);
     VERIFY(!bitmaps.is_empty());
@@ -65,6 +67,8 @@ void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gf
     auto maybe_promise = m_pending_decoded_images.take(image_id);
     if (!maybe_promise.has_value()) {
         dbgln("ImageDecoderClient: No pending image with ID {}", image_id);
+        if (decodes_frames_on_demand)
+            release_animation(image_id);
         return;
     }
     auto promise = maybe_promise.release_value();
@@ -72,12 +76,17 @@ void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gf
     DecodedImage image;
     image.is_animated = is_animated;
     image.loop_count = loop_count;
+    image.frame_count = frame_count;
     image.scale = scale;
+    if (decodes_frames_on_demand)
+        image.animation_id = image_id;
     image.frames.ensure_capacity(bitmaps.size());
     image.color_space = move(color_space);
     for (size_t i = 0; i < bitmaps.size(); ++i) {
         if (!bitmaps[i]) {
             dbgln("ImageDecoderClient: Invalid bitmap for request {} at index {}", image_id, i);
+            if (decodes_frames_on_demand)
+                release_animation(image_id);
             promise->reject(Error::from_string_literal("Invalid bitmap"));
             return;
         }
@@ -102,4 +111,86 @@ void Client::did_fail_to_decode_image(i64 image_id, String error_message)
     promise->reject(Error::from_string_literal("Image decoding failed or aborted"));
 }
 
+void Client::request_animation_frames(i64 animation_id, u32 first_frame_index, u32 count, AnimationFramesCallback callback)
+{
+    if (!is_open())
+        return;
+
+    m_animation_frame_handlers.set(animation_id, move(callback));
+    async_request_animation_frames(animation_id, first_frame_index, count);
+}
+
+void Client::release_animation(i64 animation_id)
+{
+    m_animation_frame_handlers.remove(animation_id);
+    if (is_open())
+        async_release_animation(animation_id);
+}
+
+void Client::did_decode_animation_frames(i64 image_id, u32 first_frame_index, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations)
+{
+    auto it = m_animation_frame_handlers.find(image_id);
+    if (it == m_animation_frame_handlers.end())
+        return;
+
+    auto handler = move(it->value);
+    handler(first_frame_index, move(bitmap_sequence.bitmaps), move(durations));
+
+    // Put the handler back, unless it requested more frames with a new one or released the animation while it ran.
+    if (it = m_animation_frame_handlers.find(image_id); it != m_animation_frame_handlers.end() && !it->value)
+        it->value = move(handler);
+}
+
+Optional<i64> Client::start_incremental_decode(PartialImageCallback callback)
+{
+    auto response = send_sync_but_allow_failure<Messages::ImageDecoderServer::StartIncrementalDecode>();
+    if (!response) {
+        dbgln("ImageDecoder disconnected trying to start an incremental decode");
+        return {};
+    }
+
+    auto session_id = response->session_id();
+    m_partial_image_handlers.set(session_id, move(callback));
+    return session_id;
+}
+
+void Client::append_incremental_decode_data(i64 session_id, ReadonlyBytes data)
+{
+    if (data.is_empty() || !is_open() || !m_partial_image_handlers.contains(session_id))
+        return;
+
+    auto buffer_or_error = Core::AnonymousBuffer::create_with_size(data.size());
+    if (buffer_or_error.is_error()) {
+        dbgln("Could not allocate buffer for incremental decode data: {}", buffer_or_error.error());
+        return;
+    }
+    auto buffer = buffer_or_error.release_value();
+    memcpy(buffer.data<void>(), data.data(), data.size());
+
+    async_append_incremental_decode_data(session_id, move(buffer));
+}
+
+void Client::end_incremental_decode(i64 session_id)
+{
+    m_partial_image_handlers.remove(session_id);
+    if (is_open())
+        async_end_incremental_decode(session_id);
+}
+
+void Client::did_decode_partial_image(i64 session_id, Gfx::BitmapSequence bitmap_sequence, Gfx::ColorSpace color_space)
+{
+    auto it = m_partial_image_handlers.find(session_id);
+    if (it == m_partial_image_handlers.end())
+        return;
+    if (bitmap_sequence.bitmaps.is_empty() || !bitmap_sequence.bitmaps.first())
+        return;
+
+    // NOTE: The handler may end the session while it runs, so it's called from a local copy.
+    auto handler = move(it->value);
+    handler(bitmap_sequence.bitmaps.first().release_nonnull(), move(color_space));
+
+    if (it = m_partial_image_handlers.find(session_id); it != m_partial_image_handlers.end() && !it->value)
+        it->value = move(handler);
+}
+
 }
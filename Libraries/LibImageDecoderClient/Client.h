@@ -11,6 +11,7 @@
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
 #include <LibCore/Promise.h>
 #include <LibGfx/ColorSpace.h>
+#include <LibImageDecoderClient/DecodePriority.h>
 #include <LibIPC/ConnectionToServer.h>
 
 namespace ImageDecoderClient {
@@ -24,8 +25,13 @@ struct DecodedImage {
     bool is_animated { false };
     Gfx::FloatPoint scale { 1, 1 };
     u32 loop_count { 0 };
+    u32 frame_count { 0 };
     Vector<Frame> frames;
     Gfx::ColorSpace color_space;
+
+    // Set if only the first few frames of the animation were decoded. The rest can be requested with
+    // Client::request_animation_frames(), and the animation must be released once it's no longer needed.
+    Optional<i64> animation_id;
 };
 
 class Client final
@@ -38,17 +44,32 @@ public:
 
     Client(NonnullOwnPtr<IPC::Transport>);
 
-    NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {});
+    NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {}, DecodePriority = DecodePriority::NearViewport);
+
+    using AnimationFramesCallback = Function<void(u32 first_frame_index, Vector<RefPtr<Gfx::Bitmap>>, Vector<u32> durations)>;
+    void request_animation_frames(i64 animation_id, u32 first_frame_index, u32 count, AnimationFramesCallback);
+    void release_animation(i64 animation_id);
+
+    // Decodes an image while its data is still arriving. The callback is invoked with a partial bitmap every so often
+    // as data is appended, until the session is ended. The complete image still has to be decoded with decode_image().
+    using PartialImageCallback = Function<void(NonnullRefPtr<Gfx::Bitmap>, Gfx::ColorSpace)>;
+    Optional<i64> start_incremental_decode(PartialImageCallback);
+    void append_incremental_decode_data(i64 session_id, ReadonlyBytes);
+    void end_incremental_decode(i64 session_id);
 
     Function<void()> on_death;
 
 private:
     virtual void die() override;
 
-    virtual void did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space) override;
+    virtual void did_decode_image(i64 image_id, bool is_animated, u32 loop_count, u32 frame_count, bool decodes_frames_on_demand, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space) override;
     virtual void did_fail_to_decode_image(i64 image_id, String error_message) override;
+    virtual void did_decode_animation_frames(i64 image_id, u32 first_frame_index, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations) override;
+    virtual void did_decode_partial_image(i64 session_id, Gfx::BitmapSequence bitmap_sequence, Gfx::ColorSpace color_space) override;
 
     HashMap<i64, NonnullRefPtr<Core::Promise<DecodedImage>>> m_pending_decoded_images;
+    HashMap<i64, AnimationFramesCallback> m_animation_frame_handlers;
+    HashMap<i64, PartialImageCallback> m_partial_image_handlers;
 };
 
 }
@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace ImageDecoderClient {
+
+// How soon an image is needed, going by where it is on the page. Images that are needed sooner are decoded first.
+enum class DecodePriority : u8 {
+    Offscreen,
+    NearViewport,
+    Visible,
+};
+
+}
@@ -1816,6 +1816,7 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> CallExpression::generat
                 callee,
                 this_value,
                 argument_operands,
+                generator.next_call_cache(),
                 expression_string_index);
         }
     }
@@ -11,10 +11,19 @@ namespace JS::Bytecode {
 
 Optional<Builtin> get_builtin(MemberExpression const& expression)
 {
-    if (expression.is_computed() || !expression.object().is_identifier() || !expression.property().is_identifier())
+    if (expression.is_computed() || !expression.property().is_identifier())
         return {};
-    auto base_name = static_cast<Identifier const&>(expression.object()).string();
     auto property_name = static_cast<Identifier const&>(expression.property()).string();
+
+#define CHECK_METHOD_BUILTIN(name, snake_case_name, base, property, ...) \
+    if (property_name == #property##sv)                                  \
+        return Builtin::name;
+    JS_ENUMERATE_METHOD_BUILTINS(CHECK_METHOD_BUILTIN)
+#undef CHECK_METHOD_BUILTIN
+
+    if (!expression.object().is_identifier())
+        return {};
+    auto base_name = static_cast<Identifier const&>(expression.object()).string();
 #define CHECK_MEMBER_BUILTIN(name, snake_case_name, base, property, ...) \
     if (base_name == #base##sv && property_name == #property##sv)        \
         return Builtin::name;
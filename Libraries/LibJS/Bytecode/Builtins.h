@@ -26,10 +26,22 @@ namespace JS::Bytecode {
     O(MathSin, math_sin, Math, sin, 1)                                                            \
     O(MathCos, math_cos, Math, cos, 1)                                                            \
     O(MathTan, math_tan, Math, tan, 1)                                                            \
+    O(MathMax, math_max, Math, max, 2)                                                            \
+    O(MathMin, math_min, Math, min, 2)                                                            \
+    O(MathTrunc, math_trunc, Math, trunc, 1)                                                      \
+    O(MathSign, math_sign, Math, sign, 1)                                                         \
     O(ArrayIteratorPrototypeNext, array_iterator_prototype_next, ArrayIteratorPrototype, next, 0) \
     O(MapIteratorPrototypeNext, map_iterator_prototype_next, MapIteratorPrototype, next, 0)       \
     O(SetIteratorPrototypeNext, set_iterator_prototype_next, SetIteratorPrototype, next, 0)       \
-    O(StringIteratorPrototypeNext, string_iterator_prototype_next, StringIteratorPrototype, next, 0)
+    O(StringIteratorPrototypeNext, string_iterator_prototype_next, StringIteratorPrototype, next, 0) \
+    JS_ENUMERATE_METHOD_BUILTINS(O)
+
+// Builtins that are methods on a prototype, recognized by property name alone (e.g. `anything.charCodeAt(i)`).
+// The call site's this value is passed along to their implementation.
+// TitleCaseName, snake_case_name, base, property, argument_count
+#define JS_ENUMERATE_METHOD_BUILTINS(O)                                                          \
+    O(StringPrototypeCharCodeAt, string_prototype_char_code_at, StringPrototype, charCodeAt, 1) \
+    O(ArrayPrototypePush, array_prototype_push, ArrayPrototype, push, 1)
 
 enum class Builtin : u8 {
 #define DEFINE_BUILTIN_ENUM(name, ...) name,
@@ -4,10 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/MemoryReporting.h>
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/RegexTable.h>
+#include <LibJS/Runtime/Shape.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/SourceCode.h>
 
@@ -15,6 +17,30 @@ namespace JS::Bytecode {
 
 GC_DEFINE_ALLOCATOR(Executable);
 
+size_t Executable::s_executable_count { 0 };
+size_t Executable::s_executable_size_in_bytes { 0 };
+
+size_t MegamorphicPropertyLookupCache::index_for(Shape const& shape, FlyString const& property_name)
+{
+    return pair_int_hash(ptr_hash(&shape), property_name.hash()) & (number_of_entries - 1);
+}
+
+MegamorphicPropertyLookupCache::Entry const* MegamorphicPropertyLookupCache::lookup(Shape const& shape, FlyString const& property_name) const
+{
+    auto const& entry = m_entries[index_for(shape, property_name)];
+    if (entry.shape.ptr() != &shape || entry.property_name != property_name)
+        return nullptr;
+    return &entry;
+}
+
+void MegamorphicPropertyLookupCache::insert(Shape& shape, FlyString const& property_name, u32 property_offset)
+{
+    auto& entry = m_entries[index_for(shape, property_name)];
+    entry.shape = shape;
+    entry.property_name = property_name;
+    entry.property_offset = property_offset;
+}
+
 Executable::Executable(
     Vector<u8> bytecode,
     NonnullOwnPtr<IdentifierTable> identifier_table,
@@ -24,6 +50,7 @@ Executable::Executable(
     NonnullRefPtr<SourceCode const> source_code,
     size_t number_of_property_lookup_caches,
     size_t number_of_global_variable_caches,
+    size_t number_of_call_caches,
     size_t number_of_registers,
     bool is_strict_mode)
     : bytecode(move(bytecode))
@@ -37,9 +64,27 @@ Executable::Executable(
 {
     property_lookup_caches.resize(number_of_property_lookup_caches);
     global_variable_caches.resize(number_of_global_variable_caches);
+    call_caches.resize(number_of_call_caches);
+
+    m_size_in_bytes = this->bytecode.capacity()
+        + property_lookup_caches.capacity() * sizeof(PropertyLookupCache)
+        + global_variable_caches.capacity() * sizeof(GlobalVariableCache)
+        + call_caches.capacity() * sizeof(CallCache)
+        + this->constants.capacity() * sizeof(Value);
+    ++s_executable_count;
+    s_executable_size_in_bytes += m_size_in_bytes;
 }
 
-Executable::~Executable() = default;
+Executable::~Executable()
+{
+    --s_executable_count;
+    s_executable_size_in_bytes -= m_size_in_bytes;
+}
+
+void Executable::report_memory_usage(Core::MemoryReports& reports)
+{
+    reports.add("js/bytecode-executables"_string, s_executable_size_in_bytes, s_executable_count);
+}
 
 void Executable::dump() const
 {
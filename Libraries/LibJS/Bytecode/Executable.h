@@ -11,6 +11,7 @@
 #include <AK/NonnullOwnPtr.h>
 #include <AK/OwnPtr.h>
 #include <AK/WeakPtr.h>
+#include <LibCore/Forward.h>
 #include <LibGC/CellAllocator.h>
 #include <LibJS/Bytecode/IdentifierTable.h>
 #include <LibJS/Bytecode/Label.h>
@@ -33,6 +34,31 @@ struct PropertyLookupCache {
         WeakPtr<PrototypeChainValidity> prototype_chain_validity;
     };
     AK::Array<Entry, max_number_of_shapes_to_remember> entries;
+
+    [[nodiscard]] bool is_full() const { return !entries.last().shape.is_null(); }
+};
+
+// A VM-wide, direct-mapped cache of own property offsets keyed by (Shape, property name).
+// Property lookup sites that have gone megamorphic (i.e. filled up their PropertyLookupCache)
+// fall back to this before taking the full [[Get]]/[[Set]] path.
+class MegamorphicPropertyLookupCache {
+public:
+    static constexpr size_t number_of_entries = 1024;
+    static_assert(is_power_of_two(number_of_entries));
+
+    struct Entry {
+        WeakPtr<Shape> shape;
+        FlyString property_name;
+        u32 property_offset { 0 };
+    };
+
+    [[nodiscard]] Entry const* lookup(Shape const&, FlyString const& property_name) const;
+    void insert(Shape&, FlyString const& property_name, u32 property_offset);
+
+private:
+    static size_t index_for(Shape const&, FlyString const& property_name);
+
+    AK::Array<Entry, number_of_entries> m_entries;
 };
 
 struct GlobalVariableCache : public PropertyLookupCache {
@@ -42,6 +68,14 @@ struct GlobalVariableCache : public PropertyLookupCache {
     bool in_module_environment { false };
 };
 
+// Remembers the ECMAScript function most recently called from a Call instruction, along with the
+// stack frame size it needs, so that monomorphic call sites can skip the generic frame size query.
+struct CallCache {
+    WeakPtr<Object> callee;
+    size_t registers_and_constants_and_locals_count { 0 };
+    size_t argument_count { 0 };
+};
+
 struct SourceRecord {
     u32 source_start_offset {};
     u32 source_end_offset {};
@@ -61,6 +95,7 @@ public:
         NonnullRefPtr<SourceCode const>,
         size_t number_of_property_lookup_caches,
         size_t number_of_global_variable_caches,
+        size_t number_of_call_caches,
         size_t number_of_registers,
         bool is_strict_mode);
 
@@ -70,6 +105,7 @@ public:
     Vector<u8> bytecode;
     Vector<PropertyLookupCache> property_lookup_caches;
     Vector<GlobalVariableCache> global_variable_caches;
+    Vector<CallCache> call_caches;
     NonnullOwnPtr<StringTable> string_table;
     NonnullOwnPtr<IdentifierTable> identifier_table;
     NonnullOwnPtr<RegexTable> regex_table;
@@ -113,8 +149,17 @@ public:
 
     void dump() const;
 
+    // Reports the memory taken up by the bytecode, caches and constants of all executables. These are sized once, when
+    // the executable is created.
+    static void report_memory_usage(Core::MemoryReports&);
+
 private:
     virtual void visit_edges(Visitor&) override;
+
+    size_t m_size_in_bytes { 0 };
+
+    static size_t s_executable_count;
+    static size_t s_executable_size_in_bytes;
 };
 
 }
@@ -308,6 +308,44 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
     auto number_of_constants = generator.m_constants.size();
     auto number_of_locals = function ? function->local_variables_names().size() : 0;
 
+    // Pass: Thread jumps through blocks that do nothing but jump somewhere else.
+    {
+        auto forwarding_target_of = [&](BasicBlock const& block) -> Optional<Label> {
+            if (block.size() == 0)
+                return {};
+            auto const& instruction = *InstructionStreamIterator { block.instruction_stream() };
+            if (instruction.type() != Instruction::Type::Jump || instruction.length() != block.size())
+                return {};
+            return static_cast<Op::Jump const&>(instruction).target();
+        };
+
+        Vector<Optional<Label>> forwarding_targets;
+        forwarding_targets.ensure_capacity(generator.m_root_basic_blocks.size());
+        for (auto& block : generator.m_root_basic_blocks)
+            forwarding_targets.unchecked_append(forwarding_target_of(*block));
+
+        auto thread_label = [&](Label& label) {
+            // NOTE: The number of hops is bounded, so that a cycle of forwarding blocks (e.g. `for (;;) {}`) terminates.
+            for (size_t hops = 0; hops < forwarding_targets.size(); ++hops) {
+                auto const& target = forwarding_targets[label.basic_block_index()];
+                if (!target.has_value() || target->basic_block_index() == label.basic_block_index())
+                    return;
+                label = *target;
+            }
+        };
+
+        for (auto& block : generator.m_root_basic_blocks) {
+            Bytecode::InstructionStreamIterator it(block->instruction_stream());
+            while (!it.at_end()) {
+                auto& instruction = const_cast<Instruction&>(*it);
+                instruction.visit_labels([&](Label& label) {
+                    thread_label(label);
+                });
+                ++it;
+            }
+        }
+    }
+
     // Pass: Rewrite the bytecode to use the correct register and constant indices.
     for (auto& block : generator.m_root_basic_blocks) {
         Bytecode::InstructionStreamIterator it(block->instruction_stream());
@@ -398,6 +436,15 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
                 }
             }
 
+            // OPTIMIZATION: Don't emit moves from an operand to itself.
+            if (instruction.type() == Instruction::Type::Mov) {
+                auto& mov = static_cast<Bytecode::Op::Mov&>(instruction);
+                if (mov.dst() == mov.src()) {
+                    ++it;
+                    continue;
+                }
+            }
+
             // OPTIMIZATION: For `JumpIf` where one of the targets is the very next block,
             //               we can emit a `JumpTrue` or `JumpFalse` (to the other block) instead.
             if (instruction.type() == Instruction::Type::JumpIf) {
@@ -452,6 +499,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         node.source_code(),
         generator.m_next_property_lookup_cache,
         generator.m_next_global_variable_cache,
+        generator.m_next_call_cache,
         generator.m_next_register,
         is_strict_mode);
 
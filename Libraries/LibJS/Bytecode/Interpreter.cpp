@@ -20,6 +20,7 @@
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/ArrayPrototype.h>
 #include <LibJS/Runtime/BigInt.h>
 #include <LibJS/Runtime/CompletionCell.h>
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
@@ -37,6 +38,8 @@
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/Reference.h>
 #include <LibJS/Runtime/RegExpObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/StringPrototype.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
@@ -402,6 +405,10 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
 
     for (;;) {
     start:
+        // Entering an executable and taking a jump (which includes every loop back-edge) are our profiler safepoints.
+        if (auto* profiler = vm().sampling_profiler()) [[unlikely]]
+            profiler->poll();
+
         for (;;) {
             goto* bytecode_dispatch_table[static_cast<size_t>((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type())];
 
@@ -552,6 +559,61 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             goto start;
         }
 
+        // OPTIMIZATION: The hottest arithmetic and relational ops get their Int32 fast path handled right here in the
+        //               dispatch loop, so we don't pay for a call and a ThrowCompletionOr round-trip on every iteration.
+        //               Anything else falls back to the op's regular execute_impl().
+#define HANDLE_INT32_BINARY_OP(name, int32_operator, overflow_check)                                                        \
+    handle_##name:                                                                                                          \
+    {                                                                                                                       \
+        auto& instruction = *reinterpret_cast<Op::name const*>(&bytecode[program_counter]);                                 \
+        auto lhs = get(instruction.lhs());                                                                                  \
+        auto rhs = get(instruction.rhs());                                                                                  \
+        if (lhs.is_int32() && rhs.is_int32() && !overflow_check(lhs.as_i32(), rhs.as_i32())) [[likely]] {                   \
+            set(instruction.dst(), Value(lhs.as_i32() int32_operator rhs.as_i32()));                                        \
+            DISPATCH_NEXT(name);                                                                                            \
+        }                                                                                                                   \
+        auto result = instruction.execute_impl(*this);                                                                      \
+        if (result.is_error()) [[unlikely]] {                                                                               \
+            if (handle_exception(program_counter, result.error_value()) == HandleExceptionResponse::ExitFromExecutable)     \
+                return;                                                                                                     \
+            goto start;                                                                                                     \
+        }                                                                                                                   \
+        DISPATCH_NEXT(name);                                                                                                \
+    }
+
+#define NO_OVERFLOW_CHECK(lhs, rhs) false
+
+            HANDLE_INT32_BINARY_OP(Add, +, Checked<i32>::addition_would_overflow);
+            HANDLE_INT32_BINARY_OP(Sub, -, Checked<i32>::subtraction_would_overflow);
+            HANDLE_INT32_BINARY_OP(LessThan, <, NO_OVERFLOW_CHECK);
+            HANDLE_INT32_BINARY_OP(LessThanEquals, <=, NO_OVERFLOW_CHECK);
+            HANDLE_INT32_BINARY_OP(GreaterThan, >, NO_OVERFLOW_CHECK);
+            HANDLE_INT32_BINARY_OP(GreaterThanEquals, >=, NO_OVERFLOW_CHECK);
+#undef NO_OVERFLOW_CHECK
+#undef HANDLE_INT32_BINARY_OP
+
+#define HANDLE_INT32_UPDATE_OP(name, int32_operator, limit)                                                                 \
+    handle_##name:                                                                                                          \
+    {                                                                                                                       \
+        auto& instruction = *reinterpret_cast<Op::name const*>(&bytecode[program_counter]);                                 \
+        auto value = get(instruction.dst());                                                                                \
+        if (value.is_int32() && value.as_i32() != limit) [[likely]] {                                                       \
+            set(instruction.dst(), Value(value.as_i32() int32_operator 1));                                                 \
+            DISPATCH_NEXT(name);                                                                                            \
+        }                                                                                                                   \
+        auto result = instruction.execute_impl(*this);                                                                      \
+        if (result.is_error()) [[unlikely]] {                                                                               \
+            if (handle_exception(program_counter, result.error_value()) == HandleExceptionResponse::ExitFromExecutable)     \
+                return;                                                                                                     \
+            goto start;                                                                                                     \
+        }                                                                                                                   \
+        DISPATCH_NEXT(name);                                                                                                \
+    }
+
+            HANDLE_INT32_UPDATE_OP(Increment, +, NumericLimits<i32>::max());
+            HANDLE_INT32_UPDATE_OP(Decrement, -, NumericLimits<i32>::min());
+#undef HANDLE_INT32_UPDATE_OP
+
 #define HANDLE_INSTRUCTION(name)                                                                                            \
     handle_##name:                                                                                                          \
     {                                                                                                                       \
@@ -575,7 +637,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
         DISPATCH_NEXT(name);                                                                \
     }
 
-            HANDLE_INSTRUCTION(Add);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(AddPrivateName);
             HANDLE_INSTRUCTION(ArrayAppend);
             HANDLE_INSTRUCTION(AsyncIteratorClose);
@@ -598,7 +659,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(CreateVariable);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(CreateRestParams);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(CreateArguments);
-            HANDLE_INSTRUCTION(Decrement);
             HANDLE_INSTRUCTION(DeleteById);
             HANDLE_INSTRUCTION(DeleteByIdWithThis);
             HANDLE_INSTRUCTION(DeleteByValue);
@@ -627,12 +687,9 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(GetPrivateById);
             HANDLE_INSTRUCTION(GetBinding);
             HANDLE_INSTRUCTION(GetInitializedBinding);
-            HANDLE_INSTRUCTION(GreaterThan);
-            HANDLE_INSTRUCTION(GreaterThanEquals);
             HANDLE_INSTRUCTION(HasPrivateId);
             HANDLE_INSTRUCTION(ImportCall);
             HANDLE_INSTRUCTION(In);
-            HANDLE_INSTRUCTION(Increment);
             HANDLE_INSTRUCTION(InitializeLexicalBinding);
             HANDLE_INSTRUCTION(InitializeVariableBinding);
             HANDLE_INSTRUCTION(InstanceOf);
@@ -645,8 +702,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(LeavePrivateEnvironment);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(LeaveUnwindContext);
             HANDLE_INSTRUCTION(LeftShift);
-            HANDLE_INSTRUCTION(LessThan);
-            HANDLE_INSTRUCTION(LessThanEquals);
             HANDLE_INSTRUCTION(LooselyEquals);
             HANDLE_INSTRUCTION(LooselyInequals);
             HANDLE_INSTRUCTION(Mod);
@@ -678,7 +733,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(SetVariableBinding);
             HANDLE_INSTRUCTION(StrictlyEquals);
             HANDLE_INSTRUCTION(StrictlyInequals);
-            HANDLE_INSTRUCTION(Sub);
             HANDLE_INSTRUCTION(SuperCallWithArgumentArray);
             HANDLE_INSTRUCTION(Throw);
             HANDLE_INSTRUCTION(ThrowIfNotObject);
@@ -1020,13 +1074,29 @@ inline ThrowCompletionOr<Value> get_by_id(VM& vm, Optional<IdentifierTableIndex>
         }
     }
 
+    auto const& property_name = executable.get_identifier(property);
+
+    // OPTIMIZATION: This site has seen more shapes than it can remember, so try the VM-wide megamorphic cache.
+    bool const is_megamorphic = cache.is_full();
+    if (is_megamorphic) {
+        if (auto const* megamorphic_entry = vm.bytecode_interpreter().megamorphic_get_cache().lookup(shape, property_name)) {
+            auto value = base_obj->get_direct(megamorphic_entry->property_offset);
+            if (value.is_accessor())
+                return TRY(call(vm, value.as_accessor().getter(), this_value));
+            return value;
+        }
+    }
+
     CacheablePropertyMetadata cacheable_metadata;
-    auto value = TRY(base_obj->internal_get(executable.get_identifier(property), this_value, &cacheable_metadata));
+    auto value = TRY(base_obj->internal_get(property_name, this_value, &cacheable_metadata));
 
     // If internal_get() caused object's shape change, we can no longer be sure
     // that collected metadata is valid, e.g. if getter in prototype chain added
     // property with the same name into the object itself.
     if (&shape == &base_obj->shape()) {
+        if (is_megamorphic && cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty)
+            vm.bytecode_interpreter().megamorphic_get_cache().insert(shape, property_name, cacheable_metadata.property_offset.value());
+
         auto get_cache_slot = [&] -> PropertyLookupCache::Entry& {
             for (size_t i = cache.entries.size() - 1; i >= 1; --i) {
                 cache.entries[i] = cache.entries[i - 1];
@@ -1266,6 +1336,19 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
             }
         }
 
+        // OPTIMIZATION: This site has seen more shapes than it can remember, so try the VM-wide megamorphic cache.
+        bool const is_megamorphic = caches && caches->is_full() && name.is_string();
+        if (is_megamorphic) {
+            if (auto const* megamorphic_entry = vm.bytecode_interpreter().megamorphic_put_cache().lookup(shape, name.as_string())) {
+                auto value_in_object = object->get_direct(megamorphic_entry->property_offset);
+                if (value_in_object.is_accessor())
+                    TRY(call(vm, value_in_object.as_accessor().setter(), this_value, value));
+                else
+                    object->put_direct(megamorphic_entry->property_offset, value);
+                return {};
+            }
+        }
+
         CacheablePropertyMetadata cacheable_metadata;
         bool succeeded = TRY(object->internal_set(name, value, this_value, &cacheable_metadata));
 
@@ -1273,6 +1356,9 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
         // that collected metadata is valid, e.g. if setter in prototype chain added
         // property with the same name into the object itself.
         if (succeeded && caches && &shape == &object->shape()) {
+            if (is_megamorphic && cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty)
+                vm.bytecode_interpreter().megamorphic_put_cache().insert(shape, name.as_string(), cacheable_metadata.property_offset.value());
+
             auto get_cache_slot = [&] -> PropertyLookupCache::Entry& {
                 for (size_t i = caches->entries.size() - 1; i >= 1; --i) {
                     caches->entries[i] = caches->entries[i - 1];
@@ -1388,13 +1474,10 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<FlyStri
         if (storage
             && storage->is_simple_storage()
             && !object.may_interfere_with_indexed_property_access()) {
-            auto maybe_value = storage->get(index);
-            if (maybe_value.has_value()) {
-                auto existing_value = maybe_value->value;
-                if (!existing_value.is_accessor()) {
-                    storage->put(index, value);
-                    return {};
-                }
+            auto& simple_storage = static_cast<SimpleIndexedPropertyStorage&>(*storage);
+            if (simple_storage.inline_has_index(index) && !simple_storage.elements()[index].is_accessor()) {
+                simple_storage.inline_set(index, value);
+                return {};
             }
         }
 
@@ -2797,7 +2880,7 @@ void GetImportMeta::execute_impl(Bytecode::Interpreter& interpreter) const
     interpreter.set(dst(), interpreter.vm().get_import_meta());
 }
 
-static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& interpreter, Bytecode::Builtin builtin, ReadonlySpan<Operand> arguments)
+static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& interpreter, Bytecode::Builtin builtin, Value this_value, ReadonlySpan<Operand> arguments)
 {
     switch (builtin) {
     case Builtin::MathAbs:
@@ -2826,6 +2909,20 @@ static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& int
         return TRY(MathObject::cos_impl(interpreter.vm(), interpreter.get(arguments[0])));
     case Builtin::MathTan:
         return TRY(MathObject::tan_impl(interpreter.vm(), interpreter.get(arguments[0])));
+    case Builtin::MathMax:
+        return TRY(MathObject::max_impl(interpreter.vm(), interpreter.get(arguments[0]), interpreter.get(arguments[1])));
+    case Builtin::MathMin:
+        return TRY(MathObject::min_impl(interpreter.vm(), interpreter.get(arguments[0]), interpreter.get(arguments[1])));
+    case Builtin::MathTrunc:
+        return TRY(MathObject::trunc_impl(interpreter.vm(), interpreter.get(arguments[0])));
+    case Builtin::MathSign:
+        return TRY(MathObject::sign_impl(interpreter.vm(), interpreter.get(arguments[0])));
+    case Builtin::StringPrototypeCharCodeAt:
+        return TRY(StringPrototype::char_code_at_impl(interpreter.vm(), this_value, interpreter.get(arguments[0])));
+    case Builtin::ArrayPrototypePush: {
+        auto item = interpreter.get(arguments[0]);
+        return TRY(ArrayPrototype::push_impl(interpreter.vm(), this_value, { &item, 1 }));
+    }
     case Builtin::ArrayIteratorPrototypeNext:
     case Builtin::MapIteratorPrototypeNext:
     case Builtin::SetIteratorPrototypeNext:
@@ -2850,7 +2947,24 @@ ThrowCompletionOr<void> Call::execute_impl(Bytecode::Interpreter& interpreter) c
     ExecutionContext* callee_context = nullptr;
     size_t registers_and_constants_and_locals_count = 0;
     size_t argument_count = m_argument_count;
-    TRY(function.get_stack_frame_size(registers_and_constants_and_locals_count, argument_count));
+
+    // OPTIMIZATION: Most call sites keep calling the same ECMAScript function. Once its stack frame size is known,
+    //               we can skip the (virtual) query, which also makes sure the function has been compiled.
+    auto& cache = interpreter.current_executable().call_caches[m_cache_index];
+    bool is_cached_ecmascript_function = cache.callee.ptr() == &function;
+    if (is_cached_ecmascript_function) {
+        registers_and_constants_and_locals_count = cache.registers_and_constants_and_locals_count;
+        argument_count = cache.argument_count;
+    } else {
+        TRY(function.get_stack_frame_size(registers_and_constants_and_locals_count, argument_count));
+        if (function.is_ecmascript_function_object()) {
+            cache.callee = function;
+            cache.registers_and_constants_and_locals_count = registers_and_constants_and_locals_count;
+            cache.argument_count = argument_count;
+            is_cached_ecmascript_function = true;
+        }
+    }
+
     ALLOCATE_EXECUTION_CONTEXT_ON_NATIVE_STACK_WITHOUT_CLEARING_ARGS(callee_context, registers_and_constants_and_locals_count, max(m_argument_count, argument_count));
 
     auto* callee_context_argument_values = callee_context->arguments.data();
@@ -2863,7 +2977,10 @@ ThrowCompletionOr<void> Call::execute_impl(Bytecode::Interpreter& interpreter) c
         callee_context_argument_values[i] = js_undefined();
     callee_context->passed_argument_count = insn_argument_count;
 
-    auto retval = TRY(function.internal_call(*callee_context, interpreter.get(m_this_value)));
+    // NOTE: ECMAScriptFunctionObject is final, so this lets the compiler call its [[Call]] directly.
+    auto retval = is_cached_ecmascript_function
+        ? TRY(static_cast<ECMAScriptFunctionObject&>(function).internal_call(*callee_context, interpreter.get(m_this_value)))
+        : TRY(function.internal_call(*callee_context, interpreter.get(m_this_value)));
     interpreter.set(m_dst, retval);
     return {};
 }
@@ -2901,7 +3018,7 @@ ThrowCompletionOr<void> CallBuiltin::execute_impl(Bytecode::Interpreter& interpr
     TRY(throw_if_needed_for_call(interpreter, callee, CallType::Call, expression_string()));
 
     if (m_argument_count == Bytecode::builtin_argument_count(m_builtin) && callee.is_object() && interpreter.realm().get_builtin_value(m_builtin) == &callee.as_object()) {
-        interpreter.set(dst(), TRY(dispatch_builtin_call(interpreter, m_builtin, { m_arguments, m_argument_count })));
+        interpreter.set(dst(), TRY(dispatch_builtin_call(interpreter, m_builtin, interpreter.get(m_this_value), { m_arguments, m_argument_count })));
 
         return {};
     }
@@ -84,6 +84,9 @@ public:
 
     ExecutionContext& running_execution_context() { return *m_running_execution_context; }
 
+    MegamorphicPropertyLookupCache& megamorphic_get_cache() { return m_megamorphic_get_cache; }
+    MegamorphicPropertyLookupCache& megamorphic_put_cache() { return m_megamorphic_put_cache; }
+
 private:
     void run_bytecode(size_t entry_point);
 
@@ -102,6 +105,8 @@ private:
     Span<Value> m_registers_and_constants_and_locals_arguments;
     Vector<Value> m_argument_values_buffer;
     ExecutionContext* m_running_execution_context { nullptr };
+    MegamorphicPropertyLookupCache m_megamorphic_get_cache;
+    MegamorphicPropertyLookupCache m_megamorphic_put_cache;
 };
 
 JS_API extern bool g_dump_bytecode;
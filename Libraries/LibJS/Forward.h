@@ -165,6 +165,7 @@ class Cell;
 class ClassExpression;
 struct ClassFieldDefinition;
 class Completion;
+class CompletionCell;
 class Console;
 class CyclicModule;
 class DeclarativeEnvironment;
@@ -209,6 +210,7 @@ class PropertyDescriptor;
 class PropertyKey;
 class Realm;
 class Reference;
+class SamplingProfiler;
 class ScopeNode;
 class Script;
 class Shape;
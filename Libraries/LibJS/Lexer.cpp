@@ -10,6 +10,7 @@
 #include <AK/Debug.h>
 #include <AK/GenericLexer.h>
 #include <AK/HashMap.h>
+#include <AK/SIMDExtras.h>
 #include <AK/Utf8View.h>
 #include <LibUnicode/CharacterTypes.h>
 #include <stdio.h>
@@ -366,6 +367,76 @@ void Lexer::consume()
     m_current_char = m_source[m_position++];
 }
 
+// Returns the index of the first character at or after start that is either one of the stop characters or not ASCII,
+// comparing a whole vector of characters at a time.
+template<typename... StopCharacters>
+static size_t find_end_of_ascii_run(StringView source, size_t start, StopCharacters... stop_characters)
+{
+    using VectorType = AK::SIMD::u8x16;
+    static constexpr size_t lane_count = AK::SIMD::vector_length<VectorType>;
+
+    auto const* characters = reinterpret_cast<u8 const*>(source.characters_without_null_termination());
+
+    size_t index = start;
+    for (; index + lane_count <= source.length(); index += lane_count) {
+        auto chunk = AK::SIMD::load_unaligned<VectorType>(characters + index);
+        auto stops = reinterpret_cast<VectorType>(chunk >= 0x80);
+        ((stops |= reinterpret_cast<VectorType>(chunk == static_cast<u8>(stop_characters))), ...);
+
+        static_assert(sizeof(VectorType) == 2 * sizeof(u64));
+        u64 words[2];
+        __builtin_memcpy(words, &stops, sizeof(VectorType));
+        if ((words[0] | words[1]) == 0)
+            continue;
+
+        for (size_t lane = 0; lane < lane_count; ++lane) {
+            if (stops[lane])
+                return index + lane;
+        }
+    }
+
+    for (; index < source.length(); ++index) {
+        auto character = characters[index];
+        if (character >= 0x80 || ((character == static_cast<u8>(stop_characters)) || ...))
+            return index;
+    }
+    return index;
+}
+
+// Consumes every character up to (but not including) the one at the given index into the source. The characters in
+// between must all be ASCII and not be line terminators, so that only the column needs to be updated.
+void Lexer::consume_ascii_run_until(size_t end)
+{
+    if (m_eof)
+        return;
+
+    auto current_index = m_position - 1;
+    if (end <= current_index)
+        return;
+
+    m_line_column += end - current_index - 1;
+    m_position = end;
+    m_current_char = m_source[end - 1];
+    consume();
+}
+
+// Like consume(), but also consumes the ASCII characters following the current one, up to the next line terminator or
+// stop character. It's meant for the bodies of comments and strings, which tend to be long runs of plain ASCII.
+template<typename... StopCharacters>
+void Lexer::consume_ascii_run(StopCharacters... stop_characters)
+{
+    if (m_eof)
+        return;
+
+    auto current_index = m_position - 1;
+    auto end = find_end_of_ascii_run(m_source, current_index, '\n', '\r', stop_characters...);
+    if (end == current_index) {
+        consume();
+        return;
+    }
+    consume_ascii_run_until(end);
+}
+
 bool Lexer::consume_decimal_number()
 {
     if (!is_ascii_digit(m_current_char))
@@ -661,18 +732,26 @@ Token Lexer::next()
                 } while (is_line_terminator());
             } else if (is_whitespace()) {
                 do {
-                    consume();
+                    // OPTIMIZATION: Skip over runs of spaces and tabs, such as indentation, all at once.
+                    if (m_current_char == ' ' || m_current_char == '\t') {
+                        auto end = m_position;
+                        while (end < m_source.length() && (m_source[end] == ' ' || m_source[end] == '\t'))
+                            ++end;
+                        consume_ascii_run_until(end);
+                    } else {
+                        consume();
+                    }
                 } while (is_whitespace());
             } else if (is_line_comment_start(line_has_token_yet)) {
                 consume();
                 do {
-                    consume();
+                    consume_ascii_run();
                 } while (!is_eof() && !is_line_terminator());
             } else if (is_block_comment_start()) {
                 size_t start_line_number = m_line_number;
                 consume();
                 do {
-                    consume();
+                    consume_ascii_run('*');
                 } while (!is_eof() && !is_block_comment_end());
                 if (is_eof())
                     unterminated_comment = true;
@@ -777,19 +856,30 @@ Token Lexer::next()
         }
     } else if (auto code_point = is_identifier_start(identifier_length); code_point.has_value()) {
         bool has_escaped_character = false;
-        // identifier or keyword
-        StringBuilder builder;
-        do {
-            builder.append_code_point(*code_point);
-            for (size_t i = 0; i < identifier_length; ++i)
-                consume();
 
-            has_escaped_character |= identifier_length > 1;
+        // OPTIMIZATION: Most identifiers are plain ASCII without escapes, which we can take straight from the source.
+        auto ascii_identifier_end = m_position - 1;
+        while (ascii_identifier_end < m_source.length() && (is_ascii_alphanumeric(m_source[ascii_identifier_end]) || m_source[ascii_identifier_end] == '_' || m_source[ascii_identifier_end] == '$'))
+            ++ascii_identifier_end;
 
-            code_point = is_identifier_middle(identifier_length);
-        } while (code_point.has_value());
+        if (identifier_length == 1 && (ascii_identifier_end == m_source.length() || (is_ascii(m_source[ascii_identifier_end]) && m_source[ascii_identifier_end] != '\\'))) {
+            identifier = FlyString::from_utf8_without_validation(m_source.substring_view(m_position - 1, ascii_identifier_end - m_position + 1).bytes());
+            consume_ascii_run_until(ascii_identifier_end);
+        } else {
+            // identifier or keyword
+            StringBuilder builder;
+            do {
+                builder.append_code_point(*code_point);
+                for (size_t i = 0; i < identifier_length; ++i)
+                    consume();
+
+                has_escaped_character |= identifier_length > 1;
+
+                code_point = is_identifier_middle(identifier_length);
+            } while (code_point.has_value());
 
-        identifier = builder.to_string_without_validation();
+            identifier = builder.to_string_without_validation();
+        }
         m_parsed_identifiers->identifiers.set(*identifier);
 
         auto it = s_keywords.find(identifier->hash(), [&](auto& entry) { return entry.key == identifier; });
@@ -877,7 +967,7 @@ Token Lexer::next()
                     consume();
                 }
             }
-            consume();
+            consume_ascii_run(stop_char, '\\');
         }
         if (m_current_char != stop_char) {
             token_type = TokenType::UnterminatedStringLiteral;
@@ -31,6 +31,9 @@ public:
 
 private:
     void consume();
+    template<typename... StopCharacters>
+    void consume_ascii_run(StopCharacters...);
+    void consume_ascii_run_until(size_t end);
     bool consume_exponent();
     bool consume_octal_number();
     bool consume_hexadecimal_number();
@@ -299,34 +299,48 @@ ThrowCompletionOr<Optional<PropertyDescriptor>> Array::internal_get_own_property
     return Object::internal_get_own_property(property_key);
 }
 
-ThrowCompletionOr<bool> Array::internal_set(PropertyKey const& property_key, Value value, Value receiver, CacheablePropertyMetadata* cacheable_metadata, PropertyLookupPhase phase)
+bool Array::default_prototype_chain_intact() const
 {
-    auto& vm = this->vm();
+    auto const& intrinsics = m_realm->intrinsics();
+    auto const* array_prototype = shape().prototype();
+    if (!array_prototype)
+        return false;
+    if (!array_prototype->indexed_properties().is_empty())
+        return false;
+    auto const& array_prototype_shape = array_prototype->shape();
+    if (intrinsics.default_array_prototype_shape().ptr() != &array_prototype_shape)
+        return false;
 
-    auto default_prototype_chain_intact = [&] {
-        auto const& intrinsics = m_realm->intrinsics();
-        auto* array_prototype = shape().prototype();
-        if (!array_prototype)
-            return false;
-        if (!array_prototype->indexed_properties().is_empty())
-            return false;
-        auto& array_prototype_shape = shape().prototype()->shape();
-        if (intrinsics.default_array_prototype_shape().ptr() != &array_prototype_shape)
-            return false;
+    auto const* object_prototype = array_prototype_shape.prototype();
+    if (!object_prototype)
+        return false;
+    if (!object_prototype->indexed_properties().is_empty())
+        return false;
+    auto const& object_prototype_shape = object_prototype->shape();
+    if (intrinsics.default_object_prototype_shape().ptr() != &object_prototype_shape)
+        return false;
+    if (object_prototype_shape.prototype())
+        return false;
 
-        auto* object_prototype = array_prototype_shape.prototype();
-        if (!object_prototype)
-            return false;
-        if (!object_prototype->indexed_properties().is_empty())
-            return false;
-        auto& object_prototype_shape = array_prototype_shape.prototype()->shape();
-        if (intrinsics.default_object_prototype_shape().ptr() != &object_prototype_shape)
-            return false;
-        if (object_prototype_shape.prototype())
-            return false;
+    return true;
+}
 
-        return true;
-    };
+bool Array::try_fast_append(Value value)
+{
+    if (m_is_proxy_target || !m_is_extensible || !m_length_writable || may_interfere_with_indexed_property_access())
+        return false;
+    if (indexed_properties().array_like_size() >= NumericLimits<u32>::max())
+        return false;
+    if (!default_prototype_chain_intact())
+        return false;
+
+    indexed_properties().append(value);
+    return true;
+}
+
+ThrowCompletionOr<bool> Array::internal_set(PropertyKey const& property_key, Value value, Value receiver, CacheablePropertyMetadata* cacheable_metadata, PropertyLookupPhase phase)
+{
+    auto& vm = this->vm();
 
     VERIFY(receiver.is_object());
     auto& receiver_object = receiver.as_object();
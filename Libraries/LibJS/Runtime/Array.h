@@ -58,6 +58,10 @@ public:
 
     void set_is_proxy_target(bool is_proxy_target) { m_is_proxy_target = is_proxy_target; }
 
+    // Appends a value at index [[length]] if that can't be observed (no proxy, setters or frozen length in the way).
+    // Returns false without doing anything otherwise, in which case the caller has to take the generic path.
+    bool try_fast_append(Value);
+
     virtual void visit_edges(Cell::Visitor& visitor) override;
 
 protected:
@@ -67,6 +71,7 @@ private:
     virtual bool is_array_exotic_object() const final { return true; }
 
     ThrowCompletionOr<bool> set_length(PropertyDescriptor const&);
+    bool default_prototype_chain_intact() const;
 
     GC::Ref<Realm> m_realm;
     bool m_length_writable { true };
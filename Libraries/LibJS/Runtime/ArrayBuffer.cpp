@@ -52,6 +52,14 @@ void ArrayBuffer::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_detach_key);
 }
 
+ErrorOr<ByteBuffer> ArrayBuffer::take_or_copy_data()
+{
+    return m_data_block.byte_buffer.visit(
+        [](Empty) -> ErrorOr<ByteBuffer> { VERIFY_NOT_REACHED(); },
+        [](ByteBuffer& buffer) -> ErrorOr<ByteBuffer> { return move(buffer); },
+        [](ByteBuffer* buffer) -> ErrorOr<ByteBuffer> { return ByteBuffer::copy(buffer->bytes()); });
+}
+
 // 6.2.9.1 CreateByteDataBlock ( size ), https://tc39.es/ecma262/#sec-createbytedatablock
 ThrowCompletionOr<DataBlock> create_byte_data_block(VM& vm, size_t size)
 {
@@ -259,6 +267,21 @@ ThrowCompletionOr<void> detach_array_buffer(VM& vm, ArrayBuffer& array_buffer, O
     return {};
 }
 
+// NON-STANDARD: Performs DetachArrayBuffer(arrayBuffer), but hands the [[ArrayBufferData]] over to the caller instead of
+//               dropping it. This lets a transfer of the buffer avoid copying its contents.
+ThrowCompletionOr<ByteBuffer> detach_array_buffer_and_take_data(VM& vm, ArrayBuffer& array_buffer)
+{
+    VERIFY(!array_buffer.is_shared_array_buffer());
+
+    // NOTE: Check the detach key up front, so that a buffer that can't be detached keeps its data.
+    if (!same_value(array_buffer.detach_key(), js_undefined()))
+        return vm.throw_completion<TypeError>(ErrorType::DetachKeyMismatch, js_undefined(), array_buffer.detach_key());
+
+    auto data = TRY_OR_THROW_OOM(vm, array_buffer.take_or_copy_data());
+    MUST(detach_array_buffer(vm, array_buffer));
+    return data;
+}
+
 // 25.1.3.6 CloneArrayBuffer ( srcBuffer, srcByteOffset, srcLength, cloneConstructor ), https://tc39.es/ecma262/#sec-clonearraybuffer
 ThrowCompletionOr<ArrayBuffer*> clone_array_buffer(VM& vm, ArrayBuffer& source_buffer, size_t source_byte_offset, size_t source_length)
 {
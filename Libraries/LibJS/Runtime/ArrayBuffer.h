@@ -83,6 +83,10 @@ public:
 
     void detach_buffer() { m_data_block.byte_buffer = Empty {}; }
 
+    // Moves the data out of the data block if this buffer owns it, and copies it otherwise. The buffer is left without
+    // any data, so this has to be followed by detaching it.
+    ErrorOr<ByteBuffer> take_or_copy_data();
+
     // 25.1.3.4 IsDetachedBuffer ( arrayBuffer ), https://tc39.es/ecma262/#sec-isdetachedbuffer
     bool is_detached() const
     {
@@ -150,6 +154,7 @@ JS_API void copy_data_block_bytes(ByteBuffer& to_block, u64 to_index, ByteBuffer
 JS_API ThrowCompletionOr<ArrayBuffer*> allocate_array_buffer(VM&, FunctionObject& constructor, size_t byte_length, Optional<size_t> const& max_byte_length = {});
 JS_API ThrowCompletionOr<ArrayBuffer*> array_buffer_copy_and_detach(VM&, ArrayBuffer& array_buffer, Value new_length, PreserveResizability preserve_resizability);
 JS_API ThrowCompletionOr<void> detach_array_buffer(VM&, ArrayBuffer& array_buffer, Optional<Value> key = {});
+JS_API ThrowCompletionOr<ByteBuffer> detach_array_buffer_and_take_data(VM&, ArrayBuffer& array_buffer);
 JS_API ThrowCompletionOr<Optional<size_t>> get_array_buffer_max_byte_length_option(VM&, Value options);
 JS_API ThrowCompletionOr<ArrayBuffer*> clone_array_buffer(VM&, ArrayBuffer& source_buffer, size_t source_byte_offset, size_t source_length);
 JS_API ThrowCompletionOr<GC::Ref<ArrayBuffer>> allocate_shared_array_buffer(VM&, FunctionObject& constructor, size_t byte_length);
@@ -63,7 +63,7 @@ void ArrayPrototype::initialize(Realm& realm)
     define_native_function(realm, vm.names.lastIndexOf, last_index_of, 1, attr);
     define_native_function(realm, vm.names.map, map, 1, attr);
     define_native_function(realm, vm.names.pop, pop, 0, attr);
-    define_native_function(realm, vm.names.push, push, 1, attr);
+    define_native_function(realm, vm.names.push, push, 1, attr, Bytecode::Builtin::ArrayPrototypePush);
     define_native_function(realm, vm.names.reduce, reduce, 1, attr);
     define_native_function(realm, vm.names.reduceRight, reduce_right, 1, attr);
     define_native_function(realm, vm.names.reverse, reverse, 0, attr);
@@ -719,6 +719,26 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::for_each)
     return js_undefined();
 }
 
+// OPTIMIZATION: The search functions below can scan simple indexed storage directly if it has no holes in the
+//               searched range, since comparing elements has no observable side effects that could modify it.
+static SimpleIndexedPropertyStorage const* packed_storage_for_search(Object const& object, size_t length)
+{
+    if (object.may_interfere_with_indexed_property_access())
+        return nullptr;
+    auto const* storage = object.indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage())
+        return nullptr;
+    auto const& simple_storage = static_cast<SimpleIndexedPropertyStorage const&>(*storage);
+    if (simple_storage.has_empty_elements() || simple_storage.array_like_size() < length)
+        return nullptr;
+    return &simple_storage;
+}
+
+static bool has_only_numbers(SimpleIndexedPropertyStorage const& storage)
+{
+    return storage.element_kind() != SimpleIndexedPropertyStorage::ElementKind::Any;
+}
+
 // 23.1.3.16 Array.prototype.includes ( searchElement [ , fromIndex ] ), https://tc39.es/ecma262/#sec-array.prototype.includes
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
 {
@@ -742,6 +762,28 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    if (auto const* storage = packed_storage_for_search(this_object, length)) {
+        auto elements = storage->elements().span().slice(0, length);
+        if (has_only_numbers(*storage)) {
+            if (!value_to_find.is_number())
+                return Value(false);
+            auto number_to_find = value_to_find.as_double();
+            bool find_nan = isnan(number_to_find);
+            for (u64 i = from_index; i < length; ++i) {
+                auto number = elements[i].as_double();
+                if (number == number_to_find || (find_nan && isnan(number)))
+                    return Value(true);
+            }
+            return Value(false);
+        }
+        for (u64 i = from_index; i < length; ++i) {
+            if (same_value_zero(elements[i], value_to_find))
+                return Value(true);
+        }
+        return Value(false);
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -795,6 +837,25 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    if (auto const* storage = packed_storage_for_search(object, length)) {
+        auto elements = storage->elements().span().slice(0, length);
+        if (has_only_numbers(*storage)) {
+            if (!search_element.is_number())
+                return Value(-1);
+            auto number_to_find = search_element.as_double();
+            for (; k < length; ++k) {
+                if (elements[k].as_double() == number_to_find)
+                    return Value(k);
+            }
+            return Value(-1);
+        }
+        for (; k < length; ++k) {
+            if (is_strictly_equal(search_element, elements[k]))
+                return Value(k);
+        }
+        return Value(-1);
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -906,6 +967,25 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::last_index_of)
         k = (double)length + n;
     }
 
+    if (auto const* storage = packed_storage_for_search(object, length)) {
+        auto elements = storage->elements().span().slice(0, length);
+        if (has_only_numbers(*storage)) {
+            if (!search_element.is_number())
+                return Value(-1);
+            auto number_to_find = search_element.as_double();
+            for (; k >= 0; --k) {
+                if (elements[k].as_double() == number_to_find)
+                    return Value((size_t)k);
+            }
+            return Value(-1);
+        }
+        for (; k >= 0; --k) {
+            if (is_strictly_equal(search_element, elements[k]))
+                return Value((size_t)k);
+        }
+        return Value(-1);
+    }
+
     // 8. Repeat, while k ≥ 0,
     for (; k >= 0; --k) {
         auto property_key = PropertyKey { k };
@@ -997,21 +1077,33 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::pop)
 }
 
 // 23.1.3.23 Array.prototype.push ( ...items ), https://tc39.es/ecma262/#sec-array.prototype.push
-JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::push)
+ThrowCompletionOr<Value> ArrayPrototype::push_impl(VM& vm, Value this_value, ReadonlySpan<Value> items)
 {
-    auto this_object = TRY(vm.this_value().to_object(vm));
+    // OPTIMIZATION: Pushing a single value onto a plain array can be done without going through [[Set]] twice.
+    if (items.size() == 1 && this_value.is_object() && is<Array>(this_value.as_object())) {
+        auto& array = static_cast<Array&>(this_value.as_object());
+        if (array.try_fast_append(items[0]))
+            return Value(array.indexed_properties().array_like_size());
+    }
+
+    auto this_object = TRY(this_value.to_object(vm));
     auto length = TRY(length_of_array_like(vm, this_object));
-    auto argument_count = vm.argument_count();
+    auto argument_count = items.size();
     auto new_length = length + argument_count;
     if (new_length > MAX_ARRAY_LIKE_INDEX)
         return vm.throw_completion<TypeError>(ErrorType::ArrayMaxSize);
     for (size_t i = 0; i < argument_count; ++i)
-        TRY(this_object->set(length + i, vm.argument(i), Object::ShouldThrowExceptions::Yes));
+        TRY(this_object->set(length + i, items[i], Object::ShouldThrowExceptions::Yes));
     auto new_length_value = Value(new_length);
     TRY(this_object->set(vm.names.length, new_length_value, Object::ShouldThrowExceptions::Yes));
     return new_length_value;
 }
 
+JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::push)
+{
+    return push_impl(vm, vm.this_value(), vm.running_execution_context().arguments);
+}
+
 // 23.1.3.24 Array.prototype.reduce ( callbackfn [ , initialValue ] ), https://tc39.es/ecma262/#sec-array.prototype.reduce
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::reduce)
 {
@@ -5,6 +5,7 @@
  */
 
 #include <AK/TypeCasts.h>
+#include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/AsyncFunctionDriverWrapper.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/NativeFunction.h>
@@ -109,7 +110,25 @@ ThrowCompletionOr<void> AsyncFunctionDriverWrapper::await(JS::Value value)
 
     // 7. Perform PerformPromiseThen(promise, onFulfilled, onRejected).
     m_current_promise = as<Promise>(promise_object);
-    m_current_promise->perform_then(m_on_fulfilled, m_on_rejected, {});
+
+    // OPTIMIZATION: Awaiting an already settled promise (including any non-promise value) is very common. In that case,
+    //               PerformPromiseThen would create a pair of reactions and job callbacks only to immediately enqueue a
+    //               job for one of them. We enqueue a job that calls the right closure directly instead, which is
+    //               indistinguishable as nobody else can observe the reactions.
+    if (auto state = m_current_promise->state(); state != Promise::State::Pending) {
+        auto handler = state == Promise::State::Fulfilled ? m_on_fulfilled : m_on_rejected;
+
+        if (state == Promise::State::Rejected && !m_current_promise->is_handled())
+            vm.host_promise_rejection_tracker(*m_current_promise, Promise::RejectionOperation::Handle);
+        m_current_promise->set_is_handled();
+
+        auto job = GC::create_function(vm.heap(), [&vm, handler = GC::Ref { *handler }, argument = m_current_promise->result()]() -> ThrowCompletionOr<Value> {
+            return call(vm, Value { handler }, js_undefined(), argument);
+        });
+        vm.host_enqueue_promise_job(job, handler->realm());
+    } else {
+        m_current_promise->perform_then(m_on_fulfilled, m_on_rejected, {});
+    }
 
     // NOTE: None of these are necessary. 8-12 are handled by step d of the above lambdas.
     // 8. Remove asyncContext from the execution context stack and restore the execution context that is at the top of the
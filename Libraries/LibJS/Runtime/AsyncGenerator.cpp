@@ -48,6 +48,7 @@ void AsyncGenerator::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_generating_function);
     visitor.visit(m_previous_value);
     visitor.visit(m_current_promise);
+    visitor.visit(m_completion_cell);
     m_async_generator_context->visit_edges(visitor);
 }
 
@@ -176,7 +177,11 @@ void AsyncGenerator::execute(VM& vm, Completion completion)
             return false;
         };
 
-        auto completion_cell = heap().allocate<CompletionCell>(completion);
+        // NOTE: The bytecode only reads the completion right after resuming, so one cell serves every resumption.
+        if (m_completion_cell)
+            m_completion_cell->set_completion(completion);
+        else
+            m_completion_cell = heap().allocate<CompletionCell>(completion);
 
         auto& bytecode_interpreter = vm.bytecode_interpreter();
 
@@ -185,7 +190,7 @@ void AsyncGenerator::execute(VM& vm, Completion completion)
         // We should never enter `execute` again after the generator is complete.
         VERIFY(continuation_address.has_value());
 
-        auto next_result = bytecode_interpreter.run_executable(*m_generating_function->bytecode_executable(), continuation_address, completion_cell);
+        auto next_result = bytecode_interpreter.run_executable(*m_generating_function->bytecode_executable(), continuation_address, m_completion_cell);
 
         auto result_value = move(next_result.value);
         if (!result_value.is_throw_completion()) {
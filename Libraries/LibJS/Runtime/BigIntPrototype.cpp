@@ -90,10 +90,14 @@ JS_DEFINE_NATIVE_FUNCTION(BigIntPrototype::to_locale_string)
     auto bigint = TRY(this_bigint_value(vm, vm.this_value()));
 
     // 2. Let numberFormat be ? Construct(%NumberFormat%, « locales, options »).
-    auto* number_format = static_cast<Intl::NumberFormat*>(TRY(construct(vm, realm.intrinsics().intl_number_format_constructor(), locales, options)).ptr());
+    // OPTIMIZATION: We reuse recently constructed NumberFormats whenever doing so is indistinguishable from constructing
+    //               a new one.
+    auto number_format = TRY(realm.intrinsics().number_format_cache().get_or_create(Intl::ObjectCacheKey::for_arguments(locales, options), [&]() -> ThrowCompletionOr<GC::Ref<Intl::NumberFormat>> {
+        return as<Intl::NumberFormat>(*TRY(construct(vm, realm.intrinsics().intl_number_format_constructor(), locales, options)));
+    }));
 
     // 3. Return ? FormatNumeric(numberFormat, x).
-    auto formatted = Intl::format_numeric(*number_format, Value(bigint));
+    auto formatted = Intl::format_numeric(number_format, Value(bigint));
     return PrimitiveString::create(vm, move(formatted));
 }
 
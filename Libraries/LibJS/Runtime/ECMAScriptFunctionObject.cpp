@@ -143,7 +143,7 @@ GC::Ref<ECMAScriptFunctionObject> ECMAScriptFunctionObject::create_from_function
 }
 
 SharedFunctionInstanceData::SharedFunctionInstanceData(
-    VM& vm,
+    VM&,
     FunctionKind kind,
     FlyString name,
     i32 function_length,
@@ -166,6 +166,7 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
     , m_contains_direct_call_to_eval(parsing_insights.contains_direct_call_to_eval)
     , m_is_arrow_function(is_arrow_function)
     , m_uses_this(parsing_insights.uses_this)
+    , m_uses_this_from_environment(parsing_insights.uses_this_from_environment)
 {
     if (m_is_arrow_function)
         m_this_mode = ThisMode::Lexical;
@@ -184,6 +185,12 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
             return false;
         return true;
     });
+}
+
+void SharedFunctionInstanceData::compute_function_declaration_instantiation_data(VM& vm)
+{
+    VERIFY(!m_has_function_declaration_instantiation_data);
+    m_has_function_declaration_instantiation_data = true;
 
     // NOTE: The following steps are from FunctionDeclarationInstantiation that could be executed once
     //       and then reused in all subsequent function instantiations.
@@ -277,7 +284,7 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
 
     size_t parameter_environment_bindings_count = 0;
     // 19. If strict is true or hasParameterExpressions is false, then
-    if (strict || !m_has_parameter_expressions) {
+    if (m_strict || !m_has_parameter_expressions) {
         // a. NOTE: Only a single Environment Record is needed for the parameters, since calls to eval in strict mode code cannot create new bindings which are visible outside of the eval.
         // b. Let env be the LexicalEnvironment of calleeContext
         // NOTE: Here we are only interested in the size of the environment.
@@ -414,7 +421,7 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
         }));
     }
 
-    m_function_environment_needed = arguments_object_needs_binding || m_function_environment_bindings_count > 0 || m_var_environment_bindings_count > 0 || m_lex_environment_bindings_count > 0 || parsing_insights.uses_this_from_environment || m_contains_direct_call_to_eval;
+    m_function_environment_needed = arguments_object_needs_binding || m_function_environment_bindings_count > 0 || m_var_environment_bindings_count > 0 || m_lex_environment_bindings_count > 0 || m_uses_this_from_environment || m_contains_direct_call_to_eval;
 }
 
 ECMAScriptFunctionObject::ECMAScriptFunctionObject(
@@ -483,6 +490,7 @@ void ECMAScriptFunctionObject::initialize(Realm& realm)
 
 ThrowCompletionOr<void> ECMAScriptFunctionObject::get_stack_frame_size(size_t& registers_and_constants_and_locals_count, size_t& argument_count)
 {
+    const_cast<SharedFunctionInstanceData&>(shared_data()).ensure_function_declaration_instantiation_data(vm());
     if (!m_bytecode_executable) {
         if (!ecmascript_code().bytecode_executable()) {
             if (is_module_wrapper()) {
@@ -548,6 +556,7 @@ ThrowCompletionOr<GC::Ref<Object>> ECMAScriptFunctionObject::internal_construct(
 {
     auto& vm = this->vm();
 
+    const_cast<SharedFunctionInstanceData&>(shared_data()).ensure_function_declaration_instantiation_data(vm);
     if (!m_bytecode_executable) {
         if (!ecmascript_code().bytecode_executable()) {
             if (is_module_wrapper()) {
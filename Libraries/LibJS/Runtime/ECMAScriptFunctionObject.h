@@ -48,6 +48,14 @@ public:
         FunctionParsingInsights const&,
         Vector<LocalVariable> local_variables_names);
 
+    // The parts of FunctionDeclarationInstantiation that only depend on the code are computed once and shared by all
+    // instances. This walks the entire function body, so we wait until the function is actually called for the first time.
+    ALWAYS_INLINE void ensure_function_declaration_instantiation_data(VM& vm)
+    {
+        if (!m_has_function_declaration_instantiation_data) [[unlikely]]
+            compute_function_declaration_instantiation_data(vm);
+    }
+
     RefPtr<FunctionParameters const> m_formal_parameters; // [[FormalParameters]]
     RefPtr<Statement const> m_ecmascript_code;            // [[ECMAScriptCode]]
 
@@ -85,6 +93,8 @@ public:
     bool m_arguments_object_needed { false };
     bool m_function_environment_needed { false };
     bool m_uses_this { false };
+    bool m_uses_this_from_environment { false };
+    bool m_has_function_declaration_instantiation_data { false };
     Vector<VariableNameToInitialize> m_var_names_to_initialize_binding;
     Vector<FlyString> m_function_names_to_initialize_binding;
 
@@ -95,6 +105,9 @@ public:
     Variant<PropertyKey, PrivateName, Empty> m_class_field_initializer_name; // [[ClassFieldInitializerName]]
     ConstructorKind m_constructor_kind : 1 { ConstructorKind::Base };        // [[ConstructorKind]]
     bool m_is_class_constructor : 1 { false };                               // [[IsClassConstructor]]
+
+private:
+    void compute_function_declaration_instantiation_data(VM&);
 };
 
 // 10.2 ECMAScript Function Objects, https://tc39.es/ecma262/#sec-ecmascript-function-objects
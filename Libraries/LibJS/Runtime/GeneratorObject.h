@@ -55,6 +55,11 @@ private:
     NonnullOwnPtr<ExecutionContext> m_execution_context;
     GC::Ptr<ECMAScriptFunctionObject> m_generating_function;
     Value m_previous_value;
+
+    // The completion we're resumed with is handed to the bytecode in this cell, which is reused across resumptions as
+    // the bytecode only reads it right after resuming.
+    GC::Ptr<CompletionCell> m_completion_cell;
+
     GeneratorState m_generator_state { GeneratorState::SuspendedStart };
     Optional<StringView> m_generator_brand;
 };
@@ -17,6 +17,8 @@ SimpleIndexedPropertyStorage::SimpleIndexedPropertyStorage(Vector<Value>&& initi
     : IndexedPropertyStorage(IsSimpleStorage::Yes, initial_values.size())
     , m_packed_elements(move(initial_values))
 {
+    for (auto value : m_packed_elements)
+        widen_element_kind_if_needed(value);
 }
 
 bool SimpleIndexedPropertyStorage::has_index(u32 index) const
@@ -59,6 +61,7 @@ void SimpleIndexedPropertyStorage::put(u32 index, Value value, PropertyAttribute
     if (value.is_special_empty_value()) {
         ++m_number_of_empty_elements;
     }
+    widen_element_kind_if_needed(value);
 }
 
 void SimpleIndexedPropertyStorage::remove(u32 index)
@@ -74,6 +77,8 @@ ValueAndAttributes SimpleIndexedPropertyStorage::take_first()
         --m_number_of_empty_elements;
     }
     m_array_size--;
+    if (m_array_size == 0)
+        m_element_kind = ElementKind::Int32;
     return { m_packed_elements.take_first(), default_attributes };
 }
 
@@ -85,6 +90,8 @@ ValueAndAttributes SimpleIndexedPropertyStorage::take_last()
         --m_number_of_empty_elements;
     }
     m_packed_elements[m_array_size] = js_special_empty_value();
+    if (m_array_size == 0)
+        m_element_kind = ElementKind::Int32;
     return { last_element, default_attributes };
 }
 
@@ -96,6 +103,8 @@ bool SimpleIndexedPropertyStorage::set_array_like_size(size_t new_size)
     auto old_size = m_array_size;
     m_array_size = new_size;
     m_packed_elements.resize_with_default_value_and_keep_capacity(new_size, js_special_empty_value());
+    if (m_array_size == 0)
+        m_element_kind = ElementKind::Int32;
 
     if (old_size <= m_array_size) {
         m_number_of_empty_elements += m_array_size - old_size;
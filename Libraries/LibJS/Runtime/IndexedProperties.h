@@ -92,15 +92,40 @@ public:
         return ValueAndAttributes { m_packed_elements.data()[index], default_attributes };
     }
 
+    // Overwrites an element that is known to be present, skipping the bookkeeping put() does for holes and growth.
+    void inline_set(u32 index, Value value)
+    {
+        ASSERT(inline_has_index(index));
+        m_packed_elements.data()[index] = value;
+        widen_element_kind_if_needed(value);
+    }
+
     bool has_empty_elements() const { return m_number_of_empty_elements.value() > 0; }
 
+    // The most specific kind of value every (non-empty) element is known to have. This only ever widens while the
+    // storage holds elements, so code that checks it once can rely on it until it runs something observable.
+    enum class ElementKind : u8 {
+        Int32,
+        Number,
+        Any,
+    };
+    ElementKind element_kind() const { return m_element_kind; }
+
 private:
     friend GenericIndexedPropertyStorage;
 
     void grow_storage_if_needed();
 
+    void widen_element_kind_if_needed(Value value)
+    {
+        if (m_element_kind == ElementKind::Any || value.is_int32() || value.is_special_empty_value())
+            return;
+        m_element_kind = value.is_number() ? ElementKind::Number : ElementKind::Any;
+    }
+
     Checked<size_t> m_number_of_empty_elements { 0 };
     Vector<Value> m_packed_elements;
+    ElementKind m_element_kind { ElementKind::Int32 };
 };
 
 class JS_API GenericIndexedPropertyStorage final : public IndexedPropertyStorage {
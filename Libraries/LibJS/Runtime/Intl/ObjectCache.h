@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibJS/Runtime/Completion.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/Value.h>
+
+namespace JS::Intl {
+
+struct ObjectCacheKey {
+    // Constructing an Intl object has no observable side effects when it is given no options, and either no locales or
+    // a single locale string. Such an object only depends on that locale (and the host's defaults), so it can be shared.
+    static Optional<ObjectCacheKey> for_arguments(Value locales, Value options)
+    {
+        if (!options.is_undefined())
+            return {};
+        if (locales.is_undefined())
+            return ObjectCacheKey {};
+        if (locales.is_string())
+            return ObjectCacheKey { locales.as_string().utf8_string() };
+        return {};
+    }
+
+    bool operator==(ObjectCacheKey const&) const = default;
+
+    Optional<String> locale;
+
+    // Anything besides the locale that the object depends on, such as the time zone of a DateTimeFormat.
+    Optional<String> context;
+};
+
+// The locale-sensitive methods of Number, BigInt, Date and String construct an Intl object on every call, and with it
+// an ICU formatter or collator. This holds on to the objects that were used most recently, so that calls which would
+// construct an identical object can use one of those instead.
+template<typename T, size_t capacity = 8>
+class ObjectCache {
+public:
+    template<typename Callback>
+    ThrowCompletionOr<GC::Ref<T>> get_or_create(Optional<ObjectCacheKey> key, Callback&& create)
+    {
+        if (!key.has_value())
+            return create();
+
+        for (size_t i = 0; i < m_entries.size(); ++i) {
+            if (m_entries[i].key != *key)
+                continue;
+
+            if (i != 0)
+                m_entries.prepend(m_entries.take(i));
+            return m_entries.first().object;
+        }
+
+        auto object = TRY(create());
+
+        if (m_entries.size() == capacity)
+            m_entries.take_last();
+        m_entries.prepend({ key.release_value(), object });
+
+        return object;
+    }
+
+    void visit_edges(Cell::Visitor& visitor)
+    {
+        for (auto& entry : m_entries)
+            visitor.visit(entry.object);
+    }
+
+private:
+    struct Entry {
+        ObjectCacheKey key;
+        GC::Ref<T> object;
+    };
+
+    // Ordered from the most to the least recently used.
+    Vector<Entry, capacity> m_entries;
+};
+
+}
@@ -479,15 +479,11 @@ void Intrinsics::visit_edges(Visitor& visitor)
     JS_ENUMERATE_ITERATOR_PROTOTYPES
 #undef __JS_ENUMERATE
 
-    visitor.visit(m_default_collator);
-}
-
-GC::Ref<Intl::Collator> Intrinsics::default_collator()
-{
-    if (!m_default_collator) {
-        m_default_collator = as<Intl::Collator>(*MUST(construct(this->vm(), intl_collator_constructor(), js_undefined(), js_undefined())));
-    }
-    return *m_default_collator;
+    m_collator_cache.visit_edges(visitor);
+    m_number_format_cache.visit_edges(visitor);
+    m_date_format_cache.visit_edges(visitor);
+    m_time_format_cache.visit_edges(visitor);
+    m_date_time_format_cache.visit_edges(visitor);
 }
 
 // 10.2.4 AddRestrictedFunctionProperties ( F, realm ), https://tc39.es/ecma262/#sec-addrestrictedfunctionproperties
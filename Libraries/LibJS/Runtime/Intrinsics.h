@@ -10,6 +10,7 @@
 #include <LibGC/CellAllocator.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
+#include <LibJS/Runtime/Intl/ObjectCache.h>
 
 namespace JS {
 
@@ -124,7 +125,11 @@ public:
     JS_ENUMERATE_ITERATOR_PROTOTYPES
 #undef __JS_ENUMERATE
 
-    [[nodiscard]] GC::Ref<Intl::Collator> default_collator();
+    Intl::ObjectCache<Intl::Collator>& collator_cache() { return m_collator_cache; }
+    Intl::ObjectCache<Intl::NumberFormat>& number_format_cache() { return m_number_format_cache; }
+    Intl::ObjectCache<Intl::DateTimeFormat>& date_format_cache() { return m_date_format_cache; }
+    Intl::ObjectCache<Intl::DateTimeFormat>& time_format_cache() { return m_time_format_cache; }
+    Intl::ObjectCache<Intl::DateTimeFormat>& date_time_format_cache() { return m_date_time_format_cache; }
 
 private:
     Intrinsics(Realm& realm)
@@ -248,7 +253,11 @@ private:
     JS_ENUMERATE_ITERATOR_PROTOTYPES
 #undef __JS_ENUMERATE
 
-    GC::Ptr<Intl::Collator> m_default_collator;
+    Intl::ObjectCache<Intl::Collator> m_collator_cache;
+    Intl::ObjectCache<Intl::NumberFormat> m_number_format_cache;
+    Intl::ObjectCache<Intl::DateTimeFormat> m_date_format_cache;
+    Intl::ObjectCache<Intl::DateTimeFormat> m_time_format_cache;
+    Intl::ObjectCache<Intl::DateTimeFormat> m_date_time_format_cache;
 };
 
 JS_API void add_restricted_function_properties(FunctionObject&, Realm&);
@@ -4,11 +4,15 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
+#include <AK/CharacterTypes.h>
 #include <AK/Function.h>
+#include <AK/GenericLexer.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonParser.h>
 #include <AK/StringBuilder.h>
+#include <AK/StringConversions.h>
 #include <AK/TypeCasts.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
@@ -110,7 +114,9 @@ ThrowCompletionOr<Optional<String>> JSONObject::stringify_impl(VM& vm, Value val
 
     auto wrapper = Object::create(realm, realm.intrinsics().object_prototype());
     MUST(wrapper->create_data_property_or_throw(String {}, value));
-    return serialize_json_property(vm, state, String {}, wrapper);
+    if (!TRY(serialize_json_property(vm, state, String {}, wrapper)))
+        return Optional<String> {};
+    return state.builder.to_string_without_validation();
 }
 
 // 25.5.2 JSON.stringify ( value [ , replacer [ , space ] ] ), https://tc39.es/ecma262/#sec-json.stringify
@@ -132,11 +138,20 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::stringify)
 
 // 25.5.2.1 SerializeJSONProperty ( state, key, holder ), https://tc39.es/ecma262/#sec-serializejsonproperty
 // 1.4.1 SerializeJSONProperty ( state, key, holder ), https://tc39.es/proposal-json-parse-with-source/#sec-serializejsonproperty
-ThrowCompletionOr<Optional<String>> JSONObject::serialize_json_property(VM& vm, StringifyState& state, PropertyKey const& key, Object* holder)
+ThrowCompletionOr<bool> JSONObject::serialize_json_property(VM& vm, StringifyState& state, PropertyKey const& key, Object* holder)
 {
     // 1. Let value be ? Get(holder, key).
     auto value = TRY(holder->get(key));
 
+    return serialize_json_value(vm, state, key, holder, value);
+}
+
+// NOTE: This is steps 2 and onwards of SerializeJSONProperty, split out so that callers that already know the result of
+//       step 1 (such as the plain object fast path in SerializeJSONObject) can skip the generic [[Get]].
+ThrowCompletionOr<bool> JSONObject::serialize_json_value(VM& vm, StringifyState& state, PropertyKey const& key, Object* holder, Value value)
+{
+    auto& builder = state.builder;
+
     // 2. If Type(value) is Object or BigInt, then
     if (value.is_object() || value.is_bigint()) {
         // a. Let toJSON be ? GetV(value, "toJSON").
@@ -162,7 +177,8 @@ ThrowCompletionOr<Optional<String>> JSONObject::serialize_json_property(VM& vm,
         // a. If value has an [[IsRawJSON]] internal slot, then
         if (is<RawJSONObject>(value_object)) {
             // i. Return ! Get(value, "rawJSON").
-            return MUST(value_object.get(vm.names.rawJSON)).as_string().utf8_string();
+            builder.append(MUST(value_object.get(vm.names.rawJSON)).as_string().utf8_string_view());
+            return true;
         }
         // b. If value has a [[NumberData]] internal slot, then
         if (is<NumberObject>(value_object)) {
@@ -187,26 +203,35 @@ ThrowCompletionOr<Optional<String>> JSONObject::serialize_json_property(VM& vm,
     }
 
     // 5. If value is null, return "null".
-    if (value.is_null())
-        return "null"_string;
+    if (value.is_null()) {
+        builder.append("null"sv);
+        return true;
+    }
 
     // 6. If value is true, return "true".
     // 7. If value is false, return "false".
-    if (value.is_boolean())
-        return value.as_bool() ? "true"_string : "false"_string;
+    if (value.is_boolean()) {
+        builder.append(value.as_bool() ? "true"sv : "false"sv);
+        return true;
+    }
 
     // 8. If Type(value) is String, return QuoteJSONString(value).
-    if (value.is_string())
-        return quote_json_string(value.as_string().utf8_string());
+    if (value.is_string()) {
+        quote_json_string(builder, value.as_string().utf8_string_view());
+        return true;
+    }
 
     // 9. If Type(value) is Number, then
     if (value.is_number()) {
         // a. If value is finite, return ! ToString(value).
-        if (value.is_finite_number())
-            return MUST(value.to_string(vm));
-
+        if (value.is_int32())
+            builder.appendff("{}", value.as_i32());
+        else if (value.is_finite_number())
+            builder.append(MUST(value.to_string(vm)));
         // b. Return "null".
-        return "null"_string;
+        else
+            builder.append("null"sv);
+        return true;
     }
 
     // 10. If Type(value) is BigInt, throw a TypeError exception.
@@ -220,152 +245,195 @@ ThrowCompletionOr<Optional<String>> JSONObject::serialize_json_property(VM& vm,
 
         // b. If isArray is true, return ? SerializeJSONArray(state, value).
         if (is_array)
-            return TRY(serialize_json_array(vm, state, value.as_object()));
-
+            TRY(serialize_json_array(vm, state, value.as_object()));
         // c. Return ? SerializeJSONObject(state, value).
-        return TRY(serialize_json_object(vm, state, value.as_object()));
+        else
+            TRY(serialize_json_object(vm, state, value.as_object()));
+        return true;
     }
 
     // 12. Return undefined.
-    return Optional<String> {};
+    return false;
+}
+
+void JSONObject::append_serialized_property_key(StringBuilder& builder, String const& gap, PropertyKey const& key)
+{
+    quote_json_string(builder, key.to_string());
+    builder.append(':');
+    if (!gap.is_empty())
+        builder.append(' ');
+}
+
+// Objects with these properties can have their enumerable own keys and data property values read straight out of their
+// shape, since nothing can observe the difference from going through [[OwnPropertyKeys]], [[GetOwnProperty]] and [[Get]].
+static bool can_serialize_properties_from_shape(Object const& object)
+{
+    return object.is_plain_object()
+        && !object.has_intrinsic_accessors()
+        && object.indexed_properties().is_empty();
+}
+
+JSONObject::SerializedShapeKeys const& JSONObject::serialized_keys_for_shape(StringifyState& state, Shape const& shape)
+{
+    VERIFY(!shape.is_dictionary());
+
+    auto& serialized_keys = state.serialized_shape_keys.ensure(&shape, [&] {
+        auto serialized_keys = make<SerializedShapeKeys>();
+        serialized_keys->shape = GC::make_root(const_cast<Shape&>(shape));
+
+        StringBuilder key_builder;
+        for (auto const& [key, metadata] : shape.property_table()) {
+            if (!key.is_string() || !metadata.attributes.is_enumerable())
+                continue;
+            key_builder.clear();
+            append_serialized_property_key(key_builder, state.gap, key);
+            serialized_keys->keys.append({ key, metadata.offset, key_builder.to_string_without_validation() });
+        }
+        return serialized_keys;
+    });
+    return *serialized_keys;
 }
 
 // 25.5.2.4 SerializeJSONObject ( state, value ), https://tc39.es/ecma262/#sec-serializejsonobject
-ThrowCompletionOr<String> JSONObject::serialize_json_object(VM& vm, StringifyState& state, Object& object)
+ThrowCompletionOr<void> JSONObject::serialize_json_object(VM& vm, StringifyState& state, Object& object)
 {
     if (state.seen_objects.contains(&object))
         return vm.throw_completion<TypeError>(ErrorType::JsonCircular);
 
     state.seen_objects.set(&object);
     String previous_indent = state.indent;
-    state.indent = MUST(String::formatted("{}{}", state.indent, state.gap));
-    Vector<String> property_strings;
+    if (!state.gap.is_empty())
+        state.indent = MUST(String::formatted("{}{}", state.indent, state.gap));
 
-    auto process_property = [&](PropertyKey const& key) -> ThrowCompletionOr<void> {
-        if (key.is_symbol())
-            return {};
-        auto serialized_property_string = TRY(serialize_json_property(vm, state, key, &object));
-        if (serialized_property_string.has_value()) {
-            property_strings.append(MUST(String::formatted(
-                "{}:{}{}",
-                quote_json_string(key.to_string()),
-                state.gap.is_empty() ? "" : " ",
-                serialized_property_string)));
+    auto& builder = state.builder;
+    bool has_properties = false;
+
+    builder.append('{');
+
+    // NOTE: The property separator and key are written before the value is serialized. If the value turns out to
+    //       serialize to undefined, we trim the builder back to where this property started.
+    auto serialize_property = [&](PropertyKey const& key, SerializedShapeKeys::Key const* serialized_key, Optional<Value> value) -> ThrowCompletionOr<void> {
+        auto property_start = builder.length();
+
+        if (has_properties)
+            builder.append(',');
+        if (!state.gap.is_empty()) {
+            builder.append('\n');
+            builder.append(state.indent);
         }
+
+        if (serialized_key)
+            builder.append(serialized_key->serialized_key);
+        else
+            append_serialized_property_key(builder, state.gap, key);
+
+        auto serialized = value.has_value()
+            ? TRY(serialize_json_value(vm, state, key, &object, *value))
+            : TRY(serialize_json_property(vm, state, key, &object));
+
+        if (serialized)
+            has_properties = true;
+        else
+            builder.trim(builder.length() - property_start);
         return {};
     };
 
     if (state.property_list.has_value()) {
         auto property_list = state.property_list.value();
         for (auto& property : property_list)
-            TRY(process_property(property));
+            TRY(serialize_property(property, nullptr, {}));
+    } else if (can_serialize_properties_from_shape(object) && !object.shape().is_dictionary()) {
+        auto& shape = object.shape();
+        auto const& serialized_keys = serialized_keys_for_shape(state, shape);
+        for (auto const& serialized_key : serialized_keys.keys) {
+            // NOTE: Serializing an earlier property may have run user code that reshaped this object. In that case we
+            //       fall back to a full [[Get]], which also takes care of the property having been deleted.
+            Optional<Value> value;
+            if (&object.shape() == &shape) {
+                if (auto direct_value = object.get_direct(serialized_key.offset); !direct_value.is_accessor())
+                    value = direct_value;
+            }
+            TRY(serialize_property(serialized_key.key, &serialized_key, value));
+        }
+    } else if (can_serialize_properties_from_shape(object)) {
+        // NOTE: Dictionary shapes are mutated in place, so we snapshot the keys up front and [[Get]] each of them.
+        Vector<PropertyKey> property_list;
+        for (auto const& [key, metadata] : object.shape().property_table()) {
+            if (key.is_string() && metadata.attributes.is_enumerable())
+                property_list.append(key);
+        }
+        for (auto& property : property_list)
+            TRY(serialize_property(property, nullptr, {}));
     } else {
         auto property_list = TRY(object.enumerable_own_property_names(PropertyKind::Key));
         for (auto& property : property_list)
-            TRY(process_property(property.as_string().utf8_string()));
+            TRY(serialize_property(property.as_string().utf8_string(), nullptr, {}));
     }
-    StringBuilder builder;
-    if (property_strings.is_empty()) {
-        builder.append("{}"sv);
-    } else {
-        bool first = true;
-        builder.append('{');
-        if (state.gap.is_empty()) {
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(',');
-                first = false;
-                builder.append(property_string);
-            }
-        } else {
-            builder.append('\n');
-            builder.append(state.indent);
-            auto separator = MUST(String::formatted(",\n{}", state.indent));
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(separator);
-                first = false;
-                builder.append(property_string);
-            }
-            builder.append('\n');
-            builder.append(previous_indent);
-        }
-        builder.append('}');
+
+    if (has_properties && !state.gap.is_empty()) {
+        builder.append('\n');
+        builder.append(previous_indent);
     }
+    builder.append('}');
 
     state.seen_objects.remove(&object);
     state.indent = previous_indent;
-    return builder.to_string_without_validation();
+    return {};
 }
 
 // 25.5.2.5 SerializeJSONArray ( state, value ), https://tc39.es/ecma262/#sec-serializejsonarray
-ThrowCompletionOr<String> JSONObject::serialize_json_array(VM& vm, StringifyState& state, Object& object)
+ThrowCompletionOr<void> JSONObject::serialize_json_array(VM& vm, StringifyState& state, Object& object)
 {
     if (state.seen_objects.contains(&object))
         return vm.throw_completion<TypeError>(ErrorType::JsonCircular);
 
     state.seen_objects.set(&object);
     String previous_indent = state.indent;
-    state.indent = MUST(String::formatted("{}{}", state.indent, state.gap));
-    Vector<String> property_strings;
+    if (!state.gap.is_empty())
+        state.indent = MUST(String::formatted("{}{}", state.indent, state.gap));
 
-    auto length = TRY(length_of_array_like(vm, object));
+    auto& builder = state.builder;
 
-    // Optimization
-    property_strings.ensure_capacity(length);
+    auto length = TRY(length_of_array_like(vm, object));
 
+    builder.append('[');
     for (size_t i = 0; i < length; ++i) {
-        auto serialized_property_string = TRY(serialize_json_property(vm, state, i, &object));
-        if (!serialized_property_string.has_value()) {
-            property_strings.append("null"_string);
-        } else {
-            property_strings.append(serialized_property_string.release_value());
-        }
-    }
-
-    StringBuilder builder;
-    if (property_strings.is_empty()) {
-        builder.append("[]"sv);
-    } else {
-        if (state.gap.is_empty()) {
-            builder.append('[');
-            bool first = true;
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(',');
-                first = false;
-                builder.append(property_string);
-            }
-            builder.append(']');
-        } else {
-            builder.append("[\n"sv);
-            builder.append(state.indent);
-            auto separator = MUST(String::formatted(",\n{}", state.indent));
-            bool first = true;
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(separator);
-                first = false;
-                builder.append(property_string);
-            }
+        if (i > 0)
+            builder.append(',');
+        if (!state.gap.is_empty()) {
             builder.append('\n');
-            builder.append(previous_indent);
-            builder.append(']');
+            builder.append(state.indent);
         }
+        if (!TRY(serialize_json_property(vm, state, i, &object)))
+            builder.append("null"sv);
     }
+    if (length > 0 && !state.gap.is_empty()) {
+        builder.append('\n');
+        builder.append(previous_indent);
+    }
+    builder.append(']');
 
     state.seen_objects.remove(&object);
     state.indent = previous_indent;
-    return builder.to_string_without_validation();
+    return {};
 }
 
 // 25.5.2.2 QuoteJSONString ( value ), https://tc39.es/ecma262/#sec-quotejsonstring
-String JSONObject::quote_json_string(String string)
+void JSONObject::quote_json_string(StringBuilder& builder, StringView string)
 {
     // 1. Let product be the String value consisting solely of the code unit 0x0022 (QUOTATION MARK).
-    StringBuilder builder;
     builder.append('"');
 
+    // OPTIMIZATION: Most strings (and almost all property keys) contain nothing that needs escaping.
+    auto needs_escaping = any_of(string.bytes(), [](u8 byte) {
+        return byte < 0x20 || byte == '"' || byte == '\\' || byte >= 0x80;
+    });
+    if (!needs_escaping) {
+        builder.append(string);
+        builder.append('"');
+        return;
+    }
+
     // 2. For each code point C of StringToCodePoints(value), do
     auto utf_view = Utf8View(string);
     for (auto code_point : utf_view) {
@@ -411,7 +479,6 @@ String JSONObject::quote_json_string(String string)
     builder.append('"');
 
     // 4. Return product.
-    return builder.to_string_without_validation();
 }
 
 // 25.5.1 JSON.parse ( text [ , reviver ] ), https://tc39.es/ecma262/#sec-json.parse
@@ -447,10 +514,324 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
     return unfiltered;
 }
 
+// Parses JSON text directly into JS values, without building an intermediate AK::JsonValue tree first.
+// It accepts exactly the same grammar as AK::JsonParser.
+class JSONTextParser : public GenericLexer {
+public:
+    JSONTextParser(VM& vm, StringView input)
+        : GenericLexer(input)
+        , m_vm(vm)
+        , m_realm(*vm.current_realm())
+    {
+    }
+
+    ErrorOr<Value> parse()
+    {
+        auto result = TRY(parse_value(0));
+        ignore_while(is_space);
+        if (!is_eof())
+            return AK::Error::from_string_literal("JSON: Didn't consume all input");
+        return result;
+    }
+
+private:
+    static constexpr bool is_space(char ch) { return ch == '\t' || ch == '\n' || ch == '\r' || ch == ' '; }
+
+    // OPTIMIZATION: Objects in JSON documents tend to come in long runs with the same keys in the same order, e.g. the
+    //               elements of an array of records. For each nesting depth, we remember the shape and keys of the
+    //               last object parsed there. The next object at that depth starts out with that shape, and its values
+    //               are stored directly into place for as long as its keys keep matching, skipping shape transitions.
+    struct ShapePrediction {
+        GC::Root<Shape> shape;
+        Vector<PropertyKey> keys;
+    };
+    static constexpr size_t maximum_depth_with_shape_prediction = 16;
+
+    ErrorOr<Value> parse_value(size_t depth)
+    {
+        ignore_while(is_space);
+        switch (peek()) {
+        case '{':
+            return TRY(parse_object(depth));
+        case '[':
+            return TRY(parse_array(depth));
+        case '"':
+            return PrimitiveString::create(m_vm, TRY(consume_and_unescape_string()));
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+            return parse_number();
+        case 'f':
+            if (!consume_specific("false"sv))
+                return AK::Error::from_string_literal("JSON: Expected 'false'");
+            return Value(false);
+        case 't':
+            if (!consume_specific("true"sv))
+                return AK::Error::from_string_literal("JSON: Expected 'true'");
+            return Value(true);
+        case 'n':
+            if (!consume_specific("null"sv))
+                return AK::Error::from_string_literal("JSON: Expected 'null'");
+            return js_null();
+        }
+        return AK::Error::from_string_literal("JSON: Unexpected character");
+    }
+
+    ErrorOr<GC::Ref<Object>> parse_object(size_t depth)
+    {
+        if (!consume_specific('{'))
+            return AK::Error::from_string_literal("JSON: Expected '{'");
+
+        ShapePrediction* prediction = nullptr;
+        if (depth < maximum_depth_with_shape_prediction) {
+            if (m_shape_predictions.size() <= depth)
+                m_shape_predictions.resize(depth + 1);
+            prediction = &m_shape_predictions[depth];
+        }
+
+        bool following_prediction = prediction && prediction->shape;
+        GC::Ref<Object> object = following_prediction
+            ? Object::create_with_premade_shape(*prediction->shape)
+            : Object::create(m_realm, m_realm.intrinsics().object_prototype());
+        Vector<PropertyKey> keys;
+        size_t property_count = 0;
+
+        auto stop_following_prediction = [&] {
+            auto new_object = Object::create(m_realm, m_realm.intrinsics().object_prototype());
+            for (size_t i = 0; i < property_count; ++i)
+                new_object->define_direct_property(prediction->keys[i], object->get_direct(i), default_attributes);
+            object = new_object;
+            following_prediction = false;
+        };
+
+        for (;;) {
+            ignore_while(is_space);
+            if (peek() == '}')
+                break;
+            PropertyKey key { TRY(consume_and_unescape_string()) };
+            ignore_while(is_space);
+            if (!consume_specific(':'))
+                return AK::Error::from_string_literal("JSON: Expected ':'");
+            auto value = TRY(parse_value(depth + 1));
+
+            if (following_prediction) {
+                if (property_count < prediction->keys.size() && prediction->keys[property_count] == key)
+                    object->put_direct(property_count, value);
+                else
+                    stop_following_prediction();
+            }
+            if (!following_prediction) {
+                object->define_direct_property(key, value, default_attributes);
+                if (prediction)
+                    keys.append(move(key));
+            }
+            ++property_count;
+
+            ignore_while(is_space);
+            if (peek() == '}')
+                break;
+            if (!consume_specific(','))
+                return AK::Error::from_string_literal("JSON: Expected ','");
+            ignore_while(is_space);
+            if (peek() == '}')
+                return AK::Error::from_string_literal("JSON: Unexpected '}'");
+        }
+        if (!consume_specific('}'))
+            return AK::Error::from_string_literal("JSON: Expected '}'");
+
+        if (following_prediction && property_count != prediction->keys.size())
+            stop_following_prediction();
+
+        // NOTE: Only plain transition shapes can be shared between objects. Numeric keys live in indexed storage and
+        //       duplicate keys don't add to the shape, so those objects can't follow the key list.
+        if (prediction && !following_prediction) {
+            auto& shape = object->shape();
+            if (!shape.is_dictionary() && object->indexed_properties().is_empty() && shape.property_count() == keys.size()) {
+                prediction->shape = GC::make_root(shape);
+                prediction->keys = move(keys);
+            } else {
+                prediction->shape = {};
+                prediction->keys.clear();
+            }
+        }
+
+        return object;
+    }
+
+    ErrorOr<GC::Ref<Array>> parse_array(size_t depth)
+    {
+        if (!consume_specific('['))
+            return AK::Error::from_string_literal("JSON: Expected '['");
+        auto array = MUST(Array::create(m_realm, 0));
+        u32 index = 0;
+        for (;;) {
+            ignore_while(is_space);
+            if (peek() == ']')
+                break;
+            array->define_direct_property(index++, TRY(parse_value(depth + 1)), default_attributes);
+            ignore_while(is_space);
+            if (peek() == ']')
+                break;
+            if (!consume_specific(','))
+                return AK::Error::from_string_literal("JSON: Expected ','");
+            ignore_while(is_space);
+            if (peek() == ']')
+                return AK::Error::from_string_literal("JSON: Unexpected ']'");
+        }
+        ignore_while(is_space);
+        if (!consume_specific(']'))
+            return AK::Error::from_string_literal("JSON: Expected ']'");
+        return array;
+    }
+
+    ErrorOr<String> consume_and_unescape_string()
+    {
+        if (!consume_specific('"'))
+            return AK::Error::from_string_literal("JSON: Expected '\"'");
+
+        // OPTIMIZATION: Most strings have no escape sequences, so they can be taken straight from the input.
+        size_t literal_characters = 0;
+        for (;;) {
+            char ch = peek(literal_characters);
+            if (ch == '"' || ch == '\\' || ch == 0 || is_ascii_c0_control(ch))
+                break;
+            ++literal_characters;
+        }
+        if (peek(literal_characters) == '"') {
+            auto string = consume(literal_characters);
+            ignore();
+            // NOTE: The input is valid UTF-8, and we stopped at an ASCII character, so this is valid UTF-8 as well.
+            return String::from_utf8_without_validation(string.bytes());
+        }
+
+        StringBuilder builder;
+        for (;;) {
+            literal_characters = 0;
+            for (;;) {
+                char ch = peek(literal_characters);
+                if (ch == 0)
+                    return AK::Error::from_string_literal("JSON: EOF while parsing String");
+                if (is_ascii_c0_control(ch))
+                    return AK::Error::from_string_literal("JSON: ASCII control sequence encountered");
+                if (ch == '"' || ch == '\\')
+                    break;
+                ++literal_characters;
+            }
+            builder.append(consume(literal_characters));
+
+            if (peek() == '"') {
+                ignore();
+                break;
+            }
+
+            ignore(); // '\'
+
+            switch (peek()) {
+            case '\0':
+                return AK::Error::from_string_literal("JSON: EOF while parsing String");
+            case '"':
+            case '\\':
+            case '/':
+                builder.append(consume());
+                break;
+            case 'b':
+                ignore();
+                builder.append('\b');
+                break;
+            case 'f':
+                ignore();
+                builder.append('\f');
+                break;
+            case 'n':
+                ignore();
+                builder.append('\n');
+                break;
+            case 'r':
+                ignore();
+                builder.append('\r');
+                break;
+            case 't':
+                ignore();
+                builder.append('\t');
+                break;
+            case 'u': {
+                ignore(); // 'u'
+                auto code_point = decode_single_or_paired_surrogate();
+                if (code_point.is_error())
+                    return AK::Error::from_string_literal("JSON: Error while parsing Unicode escape");
+                builder.append_code_point(code_point.value());
+                break;
+            }
+            default:
+                return AK::Error::from_string_literal("JSON: Invalid escaped character");
+            }
+        }
+
+        return builder.to_string();
+    }
+
+    ErrorOr<Value> parse_number()
+    {
+        auto start_index = tell();
+
+        bool negative = consume_specific('-');
+        if (negative && !is_ascii_digit(peek()))
+            return AK::Error::from_string_literal("JSON: Unexpected '-' without further digits");
+        if (peek() == '0' && is_ascii_digit(peek(1)))
+            return AK::Error::from_string_literal("JSON: Cannot have leading zeros");
+
+        // OPTIMIZATION: Integers with up to 15 digits are exactly representable as doubles, so we can accumulate them.
+        static constexpr size_t maximum_digits_for_fast_path = 15;
+        u64 integer = 0;
+        size_t digits = 0;
+        while (is_ascii_digit(peek())) {
+            integer = integer * 10 + parse_ascii_digit(consume());
+            ++digits;
+        }
+
+        bool is_integer = true;
+        if (peek() == '.') {
+            if (!is_ascii_digit(peek(1)))
+                return AK::Error::from_string_literal("JSON: Must have digits after decimal point");
+            is_integer = false;
+        } else if (peek() == 'e' || peek() == 'E') {
+            char next = peek(1);
+            if (!is_ascii_digit(next) && ((next != '+' && next != '-') || !is_ascii_digit(peek(2))))
+                return AK::Error::from_string_literal("JSON: Must have digits after exponent with an optional sign inbetween");
+            is_integer = false;
+        }
+
+        if (is_integer && digits <= maximum_digits_for_fast_path) {
+            if (negative)
+                return Value(integer == 0 ? -0.0 : -static_cast<double>(integer));
+            return Value(static_cast<double>(integer));
+        }
+
+        auto parse_result = parse_first_number<double>(m_input.substring_view(start_index), TrimWhitespace::No);
+        if (!parse_result.has_value())
+            return AK::Error::from_string_literal("JSON: Invalid floating point");
+        m_index = start_index + parse_result->characters_parsed;
+        return Value(parse_result->value);
+    }
+
+    VM& m_vm;
+    Realm& m_realm;
+    Vector<ShapePrediction> m_shape_predictions;
+};
+
 // 25.5.1.1 ParseJSON ( text ), https://tc39.es/ecma262/#sec-ParseJSON
 ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
 {
-    auto json = JsonValue::from_string(text);
+    JSONTextParser parser(vm, text);
+    auto json = parser.parse();
 
     // 1. If StringToCodePoints(text) is not a valid JSON text as specified in ECMA-404, throw a SyntaxError exception.
     if (json.is_error())
@@ -461,7 +842,7 @@ ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
     // 4. NOTE: The early error rules defined in 13.2.5.1 have special handling for the above invocation of ParseText.
     // 5. Assert: script is a Parse Node.
     // 6. Let result be ! Evaluation of script.
-    auto result = JSONObject::parse_json_value(vm, json.value());
+    auto result = json.release_value();
 
     // 7. NOTE: The PropertyDefinitionEvaluation semantics defined in 13.2.5.5 have special handling for the above evaluation.
     // 8. Assert: result is either a String, a Number, a Boolean, an Object that is defined by either an ArrayLiteral or an ObjectLiteral, or null.
@@ -6,6 +6,10 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/StringBuilder.h>
+#include <LibGC/Root.h>
 #include <LibJS/Runtime/Object.h>
 
 namespace JS {
@@ -28,19 +32,39 @@ public:
 private:
     explicit JSONObject(Realm&);
 
+    // The enumerable string keys of a (non-dictionary) shape, along with their quoted "key": prefix. Since such
+    // shapes are immutable, this can be shared by every object with that shape in a single stringify operation.
+    struct SerializedShapeKeys {
+        struct Key {
+            PropertyKey key;
+            u32 offset { 0 };
+            String serialized_key;
+        };
+
+        GC::Root<Shape> shape;
+        Vector<Key> keys;
+    };
+
     struct StringifyState {
         GC::Ptr<FunctionObject> replacer_function;
         HashTable<GC::Ptr<Object>> seen_objects;
         String indent;
         String gap;
         Optional<Vector<String>> property_list;
+        StringBuilder builder;
+        HashMap<Shape const*, NonnullOwnPtr<SerializedShapeKeys>> serialized_shape_keys;
     };
 
     // Stringify helpers
-    static ThrowCompletionOr<Optional<String>> serialize_json_property(VM&, StringifyState&, PropertyKey const& key, Object* holder);
-    static ThrowCompletionOr<String> serialize_json_object(VM&, StringifyState&, Object&);
-    static ThrowCompletionOr<String> serialize_json_array(VM&, StringifyState&, Object&);
-    static String quote_json_string(String);
+    // NOTE: These append their output to state.builder. The serialize_json_property/value helpers return false
+    //       (having appended nothing) for values that serialize to undefined.
+    static ThrowCompletionOr<bool> serialize_json_property(VM&, StringifyState&, PropertyKey const& key, Object* holder);
+    static ThrowCompletionOr<bool> serialize_json_value(VM&, StringifyState&, PropertyKey const& key, Object* holder, Value);
+    static ThrowCompletionOr<void> serialize_json_object(VM&, StringifyState&, Object&);
+    static ThrowCompletionOr<void> serialize_json_array(VM&, StringifyState&, Object&);
+    static SerializedShapeKeys const& serialized_keys_for_shape(StringifyState&, Shape const&);
+    static void append_serialized_property_key(StringBuilder&, String const& gap, PropertyKey const&);
+    static void quote_json_string(StringBuilder&, StringView);
 
     // Parse helpers
     static Object* parse_json_object(VM&, JsonObject const&);
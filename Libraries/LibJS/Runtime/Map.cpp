@@ -23,71 +23,114 @@ Map::Map(Object& prototype)
 // 24.1.3.1 Map.prototype.clear ( ), https://tc39.es/ecma262/#sec-map.prototype.clear
 void Map::map_clear()
 {
-    m_keys.clear();
     m_entries.clear();
+    m_positions.clear();
+    m_deleted_entry_count = 0;
+    ++m_compaction_count;
 }
 
 // 24.1.3.3 Map.prototype.delete ( key ), https://tc39.es/ecma262/#sec-map.prototype.delete
 bool Map::map_remove(Value const& key)
 {
-    Optional<size_t> index;
-
-    for (auto it = m_keys.begin(); !it.is_end(); ++it) {
-        if (ValueTraits::equals(*it, key)) {
-            index = it.key();
-            break;
-        }
-    }
-
-    if (!index.has_value())
+    auto it = m_positions.find(key);
+    if (it == m_positions.end())
         return false;
 
-    m_keys.remove(*index);
-    m_entries.remove(key);
+    auto& entry = m_entries[it->value];
+    entry.key = js_special_empty_value();
+    entry.value = js_special_empty_value();
+    ++m_deleted_entry_count;
+    m_positions.remove(it);
+
+    compact_if_needed();
     return true;
 }
 
 // 24.1.3.6 Map.prototype.get ( key ), https://tc39.es/ecma262/#sec-map.prototype.get
 Optional<Value> Map::map_get(Value const& key) const
 {
-    if (auto it = m_entries.find(key); it != m_entries.end())
-        return it->value;
+    if (auto it = m_positions.find(key); it != m_positions.end())
+        return m_entries[it->value].value;
     return {};
 }
 
 // 24.1.3.7 Map.prototype.has ( key ), https://tc39.es/ecma262/#sec-map.prototype.has
 bool Map::map_has(Value const& key) const
 {
-    return m_entries.contains(key);
+    return m_positions.contains(key);
 }
 
 // 24.1.3.9 Map.prototype.set ( key, value ), https://tc39.es/ecma262/#sec-map.prototype.set
 void Map::map_set(Value const& key, Value value)
 {
-    auto it = m_entries.find(key);
-    if (it != m_entries.end()) {
-        it->value = value;
-    } else {
-        auto index = m_next_insertion_id++;
-        m_keys.insert(index, key);
-        m_entries.set(key, value);
-    }
+    auto position = m_positions.ensure(key, [&] {
+        m_entries.append({ key, js_undefined(), m_next_insertion_id++ });
+        return m_entries.size() - 1;
+    });
+    m_entries[position].value = value;
 }
 
 size_t Map::map_size() const
 {
-    return m_keys.size();
+    return m_positions.size();
+}
+
+void Map::copy_entries_from(Map const& other)
+{
+    VERIFY(m_entries.is_empty());
+    m_entries.ensure_capacity(other.map_size());
+    m_positions.ensure_capacity(other.map_size());
+    for (auto const& entry : other.m_entries) {
+        if (entry.is_deleted())
+            continue;
+        m_positions.set(entry.key, m_entries.size());
+        m_entries.unchecked_append({ entry.key, entry.value, m_next_insertion_id++ });
+    }
+}
+
+size_t Map::position_of_first_entry_not_below(size_t insertion_id) const
+{
+    // NOTE: New entries are always appended, so m_entries is sorted by insertion id.
+    size_t low = 0;
+    size_t high = m_entries.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (m_entries[middle].insertion_id < insertion_id)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+void Map::compact_if_needed()
+{
+    static constexpr size_t minimum_deleted_entries_to_compact = 16;
+    if (m_deleted_entry_count < minimum_deleted_entries_to_compact || m_deleted_entry_count * 2 < m_entries.size())
+        return;
+
+    size_t live_entry_count = 0;
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        auto const& entry = m_entries[i];
+        if (entry.is_deleted())
+            continue;
+        m_positions.set(entry.key, live_entry_count);
+        m_entries[live_entry_count++] = entry;
+    }
+    m_entries.shrink(live_entry_count);
+    m_deleted_entry_count = 0;
+    ++m_compaction_count;
 }
 
 void Map::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto& value : m_entries) {
-        visitor.visit(value.key);
-        visitor.visit(value.value);
+    for (auto const& entry : m_entries) {
+        visitor.visit(entry.key);
+        visitor.visit(entry.value);
     }
-    // NOTE: The entries in m_keys are already visited by the walk over m_entries above.
-    visitor.ignore(m_keys);
+    // NOTE: The keys in m_positions are already visited by the walk over m_entries above.
+    visitor.ignore(m_positions);
 }
 
 }
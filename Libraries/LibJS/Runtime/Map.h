@@ -7,7 +7,7 @@
 #pragma once
 
 #include <AK/HashMap.h>
-#include <AK/RedBlackTree.h>
+#include <AK/Vector.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/Value.h>
@@ -31,33 +31,50 @@ public:
     void map_set(Value const&, Value);
     size_t map_size() const;
 
+    // Replaces the contents of this (empty) map with the entries of another, preserving their order.
+    void copy_entries_from(Map const&);
+
+    struct Entry {
+        Value key;
+        Value value;
+        size_t insertion_id { 0 };
+
+        bool is_deleted() const { return key.is_special_empty_value(); }
+    };
+
     struct EndIterator {
     };
 
+    // NOTE: Iterators remember the insertion id of the entry they're at rather than relying on a position in
+    //       m_entries, since positions shift whenever the entries are compacted.
     template<bool IsConst>
     struct IteratorImpl {
         bool is_end() const
         {
-            return m_map->m_keys.begin_from(m_index).is_end()
-                && m_map->m_keys.find_smallest_not_below_iterator(m_index).is_end();
+            ensure_position();
+            return m_position >= m_map->m_entries.size();
         }
 
         IteratorImpl& operator++()
         {
-            ++m_index;
+            ensure_position();
+            if (m_position < m_map->m_entries.size()) {
+                m_index = m_map->m_entries[m_position].insertion_id + 1;
+                ++m_position;
+            }
             return *this;
         }
 
         decltype(auto) operator*()
         {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            ensure_position();
+            return m_map->m_entries[m_position];
         }
 
         decltype(auto) operator*() const
         {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            ensure_position();
+            return m_map->m_entries[m_position];
         }
 
         bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && &m_map == &other.m_map; }
@@ -68,35 +85,34 @@ public:
         IteratorImpl(Map const& map)
         requires(IsConst)
             : m_map(map)
+            , m_compaction_count(map.m_compaction_count)
         {
-            ensure_index();
         }
 
         IteratorImpl(Map& map)
         requires(!IsConst)
             : m_map(map)
+            , m_compaction_count(map.m_compaction_count)
         {
-            ensure_index();
         }
 
-        void ensure_index() const
+        void ensure_position() const
         {
-            if (m_map->m_keys.is_empty())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = m_map->m_keys.begin().key();
-        }
-
-        void ensure_next_element() const
-        {
-            if (auto it = m_map->m_keys.find_smallest_not_below_iterator(m_index); it.is_end())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = it.key();
+            auto const& entries = m_map->m_entries;
+            if (m_compaction_count != m_map->m_compaction_count) {
+                m_position = m_map->position_of_first_entry_not_below(m_index);
+                m_compaction_count = m_map->m_compaction_count;
+            }
+            while (m_position < entries.size() && entries[m_position].is_deleted())
+                ++m_position;
+            if (m_position < entries.size())
+                m_index = entries[m_position].insertion_id;
         }
 
         Conditional<IsConst, GC::Ref<Map const>, GC::Ref<Map>> m_map;
         mutable size_t m_index { 0 };
+        mutable size_t m_position { 0 };
+        mutable size_t m_compaction_count { 0 };
     };
 
     using Iterator = IteratorImpl<false>;
@@ -110,9 +126,16 @@ private:
     explicit Map(Object& prototype);
     virtual void visit_edges(Visitor& visitor) override;
 
+    size_t position_of_first_entry_not_below(size_t insertion_id) const;
+    void compact_if_needed();
+
+    // Entries are stored densely in insertion order, with deleted entries left behind as holes so that
+    // iteration is a linear scan. The holes are squeezed out once they make up half of the entries.
+    Vector<Entry> m_entries;
+    HashMap<Value, size_t, ValueTraits> m_positions;
     size_t m_next_insertion_id { 0 };
-    RedBlackTree<size_t, Value> m_keys;
-    HashMap<Value, Value, ValueTraits> m_entries;
+    size_t m_deleted_entry_count { 0 };
+    size_t m_compaction_count { 0 };
 };
 
 }
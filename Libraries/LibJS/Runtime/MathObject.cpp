@@ -39,16 +39,16 @@ void MathObject::initialize(Realm& realm)
     define_native_function(realm, vm.names.floor, floor, 1, attr, Bytecode::Builtin::MathFloor);
     define_native_function(realm, vm.names.ceil, ceil, 1, attr, Bytecode::Builtin::MathCeil);
     define_native_function(realm, vm.names.round, round, 1, attr, Bytecode::Builtin::MathRound);
-    define_native_function(realm, vm.names.max, max, 2, attr);
-    define_native_function(realm, vm.names.min, min, 2, attr);
-    define_native_function(realm, vm.names.trunc, trunc, 1, attr);
+    define_native_function(realm, vm.names.max, max, 2, attr, Bytecode::Builtin::MathMax);
+    define_native_function(realm, vm.names.min, min, 2, attr, Bytecode::Builtin::MathMin);
+    define_native_function(realm, vm.names.trunc, trunc, 1, attr, Bytecode::Builtin::MathTrunc);
     define_native_function(realm, vm.names.sin, sin, 1, attr, Bytecode::Builtin::MathSin);
     define_native_function(realm, vm.names.cos, cos, 1, attr, Bytecode::Builtin::MathCos);
     define_native_function(realm, vm.names.tan, tan, 1, attr, Bytecode::Builtin::MathTan);
     define_native_function(realm, vm.names.pow, pow, 2, attr, Bytecode::Builtin::MathPow);
     define_native_function(realm, vm.names.exp, exp, 1, attr, Bytecode::Builtin::MathExp);
     define_native_function(realm, vm.names.expm1, expm1, 1, attr);
-    define_native_function(realm, vm.names.sign, sign, 1, attr);
+    define_native_function(realm, vm.names.sign, sign, 1, attr, Bytecode::Builtin::MathSign);
     define_native_function(realm, vm.names.clz32, clz32, 1, attr);
     define_native_function(realm, vm.names.acos, acos, 1, attr);
     define_native_function(realm, vm.names.acosh, acosh, 1, attr);
@@ -753,6 +753,36 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::max)
     return highest;
 }
 
+// 21.3.2.24 Math.max ( ...args ), https://tc39.es/ecma262/#sec-math.max
+// NOTE: This is Math.max specialized for exactly two arguments.
+ThrowCompletionOr<Value> MathObject::max_impl(VM& vm, Value a, Value b)
+{
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (a.is_int32() && b.is_int32())
+        return Value(AK::max(a.as_i32(), b.as_i32()));
+
+    // 1. Let coerced be a new empty List.
+    // 2. For each element arg of args, do
+    //    a. Let n be ? ToNumber(arg).
+    //    b. Append n to coerced.
+    auto x = TRY(a.to_number(vm));
+    auto y = TRY(b.to_number(vm));
+
+    // 3. Let highest be -∞𝔽.
+    // 4. For each element number of coerced, do
+    //    a. If number is NaN, return NaN.
+    if (x.is_nan() || y.is_nan())
+        return js_nan();
+
+    //    b. If number is +0𝔽 and highest is -0𝔽, set highest to +0𝔽.
+    //    c. If number > highest, set highest to number.
+    if ((y.is_positive_zero() && x.is_negative_zero()) || y.as_double() > x.as_double())
+        return y;
+
+    // 5. Return highest.
+    return x;
+}
+
 // 21.3.2.26 Math.min ( ...args ), https://tc39.es/ecma262/#sec-math.min
 JS_DEFINE_NATIVE_FUNCTION(MathObject::min)
 {
@@ -787,6 +817,36 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::min)
     return lowest;
 }
 
+// 21.3.2.25 Math.min ( ...args ), https://tc39.es/ecma262/#sec-math.min
+// NOTE: This is Math.min specialized for exactly two arguments.
+ThrowCompletionOr<Value> MathObject::min_impl(VM& vm, Value a, Value b)
+{
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (a.is_int32() && b.is_int32())
+        return Value(AK::min(a.as_i32(), b.as_i32()));
+
+    // 1. Let coerced be a new empty List.
+    // 2. For each element arg of args, do
+    //    a. Let n be ? ToNumber(arg).
+    //    b. Append n to coerced.
+    auto x = TRY(a.to_number(vm));
+    auto y = TRY(b.to_number(vm));
+
+    // 3. Let lowest be +∞𝔽.
+    // 4. For each element number of coerced, do
+    //    a. If number is NaN, return NaN.
+    if (x.is_nan() || y.is_nan())
+        return js_nan();
+
+    //    b. If number is -0𝔽 and lowest is +0𝔽, set lowest to -0𝔽.
+    //    c. If number < lowest, set lowest to number.
+    if ((y.is_negative_zero() && x.is_positive_zero()) || y.as_double() < x.as_double())
+        return y;
+
+    // 5. Return lowest.
+    return x;
+}
+
 // 21.3.2.27 Math.pow ( base, exponent ), https://tc39.es/ecma262/#sec-math.pow
 ThrowCompletionOr<Value> MathObject::pow_impl(VM& vm, Value base, Value exponent)
 {
@@ -892,10 +952,14 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::round)
 }
 
 // 21.3.2.30 Math.sign ( x ), https://tc39.es/ecma262/#sec-math.sign
-JS_DEFINE_NATIVE_FUNCTION(MathObject::sign)
+ThrowCompletionOr<Value> MathObject::sign_impl(VM& vm, Value x)
 {
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (x.is_int32())
+        return Value((x.as_i32() > 0) - (x.as_i32() < 0));
+
     // 1. Let n be ? ToNumber(x).
-    auto number = TRY(vm.argument(0).to_number(vm));
+    auto number = TRY(x.to_number(vm));
 
     // 2. If n is one of NaN, +0𝔽, or -0𝔽, return n.
     if (number.is_nan() || number.as_double() == 0)
@@ -909,6 +973,11 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::sign)
     return Value(1);
 }
 
+JS_DEFINE_NATIVE_FUNCTION(MathObject::sign)
+{
+    return sign_impl(vm, vm.argument(0));
+}
+
 // 21.3.2.31 Math.sin ( x ), https://tc39.es/ecma262/#sec-math.sin
 ThrowCompletionOr<Value> MathObject::sin_impl(VM& vm, Value value)
 {
@@ -1016,10 +1085,14 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::tanh)
 }
 
 // 21.3.2.36 Math.trunc ( x ), https://tc39.es/ecma262/#sec-math.trunc
-JS_DEFINE_NATIVE_FUNCTION(MathObject::trunc)
+ThrowCompletionOr<Value> MathObject::trunc_impl(VM& vm, Value x)
 {
+    // OPTIMIZATION: Int32 values are already integral.
+    if (x.is_int32())
+        return x;
+
     // 1. Let n be ? ToNumber(x).
-    auto number = TRY(vm.argument(0).to_number(vm));
+    auto number = TRY(x.to_number(vm));
 
     // 2. If n is not finite or n is either +0𝔽 or -0𝔽, return n.
     if (number.is_nan() || number.is_infinity() || number.as_double() == 0)
@@ -1033,6 +1106,11 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::trunc)
             : ::floor(number.as_double()));
 }
 
+JS_DEFINE_NATIVE_FUNCTION(MathObject::trunc)
+{
+    return trunc_impl(vm, vm.argument(0));
+}
+
 struct TwoSumResult {
     double hi;
     double lo;
@@ -34,11 +34,15 @@ static HashMap<GC::Ptr<Object const>, HashMap<FlyString, Object::IntrinsicAccess
 // 10.1.12 OrdinaryObjectCreate ( proto [ , additionalInternalSlotsList ] ), https://tc39.es/ecma262/#sec-ordinaryobjectcreate
 GC::Ref<Object> Object::create(Realm& realm, Object* prototype)
 {
+    GC::Ptr<Object> object;
     if (!prototype)
-        return realm.create<Object>(realm.intrinsics().empty_object_shape());
-    if (prototype == realm.intrinsics().object_prototype())
-        return realm.create<Object>(realm.intrinsics().new_object_shape());
-    return realm.create<Object>(ConstructWithPrototypeTag::Tag, *prototype);
+        object = realm.create<Object>(realm.intrinsics().empty_object_shape());
+    else if (prototype == realm.intrinsics().object_prototype())
+        object = realm.create<Object>(realm.intrinsics().new_object_shape());
+    else
+        object = realm.create<Object>(ConstructWithPrototypeTag::Tag, *prototype);
+    object->m_is_plain_object = true;
+    return *object;
 }
 
 GC::Ref<Object> Object::create_prototype(Realm& realm, Object* prototype)
@@ -46,12 +50,16 @@ GC::Ref<Object> Object::create_prototype(Realm& realm, Object* prototype)
     auto shape = realm.heap().allocate<Shape>(realm);
     if (prototype)
         shape->set_prototype_without_transition(prototype);
-    return realm.create<Object>(shape);
+    auto object = realm.create<Object>(shape);
+    object->m_is_plain_object = true;
+    return object;
 }
 
 GC::Ref<Object> Object::create_with_premade_shape(Shape& shape)
 {
-    return shape.realm().create<Object>(shape);
+    auto object = shape.realm().create<Object>(shape);
+    object->m_is_plain_object = true;
+    return object;
 }
 
 Object::Object(GlobalObjectTag, Realm& realm, MayInterfereWithIndexedPropertyAccess may_interfere_with_indexed_property_access)
@@ -1156,6 +1164,8 @@ ThrowCompletionOr<bool> Object::set_immutable_prototype(Object* prototype)
     return false;
 }
 
+static constexpr size_t max_transitions_before_converting_to_dictionary = 64;
+
 static Optional<Object::IntrinsicAccessor> find_intrinsic_accessor(Object const* object, PropertyKey const& property_key)
 {
     if (!property_key.is_string())
@@ -1229,7 +1239,6 @@ void Object::storage_set(PropertyKey const& property_key, ValueAndAttributes con
     auto metadata = shape().lookup(property_key);
 
     if (!metadata.has_value()) {
-        static constexpr size_t max_transitions_before_converting_to_dictionary = 64;
         if (!m_shape->is_dictionary() && m_shape->property_count() >= max_transitions_before_converting_to_dictionary)
             set_shape(m_shape->create_cacheable_dictionary_transition());
 
@@ -1266,13 +1275,17 @@ void Object::storage_delete(PropertyKey const& property_key)
     auto metadata = shape().lookup(property_key);
     VERIFY(metadata.has_value());
 
-    if (m_shape->is_cacheable_dictionary()) {
-        m_shape = m_shape->create_uncacheable_dictionary_transition();
-    }
-    if (m_shape->is_uncacheable_dictionary()) {
-        m_shape->remove_property_without_transition(property_key, metadata->offset);
-        m_storage.remove(metadata->offset);
-        return;
+    // Objects that keep having properties deleted are most likely used as dictionaries. Rather than growing a unique
+    // chain of delete transitions for each of them, give them their own shape that is updated in place.
+    // NOTE: Prototype shapes always transition, since that's what invalidates prototype chain caches.
+    if (!m_shape->is_prototype_shape()) {
+        if (m_shape->is_cacheable_dictionary() || (!m_shape->is_dictionary() && m_shape->has_delete_transition_in_chain()))
+            m_shape = m_shape->create_uncacheable_dictionary_transition();
+        if (m_shape->is_uncacheable_dictionary()) {
+            m_shape->remove_property_without_transition(property_key, metadata->offset);
+            m_storage.remove(metadata->offset);
+            return;
+        }
     }
     m_shape = m_shape->create_delete_transition(property_key);
     m_storage.remove(metadata->offset);
@@ -1322,6 +1335,24 @@ void Object::define_intrinsic_accessor(PropertyKey const& property_key, Property
     intrinsics.set(property_key.as_string(), move(accessor));
 }
 
+void Object::define_intrinsic_accessors(ReadonlySpan<IntrinsicAccessorDefinition> definitions, PropertyAttributes attributes)
+{
+    // OPTIMIZATION: Global objects get hundreds of these. Rather than growing a transition for each of them only to become
+    //               a dictionary anyway, become one up front, and only look up this object's accessor table once.
+    if (!m_shape->is_dictionary() && m_shape->property_count() + definitions.size() > max_transitions_before_converting_to_dictionary)
+        set_shape(m_shape->create_cacheable_dictionary_transition());
+    m_storage.ensure_capacity(m_storage.size() + definitions.size());
+
+    for (auto const& definition : definitions)
+        storage_set(PropertyKey { definition.name, PropertyKey::StringMayBeNumber::No }, { {}, attributes });
+
+    m_has_intrinsic_accessors = true;
+    auto& intrinsics = s_intrinsics.ensure(this);
+    intrinsics.ensure_capacity(intrinsics.size() + definitions.size());
+    for (auto const& definition : definitions)
+        intrinsics.set(definition.name, definition.accessor);
+}
+
 // Simple side-effect free property lookup, following the prototype chain. Non-standard.
 Value Object::get_without_side_effects(PropertyKey const& property_key) const
 {
@@ -1440,9 +1471,14 @@ void Object::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_shape);
     visitor.visit(m_storage);
 
-    m_indexed_properties.for_each_value([&visitor](auto& value) {
-        visitor.visit(value);
-    });
+    // OPTIMIZATION: Simple storage that only holds numbers has no values that could refer to cells.
+    auto const* indexed_storage = m_indexed_properties.storage();
+    if (!indexed_storage || !indexed_storage->is_simple_storage()
+        || static_cast<SimpleIndexedPropertyStorage const&>(*indexed_storage).element_kind() == SimpleIndexedPropertyStorage::ElementKind::Any) {
+        m_indexed_properties.for_each_value([&visitor](auto& value) {
+            visitor.visit(value);
+        });
+    }
 
     if (m_private_elements) {
         for (auto& private_element : *m_private_elements)
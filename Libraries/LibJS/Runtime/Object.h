@@ -186,6 +186,13 @@ public:
     using IntrinsicAccessor = Value (*)(Realm&);
     void define_intrinsic_accessor(PropertyKey const&, PropertyAttributes attributes, IntrinsicAccessor accessor);
 
+    struct IntrinsicAccessorDefinition {
+        FlyString name;
+        IntrinsicAccessor accessor;
+    };
+    // Defines many intrinsic accessors at once, like the interface objects of a global object, faster than one by one.
+    void define_intrinsic_accessors(ReadonlySpan<IntrinsicAccessorDefinition>, PropertyAttributes attributes);
+
     void define_native_function(Realm&, PropertyKey const&, ESCAPING Function<ThrowCompletionOr<Value>(VM&)>, i32 length, PropertyAttributes attributes, Optional<Bytecode::Builtin> builtin = {});
     void define_native_accessor(Realm&, PropertyKey const&, ESCAPING Function<ThrowCompletionOr<Value>(VM&)> getter, ESCAPING Function<ThrowCompletionOr<Value>(VM&)> setter, PropertyAttributes attributes);
 
@@ -222,6 +229,10 @@ public:
     // B.3.7 The [[IsHTMLDDA]] Internal Slot, https://tc39.es/ecma262/#sec-IsHTMLDDA-internal-slot
     virtual bool is_htmldda() const { return false; }
 
+    // True for objects made by create(), create_prototype() or create_with_premade_shape(), rather than as an instance
+    // of a subclass. Such objects have ordinary internal methods, and no internal slots beyond those of every Object.
+    bool is_plain_object() const { return m_is_plain_object; }
+
     bool has_parameter_map() const { return m_has_parameter_map; }
     void set_has_parameter_map() { m_has_parameter_map = true; }
 
@@ -245,6 +256,7 @@ public:
     void set_prototype(Object*);
 
     [[nodiscard]] bool has_magical_length_property() const { return m_has_magical_length_property; }
+    [[nodiscard]] bool has_intrinsic_accessors() const { return m_has_intrinsic_accessors; }
 
     [[nodiscard]] bool is_typed_array() const { return m_is_typed_array; }
     void set_is_typed_array() { m_is_typed_array = true; }
@@ -284,6 +296,8 @@ private:
     // True if this object has lazily allocated intrinsic properties.
     bool m_has_intrinsic_accessors { false };
 
+    bool m_is_plain_object { false };
+
     GC::Ptr<Shape> m_shape;
     Vector<Value> m_storage;
     IndexedProperties m_indexed_properties;
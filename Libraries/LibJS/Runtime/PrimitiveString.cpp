@@ -28,6 +28,12 @@ RopeString::RopeString(GC::Ref<PrimitiveString> lhs, GC::Ref<PrimitiveString> rh
     , m_lhs(lhs)
     , m_rhs(rhs)
 {
+    auto depth_of = [](PrimitiveString const& string) -> u32 {
+        if (!string.m_is_rope)
+            return 0;
+        return static_cast<RopeString const&>(string).m_depth;
+    };
+    m_depth = max(depth_of(lhs), depth_of(rhs)) + 1;
 }
 
 RopeString::~RopeString() = default;
@@ -83,6 +89,13 @@ String PrimitiveString::utf8_string() const
     return *m_utf8_string;
 }
 
+FlyString PrimitiveString::utf8_fly_string() const
+{
+    FlyString fly_string { utf8_string() };
+    m_utf8_string = fly_string.to_string();
+    return fly_string;
+}
+
 StringView PrimitiveString::utf8_string_view() const
 {
     (void)utf8_string();
@@ -109,7 +122,29 @@ Utf16View PrimitiveString::utf16_string_view() const
 
 size_t PrimitiveString::length_in_utf16_code_units() const
 {
-    return utf16_string_view().length_in_code_units();
+    if (m_is_rope)
+        return static_cast<RopeString const&>(*this).length_in_utf16_code_units();
+    return utf16_string().length_in_code_units();
+}
+
+char16_t PrimitiveString::code_unit_at(size_t index) const
+{
+    if (m_is_rope && static_cast<RopeString const&>(*this).m_depth > RopeString::maximum_depth_for_indexed_access)
+        resolve_rope_if_needed(EncodingPreference::UTF16);
+
+    PrimitiveString const* current = this;
+    while (current->m_is_rope) {
+        auto const& rope_string = static_cast<RopeString const&>(*current);
+        auto lhs_length = rope_string.m_lhs->length_in_utf16_code_units();
+        if (index < lhs_length) {
+            current = rope_string.m_lhs;
+        } else {
+            index -= lhs_length;
+            current = rope_string.m_rhs;
+        }
+    }
+
+    return current->utf16_string().code_unit_at(index);
 }
 
 bool PrimitiveString::operator==(PrimitiveString const& other) const
@@ -135,11 +170,9 @@ ThrowCompletionOr<Optional<Value>> PrimitiveString::get(VM& vm, PropertyKey cons
     auto index = canonical_numeric_index_string(property_key, CanonicalIndexMode::IgnoreNumericRoundtrip);
     if (!index.is_index())
         return Optional<Value> {};
-    auto str = utf16_string_view();
-    auto length = str.length_in_code_units();
-    if (length <= index.as_index())
+    if (length_in_utf16_code_units() <= index.as_index())
         return Optional<Value> {};
-    return create(vm, Utf16String::create(str.substring_view(index.as_index(), 1)));
+    return create_from_code_unit(vm, code_unit_at(index.as_index()));
 }
 
 GC::Ref<PrimitiveString> PrimitiveString::create(VM& vm, Utf16String string)
@@ -192,6 +225,16 @@ GC::Ref<PrimitiveString> PrimitiveString::create(VM& vm, StringView string)
     return create(vm, String::from_utf8(string).release_value());
 }
 
+GC::Ref<PrimitiveString> PrimitiveString::create_from_code_unit(VM& vm, char16_t code_unit)
+{
+    if (is_ascii(code_unit))
+        return vm.single_ascii_character_string(static_cast<u8>(code_unit));
+
+    Utf16Data code_units;
+    code_units.append(code_unit);
+    return create(vm, Utf16String::create(move(code_units)));
+}
+
 GC::Ref<PrimitiveString> PrimitiveString::create(VM& vm, PrimitiveString& lhs, PrimitiveString& rhs)
 {
     // We're here to concatenate two strings into a new rope string.
@@ -221,6 +264,39 @@ void PrimitiveString::resolve_rope_if_needed(EncodingPreference preference) cons
     return rope_string.resolve(preference);
 }
 
+size_t RopeString::length_in_utf16_code_units() const
+{
+    if (m_length_in_utf16_code_units.has_value())
+        return *m_length_in_utf16_code_units;
+
+    // NOTE: Like resolve(), we avoid recursion here, since ropes built in a loop are very deep.
+    //       Every rope node along the way caches its length, so appending to a rope whose length
+    //       has been queried before only has to measure the newly appended piece.
+    auto needs_length = [](PrimitiveString const& string) {
+        return string.m_is_rope && !static_cast<RopeString const&>(string).m_length_in_utf16_code_units.has_value();
+    };
+
+    Vector<RopeString const*> stack;
+    stack.append(this);
+    while (!stack.is_empty()) {
+        auto const* current = stack.last();
+        bool children_have_length = true;
+        for (auto const* child : { current->m_lhs.ptr(), current->m_rhs.ptr() }) {
+            if (needs_length(*child)) {
+                stack.append(static_cast<RopeString const*>(child));
+                children_have_length = false;
+            }
+        }
+        if (!children_have_length)
+            continue;
+
+        current->m_length_in_utf16_code_units = current->m_lhs->length_in_utf16_code_units() + current->m_rhs->length_in_utf16_code_units();
+        stack.take_last();
+    }
+
+    return *m_length_in_utf16_code_units;
+}
+
 void RopeString::resolve(EncodingPreference preference) const
 {
 
@@ -253,8 +329,15 @@ void RopeString::resolve(EncodingPreference preference) const
         // into a UTF-16 code unit buffer and create a Utf16String from it.
 
         Utf16Data code_units;
-        for (auto const* current : pieces)
-            code_units.extend(current->utf16_string().string());
+        for (auto const* current : pieces) {
+            auto piece = current->utf16_string();
+            if (piece.is_latin1()) {
+                for (auto code_unit : piece.latin1_bytes())
+                    code_units.append(code_unit);
+            } else {
+                code_units.extend(piece.string());
+            }
+        }
 
         m_utf16_string = Utf16String::create(move(code_units));
         m_is_rope = false;
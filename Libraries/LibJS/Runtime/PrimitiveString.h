@@ -29,6 +29,7 @@ public:
     [[nodiscard]] static GC::Ref<PrimitiveString> create(VM&, FlyString const&);
     [[nodiscard]] static GC::Ref<PrimitiveString> create(VM&, PrimitiveString&, PrimitiveString&);
     [[nodiscard]] static GC::Ref<PrimitiveString> create(VM&, StringView);
+    [[nodiscard]] static GC::Ref<PrimitiveString> create_from_code_unit(VM&, char16_t);
 
     virtual ~PrimitiveString();
 
@@ -41,11 +42,16 @@ public:
     [[nodiscard]] StringView utf8_string_view() const;
     bool has_utf8_string() const { return m_utf8_string.has_value(); }
 
+    // Interns the UTF-8 string, and keeps the interned copy so that doing this again doesn't have to look it up.
+    [[nodiscard]] FlyString utf8_fly_string() const;
+
     [[nodiscard]] Utf16String utf16_string() const;
     [[nodiscard]] Utf16View utf16_string_view() const;
     bool has_utf16_string() const { return m_utf16_string.has_value(); }
 
+    // NOTE: Neither of these resolve a rope, unless it has become too deep to walk efficiently.
     size_t length_in_utf16_code_units() const;
+    char16_t code_unit_at(size_t index) const;
 
     ThrowCompletionOr<Optional<Value>> get(VM&, PropertyKey const&) const;
 
@@ -92,9 +98,15 @@ private:
     virtual void visit_edges(Visitor&) override;
 
     void resolve(EncodingPreference) const;
+    size_t length_in_utf16_code_units() const;
+
+    // Ropes deeper than this are resolved before indexing into them, rather than walked down to a leaf.
+    static constexpr u32 maximum_depth_for_indexed_access = 32;
 
     mutable GC::Ptr<PrimitiveString> m_lhs;
     mutable GC::Ptr<PrimitiveString> m_rhs;
+    mutable Optional<size_t> m_length_in_utf16_code_units;
+    u32 m_depth { 0 };
 };
 
 }
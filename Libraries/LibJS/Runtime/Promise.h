@@ -62,8 +62,9 @@ private:
     // 27.2.6 Properties of Promise Instances, https://tc39.es/ecma262/#sec-properties-of-promise-instances
     State m_state { State::Pending };                     // [[PromiseState]]
     Value m_result;                                       // [[PromiseResult]]
-    Vector<GC::Ptr<PromiseReaction>> m_fulfill_reactions; // [[PromiseFulfillReactions]]
-    Vector<GC::Ptr<PromiseReaction>> m_reject_reactions;  // [[PromiseRejectReactions]]
+    // NOTE: Most promises only ever get a single reaction of each kind, so we store one inline to avoid allocating.
+    Vector<GC::Ptr<PromiseReaction>, 1> m_fulfill_reactions; // [[PromiseFulfillReactions]]
+    Vector<GC::Ptr<PromiseReaction>, 1> m_reject_reactions;  // [[PromiseRejectReactions]]
     bool m_is_handled { false };                          // [[PromiseIsHandled]]
 };
 
@@ -72,9 +72,9 @@ public:
         m_builtins[to_underlying(builtin)] = value;
     }
 
-    GC::Ref<NativeFunction> get_builtin_value(Bytecode::Builtin builtin)
+    GC::Ptr<NativeFunction> get_builtin_value(Bytecode::Builtin builtin)
     {
-        return *m_builtins[to_underlying(builtin)];
+        return m_builtins[to_underlying(builtin)];
     }
 
 private:
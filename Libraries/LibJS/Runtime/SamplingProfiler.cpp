@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/StringBuilder.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/SourceRange.h>
+
+namespace JS {
+
+SamplingProfiler::SamplingProfiler(VM& vm, AK::Duration sampling_interval)
+    : m_vm(vm)
+    , m_sampling_interval(sampling_interval)
+    , m_start_time(MonotonicTime::now())
+    , m_end_time(m_start_time)
+    , m_next_sample_time(m_start_time + sampling_interval)
+{
+    m_frames.append({ .executable_index = {}, .program_counter = 0, .native_function_name = "(root)"_string });
+    m_nodes.append({ .frame_index = 0, .parent_index = {}, .children = {}, .self_sample_count = 0 });
+}
+
+SamplingProfiler::~SamplingProfiler() = default;
+
+void SamplingProfiler::stop()
+{
+    if (m_stopped)
+        return;
+    m_stopped = true;
+    m_end_time = MonotonicTime::now();
+}
+
+void SamplingProfiler::take_sample_if_due()
+{
+    m_polls_until_clock_check = polls_between_clock_checks;
+    if (m_stopped)
+        return;
+
+    auto now = MonotonicTime::now();
+    if (now < m_next_sample_time)
+        return;
+
+    take_sample(now);
+
+    // If we fell far behind (e.g. in a long-running native call), don't try to catch up with a burst of samples.
+    m_next_sample_time = max(m_next_sample_time + m_sampling_interval, now);
+}
+
+u32 SamplingProfiler::frame_index_for(ExecutionContext const& context)
+{
+    if (auto executable = context.executable) {
+        auto source_record = executable->source_map.get(context.program_counter);
+        FrameKey key { executable.ptr(), source_record.has_value() ? source_record->source_start_offset : 0 };
+        if (auto index = m_frame_indices.get(key); index.has_value())
+            return *index;
+
+        auto executable_index = m_executable_indices.ensure(executable.ptr(), [&] {
+            m_executables.append(GC::make_root(*executable));
+            return static_cast<u32>(m_executables.size() - 1);
+        });
+
+        auto frame_index = static_cast<u32>(m_frames.size());
+        m_frames.append({ .executable_index = executable_index, .program_counter = context.program_counter, .native_function_name = {} });
+        m_frame_indices.set(key, frame_index);
+        return frame_index;
+    }
+
+    auto name = context.function_name ? context.function_name->utf8_string() : "(native)"_string;
+    return m_native_frame_indices.ensure(name, [&] {
+        auto frame_index = static_cast<u32>(m_frames.size());
+        m_frames.append({ .executable_index = {}, .program_counter = 0, .native_function_name = name });
+        return frame_index;
+    });
+}
+
+void SamplingProfiler::take_sample(MonotonicTime now)
+{
+    u32 node_index = 0;
+    for (auto const* context : m_vm.execution_context_stack()) {
+        auto frame_index = frame_index_for(*context);
+        if (auto child = m_nodes[node_index].children.get(frame_index); child.has_value()) {
+            node_index = *child;
+            continue;
+        }
+        auto child_index = static_cast<u32>(m_nodes.size());
+        m_nodes.append({ .frame_index = frame_index, .parent_index = node_index, .children = {}, .self_sample_count = 0 });
+        m_nodes[node_index].children.set(frame_index, child_index);
+        node_index = child_index;
+    }
+
+    ++m_nodes[node_index].self_sample_count;
+    m_samples.append({ .node_index = node_index, .time = now });
+}
+
+SamplingProfiler::FrameLocation SamplingProfiler::location_of(Frame const& frame) const
+{
+    if (!frame.executable_index.has_value())
+        return { .function_name = frame.native_function_name, .url = {}, .line = -1, .column = -1 };
+
+    auto const& executable = *m_executables[*frame.executable_index];
+    FrameLocation location;
+    location.function_name = executable.name.is_empty() ? "(anonymous)"_string : executable.name.to_string();
+
+    auto unrealized_range = executable.source_range_at(frame.program_counter);
+    if (unrealized_range.source_code) {
+        auto range = unrealized_range.realize();
+        location.url = range.code->filename();
+        // .cpuprofile positions are zero-based, ours are one-based.
+        location.line = static_cast<i32>(range.start.line) - 1;
+        location.column = static_cast<i32>(range.start.column) - 1;
+    }
+    return location;
+}
+
+String SamplingProfiler::to_cpuprofile_json() const
+{
+    // Scripts are identified by URL; give each distinct URL a stable id.
+    HashMap<String, u32> script_ids;
+
+    JsonArray nodes;
+    for (size_t node_index = 0; node_index < m_nodes.size(); ++node_index) {
+        auto const& node = m_nodes[node_index];
+        auto location = location_of(m_frames[node.frame_index]);
+
+        u32 script_id = 0;
+        if (!location.url.is_empty())
+            script_id = script_ids.ensure(location.url, [&] { return static_cast<u32>(script_ids.size() + 1); });
+
+        JsonObject call_frame;
+        call_frame.set("functionName"sv, location.function_name);
+        call_frame.set("scriptId"sv, String::number(script_id));
+        call_frame.set("url"sv, location.url);
+        call_frame.set("lineNumber"sv, location.line);
+        call_frame.set("columnNumber"sv, location.column);
+
+        JsonArray children;
+        for (auto child_index : node.children)
+            children.must_append(child_index.value + 1);
+
+        JsonObject json_node;
+        // Node ids must be positive.
+        json_node.set("id"sv, static_cast<u32>(node_index + 1));
+        json_node.set("callFrame"sv, move(call_frame));
+        json_node.set("hitCount"sv, node.self_sample_count);
+        if (!children.is_empty())
+            json_node.set("children"sv, move(children));
+        nodes.must_append(move(json_node));
+    }
+
+    JsonArray samples;
+    JsonArray time_deltas;
+    auto previous_time = m_start_time;
+    for (auto const& sample : m_samples) {
+        samples.must_append(sample.node_index + 1);
+        time_deltas.must_append((sample.time - previous_time).to_microseconds());
+        previous_time = sample.time;
+    }
+
+    auto end_time = m_stopped ? m_end_time : MonotonicTime::now();
+
+    JsonObject profile;
+    profile.set("nodes"sv, move(nodes));
+    profile.set("startTime"sv, m_start_time.nanoseconds() / 1000);
+    profile.set("endTime"sv, end_time.nanoseconds() / 1000);
+    profile.set("samples"sv, move(samples));
+    profile.set("timeDeltas"sv, move(time_deltas));
+    return profile.serialized();
+}
+
+String SamplingProfiler::to_folded_stacks() const
+{
+    // Folded stacks have one "outermost;...;innermost count" line per distinct stack.
+    StringBuilder builder;
+    Vector<u32> stack;
+    for (size_t node_index = 1; node_index < m_nodes.size(); ++node_index) {
+        auto const& node = m_nodes[node_index];
+        if (node.self_sample_count == 0)
+            continue;
+
+        stack.clear_with_capacity();
+        for (Optional<u32> index = static_cast<u32>(node_index); index.has_value() && *index != 0; index = m_nodes[*index].parent_index)
+            stack.append(*index);
+
+        for (size_t i = stack.size(); i > 0; --i) {
+            auto location = location_of(m_frames[m_nodes[stack[i - 1]].frame_index]);
+            // ';' separates frames and ' ' separates the count, so neither can appear inside a frame name.
+            auto frame_name = location.function_name.replace(";"sv, ":"sv, ReplaceMode::All).release_value_but_fixme_should_propagate_errors();
+            frame_name = frame_name.replace(" "sv, "_"sv, ReplaceMode::All).release_value_but_fixme_should_propagate_errors();
+            builder.append(frame_name);
+            if (location.line >= 0) {
+                auto url = location.url.replace(" "sv, "_"sv, ReplaceMode::All).release_value_but_fixme_should_propagate_errors();
+                builder.appendff("@{}:{}", url, location.line + 1);
+            }
+            if (i > 1)
+                builder.append(';');
+        }
+        builder.appendff(" {}\n", node.self_sample_count);
+    }
+    return builder.to_string_without_validation();
+}
+
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibGC/Root.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+
+namespace JS {
+
+// A statistical profiler for JavaScript code running in the bytecode interpreter.
+//
+// Rather than interrupting the interpreter from a signal handler or another thread, the interpreter polls the
+// profiler at safepoints (entering an executable, and every jump, which includes every loop back-edge). The
+// profiler only looks at the clock every so often, and when the sampling interval has elapsed it records the
+// current execution context stack.
+//
+// Samples can be exported in the Chrome DevTools .cpuprofile format, or as folded stacks for flamegraph.pl.
+class JS_API SamplingProfiler {
+    AK_MAKE_NONCOPYABLE(SamplingProfiler);
+    AK_MAKE_NONMOVABLE(SamplingProfiler);
+
+public:
+    static constexpr AK::Duration default_sampling_interval = AK::Duration::from_milliseconds(1);
+
+    explicit SamplingProfiler(VM&, AK::Duration sampling_interval = default_sampling_interval);
+    ~SamplingProfiler();
+
+    ALWAYS_INLINE void poll()
+    {
+        if (--m_polls_until_clock_check == 0) [[unlikely]]
+            take_sample_if_due();
+    }
+
+    void stop();
+
+    size_t sample_count() const { return m_samples.size(); }
+
+    String to_cpuprofile_json() const;
+    String to_folded_stacks() const;
+
+private:
+    static constexpr u32 polls_between_clock_checks = 128;
+
+    struct Frame {
+        // Index into m_executables, or empty for native functions.
+        Optional<u32> executable_index;
+        size_t program_counter { 0 };
+        String native_function_name;
+    };
+
+    struct FrameKey {
+        Bytecode::Executable const* executable { nullptr };
+        u32 source_offset { 0 };
+
+        bool operator==(FrameKey const&) const = default;
+    };
+
+    struct Node {
+        u32 frame_index { 0 };
+        Optional<u32> parent_index;
+        HashMap<u32, u32> children;
+        u32 self_sample_count { 0 };
+    };
+
+    struct FrameLocation {
+        String function_name;
+        String url;
+        i32 line { -1 };
+        i32 column { -1 };
+    };
+
+    struct FrameKeyTraits : public DefaultTraits<FrameKey> {
+        static unsigned hash(FrameKey const& key) { return pair_int_hash(ptr_hash(key.executable), key.source_offset); }
+    };
+
+    void take_sample_if_due();
+    void take_sample(MonotonicTime);
+
+    u32 frame_index_for(ExecutionContext const&);
+    FrameLocation location_of(Frame const&) const;
+
+    VM& m_vm;
+    AK::Duration m_sampling_interval;
+    u32 m_polls_until_clock_check { polls_between_clock_checks };
+
+    MonotonicTime m_start_time;
+    MonotonicTime m_end_time;
+    MonotonicTime m_next_sample_time;
+    bool m_stopped { false };
+
+    Vector<GC::Root<Bytecode::Executable>> m_executables;
+    HashMap<Bytecode::Executable const*, u32> m_executable_indices;
+
+    Vector<Frame> m_frames;
+    HashMap<FrameKey, u32, FrameKeyTraits> m_frame_indices;
+    HashMap<String, u32> m_native_frame_indices;
+
+    // Node 0 is the synthetic root of the call tree.
+    Vector<Node> m_nodes;
+
+    struct Sample {
+        u32 node_index { 0 };
+        MonotonicTime time;
+    };
+    Vector<Sample> m_samples;
+};
+
+}
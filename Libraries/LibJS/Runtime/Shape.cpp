@@ -15,6 +15,17 @@ GC_DEFINE_ALLOCATOR(PrototypeChainValidity);
 
 static HashTable<GC::Ptr<Shape>> s_all_prototype_shapes;
 
+// Transition maps hold weak pointers to the shapes they lead to, and entries are only pruned when looked up.
+// Objects used as dictionaries produce lots of one-off transitions, so we also sweep out the dead entries
+// whenever a map has doubled in size.
+template<typename TransitionMap>
+static void prune_stale_transitions_if_needed(TransitionMap& transitions)
+{
+    if (transitions.size() < 16 || !is_power_of_two(transitions.size()))
+        return;
+    transitions.remove_all_matching([](auto const&, auto const& shape) { return !shape; });
+}
+
 Shape::~Shape()
 {
     if (m_is_prototype_shape)
@@ -39,7 +50,7 @@ GC::Ref<Shape> Shape::create_uncacheable_dictionary_transition()
 {
     auto new_shape = heap().allocate<Shape>(m_realm);
     new_shape->m_dictionary = true;
-    new_shape->m_cacheable = true;
+    new_shape->m_cacheable = false;
     new_shape->m_prototype = m_prototype;
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
     ensure_property_table();
@@ -110,6 +121,7 @@ GC::Ref<Shape> Shape::create_put_transition(PropertyKey const& property_key, Pro
     if (!m_is_prototype_shape) {
         if (!m_forward_transitions)
             m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
+        prune_stale_transitions_if_needed(*m_forward_transitions);
         m_forward_transitions->set(key, new_shape.ptr());
     }
     return new_shape;
@@ -125,6 +137,7 @@ GC::Ref<Shape> Shape::create_configure_transition(PropertyKey const& property_ke
     if (!m_is_prototype_shape) {
         if (!m_forward_transitions)
             m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
+        prune_stale_transitions_if_needed(*m_forward_transitions);
         m_forward_transitions->set(key, new_shape.ptr());
     }
     return new_shape;
@@ -141,6 +154,7 @@ GC::Ref<Shape> Shape::create_prototype_transition(Object* new_prototype)
     if (!m_is_prototype_shape) {
         if (!m_prototype_transitions)
             m_prototype_transitions = make<HashMap<GC::Ptr<Object>, WeakPtr<Shape>>>();
+        prune_stale_transitions_if_needed(*m_prototype_transitions);
         m_prototype_transitions->set(new_prototype, new_shape.ptr());
     }
     return new_shape;
@@ -159,6 +173,7 @@ Shape::Shape(Shape& previous_shape, PropertyKey const& property_key, PropertyAtt
     , m_property_count(transition_type == TransitionType::Put ? previous_shape.m_property_count + 1 : previous_shape.m_property_count)
     , m_attributes(attributes)
     , m_transition_type(transition_type)
+    , m_has_delete_transition_in_chain(previous_shape.m_has_delete_transition_in_chain)
 {
 }
 
@@ -169,6 +184,7 @@ Shape::Shape(Shape& previous_shape, PropertyKey const& property_key, TransitionT
     , m_prototype(previous_shape.m_prototype)
     , m_property_count(previous_shape.m_property_count - 1)
     , m_transition_type(transition_type)
+    , m_has_delete_transition_in_chain(true)
 {
     VERIFY(transition_type == TransitionType::Delete);
 }
@@ -179,6 +195,7 @@ Shape::Shape(Shape& previous_shape, Object* new_prototype)
     , m_prototype(new_prototype)
     , m_property_count(previous_shape.m_property_count)
     , m_transition_type(TransitionType::Prototype)
+    , m_has_delete_transition_in_chain(previous_shape.m_has_delete_transition_in_chain)
 {
 }
 
@@ -273,12 +290,20 @@ void Shape::ensure_property_table() const
 
 GC::Ref<Shape> Shape::create_delete_transition(PropertyKey const& property_key)
 {
+    // OPTIMIZATION: Deleting the property that was added last yields the same layout as the shape we came from,
+    //               so we can go back to it instead of growing the transition tree.
+    if (!m_is_prototype_shape && m_transition_type == TransitionType::Put && m_property_key == property_key && m_previous
+        && !m_previous->m_dictionary && m_previous->m_prototype == m_prototype) {
+        return *m_previous;
+    }
+
     if (auto existing_shape = get_or_prune_cached_delete_transition(property_key))
         return *existing_shape;
     auto new_shape = heap().allocate<Shape>(*this, property_key, TransitionType::Delete);
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
     if (!m_delete_transitions)
         m_delete_transitions = make<HashMap<PropertyKey, WeakPtr<Shape>>>();
+    prune_stale_transitions_if_needed(*m_delete_transitions);
     m_delete_transitions->set(property_key, new_shape.ptr());
     return new_shape;
 }
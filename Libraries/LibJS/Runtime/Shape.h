@@ -85,6 +85,7 @@ public:
     [[nodiscard]] bool is_uncacheable_dictionary() const { return m_dictionary && !m_cacheable; }
 
     [[nodiscard]] bool is_prototype_shape() const { return m_is_prototype_shape; }
+    [[nodiscard]] bool has_delete_transition_in_chain() const { return m_has_delete_transition_in_chain; }
     void set_prototype_shape();
 
     GC::Ptr<PrototypeChainValidity> prototype_chain_validity() const { return m_prototype_chain_validity; }
@@ -143,6 +144,7 @@ private:
     bool m_dictionary : 1 { false };
     bool m_cacheable : 1 { true };
     bool m_is_prototype_shape : 1 { false };
+    bool m_has_delete_transition_in_chain : 1 { false };
 };
 
 }
@@ -157,7 +157,7 @@ void StringPrototype::initialize(Realm& realm)
     // 22.1.3 Properties of the String Prototype Object, https://tc39.es/ecma262/#sec-properties-of-the-string-prototype-object
     define_native_function(realm, vm.names.at, at, 1, attr);
     define_native_function(realm, vm.names.charAt, char_at, 1, attr);
-    define_native_function(realm, vm.names.charCodeAt, char_code_at, 1, attr);
+    define_native_function(realm, vm.names.charCodeAt, char_code_at, 1, attr, Bytecode::Builtin::StringPrototypeCharCodeAt);
     define_native_function(realm, vm.names.codePointAt, code_point_at, 1, attr);
     define_native_function(realm, vm.names.concat, concat, 1, attr);
     define_native_function(realm, vm.names.endsWith, ends_with, 1, attr);
@@ -259,7 +259,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::at)
         return js_undefined();
 
     // 7. Return ? Get(O, ! ToString(𝔽(k))).
-    return PrimitiveString::create(vm, Utf16String::create(string->utf16_string_view().substring_view(index.value(), 1)));
+    return PrimitiveString::create_from_code_unit(vm, string->code_unit_at(index.value()));
 }
 
 // 22.1.3.2 String.prototype.charAt ( pos ), https://tc39.es/ecma262/#sec-string.prototype.charat
@@ -278,18 +278,29 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_at)
         return PrimitiveString::create(vm, String {});
 
     // 6. Return the substring of S from position to position + 1.
-    return PrimitiveString::create(vm, Utf16String::create(string->utf16_string_view().substring_view(position, 1)));
+    return PrimitiveString::create_from_code_unit(vm, string->code_unit_at(position));
 }
 
 // 22.1.3.3 String.prototype.charCodeAt ( pos ), https://tc39.es/ecma262/#sec-string.prototype.charcodeat
-JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_code_at)
+ThrowCompletionOr<Value> StringPrototype::char_code_at_impl(VM& vm, Value this_value, Value position_value)
 {
+    // OPTIMIZATION: Fast path for a primitive string indexed by an Int32.
+    if (this_value.is_string() && position_value.is_int32()) {
+        auto const& string = this_value.as_string();
+        auto position = position_value.as_i32();
+        if (position < 0 || static_cast<size_t>(position) >= string.length_in_utf16_code_units())
+            return js_nan();
+        return Value(string.code_unit_at(position));
+    }
+
     // 1. Let O be ? RequireObjectCoercible(this value).
+    auto object = TRY(require_object_coercible(vm, this_value));
+
     // 2. Let S be ? ToString(O).
-    auto string = TRY(primitive_string_from(vm));
+    auto string = TRY(object.to_primitive_string(vm));
 
     // 3. Let position be ? ToIntegerOrInfinity(pos).
-    auto position = TRY(vm.argument(0).to_integer_or_infinity(vm));
+    auto position = TRY(position_value.to_integer_or_infinity(vm));
 
     // 4. Let size be the length of S.
     // 5. If position < 0 or position ≥ size, return NaN.
@@ -297,7 +308,12 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_code_at)
         return js_nan();
 
     // 6. Return the Number value for the numeric value of the code unit at index position within the String S.
-    return Value(string->utf16_string_view().code_unit_at(position));
+    return Value(string->code_unit_at(position));
+}
+
+JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_code_at)
+{
+    return char_code_at_impl(vm, vm.this_value(), vm.argument(0));
 }
 
 // 22.1.3.4 String.prototype.codePointAt ( pos ), https://tc39.es/ecma262/#sec-string.prototype.codepointat
@@ -433,7 +449,8 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::includes)
     }
 
     // 10. Let index be StringIndexOf(S, searchStr, start).
-    auto index = string_index_of(string->utf16_string_view(), search_string->utf16_string_view(), start);
+    // OPTIMIZATION: Searching the strings directly lets us avoid widening Latin-1 strings to UTF-16.
+    auto index = string->utf16_string().find_code_unit_offset(search_string->utf16_string(), start);
 
     // 11. If index ≠ -1, return true.
     // 12. Return false.
@@ -450,8 +467,8 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::index_of)
     // 3. Let searchStr be ? ToString(searchString).
     auto search_string = TRY(vm.argument(0).to_primitive_string(vm));
 
-    auto utf16_string_view = string->utf16_string_view();
-    auto utf16_search_view = search_string->utf16_string_view();
+    auto utf16_string = string->utf16_string();
+    auto utf16_search_string = search_string->utf16_string();
 
     size_t start = 0;
     if (vm.argument_count() > 1) {
@@ -461,11 +478,12 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::index_of)
 
         // 6. Let len be the length of S.
         // 7. Let start be the result of clamping pos between 0 and len.
-        start = clamp(position, static_cast<double>(0), static_cast<double>(utf16_string_view.length_in_code_units()));
+        start = clamp(position, static_cast<double>(0), static_cast<double>(utf16_string.length_in_code_units()));
     }
 
     // 8. Return 𝔽(StringIndexOf(S, searchStr, start)).
-    auto index = string_index_of(utf16_string_view, utf16_search_view, start);
+    // OPTIMIZATION: Searching the strings directly lets us avoid widening Latin-1 strings to UTF-16.
+    auto index = utf16_string.find_code_unit_offset(utf16_search_string, start);
     return index.has_value() ? Value(*index) : Value(-1);
 }
 
@@ -548,15 +566,14 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::locale_compare)
     auto locales = vm.argument(1);
     auto options = vm.argument(2);
 
-    // OPTIMIZATION: If both locales and options are undefined, we can use a cached default-constructed Collator.
-    GC::Ptr<Object> collator;
-    if (locales.is_undefined() && options.is_undefined())
-        collator = realm.intrinsics().default_collator();
-    else
-        collator = TRY(construct(vm, realm.intrinsics().intl_collator_constructor(), locales, options));
+    // OPTIMIZATION: Sorting with localeCompare would construct a Collator for every comparison, so we reuse recently
+    //               constructed Collators whenever doing so is indistinguishable from constructing a new one.
+    auto collator = TRY(realm.intrinsics().collator_cache().get_or_create(Intl::ObjectCacheKey::for_arguments(locales, options), [&]() -> ThrowCompletionOr<GC::Ref<Intl::Collator>> {
+        return as<Intl::Collator>(*TRY(construct(vm, realm.intrinsics().intl_collator_constructor(), locales, options)));
+    }));
 
     // 5. Return CompareStrings(collator, S, thatValue).
-    return Intl::compare_strings(static_cast<Intl::Collator const&>(*collator), string, that_value);
+    return Intl::compare_strings(collator, string, that_value);
 }
 
 // 22.1.3.13 String.prototype.match ( regexp ), https://tc39.es/ecma262/#sec-string.prototype.match
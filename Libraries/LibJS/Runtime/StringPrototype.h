@@ -32,6 +32,8 @@ public:
     virtual void initialize(Realm&) override;
     virtual ~StringPrototype() override = default;
 
+    static ThrowCompletionOr<Value> char_code_at_impl(VM&, Value this_value, Value position);
+
 private:
     JS_DECLARE_NATIVE_FUNCTION(at);
     JS_DECLARE_NATIVE_FUNCTION(char_at);
@@ -9,6 +9,25 @@
 #include <LibJS/Runtime/VM.h>
 
 namespace JS {
+
+// NOTE: This is written without an early exit so that the compiler can vectorize it.
+static bool fits_in_latin1(ReadonlySpan<char16_t> code_units)
+{
+    char16_t all_bits = 0;
+    for (auto code_unit : code_units)
+        all_bits |= code_unit;
+    return all_bits <= 0xff;
+}
+
+static Vector<u8> narrow_to_latin1(ReadonlySpan<char16_t> code_units)
+{
+    Vector<u8> latin1_string;
+    latin1_string.resize(code_units.size());
+    for (size_t i = 0; i < code_units.size(); ++i)
+        latin1_string[i] = static_cast<u8>(code_units[i]);
+    return latin1_string;
+}
+
 namespace Detail {
 
 static NonnullRefPtr<Utf16StringImpl> the_empty_utf16_string()
@@ -22,6 +41,12 @@ Utf16StringImpl::Utf16StringImpl(Utf16Data string)
 {
 }
 
+Utf16StringImpl::Utf16StringImpl(Vector<u8> latin1_string)
+    : m_is_latin1(true)
+    , m_latin1_string(move(latin1_string))
+{
+}
+
 NonnullRefPtr<Utf16StringImpl> Utf16StringImpl::create()
 {
     return adopt_ref(*new Utf16StringImpl);
@@ -29,45 +54,116 @@ NonnullRefPtr<Utf16StringImpl> Utf16StringImpl::create()
 
 NonnullRefPtr<Utf16StringImpl> Utf16StringImpl::create(Utf16Data string)
 {
+    if (!string.is_empty() && fits_in_latin1(string.span()))
+        return adopt_ref(*new Utf16StringImpl(narrow_to_latin1(string.span())));
     return adopt_ref(*new Utf16StringImpl(move(string)));
 }
 
 NonnullRefPtr<Utf16StringImpl> Utf16StringImpl::create(StringView string)
 {
+    // OPTIMIZATION: ASCII is a subset of both UTF-8 and Latin-1, so most strings can be stored without any conversion.
+    if (!string.find_first_non_ascii_byte().has_value()) {
+        Vector<u8> latin1_string;
+        latin1_string.append(string.bytes().data(), string.length());
+        return adopt_ref(*new Utf16StringImpl(move(latin1_string)));
+    }
+
     auto result = MUST(utf8_to_utf16(string));
-    auto impl = create(move(result.data));
+    if (fits_in_latin1(result.data.span()))
+        return adopt_ref(*new Utf16StringImpl(narrow_to_latin1(result.data.span())));
+
+    auto impl = adopt_ref(*new Utf16StringImpl(move(result.data)));
     impl->m_cached_view.unsafe_set_code_point_length(result.code_point_count);
     return impl;
 }
 
 NonnullRefPtr<Utf16StringImpl> Utf16StringImpl::create(Utf16View const& view)
 {
+    if (!view.is_empty() && fits_in_latin1(view.span()))
+        return adopt_ref(*new Utf16StringImpl(narrow_to_latin1(view.span())));
+
     Utf16Data string;
     string.ensure_capacity(view.length_in_code_units());
     string.unchecked_append(view.span().data(), view.length_in_code_units());
 
-    auto impl = create(move(string));
+    auto impl = adopt_ref(*new Utf16StringImpl(move(string)));
     if (auto length_in_code_points = view.length_in_code_points_if_known(); length_in_code_points.has_value())
         impl->m_cached_view.unsafe_set_code_point_length(*length_in_code_points);
 
     return impl;
 }
 
+void Utf16StringImpl::widen_to_utf16() const
+{
+    VERIFY(m_is_latin1);
+
+    m_string.resize(m_latin1_string.size());
+    for (size_t i = 0; i < m_latin1_string.size(); ++i)
+        m_string[i] = m_latin1_string[i];
+
+    // Every Latin-1 character is a single code unit, so we know the code point length for free.
+    m_cached_view = Utf16View { m_string };
+    m_cached_view.unsafe_set_code_point_length(m_string.size());
+
+    m_latin1_string.clear();
+    m_is_latin1 = false;
+}
+
 Utf16Data const& Utf16StringImpl::string() const
 {
+    if (m_is_latin1)
+        widen_to_utf16();
     return m_string;
 }
 
 Utf16View Utf16StringImpl::view() const
 {
+    if (m_is_latin1)
+        widen_to_utf16();
     return m_cached_view;
 }
 
+template<typename CodeUnits>
+static u32 hash_code_units(CodeUnits const& code_units)
+{
+    // NOTE: The same string may be stored as Latin-1 or as UTF-16, so this has to hash code units rather than bytes.
+    u32 hash = 0;
+    for (auto code_unit : code_units) {
+        hash += static_cast<u32>(code_unit);
+        hash += (hash << 10);
+        hash ^= (hash >> 6);
+    }
+    hash += hash << 3;
+    hash ^= hash >> 11;
+    hash += hash << 15;
+    return hash;
+}
+
 u32 Utf16StringImpl::compute_hash() const
 {
-    if (m_string.is_empty())
+    if (length_in_code_units() == 0)
         return 0;
-    return string_hash((char const*)m_string.data(), m_string.size() * sizeof(u16));
+    if (m_is_latin1)
+        return hash_code_units(m_latin1_string);
+    return hash_code_units(m_string);
+}
+
+bool Utf16StringImpl::operator==(Utf16StringImpl const& other) const
+{
+    if (length_in_code_units() != other.length_in_code_units())
+        return false;
+    if (m_is_latin1 && other.m_is_latin1)
+        return m_latin1_string == other.m_latin1_string;
+    if (!m_is_latin1 && !other.m_is_latin1)
+        return m_string == other.m_string;
+
+    auto const& latin1_string = m_is_latin1 ? m_latin1_string : other.m_latin1_string;
+    auto const& utf16_string = m_is_latin1 ? other.m_string : m_string;
+    for (size_t i = 0; i < latin1_string.size(); ++i) {
+        if (latin1_string[i] != utf16_string[i])
+            return false;
+    }
+    return true;
 }
 
 }
@@ -125,27 +221,47 @@ Utf16View Utf16String::substring_view(size_t code_unit_offset) const
 
 String Utf16String::to_utf8() const
 {
+    if (is_latin1())
+        return MUST(String::from_latin1(latin1_bytes()));
     return MUST(view().to_utf8());
 }
 
 ByteString Utf16String::to_byte_string() const
 {
+    if (is_latin1())
+        return to_utf8().to_byte_string();
     return MUST(view().to_byte_string());
 }
 
 u16 Utf16String::code_unit_at(size_t index) const
 {
-    return view().code_unit_at(index);
+    return m_string->code_unit_at(index);
 }
 
 size_t Utf16String::length_in_code_units() const
 {
-    return view().length_in_code_units();
+    return m_string->length_in_code_units();
 }
 
 bool Utf16String::is_empty() const
 {
-    return view().is_empty();
+    return length_in_code_units() == 0;
+}
+
+Optional<size_t> Utf16String::find_code_unit_offset(Utf16String const& needle, size_t start_offset) const
+{
+    // OPTIMIZATION: Two Latin-1 strings can be searched as bytes, which is much faster than comparing code units.
+    if (is_latin1() && needle.is_latin1()) {
+        if (start_offset > length_in_code_units())
+            return {};
+        return StringView { latin1_bytes() }.find(StringView { needle.latin1_bytes() }, start_offset);
+    }
+
+    // A Latin-1 string can't contain any code units that don't fit into a byte, so don't widen it just to find that out.
+    if (is_latin1() && !fits_in_latin1(needle.view().span()))
+        return {};
+
+    return view().find_code_unit_offset(needle.view(), start_offset);
 }
 
 }
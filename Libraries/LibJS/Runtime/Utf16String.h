@@ -29,6 +29,18 @@ public:
     Utf16Data const& string() const;
     Utf16View view() const;
 
+    // Strings whose code units all fit into a single byte are stored as Latin-1, which halves their size. They are
+    // widened to UTF-16 the first time somebody asks for their code units as UTF-16.
+    [[nodiscard]] bool is_latin1() const { return m_is_latin1; }
+    [[nodiscard]] ReadonlyBytes latin1_bytes() const
+    {
+        VERIFY(m_is_latin1);
+        return m_latin1_string.span();
+    }
+
+    [[nodiscard]] size_t length_in_code_units() const { return m_is_latin1 ? m_latin1_string.size() : m_string.size(); }
+    [[nodiscard]] u16 code_unit_at(size_t index) const { return m_is_latin1 ? m_latin1_string[index] : m_string[index]; }
+
     [[nodiscard]] u32 hash() const
     {
         if (!m_has_hash) {
@@ -37,18 +49,22 @@ public:
         }
         return m_hash;
     }
-    [[nodiscard]] bool operator==(Utf16StringImpl const& other) const { return string() == other.string(); }
+    [[nodiscard]] bool operator==(Utf16StringImpl const& other) const;
 
 private:
     Utf16StringImpl() = default;
     explicit Utf16StringImpl(Utf16Data string);
+    explicit Utf16StringImpl(Vector<u8> latin1_string);
 
     [[nodiscard]] u32 compute_hash() const;
+    void widen_to_utf16() const;
 
     mutable bool m_has_hash { false };
+    mutable bool m_is_latin1 { false };
     mutable u32 m_hash { 0 };
-    Utf16Data m_string;
-    Utf16View m_cached_view { m_string };
+    mutable Vector<u8> m_latin1_string;
+    mutable Utf16Data m_string;
+    mutable Utf16View m_cached_view { m_string };
 };
 
 }
@@ -74,6 +90,11 @@ public:
     bool is_empty() const;
     bool is_valid() const { return m_string; }
 
+    [[nodiscard]] bool is_latin1() const { return m_string->is_latin1(); }
+    [[nodiscard]] ReadonlyBytes latin1_bytes() const { return m_string->latin1_bytes(); }
+
+    Optional<size_t> find_code_unit_offset(Utf16String const& needle, size_t start_offset = 0) const;
+
     [[nodiscard]] u32 hash() const { return m_string->hash(); }
     [[nodiscard]] bool operator==(Utf16String const& other) const
     {
@@ -13,6 +13,7 @@
 #include <AK/String.h>
 #include <AK/StringBuilder.h>
 #include <AK/Time.h>
+#include <LibCore/MemoryReporting.h>
 #include <LibFileSystem/FileSystem.h>
 #include <LibJS/AST.h>
 #include <LibJS/Bytecode/Interpreter.h>
@@ -29,6 +30,7 @@
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/Reference.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/Symbol.h>
 #include <LibJS/Runtime/Temporal/Instant.h>
 #include <LibJS/Runtime/VM.h>
@@ -71,6 +73,22 @@ VM::VM(ErrorMessages error_messages)
 {
     m_bytecode_interpreter = make<Bytecode::Interpreter>(*this);
 
+    // Execution contexts on our stacks are rooted precisely by gather_roots(), so the heap doesn't need to scan
+    // the ones that were allocated on the native stack conservatively.
+    m_heap.set_gather_precisely_rooted_stack_ranges([this](Vector<ReadonlyBytes>& ranges) {
+        auto add_ranges_for_execution_context_stack = [&ranges](Vector<ExecutionContext*> const& stack) {
+            for (auto* execution_context : stack) {
+                auto values = execution_context->registers_and_constants_and_locals_and_arguments_span();
+                auto const* begin = reinterpret_cast<u8 const*>(execution_context);
+                auto const* end = reinterpret_cast<u8 const*>(values.data() + values.size());
+                ranges.append({ begin, static_cast<size_t>(end - begin) });
+            }
+        };
+        add_ranges_for_execution_context_stack(m_execution_context_stack);
+        for (auto& saved_stack : m_saved_execution_context_stacks)
+            add_ranges_for_execution_context_stack(saved_stack);
+    });
+
     m_empty_string = m_heap.allocate<PrimitiveString>(String {});
 
     cached_strings = {
@@ -200,9 +218,17 @@ VM::VM(ErrorMessages error_messages)
     // AD-HOC: Inform the host that we received a date string we were unable to parse.
     host_unrecognized_date_string = [](StringView) {
     };
+
+    m_memory_reporter_id = Core::MemoryReporting::register_reporter([this](Core::MemoryReports& reports) {
+        reports.add("js/script-cache"_string, m_script_cache_size, m_script_cache.size());
+        Bytecode::Executable::report_memory_usage(reports);
+    });
 }
 
-VM::~VM() = default;
+VM::~VM()
+{
+    Core::MemoryReporting::unregister_reporter(m_memory_reporter_id);
+}
 
 String const& VM::error_message(ErrorMessage type) const
 {
@@ -260,7 +286,7 @@ void VM::gather_roots(HashMap<GC::Cell*, GC::HeapRoot>& roots)
             ExecutionContextRootsCollector visitor;
             execution_context->visit_edges(visitor);
             for (auto cell : visitor.roots)
-                roots.set(cell, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+                roots.set(cell, GC::HeapRoot { .type = GC::HeapRoot::Type::ExecutionContext });
         }
     };
     gather_roots_from_execution_context_stack(m_execution_context_stack);
@@ -477,6 +503,102 @@ void VM::dump_backtrace() const
     }
 }
 
+void VM::set_track_allocation_sites(bool track_allocation_sites)
+{
+    if (!track_allocation_sites) {
+        m_heap.set_allocation_site_tracker({});
+        return;
+    }
+
+    m_heap.set_allocation_site_tracker([this]() -> Optional<String> {
+        for (ssize_t i = m_execution_context_stack.size() - 1; i >= 0; --i) {
+            auto const& frame = m_execution_context_stack[i];
+            if (!frame->executable)
+                continue;
+            auto unrealized_source_range = frame->executable->source_range_at(frame->program_counter);
+            if (!unrealized_source_range.source_code)
+                return {};
+            auto source_range = unrealized_source_range.realize();
+            return MUST(String::formatted("{}:{}:{}", source_range.filename(), source_range.start.line, source_range.start.column));
+        }
+        return {};
+    });
+}
+
+void VM::start_sampling_profiler(AK::Duration sampling_interval)
+{
+    m_sampling_profiler = make<SamplingProfiler>(*this, sampling_interval);
+}
+
+OwnPtr<SamplingProfiler> VM::stop_sampling_profiler()
+{
+    if (m_sampling_profiler)
+        m_sampling_profiler->stop();
+    return move(m_sampling_profiler);
+}
+
+Optional<String> VM::script_cache_partition(Realm& realm)
+{
+    if (!host_get_script_cache_partition)
+        return String {};
+    return host_get_script_cache_partition(realm);
+}
+
+RefPtr<Program> VM::cached_script_parse_node(Realm& realm, StringView source_text, StringView filename, size_t line_number_offset)
+{
+    auto partition = script_cache_partition(realm);
+    if (!partition.has_value())
+        return {};
+
+    auto source_hash = source_text.hash();
+    for (size_t i = 0; i < m_script_cache.size(); ++i) {
+        auto& entry = m_script_cache[i];
+        if (entry.source_hash != source_hash || entry.source_size != source_text.length() || entry.line_number_offset != line_number_offset)
+            continue;
+        if (entry.partition != *partition)
+            continue;
+        auto const& source_code = entry.parse_node->source_code();
+        if (source_code.filename() != filename || source_code.code() != source_text)
+            continue;
+
+        // Keep the most recently used scripts at the end, as those are evicted last.
+        auto parse_node = entry.parse_node;
+        m_script_cache.append(m_script_cache.take(i));
+        return parse_node;
+    }
+    return {};
+}
+
+void VM::cache_script_parse_node(Realm& realm, StringView source_text, NonnullRefPtr<Program> parse_node, size_t line_number_offset)
+{
+    if (source_text.length() < minimum_cached_script_size || source_text.length() > maximum_script_cache_size)
+        return;
+
+    auto partition = script_cache_partition(realm);
+    if (!partition.has_value())
+        return;
+
+    m_script_cache_size += source_text.length();
+    while (!m_script_cache.is_empty() && (m_script_cache_size > maximum_script_cache_size || m_script_cache.size() >= maximum_script_cache_entry_count)) {
+        auto evicted = m_script_cache.take_first();
+        m_script_cache_size -= evicted.source_size;
+    }
+
+    m_script_cache.append({
+        .partition = partition.release_value(),
+        .source_hash = source_text.hash(),
+        .source_size = source_text.length(),
+        .line_number_offset = line_number_offset,
+        .parse_node = move(parse_node),
+    });
+}
+
+void VM::clear_script_cache()
+{
+    m_script_cache.clear();
+    m_script_cache_size = 0;
+}
+
 void VM::save_execution_context_stack()
 {
     m_saved_execution_context_stacks.append(move(m_execution_context_stack));
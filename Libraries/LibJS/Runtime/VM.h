@@ -57,6 +57,14 @@ public:
 
     void dump_backtrace() const;
 
+    // Records the source location of the innermost JS frame for every heap allocation, see Heap::set_allocation_site_tracker().
+    void set_track_allocation_sites(bool);
+
+    // While a sampling profiler is active, the bytecode interpreter polls it at every safepoint.
+    void start_sampling_profiler(AK::Duration sampling_interval);
+    OwnPtr<SamplingProfiler> stop_sampling_profiler();
+    SamplingProfiler* sampling_profiler() { return m_sampling_profiler.ptr(); }
+
     void gather_roots(HashMap<GC::Cell*, GC::HeapRoot>&);
 
 #define __JS_ENUMERATE(SymbolName, snake_name)             \
@@ -291,8 +299,24 @@ public:
     Function<ThrowCompletionOr<void>(Realm&, NonnullOwnPtr<ExecutionContext>, ShadowRealm&)> host_initialize_shadow_realm;
     Function<Crypto::SignedBigInteger(Object const& global)> host_system_utc_epoch_nanoseconds;
 
+    // Returns the partition of the script cache that scripts parsed in the given realm go into, or nothing if they
+    // shouldn't be cached at all. Without this hook, all realms share one partition.
+    Function<Optional<String>(Realm&)> host_get_script_cache_partition;
+
     Vector<StackTraceElement> stack_trace() const;
 
+    // Parsed scripts are kept around by source text, so that loading the same (large) script again, e.g. a library on
+    // the next navigation, can skip parsing. Since bytecode for functions is cached on their AST nodes, it also skips codegen.
+    // Entries are partitioned by host_get_script_cache_partition, so that realms only ever get parse nodes back that
+    // were parsed in the same partition.
+    RefPtr<Program> cached_script_parse_node(Realm&, StringView source_text, StringView filename, size_t line_number_offset);
+    void cache_script_parse_node(Realm&, StringView source_text, NonnullRefPtr<Program>, size_t line_number_offset);
+    void clear_script_cache();
+    size_t script_cache_entry_count() const { return m_script_cache.size(); }
+    static constexpr size_t minimum_cached_script_size = 16 * KiB;
+    static constexpr size_t maximum_script_cache_size = 64 * MiB;
+    static constexpr size_t maximum_script_cache_entry_count = 128;
+
 private:
     using ErrorMessages = AK::Array<String, to_underlying(ErrorMessage::__Count)>;
 
@@ -312,6 +336,21 @@ private:
 
     void run_queued_promise_jobs_impl();
 
+    Optional<String> script_cache_partition(Realm&);
+
+    struct CachedScriptParseNode {
+        String partition;
+        u32 source_hash { 0 };
+        size_t source_size { 0 };
+        size_t line_number_offset { 0 };
+        NonnullRefPtr<Program> parse_node;
+    };
+    // Ordered from least to most recently used.
+    Vector<CachedScriptParseNode> m_script_cache;
+    size_t m_script_cache_size { 0 };
+
+    int m_memory_reporter_id { 0 };
+
     HashMap<String, GC::Ptr<PrimitiveString>> m_string_cache;
     HashMap<Utf16String, GC::Ptr<PrimitiveString>> m_utf16_string_cache;
 
@@ -354,6 +393,8 @@ private:
 
     OwnPtr<Bytecode::Interpreter> m_bytecode_interpreter;
 
+    OwnPtr<SamplingProfiler> m_sampling_profiler;
+
     bool m_dynamic_imports_allowed { false };
 };
 
@@ -17,6 +17,14 @@ GC_DEFINE_ALLOCATOR(Script);
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
 Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
+    auto& vm = realm.vm();
+
+    // Non-standard: Reuse the parse node of a script with the same source text, if we've seen one recently.
+    if (source_text.length() >= VM::minimum_cached_script_size) {
+        if (auto cached_script = vm.cached_script_parse_node(realm, source_text, filename, line_number_offset))
+            return realm.heap().allocate<Script>(realm, filename, cached_script.release_nonnull(), host_defined);
+    }
+
     // 1. Let script be ParseText(sourceText, Script).
     auto parser = Parser(Lexer(source_text, filename, line_number_offset));
     auto script = parser.parse_program();
@@ -25,6 +33,8 @@ Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_tex
     if (parser.has_errors())
         return parser.errors();
 
+    vm.cache_script_parse_node(realm, source_text, script, line_number_offset);
+
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
     return realm.heap().allocate<Script>(realm, filename, move(script), host_defined);
 }
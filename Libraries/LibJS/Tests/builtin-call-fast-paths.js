@@ -0,0 +1,73 @@
+test("Math builtins with two arguments", () => {
+    expect(Math.max(1, 2)).toBe(2);
+    expect(Math.max(-0, 0)).toBe(0);
+    expect(Math.max(0, -0)).toBe(0);
+    expect(Math.max(1, NaN)).toBeNaN();
+    expect(Math.max("3", 2.5)).toBe(3);
+    expect(Math.min(1, 2)).toBe(1);
+    expect(Math.min(0, -0)).toBe(-0);
+    expect(Math.min(-0, 0)).toBe(-0);
+    expect(Math.min(NaN, 1)).toBeNaN();
+    expect(Math.trunc(-4.7)).toBe(-4);
+    expect(Math.trunc(12)).toBe(12);
+    expect(Math.sign(-12)).toBe(-1);
+    expect(Math.sign(-0)).toBe(-0);
+    expect(Math.sign(0.5)).toBe(1);
+});
+
+test("Math.max still coerces both arguments in order", () => {
+    const log = [];
+    const a = { valueOf: () => (log.push("a"), NaN) };
+    const b = { valueOf: () => (log.push("b"), 1) };
+    expect(Math.max(a, b)).toBeNaN();
+    expect(log).toEqual(["a", "b"]);
+});
+
+test("charCodeAt on arbitrary receivers", () => {
+    const s = "abc";
+    expect(s.charCodeAt(1)).toBe(98);
+    expect(s.charCodeAt(3)).toBeNaN();
+    expect(s.charCodeAt(-1)).toBeNaN();
+    expect(s.charCodeAt(1.9)).toBe(98);
+    expect(new String("xyz").charCodeAt(0)).toBe(120);
+
+    const fake = { charCodeAt: () => "not a builtin" };
+    expect(fake.charCodeAt(0)).toBe("not a builtin");
+
+    expect(() => {
+        String.prototype.charCodeAt.call(null, 0);
+    }).toThrow(TypeError);
+});
+
+test("push on arrays and array-likes", () => {
+    const a = [];
+    for (let i = 0; i < 5; ++i) expect(a.push(i * 2)).toBe(i + 1);
+    expect(a).toEqual([0, 2, 4, 6, 8]);
+
+    const frozen = Object.freeze([1]);
+    expect(() => {
+        frozen.push(2);
+    }).toThrow(TypeError);
+
+    const arrayLike = { length: 2, push: Array.prototype.push };
+    expect(arrayLike.push("x")).toBe(3);
+    expect(arrayLike[2]).toBe("x");
+});
+
+test("push respects setters on the prototype chain", () => {
+    let setterValue;
+    Object.defineProperty(Array.prototype, 0, {
+        set(value) {
+            setterValue = value;
+        },
+        configurable: true,
+    });
+    try {
+        const a = [];
+        expect(a.push("hello")).toBe(1);
+        expect(setterValue).toBe("hello");
+        expect(a.hasOwnProperty(0)).toBeFalse();
+    } finally {
+        delete Array.prototype[0];
+    }
+});
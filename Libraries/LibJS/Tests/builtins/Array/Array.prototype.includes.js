@@ -26,3 +26,33 @@ test("is unscopable", () => {
         }).toThrowWithMessage(ReferenceError, "'includes' is not defined");
     }
 });
+
+test("arrays whose elements change from integers to other numbers and values", () => {
+    const array = [1, 2, 3];
+    expect(array.includes(2)).toBeTrue();
+    expect(array.includes(2.0)).toBeTrue();
+    expect(array.includes("2")).toBeFalse();
+    expect(array.includes(NaN)).toBeFalse();
+
+    array.push(NaN, -0, 1.5);
+    expect(array.includes(NaN)).toBeTrue();
+    expect(array.includes(0)).toBeTrue();
+    expect(array.includes(1.5)).toBeTrue();
+    expect(array.includes(undefined)).toBeFalse();
+
+    array[1] = "2";
+    expect(array.includes(2)).toBeFalse();
+    expect(array.includes("2")).toBeTrue();
+    expect(array.includes(NaN)).toBeTrue();
+});
+
+test("holes are treated as undefined", () => {
+    const array = [1, , 3];
+    expect(array.includes(undefined)).toBeTrue();
+    Array.prototype[1] = 2;
+    try {
+        expect(array.includes(2)).toBeTrue();
+    } finally {
+        delete Array.prototype[1];
+    }
+});
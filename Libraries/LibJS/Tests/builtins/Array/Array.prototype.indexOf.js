@@ -23,3 +23,23 @@ test("basic functionality", () => {
     expect([].indexOf()).toBe(-1);
     expect([undefined].indexOf()).toBe(0);
 });
+
+test("arrays whose elements change from integers to other numbers and values", () => {
+    const array = [1, 2, 3, 2];
+    expect(array.indexOf(2)).toBe(1);
+    expect(array.lastIndexOf(2)).toBe(3);
+    expect(array.indexOf("2")).toBe(-1);
+
+    array.push(NaN, -0, 1.5);
+    expect(array.indexOf(NaN)).toBe(-1);
+    expect(array.lastIndexOf(NaN)).toBe(-1);
+    expect(array.indexOf(0)).toBe(5);
+    expect(array.lastIndexOf(1.5)).toBe(6);
+    expect(array.indexOf(1.5, -1)).toBe(6);
+
+    const object = {};
+    array.push(object, "2");
+    expect(array.indexOf(object)).toBe(7);
+    expect(array.indexOf("2")).toBe(8);
+    expect(array.lastIndexOf(2)).toBe(3);
+});
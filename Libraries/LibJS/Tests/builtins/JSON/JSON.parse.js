@@ -74,3 +74,37 @@ test("does not truncate large integers", () => {
     expect(JSON.parse("18446744073709551616")).toEqual(18446744073709551616);
     expect(JSON.parse("18446744073709551617")).toEqual(18446744073709551617);
 });
+
+test("consecutive objects with the same or differing keys", () => {
+    const records = JSON.parse(`[
+        { "id": 1, "name": "a", "tags": { "x": 1 } },
+        { "id": 2, "name": "b", "tags": { "x": 2 } },
+        { "id": 3, "name": "c" },
+        { "id": 4, "name": "d", "tags": { "y": 3 }, "extra": true },
+        { "name": "e", "id": 5 },
+        { "id": 6, "id": 7, "name": "f" },
+        { "id": 8, "0": "zero", "name": "g" },
+        {},
+        { "id": 9, "name": "h", "tags": null }
+    ]`);
+
+    expect(records).toHaveLength(9);
+    expect(Object.keys(records[0])).toEqual(["id", "name", "tags"]);
+    expect(records[0].tags.x).toBe(1);
+    expect(records[1]).toEqual({ id: 2, name: "b", tags: { x: 2 } });
+    expect(Object.keys(records[2])).toEqual(["id", "name"]);
+    expect(records[2].tags).toBeUndefined();
+    expect(Object.keys(records[3])).toEqual(["id", "name", "tags", "extra"]);
+    expect(records[3].tags.y).toBe(3);
+    expect(records[3].tags.x).toBeUndefined();
+    expect(Object.keys(records[4])).toEqual(["name", "id"]);
+    expect(records[5]).toEqual({ id: 7, name: "f" });
+    expect(Object.keys(records[6])).toEqual(["0", "id", "name"]);
+    expect(Object.keys(records[7])).toEqual([]);
+    expect(records[8]).toEqual({ id: 9, name: "h", tags: null });
+
+    records[1].id = 10;
+    expect(records[0].id).toBe(1);
+    delete records[0].name;
+    expect(records[1].name).toBe("b");
+});
@@ -28,3 +28,33 @@ test("basic functionality", () => {
         '{"0":0,"1":1,"2":2,"key2":"key2","defined":"defined","key4":"key4","key1":"key1"}'
     );
 });
+
+test("objects sharing a shape", () => {
+    let objects = [];
+    for (let i = 0; i < 3; ++i) objects.push({ a: i, "b\n": "x", c: undefined, d: [i] });
+    Object.defineProperty(objects[1], "e", { value: "hidden", enumerable: false });
+
+    expect(JSON.stringify(objects)).toBe(
+        '[{"a":0,"b\\n":"x","d":[0]},{"a":1,"b\\n":"x","d":[1]},{"a":2,"b\\n":"x","d":[2]}]'
+    );
+    expect(JSON.stringify(objects.slice(0, 2), null, 1)).toBe(
+        '[\n {\n  "a": 0,\n  "b\\n": "x",\n  "d": [\n   0\n  ]\n },\n {\n  "a": 1,\n  "b\\n": "x",\n  "d": [\n   1\n  ]\n }\n]'
+    );
+});
+
+test("properties changed while serializing", () => {
+    let proto = { b: "from prototype" };
+    let o = Object.create(proto);
+    o.a = {
+        toJSON() {
+            delete o.b;
+            o.c = "changed";
+            o.d = "added";
+            return "a";
+        },
+    };
+    o.b = "own";
+    o.c = "original";
+
+    expect(JSON.stringify(o)).toBe('{"a":"a","b":"from prototype","c":"changed"}');
+});
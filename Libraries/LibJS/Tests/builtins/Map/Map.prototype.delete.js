@@ -82,4 +82,44 @@ describe("modification with active iterators", () => {
         expect(iterator.next()).toBeIteratorResultDone();
         expect(iterator.next()).toBeIteratorResultDone();
     });
+
+    test("iterator keeps its place when many deleted elements are compacted away", () => {
+        const map = new Map();
+        for (let i = 0; i < 100; ++i) map.set(i, i);
+
+        const iterator = map.keys();
+        for (let i = 0; i < 50; ++i) expect(iterator.next()).toBeIteratorResultWithValue(i);
+
+        for (let i = 0; i < 50; ++i) expect(map.delete(i)).toBeTrue();
+        for (let i = 50; i < 90; i += 2) expect(map.delete(i)).toBeTrue();
+        map.set("new", "new");
+
+        const remaining = [];
+        for (let result = iterator.next(); !result.done; result = iterator.next())
+            remaining.push(result.value);
+
+        const expected = [];
+        for (let i = 50; i < 100; ++i) {
+            if (i >= 90 || i % 2 === 1) expected.push(i);
+        }
+        expected.push("new");
+        expect(remaining).toEqual(expected);
+        expect(map).toHaveSize(31);
+    });
+
+    test("clearing the map while iterating continues with newly added elements", () => {
+        const map = new Map([
+            [1, 2],
+            [3, 4],
+        ]);
+        const iterator = map.entries();
+
+        expect(iterator.next()).toBeIteratorResultWithValue([1, 2]);
+
+        map.clear();
+        map.set(5, 6);
+
+        expect(iterator.next()).toBeIteratorResultWithValue([5, 6]);
+        expect(iterator.next()).toBeIteratorResultDone();
+    });
 });
@@ -29,3 +29,22 @@ test("UTF-16", () => {
     expect(s.indexOf("\ude00")).toBe(1);
     expect(s.indexOf("a")).toBe(-1);
 });
+
+test("Latin-1", () => {
+    var s = "café crème";
+    expect(s.indexOf("crème")).toBe(5);
+    expect(s.indexOf("é", 4)).toBe(7);
+    expect(s.indexOf("")).toBe(0);
+    expect(s.indexOf("", 10)).toBe(10);
+    expect(s.indexOf("", 11)).toBe(10);
+    expect(s.indexOf("€")).toBe(-1);
+    expect(s.indexOf("crème€")).toBe(-1);
+
+    // Mix strings that contain code units above U+00FF with ones that don't.
+    var wide = "€ café";
+    expect(wide.indexOf("café")).toBe(2);
+    expect(wide.slice(2) === "café").toBeTrue();
+    expect((s + wide).indexOf("crème€")).toBe(5);
+    expect((s + wide).length).toBe(16);
+    expect((s + wide)[10]).toBe("€");
+});
@@ -37,3 +37,18 @@ test("UTF-16", () => {
     expect(s.localeCompare("\ud83d") > 0);
     expect(s.localeCompare("😀😀s") < 0);
 });
+
+test("locales", () => {
+    // Collators that are constructed from just a locale may be reused, which must not affect the results.
+    for (let i = 0; i < 3; ++i) {
+        expect("ä".localeCompare("z", "de")).toBe(-1);
+        expect("ä".localeCompare("z", "sv")).toBe(1);
+        expect("ä".localeCompare("z")).toBe(-1);
+        expect("a".localeCompare("A", "en", { caseFirst: "upper" })).toBe(1);
+        expect("a".localeCompare("A", "en")).toBe(-1);
+
+        expect(() => {
+            "a".localeCompare("b", "");
+        }).toThrowWithMessage(RangeError, " is not a structurally valid language tag");
+    }
+});
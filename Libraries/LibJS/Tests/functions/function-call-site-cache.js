@@ -0,0 +1,27 @@
+test("call site switching between callees", () => {
+    function makeAdder(n) {
+        return (a, b, c) => a + b + (c === undefined ? n : c);
+    }
+
+    const callees = [
+        makeAdder(1),
+        makeAdder(2),
+        Math.max,
+        function (a, b, c, d, e) {
+            return [a, b, c, d, e].length + (d === undefined ? 100 : 0);
+        },
+    ];
+
+    const results = [];
+    for (let i = 0; i < 12; ++i) results.push(callees[i % callees.length](i, 1));
+
+    expect(results).toEqual([2, 4, 2, 105, 6, 8, 6, 105, 10, 12, 10, 105]);
+});
+
+test("class constructors at a cached call site still throw", () => {
+    class C {}
+    const targets = [function () {}, C];
+    expect(() => {
+        for (const target of targets) target();
+    }).toThrowWithMessage(TypeError, "Class constructor C must be called with 'new'");
+});
@@ -16,3 +16,109 @@ test("Inline cache invalidated by deleting property from unique shape", () => {
     expect(first).toBe(2);
     expect(second).toBeUndefined();
 });
+
+test("Megamorphic property access sites see the right values", () => {
+    let objects = [];
+    for (let i = 0; i < 16; ++i) {
+        let o = {};
+        o["pad" + i] = i;
+        o.x = i;
+        objects.push(o);
+    }
+
+    function get(o) {
+        return o.x;
+    }
+
+    function put(o, value) {
+        o.x = value;
+    }
+
+    for (let round = 0; round < 3; ++round) {
+        for (let i = 0; i < objects.length; ++i) {
+            expect(get(objects[i])).toBe(i + round);
+            put(objects[i], i + round + 1);
+        }
+    }
+
+    delete objects[3].x;
+    expect(get(objects[3])).toBeUndefined();
+});
+
+test("Megamorphic put does not write through non-writable or accessor properties", () => {
+    let objects = [];
+    for (let i = 0; i < 8; ++i) {
+        let o = {};
+        o["pad" + i] = i;
+        o.y = i;
+        objects.push(o);
+    }
+
+    let setter_calls = 0;
+    let with_accessor = {
+        set y(value) {
+            ++setter_calls;
+        },
+    };
+    let frozen = Object.freeze({ y: 1 });
+
+    function put(o, value) {
+        o.y = value;
+    }
+
+    for (let round = 0; round < 3; ++round) {
+        for (const o of objects) put(o, round);
+        put(with_accessor, round);
+        put(frozen, round);
+    }
+
+    expect(setter_calls).toBe(3);
+    expect(frozen.y).toBe(1);
+    expect(objects[5].y).toBe(2);
+});
+
+test("Deleting the most recently added property and adding it back", () => {
+    function get(o) {
+        return o.z;
+    }
+
+    let o = { x: 1, y: 2 };
+    for (let i = 0; i < 4; ++i) {
+        o.z = i;
+        expect(get(o)).toBe(i);
+        delete o.z;
+        expect(get(o)).toBeUndefined();
+        expect(Object.keys(o)).toEqual(["x", "y"]);
+    }
+
+    o.z = 5;
+    expect(o.x).toBe(1);
+    expect(o.y).toBe(2);
+    expect(get(o)).toBe(5);
+});
+
+test("Objects used as dictionaries keep correct values and key order", () => {
+    function get(o, key) {
+        return o[key];
+    }
+
+    let dictionary = {};
+    for (let i = 0; i < 32; ++i) dictionary["key" + i] = i;
+
+    for (let i = 0; i < 32; i += 2) delete dictionary["key" + i];
+    for (let i = 1; i < 32; i += 2) expect(get(dictionary, "key" + i)).toBe(i);
+    for (let i = 0; i < 32; i += 2) expect(get(dictionary, "key" + i)).toBeUndefined();
+
+    dictionary.key0 = "again";
+    let keys = Object.keys(dictionary);
+    expect(keys.length).toBe(17);
+    expect(keys[0]).toBe("key1");
+    expect(keys[keys.length - 1]).toBe("key0");
+    expect(get(dictionary, "key0")).toBe("again");
+
+    delete dictionary.key1;
+    delete dictionary.key31;
+    expect(Object.keys(dictionary).length).toBe(15);
+    expect(dictionary.key3).toBe(3);
+    expect(dictionary.key29).toBe(29);
+});
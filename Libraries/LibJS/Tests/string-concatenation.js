@@ -28,3 +28,22 @@ test("adding strings with dangling surrogates", () => {
     expect("\ud834a" + "\udf06").toBe("\ud834a\udf06");
     expect("\ud834" + "a\udf06").toBe("\ud834a\udf06");
 });
+
+test("length and code units of strings built by repeated concatenation", () => {
+    let string = "";
+    const pieces = ["a", "\ud834", "\udf06", "bc", "ü", "d"];
+    const codeUnits = [];
+    for (let i = 0; i < 200; ++i) {
+        const piece = pieces[i % pieces.length];
+        string += piece;
+        for (let j = 0; j < piece.length; ++j) codeUnits.push(piece.charCodeAt(j));
+
+        expect(string.length).toBe(codeUnits.length);
+        expect(string.charCodeAt(codeUnits.length - 1)).toBe(codeUnits[codeUnits.length - 1]);
+        expect(string.charCodeAt(0)).toBe(codeUnits[0]);
+        expect(string[codeUnits.length - 1]).toBe(String.fromCharCode(codeUnits[codeUnits.length - 1]));
+        expect(string.at(-1)).toBe(String.fromCharCode(codeUnits[codeUnits.length - 1]));
+        expect(string.charAt(codeUnits.length)).toBe("");
+    }
+    expect(string).toBe(String.fromCharCode(...codeUnits));
+});
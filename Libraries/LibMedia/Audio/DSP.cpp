@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BuiltinWrappers.h>
+#include <AK/Math.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <AK/SIMDMath.h>
+#include <LibMedia/Audio/DSP.h>
+
+namespace Audio {
+
+using AK::SIMD::expand4;
+using AK::SIMD::f32x4;
+using AK::SIMD::load_unaligned;
+using AK::SIMD::store_unaligned;
+
+static constexpr size_t samples_per_vector = 4;
+
+void add(Span<float> destination, ReadonlySpan<float> source)
+{
+    VERIFY(destination.size() == source.size());
+
+    size_t i = 0;
+    for (; i + samples_per_vector <= destination.size(); i += samples_per_vector)
+        store_unaligned(destination.data() + i, load_unaligned<f32x4>(destination.data() + i) + load_unaligned<f32x4>(source.data() + i));
+
+    for (; i < destination.size(); ++i)
+        destination[i] += source[i];
+}
+
+void add_scaled(Span<float> destination, ReadonlySpan<float> source, float factor)
+{
+    VERIFY(destination.size() == source.size());
+
+    size_t i = 0;
+    auto factors = expand4(factor);
+    for (; i + samples_per_vector <= destination.size(); i += samples_per_vector)
+        store_unaligned(destination.data() + i, load_unaligned<f32x4>(destination.data() + i) + load_unaligned<f32x4>(source.data() + i) * factors);
+
+    for (; i < destination.size(); ++i)
+        destination[i] += source[i] * factor;
+}
+
+void multiply(Span<float> destination, ReadonlySpan<float> factors)
+{
+    VERIFY(destination.size() == factors.size());
+
+    size_t i = 0;
+    for (; i + samples_per_vector <= destination.size(); i += samples_per_vector)
+        store_unaligned(destination.data() + i, load_unaligned<f32x4>(destination.data() + i) * load_unaligned<f32x4>(factors.data() + i));
+
+    for (; i < destination.size(); ++i)
+        destination[i] *= factors[i];
+}
+
+void scale(Span<float> destination, float factor)
+{
+    size_t i = 0;
+    auto factors = expand4(factor);
+    for (; i + samples_per_vector <= destination.size(); i += samples_per_vector)
+        store_unaligned(destination.data() + i, load_unaligned<f32x4>(destination.data() + i) * factors);
+
+    for (; i < destination.size(); ++i)
+        destination[i] *= factor;
+}
+
+void apply_linear_gain_ramp(Span<float> samples, float start_gain, float end_gain)
+{
+    if (samples.is_empty())
+        return;
+
+    auto step = (end_gain - start_gain) / static_cast<float>(samples.size());
+
+    // NOTE: The gain of every sample is computed from its index rather than accumulated, so that rounding errors don't
+    //       add up over long blocks.
+    size_t i = 0;
+    f32x4 offsets { 0, 1, 2, 3 };
+    for (; i + samples_per_vector <= samples.size(); i += samples_per_vector) {
+        auto gain = expand4(start_gain) + (offsets + expand4(static_cast<float>(i))) * expand4(step);
+        store_unaligned(samples.data() + i, load_unaligned<f32x4>(samples.data() + i) * gain);
+    }
+
+    for (; i < samples.size(); ++i)
+        samples[i] *= start_gain + static_cast<float>(i) * step;
+}
+
+void clamp(Span<float> samples, float min, float max)
+{
+    size_t i = 0;
+    for (; i + samples_per_vector <= samples.size(); i += samples_per_vector)
+        store_unaligned(samples.data() + i, AK::SIMD::clamp(load_unaligned<f32x4>(samples.data() + i), min, max));
+
+    for (; i < samples.size(); ++i)
+        samples[i] = AK::clamp(samples[i], min, max);
+}
+
+void interleave_stereo(ReadonlySpan<float> left, ReadonlySpan<float> right, Span<float> interleaved)
+{
+    VERIFY(left.size() == right.size());
+    VERIFY(interleaved.size() == left.size() * 2);
+
+    size_t i = 0;
+    for (; i + samples_per_vector <= left.size(); i += samples_per_vector) {
+        auto l = load_unaligned<f32x4>(left.data() + i);
+        auto r = load_unaligned<f32x4>(right.data() + i);
+        store_unaligned(interleaved.data() + i * 2, f32x4 { l[0], r[0], l[1], r[1] });
+        store_unaligned(interleaved.data() + i * 2 + samples_per_vector, f32x4 { l[2], r[2], l[3], r[3] });
+    }
+
+    for (; i < left.size(); ++i) {
+        interleaved[i * 2] = left[i];
+        interleaved[i * 2 + 1] = right[i];
+    }
+}
+
+void deinterleave_stereo(ReadonlySpan<float> interleaved, Span<float> left, Span<float> right)
+{
+    VERIFY(left.size() == right.size());
+    VERIFY(interleaved.size() == left.size() * 2);
+
+    size_t i = 0;
+    for (; i + samples_per_vector <= left.size(); i += samples_per_vector) {
+        auto first = load_unaligned<f32x4>(interleaved.data() + i * 2);
+        auto second = load_unaligned<f32x4>(interleaved.data() + i * 2 + samples_per_vector);
+        store_unaligned(left.data() + i, f32x4 { first[0], first[2], second[0], second[2] });
+        store_unaligned(right.data() + i, f32x4 { first[1], first[3], second[1], second[3] });
+    }
+
+    for (; i < left.size(); ++i) {
+        left[i] = interleaved[i * 2];
+        right[i] = interleaved[i * 2 + 1];
+    }
+}
+
+void compute_magnitudes(ReadonlySpan<float> real, ReadonlySpan<float> imaginary, Span<float> magnitudes)
+{
+    VERIFY(real.size() == imaginary.size());
+    VERIFY(magnitudes.size() == real.size());
+
+    size_t i = 0;
+    for (; i + samples_per_vector <= real.size(); i += samples_per_vector) {
+        auto re = load_unaligned<f32x4>(real.data() + i);
+        auto im = load_unaligned<f32x4>(imaginary.data() + i);
+        store_unaligned(magnitudes.data() + i, AK::SIMD::sqrt(re * re + im * im));
+    }
+
+    for (; i < real.size(); ++i)
+        magnitudes[i] = AK::sqrt(real[i] * real[i] + imaginary[i] * imaginary[i]);
+}
+
+void process_biquad_cascade(Span<float> samples, ReadonlySpan<BiquadCoefficients> sections, Span<BiquadState> states)
+{
+    VERIFY(sections.size() == states.size());
+
+    // NOTE: Every output sample depends on the previous ones, so there is nothing to vectorize within a section. We
+    //       go through the whole block once per section instead of through all sections once per sample, so that the
+    //       coefficients and state of the section stay in registers.
+    for (size_t section = 0; section < sections.size(); ++section) {
+        auto const& c = sections[section];
+        auto s1 = states[section].s1;
+        auto s2 = states[section].s2;
+
+        // This is the transposed direct form II, which needs the least state and is the most robust one with floats.
+        for (auto& sample : samples) {
+            auto x = sample;
+            auto y = c.b0 * x + s1;
+            s1 = c.b1 * x - c.a1 * y + s2;
+            s2 = c.b2 * x - c.a2 * y;
+            sample = y;
+        }
+
+        states[section].s1 = s1;
+        states[section].s2 = s2;
+    }
+}
+
+ErrorOr<FFT> FFT::create(size_t size)
+{
+    if (size < 2 || !is_power_of_two(size) || size > NumericLimits<u32>::max())
+        return Error::from_string_literal("FFT size has to be a power of two");
+
+    auto bits = count_trailing_zeroes(size);
+
+    Vector<u32> bit_reversed_indices;
+    TRY(bit_reversed_indices.try_resize(size));
+    for (size_t i = 0; i < size; ++i) {
+        u32 reversed = 0;
+        for (size_t bit = 0; bit < bits; ++bit)
+            reversed |= ((i >> bit) & 1) << (bits - 1 - bit);
+        bit_reversed_indices[i] = reversed;
+    }
+
+    Vector<float> twiddle_real;
+    Vector<float> twiddle_imaginary;
+    TRY(twiddle_real.try_resize(size - 1));
+    TRY(twiddle_imaginary.try_resize(size - 1));
+    for (size_t half_size = 1; half_size < size; half_size *= 2) {
+        for (size_t k = 0; k < half_size; ++k) {
+            auto angle = -AK::Pi<double> * static_cast<double>(k) / static_cast<double>(half_size);
+            twiddle_real[half_size - 1 + k] = static_cast<float>(AK::cos(angle));
+            twiddle_imaginary[half_size - 1 + k] = static_cast<float>(AK::sin(angle));
+        }
+    }
+
+    return FFT { size, move(bit_reversed_indices), move(twiddle_real), move(twiddle_imaginary) };
+}
+
+FFT::FFT(size_t size, Vector<u32> bit_reversed_indices, Vector<float> twiddle_real, Vector<float> twiddle_imaginary)
+    : m_size(size)
+    , m_bit_reversed_indices(move(bit_reversed_indices))
+    , m_twiddle_real(move(twiddle_real))
+    , m_twiddle_imaginary(move(twiddle_imaginary))
+{
+}
+
+void FFT::transform(Span<float> real, Span<float> imaginary) const
+{
+    VERIFY(real.size() == m_size);
+    VERIFY(imaginary.size() == m_size);
+
+    for (size_t i = 0; i < m_size; ++i) {
+        auto j = m_bit_reversed_indices[i];
+        if (i < j) {
+            swap(real[i], real[j]);
+            swap(imaginary[i], imaginary[j]);
+        }
+    }
+
+    for (size_t half_size = 1; half_size < m_size; half_size *= 2) {
+        auto const* twiddle_real = m_twiddle_real.data() + half_size - 1;
+        auto const* twiddle_imaginary = m_twiddle_imaginary.data() + half_size - 1;
+
+        for (size_t start = 0; start < m_size; start += half_size * 2) {
+            auto* even_real = real.data() + start;
+            auto* even_imaginary = imaginary.data() + start;
+            auto* odd_real = even_real + half_size;
+            auto* odd_imaginary = even_imaginary + half_size;
+
+            size_t k = 0;
+            for (; k + samples_per_vector <= half_size; k += samples_per_vector) {
+                auto w_re = load_unaligned<f32x4>(twiddle_real + k);
+                auto w_im = load_unaligned<f32x4>(twiddle_imaginary + k);
+                auto o_re = load_unaligned<f32x4>(odd_real + k);
+                auto o_im = load_unaligned<f32x4>(odd_imaginary + k);
+                auto e_re = load_unaligned<f32x4>(even_real + k);
+                auto e_im = load_unaligned<f32x4>(even_imaginary + k);
+
+                auto t_re = o_re * w_re - o_im * w_im;
+                auto t_im = o_re * w_im + o_im * w_re;
+                store_unaligned(even_real + k, e_re + t_re);
+                store_unaligned(even_imaginary + k, e_im + t_im);
+                store_unaligned(odd_real + k, e_re - t_re);
+                store_unaligned(odd_imaginary + k, e_im - t_im);
+            }
+
+            // NOTE: Only the first two stages are narrower than a vector.
+            for (; k < half_size; ++k) {
+                auto t_re = odd_real[k] * twiddle_real[k] - odd_imaginary[k] * twiddle_imaginary[k];
+                auto t_im = odd_real[k] * twiddle_imaginary[k] + odd_imaginary[k] * twiddle_real[k];
+                odd_real[k] = even_real[k] - t_re;
+                odd_imaginary[k] = even_imaginary[k] - t_im;
+                even_real[k] += t_re;
+                even_imaginary[k] += t_im;
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/Span.h>
+#include <AK/Vector.h>
+
+namespace Audio {
+
+// Kernels for processing blocks of planar float samples. These work on several samples at a time, so callers should
+// hand them whole blocks (like a render quantum) rather than calling them once per sample. Unless noted otherwise, the
+// source and destination have to be of the same size, and may not overlap unless they are the same span.
+
+// destination[i] += source[i]
+void add(Span<float> destination, ReadonlySpan<float> source);
+// destination[i] += source[i] * factor
+void add_scaled(Span<float> destination, ReadonlySpan<float> source, float factor);
+// destination[i] *= factors[i]
+void multiply(Span<float> destination, ReadonlySpan<float> factors);
+// destination[i] *= factor
+void scale(Span<float> destination, float factor);
+
+// Multiplies the samples by a gain that changes linearly from start_gain at the first sample towards end_gain, which
+// is reached right after the last sample. This is what a gain change without zipper noise looks like.
+void apply_linear_gain_ramp(Span<float> samples, float start_gain, float end_gain);
+
+// Limits every sample to [min, max].
+void clamp(Span<float> samples, float min, float max);
+
+// Converts between two planar channels and interleaved stereo (L, R, L, R, ...). The interleaved span has to hold
+// twice as many samples as each of the channels.
+void interleave_stereo(ReadonlySpan<float> left, ReadonlySpan<float> right, Span<float> interleaved);
+void deinterleave_stereo(ReadonlySpan<float> interleaved, Span<float> left, Span<float> right);
+
+// magnitudes[i] = sqrt(real[i]^2 + imaginary[i]^2)
+void compute_magnitudes(ReadonlySpan<float> real, ReadonlySpan<float> imaginary, Span<float> magnitudes);
+
+// The coefficients of a second-order IIR filter section, normalized so that a0 is 1:
+// y[n] = b0 * x[n] + b1 * x[n - 1] + b2 * x[n - 2] - a1 * y[n - 1] - a2 * y[n - 2]
+struct BiquadCoefficients {
+    float b0 { 1 };
+    float b1 { 0 };
+    float b2 { 0 };
+    float a1 { 0 };
+    float a2 { 0 };
+};
+
+// The memory of a biquad section between blocks. Every channel that is filtered needs its own.
+struct BiquadState {
+    float s1 { 0 };
+    float s2 { 0 };
+};
+
+// Runs the samples through each of the sections in turn. There has to be one state per section.
+void process_biquad_cascade(Span<float> samples, ReadonlySpan<BiquadCoefficients>, Span<BiquadState>);
+
+// An in-place radix-2 fast Fourier transform of a fixed, power-of-two size. The twiddle factors are computed once on
+// creation, so callers should hold on to an FFT for as long as the size doesn't change.
+class FFT {
+public:
+    static ErrorOr<FFT> create(size_t size);
+
+    size_t size() const { return m_size; }
+
+    // Computes X[k] = sum(x[n] * e^(-2 * pi * i * k * n / size)) of the complex input, replacing it with the result.
+    // Both spans have to hold size() samples.
+    void transform(Span<float> real, Span<float> imaginary) const;
+
+private:
+    FFT(size_t size, Vector<u32> bit_reversed_indices, Vector<float> twiddle_real, Vector<float> twiddle_imaginary);
+
+    size_t m_size { 0 };
+    Vector<u32> m_bit_reversed_indices;
+
+    // The twiddle factors of each butterfly stage, one stage after another. The stage that combines two transforms of
+    // size N into one of size 2N uses N of them, starting at index N - 1.
+    Vector<float> m_twiddle_real;
+    Vector<float> m_twiddle_imaginary;
+};
+
+}
@@ -115,15 +115,24 @@ DecoderErrorOr<Vector<Track>> FFmpegDemuxer::get_tracks_for_type(TrackType type)
 
 DecoderErrorOr<Optional<AK::Duration>> FFmpegDemuxer::seek_to_most_recent_keyframe(Track track, AK::Duration timestamp, Optional<AK::Duration> earliest_available_sample)
 {
-    // FIXME: What do we do with this here?
-    (void)earliest_available_sample;
-
     VERIFY(track.identifier() < m_format_context->nb_streams);
     auto* stream = m_format_context->streams[track.identifier()];
     auto time_base = av_q2d(stream->time_base);
     auto time_in_seconds = static_cast<double>(timestamp.to_milliseconds()) / 1000.0 / time_base;
     auto sample_timestamp = AK::round_to<int64_t>(time_in_seconds);
 
+    // If the keyframe we would land on is no later than the samples the caller already has, decoding forward from the
+    // current position reaches the target at least as quickly, so keep our position instead of seeking backwards.
+    if (earliest_available_sample.has_value() && timestamp >= earliest_available_sample.value()) {
+        auto keyframe_index = av_index_search_timestamp(stream, sample_timestamp, AVSEEK_FLAG_BACKWARD);
+        if (keyframe_index >= 0) {
+            auto const* keyframe_entry = avformat_index_get_entry(stream, keyframe_index);
+            auto keyframe_in_milliseconds = static_cast<double>(keyframe_entry->timestamp) * time_base * 1000.0;
+            if (AK::Duration::from_milliseconds(AK::round_to<int64_t>(keyframe_in_milliseconds)) <= earliest_available_sample.value())
+                return OptionalNone {};
+        }
+    }
+
     if (av_seek_frame(m_format_context, stream->index, sample_timestamp, AVSEEK_FLAG_BACKWARD) < 0)
         return DecoderError::format(DecoderErrorCategory::Unknown, "Failed to seek");
 
@@ -4,16 +4,33 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/Environment.h>
 #include <LibCore/System.h>
 #include <LibMedia/VideoFrame.h>
 
 #include "FFmpegHelpers.h"
 #include "FFmpegVideoDecoder.h"
 
+extern "C" {
+#include <libavutil/hwcontext.h>
+#include <libavutil/pixdesc.h>
+}
+
 namespace Media::FFmpeg {
 
-static AVPixelFormat negotiate_output_format(AVCodecContext*, AVPixelFormat const* formats)
+static AVPixelFormat negotiate_output_format(AVCodecContext* codec_context, AVPixelFormat const* formats)
 {
+    // NOTE: If we managed to open a hardware device for this codec, its pixel format is stored in the context's opaque
+    //       pointer. FFmpeg only offers that format when the hardware can actually decode the stream, and otherwise
+    //       falls back to decoding in software with one of the formats below.
+    auto hardware_format = static_cast<AVPixelFormat>(reinterpret_cast<intptr_t>(codec_context->opaque));
+    if (hardware_format != AV_PIX_FMT_NONE) {
+        for (auto const* format = formats; *format >= 0; format++) {
+            if (*format == hardware_format)
+                return hardware_format;
+        }
+    }
+
     while (*formats >= 0) {
         switch (*formats) {
         case AV_PIX_FMT_YUV420P:
@@ -37,16 +54,68 @@ static AVPixelFormat negotiate_output_format(AVCodecContext*, AVPixelFormat cons
     return AV_PIX_FMT_NONE;
 }
 
+static Optional<AVHWDeviceType> hardware_device_type_for_platform()
+{
+#if defined(AK_OS_MACOS)
+    return AV_HWDEVICE_TYPE_VIDEOTOOLBOX;
+#elif defined(AK_OS_WINDOWS)
+    return AV_HWDEVICE_TYPE_D3D11VA;
+#elif defined(AK_OS_LINUX) || defined(AK_OS_BSD_GENERIC)
+    return AV_HWDEVICE_TYPE_VAAPI;
+#else
+    return {};
+#endif
+}
+
+// Opens the platform's hardware decoder for the codec, if there is one. Returns the pixel format that the hardware
+// decodes into, or AV_PIX_FMT_NONE if the codec will be decoded in software.
+static AVPixelFormat try_attach_hardware_device(AVCodec const* codec, AVCodecContext* codec_context)
+{
+    if (Core::Environment::has("LADYBIRD_DISABLE_HARDWARE_VIDEO_DECODING"sv))
+        return AV_PIX_FMT_NONE;
+
+    auto device_type = hardware_device_type_for_platform();
+    if (!device_type.has_value())
+        return AV_PIX_FMT_NONE;
+
+    auto hardware_format = AV_PIX_FMT_NONE;
+    for (int i = 0;; i++) {
+        auto const* config = avcodec_get_hw_config(codec, i);
+        if (!config)
+            break;
+        if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) != 0 && config->device_type == *device_type) {
+            hardware_format = config->pix_fmt;
+            break;
+        }
+    }
+    if (hardware_format == AV_PIX_FMT_NONE)
+        return AV_PIX_FMT_NONE;
+
+    AVBufferRef* device_context = nullptr;
+    if (av_hwdevice_ctx_create(&device_context, *device_type, nullptr, nullptr, 0) < 0) {
+        dbgln("FFmpegVideoDecoder: Could not open a {} device, decoding in software", av_hwdevice_get_type_name(*device_type));
+        return AV_PIX_FMT_NONE;
+    }
+
+    codec_context->hw_device_ctx = av_buffer_ref(device_context);
+    av_buffer_unref(&device_context);
+    if (!codec_context->hw_device_ctx)
+        return AV_PIX_FMT_NONE;
+    return hardware_format;
+}
+
 DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create(CodecID codec_id, ReadonlyBytes codec_initialization_data)
 {
     AVCodecContext* codec_context = nullptr;
     AVPacket* packet = nullptr;
     AVFrame* frame = nullptr;
+    AVFrame* transfer_frame = nullptr;
     ArmedScopeGuard memory_guard {
         [&] {
             avcodec_free_context(&codec_context);
             av_packet_free(&packet);
             av_frame_free(&frame);
+            av_frame_free(&transfer_frame);
         }
     };
 
@@ -59,6 +128,8 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
     if (!codec_context)
         return DecoderError::format(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg codec context for codec {}", codec_id);
 
+    auto hardware_format = try_attach_hardware_device(codec, codec_context);
+    codec_context->opaque = reinterpret_cast<void*>(static_cast<intptr_t>(hardware_format));
     codec_context->get_format = negotiate_output_format;
 
     codec_context->thread_count = static_cast<int>(min(Core::System::hardware_concurrency(), 4));
@@ -86,14 +157,21 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
     if (!frame)
         return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg frame"sv);
 
+    if (hardware_format != AV_PIX_FMT_NONE) {
+        transfer_frame = av_frame_alloc();
+        if (!transfer_frame)
+            return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg frame"sv);
+    }
+
     memory_guard.disarm();
-    return DECODER_TRY_ALLOC(try_make<FFmpegVideoDecoder>(codec_context, packet, frame));
+    return DECODER_TRY_ALLOC(try_make<FFmpegVideoDecoder>(codec_context, packet, frame, transfer_frame));
 }
 
-FFmpegVideoDecoder::FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame)
+FFmpegVideoDecoder::FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame, AVFrame* transfer_frame)
     : m_codec_context(codec_context)
     , m_packet(packet)
     , m_frame(frame)
+    , m_transfer_frame(transfer_frame)
 {
 }
 
@@ -101,6 +179,7 @@ FFmpegVideoDecoder::~FFmpegVideoDecoder()
 {
     av_packet_free(&m_packet);
     av_frame_free(&m_frame);
+    av_frame_free(&m_transfer_frame);
     avcodec_free_context(&m_codec_context);
 }
 
@@ -136,11 +215,26 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
 
     switch (result) {
     case 0: {
-        auto color_primaries = static_cast<ColorPrimaries>(m_frame->color_primaries);
-        auto transfer_characteristics = static_cast<TransferCharacteristics>(m_frame->color_trc);
-        auto matrix_coefficients = static_cast<MatrixCoefficients>(m_frame->colorspace);
+        // Frames decoded in hardware live in GPU memory, so they have to be downloaded before we can convert them.
+        AVFrame const* frame_data = m_frame;
+        if (m_frame->hw_frames_ctx) {
+            VERIFY(m_transfer_frame);
+            av_frame_unref(m_transfer_frame);
+            if (av_hwframe_transfer_data(m_transfer_frame, m_frame, 0) < 0)
+                return DecoderError::with_description(DecoderErrorCategory::Unknown, "Failed to download a hardware-decoded frame"sv);
+            if (av_frame_copy_props(m_transfer_frame, m_frame) < 0)
+                return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to copy the properties of a hardware-decoded frame"sv);
+            frame_data = m_transfer_frame;
+
+            if (frame_data->format != AV_PIX_FMT_NV12 && frame_data->format != AV_PIX_FMT_P010)
+                return DecoderError::format(DecoderErrorCategory::NotImplemented, "Hardware-decoded frames in pixel format {} are not supported", av_get_pix_fmt_name(static_cast<AVPixelFormat>(frame_data->format)));
+        }
+
+        auto color_primaries = static_cast<ColorPrimaries>(frame_data->color_primaries);
+        auto transfer_characteristics = static_cast<TransferCharacteristics>(frame_data->color_trc);
+        auto matrix_coefficients = static_cast<MatrixCoefficients>(frame_data->colorspace);
         auto color_range = [&] {
-            switch (m_frame->format) {
+            switch (frame_data->format) {
             case AV_PIX_FMT_YUVJ420P:
             case AV_PIX_FMT_YUVJ422P:
             case AV_PIX_FMT_YUVJ444P:
@@ -149,7 +243,7 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
                 break;
             }
 
-            switch (m_frame->color_range) {
+            switch (frame_data->color_range) {
             case AVColorRange::AVCOL_RANGE_MPEG:
                 return VideoFullRangeFlag::Studio;
             case AVColorRange::AVCOL_RANGE_JPEG:
@@ -161,17 +255,19 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         auto cicp = CodingIndependentCodePoints { color_primaries, transfer_characteristics, matrix_coefficients, color_range };
 
         size_t bit_depth = [&] {
-            switch (m_frame->format) {
+            switch (frame_data->format) {
             case AV_PIX_FMT_YUV420P:
             case AV_PIX_FMT_YUV422P:
             case AV_PIX_FMT_YUV444P:
             case AV_PIX_FMT_YUVJ420P:
             case AV_PIX_FMT_YUVJ422P:
             case AV_PIX_FMT_YUVJ444P:
+            case AV_PIX_FMT_NV12:
                 return 8;
             case AV_PIX_FMT_YUV420P10:
             case AV_PIX_FMT_YUV422P10:
             case AV_PIX_FMT_YUV444P10:
+            case AV_PIX_FMT_P010:
                 return 10;
             case AV_PIX_FMT_YUV420P12:
             case AV_PIX_FMT_YUV422P12:
@@ -183,11 +279,13 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         size_t component_size = (bit_depth + 7) / 8;
 
         auto subsampling = [&]() -> Subsampling {
-            switch (m_frame->format) {
+            switch (frame_data->format) {
             case AV_PIX_FMT_YUV420P:
             case AV_PIX_FMT_YUV420P10:
             case AV_PIX_FMT_YUV420P12:
             case AV_PIX_FMT_YUVJ420P:
+            case AV_PIX_FMT_NV12:
+            case AV_PIX_FMT_P010:
                 return { true, true };
             case AV_PIX_FMT_YUV422P:
             case AV_PIX_FMT_YUV422P10:
@@ -205,30 +303,57 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
             }
         }();
 
-        auto size = Gfx::Size<u32> { m_frame->width, m_frame->height };
+        auto size = Gfx::Size<u32> { frame_data->width, frame_data->height };
 
-        auto timestamp = AK::Duration::from_microseconds(m_frame->pts);
+        auto timestamp = AK::Duration::from_microseconds(frame_data->pts);
         auto frame = DECODER_TRY_ALLOC(SubsampledYUVFrame::try_create(timestamp, size, bit_depth, cicp, subsampling));
 
+        // NOTE: Hardware decoders output semi-planar frames, which store the U and V samples interleaved in a single plane.
+        //       P010 keeps its 10-bit samples in the high bits of each 16-bit value.
+        bool const is_semi_planar = frame_data->format == AV_PIX_FMT_NV12 || frame_data->format == AV_PIX_FMT_P010;
+        u32 const sample_shift = frame_data->format == AV_PIX_FMT_P010 ? 6 : 0;
+
+        auto copy_row = [&](u8* destination, u8 const* source, size_t sample_count, size_t source_stride_in_samples) {
+            if (sample_shift == 0 && source_stride_in_samples == 1) {
+                memcpy(destination, source, sample_count * component_size);
+                return;
+            }
+            for (size_t i = 0; i < sample_count; i++) {
+                if (component_size == 1) {
+                    destination[i] = source[i * source_stride_in_samples];
+                } else {
+                    u16 sample;
+                    memcpy(&sample, source + i * source_stride_in_samples * sizeof(u16), sizeof(u16));
+                    sample >>= sample_shift;
+                    memcpy(destination + i * sizeof(u16), &sample, sizeof(u16));
+                }
+            }
+        };
+
         for (u32 plane = 0; plane < 3; plane++) {
-            VERIFY(m_frame->linesize[plane] != 0);
-            if (m_frame->linesize[plane] < 0)
+            auto source_plane = is_semi_planar ? min(plane, 1u) : plane;
+            auto line_size = frame_data->linesize[source_plane];
+            VERIFY(line_size != 0);
+            if (line_size < 0)
                 return DecoderError::with_description(DecoderErrorCategory::NotImplemented, "Reversed scanlines are not supported"sv);
 
             bool const use_subsampling = plane > 0;
             auto plane_size = (use_subsampling ? subsampling.subsampled_size(size) : size).to_type<size_t>();
+            size_t source_stride_in_samples = (is_semi_planar && use_subsampling) ? 2 : 1;
 
             auto output_line_size = plane_size.width() * component_size;
-            VERIFY(output_line_size <= static_cast<size_t>(m_frame->linesize[plane]));
+            VERIFY(output_line_size * source_stride_in_samples <= static_cast<size_t>(line_size));
 
-            auto const* source = m_frame->data[plane];
+            auto const* source = frame_data->data[source_plane];
             VERIFY(source != nullptr);
+            if (is_semi_planar && plane == 2)
+                source += component_size;
             auto* destination = frame->get_raw_plane_data(plane);
             VERIFY(destination != nullptr);
 
             for (size_t row = 0; row < plane_size.height(); row++) {
-                memcpy(destination, source, output_line_size);
-                source += m_frame->linesize[plane];
+                copy_row(destination, source, plane_size.width(), source_stride_in_samples);
+                source += line_size;
                 destination += output_line_size;
             }
         }
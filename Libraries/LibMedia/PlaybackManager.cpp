@@ -129,7 +129,7 @@ void PlaybackManager::dispatch_decoder_error(DecoderError error)
     }
 }
 
-void PlaybackManager::dispatch_new_frame(RefPtr<Gfx::Bitmap> frame)
+void PlaybackManager::dispatch_new_frame(PresentableVideoFrame frame)
 {
     if (on_video_frame)
         on_video_frame(move(frame));
@@ -143,7 +143,7 @@ bool PlaybackManager::dispatch_frame_queue_item(FrameQueueItem&& item)
     }
 
     dbgln_if(PLAYBACK_MANAGER_DEBUG, "Sent frame for presentation with timestamp {}ms, late by {}ms", item.timestamp().to_milliseconds(), (current_playback_time() - item.timestamp()).to_milliseconds());
-    dispatch_new_frame(item.bitmap());
+    dispatch_new_frame(item.frame());
     return false;
 }
 
@@ -188,6 +188,39 @@ void PlaybackManager::set_state_update_timer(int delay_ms)
     m_state_update_timer->start(delay_ms);
 }
 
+void PlaybackManager::set_decoded_frame_queue_size(size_t size)
+{
+    m_decoded_frame_queue_size.exchange(clamp(size, minimum_decoded_frame_queue_size, maximum_decoded_frame_queue_size));
+    m_decode_wait_condition.broadcast();
+}
+
+void PlaybackManager::request_skip_to_keyframe(AK::Duration target)
+{
+    // Frames decoded after an earlier skip that are still behind its target can't be helped by skipping again, since
+    // we'd land on the same keyframe.
+    if (m_last_keyframe_skip_target.has_value() && target <= m_last_keyframe_skip_target.value())
+        return;
+    m_last_keyframe_skip_target = target;
+
+    dbgln_if(PLAYBACK_MANAGER_DEBUG, "Decoding has fallen behind playback, requesting a skip to the keyframe before {}ms", target.to_milliseconds());
+    m_keyframe_skip_target_in_nanoseconds.exchange(target.to_nanoseconds());
+    m_decode_wait_condition.broadcast();
+}
+
+DecoderErrorOr<void> PlaybackManager::skip_to_requested_keyframe()
+{
+    auto target_in_nanoseconds = m_keyframe_skip_target_in_nanoseconds.exchange(no_keyframe_skip_requested);
+    if (target_in_nanoseconds == no_keyframe_skip_requested || !m_last_decoded_sample_timestamp.has_value())
+        return {};
+
+    auto keyframe_timestamp = TRY(seek_demuxer_to_most_recent_keyframe(AK::Duration::from_nanoseconds(target_in_nanoseconds), m_last_decoded_sample_timestamp));
+    if (keyframe_timestamp.has_value()) {
+        dbgln_if(PLAYBACK_MANAGER_DEBUG, "Media Decoder: Skipped from sample at {}ms to keyframe at {}ms", m_last_decoded_sample_timestamp->to_milliseconds(), keyframe_timestamp->to_milliseconds());
+        m_last_decoded_sample_timestamp.clear();
+    }
+    return {};
+}
+
 void PlaybackManager::restart_playback()
 {
     seek_to_timestamp(AK::Duration::zero());
@@ -208,6 +241,11 @@ void PlaybackManager::decode_and_queue_one_sample()
         {
             Threading::MutexLocker decoder_locker(m_decoder_mutex);
 
+            if (auto skip_result = skip_to_requested_keyframe(); skip_result.is_error()) {
+                item_to_enqueue = FrameQueueItem::error_marker(skip_result.release_error(), FrameQueueItem::no_timestamp);
+                break;
+            }
+
             // Get a sample to decode.
             auto sample_result = m_demuxer->get_next_sample_for_track(m_selected_video_track);
             if (sample_result.is_error()) {
@@ -215,6 +253,7 @@ void PlaybackManager::decode_and_queue_one_sample()
                 break;
             }
             auto sample = sample_result.release_value();
+            m_last_decoded_sample_timestamp = sample.timestamp();
             container_cicp = sample.auxiliary_data().get<VideoSampleData>().container_cicp();
 
             // Submit the sample to the decoder.
@@ -264,12 +303,22 @@ void PlaybackManager::decode_and_queue_one_sample()
                 break;
             }
 
+            // OPTIMIZATION: Hand over the decoded planes as they are where we can, so that converting them to RGB
+            //               happens in a shader while the frame is painted instead of on this thread.
+            if (auto yuv_data = decoded_frame->to_yuv_data()) {
+                item_to_enqueue = FrameQueueItem::frame(yuv_data.release_nonnull(), decoded_frame->timestamp());
+                m_decoded_frames++;
+                break;
+            }
+
             auto bitmap_result = decoded_frame->to_bitmap();
 
-            if (bitmap_result.is_error())
+            if (bitmap_result.is_error()) {
                 item_to_enqueue = FrameQueueItem::error_marker(bitmap_result.release_error(), decoded_frame->timestamp());
-            else
-                item_to_enqueue = FrameQueueItem::frame(bitmap_result.release_value(), decoded_frame->timestamp());
+            } else {
+                item_to_enqueue = FrameQueueItem::frame(PresentableVideoFrame { bitmap_result.release_value() }, decoded_frame->timestamp());
+                m_decoded_frames++;
+            }
             break;
         }
     }
@@ -286,7 +335,7 @@ void PlaybackManager::decode_and_queue_one_sample()
 
     bool had_error = item_to_enqueue.is_error();
     while (true) {
-        if (m_frame_queue.can_enqueue()) {
+        if (m_frame_queue.can_enqueue() && m_frame_queue.weak_used() < m_decoded_frame_queue_size.load()) {
             MUST(m_frame_queue.enqueue(move(item_to_enqueue)));
             break;
         }
@@ -347,6 +396,16 @@ PlaybackManager& PlaybackManager::PlaybackStateHandler::manager() const
     return m_manager;
 }
 
+// FIXME: This is a placeholder variable that could be scaled based on how long each frame decode takes to
+//        avoid triggering the timer to check the queue constantly. However, doing so may reduce the speed
+//        of seeking due to the decode thread having to wait for a signal to continue decoding.
+constexpr int buffering_or_seeking_decode_wait_time = 1;
+
+// How long playback keeps going without any newly decoded frames before it pauses to buffer.
+constexpr AK::Duration maximum_decoder_underrun_duration = AK::Duration::from_milliseconds(500);
+// How far behind the playback time a presented frame must be before the decoder is asked to jump ahead to a keyframe.
+constexpr AK::Duration lateness_before_skipping_to_keyframe = AK::Duration::from_milliseconds(250);
+
 class PlaybackManager::ResumingStateHandler : public PlaybackManager::PlaybackStateHandler {
 public:
     ResumingStateHandler(PlaybackManager& manager, bool playing)
@@ -453,6 +512,34 @@ private:
             manager().m_next_frame.emplace(future_frame_item.release_value());
         }
 
+        // If the decoder hasn't caught up yet, keep the clock running for a little while rather than freezing playback
+        // right away. Whatever frame is due is presented, and any frames that turn up too late are dropped by the loop
+        // above the next time we're called.
+        if (!future_frame_item.has_value()) {
+            auto now = MonotonicTime::now();
+            if (!m_decoder_underrun_start.has_value())
+                m_decoder_underrun_start = now;
+
+            if (now - m_decoder_underrun_start.value() < maximum_decoder_underrun_duration) {
+                if (manager().m_next_frame.has_value() && present_next_frame())
+                    return {};
+                manager().set_state_update_timer(buffering_or_seeking_decode_wait_time);
+                return {};
+            }
+
+            dbgln_if(PLAYBACK_MANAGER_DEBUG, "Decoder has not produced a frame for {}ms, buffering", (now - m_decoder_underrun_start.value()).to_milliseconds());
+            m_decoder_underrun_start.clear();
+        } else if (m_decoder_underrun_start.has_value()) {
+            m_decoder_underrun_start.clear();
+
+            // The last frame we presented while waiting is still on screen, so this one only needs to wait for its time.
+            if (!manager().m_next_frame.has_value() && !future_frame_item->is_error()) {
+                manager().m_next_frame.emplace(future_frame_item.release_value());
+                set_presentation_timer();
+                return {};
+            }
+        }
+
         // If we don't have both of these items, we can't present, since we need to set a timer for
         // the next frame. Check if we need to buffer based on the current state.
         if (!manager().m_next_frame.has_value() || !future_frame_item.has_value()) {
@@ -481,14 +568,8 @@ private:
         }
 
         // If we have a frame, send it for presentation.
-        if (should_present_frame) {
-            auto now = MonotonicTime::now();
-            manager().m_last_present_in_media_time += now - m_last_present_in_real_time;
-            m_last_present_in_real_time = now;
-
-            if (manager().dispatch_frame_queue_item(manager().m_next_frame.release_value()))
-                return {};
-        }
+        if (should_present_frame && present_next_frame())
+            return {};
 
         // Now that we've presented the current frame, we can throw whatever error is next in queue.
         // This way, we always display a frame before the stream ends, and should also show any frames
@@ -504,7 +585,29 @@ private:
         return {};
     }
 
+    // Returns whether we changed playback states, like dispatch_frame_queue_item().
+    [[nodiscard]] bool present_next_frame()
+    {
+        auto now = MonotonicTime::now();
+        manager().m_last_present_in_media_time += now - m_last_present_in_real_time;
+        m_last_present_in_real_time = now;
+
+        auto item = manager().m_next_frame.release_value();
+        if (item.is_frame()) {
+            manager().m_presented_frames++;
+
+            auto lateness = current_time() - item.timestamp();
+            if (lateness > late_frame_threshold)
+                manager().m_late_frames++;
+            if (lateness > lateness_before_skipping_to_keyframe)
+                manager().request_skip_to_keyframe(current_time());
+        }
+
+        return manager().dispatch_frame_queue_item(move(item));
+    }
+
     MonotonicTime m_last_present_in_real_time = MonotonicTime::now_coarse();
+    Optional<MonotonicTime> m_decoder_underrun_start;
 };
 
 class PlaybackManager::PausedStateHandler : public PlaybackManager::PlaybackStateHandler {
@@ -526,11 +629,6 @@ private:
     PlaybackState get_state() const override { return PlaybackState::Paused; }
 };
 
-// FIXME: This is a placeholder variable that could be scaled based on how long each frame decode takes to
-//        avoid triggering the timer to check the queue constantly. However, doing so may reduce the speed
-//        of seeking due to the decode thread having to wait for a signal to continue decoding.
-constexpr int buffering_or_seeking_decode_wait_time = 1;
-
 class PlaybackManager::BufferingStateHandler : public PlaybackManager::ResumingStateHandler {
     using PlaybackManager::ResumingStateHandler::ResumingStateHandler;
 
@@ -577,6 +675,10 @@ private:
         {
             Threading::MutexLocker demuxer_locker(manager().m_decoder_mutex);
 
+            // Any skip the decoder hasn't acted on yet was based on the old playback position.
+            manager().m_keyframe_skip_target_in_nanoseconds.exchange(no_keyframe_skip_requested);
+            manager().m_last_keyframe_skip_target.clear();
+
             auto demuxer_seek_result = manager().seek_demuxer_to_most_recent_keyframe(m_target_timestamp, earliest_available_sample);
             if (demuxer_seek_result.is_error()) {
                 manager().dispatch_decoder_error(demuxer_seek_result.release_error());
@@ -599,6 +701,7 @@ private:
                 dbgln_if(PLAYBACK_MANAGER_DEBUG, "Keyframe is nearer to the target than the current frames, emptying queue");
                 while (manager().dequeue_one_frame().has_value()) { }
                 manager().m_next_frame.clear();
+                manager().m_last_decoded_sample_timestamp.clear();
                 manager().m_last_present_in_media_time = keyframe_timestamp.value();
             } else if (m_target_timestamp >= manager().m_last_present_in_media_time && manager().m_next_frame.has_value() && manager().m_next_frame.value().timestamp() > m_target_timestamp) {
                 dbgln_if(PLAYBACK_MANAGER_DEBUG, "Target timestamp is between the last presented frame and the next frame, exiting seek at {}ms", m_target_timestamp.to_milliseconds());
@@ -696,6 +799,8 @@ private:
     PlaybackState get_state() const override { return PlaybackState::Stopped; }
 };
 
+static constexpr u64 decoded_frame_queue_memory_budget = 64 * MiB;
+
 DecoderErrorOr<NonnullOwnPtr<PlaybackManager>> PlaybackManager::create(NonnullOwnPtr<Demuxer> demuxer)
 {
     auto video_tracks = TRY(demuxer->get_tracks_for_type(TrackType::Video));
@@ -711,6 +816,10 @@ DecoderErrorOr<NonnullOwnPtr<PlaybackManager>> PlaybackManager::create(NonnullOw
     auto frame_queue = DECODER_TRY_ALLOC(VideoFrameQueue::create());
     auto playback_manager = DECODER_TRY_ALLOC(try_make<PlaybackManager>(demuxer, track, move(decoder), move(frame_queue)));
 
+    // Look as far ahead as the decoded frame memory budget allows for this video's frame size.
+    auto frame_size_in_bytes = max<u64>(track.video_data().pixel_width * track.video_data().pixel_height * sizeof(Gfx::ARGB32), 1);
+    playback_manager->set_decoded_frame_queue_size(decoded_frame_queue_memory_budget / frame_size_in_bytes);
+
     playback_manager->m_state_update_timer = Core::Timer::create_single_shot(0, [&self = *playback_manager] { self.timer_callback(); });
 
     playback_manager->m_decode_thread = DECODER_TRY_ALLOC(Threading::Thread::try_create([&self = *playback_manager] {
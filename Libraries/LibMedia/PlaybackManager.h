@@ -9,10 +9,12 @@
 #include <AK/Atomic.h>
 #include <AK/Function.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/NumericLimits.h>
 #include <AK/Queue.h>
 #include <AK/Time.h>
 #include <LibCore/SharedCircularQueue.h>
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/YUVData.h>
 #include <LibMedia/Demuxer.h>
 #include <LibThreading/ConditionVariable.h>
 #include <LibThreading/Mutex.h>
@@ -22,6 +24,10 @@
 
 namespace Media {
 
+// A decoded frame, either as YUV planes that are converted to RGB as they are drawn, or as an already converted bitmap
+// for frames whose colors need a conversion that drawing can't do.
+using PresentableVideoFrame = Variant<NonnullRefPtr<Gfx::Bitmap>, NonnullRefPtr<Gfx::YUVData>>;
+
 class FrameQueueItem {
 public:
     FrameQueueItem()
@@ -37,9 +43,9 @@ public:
         Error,
     };
 
-    static FrameQueueItem frame(RefPtr<Gfx::Bitmap> bitmap, AK::Duration timestamp)
+    static FrameQueueItem frame(PresentableVideoFrame frame, AK::Duration timestamp)
     {
-        return FrameQueueItem(move(bitmap), timestamp);
+        return FrameQueueItem(move(frame), timestamp);
     }
 
     static FrameQueueItem error_marker(DecoderError&& error, AK::Duration timestamp)
@@ -47,8 +53,8 @@ public:
         return FrameQueueItem(move(error), timestamp);
     }
 
-    bool is_frame() const { return m_data.has<RefPtr<Gfx::Bitmap>>(); }
-    RefPtr<Gfx::Bitmap> bitmap() const { return m_data.get<RefPtr<Gfx::Bitmap>>(); }
+    bool is_frame() const { return m_data.has<PresentableVideoFrame>(); }
+    PresentableVideoFrame const& frame() const { return m_data.get<PresentableVideoFrame>(); }
     AK::Duration timestamp() const { return m_timestamp; }
 
     bool is_error() const { return m_data.has<DecoderError>(); }
@@ -70,8 +76,8 @@ public:
     }
 
 private:
-    FrameQueueItem(RefPtr<Gfx::Bitmap> bitmap, AK::Duration timestamp)
-        : m_data(move(bitmap))
+    FrameQueueItem(PresentableVideoFrame frame, AK::Duration timestamp)
+        : m_data(move(frame))
         , m_timestamp(timestamp)
     {
         VERIFY(m_timestamp != no_timestamp);
@@ -83,12 +89,15 @@ private:
     {
     }
 
-    Variant<Empty, RefPtr<Gfx::Bitmap>, DecoderError> m_data { Empty() };
+    Variant<Empty, PresentableVideoFrame, DecoderError> m_data { Empty() };
     AK::Duration m_timestamp { no_timestamp };
 };
 
-static constexpr size_t frame_buffer_count = 4;
-using VideoFrameQueue = Core::SharedSingleProducerCircularQueue<FrameQueueItem, frame_buffer_count>;
+// The decode thread runs ahead of presentation by up to decoded_frame_queue_size() frames. The queue is allocated for the
+// largest supported look-ahead, and the look-ahead actually used can be lowered at runtime.
+static constexpr size_t maximum_decoded_frame_queue_size = 16;
+static constexpr size_t minimum_decoded_frame_queue_size = 2;
+using VideoFrameQueue = Core::SharedSingleProducerCircularQueue<FrameQueueItem, maximum_decoded_frame_queue_size>;
 
 enum class PlaybackState {
     Playing,
@@ -110,6 +119,8 @@ public:
 
     static constexpr SeekMode DEFAULT_SEEK_MODE = SeekMode::Accurate;
 
+    static constexpr AK::Duration late_frame_threshold = AK::Duration::from_milliseconds(50);
+
     static DecoderErrorOr<NonnullOwnPtr<PlaybackManager>> from_data(ReadonlyBytes data);
     static DecoderErrorOr<NonnullOwnPtr<PlaybackManager>> from_stream(NonnullOwnPtr<SeekableStream> stream);
 
@@ -130,12 +141,20 @@ public:
         return m_playback_handler->get_state();
     }
 
+    size_t decoded_frame_queue_size() const { return m_decoded_frame_queue_size.load(); }
+    void set_decoded_frame_queue_size(size_t);
+
+    u64 number_of_decoded_frames() const { return m_decoded_frames.load(); }
+    u64 number_of_presented_frames() const { return m_presented_frames; }
+    // Frames that were decoded but never presented, because a later frame was already due by the time they were dequeued.
     u64 number_of_skipped_frames() const { return m_skipped_frames; }
+    // Frames that were presented, but later than their timestamp by more than late_frame_threshold.
+    u64 number_of_late_frames() const { return m_late_frames; }
 
     AK::Duration current_playback_time();
     AK::Duration duration();
 
-    Function<void(RefPtr<Gfx::Bitmap>)> on_video_frame;
+    Function<void(PresentableVideoFrame)> on_video_frame;
     Function<void()> on_playback_state_change;
     Function<void(DecoderError)> on_decoder_error;
     Function<void(Error)> on_fatal_playback_error;
@@ -161,10 +180,16 @@ private:
     Optional<FrameQueueItem> dequeue_one_frame();
     void set_state_update_timer(int delay_ms);
 
+    // Asks the decode thread to jump ahead to the most recent keyframe before the given time, if that keyframe is past
+    // the samples it has already decoded.
+    void request_skip_to_keyframe(AK::Duration);
+    // This must be called with m_decoder_mutex locked!
+    DecoderErrorOr<void> skip_to_requested_keyframe();
+
     void decode_and_queue_one_sample();
 
     void dispatch_decoder_error(DecoderError error);
-    void dispatch_new_frame(RefPtr<Gfx::Bitmap> frame);
+    void dispatch_new_frame(PresentableVideoFrame frame);
     // Returns whether we changed playback states. If so, any PlaybackStateHandler processing must cease.
     [[nodiscard]] bool dispatch_frame_queue_item(FrameQueueItem&&);
     void dispatch_state_change();
@@ -177,6 +202,7 @@ private:
     Track m_selected_video_track;
 
     VideoFrameQueue m_frame_queue;
+    Atomic<size_t> m_decoded_frame_queue_size { minimum_decoded_frame_queue_size };
 
     RefPtr<Core::Timer> m_state_update_timer;
 
@@ -187,10 +213,19 @@ private:
     Threading::ConditionVariable m_decode_wait_condition;
     Atomic<bool> m_buffer_is_full { false };
 
+    static constexpr i64 no_keyframe_skip_requested = NumericLimits<i64>::min();
+    Atomic<i64> m_keyframe_skip_target_in_nanoseconds { no_keyframe_skip_requested };
+    // Guarded by m_decoder_mutex.
+    Optional<AK::Duration> m_last_decoded_sample_timestamp;
+    Optional<AK::Duration> m_last_keyframe_skip_target;
+
     OwnPtr<PlaybackStateHandler> m_playback_handler;
     Optional<FrameQueueItem> m_next_frame;
 
+    Atomic<u64> m_decoded_frames { 0 };
+    u64 m_presented_frames { 0 };
     u64 m_skipped_frames { 0 };
+    u64 m_late_frames { 0 };
 
     // This is a nested class to allow private access.
     class PlaybackStateHandler {
@@ -10,13 +10,6 @@
 
 #include "VideoFrame.h"
 
-#ifdef AK_OS_WINDOWS
-#    define aligned_alloc(alignment, size) _aligned_malloc(size, alignment)
-#    define aligned_free _aligned_free
-#else
-#    define aligned_free free
-#endif
-
 namespace Media {
 
 ErrorOr<NonnullOwnPtr<SubsampledYUVFrame>> SubsampledYUVFrame::try_create(
@@ -26,23 +19,10 @@ ErrorOr<NonnullOwnPtr<SubsampledYUVFrame>> SubsampledYUVFrame::try_create(
     Subsampling subsampling)
 {
     VERIFY(bit_depth < 16);
-    size_t component_size = bit_depth > 8 ? sizeof(u16) : sizeof(u8);
-    size_t alignment_size = max(bit_depth > 8 ? sizeof(u16) : sizeof(u8), sizeof(void*));
 
-    auto alloc_buffer = [&](size_t size) -> ErrorOr<u8*> {
-        void* buffer = aligned_alloc(alignment_size, round_up_to_power_of_two(size, alignment_size));
-        if (!buffer)
-            return Error::from_errno(ENOMEM);
-        return reinterpret_cast<u8*>(buffer);
-    };
-
-    auto y_data_size = size.to_type<size_t>().area() * component_size;
-    auto uv_data_size = subsampling.subsampled_size(size).to_type<size_t>().area() * component_size;
-    auto* y_buffer = TRY(alloc_buffer(y_data_size));
-    auto* u_buffer = TRY(alloc_buffer(uv_data_size));
-    auto* v_buffer = TRY(alloc_buffer(uv_data_size));
-
-    return adopt_nonnull_own_or_enomem(new (nothrow) SubsampledYUVFrame(timestamp, size, bit_depth, cicp, subsampling, y_buffer, u_buffer, v_buffer));
+    // NOTE: The planes are decoded straight into YUVData, so that they can later be presented without being copied.
+    auto yuv_data = TRY(Gfx::YUVData::create(size.to_type<int>(), max<u8>(bit_depth, 8), subsampling.x(), subsampling.y()));
+    return adopt_nonnull_own_or_enomem(new (nothrow) SubsampledYUVFrame(timestamp, size, bit_depth, cicp, subsampling, move(yuv_data)));
 }
 
 ErrorOr<NonnullOwnPtr<SubsampledYUVFrame>> SubsampledYUVFrame::try_create_from_data(
@@ -62,18 +42,13 @@ ErrorOr<NonnullOwnPtr<SubsampledYUVFrame>> SubsampledYUVFrame::try_create_from_d
     VERIFY(u_data.size() >= uv_data_size);
     VERIFY(v_data.size() >= uv_data_size);
 
-    memcpy(frame->m_y_buffer, y_data.data(), y_data_size);
-    memcpy(frame->m_u_buffer, u_data.data(), uv_data_size);
-    memcpy(frame->m_v_buffer, v_data.data(), uv_data_size);
+    memcpy(frame->get_raw_plane_data(0), y_data.data(), y_data_size);
+    memcpy(frame->get_raw_plane_data(1), u_data.data(), uv_data_size);
+    memcpy(frame->get_raw_plane_data(2), v_data.data(), uv_data_size);
     return frame;
 }
 
-SubsampledYUVFrame::~SubsampledYUVFrame()
-{
-    aligned_free(m_y_buffer);
-    aligned_free(m_u_buffer);
-    aligned_free(m_v_buffer);
-}
+SubsampledYUVFrame::~SubsampledYUVFrame() = default;
 
 template<u32 subsampling_horizontal, typename T>
 ALWAYS_INLINE void interpolate_row(u32 const row, u32 const width, T const* plane_u, T const* plane_v, T* __restrict__ u_row, T* __restrict__ v_row)
@@ -234,7 +209,32 @@ static DecoderErrorOr<void> convert_to_bitmap_selecting_subsampling(Subsampling
 
 DecoderErrorOr<void> SubsampledYUVFrame::output_to_bitmap(Gfx::Bitmap& bitmap)
 {
-    return convert_to_bitmap_selecting_subsampling(m_subsampling, cicp(), bit_depth(), width(), height(), m_y_buffer, m_u_buffer, m_v_buffer, bitmap);
+    return convert_to_bitmap_selecting_subsampling(m_subsampling, cicp(), bit_depth(), width(), height(), get_raw_plane_data(0), get_raw_plane_data(1), get_raw_plane_data(2), bitmap);
+}
+
+RefPtr<Gfx::YUVData> SubsampledYUVFrame::to_yuv_data()
+{
+    // The shader only applies the YCbCr matrix, so the primaries and transfer function must already match the output.
+    if (bit_depth() < 8 || cicp().color_primaries() != ColorPrimaries::BT709 || cicp().transfer_characteristics() != TransferCharacteristics::SRGB)
+        return nullptr;
+
+    switch (cicp().matrix_coefficients()) {
+    case MatrixCoefficients::BT470BG:
+    case MatrixCoefficients::BT601:
+        m_yuv_data->set_matrix_coefficients(Gfx::YUVMatrixCoefficients::BT601);
+        break;
+    case MatrixCoefficients::BT709:
+        m_yuv_data->set_matrix_coefficients(Gfx::YUVMatrixCoefficients::BT709);
+        break;
+    case MatrixCoefficients::BT2020NonConstantLuminance:
+        m_yuv_data->set_matrix_coefficients(Gfx::YUVMatrixCoefficients::BT2020);
+        break;
+    default:
+        return nullptr;
+    }
+
+    m_yuv_data->set_range(cicp().video_full_range_flag() == VideoFullRangeFlag::Full ? Gfx::YUVRange::Full : Gfx::YUVRange::Limited);
+    return m_yuv_data;
 }
 
 }
@@ -9,6 +9,7 @@
 #include <AK/Time.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Size.h>
+#include <LibGfx/YUVData.h>
 #include <LibMedia/Color/CodingIndependentCodePoints.h>
 
 #include "DecoderError.h"
@@ -29,6 +30,10 @@ public:
         return bitmap;
     }
 
+    // Returns the frame's planes ready to be drawn through a YUV to RGB shader, or null if the frame's colors need a
+    // conversion that the shader can't do, in which case to_bitmap() has to be used instead.
+    virtual RefPtr<Gfx::YUVData> to_yuv_data() { return nullptr; }
+
     inline AK::Duration timestamp() const { return m_timestamp; }
 
     inline Gfx::Size<u32> size() const { return m_size; }
@@ -76,33 +81,22 @@ public:
         Gfx::Size<u32> size,
         u8 bit_depth, CodingIndependentCodePoints cicp,
         Subsampling subsampling,
-        u8* plane_y_data, u8* plane_u_data, u8* plane_v_data)
+        NonnullRefPtr<Gfx::YUVData> yuv_data)
         : VideoFrame(timestamp, size, bit_depth, cicp)
         , m_subsampling(subsampling)
-        , m_y_buffer(plane_y_data)
-        , m_u_buffer(plane_u_data)
-        , m_v_buffer(plane_v_data)
+        , m_yuv_data(move(yuv_data))
     {
-        VERIFY(m_y_buffer != nullptr);
-        VERIFY(m_u_buffer != nullptr);
-        VERIFY(m_v_buffer != nullptr);
     }
 
     ~SubsampledYUVFrame();
 
     DecoderErrorOr<void> output_to_bitmap(Gfx::Bitmap& bitmap) override;
+    RefPtr<Gfx::YUVData> to_yuv_data() override;
 
     u8* get_raw_plane_data(u32 plane)
     {
-        switch (plane) {
-        case 0:
-            return m_y_buffer;
-        case 1:
-            return m_u_buffer;
-        case 2:
-            return m_v_buffer;
-        }
-        VERIFY_NOT_REACHED();
+        VERIFY(plane < Gfx::YUVData::plane_count);
+        return m_yuv_data->plane_data(plane).data();
     }
 
     template<typename T>
@@ -114,9 +108,7 @@ public:
 
 protected:
     Subsampling m_subsampling;
-    u8* m_y_buffer = nullptr;
-    u8* m_u_buffer = nullptr;
-    u8* m_v_buffer = nullptr;
+    NonnullRefPtr<Gfx::YUVData> m_yuv_data;
 };
 
 }
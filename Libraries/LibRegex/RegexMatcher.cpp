@@ -4,10 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
 #include <AK/BinarySearch.h>
 #include <AK/BumpAllocator.h>
 #include <AK/ByteString.h>
 #include <AK/Debug.h>
+#include <AK/SIMDExtras.h>
 #include <AK/StringBuilder.h>
 #include <LibRegex/RegexMatcher.h>
 #include <LibRegex/RegexParser.h>
@@ -157,6 +159,55 @@ RegexResult Matcher<Parser>::match(RegexStringView view, Optional<typename Parse
     return match(views, regex_options);
 }
 
+// Returns the index of the first code unit at or after start_index that is one of the candidates, comparing a whole
+// vector of code units at a time.
+template<AK::SIMD::SIMDVector VectorType, typename CodeUnit>
+static Optional<size_t> find_any_code_unit(ReadonlySpan<CodeUnit> haystack, size_t start_index, ReadonlySpan<u32> candidates)
+{
+    using Lane = AK::SIMD::ElementOf<VectorType>;
+    static constexpr size_t lane_count = AK::SIMD::vector_length<VectorType>;
+
+    Vector<Lane, 4> needles;
+    for (auto candidate : candidates) {
+        if (candidate <= NumericLimits<Lane>::max())
+            needles.append(static_cast<Lane>(candidate));
+    }
+    if (needles.is_empty())
+        return {};
+
+    size_t index = start_index;
+    for (; index + lane_count <= haystack.size(); index += lane_count) {
+        auto chunk = AK::SIMD::load_unaligned<VectorType>(haystack.data() + index);
+        VectorType matches {};
+        for (auto needle : needles)
+            matches |= reinterpret_cast<VectorType>(chunk == needle);
+
+        static_assert(sizeof(VectorType) == 2 * sizeof(u64));
+        u64 words[2];
+        __builtin_memcpy(words, &matches, sizeof(VectorType));
+        if ((words[0] | words[1]) == 0)
+            continue;
+
+        for (size_t lane = 0; lane < lane_count; ++lane) {
+            if (matches[lane])
+                return index + lane;
+        }
+    }
+
+    for (; index < haystack.size(); ++index) {
+        if (needles.contains_slow(static_cast<Lane>(haystack[index])))
+            return index;
+    }
+    return {};
+}
+
+static Optional<size_t> find_next_candidate_position(RegexStringView const& view, size_t start_index, ReadonlySpan<u32> candidates)
+{
+    if (view.is_u16_view())
+        return find_any_code_unit<AK::SIMD::u16x8>(view.u16_view().span(), start_index, candidates);
+    return find_any_code_unit<AK::SIMD::u8x16>(view.u8_view().bytes(), start_index, candidates);
+}
+
 template<typename Parser>
 RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optional<typename ParserTraits<Parser>::OptionsType> regex_options) const
 {
@@ -228,6 +279,52 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
         return -1;
     };
 
+    // OPTIMIZATION: A pattern that is nothing but a sequence of characters can be matched by comparing them directly,
+    //               without entering the bytecode VM. We only do this when no case folding or code point decoding is
+    //               involved, and for UTF-8 input only if all the characters are ASCII (so bytes and characters coincide).
+    Vector<u32> const* pure_substring = nullptr;
+    bool pure_substring_is_ascii = false;
+    if (auto const& substring = m_pattern->parser_result.optimization_data.pure_substring_search; substring.has_value()
+        && !unicode && !input.regex_options.has_flag_set(AllFlags::Insensitive)) {
+        pure_substring = &substring.value();
+        pure_substring_is_ascii = all_of(*pure_substring, [](u32 code_unit) { return is_ascii(code_unit); });
+    }
+
+    // OPTIMIZATION: If every match has to start with one of a handful of code units, we can scan ahead to the next
+    //               one of them with vector compares, instead of trying (or range checking) every position in between.
+    static constexpr size_t maximum_candidate_code_units = 4;
+    Vector<u32, maximum_candidate_code_units> candidate_code_units;
+    if (continue_search && !only_start_of_line && !unicode && !input.regex_options.has_flag_set(AllFlags::Insensitive)) {
+        if (pure_substring) {
+            if (!pure_substring->is_empty())
+                candidate_code_units.append(pure_substring->first());
+        } else {
+            size_t candidate_count = 0;
+            for (auto const& range : m_pattern->parser_result.optimization_data.starting_ranges)
+                candidate_count += range.to - range.from + 1;
+            if (candidate_count <= maximum_candidate_code_units) {
+                for (auto const& range : m_pattern->parser_result.optimization_data.starting_ranges) {
+                    for (auto code_unit = range.from; code_unit <= range.to; ++code_unit)
+                        candidate_code_units.append(code_unit);
+                }
+            }
+        }
+    }
+
+    auto match_pure_substring_at = [&](size_t view_index) {
+        ++operations;
+        auto const& substring = *pure_substring;
+        if (substring.size() > input.view.length() - view_index)
+            return false;
+        for (size_t i = 0; i < substring.size(); ++i) {
+            if (input.view.code_unit_at(view_index + i) != substring[i])
+                return false;
+        }
+        state.string_position = view_index + substring.size();
+        state.string_position_in_code_units = state.string_position;
+        return true;
+    };
+
     for (auto const& view : views) {
         if (lines_to_skip != 0) {
             ++input.line;
@@ -239,6 +336,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
 
         auto view_length = view.length();
         size_t view_index = m_pattern->start_offset;
+        bool use_pure_substring = pure_substring && (view.is_u16_view() || pure_substring_is_ascii);
         state.string_position = view_index;
         state.string_position_in_code_units = view_index;
         bool succeeded = false;
@@ -288,6 +386,13 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             if (match_length_minimum && match_length_minimum > view_length - view_index)
                 break;
 
+            if (!candidate_code_units.is_empty()) {
+                auto candidate_position = find_next_candidate_position(view, view_index, candidate_code_units);
+                if (!candidate_position.has_value())
+                    break;
+                view_index = *candidate_position;
+            }
+
             if (auto& starting_ranges = m_pattern->parser_result.optimization_data.starting_ranges; !starting_ranges.is_empty()) {
                 if (!binary_search(starting_ranges, input.view.code_unit_at(view_index), nullptr, compare_range))
                     goto done_matching;
@@ -301,7 +406,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             state.instruction_position = 0;
             state.repetition_marks.clear();
 
-            if (execute(input, state, operations)) {
+            if (use_pure_substring ? match_pure_substring_at(view_index) : execute(input, state, operations)) {
                 succeeded = true;
 
                 if (input.regex_options.has_flag_set(AllFlags::MatchNotEndOfLine) && state.string_position == input.view.length()) {
@@ -806,31 +806,26 @@ bool Regex<Parser>::attempt_rewrite_entire_match_as_substring_search(BasicBlockL
         return false;
 
     if (basic_blocks.is_empty()) {
-        parser_result.optimization_data.pure_substring_search = ""sv;
+        parser_result.optimization_data.pure_substring_search = Vector<u32> {};
         return true; // Empty regex, sure.
     }
 
     auto& bytecode = parser_result.bytecode;
 
-    auto is_unicode = parser_result.options.has_flag_set(AllFlags::Unicode) || parser_result.options.has_flag_set(AllFlags::UnicodeSets);
-
     // We have a single basic block, let's see if it's a series of character or string compares.
-    StringBuilder final_string;
+    Vector<u32> final_string;
     auto state = MatchState::only_for_enumeration();
     while (state.instruction_position < bytecode.size()) {
         auto& opcode = bytecode.get_opcode(state);
         switch (opcode.opcode_id()) {
         case OpCodeId::Compare: {
             auto& compare = static_cast<OpCode_Compare const&>(opcode);
-            for (auto& flat_compare : compare.flat_compares()) {
-                if (flat_compare.type != CharacterCompareType::Char)
-                    return false;
-
-                if (is_unicode || flat_compare.value <= 0x7f)
-                    final_string.append_code_point(flat_compare.value);
-                else
-                    final_string.append(bit_cast<char>(static_cast<u8>(flat_compare.value)));
-            }
+            auto flat_compares = compare.flat_compares();
+            // NOTE: A compare with several arguments matches any one of them (e.g. [ab]), not all of them in sequence.
+            if (flat_compares.size() != 1 || flat_compares.first().type != CharacterCompareType::Char)
+                return false;
+
+            final_string.append(flat_compares.first().value);
             break;
         }
         default:
@@ -839,7 +834,7 @@ bool Regex<Parser>::attempt_rewrite_entire_match_as_substring_search(BasicBlockL
         state.instruction_position += opcode.size();
     }
 
-    parser_result.optimization_data.pure_substring_search = final_string.to_byte_string();
+    parser_result.optimization_data.pure_substring_search = move(final_string);
     return true;
 }
 
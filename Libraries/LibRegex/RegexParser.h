@@ -63,7 +63,8 @@ public:
         AllOptions options;
 
         struct {
-            Optional<ByteString> pure_substring_search;
+            // If populated, the pattern is just this sequence of characters (code points in Unicode mode, code units otherwise).
+            Optional<Vector<u32>> pure_substring_search;
             // If populated, the pattern only accepts strings that start with a character in these ranges.
             Vector<CharRange> starting_ranges;
             bool only_start_of_line = false;
@@ -23,6 +23,7 @@ bool Request::stop()
 
     m_internal_buffered_data = nullptr;
     m_internal_stream_data = nullptr;
+    m_request_body_stream = nullptr;
     m_mode = Mode::Unknown;
 
     return m_client->stop_request({}, *this);
@@ -44,6 +45,46 @@ void Request::set_request_fd(Badge<Requests::RequestClient>, int fd)
     m_internal_stream_data->read_stream = move(stream);
 }
 
+void Request::set_up_request_body_stream(Badge<RequestClient>, NonnullOwnPtr<Core::LocalSocket> socket, ByteBuffer request_body)
+{
+    VERIFY(!m_request_body_stream);
+
+    auto write_notifier = Core::Notifier::construct(socket->fd().value(), Core::Notifier::Type::Write);
+    write_notifier->set_enabled(false);
+    write_notifier->on_activation = [this] {
+        write_request_body_without_blocking();
+    };
+
+    m_request_body_stream = make<RequestBodyStream>(move(socket), move(write_notifier), move(request_body));
+    write_request_body_without_blocking();
+}
+
+void Request::write_request_body_without_blocking()
+{
+    auto& stream = *m_request_body_stream;
+
+    while (stream.bytes_written < stream.body.size()) {
+        auto result = stream.socket->write_some(stream.body.bytes().slice(stream.bytes_written));
+        if (result.is_error()) {
+            // RequestServer hasn't uploaded what we gave it so far. Wait until it has room for more.
+            if (result.error().is_errno() && result.error().code() == EAGAIN) {
+                stream.write_notifier->set_enabled(true);
+                return;
+            }
+
+            // RequestServer stopped reading the body, e.g. because the request failed. It will report the failure itself.
+            break;
+        }
+        stream.bytes_written += result.value();
+    }
+
+    // NOTE: Closing our end of the socket is what tells RequestServer that the body is complete. We may be running
+    //       inside the write notifier's callback, so we only close things here rather than destroying the stream.
+    stream.write_notifier->close();
+    stream.socket->close();
+    stream.body = {};
+}
+
 void Request::set_buffered_request_finished_callback(BufferedRequestFinished on_buffered_request_finished)
 {
     VERIFY(m_mode == Mode::Unknown);
@@ -7,12 +7,14 @@
 #pragma once
 
 #include <AK/Badge.h>
+#include <AK/ByteBuffer.h>
 #include <AK/ByteString.h>
 #include <AK/Function.h>
 #include <AK/MemoryStream.h>
 #include <AK/RefCounted.h>
 #include <AK/WeakPtr.h>
 #include <LibCore/Notifier.h>
+#include <LibCore/Socket.h>
 #include <LibHTTP/HeaderMap.h>
 #include <LibRequests/NetworkError.h>
 #include <LibRequests/RequestTimingInfo.h>
@@ -59,11 +61,13 @@ public:
 
     RefPtr<Core::Notifier>& write_notifier(Badge<RequestClient>) { return m_write_notifier; }
     void set_request_fd(Badge<RequestClient>, int fd);
+    void set_up_request_body_stream(Badge<RequestClient>, NonnullOwnPtr<Core::LocalSocket>, ByteBuffer request_body);
 
 private:
     explicit Request(RequestClient&, i32 request_id);
 
     void set_up_internal_stream_data(DataReceived on_data_available);
+    void write_request_body_without_blocking();
 
     WeakPtr<RequestClient> m_client;
     int m_request_id { -1 };
@@ -100,8 +104,16 @@ private:
         bool user_finish_called { false };
     };
 
+    struct RequestBodyStream {
+        NonnullOwnPtr<Core::LocalSocket> socket;
+        NonnullRefPtr<Core::Notifier> write_notifier;
+        ByteBuffer body;
+        size_t bytes_written { 0 };
+    };
+
     OwnPtr<InternalBufferedData> m_internal_buffered_data;
     OwnPtr<InternalStreamData> m_internal_stream_data;
+    OwnPtr<RequestBodyStream> m_request_body_stream;
 };
 
 }
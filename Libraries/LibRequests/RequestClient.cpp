@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/Socket.h>
 #include <LibCore/System.h>
 #include <LibRequests/Request.h>
 #include <LibRequests/RequestClient.h>
@@ -28,7 +29,31 @@ void RequestClient::ensure_connection(URL::URL const& url, ::RequestServer::Cach
     async_ensure_connection(url, cache_level);
 }
 
-RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ReadonlyBytes request_body, Core::ProxyData const& proxy_data)
+// Request bodies at least this large are streamed to RequestServer over a socket instead of being sent inline with the
+// start_request message, so that RequestServer only holds as much of the body as it is currently uploading.
+static constexpr size_t request_body_streaming_threshold = 1 * MiB;
+
+static ErrorOr<NonnullOwnPtr<Core::LocalSocket>> create_request_body_stream(IPC::File& server_end)
+{
+    int socket_fds[2] {};
+    TRY(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, socket_fds));
+
+    auto client_socket_or_error = Core::LocalSocket::adopt_fd(socket_fds[0]);
+    if (client_socket_or_error.is_error()) {
+        (void)Core::System::close(socket_fds[0]);
+        (void)Core::System::close(socket_fds[1]);
+        return client_socket_or_error.release_error();
+    }
+
+    server_end = IPC::File::adopt_fd(socket_fds[1]);
+
+    auto client_socket = client_socket_or_error.release_value();
+    TRY(client_socket->set_blocking(false));
+    client_socket->set_notifications_enabled(false);
+    return client_socket;
+}
+
+RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ReadonlyBytes request_body, Core::ProxyData const& proxy_data, ByteString const& cache_partition_key, ::RequestServer::RequestPriority priority, bool allow_tls_early_data)
 {
     auto body_result = ByteBuffer::copy(request_body);
     if (body_result.is_error())
@@ -37,8 +62,22 @@ RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL
     static i32 s_next_request_id = 0;
     auto request_id = s_next_request_id++;
 
-    IPCProxy::async_start_request(request_id, method, url, request_headers, body_result.release_value(), proxy_data);
     auto request = Request::create_from_id({}, *this, request_id);
+
+    if (request_body.size() >= request_body_streaming_threshold) {
+        IPC::File server_end;
+        auto client_socket = create_request_body_stream(server_end);
+        if (client_socket.is_error()) {
+            dbgln("RequestClient: Failed to create request body stream: {}", client_socket.error());
+            return nullptr;
+        }
+
+        IPCProxy::async_start_request(request_id, method, url, request_headers, {}, move(server_end), request_body.size(), proxy_data, cache_partition_key, priority, allow_tls_early_data);
+        request->set_up_request_body_stream({}, client_socket.release_value(), body_result.release_value());
+    } else {
+        IPCProxy::async_start_request(request_id, method, url, request_headers, body_result.release_value(), {}, 0, proxy_data, cache_partition_key, priority, allow_tls_early_data);
+    }
+
     m_requests.set(request_id, request);
     return request;
 }
@@ -111,11 +150,15 @@ void RequestClient::websocket_connected(i64 websocket_id)
         maybe_connection.value()->did_open({});
 }
 
-void RequestClient::websocket_received(i64 websocket_id, bool is_text, ByteBuffer data)
+void RequestClient::websocket_received(i64 websocket_id, Vector<WebSocket::Message> messages)
 {
-    auto maybe_connection = m_websockets.get(websocket_id);
-    if (maybe_connection.has_value())
-        maybe_connection.value()->did_receive({}, move(data), is_text);
+    for (auto& message : messages) {
+        // NOTE: The connection is looked up again for every message, as handling one may close it.
+        auto maybe_connection = m_websockets.get(websocket_id);
+        if (!maybe_connection.has_value())
+            return;
+        maybe_connection.value()->did_receive({}, move(message.data), message.is_text);
+    }
 }
 
 void RequestClient::websocket_errored(i64 websocket_id, i32 message)
@@ -6,8 +6,12 @@
  */
 
 #include <AK/Function.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/QuickSort.h>
 #include <AK/Time.h>
 #include <LibCore/ArgsParser.h>
+#include <LibCore/File.h>
 #include <LibTest/Macros.h>
 #include <LibTest/TestResult.h>
 #include <LibTest/TestSuite.h>
@@ -21,15 +25,15 @@ class TestElapsedTimer {
 public:
     TestElapsedTimer() { restart(); }
 
-    void restart() { m_started = UnixDateTime::now(); }
+    void restart() { m_started = MonotonicTime::now(); }
 
     AK::Duration elapsed() const
     {
-        return UnixDateTime::now() - m_started;
+        return MonotonicTime::now() - m_started;
     }
 
 private:
-    UnixDateTime m_started;
+    MonotonicTime m_started { MonotonicTime::now() };
 };
 
 // Declared in Macros.h
@@ -124,6 +128,11 @@ int TestSuite::main(ByteString const& suite_name, Span<StringView> arguments)
     args_parser.add_option(do_tests_only, "Only run tests.", "tests");
     args_parser.add_option(do_benchmarks_only, "Only run benchmarks.", "bench");
     args_parser.add_option(m_benchmark_repetitions, "Number of times to repeat each benchmark (default 1)", "benchmark_repetitions", 0, "N");
+    args_parser.add_option(m_benchmark_warmup_runs, "Number of untimed runs of each benchmark before it is measured (default 0)", "benchmark_warmup", 0, "N");
+    args_parser.add_option(m_benchmark_min_time_ms, "Keep repeating each benchmark until it has run for at least this long (default 0)", "benchmark_min_time", 0, "MS");
+    args_parser.add_option(m_benchmark_results_path, "Write the benchmark results to a JSON file", "benchmark_json", 0, "PATH");
+    args_parser.add_option(m_benchmark_baseline_path, "Compare the benchmark results with a JSON file written by --benchmark_json", "benchmark_baseline", 0, "PATH");
+    args_parser.add_option(m_benchmark_regression_threshold, "Fail benchmarks whose median time is this many percent above the baseline (default 10)", "benchmark_regression_threshold", 0, "PERCENT");
     args_parser.add_option(m_randomized_runs, "Number of times to run each RANDOMIZED_TEST_CASE (default 100)", "randomized_runs", 0, "RUNS");
     args_parser.add_option(do_list_cases, "List available test cases.", "list");
     args_parser.add_positional_argument(search_string, "Only run matching cases.", "pattern", Core::ArgsParser::Required::No);
@@ -142,9 +151,132 @@ int TestSuite::main(ByteString const& suite_name, Span<StringView> arguments)
         return 0;
     }
 
+    if (!m_benchmark_baseline_path.is_empty()) {
+        if (auto result = load_benchmark_baseline(); result.is_error()) {
+            warnln("Unable to load benchmark baseline '{}': {}", m_benchmark_baseline_path, result.error());
+            return 1;
+        }
+    }
+
     outln("Running {} cases out of {}.", matching_tests.size(), m_cases.size());
 
-    return run(matching_tests);
+    auto result = run(matching_tests);
+
+    if (!m_benchmark_results_path.is_empty()) {
+        if (auto write_result = write_benchmark_results(); write_result.is_error()) {
+            warnln("Unable to write benchmark results to '{}': {}", m_benchmark_results_path, write_result.error());
+            return 1;
+        }
+    }
+
+    return result;
+}
+
+TestSuite::BenchmarkStatistics TestSuite::compute_benchmark_statistics(Vector<AK::Duration> samples)
+{
+    VERIFY(!samples.is_empty());
+    quick_sort(samples);
+
+    BenchmarkStatistics statistics;
+    statistics.samples = samples.size();
+    statistics.min = samples.first();
+    statistics.max = samples.last();
+
+    for (auto sample : samples)
+        statistics.total += sample;
+
+    auto mean_ns = static_cast<double>(statistics.total.to_nanoseconds()) / static_cast<double>(samples.size());
+    statistics.mean = AK::Duration::from_nanoseconds(static_cast<i64>(mean_ns));
+
+    auto middle = samples.size() / 2;
+    if (samples.size() % 2 == 0)
+        statistics.median = AK::Duration::from_nanoseconds((samples[middle - 1].to_nanoseconds() + samples[middle].to_nanoseconds()) / 2);
+    else
+        statistics.median = samples[middle];
+
+    if (samples.size() > 1) {
+        double sum_of_squared_deviations = 0;
+        for (auto sample : samples) {
+            auto deviation = static_cast<double>(sample.to_nanoseconds()) - mean_ns;
+            sum_of_squared_deviations += deviation * deviation;
+        }
+        auto standard_deviation_ns = sqrt(sum_of_squared_deviations / static_cast<double>(samples.size() - 1));
+        statistics.standard_deviation = AK::Duration::from_nanoseconds(static_cast<i64>(standard_deviation_ns));
+    }
+
+    return statistics;
+}
+
+static double to_milliseconds(AK::Duration duration)
+{
+    return static_cast<double>(duration.to_nanoseconds()) / 1'000'000.0;
+}
+
+ErrorOr<void> TestSuite::load_benchmark_baseline()
+{
+    auto file = TRY(Core::File::open(m_benchmark_baseline_path, Core::File::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+    auto json = TRY(JsonValue::from_string(contents));
+
+    if (!json.is_object())
+        return Error::from_string_literal("Expected a JSON object");
+
+    auto benchmarks = json.as_object().get_array("benchmarks"sv);
+    if (!benchmarks.has_value())
+        return Error::from_string_literal("Expected a 'benchmarks' array");
+
+    benchmarks->for_each([&](JsonValue const& benchmark) {
+        if (!benchmark.is_object())
+            return;
+
+        auto name = benchmark.as_object().get_string("name"sv);
+        auto median_ns = benchmark.as_object().get_double_with_precision_loss("median_ns"sv);
+        if (name.has_value() && median_ns.has_value())
+            m_benchmark_baseline_median_ns.set(name->to_byte_string(), *median_ns);
+    });
+
+    return {};
+}
+
+void TestSuite::compare_benchmark_with_baseline(TestCase const& test_case, BenchmarkStatistics const& statistics)
+{
+    auto baseline_median_ns = m_benchmark_baseline_median_ns.get(test_case.name());
+    if (!baseline_median_ns.has_value() || *baseline_median_ns <= 0)
+        return;
+
+    auto change = (static_cast<double>(statistics.median.to_nanoseconds()) - *baseline_median_ns) / *baseline_median_ns * 100;
+    dbgln("Benchmark '{}' median changed by {:+.1f}% compared to the baseline ({:.3f}ms)", test_case.name(), change, *baseline_median_ns / 1'000'000.0);
+
+    if (change > m_benchmark_regression_threshold) {
+        warnln("Benchmark '{}' regressed by {:.1f}%, which is more than the threshold of {:.1f}%", test_case.name(), change, m_benchmark_regression_threshold);
+        m_current_test_result = TestResult::Failed;
+    }
+}
+
+void TestSuite::record_benchmark_result(TestCase const& test_case, BenchmarkStatistics const& statistics)
+{
+    JsonObject result;
+    result.set("name"sv, MUST(String::from_byte_string(test_case.name())));
+    result.set("result"sv, MUST(String::from_byte_string(test_result_to_string(m_current_test_result))));
+    result.set("samples"sv, statistics.samples);
+    result.set("mean_ns"sv, statistics.mean.to_nanoseconds());
+    result.set("median_ns"sv, statistics.median.to_nanoseconds());
+    result.set("standard_deviation_ns"sv, statistics.standard_deviation.to_nanoseconds());
+    result.set("min_ns"sv, statistics.min.to_nanoseconds());
+    result.set("max_ns"sv, statistics.max.to_nanoseconds());
+    result.set("total_ns"sv, statistics.total.to_nanoseconds());
+    m_benchmark_results.must_append(move(result));
+}
+
+ErrorOr<void> TestSuite::write_benchmark_results() const
+{
+    JsonObject results;
+    results.set("suite"sv, TRY(String::from_byte_string(m_suite_name)));
+    results.set("benchmarks"sv, m_benchmark_results);
+
+    auto file = TRY(Core::File::open(m_benchmark_results_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    TRY(file->write_until_depleted(results.serialized().bytes()));
+    return {};
 }
 
 Vector<NonnullRefPtr<TestCase>> TestSuite::find_cases(ByteString const& search, bool find_tests, bool find_benchmarks)
@@ -179,48 +311,67 @@ int TestSuite::run(Vector<NonnullRefPtr<TestCase>> const& tests)
 
     for (auto const& t : tests) {
         auto const test_type = t->is_benchmark() ? "benchmark" : "test";
-        auto const repetitions = t->is_benchmark() ? m_benchmark_repetitions : 1;
 
         warnln("Running {} '{}'.", test_type, t->name());
         m_current_test_result = TestResult::NotRun;
         enable_reporting();
 
-        AK::Duration total_time;
-        u64 sum_of_squared_times = 0;
-        AK::Duration min_time = AK::Duration::max();
-        AK::Duration max_time;
-
-        for (u64 i = 0; i < repetitions; ++i) {
+        auto run_once = [&] {
             TestElapsedTimer timer;
             t->func()();
-            auto const iteration_time = timer.elapsed();
-            auto const iteration_ms = iteration_time.to_milliseconds();
-            total_time += iteration_time;
-            sum_of_squared_times += iteration_ms * iteration_ms;
-            min_time = min(min_time, iteration_time);
-            max_time = max(max_time, iteration_time);
+            auto elapsed = timer.elapsed();
 
             // Non-randomized tests don't touch the test result when passing.
             if (m_current_test_result == TestResult::NotRun)
                 m_current_test_result = TestResult::Passed;
-        }
-
-        auto const total_time_ms = total_time.to_milliseconds();
+            return elapsed;
+        };
 
-        if (repetitions != 1) {
-            double average = total_time_ms / static_cast<double>(repetitions);
-            double average_squared = average * average;
-            double standard_deviation = sqrt((sum_of_squared_times + repetitions * average_squared - 2 * total_time_ms * average) / (repetitions - 1));
+        AK::Duration total_time;
 
-            dbgln("{} {} '{}' on average in {:.1f}±{:.1f}ms (min={}ms, max={}ms, total={}ms)",
-                test_result_to_string(m_current_test_result), test_type, t->name(),
-                average,
-                standard_deviation,
-                min_time.to_milliseconds(),
-                max_time.to_milliseconds(),
-                total_time_ms);
+        if (!t->is_benchmark()) {
+            total_time = run_once();
+            dbgln("{} {} '{}' in {}ms", test_result_to_string(m_current_test_result), test_type, t->name(), total_time.to_milliseconds());
         } else {
-            dbgln("{} {} '{}' in {}ms", test_result_to_string(m_current_test_result), test_type, t->name(), total_time_ms);
+            for (u64 i = 0; i < m_benchmark_warmup_runs; ++i)
+                (void)run_once();
+
+            // Benchmarks are repeated at least the requested number of times, and then for as long as it takes to reach
+            // the requested minimum time, which calibrates the number of samples to how long the benchmark takes.
+            auto const min_time = AK::Duration::from_milliseconds(static_cast<i64>(m_benchmark_min_time_ms));
+            Vector<AK::Duration> samples;
+            AK::Duration sampled_time;
+
+            while (samples.size() < max<u64>(m_benchmark_repetitions, 1) || sampled_time < min_time) {
+                auto sample = run_once();
+                samples.append(sample);
+                sampled_time += sample;
+
+                if (m_current_test_result == TestResult::Failed)
+                    break;
+            }
+
+            auto statistics = compute_benchmark_statistics(move(samples));
+            total_time = statistics.total;
+
+            if (statistics.samples != 1) {
+                dbgln("{} {} '{}' on average in {:.3f}±{:.3f}ms (median={:.3f}ms, min={:.3f}ms, max={:.3f}ms, total={:.3f}ms, samples={})",
+                    test_result_to_string(m_current_test_result), test_type, t->name(),
+                    to_milliseconds(statistics.mean),
+                    to_milliseconds(statistics.standard_deviation),
+                    to_milliseconds(statistics.median),
+                    to_milliseconds(statistics.min),
+                    to_milliseconds(statistics.max),
+                    to_milliseconds(statistics.total),
+                    statistics.samples);
+            } else {
+                dbgln("{} {} '{}' in {:.3f}ms", test_result_to_string(m_current_test_result), test_type, t->name(), to_milliseconds(statistics.total));
+            }
+
+            if (m_current_test_result == TestResult::Passed)
+                compare_benchmark_with_baseline(*t, statistics);
+            if (!m_benchmark_results_path.is_empty())
+                record_benchmark_result(*t, statistics);
         }
 
         if (t->is_benchmark()) {
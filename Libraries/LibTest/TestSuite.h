@@ -9,6 +9,8 @@
 
 #include <AK/ByteString.h>
 #include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/JsonArray.h>
 #include <AK/Time.h>
 #include <AK/Vector.h>
 #include <LibTest/Export.h>
@@ -65,12 +67,35 @@ public:
     u64 randomized_runs() { return m_randomized_runs; }
 
 private:
+    struct BenchmarkStatistics {
+        size_t samples { 0 };
+        AK::Duration mean;
+        AK::Duration median;
+        AK::Duration standard_deviation;
+        AK::Duration min;
+        AK::Duration max;
+        AK::Duration total;
+    };
+    static BenchmarkStatistics compute_benchmark_statistics(Vector<AK::Duration>);
+
+    ErrorOr<void> load_benchmark_baseline();
+    void compare_benchmark_with_baseline(TestCase const&, BenchmarkStatistics const&);
+    void record_benchmark_result(TestCase const&, BenchmarkStatistics const&);
+    ErrorOr<void> write_benchmark_results() const;
+
     static TestSuite* s_global;
     Vector<NonnullRefPtr<TestCase>> m_cases;
     AK::Duration m_test_time;
     AK::Duration m_bench_time;
     ByteString m_suite_name;
     u64 m_benchmark_repetitions = 1;
+    u64 m_benchmark_warmup_runs = 0;
+    u64 m_benchmark_min_time_ms = 0;
+    StringView m_benchmark_results_path;
+    StringView m_benchmark_baseline_path;
+    double m_benchmark_regression_threshold = 10;
+    HashMap<ByteString, double> m_benchmark_baseline_median_ns;
+    JsonArray m_benchmark_results;
     u64 m_randomized_runs = 100;
     Function<void()> m_setup;
     TestResult m_current_test_result = TestResult::NotRun;
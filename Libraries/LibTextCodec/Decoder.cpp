@@ -408,6 +408,11 @@ ErrorOr<void> Latin1Decoder::process(StringView input, Function<ErrorOr<void>(u3
     return {};
 }
 
+ErrorOr<String> Latin1Decoder::to_utf8(StringView input)
+{
+    return String::from_latin1(input.bytes());
+}
+
 ErrorOr<void> PDFDocEncodingDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     // PDF 1.7 spec, Appendix D.2 "PDFDocEncoding Character Set"
@@ -502,6 +507,35 @@ ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<E
     return {};
 }
 
+template<Integral ArrayType>
+bool SingleByteDecoder<ArrayType>::validate(StringView input)
+{
+    // OPTIMIZATION: ASCII bytes are always valid, so we only look up the bytes in between runs of them.
+    for (auto non_ascii_index = input.find_first_non_ascii_byte(); non_ascii_index.has_value(); non_ascii_index = input.find_first_non_ascii_byte()) {
+        if (m_translation_table[static_cast<u8>(input[*non_ascii_index]) - 0x80] == replacement_code_point)
+            return false;
+        input = input.substring_view(*non_ascii_index + 1);
+    }
+    return true;
+}
+
+template<Integral ArrayType>
+ErrorOr<String> SingleByteDecoder<ArrayType>::to_utf8(StringView input)
+{
+    // OPTIMIZATION: ASCII bytes decode to themselves, so runs of them are appended to the output in one go, and only
+    //               the bytes in between are looked up in the index one by one.
+    StringBuilder builder(input.length());
+
+    for (auto non_ascii_index = input.find_first_non_ascii_byte(); non_ascii_index.has_value(); non_ascii_index = input.find_first_non_ascii_byte()) {
+        TRY(builder.try_append(input.substring_view(0, *non_ascii_index)));
+        TRY(builder.try_append_code_point(m_translation_table[static_cast<u8>(input[*non_ascii_index]) - 0x80]));
+        input = input.substring_view(*non_ascii_index + 1);
+    }
+    TRY(builder.try_append(input));
+
+    return builder.to_string_without_validation();
+}
+
 // https://encoding.spec.whatwg.org/#index-gb18030-ranges-code-point
 static Optional<u32> index_gb18030_ranges_code_point(u32 pointer)
 {
@@ -6,81 +6,114 @@
  */
 
 #include <AK/Queue.h>
+#include <LibCore/System.h>
 #include <LibThreading/BackgroundAction.h>
 #include <LibThreading/Mutex.h>
 #include <LibThreading/Thread.h>
 
+// Enough threads that a slow action (e.g. decoding a huge image) doesn't hold up everything queued behind it, but few
+// enough that a burst of actions doesn't crowd out the threads doing the process's main work.
+static constexpr size_t maximum_background_thread_count = 4;
+
 static pthread_mutex_t s_mutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_cond_t s_condition = PTHREAD_COND_INITIALIZER;
-static Queue<Function<void()>>* s_all_actions;
-static Threading::Thread* s_background_thread;
-static Atomic<bool> s_background_thread_should_run = true;
+static Queue<Function<void()>>* s_actions_by_priority[3];
+static Vector<Threading::Thread*>* s_background_threads;
+static Atomic<bool> s_background_threads_should_run = true;
+
+static Queue<Function<void()>>& actions_for(Threading::BackgroundActionPriority priority)
+{
+    return *s_actions_by_priority[to_underlying(priority)];
+}
+
+static bool has_pending_actions()
+{
+    for (auto* actions : s_actions_by_priority) {
+        if (!actions->is_empty())
+            return true;
+    }
+    return false;
+}
 
 static intptr_t background_thread_func()
 {
-    Vector<Function<void()>> actions;
-    while (s_background_thread_should_run.load(AK::MemoryOrder::memory_order_acquire)) {
+    while (s_background_threads_should_run.load(AK::MemoryOrder::memory_order_acquire)) {
         pthread_mutex_lock(&s_mutex);
 
-        while (s_all_actions->is_empty() && s_background_thread_should_run.load(AK::MemoryOrder::memory_order_acquire))
+        while (!has_pending_actions() && s_background_threads_should_run.load(AK::MemoryOrder::memory_order_acquire))
             pthread_cond_wait(&s_condition, &s_mutex);
 
-        while (!s_all_actions->is_empty())
-            actions.append(s_all_actions->dequeue());
+        // NOTE: Each thread takes one action at a time, so that the other threads can pick up the rest of the queue
+        //       while it works. Higher priority actions always go first.
+        Optional<Function<void()>> action;
+        for (auto priority : { Threading::BackgroundActionPriority::High, Threading::BackgroundActionPriority::Normal, Threading::BackgroundActionPriority::Low }) {
+            if (auto& actions = actions_for(priority); !actions.is_empty()) {
+                action = actions.dequeue();
+                break;
+            }
+        }
 
         pthread_mutex_unlock(&s_mutex);
 
-        for (auto& action : actions) {
-            if (s_background_thread_should_run.load(AK::MemoryOrder::memory_order_acquire))
-                action();
-        }
-        actions.clear();
+        if (action.has_value() && s_background_threads_should_run.load(AK::MemoryOrder::memory_order_acquire))
+            (*action)();
     }
     return 0;
 }
 
 static void init()
 {
-    s_all_actions = new Queue<Function<void()>>;
-    s_background_thread = &Threading::Thread::construct(background_thread_func, "Background Thread"sv).leak_ref();
-    s_background_thread->start();
+    for (auto& actions : s_actions_by_priority)
+        actions = new Queue<Function<void()>>;
+
+    auto thread_count = clamp(static_cast<size_t>(Core::System::hardware_concurrency()), 1, maximum_background_thread_count);
+
+    s_background_threads = new Vector<Threading::Thread*>;
+    for (size_t i = 0; i < thread_count; ++i) {
+        auto* thread = &Threading::Thread::construct(background_thread_func, "Background Thread"sv).leak_ref();
+        thread->start();
+        s_background_threads->append(thread);
+    }
 }
 
 void Threading::quit_background_thread()
 {
-    if (!s_background_thread)
+    if (!s_background_threads)
         return;
 
-    s_background_thread_should_run.store(false, AK::MemoryOrder::memory_order_release);
+    s_background_threads_should_run.store(false, AK::MemoryOrder::memory_order_release);
 
     pthread_mutex_lock(&s_mutex);
     pthread_cond_broadcast(&s_condition);
     pthread_mutex_unlock(&s_mutex);
 
-    MUST(s_background_thread->join());
+    for (auto* thread : *s_background_threads) {
+        MUST(thread->join());
+        thread->unref();
+    }
 
-    delete s_all_actions;
-    s_background_thread->unref();
-    s_all_actions = nullptr;
-    s_background_thread = nullptr;
+    for (auto& actions : s_actions_by_priority) {
+        delete actions;
+        actions = nullptr;
+    }
+    delete s_background_threads;
+    s_background_threads = nullptr;
 
-    s_background_thread_should_run.store(true, AK::MemoryOrder::memory_order_release);
+    s_background_threads_should_run.store(true, AK::MemoryOrder::memory_order_release);
 }
 
-Threading::Thread& Threading::BackgroundActionBase::background_thread()
+void Threading::BackgroundActionBase::enqueue_work(Function<void()> work, BackgroundActionPriority priority)
 {
-    if (s_background_thread == nullptr)
+    pthread_mutex_lock(&s_mutex);
+    if (s_background_threads == nullptr)
         init();
-    return *s_background_thread;
+
+    actions_for(priority).enqueue(move(work));
+    pthread_cond_signal(&s_condition);
+    pthread_mutex_unlock(&s_mutex);
 }
 
-void Threading::BackgroundActionBase::enqueue_work(Function<void()> work)
+void Threading::run_in_background(Function<void()> work, BackgroundActionPriority priority)
 {
-    if (s_all_actions == nullptr)
-        init();
-
-    pthread_mutex_lock(&s_mutex);
-    s_all_actions->enqueue(move(work));
-    pthread_cond_broadcast(&s_condition);
-    pthread_mutex_unlock(&s_mutex);
+    BackgroundActionBase::enqueue_work(move(work), priority);
 }
@@ -23,15 +23,29 @@ namespace Threading {
 template<typename Result>
 class BackgroundAction;
 
+// NOTE: Actions are run by a small pool of threads, so actions queued at the same priority start in the order they
+//       were queued, but may run concurrently and finish in any order.
+enum class BackgroundActionPriority : u8 {
+    // For actions whose result nobody is waiting on yet, e.g. decoding an image that is far outside the viewport.
+    Low,
+    Normal,
+    // For actions that something user-visible is waiting on, e.g. decoding the input of a document that's loading.
+    High,
+};
+
+// Runs the given work on the background threads, for callers that wait for it themselves rather than having the result
+// delivered to an event loop.
+void run_in_background(ESCAPING Function<void()>, BackgroundActionPriority = BackgroundActionPriority::Normal);
+
 class BackgroundActionBase {
     template<typename Result>
     friend class BackgroundAction;
+    friend void run_in_background(Function<void()>, BackgroundActionPriority);
 
 private:
     BackgroundActionBase() = default;
 
-    static void enqueue_work(ESCAPING Function<void()>);
-    static Thread& background_thread();
+    static void enqueue_work(ESCAPING Function<void()>, BackgroundActionPriority);
 };
 
 template<typename Result>
@@ -55,7 +69,7 @@ public:
     bool is_canceled() const { return m_canceled; }
 
 private:
-    BackgroundAction(ESCAPING Function<ErrorOr<Result>(BackgroundAction&)> action, ESCAPING Function<ErrorOr<void>(Result)> on_complete, ESCAPING Optional<Function<void(Error)>> on_error = {})
+    BackgroundAction(ESCAPING Function<ErrorOr<Result>(BackgroundAction&)> action, ESCAPING Function<ErrorOr<void>(Result)> on_complete, ESCAPING Optional<Function<void(Error)>> on_error = {}, BackgroundActionPriority priority = BackgroundActionPriority::Normal)
         : m_action(move(action))
         , m_on_complete(move(on_complete))
     {
@@ -76,8 +90,11 @@ private:
         if (on_error.has_value())
             m_on_error = on_error.release_value();
 
-        enqueue_work([self = NonnullRefPtr(*this), promise = move(promise), origin_event_loop = &Core::EventLoop::current()]() mutable {
-            auto result = self->m_action(*self);
+        auto work = [self = NonnullRefPtr(*this), promise = move(promise), origin_event_loop = &Core::EventLoop::current()]() mutable {
+            // Don't bother starting an action that was canceled while it was waiting in the queue.
+            ErrorOr<Result> result = Error::from_errno(ECANCELED);
+            if (!self->m_canceled)
+                result = self->m_action(*self);
 
             // The event loop cancels the promise when it exits.
             self->m_canceled |= promise->is_rejected();
@@ -111,7 +128,8 @@ private:
                     self->m_on_error(move(error));
                 }
             }
-        });
+        };
+        enqueue_work(move(work), priority);
     }
 
     Function<ErrorOr<Result>(BackgroundAction&)> m_action;
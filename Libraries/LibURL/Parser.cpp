@@ -5,9 +5,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/ByteString.h>
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
+#include <AK/HashFunctions.h>
 #include <AK/IntegralMath.h>
 #include <AK/Optional.h>
 #include <AK/SourceLocation.h>
@@ -718,8 +720,174 @@ static String remove_ascii_tab_or_newline(StringView input)
     return MUST(output.to_string());
 }
 
+// Code points that the path, special-query and fragment percent-encode sets leave alone. The path set excludes "\\" as
+// well, since it acts like "/" in special URLs.
+static bool is_canonical_path_code_point(char code_point)
+{
+    return is_ascii_printable(code_point) && !" \"#<>?^`{}\\"sv.contains(code_point);
+}
+
+static bool is_canonical_query_code_point(char code_point)
+{
+    return is_ascii_printable(code_point) && !" \"#<>'"sv.contains(code_point);
+}
+
+static bool is_canonical_fragment_code_point(char code_point)
+{
+    return is_ascii_printable(code_point) && !" \"<>`"sv.contains(code_point);
+}
+
+// A domain that the host parser would return as is.
+static bool is_canonical_domain(StringView domain)
+{
+    if (domain.is_empty())
+        return false;
+
+    for (auto code_point : domain) {
+        if (!is_ascii_lower_alpha(code_point) && !is_ascii_digit(code_point) && code_point != '-' && code_point != '.')
+            return false;
+    }
+
+    // NOTE: Punycode labels have to be validated by domain to ASCII, and domains that end in a number are IPv4 addresses.
+    for (auto label : domain.split_view('.')) {
+        if (label.starts_with("xn--"sv))
+            return false;
+    }
+    return !ends_in_a_number_checker(domain);
+}
+
+// OPTIMIZATION: Most of the URLs we parse are absolute URLs that are already in their canonical form, for example because
+//               they are the serialization of a URL that was parsed before. Running the basic URL parser on such a URL
+//               produces exactly the components that the input consists of, so we can just slice them out of it.
+//               This only recognizes a conservative subset of canonical URLs: a special scheme other than "file", a
+//               lowercase ASCII domain, no credentials or port, no dot segments, and no code points that would have to
+//               be percent-encoded. Everything else goes through the basic URL parser.
+Optional<URL> Parser::parse_canonical_absolute_url(StringView input)
+{
+    auto scheme_length = input.find("://"sv);
+    if (!scheme_length.has_value())
+        return {};
+
+    auto scheme = input.substring_view(0, *scheme_length);
+    if (!scheme.is_one_of("ftp"sv, "http"sv, "https"sv, "ws"sv, "wss"sv))
+        return {};
+
+    auto is_delimiter = [](char code_point) { return code_point == '/' || code_point == '?' || code_point == '#'; };
+
+    size_t index = *scheme_length + 3;
+    auto host_start = index;
+    while (index < input.length() && !is_delimiter(input[index]))
+        ++index;
+
+    auto host = input.substring_view(host_start, index - host_start);
+    if (!is_canonical_domain(host))
+        return {};
+
+    Vector<String> paths;
+    if (index < input.length() && input[index] == '/') {
+        while (index < input.length() && input[index] == '/') {
+            auto segment_start = ++index;
+            while (index < input.length() && !is_delimiter(input[index])) {
+                if (!is_canonical_path_code_point(input[index]))
+                    return {};
+                ++index;
+            }
+
+            auto segment = input.substring_view(segment_start, index - segment_start);
+            if (is_single_dot_path_segment(segment) || is_double_dot_path_segment(segment))
+                return {};
+            paths.append(String::from_utf8_without_validation(segment.bytes()));
+        }
+    } else {
+        // NOTE: A special URL without a path gets a single empty path segment.
+        paths.append(String {});
+    }
+
+    Optional<String> query;
+    if (index < input.length() && input[index] == '?') {
+        auto query_start = ++index;
+        while (index < input.length() && input[index] != '#') {
+            if (!is_canonical_query_code_point(input[index]))
+                return {};
+            ++index;
+        }
+        query = String::from_utf8_without_validation(input.substring_view(query_start, index - query_start).bytes());
+    }
+
+    Optional<String> fragment;
+    if (index < input.length() && input[index] == '#') {
+        auto fragment_start = ++index;
+        for (; index < input.length(); ++index) {
+            if (!is_canonical_fragment_code_point(input[index]))
+                return {};
+        }
+        fragment = String::from_utf8_without_validation(input.substring_view(fragment_start).bytes());
+    }
+
+    URL url;
+    url.m_data->scheme = String::from_utf8_without_validation(scheme.bytes());
+    url.m_data->host = Host { String::from_utf8_without_validation(host.bytes()) };
+    url.m_data->paths = move(paths);
+    url.m_data->query = move(query);
+    url.m_data->fragment = move(fragment);
+    return url;
+}
+
+namespace {
+
+struct ParsedURLCacheEntry {
+    bool is_used { false };
+    String input;
+    // NOTE: Holding on to the base URL keeps its data alive, so no other URL can end up with the same data pointer.
+    //       It also makes the data copy-on-write for everybody else, so it can't change while it's in here.
+    Optional<URL> base_url;
+    Optional<URL> url;
+};
+
+}
+
+static constexpr size_t parsed_url_cache_size = 256;
+static thread_local Array<ParsedURLCacheEntry, parsed_url_cache_size> s_parsed_url_cache;
+
+void Parser::clear_parsed_url_cache()
+{
+    s_parsed_url_cache.fill({});
+}
+
 // https://url.spec.whatwg.org/#concept-basic-url-parser
 Optional<URL> Parser::basic_parse(StringView raw_input, Optional<URL const&> base_url, URL* url, Optional<State> state_override, Optional<StringView> encoding)
+{
+    // NOTE: If url or state override are given, the parser modifies an existing URL rather than producing a new one.
+    if (url || state_override.has_value())
+        return run_basic_parser(raw_input, base_url, url, state_override, encoding);
+
+    if (auto canonical_url = parse_canonical_absolute_url(raw_input); canonical_url.has_value())
+        return canonical_url;
+
+    // OPTIMIZATION: Documents resolve the same relative URLs against the same base URL over and over again, for example
+    //               during layout and fetching. URLs share their data until they are modified, so we can keep the most
+    //               recent results around and hand out copies of them cheaply. The base URL is identified by its data,
+    //               which avoids having to compare or serialize it.
+    if (encoding.has_value())
+        return run_basic_parser(raw_input, base_url, url, state_override, encoding);
+
+    auto const* base_url_data = base_url.has_value() ? base_url->m_data.ptr() : nullptr;
+    auto& cache_entry = s_parsed_url_cache[pair_int_hash(raw_input.hash(), ptr_hash(base_url_data)) % parsed_url_cache_size];
+
+    auto const* cached_base_url_data = cache_entry.base_url.has_value() ? cache_entry.base_url->m_data.ptr() : nullptr;
+    if (cache_entry.is_used && cached_base_url_data == base_url_data && cache_entry.input == raw_input)
+        return cache_entry.url;
+
+    auto result = run_basic_parser(raw_input, base_url, url, state_override, encoding);
+
+    cache_entry.is_used = true;
+    cache_entry.input = String::from_utf8_with_replacement_character(raw_input, String::WithBOMHandling::No);
+    cache_entry.base_url = base_url.copy();
+    cache_entry.url = result;
+    return result;
+}
+
+Optional<URL> Parser::run_basic_parser(StringView raw_input, Optional<URL const&> base_url, URL* url, Optional<State> state_override, Optional<StringView> encoding)
 {
     dbgln_if(URL_PARSER_DEBUG, "URL::Parser::basic_parse: Parsing '{}'", raw_input);
 
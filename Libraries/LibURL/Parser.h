@@ -67,6 +67,13 @@ public:
     static void shorten_urls_path(URL&);
 
     static Optional<Host> parse_host(StringView input, bool is_opaque = false);
+
+    // Forgets the results that basic_parse() cached on the calling thread.
+    static void clear_parsed_url_cache();
+
+private:
+    static Optional<URL> parse_canonical_absolute_url(StringView input);
+    static Optional<URL> run_basic_parser(StringView input, Optional<URL const&> base_url, URL* url, Optional<State> state_override, Optional<StringView> encoding);
 };
 
 #undef ENUMERATE_STATES
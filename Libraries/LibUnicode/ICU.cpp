@@ -9,6 +9,7 @@
 #include <AK/Utf16View.h>
 #include <LibUnicode/ICU.h>
 
+#include <unicode/brkiter.h>
 #include <unicode/dtptngen.h>
 #include <unicode/locdspnm.h>
 #include <unicode/numsys.h>
@@ -114,6 +115,42 @@ icu::TimeZoneNames& LocaleData::time_zone_names()
     return *m_time_zone_names;
 }
 
+icu::BreakIterator const& LocaleData::grapheme_break_iterator()
+{
+    if (!m_grapheme_break_iterator) {
+        UErrorCode status = U_ZERO_ERROR;
+
+        m_grapheme_break_iterator = adopt_own_if_nonnull(icu::BreakIterator::createCharacterInstance(locale(), status));
+        VERIFY(icu_success(status));
+    }
+
+    return *m_grapheme_break_iterator;
+}
+
+icu::BreakIterator const& LocaleData::sentence_break_iterator()
+{
+    if (!m_sentence_break_iterator) {
+        UErrorCode status = U_ZERO_ERROR;
+
+        m_sentence_break_iterator = adopt_own_if_nonnull(icu::BreakIterator::createSentenceInstance(locale(), status));
+        VERIFY(icu_success(status));
+    }
+
+    return *m_sentence_break_iterator;
+}
+
+icu::BreakIterator const& LocaleData::word_break_iterator()
+{
+    if (!m_word_break_iterator) {
+        UErrorCode status = U_ZERO_ERROR;
+
+        m_word_break_iterator = adopt_own_if_nonnull(icu::BreakIterator::createWordInstance(locale(), status));
+        VERIFY(icu_success(status));
+    }
+
+    return *m_word_break_iterator;
+}
+
 Optional<TimeZoneData&> TimeZoneData::for_time_zone(StringView time_zone)
 {
     auto time_zone_data = s_time_zone_cache.get(time_zone);
@@ -22,6 +22,7 @@
 #include <unicode/uversion.h>
 
 U_NAMESPACE_BEGIN
+class BreakIterator;
 class DateTimePatternGenerator;
 class LocaleDisplayNames;
 class NumberingSystem;
@@ -48,6 +49,11 @@ public:
 
     icu::TimeZoneNames& time_zone_names();
 
+    // These are only meant to be cloned, as using them directly would change the text and position they're set to.
+    icu::BreakIterator const& grapheme_break_iterator();
+    icu::BreakIterator const& sentence_break_iterator();
+    icu::BreakIterator const& word_break_iterator();
+
     Optional<DigitalFormat> const& digital_format() { return m_digital_format; }
     void set_digital_format(DigitalFormat digital_format) { m_digital_format = move(digital_format); }
 
@@ -62,6 +68,9 @@ private:
     OwnPtr<icu::NumberingSystem> m_numbering_system;
     OwnPtr<icu::DateTimePatternGenerator> m_date_time_pattern_generator;
     OwnPtr<icu::TimeZoneNames> m_time_zone_names;
+    OwnPtr<icu::BreakIterator> m_grapheme_break_iterator;
+    OwnPtr<icu::BreakIterator> m_sentence_break_iterator;
+    OwnPtr<icu::BreakIterator> m_word_break_iterator;
     Optional<DigitalFormat> m_digital_format;
 };
 
@@ -43,6 +43,10 @@ StringView normalization_form_to_string(NormalizationForm form)
 
 String normalize(StringView string, NormalizationForm form)
 {
+    // OPTIMIZATION: ASCII text is already in every normalization form.
+    if (string.is_ascii())
+        return String::from_utf8_without_validation(string.bytes());
+
     UErrorCode status = U_ZERO_ERROR;
     icu::Normalizer2 const* normalizer = nullptr;
 
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BinarySearch.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf32View.h>
 #include <LibUnicode/CharacterTypes.h>
@@ -58,6 +59,14 @@ public:
 
     virtual void set_segmented_text(String text) override
     {
+        if (m_segmenter_granularity == SegmenterGranularity::Grapheme && text.is_ascii()) {
+            auto view = text.bytes_as_string_view();
+            set_ascii_graphemes(view.length(), [&](size_t index) { return view[index]; });
+            m_segmented_text = move(text);
+            return;
+        }
+        m_ascii_graphemes.clear();
+
         UErrorCode status = U_ZERO_ERROR;
 
         m_segmented_text = move(text);
@@ -75,17 +84,41 @@ public:
 
     virtual void set_segmented_text(Utf16View const& text) override
     {
+        if (m_segmenter_granularity == SegmenterGranularity::Grapheme && text.is_ascii()) {
+            set_ascii_graphemes(text.length_in_code_units(), [&](size_t index) { return text.code_unit_at(index); });
+            m_segmented_text = Empty {};
+            return;
+        }
+        m_ascii_graphemes.clear();
+
         m_segmented_text = icu::UnicodeString { text.span().data(), static_cast<i32>(text.length_in_code_units()) };
         m_segmenter->setText(m_segmented_text.get<icu::UnicodeString>());
     }
 
     virtual size_t current_boundary() override
     {
+        if (m_ascii_graphemes.has_value())
+            return m_ascii_graphemes->current_boundary;
         return m_segmenter->current();
     }
 
     virtual Optional<size_t> previous_boundary(size_t boundary, Inclusive inclusive) override
     {
+        if (m_ascii_graphemes.has_value()) {
+            auto& graphemes = *m_ascii_graphemes;
+            boundary = min(boundary, graphemes.length);
+
+            if (inclusive == Inclusive::No || !graphemes.is_boundary(boundary)) {
+                if (boundary == 0)
+                    return {};
+                if (!graphemes.is_boundary(--boundary))
+                    --boundary;
+            }
+
+            graphemes.current_boundary = boundary;
+            return boundary;
+        }
+
         auto icu_boundary = align_boundary(boundary);
 
         if (inclusive == Inclusive::Yes) {
@@ -101,6 +134,21 @@ public:
 
     virtual Optional<size_t> next_boundary(size_t boundary, Inclusive inclusive) override
     {
+        if (m_ascii_graphemes.has_value()) {
+            auto& graphemes = *m_ascii_graphemes;
+            boundary = min(boundary, graphemes.length);
+
+            if (inclusive == Inclusive::No || !graphemes.is_boundary(boundary)) {
+                if (boundary == graphemes.length)
+                    return {};
+                if (!graphemes.is_boundary(++boundary))
+                    ++boundary;
+            }
+
+            graphemes.current_boundary = boundary;
+            return boundary;
+        }
+
         auto icu_boundary = align_boundary(boundary);
 
         if (inclusive == Inclusive::Yes) {
@@ -158,6 +206,9 @@ public:
 
     virtual bool is_current_boundary_word_like() const override
     {
+        if (m_ascii_graphemes.has_value())
+            return false;
+
         auto status = m_segmenter->getRuleStatus();
 
         if (status >= UBRK_WORD_NUMBER && status < UBRK_WORD_NUMBER_LIMIT)
@@ -173,6 +224,35 @@ public:
     }
 
 private:
+    // OPTIMIZATION: Every ASCII code point is a grapheme of its own, except that CRLF is a single grapheme. So we find
+    //               the grapheme boundaries of ASCII text ourselves, without ever handing the text to ICU.
+    struct AsciiGraphemes {
+        bool is_boundary(size_t index) const
+        {
+            return index <= length && !binary_search(line_feeds_following_carriage_returns, index);
+        }
+
+        size_t length { 0 };
+        size_t current_boundary { 0 };
+
+        // The offsets of the LF in each CRLF, which are the only offsets that aren't grapheme boundaries.
+        Vector<size_t> line_feeds_following_carriage_returns;
+    };
+
+    template<typename CodeUnitAt>
+    void set_ascii_graphemes(size_t length, CodeUnitAt const& code_unit_at)
+    {
+        AsciiGraphemes graphemes;
+        graphemes.length = length;
+
+        for (size_t i = 1; i < length; ++i) {
+            if (code_unit_at(i) == '\n' && code_unit_at(i - 1) == '\r')
+                graphemes.line_feeds_following_carriage_returns.append(i);
+        }
+
+        m_ascii_graphemes = move(graphemes);
+    }
+
     i32 align_boundary(size_t boundary)
     {
         auto icu_boundary = static_cast<i32>(boundary);
@@ -196,6 +276,23 @@ private:
 
     void for_each_boundary(SegmentationCallback callback)
     {
+        if (m_ascii_graphemes.has_value()) {
+            auto& graphemes = *m_ascii_graphemes;
+            auto const& line_feeds = graphemes.line_feeds_following_carriage_returns;
+
+            for (size_t index = 0, line_feed_index = 0; index <= graphemes.length; ++index) {
+                if (line_feed_index < line_feeds.size() && line_feeds[line_feed_index] == index) {
+                    ++line_feed_index;
+                    continue;
+                }
+
+                graphemes.current_boundary = index;
+                if (callback(index) == IterationDecision::Break)
+                    return;
+            }
+            return;
+        }
+
         if (callback(static_cast<size_t>(m_segmenter->first())) == IterationDecision::Break)
             return;
 
@@ -211,6 +308,7 @@ private:
 
     NonnullOwnPtr<icu::BreakIterator> m_segmenter;
     Variant<Empty, String, icu::UnicodeString> m_segmented_text;
+    Optional<AsciiGraphemes> m_ascii_graphemes;
 };
 
 NonnullOwnPtr<Segmenter> Segmenter::create(SegmenterGranularity segmenter_granularity)
@@ -220,26 +318,24 @@ NonnullOwnPtr<Segmenter> Segmenter::create(SegmenterGranularity segmenter_granul
 
 NonnullOwnPtr<Segmenter> Segmenter::create(StringView locale, SegmenterGranularity segmenter_granularity)
 {
-    UErrorCode status = U_ZERO_ERROR;
-
     auto locale_data = LocaleData::for_locale(locale);
     VERIFY(locale_data.has_value());
 
-    auto segmenter = adopt_own_if_nonnull([&]() {
+    // OPTIMIZATION: Creating a break iterator loads and compiles its rules, which takes far longer than cloning one
+    //               that already exists. So we only create one of each kind per locale, and clone it from then on.
+    auto const& break_iterator = [&]() -> icu::BreakIterator const& {
         switch (segmenter_granularity) {
         case SegmenterGranularity::Grapheme:
-            return icu::BreakIterator::createCharacterInstance(locale_data->locale(), status);
+            return locale_data->grapheme_break_iterator();
         case SegmenterGranularity::Sentence:
-            return icu::BreakIterator::createSentenceInstance(locale_data->locale(), status);
+            return locale_data->sentence_break_iterator();
         case SegmenterGranularity::Word:
-            return icu::BreakIterator::createWordInstance(locale_data->locale(), status);
+            return locale_data->word_break_iterator();
         }
         VERIFY_NOT_REACHED();
-    }());
-
-    VERIFY(icu_success(status));
+    }();
 
-    return make<SegmenterImpl>(segmenter.release_nonnull(), segmenter_granularity);
+    return make<SegmenterImpl>(adopt_own(*break_iterator.clone()), segmenter_granularity);
 }
 
 bool Segmenter::should_continue_beyond_word(Utf8View const& word)
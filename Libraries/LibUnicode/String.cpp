@@ -35,8 +35,25 @@ static ResolvedLocale resolve_locale(Optional<StringView> const& locale)
     return resolved_locale;
 }
 
+// OPTIMIZATION: Case mapping ASCII text only ever produces ASCII text, and Turkish and Azeri are the only languages in
+//               which that mapping differs from ASCII case mapping (by way of the dotted and dotless i). So we can skip
+//               ICU altogether for ASCII text in every other locale.
+static bool can_map_case_of_ascii_text_without_icu(String const& string, Optional<StringView> const& locale)
+{
+    if (!string.is_ascii())
+        return false;
+    if (!locale.has_value())
+        return true;
+
+    auto language = locale->substring_view(0, locale->find_any_of("-_"sv).value_or(locale->length()));
+    return !language.equals_ignoring_ascii_case("tr"sv) && !language.equals_ignoring_ascii_case("az"sv);
+}
+
 ErrorOr<String> String::to_lowercase(Optional<StringView> const& locale) const
 {
+    if (can_map_case_of_ascii_text_without_icu(*this, locale))
+        return to_ascii_lowercase();
+
     UErrorCode status = U_ZERO_ERROR;
 
     StringBuilder builder { bytes_as_string_view().length() };
@@ -53,6 +70,9 @@ ErrorOr<String> String::to_lowercase(Optional<StringView> const& locale) const
 
 ErrorOr<String> String::to_uppercase(Optional<StringView> const& locale) const
 {
+    if (can_map_case_of_ascii_text_without_icu(*this, locale))
+        return to_ascii_uppercase();
+
     UErrorCode status = U_ZERO_ERROR;
 
     StringBuilder builder { bytes_as_string_view().length() };
@@ -89,11 +109,17 @@ ErrorOr<String> String::to_titlecase(Optional<StringView> const& locale, Trailin
 
 ErrorOr<String> String::to_fullwidth() const
 {
-    UErrorCode status = U_ZERO_ERROR;
+    // OPTIMIZATION: Creating a transliterator means looking up and compiling its rules, so we only do that once.
+    static OwnPtr<icu::Transliterator> transliterator;
 
-    auto const transliterator = adopt_own_if_nonnull(icu::Transliterator::createInstance("Halfwidth-Fullwidth", UTRANS_FORWARD, status));
-    if (Unicode::icu_failure(status)) {
-        return Error::from_string_literal("Unable to create transliterator");
+    if (!transliterator) {
+        UErrorCode status = U_ZERO_ERROR;
+
+        transliterator = adopt_own_if_nonnull(icu::Transliterator::createInstance("Halfwidth-Fullwidth", UTRANS_FORWARD, status));
+        if (Unicode::icu_failure(status)) {
+            transliterator.clear();
+            return Error::from_string_literal("Unable to create transliterator");
+        }
     }
 
     auto icu_string = Unicode::icu_string(bytes_as_string_view());
@@ -104,6 +130,13 @@ ErrorOr<String> String::to_fullwidth() const
 
 static ErrorOr<void> build_casefold_string(StringView string, StringBuilder& builder)
 {
+    // OPTIMIZATION: Case folding ASCII text is the same as mapping it to ASCII lowercase.
+    if (string.is_ascii()) {
+        for (auto byte : string.bytes())
+            builder.append(AK::to_ascii_lowercase(byte));
+        return {};
+    }
+
     UErrorCode status = U_ZERO_ERROR;
 
     icu::StringByteSink sink { &builder };
@@ -125,6 +158,9 @@ ErrorOr<String> String::to_casefold() const
 
 bool String::equals_ignoring_case(String const& other) const
 {
+    if (is_ascii() && other.is_ascii())
+        return equals_ignoring_ascii_case(other);
+
     StringBuilder lhs_builder { bytes_as_string_view().length() };
     if (build_casefold_string(*this, lhs_builder).is_error())
         return false;
@@ -147,6 +147,7 @@ ErrorOr<void, ValidationError> AbstractMachine::validate(Module& module)
         return result.release_error();
     }
 
+    BytecodeInterpreter::compile(module);
     return {};
 }
 InstantiationResult AbstractMachine::instantiate(Module const& module, Vector<ExternValue> externs)
@@ -170,7 +171,7 @@ InstantiationResult AbstractMachine::instantiate(Module const& module, Vector<Ex
                 if (!extern_.has<MemoryAddress>())
                     return "Expected memory import"sv;
                 auto other_mem_type = m_store.get(extern_.get<MemoryAddress>())->type();
-                if (other_mem_type.limits().is_subset_of(mem_type.limits()))
+                if (other_mem_type.shared() == mem_type.shared() && other_mem_type.limits().is_subset_of(mem_type.limits()))
                     return {};
                 return ByteString::formatted("Memory import and extern do not match: {}-{} vs {}-{}", mem_type.limits().min(), mem_type.limits().max(), other_mem_type.limits().min(), other_mem_type.limits().max());
             },
@@ -489,19 +490,41 @@ Optional<InstantiationError> AbstractMachine::allocate_all_final_phase(Module co
     return {};
 }
 
-Result AbstractMachine::invoke(FunctionAddress address, Vector<Value> arguments)
+AbstractMachine::~AbstractMachine() = default;
+
+Result AbstractMachine::invoke(FunctionAddress address, ReadonlySpan<Value> arguments)
 {
     BytecodeInterpreter interpreter(m_stack_info);
     auto handle = register_scoped(interpreter);
-    return invoke(interpreter, address, move(arguments));
+    return invoke(interpreter, address, arguments);
+}
+
+Result AbstractMachine::invoke(Interpreter& interpreter, FunctionAddress address, ReadonlySpan<Value> arguments)
+{
+    auto configuration = take_configuration();
+    auto result = configuration->call(interpreter, address, arguments);
+    return_configuration(move(configuration));
+    return result;
 }
 
-Result AbstractMachine::invoke(Interpreter& interpreter, FunctionAddress address, Vector<Value> arguments)
+NonnullOwnPtr<Configuration> AbstractMachine::take_configuration()
 {
-    Configuration configuration { m_store };
+    auto configuration = m_idle_configurations.is_empty()
+        ? make<Configuration>(m_store)
+        : m_idle_configurations.take_last();
     if (m_should_limit_instruction_count)
-        configuration.enable_instruction_count_limit();
-    return configuration.call(interpreter, address, move(arguments));
+        configuration->enable_instruction_count_limit();
+    if (m_can_block)
+        configuration->enable_blocking();
+    return configuration;
+}
+
+void AbstractMachine::return_configuration(NonnullOwnPtr<Configuration> configuration)
+{
+    if (m_idle_configurations.size() >= max_idle_configurations)
+        return;
+    configuration->reset();
+    m_idle_configurations.append(move(configuration));
 }
 
 void Linker::link(ModuleInstance const& instance)
@@ -418,6 +418,7 @@ public:
     static ErrorOr<MemoryInstance> create(MemoryType const& type)
     {
         MemoryInstance instance { type };
+        instance.reserve_maximum_size();
 
         if (!instance.grow(type.limits().min() * Constants::page_size, GrowType::No))
             return Error::from_string_literal("Failed to grow to requested size");
@@ -453,6 +454,17 @@ public:
                 return false;
         }
         auto previous_size = m_size;
+        if (new_size > m_data.capacity()) {
+            // A shared memory that couldn't reserve its maximum size up front can't grow, moving it would break aliasing.
+            if (m_type.is_shared())
+                return false;
+            // Grow the capacity geometrically so that growing in small steps doesn't copy the whole memory every time.
+            auto new_capacity = max(new_size, min<u64>(m_data.capacity() * 2, Constants::max_reserved_memory_size));
+            if (auto max = m_type.limits().max(); max.has_value())
+                new_capacity = min(new_capacity, max.value() * Constants::page_size);
+            if (m_data.try_ensure_capacity(new_capacity).is_error() && m_data.try_ensure_capacity(new_size).is_error())
+                return false;
+        }
         if (m_data.try_resize(new_size).is_error())
             return false;
         m_size = new_size;
@@ -469,7 +481,7 @@ public:
             //
             // See relevant spec link:
             // https://www.w3.org/TR/wasm-core-2/#growing-memories%E2%91%A0
-            m_type = MemoryType { Limits(m_type.limits().min() + size_to_grow / Constants::page_size, m_type.limits().max()) };
+            m_type = MemoryType { Limits(m_type.limits().min() + size_to_grow / Constants::page_size, m_type.limits().max()), m_type.shared() };
         }
 
         return true;
@@ -483,6 +495,31 @@ private:
     {
     }
 
+    void reserve_maximum_size()
+    {
+        // Shared memories are aliased by SharedArrayBuffers and accessed atomically, so their data must never move;
+        // validation guarantees that they have a maximum size to reserve.
+        if (m_type.is_shared()) {
+            auto max = m_type.limits().max();
+            VERIFY(max.has_value());
+            (void)m_data.try_ensure_capacity(max.value() * Constants::page_size);
+            return;
+        }
+
+        // If the module tells us how large this memory may get, reserve all of it up front, so the data never has to
+        // move (or be copied) on memory.grow. Allocations this large are backed by anonymous mappings that the kernel
+        // only commits once a page is touched, so this costs address space rather than memory.
+        // NOTE: Under ASAN that isn't true, as the allocator pre-poisons the shadow of the entire allocation.
+#if defined(AK_ARCH_64_BIT) && !defined(AK_OS_WINDOWS) && !defined(HAS_ADDRESS_SANITIZER)
+        auto max = m_type.limits().max();
+        if (!max.has_value())
+            return;
+        auto maximum_size = min(max.value() * Constants::page_size, Constants::max_reserved_memory_size);
+        // This is just an optimization, if we can't reserve the space we'll allocate on demand instead.
+        (void)m_data.try_ensure_capacity(maximum_size);
+#endif
+    }
+
     MemoryType m_type;
     size_t m_size { 0 };
     ByteBuffer m_data;
@@ -627,18 +664,22 @@ struct HostVisitOps {
 class AbstractMachine {
 public:
     explicit AbstractMachine() = default;
+    ~AbstractMachine();
 
     // Validate a module; permanently sets the module's validity status.
     ErrorOr<void, ValidationError> validate(Module&);
     // Load and instantiate a module, and link it into this interpreter.
     InstantiationResult instantiate(Module const&, Vector<ExternValue>);
-    Result invoke(FunctionAddress, Vector<Value>);
-    Result invoke(Interpreter&, FunctionAddress, Vector<Value>);
+    Result invoke(FunctionAddress, ReadonlySpan<Value>);
+    Result invoke(Interpreter&, FunctionAddress, ReadonlySpan<Value>);
 
     auto& store() const { return m_store; }
     auto& store() { return m_store; }
 
     void enable_instruction_count_limit() { m_should_limit_instruction_count = true; }
+    // Lets memory.atomic.wait suspend the calling thread. Embedders whose agent must not block (like a window's event
+    // loop) leave this off, and waiting traps instead.
+    void enable_blocking() { m_can_block = true; }
 
     void visit_external_resources(HostVisitOps const&);
 
@@ -667,12 +708,20 @@ private:
         return InterpreterHandle(*this, interpreter);
     }
 
+    NonnullOwnPtr<Configuration> take_configuration();
+    void return_configuration(NonnullOwnPtr<Configuration>);
+
     Optional<InstantiationError> allocate_all_initial_phase(Module const&, ModuleInstance&, Vector<ExternValue>&, Vector<Value>& global_values, Vector<FunctionAddress>& own_functions);
     Optional<InstantiationError> allocate_all_final_phase(Module const&, ModuleInstance&, Vector<Vector<Reference>>& elements);
     Store m_store;
     StackInfo m_stack_info;
     HashTable<Interpreter*> m_active_interpreters;
+    // Configurations left over from earlier invocations; reusing them keeps the value, label and frame stacks
+    // allocated across calls. Nested invocations (wasm -> host -> wasm) each take their own.
+    static constexpr size_t max_idle_configurations = 8;
+    Vector<NonnullOwnPtr<Configuration>> m_idle_configurations;
     bool m_should_limit_instruction_count { false };
+    bool m_can_block { false };
 };
 
 class Linker {
@@ -8,13 +8,17 @@
 #include <AK/ByteReader.h>
 #include <AK/Debug.h>
 #include <AK/Endian.h>
+#include <AK/HashMap.h>
 #include <AK/MemoryStream.h>
 #include <AK/NumericLimits.h>
 #include <AK/SIMDExtras.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/AbstractMachine/Operators.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
 #include <LibWasm/Opcode.h>
 #include <LibWasm/Printer/Printer.h>
 
@@ -31,9 +35,17 @@ namespace Wasm {
     } while (false)
 
 void BytecodeInterpreter::interpret(Configuration& configuration)
+{
+    if (has_instruction_hooks()) [[unlikely]]
+        return interpret_impl<true>(configuration);
+    interpret_impl<false>(configuration);
+}
+
+template<bool HasInstructionHooks>
+void BytecodeInterpreter::interpret_impl(Configuration& configuration)
 {
     m_trap = Empty {};
-    auto& instructions = configuration.frame().expression().instructions();
+    auto& instructions = configuration.frame().expression().compiled_instructions();
     auto max_ip_value = InstructionPointer { instructions.size() };
     auto& current_ip_value = configuration.ip();
     auto const should_limit_instruction_count = configuration.should_limit_instruction_count();
@@ -48,7 +60,10 @@ void BytecodeInterpreter::interpret(Configuration& configuration)
         }
         auto& instruction = instructions[current_ip_value.value()];
         auto old_ip = current_ip_value;
-        interpret_instruction(configuration, current_ip_value, instruction);
+        if constexpr (HasInstructionHooks)
+            interpret_instruction_with_hooks(configuration, current_ip_value, instruction);
+        else
+            interpret_instruction(configuration, current_ip_value, instruction);
         if (did_trap())
             return;
         if (current_ip_value == old_ip) // If no jump occurred
@@ -56,6 +71,106 @@ void BytecodeInterpreter::interpret(Configuration& configuration)
     }
 }
 
+// Superinstructions replace the first instruction of the sequence they were fused from, and leave the rest of the
+// sequence in place. That keeps every instruction pointer (and so every label continuation) valid.
+// A superinstruction carries the arguments of the first instruction it replaces, and reads the second operand (if any)
+// from the instruction right after it.
+static void compile_expression(Expression& expression)
+{
+    auto const& instructions = expression.instructions();
+    Vector<Instruction> compiled;
+    compiled.ensure_capacity(instructions.size());
+    compiled.extend(instructions);
+
+    auto opcode_at = [&](size_t index) -> OpCode {
+        if (index >= instructions.size())
+            return OpCode { 0xffffffffffffffffull };
+        return instructions[index].opcode();
+    };
+
+    bool did_fuse_anything = false;
+    for (size_t i = 0; i < instructions.size();) {
+        auto fuse = [&](OpCode opcode, size_t length) {
+            compiled[i] = Instruction(opcode, instructions[i].arguments());
+            did_fuse_anything = true;
+            i += length;
+        };
+
+        auto first = opcode_at(i);
+        auto second = opcode_at(i + 1);
+        auto third = opcode_at(i + 2);
+
+        if (first == Instructions::local_get && second == Instructions::local_get) {
+            if (third == Instructions::i32_add) {
+                fuse(Instructions::synthetic_i32_add2local, 3);
+                continue;
+            }
+            if (third == Instructions::i32_sub) {
+                fuse(Instructions::synthetic_i32_sub2local, 3);
+                continue;
+            }
+        }
+        if (first == Instructions::local_get && second == Instructions::i32_const) {
+            if (third == Instructions::i32_add) {
+                fuse(Instructions::synthetic_i32_addconstlocal, 3);
+                continue;
+            }
+            if (third == Instructions::i32_and) {
+                fuse(Instructions::synthetic_i32_andconstlocal, 3);
+                continue;
+            }
+        }
+        if (first == Instructions::i32_const && second == Instructions::local_set) {
+            fuse(Instructions::synthetic_local_seti32_const, 2);
+            continue;
+        }
+        if (first == Instructions::local_get && second == Instructions::local_set) {
+            fuse(Instructions::synthetic_local_copy, 2);
+            continue;
+        }
+        if (second == Instructions::br_if) {
+            if (first == Instructions::i32_eqz) {
+                fuse(Instructions::synthetic_br_if_i32_eqz, 2);
+                continue;
+            }
+            if (first == Instructions::i32_eq) {
+                fuse(Instructions::synthetic_br_if_i32_eq, 2);
+                continue;
+            }
+            if (first == Instructions::i32_ne) {
+                fuse(Instructions::synthetic_br_if_i32_ne, 2);
+                continue;
+            }
+            if (first == Instructions::i32_lts) {
+                fuse(Instructions::synthetic_br_if_i32_lts, 2);
+                continue;
+            }
+            if (first == Instructions::i32_ltu) {
+                fuse(Instructions::synthetic_br_if_i32_ltu, 2);
+                continue;
+            }
+            if (first == Instructions::i32_ges) {
+                fuse(Instructions::synthetic_br_if_i32_ges, 2);
+                continue;
+            }
+            if (first == Instructions::i32_geu) {
+                fuse(Instructions::synthetic_br_if_i32_geu, 2);
+                continue;
+            }
+        }
+        ++i;
+    }
+
+    if (did_fuse_anything)
+        expression.set_compiled_instructions(move(compiled));
+}
+
+void BytecodeInterpreter::compile(Module& module)
+{
+    for (auto& code : module.code_section().functions())
+        compile_expression(code.func().body());
+}
+
 void BytecodeInterpreter::branch_to_label(Configuration& configuration, LabelIndex index)
 {
     dbgln_if(WASM_TRACE_DEBUG, "Branch to label with index {}...", index.value());
@@ -68,6 +183,24 @@ void BytecodeInterpreter::branch_to_label(Configuration& configuration, LabelInd
     configuration.ip() = label.continuation();
 }
 
+// Used by the fused compare-and-branch superinstructions, whose br_if is the instruction after them.
+ALWAYS_INLINE void BytecodeInterpreter::branch_if(Configuration& configuration, InstructionPointer& ip, Instruction const& instruction, bool condition)
+{
+    if (!condition) {
+        ip = ip.value() + 2;
+        return;
+    }
+    branch_to_label(configuration, (&instruction)[1].arguments().get<LabelIndex>());
+}
+
+template<typename PopType, typename Operator>
+ALWAYS_INLINE void BytecodeInterpreter::compare_and_branch(Configuration& configuration, InstructionPointer& ip, Instruction const& instruction)
+{
+    auto rhs = configuration.value_stack().take_last().to<PopType>();
+    auto lhs = configuration.value_stack().take_last().to<PopType>();
+    branch_if(configuration, ip, instruction, Operator {}(lhs, rhs));
+}
+
 template<typename ReadType, typename PushType>
 void BytecodeInterpreter::load_and_push(Configuration& configuration, Instruction const& instruction)
 {
@@ -233,22 +366,18 @@ void BytecodeInterpreter::call_address(Configuration& configuration, FunctionAdd
     if (source == CallAddressSource::IndirectCall) {
         TRAP_IF_NOT(type->parameters().size() <= configuration.value_stack().size());
     }
-    Vector<Value> args;
-    args.ensure_capacity(type->parameters().size());
-    auto span = configuration.value_stack().span().slice_from_end(type->parameters().size());
-    for (auto& value : span)
-        args.unchecked_append(value);
-
-    configuration.value_stack().remove(configuration.value_stack().size() - span.size(), span.size());
 
-    Result result { Trap::from_string("") };
-    if (instance->has<WasmFunction>()) {
+    if (auto* wasm_function = instance->get_pointer<WasmFunction>()) {
         CallFrameHandle handle { *this, configuration };
-        result = configuration.call(*this, address, move(args));
-    } else {
-        result = configuration.call(*this, address, move(args));
+        configuration.call_from_value_stack(*this, *wasm_function);
+        return;
     }
 
+    // The host call gets its own copy of the arguments, so they can be passed straight off the value stack.
+    auto parameter_count = type->parameters().size();
+    auto result = configuration.call(*this, address, configuration.value_stack().span().slice_from_end(parameter_count));
+    configuration.value_stack().shrink(configuration.value_stack().size() - parameter_count);
+
     if (result.is_trap()) {
         m_trap = move(result.trap());
         return;
@@ -367,6 +496,208 @@ void BytecodeInterpreter::store_to_memory(Configuration& configuration, Instruct
     data.copy_to(memory->data().bytes().slice(instance_address, data.size()));
 }
 
+// Proposal "threads": agents suspended in memory.atomic.wait, keyed by the address they are waiting on.
+// Shared memories never move, so their addresses identify the same location for every agent.
+struct AtomicWaiter {
+    explicit AtomicWaiter(Threading::Mutex& mutex)
+        : condition(mutex)
+    {
+    }
+
+    Threading::ConditionVariable condition;
+    bool notified { false };
+};
+
+static Threading::Mutex s_atomic_waiters_mutex;
+static HashMap<u8 const*, Vector<AtomicWaiter*>> s_atomic_waiters;
+
+u8* BytecodeInterpreter::atomic_access_pointer(Configuration& configuration, Instruction::MemoryArgument const& arg, u32 base, size_t size, MemoryInstance** memory_instance)
+{
+    auto& address = configuration.frame().module().memories()[arg.memory_index.value()];
+    auto memory = configuration.store().get(address);
+    u64 instance_address = static_cast<u64>(base) + arg.offset;
+    if (instance_address + size > memory->size()) {
+        m_trap = Trap::from_string("Memory access out of bounds");
+        dbgln_if(WASM_TRACE_DEBUG, "LibWasm: Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + size, memory->size());
+        return nullptr;
+    }
+    // Unlike plain accesses, atomic accesses trap if they aren't naturally aligned.
+    if (instance_address % size != 0) {
+        m_trap = Trap::from_string("Unaligned atomic memory access");
+        return nullptr;
+    }
+    if (memory_instance)
+        *memory_instance = memory;
+    return memory->data().offset_pointer(instance_address);
+}
+
+template<typename AccessT, typename PushT>
+void BytecodeInterpreter::atomic_load_and_push(Configuration& configuration, Instruction const& instruction)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto& entry = configuration.value_stack().last();
+    auto* pointer = atomic_access_pointer(configuration, arg, entry.to<u32>(), sizeof(AccessT));
+    if (!pointer)
+        return;
+    auto value = __atomic_load_n(bit_cast<AccessT*>(pointer), __ATOMIC_SEQ_CST);
+    entry = Value(static_cast<PushT>(value));
+}
+
+template<typename PopT, typename AccessT>
+void BytecodeInterpreter::atomic_pop_and_store(Configuration& configuration, Instruction const& instruction)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto value = static_cast<AccessT>(configuration.value_stack().take_last().to<PopT>());
+    auto base = configuration.value_stack().take_last().to<u32>();
+    auto* pointer = atomic_access_pointer(configuration, arg, base, sizeof(AccessT));
+    if (!pointer)
+        return;
+    __atomic_store_n(bit_cast<AccessT*>(pointer), value, __ATOMIC_SEQ_CST);
+}
+
+template<typename PopT, typename AccessT, BytecodeInterpreter::AtomicOperation operation>
+void BytecodeInterpreter::atomic_read_modify_write(Configuration& configuration, Instruction const& instruction)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto operand = static_cast<AccessT>(configuration.value_stack().take_last().to<PopT>());
+    auto& entry = configuration.value_stack().last();
+    auto* pointer = atomic_access_pointer(configuration, arg, entry.to<u32>(), sizeof(AccessT));
+    if (!pointer)
+        return;
+
+    auto* location = bit_cast<AccessT*>(pointer);
+    AccessT old_value;
+    if constexpr (operation == AtomicOperation::Add)
+        old_value = __atomic_fetch_add(location, operand, __ATOMIC_SEQ_CST);
+    else if constexpr (operation == AtomicOperation::Sub)
+        old_value = __atomic_fetch_sub(location, operand, __ATOMIC_SEQ_CST);
+    else if constexpr (operation == AtomicOperation::And)
+        old_value = __atomic_fetch_and(location, operand, __ATOMIC_SEQ_CST);
+    else if constexpr (operation == AtomicOperation::Or)
+        old_value = __atomic_fetch_or(location, operand, __ATOMIC_SEQ_CST);
+    else if constexpr (operation == AtomicOperation::Xor)
+        old_value = __atomic_fetch_xor(location, operand, __ATOMIC_SEQ_CST);
+    else
+        old_value = __atomic_exchange_n(location, operand, __ATOMIC_SEQ_CST);
+
+    // Narrow accesses zero-extend the value they read.
+    entry = Value(static_cast<PopT>(old_value));
+}
+
+template<typename PopT, typename AccessT>
+void BytecodeInterpreter::atomic_compare_exchange(Configuration& configuration, Instruction const& instruction)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto replacement = static_cast<AccessT>(configuration.value_stack().take_last().to<PopT>());
+    auto expected = static_cast<AccessT>(configuration.value_stack().take_last().to<PopT>());
+    auto& entry = configuration.value_stack().last();
+    auto* pointer = atomic_access_pointer(configuration, arg, entry.to<u32>(), sizeof(AccessT));
+    if (!pointer)
+        return;
+
+    // On failure, expected is updated to the value that was read; on success it already is that value.
+    __atomic_compare_exchange_n(bit_cast<AccessT*>(pointer), &expected, replacement, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    entry = Value(static_cast<PopT>(expected));
+}
+
+template<typename PopT, typename AccessT>
+void BytecodeInterpreter::atomic_wait(Configuration& configuration, Instruction const& instruction)
+{
+    static constexpr i32 ok = 0;
+    static constexpr i32 not_equal = 1;
+    static constexpr i32 timed_out = 2;
+
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto timeout = configuration.value_stack().take_last().to<i64>();
+    auto expected = static_cast<AccessT>(configuration.value_stack().take_last().to<PopT>());
+    auto& entry = configuration.value_stack().last();
+    MemoryInstance* memory = nullptr;
+    auto* pointer = atomic_access_pointer(configuration, arg, entry.to<u32>(), sizeof(AccessT), &memory);
+    if (!pointer)
+        return;
+    if (!memory->type().is_shared()) {
+        m_trap = Trap::from_string("memory.atomic.wait on unshared memory");
+        return;
+    }
+    if (!configuration.can_block()) {
+        m_trap = Trap::from_string("memory.atomic.wait on an agent that cannot block");
+        return;
+    }
+
+    Threading::MutexLocker locker { s_atomic_waiters_mutex };
+    if (__atomic_load_n(bit_cast<AccessT*>(pointer), __ATOMIC_SEQ_CST) != expected) {
+        entry = Value(not_equal);
+        return;
+    }
+
+    AtomicWaiter waiter { s_atomic_waiters_mutex };
+    s_atomic_waiters.ensure(pointer).append(&waiter);
+
+    // A negative timeout means waiting forever. Either way, every wait on the condition is bounded, so that a huge
+    // timeout never turns into an overflowing absolute deadline.
+    static constexpr auto max_wait_slice = AK::Duration::from_seconds(1);
+    Optional<MonotonicTime> deadline;
+    if (timeout >= 0)
+        deadline = MonotonicTime::now() + AK::Duration::from_nanoseconds(timeout);
+    while (!waiter.notified) {
+        auto slice = max_wait_slice;
+        if (deadline.has_value()) {
+            auto now = MonotonicTime::now();
+            if (now >= *deadline)
+                break;
+            slice = min(slice, *deadline - now);
+        }
+        (void)waiter.condition.wait_for(slice);
+    }
+
+    if (waiter.notified) {
+        entry = Value(ok);
+        return;
+    }
+
+    auto it = s_atomic_waiters.find(pointer);
+    it->value.remove_first_matching([&](auto* candidate) { return candidate == &waiter; });
+    if (it->value.is_empty())
+        s_atomic_waiters.remove(it);
+    entry = Value(timed_out);
+}
+
+void BytecodeInterpreter::atomic_notify(Configuration& configuration, Instruction const& instruction)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto count = configuration.value_stack().take_last().to<u32>();
+    auto& entry = configuration.value_stack().last();
+    MemoryInstance* memory = nullptr;
+    auto* pointer = atomic_access_pointer(configuration, arg, entry.to<u32>(), sizeof(u32), &memory);
+    if (!pointer)
+        return;
+
+    // Nobody can be waiting on an unshared memory.
+    if (!memory->type().is_shared()) {
+        entry = Value(static_cast<i32>(0));
+        return;
+    }
+
+    Threading::MutexLocker locker { s_atomic_waiters_mutex };
+    auto it = s_atomic_waiters.find(pointer);
+    if (it == s_atomic_waiters.end()) {
+        entry = Value(static_cast<i32>(0));
+        return;
+    }
+
+    u32 woken = 0;
+    auto& waiters = it->value;
+    while (woken < count && !waiters.is_empty()) {
+        auto* waiter = waiters.take_first();
+        waiter->notified = true;
+        waiter->condition.signal();
+        ++woken;
+    }
+    if (waiters.is_empty())
+        s_atomic_waiters.remove(it);
+    entry = Value(static_cast<i32>(woken));
+}
+
 template<typename T>
 T BytecodeInterpreter::read_value(ReadonlyBytes data)
 {
@@ -504,7 +835,7 @@ ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& con
     case Instructions::return_.value(): {
         while (configuration.label_stack().size() - 1 != configuration.frame().label_index())
             configuration.label_stack().take_last();
-        configuration.ip() = configuration.frame().expression().instructions().size();
+        configuration.ip() = configuration.frame().expression().compiled_instructions().size();
         return;
     }
     case Instructions::br.value():
@@ -1659,11 +1990,206 @@ ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& con
         return unary_operation<u128, u128, Operators::VectorConvertOp<4, 2, u32, f64, Operators::SaturatingTruncate<i32>>>(configuration);
     case Instructions::i32x4_trunc_sat_f64x2_u_zero.value():
         return unary_operation<u128, u128, Operators::VectorConvertOp<4, 2, u32, f64, Operators::SaturatingTruncate<u32>>>(configuration);
+
+    // Superinstructions, see compile_expression(). The first operand is the superinstruction's own argument, and the
+    // second one is read from the instruction that follows it.
+    case Instructions::synthetic_i32_add2local.value(): {
+        auto& locals = configuration.frame().locals();
+        auto lhs = locals[instruction.arguments().get<LocalIndex>().value()].to<u32>();
+        auto rhs = locals[(&instruction)[1].arguments().get<LocalIndex>().value()].to<u32>();
+        configuration.value_stack().append(Value(static_cast<i32>(lhs + rhs)));
+        ip = ip.value() + 3;
+        return;
+    }
+    case Instructions::synthetic_i32_sub2local.value(): {
+        auto& locals = configuration.frame().locals();
+        auto lhs = locals[instruction.arguments().get<LocalIndex>().value()].to<u32>();
+        auto rhs = locals[(&instruction)[1].arguments().get<LocalIndex>().value()].to<u32>();
+        configuration.value_stack().append(Value(static_cast<i32>(lhs - rhs)));
+        ip = ip.value() + 3;
+        return;
+    }
+    case Instructions::synthetic_i32_addconstlocal.value(): {
+        auto lhs = configuration.frame().locals()[instruction.arguments().get<LocalIndex>().value()].to<u32>();
+        auto rhs = static_cast<u32>((&instruction)[1].arguments().get<i32>());
+        configuration.value_stack().append(Value(static_cast<i32>(lhs + rhs)));
+        ip = ip.value() + 3;
+        return;
+    }
+    case Instructions::synthetic_i32_andconstlocal.value(): {
+        auto lhs = configuration.frame().locals()[instruction.arguments().get<LocalIndex>().value()].to<i32>();
+        auto rhs = (&instruction)[1].arguments().get<i32>();
+        configuration.value_stack().append(Value(lhs & rhs));
+        ip = ip.value() + 3;
+        return;
+    }
+    case Instructions::synthetic_local_seti32_const.value():
+        configuration.frame().locals()[(&instruction)[1].arguments().get<LocalIndex>().value()] = Value(instruction.arguments().get<i32>());
+        ip = ip.value() + 2;
+        return;
+    case Instructions::synthetic_local_copy.value(): {
+        auto& locals = configuration.frame().locals();
+        locals[(&instruction)[1].arguments().get<LocalIndex>().value()] = locals[instruction.arguments().get<LocalIndex>().value()];
+        ip = ip.value() + 2;
+        return;
+    }
+    case Instructions::synthetic_br_if_i32_eqz.value():
+        return branch_if(configuration, ip, instruction, configuration.value_stack().take_last().to<i32>() == 0);
+    case Instructions::synthetic_br_if_i32_eq.value():
+        return compare_and_branch<i32, Operators::Equals>(configuration, ip, instruction);
+    case Instructions::synthetic_br_if_i32_ne.value():
+        return compare_and_branch<i32, Operators::NotEquals>(configuration, ip, instruction);
+    case Instructions::synthetic_br_if_i32_lts.value():
+        return compare_and_branch<i32, Operators::LessThan>(configuration, ip, instruction);
+    case Instructions::synthetic_br_if_i32_ltu.value():
+        return compare_and_branch<u32, Operators::LessThan>(configuration, ip, instruction);
+    case Instructions::synthetic_br_if_i32_ges.value():
+        return compare_and_branch<i32, Operators::GreaterThanOrEquals>(configuration, ip, instruction);
+    case Instructions::memory_atomic_notify.value():
+        return atomic_notify(configuration, instruction);
+    case Instructions::memory_atomic_wait32.value():
+        return atomic_wait<i32, u32>(configuration, instruction);
+    case Instructions::memory_atomic_wait64.value():
+        return atomic_wait<i64, u64>(configuration, instruction);
+    case Instructions::atomic_fence.value():
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        return;
+    case Instructions::i32_atomic_load.value():
+        return atomic_load_and_push<u32, i32>(configuration, instruction);
+    case Instructions::i64_atomic_load.value():
+        return atomic_load_and_push<u64, i64>(configuration, instruction);
+    case Instructions::i32_atomic_load8_u.value():
+        return atomic_load_and_push<u8, i32>(configuration, instruction);
+    case Instructions::i32_atomic_load16_u.value():
+        return atomic_load_and_push<u16, i32>(configuration, instruction);
+    case Instructions::i64_atomic_load8_u.value():
+        return atomic_load_and_push<u8, i64>(configuration, instruction);
+    case Instructions::i64_atomic_load16_u.value():
+        return atomic_load_and_push<u16, i64>(configuration, instruction);
+    case Instructions::i64_atomic_load32_u.value():
+        return atomic_load_and_push<u32, i64>(configuration, instruction);
+    case Instructions::i32_atomic_store.value():
+        return atomic_pop_and_store<i32, u32>(configuration, instruction);
+    case Instructions::i64_atomic_store.value():
+        return atomic_pop_and_store<i64, u64>(configuration, instruction);
+    case Instructions::i32_atomic_store8.value():
+        return atomic_pop_and_store<i32, u8>(configuration, instruction);
+    case Instructions::i32_atomic_store16.value():
+        return atomic_pop_and_store<i32, u16>(configuration, instruction);
+    case Instructions::i64_atomic_store8.value():
+        return atomic_pop_and_store<i64, u8>(configuration, instruction);
+    case Instructions::i64_atomic_store16.value():
+        return atomic_pop_and_store<i64, u16>(configuration, instruction);
+    case Instructions::i64_atomic_store32.value():
+        return atomic_pop_and_store<i64, u32>(configuration, instruction);
+    case Instructions::i32_atomic_rmw_add.value():
+        return atomic_read_modify_write<i32, u32, AtomicOperation::Add>(configuration, instruction);
+    case Instructions::i64_atomic_rmw_add.value():
+        return atomic_read_modify_write<i64, u64, AtomicOperation::Add>(configuration, instruction);
+    case Instructions::i32_atomic_rmw8_add_u.value():
+        return atomic_read_modify_write<i32, u8, AtomicOperation::Add>(configuration, instruction);
+    case Instructions::i32_atomic_rmw16_add_u.value():
+        return atomic_read_modify_write<i32, u16, AtomicOperation::Add>(configuration, instruction);
+    case Instructions::i64_atomic_rmw8_add_u.value():
+        return atomic_read_modify_write<i64, u8, AtomicOperation::Add>(configuration, instruction);
+    case Instructions::i64_atomic_rmw16_add_u.value():
+        return atomic_read_modify_write<i64, u16, AtomicOperation::Add>(configuration, instruction);
+    case Instructions::i64_atomic_rmw32_add_u.value():
+        return atomic_read_modify_write<i64, u32, AtomicOperation::Add>(configuration, instruction);
+    case Instructions::i32_atomic_rmw_sub.value():
+        return atomic_read_modify_write<i32, u32, AtomicOperation::Sub>(configuration, instruction);
+    case Instructions::i64_atomic_rmw_sub.value():
+        return atomic_read_modify_write<i64, u64, AtomicOperation::Sub>(configuration, instruction);
+    case Instructions::i32_atomic_rmw8_sub_u.value():
+        return atomic_read_modify_write<i32, u8, AtomicOperation::Sub>(configuration, instruction);
+    case Instructions::i32_atomic_rmw16_sub_u.value():
+        return atomic_read_modify_write<i32, u16, AtomicOperation::Sub>(configuration, instruction);
+    case Instructions::i64_atomic_rmw8_sub_u.value():
+        return atomic_read_modify_write<i64, u8, AtomicOperation::Sub>(configuration, instruction);
+    case Instructions::i64_atomic_rmw16_sub_u.value():
+        return atomic_read_modify_write<i64, u16, AtomicOperation::Sub>(configuration, instruction);
+    case Instructions::i64_atomic_rmw32_sub_u.value():
+        return atomic_read_modify_write<i64, u32, AtomicOperation::Sub>(configuration, instruction);
+    case Instructions::i32_atomic_rmw_and.value():
+        return atomic_read_modify_write<i32, u32, AtomicOperation::And>(configuration, instruction);
+    case Instructions::i64_atomic_rmw_and.value():
+        return atomic_read_modify_write<i64, u64, AtomicOperation::And>(configuration, instruction);
+    case Instructions::i32_atomic_rmw8_and_u.value():
+        return atomic_read_modify_write<i32, u8, AtomicOperation::And>(configuration, instruction);
+    case Instructions::i32_atomic_rmw16_and_u.value():
+        return atomic_read_modify_write<i32, u16, AtomicOperation::And>(configuration, instruction);
+    case Instructions::i64_atomic_rmw8_and_u.value():
+        return atomic_read_modify_write<i64, u8, AtomicOperation::And>(configuration, instruction);
+    case Instructions::i64_atomic_rmw16_and_u.value():
+        return atomic_read_modify_write<i64, u16, AtomicOperation::And>(configuration, instruction);
+    case Instructions::i64_atomic_rmw32_and_u.value():
+        return atomic_read_modify_write<i64, u32, AtomicOperation::And>(configuration, instruction);
+    case Instructions::i32_atomic_rmw_or.value():
+        return atomic_read_modify_write<i32, u32, AtomicOperation::Or>(configuration, instruction);
+    case Instructions::i64_atomic_rmw_or.value():
+        return atomic_read_modify_write<i64, u64, AtomicOperation::Or>(configuration, instruction);
+    case Instructions::i32_atomic_rmw8_or_u.value():
+        return atomic_read_modify_write<i32, u8, AtomicOperation::Or>(configuration, instruction);
+    case Instructions::i32_atomic_rmw16_or_u.value():
+        return atomic_read_modify_write<i32, u16, AtomicOperation::Or>(configuration, instruction);
+    case Instructions::i64_atomic_rmw8_or_u.value():
+        return atomic_read_modify_write<i64, u8, AtomicOperation::Or>(configuration, instruction);
+    case Instructions::i64_atomic_rmw16_or_u.value():
+        return atomic_read_modify_write<i64, u16, AtomicOperation::Or>(configuration, instruction);
+    case Instructions::i64_atomic_rmw32_or_u.value():
+        return atomic_read_modify_write<i64, u32, AtomicOperation::Or>(configuration, instruction);
+    case Instructions::i32_atomic_rmw_xor.value():
+        return atomic_read_modify_write<i32, u32, AtomicOperation::Xor>(configuration, instruction);
+    case Instructions::i64_atomic_rmw_xor.value():
+        return atomic_read_modify_write<i64, u64, AtomicOperation::Xor>(configuration, instruction);
+    case Instructions::i32_atomic_rmw8_xor_u.value():
+        return atomic_read_modify_write<i32, u8, AtomicOperation::Xor>(configuration, instruction);
+    case Instructions::i32_atomic_rmw16_xor_u.value():
+        return atomic_read_modify_write<i32, u16, AtomicOperation::Xor>(configuration, instruction);
+    case Instructions::i64_atomic_rmw8_xor_u.value():
+        return atomic_read_modify_write<i64, u8, AtomicOperation::Xor>(configuration, instruction);
+    case Instructions::i64_atomic_rmw16_xor_u.value():
+        return atomic_read_modify_write<i64, u16, AtomicOperation::Xor>(configuration, instruction);
+    case Instructions::i64_atomic_rmw32_xor_u.value():
+        return atomic_read_modify_write<i64, u32, AtomicOperation::Xor>(configuration, instruction);
+    case Instructions::i32_atomic_rmw_xchg.value():
+        return atomic_read_modify_write<i32, u32, AtomicOperation::Exchange>(configuration, instruction);
+    case Instructions::i64_atomic_rmw_xchg.value():
+        return atomic_read_modify_write<i64, u64, AtomicOperation::Exchange>(configuration, instruction);
+    case Instructions::i32_atomic_rmw8_xchg_u.value():
+        return atomic_read_modify_write<i32, u8, AtomicOperation::Exchange>(configuration, instruction);
+    case Instructions::i32_atomic_rmw16_xchg_u.value():
+        return atomic_read_modify_write<i32, u16, AtomicOperation::Exchange>(configuration, instruction);
+    case Instructions::i64_atomic_rmw8_xchg_u.value():
+        return atomic_read_modify_write<i64, u8, AtomicOperation::Exchange>(configuration, instruction);
+    case Instructions::i64_atomic_rmw16_xchg_u.value():
+        return atomic_read_modify_write<i64, u16, AtomicOperation::Exchange>(configuration, instruction);
+    case Instructions::i64_atomic_rmw32_xchg_u.value():
+        return atomic_read_modify_write<i64, u32, AtomicOperation::Exchange>(configuration, instruction);
+    case Instructions::i32_atomic_rmw_cmpxchg.value():
+        return atomic_compare_exchange<i32, u32>(configuration, instruction);
+    case Instructions::i64_atomic_rmw_cmpxchg.value():
+        return atomic_compare_exchange<i64, u64>(configuration, instruction);
+    case Instructions::i32_atomic_rmw8_cmpxchg_u.value():
+        return atomic_compare_exchange<i32, u8>(configuration, instruction);
+    case Instructions::i32_atomic_rmw16_cmpxchg_u.value():
+        return atomic_compare_exchange<i32, u16>(configuration, instruction);
+    case Instructions::i64_atomic_rmw8_cmpxchg_u.value():
+        return atomic_compare_exchange<i64, u8>(configuration, instruction);
+    case Instructions::i64_atomic_rmw16_cmpxchg_u.value():
+        return atomic_compare_exchange<i64, u16>(configuration, instruction);
+    case Instructions::i64_atomic_rmw32_cmpxchg_u.value():
+        return atomic_compare_exchange<i64, u32>(configuration, instruction);
+    case Instructions::synthetic_br_if_i32_geu.value():
+        return compare_and_branch<u32, Operators::GreaterThanOrEquals>(configuration, ip, instruction);
     }
 }
 
-void DebuggerBytecodeInterpreter::interpret_instruction(Configuration& configuration, InstructionPointer& ip, Instruction const& instruction)
+void DebuggerBytecodeInterpreter::interpret_instruction_with_hooks(Configuration& configuration, InstructionPointer& ip, Instruction const& instruction)
 {
+    if (profiler)
+        profiler->record_instruction(configuration, ip);
+
     if (pre_interpret_hook) {
         auto result = pre_interpret_hook(configuration, ip, instruction);
         if (!result) {
@@ -9,6 +9,7 @@
 #include <AK/StackInfo.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/AbstractMachine/Interpreter.h>
+#include <LibWasm/Forward.h>
 
 namespace Wasm {
 
@@ -20,6 +21,10 @@ struct BytecodeInterpreter : public Interpreter {
 
     virtual void interpret(Configuration&) final;
 
+    // Lowers the function bodies of a validated module into the form the interpreter runs, fusing common instruction
+    // sequences into superinstructions.
+    static void compile(Module&);
+
     virtual ~BytecodeInterpreter() override = default;
     virtual bool did_trap() const final { return !m_trap.has<Empty>(); }
     virtual Trap trap() const final
@@ -52,9 +57,30 @@ struct BytecodeInterpreter : public Interpreter {
         IndirectCall,
     };
 
+    // Proposal "threads"
+    enum class AtomicOperation {
+        Add,
+        Sub,
+        And,
+        Or,
+        Xor,
+        Exchange,
+    };
+
 protected:
+    // Interpreters that want to observe every instruction (e.g. for debugging or profiling) override these; the plain
+    // dispatch loop is used whenever has_instruction_hooks() returns false.
+    virtual bool has_instruction_hooks() const { return false; }
+    virtual void interpret_instruction_with_hooks(Configuration&, InstructionPointer&, Instruction const&) { VERIFY_NOT_REACHED(); }
+
+    template<bool HasInstructionHooks>
+    void interpret_impl(Configuration&);
+
     void interpret_instruction(Configuration&, InstructionPointer&, Instruction const&);
     void branch_to_label(Configuration&, LabelIndex);
+    void branch_if(Configuration&, InstructionPointer&, Instruction const&, bool condition);
+    template<typename PopT, typename Operator>
+    void compare_and_branch(Configuration&, InstructionPointer&, Instruction const&);
     template<typename ReadT, typename PushT>
     void load_and_push(Configuration&, Instruction const&);
     template<typename PopT, typename StoreT>
@@ -76,6 +102,18 @@ protected:
     template<typename M, template<typename> typename SetSign, typename VectorType = Native128ByteVectorOf<M, SetSign>>
     VectorType pop_vector(Configuration&);
     void store_to_memory(Configuration&, Instruction::MemoryArgument const&, ReadonlyBytes data, u32 base);
+    u8* atomic_access_pointer(Configuration&, Instruction::MemoryArgument const&, u32 base, size_t size, MemoryInstance** = nullptr);
+    template<typename AccessT, typename PushT>
+    void atomic_load_and_push(Configuration&, Instruction const&);
+    template<typename PopT, typename AccessT>
+    void atomic_pop_and_store(Configuration&, Instruction const&);
+    template<typename PopT, typename AccessT, AtomicOperation>
+    void atomic_read_modify_write(Configuration&, Instruction const&);
+    template<typename PopT, typename AccessT>
+    void atomic_compare_exchange(Configuration&, Instruction const&);
+    template<typename PopT, typename AccessT>
+    void atomic_wait(Configuration&, Instruction const&);
+    void atomic_notify(Configuration&, Instruction const&);
     void call_address(Configuration&, FunctionAddress, CallAddressSource = CallAddressSource::DirectCall);
 
     template<typename PopTypeLHS, typename PushType, typename Operator, typename PopTypeRHS = PopTypeLHS, typename... Args>
@@ -115,9 +153,11 @@ struct DebuggerBytecodeInterpreter : public BytecodeInterpreter {
 
     Function<bool(Configuration&, InstructionPointer&, Instruction const&)> pre_interpret_hook;
     Function<bool(Configuration&, InstructionPointer&, Instruction const&, Interpreter const&)> post_interpret_hook;
+    Profiler* profiler { nullptr };
 
 private:
-    void interpret_instruction(Configuration&, InstructionPointer&, Instruction const&);
+    virtual bool has_instruction_hooks() const override { return profiler || pre_interpret_hook || post_interpret_hook; }
+    virtual void interpret_instruction_with_hooks(Configuration&, InstructionPointer&, Instruction const&) override;
 };
 
 }
@@ -18,23 +18,30 @@ void Configuration::unwind(Badge<CallFrameHandle>, CallFrameHandle const& frame_
     m_ip = frame_handle.ip;
 }
 
-Result Configuration::call(Interpreter& interpreter, FunctionAddress address, Vector<Value> arguments)
+Result Configuration::call(Interpreter& interpreter, FunctionAddress address, ReadonlySpan<Value> arguments)
 {
     auto* function = m_store.get(address);
     if (!function)
         return Trap::from_string("Attempt to call nonexistent function by address");
     if (auto* wasm_function = function->get_pointer<WasmFunction>()) {
-        Vector<Value> locals = move(arguments);
-        locals.ensure_capacity(locals.size() + wasm_function->code().func().locals().size());
-        for (auto& local : wasm_function->code().func().locals()) {
+        auto const& func = wasm_function->code().func();
+
+        size_t local_count = arguments.size();
+        for (auto& local : func.locals())
+            local_count += local.n();
+
+        Vector<Value> locals;
+        locals.ensure_capacity(local_count);
+        locals.unchecked_append(arguments.data(), arguments.size());
+        for (auto& local : func.locals()) {
             for (size_t i = 0; i < local.n(); ++i)
-                locals.append(Value(local.type()));
+                locals.unchecked_append(Value(local.type()));
         }
 
         set_frame(Frame {
             wasm_function->module(),
             move(locals),
-            wasm_function->code().func().body(),
+            func.body(),
             wasm_function->type().results().size(),
         });
         m_ip = 0;
@@ -43,7 +50,48 @@ Result Configuration::call(Interpreter& interpreter, FunctionAddress address, Ve
 
     // It better be a host function, else something is really wrong.
     auto& host_function = function->get<HostFunction>();
-    return host_function.function()(*this, arguments);
+    Vector<Value> host_arguments;
+    host_arguments.ensure_capacity(arguments.size());
+    host_arguments.unchecked_append(arguments.data(), arguments.size());
+    return host_function.function()(*this, host_arguments);
+}
+
+void Configuration::call_from_value_stack(Interpreter& interpreter, WasmFunction const& function)
+{
+    auto const& func = function.code().func();
+    auto parameter_count = function.type().parameters().size();
+
+    size_t local_count = parameter_count;
+    for (auto& local : func.locals())
+        local_count += local.n();
+
+    Vector<Value> locals;
+    locals.ensure_capacity(local_count);
+    for (auto& value : m_value_stack.span().slice_from_end(parameter_count))
+        locals.unchecked_append(value);
+    m_value_stack.shrink(m_value_stack.size() - parameter_count);
+    for (auto& local : func.locals()) {
+        for (size_t i = 0; i < local.n(); ++i)
+            locals.unchecked_append(Value(local.type()));
+    }
+
+    set_frame(Frame {
+        function.module(),
+        move(locals),
+        func.body(),
+        function.type().results().size(),
+    });
+    m_ip = 0;
+
+    interpreter.interpret(*this);
+    if (interpreter.did_trap())
+        return;
+
+    // Drop anything an early `return` left between the caller's operands and our results.
+    auto label = label_stack().take_last();
+    auto arity = frame().arity();
+    if (m_value_stack.size() > label.stack_height() + arity)
+        m_value_stack.remove(label.stack_height(), m_value_stack.size() - label.stack_height() - arity);
 }
 
 Result Configuration::execute(Interpreter& interpreter)
@@ -61,6 +109,15 @@ Result Configuration::execute(Interpreter& interpreter)
     return Result { move(results) };
 }
 
+void Configuration::reset()
+{
+    m_value_stack.clear_with_capacity();
+    m_label_stack.clear_with_capacity();
+    m_frame_stack.clear_with_capacity();
+    m_depth = 0;
+    m_ip = 0;
+}
+
 void Configuration::dump_stack()
 {
     auto print_value = []<typename... Ts>(CheckedFormatString<Ts...> format, Ts... vs) {
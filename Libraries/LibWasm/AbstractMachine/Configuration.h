@@ -26,6 +26,7 @@ public:
     }
     ALWAYS_INLINE auto& frame() const { return m_frame_stack.last(); }
     ALWAYS_INLINE auto& frame() { return m_frame_stack.last(); }
+    ALWAYS_INLINE auto& frames() const { return m_frame_stack; }
     ALWAYS_INLINE auto& ip() const { return m_ip; }
     ALWAYS_INLINE auto& ip() { return m_ip; }
     ALWAYS_INLINE auto& depth() const { return m_depth; }
@@ -55,12 +56,21 @@ public:
     };
 
     void unwind(Badge<CallFrameHandle>, CallFrameHandle const&);
-    Result call(Interpreter&, FunctionAddress, Vector<Value> arguments);
+    Result call(Interpreter&, FunctionAddress, ReadonlySpan<Value> arguments);
+    // Calls a wasm function from another wasm function: the arguments are popped off the value stack, and the results
+    // are left on it, so nothing has to be copied into or out of temporary vectors.
+    void call_from_value_stack(Interpreter&, WasmFunction const&);
     Result execute(Interpreter&);
 
     void enable_instruction_count_limit() { m_should_limit_instruction_count = true; }
     bool should_limit_instruction_count() const { return m_should_limit_instruction_count; }
 
+    void enable_blocking() { m_can_block = true; }
+    bool can_block() const { return m_can_block; }
+
+    // Drops all frames, labels and values while keeping the storage around, so the configuration can run another call.
+    void reset();
+
     void dump_stack();
 
 private:
@@ -71,6 +81,7 @@ private:
     size_t m_depth { 0 };
     InstructionPointer m_ip;
     bool m_should_limit_instruction_count { false };
+    bool m_can_block { false };
 };
 
 }
@@ -50,6 +50,39 @@ DEFINE_BINARY_OPERATOR(BitXor, ^);
 
 #undef DEFINE_BINARY_OPERATOR
 
+// The lane-wise semantics of these operators match the corresponding operators on native vector types, so vector
+// operations using them can be lowered onto single vector instructions rather than a loop over the lanes.
+template<typename Op>
+concept NativeVectorComparison = IsOneOf<Op, Equals, NotEquals, GreaterThan, LessThan, LessThanOrEquals, GreaterThanOrEquals>;
+
+template<typename Op>
+concept NativeVectorWrappingArithmetic = IsOneOf<Op, Add, Subtract, Multiply>;
+
+template<size_t Offset, size_t Stride, SIMDVector VectorType, size_t... Indices>
+ALWAYS_INLINE static auto select_lanes_impl(VectorType vector, IndexSequence<Indices...>)
+{
+    return __builtin_shufflevector(vector, vector, (Offset + Indices * Stride)...);
+}
+
+// Returns the vector made of lanes Offset, Offset + Stride, ..., of which there are Count.
+template<size_t Offset, size_t Stride, size_t Count, SIMDVector VectorType>
+ALWAYS_INLINE static auto select_lanes(VectorType vector)
+{
+    return select_lanes_impl<Offset, Stride>(vector, MakeIndexSequence<Count>());
+}
+
+template<SIMDVector VectorType, size_t... Indices>
+ALWAYS_INLINE static auto concatenate_impl(VectorType low, VectorType high, IndexSequence<Indices...>)
+{
+    return __builtin_shufflevector(low, high, Indices...);
+}
+
+template<SIMDVector VectorType>
+ALWAYS_INLINE static auto concatenate(VectorType low, VectorType high)
+{
+    return concatenate_impl(low, high, MakeIndexSequence<vector_length<VectorType> * 2>());
+}
+
 struct Divide {
     template<typename Lhs, typename Rhs>
     auto operator()(Lhs lhs, Rhs rhs) const
@@ -338,6 +371,11 @@ struct VectorCmpOp {
         auto result = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c1);
         auto other = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c2);
         Op op;
+        if constexpr (NativeVectorComparison<Op>) {
+            using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+            return bit_cast<u128>(op(bit_cast<VectorType>(c1), bit_cast<VectorType>(c2)));
+        }
+
         for (size_t i = 0; i < VectorSize; ++i) {
             SetSign<ElementType> lhs = result[i];
             SetSign<ElementType> rhs = other[i];
@@ -372,6 +410,9 @@ struct VectorFloatCmpOp {
         using ElementType = NativeIntegralType<128 / VectorSize>;
         Native128ByteVectorOf<ElementType, MakeUnsigned> result;
         Op op;
+        if constexpr (NativeVectorComparison<Op>)
+            return bit_cast<u128>(op(first, other));
+
         for (size_t i = 0; i < VectorSize; ++i)
             result[i] = op(first[i], other[i]) ? static_cast<ElementType>(-1) : 0;
         return bit_cast<u128>(result);
@@ -576,7 +617,12 @@ struct VectorIntegerExtOpPairwise {
         VectorResult result;
         Op op;
 
-        // FIXME: Find a way to not loop here
+        if constexpr (IsSame<Op, Add>) {
+            auto even = __builtin_convertvector((select_lanes<0, 2, VectorSize>(vector)), VectorResult);
+            auto odd = __builtin_convertvector((select_lanes<1, 2, VectorSize>(vector)), VectorResult);
+            return bit_cast<u128>(even + odd);
+        }
+
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(vector[i * 2], vector[(i * 2) + 1]);
         }
@@ -611,19 +657,8 @@ struct VectorIntegerExt {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
         auto vector = bit_cast<VectorInput>(c);
-        VectorResult result;
-
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            if constexpr (Mode == VectorExt::High)
-                result[i] = vector[VectorSize + i];
-            else if constexpr (Mode == VectorExt::Low)
-                result[i] = vector[i];
-            else
-                VERIFY_NOT_REACHED();
-        }
-
-        return bit_cast<u128>(result);
+        constexpr size_t offset = Mode == VectorExt::High ? VectorSize : 0;
+        return bit_cast<u128>(__builtin_convertvector((select_lanes<offset, 1, VectorSize>(vector)), VectorResult));
     }
 
     static StringView name()
@@ -652,8 +687,15 @@ struct VectorIntegerExtOp {
         VectorResult result;
         Op op;
 
+        if constexpr (IsSame<Op, Multiply>) {
+            // The product of two extended lanes always fits in the wider lane, so this can't overflow.
+            constexpr size_t offset = Mode == VectorExt::High ? VectorSize : 0;
+            auto a = __builtin_convertvector((select_lanes<offset, 1, VectorSize>(first)), VectorResult);
+            auto b = __builtin_convertvector((select_lanes<offset, 1, VectorSize>(second)), VectorResult);
+            return bit_cast<u128>(a * b);
+        }
+
         using ResultType = SetSign<NativeIntegralType<128 / VectorSize>>;
-        // FIXME: Find a way to not loop here
         for (size_t i = 0; i < VectorSize; ++i) {
             if constexpr (Mode == VectorExt::High) {
                 ResultType a = first[VectorSize + i];
@@ -695,7 +737,16 @@ struct VectorIntegerBinaryOp {
         VectorType result;
         Op op;
 
-        // FIXME: Find a way to not loop here
+        if constexpr (NativeVectorWrappingArithmetic<Op>) {
+            // Do the arithmetic on unsigned lanes, where overflow is defined to wrap around.
+            using UnsignedVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
+            return bit_cast<u128>(op(bit_cast<UnsignedVectorType>(first), bit_cast<UnsignedVectorType>(second)));
+        } else if constexpr (IsSame<Op, Minimum>) {
+            return bit_cast<u128>(first < second ? first : second);
+        } else if constexpr (IsSame<Op, Maximum>) {
+            return bit_cast<u128>(first < second ? second : first);
+        }
+
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(first[i], second[i]);
         }
@@ -743,18 +794,15 @@ struct VectorDotProduct {
     {
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, MakeSigned>;
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, MakeSigned>;
+        using UnsignedVectorResult = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
         auto v1 = bit_cast<VectorInput>(lhs);
         auto v2 = bit_cast<VectorInput>(rhs);
-        VectorResult result;
-
-        using ResultType = MakeUnsigned<NativeIntegralType<128 / VectorSize>>;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            ResultType low = v1[i * 2] * v2[i * 2];
-            ResultType high = v1[(i * 2) + 1] * v2[(i * 2) + 1];
-            result[i] = low + high;
-        }
 
-        return bit_cast<u128>(result);
+        auto widen = [](auto vector) { return bit_cast<UnsignedVectorResult>(__builtin_convertvector(vector, VectorResult)); };
+        // Each product fits in a wider lane, but their sum may not, so sum them on unsigned lanes where overflow wraps around.
+        auto low = widen(select_lanes<0, 2, VectorSize>(v1)) * widen(select_lanes<0, 2, VectorSize>(v2));
+        auto high = widen(select_lanes<1, 2, VectorSize>(v1)) * widen(select_lanes<1, 2, VectorSize>(v2));
+        return bit_cast<u128>(low + high);
     }
 
     static StringView name() { return "dot"sv; }
@@ -766,27 +814,20 @@ struct VectorNarrow {
     {
         using VectorInput = NativeVectorType<128 / (VectorSize / 2), VectorSize / 2, MakeSigned>;
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
+        using VectorHalfResult = NativeVectorType<128 / VectorSize, VectorSize / 2, MakeUnsigned>;
         auto v1 = bit_cast<VectorInput>(lhs);
         auto v2 = bit_cast<VectorInput>(rhs);
-        VectorResult result;
 
-        for (size_t i = 0; i < (VectorSize / 2); ++i) {
-            if (v1[i] <= NumericLimits<Element>::min())
-                result[i] = NumericLimits<Element>::min();
-            else if (v1[i] >= NumericLimits<Element>::max())
-                result[i] = NumericLimits<Element>::max();
-            else
-                result[i] = v1[i];
-        }
-        for (size_t i = 0; i < (VectorSize / 2); ++i) {
-            if (v2[i] <= NumericLimits<Element>::min())
-                result[i + VectorSize / 2] = NumericLimits<Element>::min();
-            else if (v2[i] >= NumericLimits<Element>::max())
-                result[i + VectorSize / 2] = NumericLimits<Element>::max();
-            else
-                result[i + VectorSize / 2] = v2[i];
-        }
+        auto saturate = [](VectorInput vector) {
+            using InputElement = MakeSigned<NativeIntegralType<128 / (VectorSize / 2)>>;
+            VectorInput minimum = static_cast<InputElement>(NumericLimits<Element>::min()) - VectorInput {};
+            VectorInput maximum = static_cast<InputElement>(NumericLimits<Element>::max()) - VectorInput {};
+            vector = vector < minimum ? minimum : vector;
+            vector = vector > maximum ? maximum : vector;
+            return __builtin_convertvector(vector, VectorHalfResult);
+        };
 
+        VectorResult result = concatenate(saturate(v1), saturate(v2));
         return bit_cast<u128>(result);
     }
 
@@ -798,11 +839,21 @@ struct VectorIntegerUnaryOp {
     auto operator()(u128 lhs) const
     {
         using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+        using UnsignedVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
+        using SignedVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeSigned>;
         auto value = bit_cast<VectorType>(lhs);
         VectorType result;
         Op op;
 
-        // FIXME: Find a way to not loop here
+        // Negation and absolute value wrap around for the most negative value, so do them on unsigned lanes.
+        if constexpr (IsSame<Op, Negate>) {
+            return bit_cast<u128>(UnsignedVectorType {} - bit_cast<UnsignedVectorType>(value));
+        } else if constexpr (IsSame<Op, Absolute>) {
+            // The sign mask is all ones for negative lanes, and abs(x) == (x ^ mask) - mask.
+            auto mask = bit_cast<UnsignedVectorType>(bit_cast<SignedVectorType>(value) >> (128 / VectorSize - 1));
+            return bit_cast<u128>((bit_cast<UnsignedVectorType>(value) ^ mask) - mask);
+        }
+
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(value[i]);
         }
@@ -836,6 +887,12 @@ struct VectorFloatBinaryOp {
         auto second = bit_cast<VectorType>(rhs);
         VectorType result;
         Op op;
+        // Minimum and Maximum have special cases for NaNs and signed zeroes, so they stay lane-wise.
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply, PseudoMinimum, PseudoMaximum>)
+            return bit_cast<u128>(op(first, second));
+        else if constexpr (IsSame<Op, Divide>)
+            return bit_cast<u128>(first / second);
+
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(first[i], second[i]);
         }
@@ -860,9 +917,18 @@ struct VectorFloatUnaryOp {
     auto operator()(u128 lhs) const
     {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
+        using BitsVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
         auto value = bit_cast<VectorType>(lhs);
         VectorType result;
         Op op;
+        // Negation and absolute value only touch the sign bit, including for NaNs.
+        using Bits = NativeIntegralType<128 / VectorSize>;
+        constexpr Bits sign_bit = static_cast<Bits>(1) << (128 / VectorSize - 1);
+        if constexpr (IsSame<Op, Negate>)
+            return bit_cast<u128>(bit_cast<BitsVectorType>(value) ^ sign_bit);
+        else if constexpr (IsSame<Op, Absolute>)
+            return bit_cast<u128>(bit_cast<BitsVectorType>(value) & static_cast<Bits>(~sign_bit));
+
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(value[i]);
         }
@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/LEB128.h>
+#include <AK/MemoryStream.h>
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
+#include <LibWasm/Printer/Printer.h>
+
+namespace Wasm {
+
+// https://webassembly.github.io/spec/core/appendix/custom.html#name-section
+static ErrorOr<void> parse_function_names(ReadonlyBytes contents, HashMap<u32, ByteString>& names)
+{
+    static constexpr u8 function_names_subsection_id = 1;
+
+    FixedMemoryStream stream { contents };
+    while (!stream.is_eof()) {
+        auto id = TRY(stream.read_value<u8>());
+        auto size = TRY(stream.read_value<LEB128<u32>>());
+        if (id != function_names_subsection_id) {
+            TRY(stream.discard(size));
+            continue;
+        }
+
+        auto count = TRY(stream.read_value<LEB128<u32>>());
+        for (u32 i = 0; i < count; ++i) {
+            auto index = TRY(stream.read_value<LEB128<u32>>());
+            auto length = TRY(stream.read_value<LEB128<u32>>());
+            auto buffer = TRY(ByteBuffer::create_uninitialized(length));
+            TRY(stream.read_until_filled(buffer));
+            names.set(index, ByteString { buffer.bytes() });
+        }
+        return {};
+    }
+    return {};
+}
+
+Profiler::Profiler(Store& store, AK::Duration sampling_interval)
+    : m_store(store)
+    , m_sampling_interval(sampling_interval)
+    , m_start_time(MonotonicTime::now())
+    , m_end_time(m_start_time)
+    , m_next_sample_time(m_start_time + sampling_interval)
+{
+    m_nodes.append({ .function_index = 0, .parent_index = {}, .children = {}, .self_sample_count = 0 });
+}
+
+Profiler::~Profiler() = default;
+
+void Profiler::stop()
+{
+    if (m_stopped)
+        return;
+    m_stopped = true;
+    m_end_time = MonotonicTime::now();
+}
+
+u64 Profiler::instruction_count() const
+{
+    u64 count = 0;
+    for (auto const& function : m_functions)
+        count += function.instruction_count;
+    return count;
+}
+
+HashMap<u32, ByteString> const& Profiler::function_names_for(ModuleInstance const& module_instance, Module const* module)
+{
+    return m_function_names.ensure(&module_instance, [&] {
+        HashMap<u32, ByteString> names;
+        if (!module)
+            return names;
+        for (auto const& section : module->custom_sections()) {
+            if (section.name() != "name"sv)
+                continue;
+            // A malformed name section just means we fall back to numbered names.
+            if (parse_function_names(section.contents(), names).is_error())
+                names.clear();
+            break;
+        }
+        return names;
+    });
+}
+
+u32 Profiler::function_index_for(ModuleInstance const& module_instance, Expression const& expression)
+{
+    if (auto index = m_function_indices.get(&expression); index.has_value())
+        return *index;
+
+    FunctionProfile function;
+    auto const& addresses = module_instance.functions();
+    for (size_t index = 0; index < addresses.size(); ++index) {
+        auto* instance = m_store.get(addresses[index]);
+        if (!instance)
+            continue;
+        auto* wasm_function = instance->get_pointer<WasmFunction>();
+        if (!wasm_function || &wasm_function->code().func().body() != &expression)
+            continue;
+
+        auto module = wasm_function->module_ref();
+        auto const& names = function_names_for(module_instance, module.ptr());
+        if (auto name = names.get(index); name.has_value())
+            function.name = *name;
+        else
+            function.name = ByteString::formatted("func{}", index);
+        function.address = addresses[index];
+        break;
+    }
+    if (!function.address.has_value())
+        function.name = "(unknown)";
+
+    function.opcodes.ensure_capacity(expression.instructions().size());
+    for (auto const& instruction : expression.instructions())
+        function.opcodes.unchecked_append(instruction.opcode());
+    function.offsets.resize(expression.instructions().size());
+
+    auto function_index = static_cast<u32>(m_functions.size());
+    m_functions.append(move(function));
+    m_function_indices.set(&expression, function_index);
+    return function_index;
+}
+
+void Profiler::enter_expression(Configuration const& configuration, Expression const& expression)
+{
+    m_current_expression = &expression;
+    m_current_function_index = function_index_for(configuration.frame().module(), expression);
+}
+
+void Profiler::take_sample_if_due(Configuration const& configuration, InstructionPointer ip)
+{
+    m_instructions_until_clock_check = instructions_between_clock_checks;
+    if (m_stopped)
+        return;
+
+    auto now = MonotonicTime::now();
+    if (now < m_next_sample_time)
+        return;
+
+    take_sample(configuration, ip, now);
+
+    // If we fell far behind (e.g. in a long-running host call), don't try to catch up with a burst of samples.
+    m_next_sample_time = max(m_next_sample_time + m_sampling_interval, now);
+}
+
+void Profiler::take_sample(Configuration const& configuration, InstructionPointer ip, MonotonicTime now)
+{
+    u32 node_index = 0;
+    for (auto const& frame : configuration.frames()) {
+        auto function_index = function_index_for(frame.module(), frame.expression());
+        if (auto child = m_nodes[node_index].children.get(function_index); child.has_value()) {
+            node_index = *child;
+            continue;
+        }
+        auto child_index = static_cast<u32>(m_nodes.size());
+        m_nodes.append({ .function_index = function_index, .parent_index = node_index, .children = {}, .self_sample_count = 0 });
+        m_nodes[node_index].children.set(function_index, child_index);
+        node_index = child_index;
+    }
+
+    ++m_nodes[node_index].self_sample_count;
+    m_samples.append({ .node_index = node_index, .time = now });
+
+    auto& function = m_functions[m_current_function_index];
+    ++function.self_sample_count;
+    if (ip.value() < function.offsets.size())
+        ++function.offsets[ip.value()].sample_count;
+}
+
+String Profiler::to_cpuprofile_json() const
+{
+    JsonArray nodes;
+    for (size_t node_index = 0; node_index < m_nodes.size(); ++node_index) {
+        auto const& node = m_nodes[node_index];
+
+        JsonObject call_frame;
+        call_frame.set("functionName"sv, node_index == 0 ? "(root)"sv : m_functions[node.function_index].name.view());
+        call_frame.set("scriptId"sv, "0"sv);
+        call_frame.set("url"sv, ""sv);
+        call_frame.set("lineNumber"sv, -1);
+        call_frame.set("columnNumber"sv, -1);
+
+        JsonArray children;
+        for (auto child_index : node.children)
+            children.must_append(child_index.value + 1);
+
+        JsonObject json_node;
+        // Node ids must be positive.
+        json_node.set("id"sv, static_cast<u32>(node_index + 1));
+        json_node.set("callFrame"sv, move(call_frame));
+        json_node.set("hitCount"sv, node.self_sample_count);
+        if (!children.is_empty())
+            json_node.set("children"sv, move(children));
+        nodes.must_append(move(json_node));
+    }
+
+    JsonArray samples;
+    JsonArray time_deltas;
+    auto previous_time = m_start_time;
+    for (auto const& sample : m_samples) {
+        samples.must_append(sample.node_index + 1);
+        time_deltas.must_append((sample.time - previous_time).to_microseconds());
+        previous_time = sample.time;
+    }
+
+    auto end_time = m_stopped ? m_end_time : MonotonicTime::now();
+
+    JsonObject profile;
+    profile.set("nodes"sv, move(nodes));
+    profile.set("startTime"sv, m_start_time.nanoseconds() / 1000);
+    profile.set("endTime"sv, end_time.nanoseconds() / 1000);
+    profile.set("samples"sv, move(samples));
+    profile.set("timeDeltas"sv, move(time_deltas));
+    return profile.serialized();
+}
+
+String Profiler::to_folded_stacks() const
+{
+    StringBuilder builder;
+    Vector<u32> stack;
+    for (size_t node_index = 1; node_index < m_nodes.size(); ++node_index) {
+        auto const& node = m_nodes[node_index];
+        if (node.self_sample_count == 0)
+            continue;
+
+        stack.clear_with_capacity();
+        for (Optional<u32> index = static_cast<u32>(node_index); index.has_value() && *index != 0; index = m_nodes[*index].parent_index)
+            stack.append(*index);
+
+        for (size_t i = stack.size(); i > 0; --i) {
+            // ';' separates frames and ' ' separates the count, so neither can appear inside a frame name.
+            auto frame_name = m_functions[m_nodes[stack[i - 1]].function_index].name.replace(";"sv, ":"sv).replace(" "sv, "_"sv);
+            builder.append(frame_name);
+            if (i > 1)
+                builder.append(';');
+        }
+        builder.appendff(" {}\n", node.self_sample_count);
+    }
+    return builder.to_string_without_validation();
+}
+
+String Profiler::to_summary(size_t max_function_count, size_t max_offsets_per_function) const
+{
+    auto total_instructions = instruction_count();
+    auto total_samples = m_samples.size();
+    auto end_time = m_stopped ? m_end_time : MonotonicTime::now();
+
+    auto percentage = [](u64 part, u64 whole) {
+        return whole == 0 ? 0.0 : 100.0 * static_cast<double>(part) / static_cast<double>(whole);
+    };
+
+    Vector<u32> function_order;
+    function_order.ensure_capacity(m_functions.size());
+    for (u32 i = 0; i < m_functions.size(); ++i)
+        function_order.unchecked_append(i);
+    quick_sort(function_order, [&](u32 a, u32 b) {
+        auto const& lhs = m_functions[a];
+        auto const& rhs = m_functions[b];
+        if (lhs.self_sample_count != rhs.self_sample_count)
+            return lhs.self_sample_count > rhs.self_sample_count;
+        return lhs.instruction_count > rhs.instruction_count;
+    });
+
+    StringBuilder builder;
+    builder.appendff("{} instructions, {} samples over {}ms\n", total_instructions, total_samples, (end_time - m_start_time).to_milliseconds());
+    builder.appendff("{:>8} {:>8} {:>14} {:>8}  function\n", "samples", "self %", "instructions", "insn %");
+
+    for (size_t i = 0; i < min(function_order.size(), max_function_count); ++i) {
+        auto const& function = m_functions[function_order[i]];
+        builder.appendff("{:>8} {:>7.2}% {:>14} {:>7.2}%  {}\n",
+            function.self_sample_count,
+            percentage(function.self_sample_count, total_samples),
+            function.instruction_count,
+            percentage(function.instruction_count, total_instructions),
+            function.name);
+
+        Vector<u32> offset_order;
+        for (u32 offset = 0; offset < function.offsets.size(); ++offset) {
+            if (function.offsets[offset].instruction_count != 0)
+                offset_order.append(offset);
+        }
+        quick_sort(offset_order, [&](u32 a, u32 b) {
+            auto const& lhs = function.offsets[a];
+            auto const& rhs = function.offsets[b];
+            if (lhs.sample_count != rhs.sample_count)
+                return lhs.sample_count > rhs.sample_count;
+            return lhs.instruction_count > rhs.instruction_count;
+        });
+
+        for (size_t j = 0; j < min(offset_order.size(), max_offsets_per_function); ++j) {
+            auto offset = offset_order[j];
+            auto const& profile = function.offsets[offset];
+            builder.appendff("{:>8} {:>8} {:>14} {:>8}    @{} {}\n", profile.sample_count, "", profile.instruction_count, "", offset, instruction_name(function.opcodes[offset]));
+        }
+    }
+    return builder.to_string_without_validation();
+}
+
+}
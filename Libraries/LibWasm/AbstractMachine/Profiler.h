@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibWasm/AbstractMachine/Configuration.h>
+
+namespace Wasm {
+
+// An instruction-level profiler for code running in a DebuggerBytecodeInterpreter.
+//
+// The interpreter reports every instruction it is about to execute. The profiler counts instructions exactly, per
+// function and per instruction pointer, and every so often looks at the clock; when the sampling interval has elapsed
+// it records the current wasm call stack, which is what time is attributed with.
+//
+// Functions are named from the module's "name" custom section where possible, and "func<index>" otherwise.
+// Profiles can be exported in the Chrome DevTools .cpuprofile format, as folded stacks for flamegraph.pl, or as a
+// plain text summary of the hottest functions and instructions.
+class Profiler {
+    AK_MAKE_NONCOPYABLE(Profiler);
+    AK_MAKE_NONMOVABLE(Profiler);
+
+public:
+    static constexpr AK::Duration default_sampling_interval = AK::Duration::from_milliseconds(1);
+
+    explicit Profiler(Store&, AK::Duration sampling_interval = default_sampling_interval);
+    ~Profiler();
+
+    ALWAYS_INLINE void record_instruction(Configuration const& configuration, InstructionPointer ip)
+    {
+        auto const* expression = &configuration.frame().expression();
+        if (expression != m_current_expression) [[unlikely]]
+            enter_expression(configuration, *expression);
+
+        auto& function = m_functions[m_current_function_index];
+        ++function.instruction_count;
+        if (ip.value() < function.offsets.size())
+            ++function.offsets[ip.value()].instruction_count;
+
+        if (--m_instructions_until_clock_check == 0) [[unlikely]]
+            take_sample_if_due(configuration, ip);
+    }
+
+    void stop();
+
+    size_t sample_count() const { return m_samples.size(); }
+    u64 instruction_count() const;
+
+    String to_cpuprofile_json() const;
+    String to_folded_stacks() const;
+    String to_summary(size_t max_function_count = 20, size_t max_offsets_per_function = 5) const;
+
+private:
+    static constexpr u32 instructions_between_clock_checks = 1024;
+
+    struct OffsetProfile {
+        u64 instruction_count { 0 };
+        u32 sample_count { 0 };
+    };
+
+    struct FunctionProfile {
+        ByteString name;
+        Optional<FunctionAddress> address;
+        // The opcodes of the function body, so offsets can be described after the module is gone.
+        Vector<OpCode> opcodes;
+        Vector<OffsetProfile> offsets;
+        u64 instruction_count { 0 };
+        u32 self_sample_count { 0 };
+    };
+
+    struct Node {
+        u32 function_index { 0 };
+        Optional<u32> parent_index;
+        HashMap<u32, u32> children;
+        u32 self_sample_count { 0 };
+    };
+
+    struct Sample {
+        u32 node_index { 0 };
+        MonotonicTime time;
+    };
+
+    void enter_expression(Configuration const&, Expression const&);
+    u32 function_index_for(ModuleInstance const&, Expression const&);
+    HashMap<u32, ByteString> const& function_names_for(ModuleInstance const&, Module const*);
+
+    void take_sample_if_due(Configuration const&, InstructionPointer);
+    void take_sample(Configuration const&, InstructionPointer, MonotonicTime);
+
+    Store& m_store;
+    AK::Duration m_sampling_interval;
+    u32 m_instructions_until_clock_check { instructions_between_clock_checks };
+
+    MonotonicTime m_start_time;
+    MonotonicTime m_end_time;
+    MonotonicTime m_next_sample_time;
+    bool m_stopped { false };
+
+    Expression const* m_current_expression { nullptr };
+    u32 m_current_function_index { 0 };
+
+    Vector<FunctionProfile> m_functions;
+    HashMap<Expression const*, u32> m_function_indices;
+    HashMap<ModuleInstance const*, HashMap<u32, ByteString>> m_function_names;
+
+    // Node 0 is the synthetic root of the call tree.
+    Vector<Node> m_nodes;
+    Vector<Sample> m_samples;
+};
+
+}
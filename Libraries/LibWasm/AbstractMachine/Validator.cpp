@@ -4,10 +4,17 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
 #include <AK/HashTable.h>
+#include <AK/NumericLimits.h>
 #include <AK/SourceLocation.h>
 #include <AK/TemporaryChange.h>
 #include <AK/Try.h>
+#include <LibCore/System.h>
+#include <LibThreading/BackgroundAction.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
 #include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWasm/Printer/Printer.h>
 
@@ -255,28 +262,125 @@ ErrorOr<void, ValidationError> Validator::validate(TableSection const& section)
 
 ErrorOr<void, ValidationError> Validator::validate(CodeSection const& section)
 {
-    size_t index = m_context.imported_function_count;
-    for (auto& entry : section.functions()) {
-        auto function_index = index++;
-        TRY(validate(FunctionIndex { function_index }));
-        auto& function_type = m_context.functions[function_index];
-        auto& function = entry.func();
-
-        auto function_validator = fork();
-        function_validator.m_context.locals = {};
-        function_validator.m_context.locals.extend(function_type.parameters());
-        for (auto& local : function.locals()) {
-            for (size_t i = 0; i < local.n(); ++i)
-                function_validator.m_context.locals.append(local.type());
+    auto& functions = section.functions();
+    for (size_t i = 0; i < functions.size(); ++i)
+        TRY(validate(FunctionIndex { m_context.imported_function_count + i }));
+
+    if (functions.size() >= minimum_function_count_for_parallel_validation) {
+        if (auto thread_count = Core::System::hardware_concurrency(); thread_count > 1)
+            return validate_function_bodies_in_parallel(section, thread_count);
+    }
+
+    for (size_t i = 0; i < functions.size(); ++i) {
+        FunctionIndex function_index { m_context.imported_function_count + i };
+        auto function_validator = fork_for_function(function_index, functions[i].func());
+        TRY(function_validator->validate_function_body(function_index, functions[i].func()));
+    }
+
+    return {};
+}
+
+NonnullOwnPtr<Validator> Validator::fork_for_function(FunctionIndex function_index, CodeSection::Func const& function) const
+{
+    auto function_validator = adopt_own(*new Validator { m_context });
+
+    auto& function_type = m_context.functions[function_index.value()];
+    function_validator->m_context.locals = {};
+    function_validator->m_context.locals.extend(function_type.parameters());
+    for (auto& local : function.locals()) {
+        for (size_t i = 0; i < local.n(); ++i)
+            function_validator->m_context.locals.append(local.type());
+    }
+
+    function_validator->m_frames.empend(function_type, FrameKind::Function, (size_t)0);
+    return function_validator;
+}
+
+ErrorOr<void, ValidationError> Validator::validate_function_body(FunctionIndex function_index, CodeSection::Func const& function)
+{
+    auto& function_type = m_context.functions[function_index.value()];
+    auto results = TRY(validate(function.body(), function_type.results()));
+    if (results.result_types.size() != function_type.results().size())
+        return Errors::invalid("function result"sv, function_type.results(), results.result_types);
+    return {};
+}
+
+ErrorOr<void, ValidationError> Validator::validate_function_bodies_in_parallel(CodeSection const& section, size_t thread_count)
+{
+    auto& functions = section.functions();
+
+    // The context's COWVectors are shared between all the forked validators, and their reference counts are not atomic.
+    // So all the validators are created (and destroyed) on this thread, and the worker threads only ever read the context.
+    Vector<NonnullOwnPtr<Validator>> function_validators;
+    function_validators.ensure_capacity(functions.size());
+    for (size_t i = 0; i < functions.size(); ++i)
+        function_validators.unchecked_append(fork_for_function(FunctionIndex { m_context.imported_function_count + i }, functions[i].func()));
+
+    Vector<Optional<ValidationError>> errors;
+    errors.resize(functions.size());
+
+    Atomic<size_t> next_function { 0 };
+    // Report the error in the first invalid function, as validating the functions in order would.
+    Atomic<size_t> first_invalid_function { NumericLimits<size_t>::max() };
+
+    auto validate_functions = [&] {
+        while (true) {
+            auto i = next_function.fetch_add(1, AK::memory_order_relaxed);
+            if (i >= functions.size() || i > first_invalid_function.load(AK::memory_order_relaxed))
+                return;
+
+            FunctionIndex function_index { m_context.imported_function_count + i };
+            auto result = function_validators[i]->validate_function_body(function_index, functions[i].func());
+            if (!result.is_error())
+                continue;
+
+            errors[i] = result.release_error();
+            auto current = first_invalid_function.load(AK::memory_order_relaxed);
+            while (i < current && !first_invalid_function.compare_exchange_strong(current, i, AK::memory_order_relaxed)) { }
         }
+    };
+
+    // The helpers run on the shared background threads, where they may have to wait behind other work. So this thread
+    // does its share of the work too, and once it runs out, helpers that haven't started yet are told not to bother.
+    // That way, we only ever wait for helpers that are actually validating functions.
+    struct HelperState : public AtomicRefCounted<HelperState> {
+        Threading::Mutex mutex;
+        Threading::ConditionVariable finished { mutex };
+        size_t running_helper_count { 0 };
+        bool closed { false };
+    };
+    auto helper_state = adopt_ref(*new HelperState);
+
+    for (size_t i = 1; i < min(thread_count, functions.size()); ++i) {
+        Threading::run_in_background([helper_state, validate_functions = &validate_functions] {
+            {
+                Threading::MutexLocker locker(helper_state->mutex);
+                if (helper_state->closed)
+                    return;
+                ++helper_state->running_helper_count;
+            }
 
-        function_validator.m_frames.empend(function_type, FrameKind::Function, (size_t)0);
+            (*validate_functions)();
 
-        auto results = TRY(function_validator.validate(function.body(), function_type.results()));
-        if (results.result_types.size() != function_type.results().size())
-            return Errors::invalid("function result"sv, function_type.results(), results.result_types);
+            Threading::MutexLocker locker(helper_state->mutex);
+            if (--helper_state->running_helper_count == 0)
+                helper_state->finished.signal();
+        },
+            Threading::BackgroundActionPriority::High);
     }
 
+    validate_functions();
+
+    {
+        Threading::MutexLocker locker(helper_state->mutex);
+        helper_state->closed = true;
+        while (helper_state->running_helper_count > 0)
+            helper_state->finished.wait();
+    }
+
+    if (auto index = first_invalid_function.load(); index < functions.size())
+        return errors[index].release_value();
+
     return {};
 }
 
@@ -287,6 +391,9 @@ ErrorOr<void, ValidationError> Validator::validate(TableType const& type)
 
 ErrorOr<void, ValidationError> Validator::validate(MemoryType const& type)
 {
+    // Proposal "threads", shared memories must declare a maximum size, so they never have to move when grown.
+    if (type.is_shared() && !type.limits().max().has_value())
+        return Errors::invalid("shared memory without a maximum size"sv);
     return validate(type.limits(), 1 << 16);
 }
 
@@ -3696,6 +3803,611 @@ VALIDATE_INSTRUCTION(f64x2_convert_low_i32x4_u)
     return stack.take_and_put<ValueType::V128>(ValueType::V128);
 }
 
+// Proposal "threads", atomic accesses must be naturally aligned.
+ErrorOr<void, ValidationError> Validator::validate_atomic_memory_argument(Instruction const& instruction, size_t natural_size)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+
+    TRY(validate(arg.memory_index));
+
+    if ((1ull << arg.align) != natural_size)
+        return Errors::invalid("atomic memory op alignment"sv, natural_size, 1ull << arg.align);
+
+    return {};
+}
+
+VALIDATE_INSTRUCTION(memory_atomic_notify)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(memory_atomic_wait32)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(memory_atomic_wait64)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(atomic_fence)
+{
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_load)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_load8_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_load16_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load8_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load16_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load32_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_store)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_store8)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_store16)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store8)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store16)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store32)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_add)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_add)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_add_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_add_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_add_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_add_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_add_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_sub)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_sub)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_sub_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_sub_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_sub_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_sub_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_sub_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_and)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_and)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_and_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_and_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_and_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_and_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_and_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_or)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_or)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_or_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_or_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_or_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_or_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_or_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_xor)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_xor)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_xor_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_xor_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_xor_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_xor_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_xor_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_xchg)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_xchg)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_xchg_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_xchg_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_xchg_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_xchg_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_xchg_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_cmpxchg)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_cmpxchg)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_cmpxchg_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_cmpxchg_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_cmpxchg_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_cmpxchg_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_cmpxchg_u)
+{
+    TRY(validate_atomic_memory_argument(instruction, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I64, ValueType::I32>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
 ErrorOr<void, ValidationError> Validator::validate(Instruction const& instruction, Stack& stack, bool& is_constant)
 {
     switch (instruction.opcode().value()) {
@@ -8,6 +8,7 @@
 
 #include <AK/COWVector.h>
 #include <AK/Debug.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/RedBlackTree.h>
 #include <AK/SourceLocation.h>
 #include <AK/Tuple.h>
@@ -268,6 +269,7 @@ public:
     ErrorOr<void, ValidationError> validate(Instruction const& instruction, Stack& stack, bool& is_constant);
     template<u64 opcode>
     ErrorOr<void, ValidationError> validate_instruction(Instruction const&, Stack& stack, bool& is_constant);
+    ErrorOr<void, ValidationError> validate_atomic_memory_argument(Instruction const&, size_t natural_size);
 
     // Types
     ErrorOr<void, ValidationError> validate(Limits const&, u64 bound); // n <= bound && m? <= bound
@@ -283,6 +285,13 @@ private:
     {
     }
 
+    // Code sections with at least this many functions have their function bodies validated on multiple threads.
+    static constexpr size_t minimum_function_count_for_parallel_validation = 64;
+
+    NonnullOwnPtr<Validator> fork_for_function(FunctionIndex, CodeSection::Func const&) const;
+    ErrorOr<void, ValidationError> validate_function_body(FunctionIndex, CodeSection::Func const&);
+    ErrorOr<void, ValidationError> validate_function_bodies_in_parallel(CodeSection const&, size_t thread_count);
+
     struct Errors {
         static ValidationError invalid(StringView name) { return ByteString::formatted("Invalid {}", name); }
 
@@ -43,6 +43,7 @@ static constexpr auto minimum_stack_space_to_keep_free = 256 * KiB; // Note: Val
 static constexpr auto max_allowed_executed_instructions_per_call = 256 * 1024 * 1024;
 static constexpr auto max_allowed_vector_size = 500 * MiB;
 static constexpr auto max_allowed_function_locals_per_type = 42069; // Note: VERY arbitrary.
+static constexpr auto max_reserved_memory_size = 4 * GiB - page_size; // Note: memory.grow can never reach 2^16 pages.
 
 // Messages used by the host
 static constexpr auto stack_exhaustion_message = "STACK-EXHAUSTION"sv;
@@ -454,14 +454,99 @@ namespace Instructions {
     M(i32x4_trunc_sat_f64x2_s_zero, 0xfd000000000000fcull)  \
     M(i32x4_trunc_sat_f64x2_u_zero, 0xfd000000000000fdull)  \
     M(f64x2_convert_low_i32x4_s, 0xfd000000000000feull)     \
-    M(f64x2_convert_low_i32x4_u, 0xfd000000000000ffull)
+    M(f64x2_convert_low_i32x4_u, 0xfd000000000000ffull)     \
+    M(memory_atomic_notify, 0xfe00000000000000ull)          \
+    M(memory_atomic_wait32, 0xfe00000000000001ull)          \
+    M(memory_atomic_wait64, 0xfe00000000000002ull)          \
+    M(atomic_fence, 0xfe00000000000003ull)                  \
+    M(i32_atomic_load, 0xfe00000000000010ull)               \
+    M(i64_atomic_load, 0xfe00000000000011ull)               \
+    M(i32_atomic_load8_u, 0xfe00000000000012ull)            \
+    M(i32_atomic_load16_u, 0xfe00000000000013ull)           \
+    M(i64_atomic_load8_u, 0xfe00000000000014ull)            \
+    M(i64_atomic_load16_u, 0xfe00000000000015ull)           \
+    M(i64_atomic_load32_u, 0xfe00000000000016ull)           \
+    M(i32_atomic_store, 0xfe00000000000017ull)              \
+    M(i64_atomic_store, 0xfe00000000000018ull)              \
+    M(i32_atomic_store8, 0xfe00000000000019ull)             \
+    M(i32_atomic_store16, 0xfe0000000000001aull)            \
+    M(i64_atomic_store8, 0xfe0000000000001bull)             \
+    M(i64_atomic_store16, 0xfe0000000000001cull)            \
+    M(i64_atomic_store32, 0xfe0000000000001dull)            \
+    M(i32_atomic_rmw_add, 0xfe0000000000001eull)            \
+    M(i64_atomic_rmw_add, 0xfe0000000000001full)            \
+    M(i32_atomic_rmw8_add_u, 0xfe00000000000020ull)         \
+    M(i32_atomic_rmw16_add_u, 0xfe00000000000021ull)        \
+    M(i64_atomic_rmw8_add_u, 0xfe00000000000022ull)         \
+    M(i64_atomic_rmw16_add_u, 0xfe00000000000023ull)        \
+    M(i64_atomic_rmw32_add_u, 0xfe00000000000024ull)        \
+    M(i32_atomic_rmw_sub, 0xfe00000000000025ull)            \
+    M(i64_atomic_rmw_sub, 0xfe00000000000026ull)            \
+    M(i32_atomic_rmw8_sub_u, 0xfe00000000000027ull)         \
+    M(i32_atomic_rmw16_sub_u, 0xfe00000000000028ull)        \
+    M(i64_atomic_rmw8_sub_u, 0xfe00000000000029ull)         \
+    M(i64_atomic_rmw16_sub_u, 0xfe0000000000002aull)        \
+    M(i64_atomic_rmw32_sub_u, 0xfe0000000000002bull)        \
+    M(i32_atomic_rmw_and, 0xfe0000000000002cull)            \
+    M(i64_atomic_rmw_and, 0xfe0000000000002dull)            \
+    M(i32_atomic_rmw8_and_u, 0xfe0000000000002eull)         \
+    M(i32_atomic_rmw16_and_u, 0xfe0000000000002full)        \
+    M(i64_atomic_rmw8_and_u, 0xfe00000000000030ull)         \
+    M(i64_atomic_rmw16_and_u, 0xfe00000000000031ull)        \
+    M(i64_atomic_rmw32_and_u, 0xfe00000000000032ull)        \
+    M(i32_atomic_rmw_or, 0xfe00000000000033ull)             \
+    M(i64_atomic_rmw_or, 0xfe00000000000034ull)             \
+    M(i32_atomic_rmw8_or_u, 0xfe00000000000035ull)          \
+    M(i32_atomic_rmw16_or_u, 0xfe00000000000036ull)         \
+    M(i64_atomic_rmw8_or_u, 0xfe00000000000037ull)          \
+    M(i64_atomic_rmw16_or_u, 0xfe00000000000038ull)         \
+    M(i64_atomic_rmw32_or_u, 0xfe00000000000039ull)         \
+    M(i32_atomic_rmw_xor, 0xfe0000000000003aull)            \
+    M(i64_atomic_rmw_xor, 0xfe0000000000003bull)            \
+    M(i32_atomic_rmw8_xor_u, 0xfe0000000000003cull)         \
+    M(i32_atomic_rmw16_xor_u, 0xfe0000000000003dull)        \
+    M(i64_atomic_rmw8_xor_u, 0xfe0000000000003eull)         \
+    M(i64_atomic_rmw16_xor_u, 0xfe0000000000003full)        \
+    M(i64_atomic_rmw32_xor_u, 0xfe00000000000040ull)        \
+    M(i32_atomic_rmw_xchg, 0xfe00000000000041ull)           \
+    M(i64_atomic_rmw_xchg, 0xfe00000000000042ull)           \
+    M(i32_atomic_rmw8_xchg_u, 0xfe00000000000043ull)        \
+    M(i32_atomic_rmw16_xchg_u, 0xfe00000000000044ull)       \
+    M(i64_atomic_rmw8_xchg_u, 0xfe00000000000045ull)        \
+    M(i64_atomic_rmw16_xchg_u, 0xfe00000000000046ull)       \
+    M(i64_atomic_rmw32_xchg_u, 0xfe00000000000047ull)       \
+    M(i32_atomic_rmw_cmpxchg, 0xfe00000000000048ull)        \
+    M(i64_atomic_rmw_cmpxchg, 0xfe00000000000049ull)        \
+    M(i32_atomic_rmw8_cmpxchg_u, 0xfe0000000000004aull)     \
+    M(i32_atomic_rmw16_cmpxchg_u, 0xfe0000000000004bull)    \
+    M(i64_atomic_rmw8_cmpxchg_u, 0xfe0000000000004cull)     \
+    M(i64_atomic_rmw16_cmpxchg_u, 0xfe0000000000004dull)    \
+    M(i64_atomic_rmw32_cmpxchg_u, 0xfe0000000000004eull)
 
 #define ENUMERATE_WASM_OPCODES(M)         \
     ENUMERATE_SINGLE_BYTE_WASM_OPCODES(M) \
     ENUMERATE_MULTI_BYTE_WASM_OPCODES(M)
 
+// These are superinstructions that the bytecode interpreter fuses common instruction sequences into, see
+// BytecodeInterpreter::compile(). They never appear in a module, and are not part of ENUMERATE_WASM_OPCODES.
+#define ENUMERATE_SYNTHETIC_WASM_OPCODES(M)                \
+    M(synthetic_i32_add2local, 0xff00000000000000ull)      \
+    M(synthetic_i32_sub2local, 0xff00000000000001ull)      \
+    M(synthetic_i32_addconstlocal, 0xff00000000000002ull)  \
+    M(synthetic_i32_andconstlocal, 0xff00000000000003ull)  \
+    M(synthetic_local_seti32_const, 0xff00000000000004ull) \
+    M(synthetic_local_copy, 0xff00000000000005ull)         \
+    M(synthetic_br_if_i32_eqz, 0xff00000000000006ull)      \
+    M(synthetic_br_if_i32_eq, 0xff00000000000007ull)       \
+    M(synthetic_br_if_i32_ne, 0xff00000000000008ull)       \
+    M(synthetic_br_if_i32_lts, 0xff00000000000009ull)      \
+    M(synthetic_br_if_i32_ltu, 0xff0000000000000aull)      \
+    M(synthetic_br_if_i32_ges, 0xff0000000000000bull)      \
+    M(synthetic_br_if_i32_geu, 0xff0000000000000cull)
+
 #define M(name, value) static constexpr OpCode name = value;
 ENUMERATE_WASM_OPCODES(M)
+ENUMERATE_SYNTHETIC_WASM_OPCODES(M)
 #undef M
 
 }
@@ -146,21 +146,15 @@ ParseResult<FunctionType> FunctionType::parse(Stream& stream)
     return FunctionType { parameters_result, results_result };
 }
 
-ParseResult<Limits> Limits::parse(Stream& stream)
+static ParseResult<Limits> parse_limits_bounds(Stream& stream, bool has_maximum)
 {
-    ScopeLogger<WASM_BINPARSER_DEBUG> logger("Limits"sv);
-    auto flag = TRY_READ(stream, u8, ParseError::ExpectedKindTag);
-
-    if (flag > 1)
-        return with_eof_check(stream, ParseError::InvalidTag);
-
     auto min_or_error = stream.read_value<LEB128<u32>>();
     if (min_or_error.is_error())
         return with_eof_check(stream, ParseError::ExpectedSize);
     size_t min = min_or_error.release_value();
 
     Optional<u32> max;
-    if (flag) {
+    if (has_maximum) {
         auto value_or_error = stream.read_value<LEB128<u32>>();
         if (value_or_error.is_error())
             return with_eof_check(stream, ParseError::ExpectedSize);
@@ -170,11 +164,28 @@ ParseResult<Limits> Limits::parse(Stream& stream)
     return Limits { static_cast<u32>(min), move(max) };
 }
 
+ParseResult<Limits> Limits::parse(Stream& stream)
+{
+    ScopeLogger<WASM_BINPARSER_DEBUG> logger("Limits"sv);
+    auto flag = TRY_READ(stream, u8, ParseError::ExpectedKindTag);
+
+    if (flag > 1)
+        return with_eof_check(stream, ParseError::InvalidTag);
+
+    return parse_limits_bounds(stream, flag == 1);
+}
+
 ParseResult<MemoryType> MemoryType::parse(Stream& stream)
 {
     ScopeLogger<WASM_BINPARSER_DEBUG> logger("MemoryType"sv);
-    auto limits_result = TRY(Limits::parse(stream));
-    return MemoryType { limits_result };
+    auto flag = TRY_READ(stream, u8, ParseError::ExpectedKindTag);
+
+    // Proposal "threads", bit 1 of the limits flag marks the memory as shared.
+    if (flag > 3)
+        return with_eof_check(stream, ParseError::InvalidTag);
+
+    auto limits_result = TRY(parse_limits_bounds(stream, (flag & 1) != 0));
+    return MemoryType { limits_result, (flag & 2) != 0 ? MemoryType::Shared::Yes : MemoryType::Shared::No };
 }
 
 ParseResult<TableType> TableType::parse(Stream& stream)
@@ -505,7 +516,8 @@ ParseResult<Instruction> Instruction::parse(Stream& stream)
     case Instructions::i64_extend32_s.value():
         return Instruction { opcode };
     case 0xfc:
-    case 0xfd: {
+    case 0xfd:
+    case 0xfe: {
         // These are multibyte instructions.
         auto selector = TRY_READ(stream, LEB128<u32>, ParseError::InvalidInput);
         OpCode full_opcode = static_cast<u64>(opcode.value()) << 56 | selector;
@@ -850,6 +862,93 @@ ParseResult<Instruction> Instruction::parse(Stream& stream)
         case Instructions::f64x2_convert_low_i32x4_u.value():
             // op
             return Instruction { full_opcode };
+        case Instructions::memory_atomic_notify.value():
+        case Instructions::memory_atomic_wait32.value():
+        case Instructions::memory_atomic_wait64.value():
+        case Instructions::i32_atomic_load.value():
+        case Instructions::i64_atomic_load.value():
+        case Instructions::i32_atomic_load8_u.value():
+        case Instructions::i32_atomic_load16_u.value():
+        case Instructions::i64_atomic_load8_u.value():
+        case Instructions::i64_atomic_load16_u.value():
+        case Instructions::i64_atomic_load32_u.value():
+        case Instructions::i32_atomic_store.value():
+        case Instructions::i64_atomic_store.value():
+        case Instructions::i32_atomic_store8.value():
+        case Instructions::i32_atomic_store16.value():
+        case Instructions::i64_atomic_store8.value():
+        case Instructions::i64_atomic_store16.value():
+        case Instructions::i64_atomic_store32.value():
+        case Instructions::i32_atomic_rmw_add.value():
+        case Instructions::i64_atomic_rmw_add.value():
+        case Instructions::i32_atomic_rmw8_add_u.value():
+        case Instructions::i32_atomic_rmw16_add_u.value():
+        case Instructions::i64_atomic_rmw8_add_u.value():
+        case Instructions::i64_atomic_rmw16_add_u.value():
+        case Instructions::i64_atomic_rmw32_add_u.value():
+        case Instructions::i32_atomic_rmw_sub.value():
+        case Instructions::i64_atomic_rmw_sub.value():
+        case Instructions::i32_atomic_rmw8_sub_u.value():
+        case Instructions::i32_atomic_rmw16_sub_u.value():
+        case Instructions::i64_atomic_rmw8_sub_u.value():
+        case Instructions::i64_atomic_rmw16_sub_u.value():
+        case Instructions::i64_atomic_rmw32_sub_u.value():
+        case Instructions::i32_atomic_rmw_and.value():
+        case Instructions::i64_atomic_rmw_and.value():
+        case Instructions::i32_atomic_rmw8_and_u.value():
+        case Instructions::i32_atomic_rmw16_and_u.value():
+        case Instructions::i64_atomic_rmw8_and_u.value():
+        case Instructions::i64_atomic_rmw16_and_u.value():
+        case Instructions::i64_atomic_rmw32_and_u.value():
+        case Instructions::i32_atomic_rmw_or.value():
+        case Instructions::i64_atomic_rmw_or.value():
+        case Instructions::i32_atomic_rmw8_or_u.value():
+        case Instructions::i32_atomic_rmw16_or_u.value():
+        case Instructions::i64_atomic_rmw8_or_u.value():
+        case Instructions::i64_atomic_rmw16_or_u.value():
+        case Instructions::i64_atomic_rmw32_or_u.value():
+        case Instructions::i32_atomic_rmw_xor.value():
+        case Instructions::i64_atomic_rmw_xor.value():
+        case Instructions::i32_atomic_rmw8_xor_u.value():
+        case Instructions::i32_atomic_rmw16_xor_u.value():
+        case Instructions::i64_atomic_rmw8_xor_u.value():
+        case Instructions::i64_atomic_rmw16_xor_u.value():
+        case Instructions::i64_atomic_rmw32_xor_u.value():
+        case Instructions::i32_atomic_rmw_xchg.value():
+        case Instructions::i64_atomic_rmw_xchg.value():
+        case Instructions::i32_atomic_rmw8_xchg_u.value():
+        case Instructions::i32_atomic_rmw16_xchg_u.value():
+        case Instructions::i64_atomic_rmw8_xchg_u.value():
+        case Instructions::i64_atomic_rmw16_xchg_u.value():
+        case Instructions::i64_atomic_rmw32_xchg_u.value():
+        case Instructions::i32_atomic_rmw_cmpxchg.value():
+        case Instructions::i64_atomic_rmw_cmpxchg.value():
+        case Instructions::i32_atomic_rmw8_cmpxchg_u.value():
+        case Instructions::i32_atomic_rmw16_cmpxchg_u.value():
+        case Instructions::i64_atomic_rmw8_cmpxchg_u.value():
+        case Instructions::i64_atomic_rmw16_cmpxchg_u.value():
+        case Instructions::i64_atomic_rmw32_cmpxchg_u.value(): {
+            // Proposal "threads": op (align [multi-memory: memindex] offset)
+            u32 align = TRY_READ(stream, LEB128<u32>, ParseError::InvalidInput);
+
+            // Proposal "multi-memory", if bit 6 of alignment is set, then a memory index follows the alignment.
+            auto memory_index = 0;
+            if ((align & 0x40) != 0) {
+                align &= ~0x40;
+                memory_index = TRY_READ(stream, LEB128<u32>, ParseError::InvalidInput);
+            }
+
+            auto offset = TRY_READ(stream, LEB128<u32>, ParseError::InvalidInput);
+
+            return Instruction { full_opcode, MemoryArgument { align, offset, MemoryIndex(memory_index) } };
+        }
+        case Instructions::atomic_fence.value(): {
+            // Proposal "threads": op 0x00
+            auto reserved = TRY_READ(stream, u8, ParseError::InvalidInput);
+            if (reserved != 0)
+                return ParseError::InvalidInput;
+            return Instruction { full_opcode };
+        }
         default:
             return ParseError::UnknownInstruction;
         }
@@ -1247,6 +1346,71 @@ ParseResult<SectionId> SectionId::parse(Stream& stream)
     }
 }
 
+static ParseResult<void> parse_section_contents(Module& module, SectionId::SectionIdKind kind, Stream& section_stream)
+{
+    switch (kind) {
+    case SectionId::SectionIdKind::Custom:
+        module.custom_sections().append(TRY(CustomSection::parse(section_stream)));
+        break;
+    case SectionId::SectionIdKind::Type:
+        module.type_section() = TRY(TypeSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Import:
+        module.import_section() = TRY(ImportSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Function:
+        module.function_section() = TRY(FunctionSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Table:
+        module.table_section() = TRY(TableSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Memory:
+        module.memory_section() = TRY(MemorySection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Global:
+        module.global_section() = TRY(GlobalSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Export:
+        module.export_section() = TRY(ExportSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Start:
+        module.start_section() = TRY(StartSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Element:
+        module.element_section() = TRY(ElementSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Code:
+        module.code_section() = TRY(CodeSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Data:
+        module.data_section() = TRY(DataSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::DataCount:
+        module.data_count_section() = TRY(DataCountSection::parse(section_stream));
+        break;
+    default:
+        return ParseError::InvalidIndex;
+    }
+    return {};
+}
+
+static ParseResult<void> check_section_is_not_duplicate(SectionId::SectionIdKind kind, SectionId::SectionIdKind last_section_id)
+{
+    if (kind != SectionId::SectionIdKind::Custom && kind == last_section_id)
+        return ParseError::DuplicateSection;
+    return {};
+}
+
+static ParseResult<void> update_last_section_id(SectionId::SectionIdKind kind, SectionId::SectionIdKind& last_section_id)
+{
+    if (kind != SectionId::SectionIdKind::Custom) {
+        if (kind < last_section_id)
+            return ParseError::SectionOutOfOrder;
+        last_section_id = kind;
+    }
+    return {};
+}
+
 ParseResult<NonnullRefPtr<Module>> Module::parse(Stream& stream)
 {
     ScopeLogger<WASM_BINPARSER_DEBUG> logger("Module"sv);
@@ -1270,62 +1434,186 @@ ParseResult<NonnullRefPtr<Module>> Module::parse(Stream& stream)
         size_t section_size = TRY_READ(stream, LEB128<u32>, ParseError::ExpectedSize);
         auto section_stream = ConstrainedStream { MaybeOwned<Stream>(stream), section_size };
 
-        if (section_id.kind() != SectionId::SectionIdKind::Custom && section_id.kind() == last_section_id)
-            return ParseError::DuplicateSection;
+        TRY(check_section_is_not_duplicate(section_id.kind(), last_section_id));
+        TRY(parse_section_contents(module, section_id.kind(), section_stream));
+        TRY(update_last_section_id(section_id.kind(), last_section_id));
+        if (section_stream.remaining() != 0)
+            return ParseError::SectionSizeMismatch;
+    }
 
-        switch (section_id.kind()) {
-        case SectionId::SectionIdKind::Custom:
-            module.custom_sections().append(TRY(CustomSection::parse(section_stream)));
-            break;
-        case SectionId::SectionIdKind::Type:
-            module.type_section() = TRY(TypeSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Import:
-            module.import_section() = TRY(ImportSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Function:
-            module.function_section() = TRY(FunctionSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Table:
-            module.table_section() = TRY(TableSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Memory:
-            module.memory_section() = TRY(MemorySection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Global:
-            module.global_section() = TRY(GlobalSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Export:
-            module.export_section() = TRY(ExportSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Start:
-            module.start_section() = TRY(StartSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Element:
-            module.element_section() = TRY(ElementSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Code:
-            module.code_section() = TRY(CodeSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Data:
-            module.data_section() = TRY(DataSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::DataCount:
-            module.data_count_section() = TRY(DataCountSection::parse(section_stream));
+    return module_ptr;
+}
+
+// Returns the length of the LEB128-encoded u32 at the start of `bytes`, or nothing if it's cut off.
+static ParseResult<Optional<size_t>> length_of_leb128_u32(ReadonlyBytes bytes, ParseError error)
+{
+    // A u32 takes at most ceil(32 / 7) = 5 bytes.
+    static constexpr size_t max_length = 5;
+    for (size_t i = 0; i < min(bytes.size(), max_length); ++i) {
+        if ((bytes[i] & 0x80) == 0)
+            return i + 1;
+    }
+    if (bytes.size() >= max_length)
+        return error;
+    return OptionalNone {};
+}
+
+StreamingModuleParser::StreamingModuleParser()
+    : m_module(make_ref_counted<Module>())
+{
+}
+
+ParseResult<void> StreamingModuleParser::append(ReadonlyBytes bytes)
+{
+    if (m_error.has_value())
+        return *m_error;
+
+    if (m_buffer.try_append(bytes).is_error()) {
+        m_error = ParseError::OutOfMemory;
+        return *m_error;
+    }
+
+    while (true) {
+        auto made_progress = parse_next();
+        if (made_progress.is_error()) {
+            m_error = made_progress.error();
+            m_buffer.clear();
+            return *m_error;
+        }
+        if (!made_progress.value())
             break;
-        default:
-            return ParseError::InvalidIndex;
+    }
+
+    // Drop everything we've parsed so far; large sections are only ever copied once they've been fully parsed.
+    if (m_consumed != 0) {
+        auto remaining = m_buffer.bytes().slice(m_consumed);
+        auto buffer = ByteBuffer::copy(remaining);
+        if (buffer.is_error()) {
+            m_error = ParseError::OutOfMemory;
+            return *m_error;
+        }
+        m_buffer = buffer.release_value();
+        m_consumed = 0;
+    }
+
+    return {};
+}
+
+ParseResult<bool> StreamingModuleParser::parse_next()
+{
+    auto available = m_buffer.bytes().slice(m_consumed);
+
+    switch (m_state) {
+    case State::Header: {
+        auto header_size = Module::wasm_magic.size() + Module::wasm_version.size();
+        if (available.size() < header_size)
+            return false;
+        if (available.slice(0, Module::wasm_magic.size()) != Module::wasm_magic.span())
+            return ParseError::InvalidModuleMagic;
+        if (available.slice(Module::wasm_magic.size(), Module::wasm_version.size()) != Module::wasm_version.span())
+            return ParseError::InvalidModuleVersion;
+        m_consumed += header_size;
+        m_state = State::SectionHeader;
+        return true;
+    }
+    case State::SectionHeader: {
+        if (available.size() < 2)
+            return false;
+        auto size_length = TRY(length_of_leb128_u32(available.slice(1), ParseError::ExpectedSize));
+        if (!size_length.has_value())
+            return false;
+
+        FixedMemoryStream stream { available.slice(0, 1 + *size_length) };
+        m_section_kind = TRY(SectionId::parse(stream)).kind();
+        m_section_size = TRY_READ(stream, LEB128<u32>, ParseError::ExpectedSize);
+        m_consumed += 1 + *size_length;
+
+        TRY(check_section_is_not_duplicate(m_section_kind, m_last_section_id));
+        if (m_section_kind == SectionId::SectionIdKind::Code) {
+            TRY(update_last_section_id(m_section_kind, m_last_section_id));
+            m_state = State::CodeCount;
+        } else {
+            m_state = State::SectionContents;
         }
-        if (section_id.kind() != SectionId::SectionIdKind::Custom) {
-            if (section_id.kind() < last_section_id)
-                return ParseError::SectionOutOfOrder;
-            last_section_id = section_id.kind();
+        return true;
+    }
+    case State::SectionContents: {
+        if (available.size() < m_section_size)
+            return false;
+
+        FixedMemoryStream stream { available.slice(0, m_section_size) };
+        TRY(parse_section_contents(*m_module, m_section_kind, stream));
+        TRY(update_last_section_id(m_section_kind, m_last_section_id));
+        if (!stream.is_eof())
+            return ParseError::SectionSizeMismatch;
+
+        m_consumed += m_section_size;
+        m_state = State::SectionHeader;
+        return true;
+    }
+    case State::CodeCount: {
+        auto count_length = TRY(length_of_leb128_u32(available, ParseError::ExpectedSize));
+        if (!count_length.has_value())
+            return false;
+        if (*count_length > m_section_size)
+            return ParseError::SectionSizeMismatch;
+
+        FixedMemoryStream stream { available.slice(0, *count_length) };
+        m_remaining_code_entries = TRY_READ(stream, LEB128<u32>, ParseError::ExpectedSize);
+        m_consumed += *count_length;
+        m_section_size -= *count_length;
+        m_state = State::CodeEntry;
+        return true;
+    }
+    case State::CodeEntry: {
+        if (m_remaining_code_entries == 0) {
+            if (m_section_size != 0)
+                return ParseError::SectionSizeMismatch;
+            m_module->code_section() = CodeSection { move(m_code_entries) };
+            m_code_entries = {};
+            m_state = State::SectionHeader;
+            return true;
         }
-        if (section_stream.remaining() != 0)
+
+        auto size_length = TRY(length_of_leb128_u32(available, ParseError::InvalidSize));
+        if (!size_length.has_value())
+            return false;
+
+        FixedMemoryStream size_stream { available.slice(0, *size_length) };
+        size_t body_size = TRY_READ(size_stream, LEB128<u32>, ParseError::InvalidSize);
+        auto entry_size = *size_length + body_size;
+        if (entry_size > m_section_size)
+            return ParseError::SectionSizeMismatch;
+        if (available.size() < entry_size)
+            return false;
+
+        FixedMemoryStream stream { available.slice(0, entry_size) };
+        auto code = TRY(CodeSection::Code::parse(stream));
+        if (!stream.is_eof())
             return ParseError::SectionSizeMismatch;
+        if (m_code_entries.try_append(move(code)).is_error())
+            return ParseError::OutOfMemory;
+
+        m_consumed += entry_size;
+        m_section_size -= entry_size;
+        --m_remaining_code_entries;
+        return true;
+    }
     }
+    VERIFY_NOT_REACHED();
+}
 
-    return module_ptr;
+ParseResult<NonnullRefPtr<Module>> StreamingModuleParser::finish()
+{
+    if (m_error.has_value())
+        return *m_error;
+
+    if (m_state != State::SectionHeader || m_consumed != m_buffer.size()) {
+        m_error = ParseError::UnexpectedEof;
+        return *m_error;
+    }
+
+    return m_module;
 }
 
 ByteString parse_error_to_byte_string(ParseError error)
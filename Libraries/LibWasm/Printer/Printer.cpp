@@ -16,9 +16,12 @@ struct Names {
     static HashMap<ByteString, OpCode> instructions_by_name;
 };
 
-ByteString instruction_name(OpCode const& opcode)
+StringView instruction_name(OpCode const& opcode)
 {
-    return Names::instruction_names.get(opcode).value_or("<unknown>");
+    auto it = Names::instruction_names.find(opcode);
+    if (it == Names::instruction_names.end())
+        return "<unknown>"sv;
+    return it->value.view();
 }
 
 Optional<OpCode> instruction_from_name(StringView name)
@@ -1139,7 +1142,87 @@ HashMap<Wasm::OpCode, ByteString> Wasm::Names::instruction_names {
     { Instructions::i32x4_trunc_sat_f64x2_u_zero, "i32x4.trunc_sat_f64x2_u_zero" },
     { Instructions::f64x2_convert_low_i32x4_s, "f64x2.convert_low_i32x4_s" },
     { Instructions::f64x2_convert_low_i32x4_u, "f64x2.convert_low_i32x4_u" },
+    { Instructions::memory_atomic_notify, "memory.atomic.notify" },
+    { Instructions::memory_atomic_wait32, "memory.atomic.wait32" },
+    { Instructions::memory_atomic_wait64, "memory.atomic.wait64" },
+    { Instructions::atomic_fence, "atomic.fence" },
+    { Instructions::i32_atomic_load, "i32.atomic.load" },
+    { Instructions::i64_atomic_load, "i64.atomic.load" },
+    { Instructions::i32_atomic_load8_u, "i32.atomic.load8_u" },
+    { Instructions::i32_atomic_load16_u, "i32.atomic.load16_u" },
+    { Instructions::i64_atomic_load8_u, "i64.atomic.load8_u" },
+    { Instructions::i64_atomic_load16_u, "i64.atomic.load16_u" },
+    { Instructions::i64_atomic_load32_u, "i64.atomic.load32_u" },
+    { Instructions::i32_atomic_store, "i32.atomic.store" },
+    { Instructions::i64_atomic_store, "i64.atomic.store" },
+    { Instructions::i32_atomic_store8, "i32.atomic.store8" },
+    { Instructions::i32_atomic_store16, "i32.atomic.store16" },
+    { Instructions::i64_atomic_store8, "i64.atomic.store8" },
+    { Instructions::i64_atomic_store16, "i64.atomic.store16" },
+    { Instructions::i64_atomic_store32, "i64.atomic.store32" },
+    { Instructions::i32_atomic_rmw_add, "i32.atomic.rmw.add" },
+    { Instructions::i64_atomic_rmw_add, "i64.atomic.rmw.add" },
+    { Instructions::i32_atomic_rmw8_add_u, "i32.atomic.rmw8.add_u" },
+    { Instructions::i32_atomic_rmw16_add_u, "i32.atomic.rmw16.add_u" },
+    { Instructions::i64_atomic_rmw8_add_u, "i64.atomic.rmw8.add_u" },
+    { Instructions::i64_atomic_rmw16_add_u, "i64.atomic.rmw16.add_u" },
+    { Instructions::i64_atomic_rmw32_add_u, "i64.atomic.rmw32.add_u" },
+    { Instructions::i32_atomic_rmw_sub, "i32.atomic.rmw.sub" },
+    { Instructions::i64_atomic_rmw_sub, "i64.atomic.rmw.sub" },
+    { Instructions::i32_atomic_rmw8_sub_u, "i32.atomic.rmw8.sub_u" },
+    { Instructions::i32_atomic_rmw16_sub_u, "i32.atomic.rmw16.sub_u" },
+    { Instructions::i64_atomic_rmw8_sub_u, "i64.atomic.rmw8.sub_u" },
+    { Instructions::i64_atomic_rmw16_sub_u, "i64.atomic.rmw16.sub_u" },
+    { Instructions::i64_atomic_rmw32_sub_u, "i64.atomic.rmw32.sub_u" },
+    { Instructions::i32_atomic_rmw_and, "i32.atomic.rmw.and" },
+    { Instructions::i64_atomic_rmw_and, "i64.atomic.rmw.and" },
+    { Instructions::i32_atomic_rmw8_and_u, "i32.atomic.rmw8.and_u" },
+    { Instructions::i32_atomic_rmw16_and_u, "i32.atomic.rmw16.and_u" },
+    { Instructions::i64_atomic_rmw8_and_u, "i64.atomic.rmw8.and_u" },
+    { Instructions::i64_atomic_rmw16_and_u, "i64.atomic.rmw16.and_u" },
+    { Instructions::i64_atomic_rmw32_and_u, "i64.atomic.rmw32.and_u" },
+    { Instructions::i32_atomic_rmw_or, "i32.atomic.rmw.or" },
+    { Instructions::i64_atomic_rmw_or, "i64.atomic.rmw.or" },
+    { Instructions::i32_atomic_rmw8_or_u, "i32.atomic.rmw8.or_u" },
+    { Instructions::i32_atomic_rmw16_or_u, "i32.atomic.rmw16.or_u" },
+    { Instructions::i64_atomic_rmw8_or_u, "i64.atomic.rmw8.or_u" },
+    { Instructions::i64_atomic_rmw16_or_u, "i64.atomic.rmw16.or_u" },
+    { Instructions::i64_atomic_rmw32_or_u, "i64.atomic.rmw32.or_u" },
+    { Instructions::i32_atomic_rmw_xor, "i32.atomic.rmw.xor" },
+    { Instructions::i64_atomic_rmw_xor, "i64.atomic.rmw.xor" },
+    { Instructions::i32_atomic_rmw8_xor_u, "i32.atomic.rmw8.xor_u" },
+    { Instructions::i32_atomic_rmw16_xor_u, "i32.atomic.rmw16.xor_u" },
+    { Instructions::i64_atomic_rmw8_xor_u, "i64.atomic.rmw8.xor_u" },
+    { Instructions::i64_atomic_rmw16_xor_u, "i64.atomic.rmw16.xor_u" },
+    { Instructions::i64_atomic_rmw32_xor_u, "i64.atomic.rmw32.xor_u" },
+    { Instructions::i32_atomic_rmw_xchg, "i32.atomic.rmw.xchg" },
+    { Instructions::i64_atomic_rmw_xchg, "i64.atomic.rmw.xchg" },
+    { Instructions::i32_atomic_rmw8_xchg_u, "i32.atomic.rmw8.xchg_u" },
+    { Instructions::i32_atomic_rmw16_xchg_u, "i32.atomic.rmw16.xchg_u" },
+    { Instructions::i64_atomic_rmw8_xchg_u, "i64.atomic.rmw8.xchg_u" },
+    { Instructions::i64_atomic_rmw16_xchg_u, "i64.atomic.rmw16.xchg_u" },
+    { Instructions::i64_atomic_rmw32_xchg_u, "i64.atomic.rmw32.xchg_u" },
+    { Instructions::i32_atomic_rmw_cmpxchg, "i32.atomic.rmw.cmpxchg" },
+    { Instructions::i64_atomic_rmw_cmpxchg, "i64.atomic.rmw.cmpxchg" },
+    { Instructions::i32_atomic_rmw8_cmpxchg_u, "i32.atomic.rmw8.cmpxchg_u" },
+    { Instructions::i32_atomic_rmw16_cmpxchg_u, "i32.atomic.rmw16.cmpxchg_u" },
+    { Instructions::i64_atomic_rmw8_cmpxchg_u, "i64.atomic.rmw8.cmpxchg_u" },
+    { Instructions::i64_atomic_rmw16_cmpxchg_u, "i64.atomic.rmw16.cmpxchg_u" },
+    { Instructions::i64_atomic_rmw32_cmpxchg_u, "i64.atomic.rmw32.cmpxchg_u" },
     { Instructions::structured_else, "synthetic:else" },
     { Instructions::structured_end, "synthetic:end" },
+    { Instructions::synthetic_i32_add2local, "synthetic:i32.add2local" },
+    { Instructions::synthetic_i32_sub2local, "synthetic:i32.sub2local" },
+    { Instructions::synthetic_i32_addconstlocal, "synthetic:i32.addconstlocal" },
+    { Instructions::synthetic_i32_andconstlocal, "synthetic:i32.andconstlocal" },
+    { Instructions::synthetic_local_seti32_const, "synthetic:local.seti32_const" },
+    { Instructions::synthetic_local_copy, "synthetic:local.copy" },
+    { Instructions::synthetic_br_if_i32_eqz, "synthetic:br_if.i32.eqz" },
+    { Instructions::synthetic_br_if_i32_eq, "synthetic:br_if.i32.eq" },
+    { Instructions::synthetic_br_if_i32_ne, "synthetic:br_if.i32.ne" },
+    { Instructions::synthetic_br_if_i32_lts, "synthetic:br_if.i32.lt_s" },
+    { Instructions::synthetic_br_if_i32_ltu, "synthetic:br_if.i32.lt_u" },
+    { Instructions::synthetic_br_if_i32_ges, "synthetic:br_if.i32.ge_s" },
+    { Instructions::synthetic_br_if_i32_geu, "synthetic:br_if.i32.ge_u" },
 };
 HashMap<ByteString, Wasm::OpCode> Wasm::Names::instructions_by_name;
@@ -13,7 +13,8 @@ namespace Wasm {
 class Reference;
 class Value;
 
-ByteString instruction_name(OpCode const& opcode);
+// NOTE: This returns a view into a static table rather than a copy of the name, so that it can be called from any thread.
+StringView instruction_name(OpCode const& opcode);
 Optional<OpCode> instruction_from_name(StringView name);
 
 struct Printer {
@@ -0,0 +1,43 @@
+// Builds a module with `count` functions of type [] -> [i32], where function i returns i % 64.
+// The function at `invalidIndex` returns an i64 instead, which fails validation.
+function buildModule(count, invalidIndex = -1) {
+    const leb = value => {
+        const bytes = [];
+        do {
+            let byte = value & 0x7f;
+            value >>>= 7;
+            if (value !== 0) byte |= 0x80;
+            bytes.push(byte);
+        } while (value !== 0);
+        return bytes;
+    };
+    const section = (id, contents) => [id, ...leb(contents.length), ...contents];
+
+    const functions = [...leb(count), ...new Array(count).fill(0)];
+    const exports = [0x01, 0x04, 0x6c, 0x61, 0x73, 0x74, 0x00, ...leb(count - 1)];
+    const code = [...leb(count)];
+    for (let i = 0; i < count; ++i) {
+        if (i === invalidIndex) code.push(0x04, 0x00, 0x42, i % 64, 0x0b);
+        else code.push(0x04, 0x00, 0x41, i % 64, 0x0b);
+    }
+
+    // prettier-ignore
+    return new Uint8Array([
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+        ...section(0x01, [0x01, 0x60, 0x00, 0x01, 0x7f]),
+        ...section(0x03, functions),
+        ...section(0x07, exports),
+        ...section(0x0a, code),
+    ]);
+}
+
+test("module with many functions validates", () => {
+    const module = parseWebAssemblyModule(buildModule(500));
+    expect(module.invoke(module.getExport("last"))).toBe(499 % 64);
+});
+
+test("invalid function in a module with many functions fails validation", () => {
+    for (const invalidIndex of [0, 123, 499]) {
+        expect(() => parseWebAssemblyModule(buildModule(500, invalidIndex))).toThrow(TypeError);
+    }
+});
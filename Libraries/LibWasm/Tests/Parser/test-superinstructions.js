@@ -0,0 +1,114 @@
+// Builds a module exporting one (i32, i32) -> i32 function per instruction sequence the bytecode interpreter fuses.
+function buildModule(functions) {
+    const section = (id, contents) => [id, contents.length, ...contents];
+    const name = string => [string.length, ...Array.from(string, c => c.charCodeAt(0))];
+    const body = code => [code.length + 2, 0x00, ...code, 0x0b];
+
+    const exports = [functions.length];
+    functions.forEach((f, i) => exports.push(...name(f.name), 0x00, i));
+    const code = [functions.length];
+    functions.forEach(f => code.push(...body(f.code)));
+
+    // prettier-ignore
+    return new Uint8Array([
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+        ...section(0x01, [0x01, 0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f]),
+        ...section(0x03, [functions.length, ...functions.map(() => 0x00)]),
+        ...section(0x07, exports),
+        ...section(0x0a, code),
+    ]);
+}
+
+// block; <condition>; br_if 0; i32.const 0; return; end; i32.const 1
+const branchIf = condition => [0x02, 0x40, ...condition, 0x0d, 0x00, 0x41, 0x00, 0x0f, 0x0b, 0x41, 0x01];
+const compareLocals = opcode => branchIf([0x20, 0x00, 0x20, 0x01, opcode]);
+
+const module = parseWebAssemblyModule(
+    buildModule([
+        // local.get 0; local.get 1; i32.add
+        { name: "add2local", code: [0x20, 0x00, 0x20, 0x01, 0x6a] },
+        // local.get 0; local.get 1; i32.sub
+        { name: "sub2local", code: [0x20, 0x00, 0x20, 0x01, 0x6b] },
+        // local.get 1; local.get 0; i32.sub
+        { name: "sub2localSwapped", code: [0x20, 0x01, 0x20, 0x00, 0x6b] },
+        // local.get 0; i32.const 7; i32.add
+        { name: "addconstlocal", code: [0x20, 0x00, 0x41, 0x07, 0x6a] },
+        // local.get 0; i32.const -3; i32.add
+        { name: "addnegativeconstlocal", code: [0x20, 0x00, 0x41, 0x7d, 0x6a] },
+        // local.get 1; i32.const 15; i32.and
+        { name: "andconstlocal", code: [0x20, 0x01, 0x41, 0x0f, 0x71] },
+        // i32.const 42; local.set 1; local.get 1
+        { name: "seti32const", code: [0x41, 0x2a, 0x21, 0x01, 0x20, 0x01] },
+        // local.get 0; local.set 1; local.get 1
+        { name: "localcopy", code: [0x20, 0x00, 0x21, 0x01, 0x20, 0x01] },
+        { name: "brIfEqz", code: branchIf([0x20, 0x00, 0x45]) },
+        { name: "brIfEq", code: compareLocals(0x46) },
+        { name: "brIfNe", code: compareLocals(0x47) },
+        { name: "brIfLtS", code: compareLocals(0x48) },
+        { name: "brIfLtU", code: compareLocals(0x49) },
+        { name: "brIfGeS", code: compareLocals(0x4e) },
+        { name: "brIfGeU", code: compareLocals(0x4f) },
+    ])
+);
+const call = (name, ...args) => module.invoke(module.getExport(name), ...args);
+
+describe("superinstructions", () => {
+    test("local.get, local.get, i32.add", () => {
+        expect(call("add2local", 2, 3)).toBe(5);
+        expect(call("add2local", -1, 1)).toBe(0);
+        expect(call("add2local", 0x7fffffff, 1)).toBe(-0x80000000);
+    });
+
+    test("local.get, local.get, i32.sub", () => {
+        expect(call("sub2local", 10, 3)).toBe(7);
+        expect(call("sub2local", 3, 10)).toBe(-7);
+        expect(call("sub2localSwapped", 10, 3)).toBe(-7);
+        expect(call("sub2local", -0x80000000, 1)).toBe(0x7fffffff);
+    });
+
+    test("local.get, i32.const, i32.add", () => {
+        expect(call("addconstlocal", 1, 100)).toBe(8);
+        expect(call("addnegativeconstlocal", 1, 100)).toBe(-2);
+        expect(call("addconstlocal", 0x7fffffff, 0)).toBe(-0x7ffffffa);
+    });
+
+    test("local.get, i32.const, i32.and", () => {
+        expect(call("andconstlocal", 0, 0xab)).toBe(0xb);
+        expect(call("andconstlocal", 0, -1)).toBe(15);
+    });
+
+    test("i32.const, local.set", () => {
+        expect(call("seti32const", 0, 0)).toBe(42);
+    });
+
+    test("local.get, local.set", () => {
+        expect(call("localcopy", 5, 0)).toBe(5);
+        expect(call("localcopy", -5, 9)).toBe(-5);
+    });
+
+    test("compare and br_if", () => {
+        expect(call("brIfEqz", 0, 0)).toBe(1);
+        expect(call("brIfEqz", 1, 0)).toBe(0);
+
+        expect(call("brIfEq", 4, 4)).toBe(1);
+        expect(call("brIfEq", 4, 5)).toBe(0);
+
+        expect(call("brIfNe", 4, 5)).toBe(1);
+        expect(call("brIfNe", 4, 4)).toBe(0);
+
+        expect(call("brIfLtS", -1, 0)).toBe(1);
+        expect(call("brIfLtS", 0, -1)).toBe(0);
+        expect(call("brIfLtS", 3, 3)).toBe(0);
+
+        expect(call("brIfLtU", 0, -1)).toBe(1);
+        expect(call("brIfLtU", -1, 0)).toBe(0);
+
+        expect(call("brIfGeS", 0, -1)).toBe(1);
+        expect(call("brIfGeS", 3, 3)).toBe(1);
+        expect(call("brIfGeS", -1, 0)).toBe(0);
+
+        expect(call("brIfGeU", -1, 0)).toBe(1);
+        expect(call("brIfGeU", 3, 3)).toBe(1);
+        expect(call("brIfGeU", 0, -1)).toBe(0);
+    });
+});
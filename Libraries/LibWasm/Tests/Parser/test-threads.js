@@ -0,0 +1,111 @@
+// Builds a module with a shared memory of one page, exporting thin wrappers around atomic instructions.
+function buildModule() {
+    const section = (id, contents) => [id, contents.length, ...contents];
+    const name = string => [string.length, ...Array.from(string, c => c.charCodeAt(0))];
+    // Every atomic access in this module is a naturally aligned 32-bit access with no offset.
+    const atomic = opcode => [0xfe, opcode, 0x02, 0x00];
+    const body = code => [code.length + 2, 0x00, ...code, 0x0b];
+
+    const functions = [
+        // add(address, value) -> old value
+        { name: "add", type: 0, code: [0x20, 0x00, 0x20, 0x01, ...atomic(0x1e)] },
+        // sub(address, value) -> old value
+        { name: "sub", type: 0, code: [0x20, 0x00, 0x20, 0x01, ...atomic(0x25)] },
+        // exchange(address, value) -> old value
+        { name: "exchange", type: 0, code: [0x20, 0x00, 0x20, 0x01, ...atomic(0x41)] },
+        // compareExchange(address, expected, replacement) -> old value
+        { name: "compareExchange", type: 1, code: [0x20, 0x00, 0x20, 0x01, 0x20, 0x02, ...atomic(0x48)] },
+        // wait(address, expected, timeout) -> 0 (ok), 1 (not-equal) or 2 (timed-out)
+        { name: "wait", type: 2, code: [0x20, 0x00, 0x20, 0x01, 0x20, 0x02, ...atomic(0x01)] },
+        // notify(address, count) -> woken waiter count
+        { name: "notify", type: 0, code: [0x20, 0x00, 0x20, 0x01, ...atomic(0x00)] },
+        // load(address) -> value
+        { name: "load", type: 3, code: [0x20, 0x00, ...atomic(0x10)] },
+        // fence() -> 0
+        { name: "fence", type: 4, code: [0xfe, 0x03, 0x00, 0x41, 0x00] },
+    ];
+
+    const exports = [functions.length];
+    functions.forEach((f, i) => exports.push(...name(f.name), 0x00, i));
+    const code = [functions.length];
+    functions.forEach(f => code.push(...body(f.code)));
+
+    // prettier-ignore
+    return new Uint8Array([
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+        ...section(0x01, [
+            0x05,
+            0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f,
+            0x60, 0x03, 0x7f, 0x7f, 0x7f, 0x01, 0x7f,
+            0x60, 0x03, 0x7f, 0x7f, 0x7e, 0x01, 0x7f,
+            0x60, 0x01, 0x7f, 0x01, 0x7f,
+            0x60, 0x00, 0x01, 0x7f,
+        ]),
+        ...section(0x03, [functions.length, ...functions.map(f => f.type)]),
+        // One shared memory with a minimum and maximum of one page.
+        ...section(0x05, [0x01, 0x03, 0x01, 0x01]),
+        ...section(0x07, exports),
+        ...section(0x0a, code),
+    ]);
+}
+
+describe("threads", () => {
+    const module = parseWebAssemblyModule(buildModule());
+    const call = (name, ...args) => module.invoke(module.getExport(name), ...args);
+
+    test("read-modify-write operations return the old value", () => {
+        expect(call("add", 0, 5)).toBe(0);
+        expect(call("add", 0, 3)).toBe(5);
+        expect(call("sub", 0, 2)).toBe(8);
+        expect(call("exchange", 0, 42)).toBe(6);
+        expect(call("load", 0)).toBe(42);
+    });
+
+    test("compare-exchange only stores on a match", () => {
+        expect(call("exchange", 4, 1)).toBe(0);
+        expect(call("compareExchange", 4, 2, 3)).toBe(1);
+        expect(call("load", 4)).toBe(1);
+        expect(call("compareExchange", 4, 1, 3)).toBe(1);
+        expect(call("load", 4)).toBe(3);
+    });
+
+    test("wait and notify", () => {
+        expect(call("exchange", 8, 7)).toBe(0);
+        expect(call("wait", 8, 0, 0)).toBe(1);
+        expect(call("wait", 8, 7, 1000)).toBe(2);
+        expect(call("notify", 8, 1)).toBe(0);
+    });
+
+    test("fence", () => {
+        expect(call("fence")).toBe(0);
+    });
+
+    test("unaligned atomic accesses trap", () => {
+        expect(() => call("load", 2)).toThrow(TypeError);
+    });
+
+    test("out of bounds atomic accesses trap", () => {
+        expect(() => call("load", 65536)).toThrow(TypeError);
+    });
+});
+
+test("shared memory without a maximum fails validation", () => {
+    // prettier-ignore
+    const bytes = new Uint8Array([
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+        0x05, 0x03, 0x01, 0x02, 0x01,
+    ]);
+    expect(() => parseWebAssemblyModule(bytes)).toThrow(TypeError);
+});
+
+test("misaligned atomic instruction fails validation", () => {
+    // prettier-ignore
+    const bytes = new Uint8Array([
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+        0x01, 0x06, 0x01, 0x60, 0x01, 0x7f, 0x01, 0x7f,
+        0x03, 0x02, 0x01, 0x00,
+        0x05, 0x04, 0x01, 0x03, 0x01, 0x01,
+        0x0a, 0x0a, 0x01, 0x08, 0x00, 0x20, 0x00, 0xfe, 0x10, 0x00, 0x00, 0x0b,
+    ]);
+    expect(() => parseWebAssemblyModule(bytes)).toThrow(TypeError);
+});
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Badge.h>
+#include <AK/ByteBuffer.h>
 #include <AK/ByteString.h>
 #include <AK/DistinctNumeric.h>
 #include <AK/LEB128.h>
@@ -269,17 +270,27 @@ private:
 // https://webassembly.github.io/spec/core/bikeshed/#memory-types%E2%91%A4
 class MemoryType {
 public:
-    explicit MemoryType(Limits limits)
+    // Proposal "threads"
+    enum class Shared {
+        No,
+        Yes,
+    };
+
+    explicit MemoryType(Limits limits, Shared shared = Shared::No)
         : m_limits(move(limits))
+        , m_shared(shared)
     {
     }
 
     auto& limits() const { return m_limits; }
+    bool is_shared() const { return m_shared == Shared::Yes; }
+    auto shared() const { return m_shared; }
 
     static ParseResult<MemoryType> parse(Stream& stream);
 
 private:
     Limits m_limits;
+    Shared m_shared { Shared::No };
 };
 
 // https://webassembly.github.io/spec/core/bikeshed/#table-types%E2%91%A4
@@ -706,10 +717,20 @@ public:
 
     auto& instructions() const { return m_instructions; }
 
+    // The form the bytecode interpreter runs, see BytecodeInterpreter::compile().
+    // It always has the same length as instructions(), so instruction pointers are interchangeable between the two.
+    auto& compiled_instructions() const { return m_compiled_instructions.is_empty() ? m_instructions : m_compiled_instructions; }
+    void set_compiled_instructions(Vector<Instruction> instructions)
+    {
+        VERIFY(instructions.size() == m_instructions.size());
+        m_compiled_instructions = move(instructions);
+    }
+
     static ParseResult<Expression> parse(Stream& stream, Optional<size_t> size_hint = {});
 
 private:
     Vector<Instruction> m_instructions;
+    Vector<Instruction> m_compiled_instructions;
 };
 
 class GlobalSection {
@@ -884,6 +905,7 @@ public:
 
         auto& locals() const { return m_locals; }
         auto& body() const { return m_body; }
+        auto& body() { return m_body; }
 
         static ParseResult<Func> parse(Stream& stream, size_t size_hint);
 
@@ -901,6 +923,7 @@ public:
 
         auto size() const { return m_size; }
         auto& func() const { return m_func; }
+        auto& func() { return m_func; }
 
         static ParseResult<Code> parse(Stream& stream);
 
@@ -917,6 +940,7 @@ public:
     }
 
     auto& functions() const { return m_functions; }
+    auto& functions() { return m_functions; }
 
     static ParseResult<CodeSection> parse(Stream& stream);
 
@@ -1052,4 +1076,40 @@ private:
     Optional<ByteString> m_validation_error;
 };
 
+// Parses a module from bytes that arrive in chunks, e.g. from a network response.
+// Each section is parsed as soon as all of its bytes are available, and function bodies in the code section
+// are parsed one at a time, so that only the not-yet-parsed tail of the input has to be kept around.
+class StreamingModuleParser : public RefCounted<StreamingModuleParser> {
+public:
+    StreamingModuleParser();
+
+    // Once an error has been returned, further input is ignored and finish() returns the same error.
+    ParseResult<void> append(ReadonlyBytes);
+    ParseResult<NonnullRefPtr<Module>> finish();
+
+private:
+    enum class State {
+        Header,
+        SectionHeader,
+        SectionContents,
+        CodeCount,
+        CodeEntry,
+    };
+
+    ParseResult<bool> parse_next();
+
+    State m_state { State::Header };
+    ByteBuffer m_buffer;
+    size_t m_consumed { 0 };
+    Optional<ParseError> m_error;
+
+    NonnullRefPtr<Module> m_module;
+    SectionId::SectionIdKind m_last_section_id { SectionId::SectionIdKind::Custom };
+    SectionId::SectionIdKind m_section_kind { SectionId::SectionIdKind::Custom };
+    size_t m_section_size { 0 };
+
+    u32 m_remaining_code_entries { 0 };
+    Vector<CodeSection::Code> m_code_entries;
+};
+
 }
@@ -4,7 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/Bitmap.h>
+#include <AK/AnyOf.h>
 #include <AK/QuickSort.h>
 #include <LibJS/Runtime/Iterator.h>
 #include <LibWeb/Animations/Animation.h>
@@ -912,24 +912,24 @@ void KeyframeEffect::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_keyframe_objects);
 }
 
-static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation(HashMap<CSS::PropertyID, NonnullRefPtr<CSS::CSSStyleValue const>> const& old_properties, HashMap<CSS::PropertyID, NonnullRefPtr<CSS::CSSStyleValue const>> const& new_properties)
+static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation(HashMap<CSS::PropertyID, NonnullRefPtr<CSS::CSSStyleValue const>> const& old_properties, HashMap<CSS::PropertyID, NonnullRefPtr<CSS::CSSStyleValue const>> const& new_properties, Vector<CSS::PropertyID>& changed_properties)
 {
     CSS::RequiredInvalidationAfterStyleChange invalidation;
-    auto old_and_new_properties = MUST(Bitmap::create(to_underlying(CSS::last_property_id) + 1, 0));
-    for (auto const& [property_id, _] : old_properties)
-        old_and_new_properties.set(to_underlying(property_id), 1);
-    for (auto const& [property_id, _] : new_properties)
-        old_and_new_properties.set(to_underlying(property_id), 1);
-    for (auto i = to_underlying(CSS::first_property_id); i <= to_underlying(CSS::last_property_id); ++i) {
-        if (!old_and_new_properties.get(i))
-            continue;
-        auto property_id = static_cast<CSS::PropertyID>(i);
-        auto const* old_value = old_properties.get(property_id).value_or({});
-        auto const* new_value = new_properties.get(property_id).value_or({});
-        if (!old_value && !new_value)
-            continue;
-        invalidation |= compute_property_invalidation(property_id, old_value, new_value);
+
+    auto compare = [&](CSS::PropertyID property_id, CSS::CSSStyleValue const* old_value, CSS::CSSStyleValue const* new_value) {
+        auto property_invalidation = compute_property_invalidation(property_id, old_value, new_value);
+        if (!old_value || !new_value || *old_value != *new_value)
+            changed_properties.append(property_id);
+        invalidation |= property_invalidation;
+    };
+
+    for (auto const& [property_id, old_value] : old_properties)
+        compare(property_id, old_value.ptr(), new_properties.get(property_id).value_or({}));
+    for (auto const& [property_id, new_value] : new_properties) {
+        if (!old_properties.contains(property_id))
+            compare(property_id, nullptr, new_value.ptr());
     }
+
     return invalidation;
 }
 
@@ -966,13 +966,29 @@ void KeyframeEffect::update_computed_properties()
     auto& document = target->document();
     document.style_computer().collect_animation_into(*target, pseudo_element_type(), *this, *style, CSS::StyleComputer::AnimationRefresh::Yes);
 
-    auto invalidation = compute_required_invalidation(animated_properties_before_update, style->animated_property_values());
+    Vector<CSS::PropertyID> changed_properties;
+    auto invalidation = compute_required_invalidation(animated_properties_before_update, style->animated_property_values(), changed_properties);
 
     if (invalidation.is_none())
         return;
 
     // Traversal of the subtree is necessary to update the animated properties inherited from the target element.
+    // OPTIMIZATION: Animations of properties that aren't inherited by default (like transform and opacity) can only
+    //               reach descendants that explicitly inherit them, so we don't have to recompute the inherited
+    //               style of the others, which would otherwise be done across the whole subtree on every tick.
+    bool changes_inherited_property = any_of(changed_properties, [](auto property_id) {
+        return CSS::is_inherited_property(property_id);
+    });
     target->for_each_in_subtree_of_type<DOM::Element>([&](auto& element) {
+        if (!changes_inherited_property) {
+            auto computed_properties = element.computed_properties();
+            bool inherits_changed_property = computed_properties && any_of(changed_properties, [&](auto property_id) {
+                return computed_properties->is_property_inherited(property_id);
+            });
+            if (!inherits_changed_property)
+                return TraversalDecision::SkipChildrenAndContinue;
+        }
+
         auto element_invalidation = element.recompute_inherited_style();
         if (element_invalidation.is_none())
             return TraversalDecision::SkipChildrenAndContinue;
@@ -1003,7 +1019,20 @@ void KeyframeEffect::update_computed_properties()
     }
     if (invalidation.repaint) {
         document.set_needs_display();
-        document.set_needs_to_resolve_paint_only_properties();
+
+        // OPTIMIZATION: Most animations only change paint-only properties like transform and opacity. In that case, the
+        //               rest of the paint tree is unaffected, and only the subtree of the target's paintables has to
+        //               be resolved again, rather than the whole document on every tick.
+        Layout::Node* target_layout_node = nullptr;
+        if (!pseudo_element_type().has_value())
+            target_layout_node = target->layout_node();
+        else
+            target_layout_node = target->get_pseudo_element_node(pseudo_element_type().value()).ptr();
+
+        if (target_layout_node && !invalidation.relayout && !invalidation.rebuild_layout_tree)
+            document.set_needs_to_resolve_paint_only_properties(*target_layout_node);
+        else
+            document.set_needs_to_resolve_paint_only_properties();
     }
     if (invalidation.rebuild_stacking_context_tree)
         document.invalidate_stacking_context_tree();
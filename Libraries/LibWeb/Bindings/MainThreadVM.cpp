@@ -660,6 +660,15 @@ void initialize_main_thread_vm(AgentType type)
     s_main_thread_vm->host_unrecognized_date_string = [](StringView date) {
         dbgln("Unable to parse date string: \"{}\"", date);
     };
+
+    // NOTE: Like the HTTP cache, the script cache is partitioned by origin, so that how long it takes to run a script
+    //       can't reveal which scripts other sites have loaded. Realms with an opaque origin don't share their scripts.
+    s_main_thread_vm->host_get_script_cache_partition = [](JS::Realm& realm) -> Optional<String> {
+        auto const& origin = HTML::principal_realm_settings_object(HTML::principal_realm(realm)).origin();
+        if (origin.is_opaque())
+            return {};
+        return origin.serialize();
+    };
 }
 
 JS::VM& main_thread_vm()
@@ -15,6 +15,7 @@
 #include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/CSS/StyleSheetList.h>
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
@@ -157,7 +158,12 @@ WebIDL::ExceptionOr<unsigned> CSSStyleSheet::insert_rule(StringView rule, unsign
         // NOTE: The spec doesn't say where to set the parent style sheet, so we'll do it here.
         parsed_rule->set_parent_style_sheet(this);
 
-        invalidate_owners(DOM::StyleInvalidationReason::StyleSheetInsertRule);
+        // Appending a rule doesn't change the cascade order of any existing rule, so the rule caches can be updated
+        // in place. Inserting anywhere else requires renumbering everything after it.
+        if (result.value() == m_rules->length() - 1)
+            invalidate_owners_after_rule_list_change(DOM::StyleInvalidationReason::StyleSheetInsertRule, *parsed_rule, RuleListChange::Appended);
+        else
+            invalidate_owners(DOM::StyleInvalidationReason::StyleSheetInsertRule);
     }
 
     return result;
@@ -173,9 +179,11 @@ WebIDL::ExceptionOr<void> CSSStyleSheet::delete_rule(unsigned index)
         return WebIDL::NotAllowedError::create(realm(), "Can't call delete_rule() on non-modifiable stylesheets."_string);
 
     // 3. Remove a CSS rule in the CSS rules at index.
+    GC::Ptr<CSSRule const> removed_rule = m_rules->item(index);
     auto result = m_rules->remove_a_css_rule(index);
     if (!result.is_exception()) {
-        invalidate_owners(DOM::StyleInvalidationReason::StyleSheetDeleteRule);
+        VERIFY(removed_rule);
+        invalidate_owners_after_rule_list_change(DOM::StyleInvalidationReason::StyleSheetDeleteRule, *removed_rule, RuleListChange::Removed);
     }
     return result;
 }
@@ -336,6 +344,22 @@ void CSSStyleSheet::invalidate_owners(DOM::StyleInvalidationReason reason)
     }
 }
 
+void CSSStyleSheet::invalidate_owners_after_rule_list_change(DOM::StyleInvalidationReason reason, CSSRule const& rule, RuleListChange change)
+{
+    m_did_match = {};
+    for (auto& document_or_shadow_root : m_owning_documents_or_shadow_roots) {
+        document_or_shadow_root->invalidate_style(reason);
+
+        auto& style_computer = document_or_shadow_root->document().style_computer();
+        GC::Ptr<DOM::ShadowRoot const> shadow_root = as_if<DOM::ShadowRoot>(*document_or_shadow_root);
+        bool did_update_rule_cache = change == RuleListChange::Appended
+            ? style_computer.add_appended_rule_to_rule_cache(*this, shadow_root, rule)
+            : style_computer.remove_rule_from_rule_cache(*this, shadow_root, rule);
+        if (!did_update_rule_cache)
+            style_computer.invalidate_rule_cache();
+    }
+}
+
 GC::Ptr<DOM::Document> CSSStyleSheet::owning_document() const
 {
     if (!m_owning_documents_or_shadow_roots.is_empty())
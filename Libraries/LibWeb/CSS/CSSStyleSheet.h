@@ -98,6 +98,12 @@ public:
     bool has_associated_font_loader(FontLoader& font_loader) const;
 
 private:
+    enum class RuleListChange {
+        Appended,
+        Removed,
+    };
+    void invalidate_owners_after_rule_list_change(DOM::StyleInvalidationReason, CSSRule const&, RuleListChange);
+
     CSSStyleSheet(JS::Realm&, CSSRuleList&, MediaList&, Optional<::URL::URL> location);
 
     virtual void initialize(JS::Realm&) override;
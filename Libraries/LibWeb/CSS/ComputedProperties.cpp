@@ -5,6 +5,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashTable.h>
+#include <AK/NeverDestroyed.h>
 #include <AK/NonnullRawPtr.h>
 #include <AK/TypeCasts.h>
 #include <LibCore/DirIterator.h>
@@ -42,12 +44,132 @@
 
 namespace Web::CSS {
 
+namespace {
+
+struct InternedComputedPropertyGroupTraits : public DefaultTraits<ComputedPropertyGroup*> {
+    static unsigned hash(ComputedPropertyGroup const* group) { return group->hash(); }
+    static bool equals(ComputedPropertyGroup const* a, ComputedPropertyGroup const* b) { return a->has_same_values_as(*b); }
+};
+
+}
+
+// The table only holds weak references; groups remove themselves when they are destroyed.
+static HashTable<ComputedPropertyGroup*, InternedComputedPropertyGroupTraits>& interned_computed_property_groups()
+{
+    static NeverDestroyed<HashTable<ComputedPropertyGroup*, InternedComputedPropertyGroupTraits>> table;
+    return *table;
+}
+
+NonnullRefPtr<ComputedPropertyGroup> ComputedPropertyGroup::empty()
+{
+    static NeverDestroyed<NonnullRefPtr<ComputedPropertyGroup>> empty_group = [] {
+        auto group = adopt_ref(*new ComputedPropertyGroup);
+        group->m_is_shared = true;
+        return group;
+    }();
+    return *empty_group;
+}
+
+NonnullRefPtr<ComputedPropertyGroup> ComputedPropertyGroup::intern(NonnullRefPtr<ComputedPropertyGroup> group)
+{
+    if (group->m_is_shared)
+        return group;
+
+    group->m_hash = 0;
+    for (auto const& value : group->m_values)
+        group->m_hash = pair_int_hash(group->m_hash, ptr_hash(value.ptr()));
+
+    auto& table = interned_computed_property_groups();
+    if (auto it = table.find(group.ptr()); it != table.end())
+        return **it;
+
+    group->m_is_shared = true;
+    group->m_is_interned = true;
+    table.set(group.ptr());
+    return group;
+}
+
+ComputedPropertyGroup::~ComputedPropertyGroup()
+{
+    if (m_is_interned)
+        interned_computed_property_groups().remove(this);
+}
+
+NonnullRefPtr<ComputedPropertyGroup> ComputedPropertyGroup::clone() const
+{
+    auto group = adopt_ref(*new ComputedPropertyGroup);
+    group->m_values = m_values;
+    return group;
+}
+
+bool ComputedPropertyGroup::has_same_values_as(ComputedPropertyGroup const& other) const
+{
+    // Values are compared by identity: inherited and initial values are the same objects, which is what makes groups
+    // worth sharing in the first place.
+    for (size_t i = 0; i < property_count; ++i) {
+        if (m_values[i].ptr() != other.m_values[i].ptr())
+            return false;
+    }
+    return true;
+}
+
 GC_DEFINE_ALLOCATOR(ComputedProperties);
 
-ComputedProperties::ComputedProperties() = default;
+ComputedProperties::ComputedProperties()
+{
+    m_property_groups.fill(ComputedPropertyGroup::empty());
+}
 
 ComputedProperties::~ComputedProperties() = default;
 
+ComputedProperties::PropertyGroupSlot ComputedProperties::property_group_slot(PropertyID property_id)
+{
+    static Array<PropertyGroupSlot, number_of_properties> const slots = [] {
+        Array<PropertyGroupSlot, number_of_properties> slots {};
+        u16 group = 0;
+        u16 slot = 0;
+        // Inherited and non-inherited properties never share a group, since children usually only have the same
+        // values as their parent for the inherited ones.
+        for (auto inherited : { true, false }) {
+            for (size_t i = 0; i < number_of_properties; ++i) {
+                if (is_inherited_property(static_cast<PropertyID>(i)) != inherited)
+                    continue;
+                if (slot == ComputedPropertyGroup::property_count) {
+                    ++group;
+                    slot = 0;
+                }
+                slots[i] = { group, slot++ };
+            }
+            ++group;
+            slot = 0;
+        }
+        VERIFY(group <= max_number_of_property_groups);
+        return slots;
+    }();
+    return slots[to_underlying(property_id)];
+}
+
+RefPtr<CSSStyleValue const> const& ComputedProperties::value_slot(PropertyID property_id) const
+{
+    auto [group, slot] = property_group_slot(property_id);
+    return m_property_groups[group]->value(slot);
+}
+
+RefPtr<CSSStyleValue const>& ComputedProperties::mutable_value_slot(PropertyID property_id)
+{
+    auto [group, slot] = property_group_slot(property_id);
+    auto& property_group = m_property_groups[group];
+    if (property_group->is_shared())
+        property_group = property_group->clone();
+    return property_group->value(slot);
+}
+
+void ComputedProperties::intern_property_groups()
+{
+    for (auto& group : m_property_groups)
+        group = ComputedPropertyGroup::intern(group.release_nonnull());
+}
+
 void ComputedProperties::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -55,6 +177,25 @@ void ComputedProperties::visit_edges(Visitor& visitor)
     visitor.visit(m_transition_property_source);
 }
 
+GC::Ref<ComputedProperties> ComputedProperties::clone() const
+{
+    auto clone = heap().allocate<ComputedProperties>();
+    clone->m_animation_name_source = m_animation_name_source;
+    clone->m_transition_property_source = m_transition_property_source;
+    // NOTE: Property groups are copy-on-write, so the clone shares them until either style is modified.
+    clone->m_property_groups = m_property_groups;
+    clone->m_property_important = m_property_important;
+    clone->m_property_inherited = m_property_inherited;
+    // NOTE: Animated values belong to the animations of the element that owns this style, so they are not copied.
+    clone->m_math_depth = m_math_depth;
+    clone->m_font_list = m_font_list;
+    clone->m_first_available_computed_font = m_first_available_computed_font;
+    clone->m_line_height = m_line_height;
+    clone->m_font_size = m_font_size;
+    clone->m_attempted_pseudo_class_matches = m_attempted_pseudo_class_matches;
+    return clone;
+}
+
 bool ComputedProperties::is_property_important(PropertyID property_id) const
 {
     size_t n = to_underlying(property_id);
@@ -87,14 +228,14 @@ void ComputedProperties::set_property_inherited(PropertyID property_id, Inherite
 
 void ComputedProperties::set_property(PropertyID id, NonnullRefPtr<CSSStyleValue const> value, Inherited inherited, Important important)
 {
-    m_property_values[to_underlying(id)] = move(value);
+    mutable_value_slot(id) = move(value);
     set_property_important(id, important);
     set_property_inherited(id, inherited);
 }
 
 void ComputedProperties::revert_property(PropertyID id, ComputedProperties const& style_for_revert)
 {
-    m_property_values[to_underlying(id)] = style_for_revert.m_property_values[to_underlying(id)];
+    mutable_value_slot(id) = style_for_revert.value_slot(id);
     set_property_important(id, style_for_revert.is_property_important(id) ? Important::Yes : Important::No);
     set_property_inherited(id, style_for_revert.is_property_inherited(id) ? Inherited::Yes : Inherited::No);
 }
@@ -117,14 +258,14 @@ CSSStyleValue const& ComputedProperties::property(PropertyID property_id, WithAn
     }
 
     // By the time we call this method, all properties have values assigned.
-    return *m_property_values[to_underlying(property_id)];
+    return *value_slot(property_id);
 }
 
 CSSStyleValue const* ComputedProperties::maybe_null_property(PropertyID property_id) const
 {
     if (auto animated_value = m_animated_property_values.get(property_id); animated_value.has_value())
         return animated_value.value();
-    return m_property_values[to_underlying(property_id)];
+    return value_slot(property_id);
 }
 
 Variant<LengthPercentage, NormalGap> ComputedProperties::gap_value(PropertyID id) const
@@ -744,12 +885,12 @@ Positioning ComputedProperties::position() const
 
 bool ComputedProperties::operator==(ComputedProperties const& other) const
 {
-    if (m_property_values.size() != other.m_property_values.size())
-        return false;
-
-    for (size_t i = 0; i < m_property_values.size(); ++i) {
-        auto const& my_style = m_property_values[i];
-        auto const& other_style = other.m_property_values[i];
+    for (size_t i = 0; i < number_of_properties; ++i) {
+        auto property_id = static_cast<PropertyID>(i);
+        if (m_property_groups[property_group_slot(property_id).group] == other.m_property_groups[property_group_slot(property_id).group])
+            continue;
+        auto const& my_style = value_slot(property_id);
+        auto const& other_style = other.value_slot(property_id);
         if (!my_style) {
             if (other_style)
                 return false;
@@ -9,6 +9,7 @@
 
 #include <AK/HashMap.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Ptr.h>
 #include <LibGfx/Font/Font.h>
@@ -24,6 +25,44 @@
 
 namespace Web::CSS {
 
+// A copy-on-write block of computed values for a fixed group of properties.
+//
+// Inherited and non-inherited properties are kept in separate groups. Once an element's style has been computed its
+// groups are interned, so elements whose values for a whole group are the same (most commonly because they inherit
+// everything from their parent, or keep the initial values) share a single copy of that group.
+class ComputedPropertyGroup : public RefCounted<ComputedPropertyGroup> {
+public:
+    static constexpr size_t property_count = 32;
+
+    static NonnullRefPtr<ComputedPropertyGroup> empty();
+    static NonnullRefPtr<ComputedPropertyGroup> intern(NonnullRefPtr<ComputedPropertyGroup>);
+
+    ~ComputedPropertyGroup();
+
+    NonnullRefPtr<ComputedPropertyGroup> clone() const;
+
+    // Shared groups are either interned or the empty group, and must not be modified.
+    bool is_shared() const { return m_is_shared || ref_count() > 1; }
+
+    RefPtr<CSSStyleValue const> const& value(size_t slot) const { return m_values[slot]; }
+    RefPtr<CSSStyleValue const>& value(size_t slot)
+    {
+        VERIFY(!is_shared());
+        return m_values[slot];
+    }
+
+    unsigned hash() const { return m_hash; }
+    bool has_same_values_as(ComputedPropertyGroup const&) const;
+
+private:
+    ComputedPropertyGroup() = default;
+
+    Array<RefPtr<CSSStyleValue const>, property_count> m_values;
+    unsigned m_hash { 0 };
+    bool m_is_shared { false };
+    bool m_is_interned { false };
+};
+
 class ComputedProperties final : public JS::Cell {
     GC_CELL(ComputedProperties, JS::Cell);
     GC_DECLARE_ALLOCATOR(ComputedProperties);
@@ -34,15 +73,21 @@ public:
 
     virtual ~ComputedProperties() override;
 
+    // Returns a copy of this style, without any animated values, for use by another element.
+    [[nodiscard]] GC::Ref<ComputedProperties> clone() const;
+
     template<typename Callback>
     inline void for_each_property(Callback callback) const
     {
-        for (size_t i = 0; i < m_property_values.size(); ++i) {
-            if (m_property_values[i])
-                callback((PropertyID)i, *m_property_values[i]);
+        for (size_t i = 0; i < number_of_properties; ++i) {
+            if (auto const& value = value_slot(static_cast<PropertyID>(i)))
+                callback((PropertyID)i, *value);
         }
     }
 
+    // Replaces each property group with an identical interned one, if there is one.
+    void intern_property_groups();
+
     enum class Inherited {
         No,
         Yes
@@ -263,7 +308,17 @@ private:
     GC::Ptr<CSSStyleDeclaration const> m_animation_name_source;
     GC::Ptr<CSSStyleDeclaration const> m_transition_property_source;
 
-    Array<RefPtr<CSSStyleValue const>, number_of_properties> m_property_values;
+    struct PropertyGroupSlot {
+        u16 group { 0 };
+        u16 slot { 0 };
+    };
+    static constexpr size_t max_number_of_property_groups = ceil_div(number_of_properties, ComputedPropertyGroup::property_count) + 1;
+    static PropertyGroupSlot property_group_slot(PropertyID);
+
+    RefPtr<CSSStyleValue const> const& value_slot(PropertyID) const;
+    RefPtr<CSSStyleValue const>& mutable_value_slot(PropertyID);
+
+    Array<RefPtr<ComputedPropertyGroup>, max_number_of_property_groups> m_property_groups;
     Array<u8, ceil_div(number_of_properties, 8uz)> m_property_important {};
     Array<u8, ceil_div(number_of_properties, 8uz)> m_property_inherited {};
 
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/GenericShorthands.h>
+#include <AK/Hex.h>
+#include <LibCore/MemoryReporting.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <LibGfx/Font/WOFF/Loader.h>
+#include <LibGfx/Font/WOFF2/Loader.h>
+#include <LibThreading/BackgroundAction.h>
+#include <LibWeb/CSS/DecodedFontCache.h>
+
+namespace Web::CSS {
+
+DecodedFontCache& DecodedFontCache::the()
+{
+    static DecodedFontCache cache;
+    return cache;
+}
+
+static ByteString cache_key_for(ByteBuffer const& data, Optional<Gfx::FontFormat> format)
+{
+    auto digest = Crypto::Hash::SHA256::hash(data);
+    return ByteString::formatted("{}:{}", encode_hex(digest.bytes()), format.has_value() ? static_cast<int>(*format) : -1);
+}
+
+ErrorOr<NonnullRefPtr<Gfx::Typeface const>> DecodedFontCache::decode_on_this_thread(ByteBuffer const& data, Optional<Gfx::FontFormat> format)
+{
+    if (!format.has_value() || first_is_one_of(*format, Gfx::FontFormat::TrueType, Gfx::FontFormat::OpenType)) {
+        if (auto result = Gfx::Typeface::try_load_from_temporary_memory(data); !result.is_error())
+            return result;
+    }
+    if (!format.has_value() || *format == Gfx::FontFormat::WOFF) {
+        if (auto result = WOFF::try_load_from_bytes(data); !result.is_error())
+            return result;
+    }
+    if (!format.has_value() || *format == Gfx::FontFormat::WOFF2) {
+        if (auto result = WOFF2::try_load_from_bytes(data); !result.is_error())
+            return result;
+    }
+    return Error::from_string_literal("Automatic format detection failed");
+}
+
+void DecodedFontCache::decode(ByteBuffer data, Optional<Gfx::FontFormat> format, Callback callback)
+{
+    auto key = cache_key_for(data, format);
+
+    if (auto it = m_typefaces.find(key); it != m_typefaces.end()) {
+        callback(it->value);
+        return;
+    }
+
+    if (auto it = m_pending_decodes.find(key); it != m_pending_decodes.end()) {
+        it->value.append(move(callback));
+        return;
+    }
+    m_pending_decodes.ensure(key).append(move(callback));
+
+    // NOTE: The action never fails, so that the result is always delivered on this thread. Errors from the background
+    //       thread would otherwise be reported from there if the event loop goes away in the meantime.
+    (void)Threading::BackgroundAction<RefPtr<Gfx::Typeface const>>::construct(
+        [data = move(data), format](auto&) -> ErrorOr<RefPtr<Gfx::Typeface const>> {
+            auto typeface_or_error = decode_on_this_thread(data, format);
+            if (typeface_or_error.is_error())
+                return nullptr;
+            return typeface_or_error.release_value();
+        },
+        [key = move(key)](RefPtr<Gfx::Typeface const> typeface) -> ErrorOr<void> {
+            DecodedFontCache::the().did_decode(key, move(typeface));
+            return {};
+        });
+}
+
+void DecodedFontCache::clear()
+{
+    m_typefaces.clear();
+    m_keys_in_insertion_order.clear();
+    m_size_of_cached_fonts = 0;
+}
+
+void DecodedFontCache::report_memory_usage(Core::MemoryReports& reports) const
+{
+    reports.add("fonts/decoded-font-cache"_string, m_size_of_cached_fonts, m_typefaces.size());
+}
+
+void DecodedFontCache::did_decode(ByteString const& key, RefPtr<Gfx::Typeface const> typeface)
+{
+    auto callbacks = m_pending_decodes.take(key).value_or({});
+
+    if (typeface) {
+        m_typefaces.set(key, *typeface);
+        m_keys_in_insertion_order.append(key);
+        m_size_of_cached_fonts += typeface->buffer().size();
+
+        while (m_size_of_cached_fonts > maximum_size_of_cached_fonts && m_keys_in_insertion_order.size() > 1) {
+            auto evicted = m_typefaces.take(m_keys_in_insertion_order.take_first());
+            m_size_of_cached_fonts -= evicted.value()->buffer().size();
+        }
+    }
+
+    for (auto& callback : callbacks)
+        callback(typeface);
+}
+
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/ByteString.h>
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibCore/Forward.h>
+#include <LibGfx/Font/FontSupport.h>
+#include <LibGfx/Font/Typeface.h>
+
+namespace Web::CSS {
+
+// Decodes downloaded font files on a background thread, and shares the resulting typefaces between all documents in
+// this process that load the same font data, no matter which URL it came from.
+class DecodedFontCache {
+public:
+    using Callback = Function<void(RefPtr<Gfx::Typeface const>)>;
+
+    static DecodedFontCache& the();
+
+    // Invokes the callback with the decoded typeface, or null if the data is not a font of the given format. If no format
+    // is given, all the formats we support are tried. The callback is invoked synchronously if the data was decoded
+    // before, and from the event loop of the calling thread otherwise.
+    void decode(ByteBuffer data, Optional<Gfx::FontFormat>, Callback);
+
+    // Forgets every typeface we decoded. Typefaces that are still in use stay alive through the fonts using them.
+    void clear();
+
+    void report_memory_usage(Core::MemoryReports&) const;
+
+private:
+    static ErrorOr<NonnullRefPtr<Gfx::Typeface const>> decode_on_this_thread(ByteBuffer const&, Optional<Gfx::FontFormat>);
+
+    void did_decode(ByteString const& key, RefPtr<Gfx::Typeface const>);
+
+    // We hold on to typefaces after the documents using them went away, so that navigating between pages of the same
+    // site doesn't decode its fonts again. This caps how much font data we keep alive that way.
+    static constexpr size_t maximum_size_of_cached_fonts = 32 * MiB;
+
+    HashMap<ByteString, NonnullRefPtr<Gfx::Typeface const>> m_typefaces;
+    Vector<ByteString> m_keys_in_insertion_order;
+    size_t m_size_of_cached_fonts { 0 };
+
+    // Requests for data that is already being decoded just wait for that to finish.
+    HashMap<ByteString, Vector<Callback>> m_pending_decodes;
+};
+
+}
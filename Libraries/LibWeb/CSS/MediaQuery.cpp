@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <LibWeb/CSS/MediaQuery.h>
 #include <LibWeb/CSS/Serialize.h>
 #include <LibWeb/CSS/StyleComputer.h>
@@ -296,8 +297,31 @@ String MediaQuery::to_string() const
     return MUST(builder.to_string());
 }
 
+static void collect_media_features(BooleanExpression const& expression, Vector<MediaFeatureID>& media_features)
+{
+    if (auto const* media_feature = as_if<MediaFeature>(expression)) {
+        if (!media_features.contains_slow(media_feature->id()))
+            media_features.append(media_feature->id());
+        return;
+    }
+    expression.for_each_child([&](BooleanExpression const& child) {
+        collect_media_features(child, media_features);
+    });
+}
+
 bool MediaQuery::evaluate(HTML::Window const& window)
 {
+    // If none of the media features we depend on have changed since we were last evaluated, neither has our result.
+    if (m_evaluated_for_window == &window) {
+        bool any_media_feature_changed = any_of(m_media_features, [&](auto media_feature) {
+            return window.media_feature_changed_in_generation(media_feature) > m_evaluated_in_generation;
+        });
+        if (!any_media_feature_changed)
+            return m_matches;
+    } else if (m_media_condition && m_evaluated_for_window == nullptr) {
+        collect_media_features(*m_media_condition, m_media_features);
+    }
+
     auto matches_media = [](MediaType const& media) -> MatchResult {
         if (!media.known_type.has_value())
             return MatchResult::False;
@@ -323,6 +347,13 @@ bool MediaQuery::evaluate(HTML::Window const& window)
         result = negate(result);
 
     m_matches = result == MatchResult::True;
+
+    // Make sure the window is tracking all of our media features before we note down the generation.
+    for (auto media_feature : m_media_features)
+        (void)window.media_feature_changed_in_generation(media_feature);
+    m_evaluated_for_window = &window;
+    m_evaluated_in_generation = HTML::Window::current_media_feature_generation();
+
     return m_matches;
 }
 
@@ -161,6 +161,8 @@ public:
             }));
     }
 
+    MediaFeatureID id() const { return m_id; }
+
     virtual MatchResult evaluate(HTML::Window const*) const override;
     virtual String to_string() const override;
     virtual void dump(StringBuilder&, int indent_levels = 0) const override;
@@ -231,6 +233,14 @@ private:
 
     // Cached value, updated by evaluate()
     bool m_matches { false };
+
+    // The media features m_media_condition depends on, collected the first time we are evaluated.
+    Vector<MediaFeatureID> m_media_features;
+
+    // The window and generation of the last evaluation. The window is only compared, never dereferenced: a new window
+    // at the same address has all of its media features changing in a generation after this one.
+    HTML::Window const* m_evaluated_for_window { nullptr };
+    u64 m_evaluated_in_generation { 0 };
 };
 
 String serialize_a_media_query_list(Vector<NonnullRefPtr<MediaQuery>> const&);
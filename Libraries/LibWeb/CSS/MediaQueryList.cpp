@@ -92,6 +92,8 @@ bool MediaQueryList::evaluate()
     if (m_media.is_empty())
         return true;
 
+    window->update_media_feature_states();
+
     bool now_matches = false;
     for (auto& media : m_media) {
         now_matches = now_matches || media->evaluate(*window);
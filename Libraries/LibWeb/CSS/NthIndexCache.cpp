@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/CSS/NthIndexCache.h>
+#include <LibWeb/DOM/Element.h>
+
+namespace Web::CSS {
+
+// Short lists of siblings are cheaper to walk than to cache.
+static constexpr size_t maximum_siblings_to_walk_without_cache = 32;
+
+template<typename Callback>
+static Optional<size_t> walk_siblings(DOM::Element const& element, NthIndexCache::Direction direction, Callback counts)
+{
+    auto next = [direction](DOM::Element const& sibling) {
+        return direction == NthIndexCache::Direction::FromStart ? sibling.previous_element_sibling() : sibling.next_element_sibling();
+    };
+
+    size_t index = 1;
+    size_t walked = 0;
+    for (auto const* sibling = next(element); sibling; sibling = next(*sibling)) {
+        if (++walked > maximum_siblings_to_walk_without_cache)
+            return {};
+        if (counts(*sibling))
+            ++index;
+    }
+    return index;
+}
+
+size_t NthIndexCache::nth_child_index(DOM::Element const& element, Direction direction)
+{
+    if (!m_parents.contains(element.parent())) {
+        if (auto index = walk_siblings(element, direction, [](auto const&) { return true; }); index.has_value())
+            return *index;
+    }
+
+    auto const& siblings = siblings_of(element);
+    auto index = siblings.positions.get(&element)->index;
+    if (direction == Direction::FromStart)
+        return index;
+    return siblings.count - index + 1;
+}
+
+size_t NthIndexCache::nth_of_type_index(DOM::Element const& element, Direction direction)
+{
+    if (!m_parents.contains(element.parent())) {
+        auto index = walk_siblings(element, direction, [&](auto const& sibling) { return sibling.tag_name() == element.tag_name(); });
+        if (index.has_value())
+            return *index;
+    }
+
+    auto const& siblings = siblings_of(element);
+    auto index = siblings.positions.get(&element)->index_of_type;
+    if (direction == Direction::FromStart)
+        return index;
+    return *siblings.counts_of_type.get(element.tag_name()) - index + 1;
+}
+
+NthIndexCache::Siblings const& NthIndexCache::siblings_of(DOM::Element const& element)
+{
+    auto const& parent = *element.parent();
+
+    return *m_parents.ensure(&parent, [&] {
+        auto siblings = make<Siblings>();
+        for (auto const* child = parent.first_child_of_type<DOM::Element>(); child; child = child->next_element_sibling()) {
+            auto& count_of_type = siblings->counts_of_type.ensure(child->tag_name());
+            siblings->positions.set(child, { .index = ++siblings->count, .index_of_type = ++count_of_type });
+        }
+        return siblings;
+    });
+}
+
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/FlyString.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::CSS {
+
+// Remembers the positions of elements among their siblings while matching selectors during a style update, so that
+// matching :nth-child() and friends against every child of a long list doesn't walk the siblings of each child in turn.
+// Nothing here notices DOM mutations, so the cache must be cleared before the DOM changes.
+class NthIndexCache {
+public:
+    enum class Direction : u8 {
+        FromStart,
+        FromEnd,
+    };
+
+    // Returns the 1-based position of the element among its parent's element children.
+    size_t nth_child_index(DOM::Element const&, Direction);
+
+    // Returns the 1-based position of the element among its parent's element children with the same tag name.
+    size_t nth_of_type_index(DOM::Element const&, Direction);
+
+    void clear() { m_parents.clear(); }
+
+private:
+    struct Position {
+        u32 index { 0 };
+        u32 index_of_type { 0 };
+    };
+
+    struct Siblings {
+        HashMap<DOM::Element const*, Position> positions;
+        HashMap<FlyString, u32> counts_of_type;
+        u32 count { 0 };
+    };
+
+    Siblings const& siblings_of(DOM::Element const&);
+
+    HashMap<DOM::Node const*, NonnullOwnPtr<Siblings>> m_parents;
+};
+
+}
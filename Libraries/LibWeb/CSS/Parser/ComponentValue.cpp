@@ -55,7 +55,9 @@ String ComponentValue::to_debug_string() const
 
 String ComponentValue::original_source_text() const
 {
-    return m_value.visit([](auto const& it) { return it.original_source_text(); });
+    return m_value.visit(
+        [](Token const& token) { return String::from_utf8_without_validation(token.original_source_text().bytes()); },
+        [](auto const& it) { return it.original_source_text(); });
 }
 
 }
@@ -13,6 +13,7 @@
  */
 
 #include <AK/Debug.h>
+#include <AK/NeverDestroyed.h>
 #include <LibURL/Parser.h>
 #include <LibWeb/CSS/CSSMarginRule.h>
 #include <LibWeb/CSS/CSSStyleDeclaration.h>
@@ -173,6 +174,70 @@ GC::Ref<CSS::CSSStyleSheet> Parser::parse_as_css_stylesheet(Optional<::URL::URL>
     return CSSStyleSheet::create(realm(), rule_list, media_list, move(location));
 }
 
+namespace {
+
+struct CachedStyleSheetContents : public RefCounted<CachedStyleSheetContents> {
+    String source;
+    unsigned source_hash { 0 };
+    Vector<Rule> rules;
+};
+
+}
+
+// Small stylesheets are cheap to parse, so they aren't worth keeping a copy of their contents around.
+static constexpr size_t minimum_length_of_cached_style_sheet = 4 * KiB;
+static constexpr size_t maximum_total_length_of_cached_style_sheets = 32 * MiB;
+
+// Ordered from least to most recently used.
+static Vector<NonnullRefPtr<CachedStyleSheetContents>>& cached_style_sheet_contents()
+{
+    static NeverDestroyed<Vector<NonnullRefPtr<CachedStyleSheetContents>>> cache;
+    return *cache;
+}
+
+void Parser::clear_style_sheet_cache()
+{
+    cached_style_sheet_contents().clear();
+}
+
+GC::Ref<CSS::CSSStyleSheet> Parser::parse_as_css_stylesheet_using_cache(ParsingParams const& context, StringView input, Optional<::URL::URL> location, Vector<NonnullRefPtr<MediaQuery>> media_query_list)
+{
+    // The syntax-level parse only depends on the rule context, so only stylesheets parsed at the top level can share it.
+    if (input.length() < minimum_length_of_cached_style_sheet || !context.rule_context.is_empty())
+        return create(context, input).parse_as_css_stylesheet(move(location), move(media_query_list));
+
+    auto& cache = cached_style_sheet_contents();
+    auto source_hash = input.hash();
+
+    RefPtr<CachedStyleSheetContents> contents;
+    for (size_t i = 0; i < cache.size(); ++i) {
+        if (cache[i]->source_hash == source_hash && cache[i]->source == input) {
+            contents = cache.take(i);
+            break;
+        }
+    }
+
+    if (!contents) {
+        auto parser = create(context, input);
+        contents = adopt_ref(*new CachedStyleSheetContents);
+        contents->source = MUST(String::from_utf8(input));
+        contents->source_hash = source_hash;
+        contents->rules = parser.parse_a_stylesheet(parser.m_token_stream, {}).rules;
+    }
+    cache.append(*contents);
+
+    size_t total_length = 0;
+    for (auto const& entry : cache)
+        total_length += entry->source.bytes().size();
+    while (total_length > maximum_total_length_of_cached_style_sheets && cache.size() > 1)
+        total_length -= cache.take_first()->source.bytes().size();
+
+    Parser parser { context, {} };
+    auto rule_list = CSSRuleList::create(parser.realm(), parser.convert_rules(contents->rules));
+    auto media_list = MediaList::create(parser.realm(), move(media_query_list));
+    return CSSStyleSheet::create(parser.realm(), rule_list, media_list, move(location));
+}
+
 RefPtr<Supports> Parser::parse_as_supports()
 {
     return parse_a_supports(m_token_stream);
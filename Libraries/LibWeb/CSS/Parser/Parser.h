@@ -97,6 +97,12 @@ public:
     GC::RootVector<GC::Ref<CSSRule>> convert_rules(Vector<Rule> const& raw_rules);
     GC::Ref<CSS::CSSStyleSheet> parse_as_css_stylesheet(Optional<::URL::URL> location, Vector<NonnullRefPtr<MediaQuery>> media_query_list = {});
 
+    // Like create(...).parse_as_css_stylesheet(), but large stylesheets share their syntax-level parse (the tokens and
+    // the tree of raw rules) with identical stylesheets parsed before in this process, like the same framework
+    // stylesheet loaded by several frames. Only the conversion into CSSOM objects for the given realm is repeated.
+    static GC::Ref<CSS::CSSStyleSheet> parse_as_css_stylesheet_using_cache(ParsingParams const&, StringView input, Optional<::URL::URL> location, Vector<NonnullRefPtr<MediaQuery>> media_query_list = {});
+    static void clear_style_sheet_cache();
+
     struct PropertiesAndCustomProperties {
         Vector<StyleProperty> properties;
         HashMap<FlyString, StyleProperty> custom_properties;
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/FlyString.h>
+#include <AK/String.h>
 #include <LibWeb/CSS/Number.h>
 
 namespace Web::CSS::Parser {
@@ -146,7 +147,7 @@ public:
     String to_string() const;
     String to_debug_string() const;
 
-    String const& original_source_text() const { return m_original_source_text; }
+    StringView original_source_text() const { return m_original_source_text.view(); }
     Position const& start_position() const { return m_start_position; }
     Position const& end_position() const { return m_end_position; }
 
@@ -199,6 +200,16 @@ public:
         return token;
     }
 
+    // The part of the tokenizer's input a token was created from. Keeping a reference to the whole input instead of
+    // a substring of it means tokenizing doesn't need to allocate anything for it.
+    struct SourceText {
+        String source;
+        u32 start_byte_offset { 0 };
+        u32 byte_length { 0 };
+
+        StringView view() const { return source.bytes_as_string_view().substring_view(start_byte_offset, byte_length); }
+    };
+
 private:
     Type m_type { Type::Invalid };
 
@@ -206,7 +217,7 @@ private:
     Number m_number_value;
     HashType m_hash_type { HashType::Unrestricted };
 
-    String m_original_source_text;
+    SourceText m_original_source_text;
     Position m_start_position;
     Position m_end_position;
 };
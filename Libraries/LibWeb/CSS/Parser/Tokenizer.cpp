@@ -332,7 +332,7 @@ Token Tokenizer::create_eof_token()
     return create_new_token(Token::Type::EndOfFile);
 }
 
-Token Tokenizer::create_value_token(Token::Type type, FlyString&& value, String&& representation)
+Token Tokenizer::create_value_token(Token::Type type, FlyString&& value, Token::SourceText&& representation)
 {
     auto token = create_new_token(type);
     token.m_value = move(value);
@@ -340,7 +340,7 @@ Token Tokenizer::create_value_token(Token::Type type, FlyString&& value, String&
     return token;
 }
 
-Token Tokenizer::create_value_token(Token::Type type, u32 value, String&& representation)
+Token Tokenizer::create_value_token(Token::Type type, u32 value, Token::SourceText&& representation)
 {
     auto token = create_new_token(type);
     token.m_value = String::from_code_point(value);
@@ -1320,9 +1320,9 @@ size_t Tokenizer::current_byte_offset() const
     return m_utf8_iterator.ptr() - m_utf8_view.bytes();
 }
 
-String Tokenizer::input_since(size_t offset) const
+Token::SourceText Tokenizer::input_since(size_t offset) const
 {
-    return MUST(m_decoded_input.substring_from_byte_offset_with_shared_superstring(offset, current_byte_offset() - offset));
+    return { m_decoded_input, static_cast<u32>(offset), static_cast<u32>(current_byte_offset() - offset) };
 }
 
 }
@@ -69,7 +69,7 @@ private:
     [[nodiscard]] Vector<Token> tokenize();
 
     size_t current_byte_offset() const;
-    String input_since(size_t offset) const;
+    Token::SourceText input_since(size_t offset) const;
 
     [[nodiscard]] u32 next_code_point();
     [[nodiscard]] u32 peek_code_point(size_t offset = 0) const;
@@ -80,8 +80,8 @@ private:
     [[nodiscard]] U32Triplet start_of_input_stream_triplet();
 
     [[nodiscard]] static Token create_new_token(Token::Type);
-    [[nodiscard]] static Token create_value_token(Token::Type, FlyString&& value, String&& representation);
-    [[nodiscard]] static Token create_value_token(Token::Type, u32 value, String&& representation);
+    [[nodiscard]] static Token create_value_token(Token::Type, FlyString&& value, Token::SourceText&& representation);
+    [[nodiscard]] static Token create_value_token(Token::Type, u32 value, Token::SourceText&& representation);
     [[nodiscard]] Token consume_a_token();
     [[nodiscard]] Token consume_string_token(u32 ending_code_point);
     [[nodiscard]] Token consume_a_numeric_token();
@@ -7,6 +7,7 @@
 
 #include "Selector.h"
 #include <AK/GenericShorthands.h>
+#include <AK/InsertionSort.h>
 #include <LibWeb/CSS/Serialize.h>
 
 namespace Web::CSS {
@@ -131,6 +132,59 @@ Selector::Selector(Vector<CompoundSelector>&& compound_selectors)
     collect_ancestor_hashes();
 
     m_can_use_fast_matches = can_selector_use_fast_matches(*this);
+    if (m_can_use_fast_matches)
+        compile_fast_match_program();
+}
+
+void Selector::compile_fast_match_program()
+{
+    auto emit_namespace_check_if_needed = [&](SimpleSelector const& simple_selector) {
+        if (simple_selector.qualified_name().namespace_type != SimpleSelector::QualifiedName::NamespaceType::Any)
+            m_fast_match_steps.append({ .type = FastMatchStep::Type::Namespace, .simple_selector = &simple_selector });
+    };
+
+    m_fast_match_compounds.ensure_capacity(m_compound_selectors.size());
+    for (size_t i = m_compound_selectors.size(); i > 0; --i) {
+        auto const& compound_selector = m_compound_selectors[i - 1];
+        auto first_step = static_cast<u32>(m_fast_match_steps.size());
+
+        for (auto const& simple_selector : compound_selector.simple_selectors) {
+            switch (simple_selector.type) {
+            case SimpleSelector::Type::Id:
+                m_fast_match_steps.append({ .type = FastMatchStep::Type::Id, .name = &simple_selector.name(), .simple_selector = &simple_selector });
+                break;
+            case SimpleSelector::Type::Class:
+                m_fast_match_steps.append({ .type = FastMatchStep::Type::Class, .name = &simple_selector.name(), .simple_selector = &simple_selector });
+                break;
+            case SimpleSelector::Type::TagName:
+                m_fast_match_steps.append({ .type = FastMatchStep::Type::TagName, .name = &simple_selector.qualified_name().name.lowercase_name, .simple_selector = &simple_selector });
+                emit_namespace_check_if_needed(simple_selector);
+                break;
+            case SimpleSelector::Type::Universal:
+                emit_namespace_check_if_needed(simple_selector);
+                break;
+            case SimpleSelector::Type::Attribute:
+                m_fast_match_steps.append({ .type = FastMatchStep::Type::Attribute, .simple_selector = &simple_selector });
+                break;
+            case SimpleSelector::Type::PseudoClass:
+                m_fast_match_steps.append({ .type = FastMatchStep::Type::PseudoClass, .simple_selector = &simple_selector });
+                break;
+            default:
+                VERIFY_NOT_REACHED();
+            }
+        }
+
+        // Ids and classes are cheap atom comparisons that reject most elements, pseudo-classes are the most expensive.
+        // The sort must be stable, so that each namespace check stays after its tag name.
+        auto steps = m_fast_match_steps.span().slice(first_step);
+        insertion_sort(steps, [](auto const& a, auto const& b) { return a.type < b.type; });
+
+        m_fast_match_compounds.unchecked_append({
+            .first_step = first_step,
+            .step_count = static_cast<u32>(m_fast_match_steps.size()) - first_step,
+            .combinator = i > 1 ? compound_selector.combinator : Combinator::None,
+        });
+    }
 }
 
 void Selector::collect_ancestor_hashes()
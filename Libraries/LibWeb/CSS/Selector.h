@@ -250,6 +250,33 @@ public:
     auto const& ancestor_hashes() const { return m_ancestor_hashes; }
 
     bool can_use_fast_matches() const { return m_can_use_fast_matches; }
+
+    // Selectors that can use fast matches are also compiled into a flat program for the fast matcher: their compound
+    // selectors from right to left, each with its simple selectors reordered so that the checks that are cheapest and
+    // most likely to reject run first.
+    struct FastMatchStep {
+        enum class Type : u8 {
+            Id,
+            Class,
+            TagName,
+            Namespace,
+            Attribute,
+            PseudoClass,
+        };
+        Type type;
+        // Pre-resolved atom to compare with: the name for Id and Class, and the lowercase name for TagName.
+        FlyString const* name { nullptr };
+        SimpleSelector const* simple_selector { nullptr };
+    };
+    struct FastMatchCompound {
+        // This compound's steps in fast_match_steps().
+        u32 first_step { 0 };
+        u32 step_count { 0 };
+        // The combinator between this compound and the next one in the program, i.e. the one to its left.
+        Combinator combinator { Combinator::None };
+    };
+    Vector<FastMatchStep> const& fast_match_steps() const { return m_fast_match_steps; }
+    Vector<FastMatchCompound> const& fast_match_compounds() const { return m_fast_match_compounds; }
     bool can_use_ancestor_filter() const { return m_can_use_ancestor_filter; }
 
     size_t sibling_invalidation_distance() const;
@@ -268,6 +295,10 @@ private:
     PseudoClassBitmap m_contained_pseudo_classes;
 
     void collect_ancestor_hashes();
+    void compile_fast_match_program();
+
+    Vector<FastMatchStep> m_fast_match_steps;
+    Vector<FastMatchCompound> m_fast_match_compounds;
 
     Array<u32, 8> m_ancestor_hashes;
 };
@@ -7,6 +7,7 @@
 
 #include <LibWeb/CSS/ComputedProperties.h>
 #include <LibWeb/CSS/Keyword.h>
+#include <LibWeb/CSS/NthIndexCache.h>
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/DOM/Attr.h>
@@ -697,6 +698,10 @@ static inline bool matches_pseudo_class(CSS::Selector::SimpleSelector::PseudoCla
         case CSS::PseudoClass::__Count:
             VERIFY_NOT_REACHED();
         case CSS::PseudoClass::NthChild: {
+            if (context.nth_index_cache && pseudo_class.argument_selector_list.is_empty()) {
+                index = context.nth_index_cache->nth_child_index(element, CSS::NthIndexCache::Direction::FromStart);
+                break;
+            }
             if (!matches_selector_list(pseudo_class.argument_selector_list, element))
                 return false;
             for (auto* child = parent->first_child_of_type<DOM::Element>(); child && child != &element; child = child->next_element_sibling()) {
@@ -706,6 +711,10 @@ static inline bool matches_pseudo_class(CSS::Selector::SimpleSelector::PseudoCla
             break;
         }
         case CSS::PseudoClass::NthLastChild: {
+            if (context.nth_index_cache && pseudo_class.argument_selector_list.is_empty()) {
+                index = context.nth_index_cache->nth_child_index(element, CSS::NthIndexCache::Direction::FromEnd);
+                break;
+            }
             if (!matches_selector_list(pseudo_class.argument_selector_list, element))
                 return false;
             for (auto* child = parent->last_child_of_type<DOM::Element>(); child && child != &element; child = child->previous_element_sibling()) {
@@ -715,11 +724,19 @@ static inline bool matches_pseudo_class(CSS::Selector::SimpleSelector::PseudoCla
             break;
         }
         case CSS::PseudoClass::NthOfType: {
+            if (context.nth_index_cache) {
+                index = context.nth_index_cache->nth_of_type_index(element, CSS::NthIndexCache::Direction::FromStart);
+                break;
+            }
             for (auto* child = previous_sibling_with_same_tag_name(element); child; child = previous_sibling_with_same_tag_name(*child))
                 ++index;
             break;
         }
         case CSS::PseudoClass::NthLastOfType: {
+            if (context.nth_index_cache) {
+                index = context.nth_index_cache->nth_of_type_index(element, CSS::NthIndexCache::Direction::FromEnd);
+                break;
+            }
             for (auto* child = next_sibling_with_same_tag_name(element); child; child = next_sibling_with_same_tag_name(*child))
                 ++index;
             break;
@@ -1074,6 +1091,34 @@ static inline bool matches_pseudo_class(CSS::Selector::SimpleSelector::PseudoCla
     return false;
 }
 
+bool matches_same_pseudo_classes(DOM::Element const& element, DOM::Element const& other, CSS::PseudoClassBitmap const& pseudo_classes)
+{
+    for (size_t i = 0; i < to_underlying(CSS::PseudoClass::__Count); ++i) {
+        auto pseudo_class = static_cast<CSS::PseudoClass>(i);
+        if (!pseudo_classes.get(pseudo_class))
+            continue;
+
+        switch (CSS::pseudo_class_metadata(pseudo_class).parameter_type) {
+        case CSS::PseudoClassMetadata::ParameterType::None: {
+            CSS::Selector::SimpleSelector::PseudoClassSelector selector { .type = pseudo_class };
+            MatchContext element_context;
+            MatchContext other_context;
+            if (matches_pseudo_class(selector, element, {}, element_context, {}, SelectorKind::Normal) != matches_pseudo_class(selector, other, {}, other_context, {}, SelectorKind::Normal))
+                return false;
+            break;
+        }
+        case CSS::PseudoClassMetadata::ParameterType::ForgivingSelectorList:
+        case CSS::PseudoClassMetadata::ParameterType::SelectorList:
+            // NOTE: :is(), :where() and :not() only combine other selectors, which have been recorded individually.
+            break;
+        default:
+            // We can't evaluate these without their arguments, so we have to assume they could differ.
+            return false;
+        }
+    }
+    return true;
+}
+
 static ALWAYS_INLINE bool matches_namespace(
     CSS::Selector::SimpleSelector::QualifiedName const& qualified_name,
     DOM::Element const& element,
@@ -1232,48 +1277,53 @@ bool matches(CSS::Selector const& selector, DOM::Element const& element, GC::Ptr
     return matches(selector, selector.compound_selectors().size() - 1, element, shadow_host, context, scope, selector_kind, anchor);
 }
 
-static bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& simple_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
+// The fast matcher runs the flat program in Selector::fast_match_steps() and Selector::fast_match_compounds().
+// Selectors only get such a program if all their combinators are descendant or child combinators, and all their
+// pseudo-classes are simple enough.
+struct FastMatchState {
+    GC::Ptr<DOM::Element const> shadow_host;
+    MatchContext& context;
+    bool is_html_document { false };
+    CaseSensitivity class_case_sensitivity { CaseSensitivity::CaseSensitive };
+};
+
+static ALWAYS_INLINE bool fast_matches_step(CSS::Selector::FastMatchStep const& step, DOM::Element const& element, FastMatchState& state)
 {
-    if (should_block_shadow_host_matching(simple_selector, shadow_host, element))
-        return false;
-
-    switch (simple_selector.type) {
-    case CSS::Selector::SimpleSelector::Type::Universal:
-        return matches_namespace(simple_selector.qualified_name(), element, context.style_sheet_for_rule);
-    case CSS::Selector::SimpleSelector::Type::TagName:
+    switch (step.type) {
+    case CSS::Selector::FastMatchStep::Type::Id:
+        return *step.name == element.id();
+    case CSS::Selector::FastMatchStep::Type::Class:
+        // Class selectors are matched case insensitively in quirks mode.
+        // See: https://drafts.csswg.org/selectors-4/#class-html
+        return element.has_class(*step.name, state.class_case_sensitivity);
+    case CSS::Selector::FastMatchStep::Type::TagName:
         // https://html.spec.whatwg.org/multipage/semantics-other.html#case-sensitivity-of-selectors
         // When comparing a CSS element type selector to the names of HTML elements in HTML documents, the CSS element type selector must first be converted to ASCII lowercase. The
         // same selector when compared to other elements must be compared according to its original case. In both cases, to match the values must be identical to each other (and therefore
         // the comparison is case sensitive).
-        if (element.namespace_uri() == Namespace::HTML && element.document().document_type() == DOM::Document::Type::HTML) {
-            if (simple_selector.qualified_name().name.lowercase_name != element.local_name())
-                return false;
-        } else if (simple_selector.qualified_name().name.name != element.local_name()) {
-            // NOTE: Any other elements are either SVG, XHTML or MathML, all of which are case-sensitive.
-            return false;
-        }
-        return matches_namespace(simple_selector.qualified_name(), element, context.style_sheet_for_rule);
-    case CSS::Selector::SimpleSelector::Type::Class: {
-        // Class selectors are matched case insensitively in quirks mode.
-        // See: https://drafts.csswg.org/selectors-4/#class-html
-        auto case_sensitivity = element.document().in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive;
-        return element.has_class(simple_selector.name(), case_sensitivity);
-    }
-    case CSS::Selector::SimpleSelector::Type::Id:
-        return simple_selector.name() == element.id();
-    case CSS::Selector::SimpleSelector::Type::Attribute:
-        return matches_attribute(simple_selector.attribute(), context.style_sheet_for_rule, element);
-    case CSS::Selector::SimpleSelector::Type::PseudoClass:
-        return matches_pseudo_class(simple_selector.pseudo_class(), element, shadow_host, context, nullptr, SelectorKind::Normal);
-    default:
-        VERIFY_NOT_REACHED();
+        if (state.is_html_document && element.namespace_uri() == Namespace::HTML)
+            return *step.name == element.local_name();
+        // NOTE: Any other elements are either SVG, XHTML or MathML, all of which are case-sensitive.
+        return step.simple_selector->qualified_name().name.name == element.local_name();
+    case CSS::Selector::FastMatchStep::Type::Namespace:
+        return matches_namespace(step.simple_selector->qualified_name(), element, state.context.style_sheet_for_rule);
+    case CSS::Selector::FastMatchStep::Type::Attribute:
+        return matches_attribute(step.simple_selector->attribute(), state.context.style_sheet_for_rule, element);
+    case CSS::Selector::FastMatchStep::Type::PseudoClass:
+        return matches_pseudo_class(step.simple_selector->pseudo_class(), element, state.shadow_host, state.context, nullptr, SelectorKind::Normal);
     }
+    VERIFY_NOT_REACHED();
 }
 
-static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const& compound_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
+static ALWAYS_INLINE bool fast_matches_compound(CSS::Selector const& selector, CSS::Selector::FastMatchCompound const& compound, DOM::Element const& element, FastMatchState& state)
 {
-    for (auto const& simple_selector : compound_selector.simple_selectors) {
-        if (!fast_matches_simple_selector(simple_selector, element, shadow_host, context))
+    // From within a shadow tree, only :host can match the shadow host, and fast-matchable selectors never contain it.
+    if (state.shadow_host && &element == state.shadow_host.ptr())
+        return false;
+
+    auto const* steps = selector.fast_match_steps().data() + compound.first_step;
+    for (u32 i = 0; i < compound.step_count; ++i) {
+        if (!fast_matches_step(steps[i], element, state))
             return false;
     }
     return true;
@@ -1281,51 +1331,55 @@ static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const
 
 bool fast_matches(CSS::Selector const& selector, DOM::Element const& element_to_match, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
 {
-    DOM::Element const* current = &element_to_match;
-
-    ssize_t compound_selector_index = selector.compound_selectors().size() - 1;
+    auto const& compounds = selector.fast_match_compounds();
+    VERIFY(!compounds.is_empty());
+
+    FastMatchState state {
+        .shadow_host = shadow_host,
+        .context = context,
+        .is_html_document = element_to_match.document().document_type() == DOM::Document::Type::HTML,
+        .class_case_sensitivity = element_to_match.document().in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive,
+    };
 
-    if (!fast_matches_compound_selector(selector.compound_selectors().last(), *current, shadow_host, context))
+    DOM::Element const* current = &element_to_match;
+    if (!fast_matches_compound(selector, compounds[0], *current, state))
         return false;
 
-    // NOTE: If we fail after following a child combinator, we may need to backtrack
-    //       to the last matched descendant. We store the state here.
+    // NOTE: If we fail after following a child combinator, we backtrack to the most recent descendant combinator,
+    //       and continue looking for its compound further up the tree. We store the state here.
     struct {
-        GC::Ptr<DOM::Element const> element;
-        ssize_t compound_selector_index = 0;
+        DOM::Element const* element { nullptr };
+        size_t compound_index { 0 };
     } backtrack_state;
 
+    size_t compound_index = 0;
     for (;;) {
-        // NOTE: There should always be a leftmost compound selector without combinator that kicks us out of this loop.
-        VERIFY(compound_selector_index >= 0);
-
-        auto const* compound_selector = &selector.compound_selectors()[compound_selector_index];
-
-        switch (compound_selector->combinator) {
+        auto combinator = compounds[compound_index].combinator;
+        switch (combinator) {
         case CSS::Selector::Combinator::None:
             return true;
         case CSS::Selector::Combinator::Descendant:
-            backtrack_state = { current->parent_element(), compound_selector_index };
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
+            ++compound_index;
             for (current = current->parent_element(); current; current = current->parent_element()) {
-                if (fast_matches_compound_selector(*compound_selector, *current, shadow_host, context))
+                if (fast_matches_compound(selector, compounds[compound_index], *current, state))
                     break;
             }
             if (!current)
                 return false;
+            backtrack_state = { current, compound_index };
             break;
         case CSS::Selector::Combinator::ImmediateChild:
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
+            ++compound_index;
             current = current->parent_element();
             if (!current)
                 return false;
-            if (!fast_matches_compound_selector(*compound_selector, *current, shadow_host, context)) {
-                if (backtrack_state.element) {
-                    current = backtrack_state.element;
-                    compound_selector_index = backtrack_state.compound_selector_index;
-                    continue;
-                }
-                return false;
+            if (!fast_matches_compound(selector, compounds[compound_index], *current, state)) {
+                if (!backtrack_state.element)
+                    return false;
+                // Resume the descendant search above the element it matched last time.
+                current = backtrack_state.element;
+                compound_index = backtrack_state.compound_index - 1;
+                backtrack_state = {};
             }
             break;
         default:
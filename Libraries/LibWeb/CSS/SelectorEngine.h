@@ -21,8 +21,13 @@ struct MatchContext {
     GC::Ptr<DOM::Element const> subject {};
     bool collect_per_element_selector_involvement_metadata { false };
     CSS::PseudoClassBitmap attempted_pseudo_class_matches {};
+    CSS::NthIndexCache* nth_index_cache { nullptr };
 };
 
 bool matches(CSS::Selector const&, DOM::Element const&, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context, Optional<CSS::PseudoElement> = {}, GC::Ptr<DOM::ParentNode const> scope = {}, SelectorKind selector_kind = SelectorKind::Normal, GC::Ptr<DOM::Element const> anchor = nullptr);
 
+// Returns whether `element` and `other` match exactly the same subset of `pseudo_classes`.
+// Pseudo-classes that take an argument other than a selector list are assumed to differ.
+bool matches_same_pseudo_classes(DOM::Element const& element, DOM::Element const& other, CSS::PseudoClassBitmap const& pseudo_classes);
+
 }
@@ -21,8 +21,6 @@
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/FontStyleMapping.h>
 #include <LibGfx/Font/Typeface.h>
-#include <LibGfx/Font/WOFF/Loader.h>
-#include <LibGfx/Font/WOFF2/Loader.h>
 #include <LibWeb/Animations/AnimationEffect.h>
 #include <LibWeb/Animations/DocumentTimeline.h>
 #include <LibWeb/Bindings/PrincipalHostDefined.h>
@@ -37,9 +35,11 @@
 #include <LibWeb/CSS/CSSStyleRule.h>
 #include <LibWeb/CSS/CSSTransition.h>
 #include <LibWeb/CSS/ComputedProperties.h>
+#include <LibWeb/CSS/DecodedFontCache.h>
 #include <LibWeb/CSS/Fetch.h>
 #include <LibWeb/CSS/Interpolation.h>
 #include <LibWeb/CSS/InvalidationSet.h>
+#include <LibWeb/CSS/NthIndexCache.h>
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/CSS/StyleComputer.h>
@@ -74,6 +74,7 @@
 #include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/Fetch/Infrastructure/FetchController.h>
 #include <LibWeb/Fetch/Response.h>
@@ -121,6 +122,17 @@ struct Traits<Web::CSS::OwnFontFaceKey> : public DefaultTraits<Web::CSS::OwnFont
     static unsigned hash(Web::CSS::OwnFontFaceKey const& key) { return pair_int_hash(key.family_name.hash(), pair_int_hash(key.weight, key.slope)); }
 };
 
+template<>
+struct Traits<Web::CSS::FontCascadeListKey> : public DefaultTraits<Web::CSS::FontCascadeListKey> {
+    static unsigned hash(Web::CSS::FontCascadeListKey const& key)
+    {
+        auto hash = pair_int_hash(pair_int_hash(key.weight, key.slope), pair_int_hash(key.width, bit_cast<u32>(key.font_size_in_pt)));
+        for (auto const& family_name : key.family_names)
+            hash = pair_int_hash(hash, family_name.hash());
+        return hash;
+    }
+};
+
 }
 
 namespace Web::CSS {
@@ -238,23 +250,26 @@ void FontLoader::start_loading_next_url()
             // 2. Load a font from stream according to its type.
 
             // NB: We need to fetch the next source if this one fails to fetch OR decode. So, first try to decode it.
-            RefPtr<Gfx::Typeface const> typeface;
-            if (auto* bytes = stream.template get_pointer<ByteBuffer>()) {
-                if (auto maybe_typeface = loader.try_load_font(response, *bytes); !maybe_typeface.is_error())
-                    typeface = maybe_typeface.release_value();
+            auto* bytes = stream.template get_pointer<ByteBuffer>();
+            Optional<Gfx::FontFormat> format;
+            if (bytes)
+                format = font_format_for(response, *bytes);
+            if (!format.has_value()) {
+                loader.font_did_fail_to_decode();
+                return;
             }
 
-            if (!typeface) {
-                // NB: If we have other sources available, try the next one.
-                if (loader.m_urls.is_empty()) {
-                    loader.font_did_load_or_fail(nullptr);
-                } else {
-                    loader.m_fetch_controller = nullptr;
-                    loader.start_loading_next_url();
+            // OPTIMIZATION: Decoding (and especially decompressing WOFF2) happens in the background, and the result is
+            //               shared with every other document in this process that loads the same font.
+            DecodedFontCache::the().decode(*bytes, format, [weak_loader](RefPtr<Gfx::Typeface const> typeface) {
+                if (weak_loader.is_null())
+                    return;
+                if (!typeface) {
+                    weak_loader->font_did_fail_to_decode();
+                    return;
                 }
-            } else {
-                loader.font_did_load_or_fail(move(typeface));
-            }
+                weak_loader->font_did_load_or_fail(move(typeface));
+            });
         });
 
     if (maybe_fetch_controller.is_error()) {
@@ -278,7 +293,18 @@ void FontLoader::font_did_load_or_fail(RefPtr<Gfx::Typeface const> typeface)
     m_fetch_controller = nullptr;
 }
 
-ErrorOr<NonnullRefPtr<Gfx::Typeface const>> FontLoader::try_load_font(Fetch::Infrastructure::Response const& response, ByteBuffer const& bytes)
+void FontLoader::font_did_fail_to_decode()
+{
+    // NB: If we have other sources available, try the next one.
+    if (m_urls.is_empty()) {
+        font_did_load_or_fail(nullptr);
+    } else {
+        m_fetch_controller = nullptr;
+        start_loading_next_url();
+    }
+}
+
+Optional<Gfx::FontFormat> FontLoader::font_format_for(Fetch::Infrastructure::Response const& response, ByteBuffer const& bytes)
 {
     // FIXME: This could maybe use the format() provided in @font-face as well, since often the mime type is just application/octet-stream and we have to try every format
     auto mime_type = response.header_list()->extract_mime_type();
@@ -286,24 +312,17 @@ ErrorOr<NonnullRefPtr<Gfx::Typeface const>> FontLoader::try_load_font(Fetch::Inf
         mime_type = MimeSniff::Resource::sniff(bytes, MimeSniff::SniffingConfiguration { .sniffing_context = MimeSniff::SniffingContext::Font });
     }
     if (mime_type.has_value()) {
-        if (mime_type->essence() == "font/ttf"sv || mime_type->essence() == "application/x-font-ttf"sv || mime_type->essence() == "font/otf"sv) {
-            if (auto result = Gfx::Typeface::try_load_from_temporary_memory(bytes); !result.is_error()) {
-                return result;
-            }
-        }
-        if (mime_type->essence() == "font/woff"sv || mime_type->essence() == "application/font-woff"sv) {
-            if (auto result = WOFF::try_load_from_bytes(bytes); !result.is_error()) {
-                return result;
-            }
-        }
-        if (mime_type->essence() == "font/woff2"sv || mime_type->essence() == "application/font-woff2"sv) {
-            if (auto result = WOFF2::try_load_from_bytes(bytes); !result.is_error()) {
-                return result;
-            }
-        }
+        if (mime_type->essence() == "font/ttf"sv || mime_type->essence() == "application/x-font-ttf"sv)
+            return Gfx::FontFormat::TrueType;
+        if (mime_type->essence() == "font/otf"sv)
+            return Gfx::FontFormat::OpenType;
+        if (mime_type->essence() == "font/woff"sv || mime_type->essence() == "application/font-woff"sv)
+            return Gfx::FontFormat::WOFF;
+        if (mime_type->essence() == "font/woff2"sv || mime_type->essence() == "application/font-woff2"sv)
+            return Gfx::FontFormat::WOFF2;
     }
 
-    return Error::from_string_literal("Automatic format detection failed");
+    return {};
 }
 
 struct StyleComputer::MatchingFontCandidate {
@@ -458,6 +477,19 @@ InvalidationSet StyleComputer::invalidation_set_for_properties(Vector<Invalidati
     return result;
 }
 
+SiblingInvalidationSet StyleComputer::sibling_invalidation_set_for_properties(Vector<InvalidationSet::Property> const& properties) const
+{
+    if (!m_style_invalidation_data)
+        return {};
+    auto const& sibling_invalidation_sets = m_style_invalidation_data->sibling_invalidation_sets;
+    SiblingInvalidationSet result;
+    for (auto const& property : properties) {
+        if (auto it = sibling_invalidation_sets.find(property); it != sibling_invalidation_sets.end())
+            result.include_all_from(it->value);
+    }
+    return result;
+}
+
 bool StyleComputer::invalidation_property_used_in_has_selector(InvalidationSet::Property const& property) const
 {
     if (!m_style_invalidation_data)
@@ -491,6 +523,10 @@ bool StyleComputer::invalidation_property_used_in_has_selector(InvalidationSet::
 
 Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::Element const& element, CascadeOrigin cascade_origin, Optional<CSS::PseudoElement> pseudo_element, PseudoClassBitmap& attempted_pseudo_class_matches, FlyString const& qualified_layer_name) const
 {
+    auto start_time = MonotonicTime::now();
+    u64 ancestor_filter_checks = 0;
+    u64 ancestor_filter_rejects = 0;
+
     auto const& root_node = element.root();
     auto shadow_root = is<DOM::ShadowRoot>(root_node) ? static_cast<DOM::ShadowRoot const*>(&root_node) : nullptr;
     auto element_shadow_root = element.shadow_root();
@@ -523,8 +559,13 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::Element c
             return;
 
         auto const& selector = rule_to_run.selector;
-        if (selector.can_use_ancestor_filter() && should_reject_with_ancestor_filter(selector))
-            return;
+        if (selector.can_use_ancestor_filter()) {
+            ++ancestor_filter_checks;
+            if (should_reject_with_ancestor_filter(selector)) {
+                ++ancestor_filter_rejects;
+                return;
+            }
+        }
 
         rules_to_run.unchecked_append(rule_to_run);
     };
@@ -582,6 +623,7 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::Element c
             .style_sheet_for_rule = *rule_to_run.sheet,
             .subject = element,
             .collect_per_element_selector_involvement_metadata = true,
+            .nth_index_cache = m_nth_index_cache.ptr(),
         };
         ScopeGuard guard = [&] {
             attempted_pseudo_class_matches |= context.attempted_pseudo_class_matches;
@@ -591,9 +633,34 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::Element c
         matching_rules.append(&rule_to_run);
     }
 
+    auto& counts = [&] -> StyleComputationStatistics::RuleMatchingCounts& {
+        switch (cascade_origin) {
+        case CascadeOrigin::Author:
+            return m_statistics.author_rules;
+        case CascadeOrigin::User:
+            return m_statistics.user_rules;
+        case CascadeOrigin::UserAgent:
+            return m_statistics.user_agent_rules;
+        case CascadeOrigin::Animation:
+        case CascadeOrigin::Transition:
+            break;
+        }
+        VERIFY_NOT_REACHED();
+    }();
+    counts.rules_tested += rules_to_run.size();
+    counts.rules_matched += matching_rules.size();
+    m_statistics.ancestor_filter_checks += ancestor_filter_checks;
+    m_statistics.ancestor_filter_rejects += ancestor_filter_rejects;
+    m_statistics.time_in_collect_matching_rules += MonotonicTime::now() - start_time;
+
     return matching_rules;
 }
 
+void StyleComputer::did_finish_style_update(Badge<DOM::Document>)
+{
+    m_last_style_update_statistics = exchange(m_statistics, {});
+}
+
 static void sort_matching_rules(Vector<MatchingRule const*>& matching_rules)
 {
     quick_sort(matching_rules, [&](MatchingRule const* a, MatchingRule const* b) {
@@ -2062,8 +2129,7 @@ NonnullRefPtr<CSSStyleValue const> StyleComputer::get_inherit_value(CSS::Propert
 
 void StyleComputer::compute_defaulted_property_value(ComputedProperties& style, DOM::Element const* element, CSS::PropertyID property_id, Optional<CSS::PseudoElement> pseudo_element) const
 {
-    auto& value_slot = style.m_property_values[to_underlying(property_id)];
-    if (!value_slot) {
+    if (!style.value_slot(property_id)) {
         if (is_inherited_property(property_id)) {
             style.set_property(
                 property_id,
@@ -2407,7 +2473,7 @@ RefPtr<Gfx::FontCascadeList const> StyleComputer::compute_font_for_style_values(
         return {};
     };
 
-    auto find_generic_font = [&](Keyword font_id) -> RefPtr<Gfx::FontCascadeList const> {
+    auto generic_font_family_name = [&](Keyword font_id) -> Optional<FlyString> {
         Platform::GenericFont generic_font {};
         switch (font_id) {
         case Keyword::Monospace:
@@ -2438,32 +2504,39 @@ RefPtr<Gfx::FontCascadeList const> StyleComputer::compute_font_for_style_values(
         default:
             return {};
         }
-        return find_font(Platform::FontPlugin::the().generic_font_name(generic_font));
+        return Platform::FontPlugin::the().generic_font_name(generic_font);
     };
 
-    auto font_list = Gfx::FontCascadeList::create();
-    if (font_family.is_value_list()) {
-        auto const& family_list = static_cast<StyleValueList const&>(font_family).values();
-        for (auto const& family : family_list) {
-            RefPtr<Gfx::FontCascadeList const> other_font_list;
-            if (family->is_keyword()) {
-                other_font_list = find_generic_font(family->to_keyword());
-            } else if (family->is_string()) {
-                other_font_list = find_font(family->as_string().string_value());
-            } else if (family->is_custom_ident()) {
-                other_font_list = find_font(family->as_custom_ident().custom_ident());
-            }
-            if (other_font_list)
-                font_list->extend(*other_font_list);
+    FontCascadeListKey cache_key {
+        .family_names = {},
+        .weight = weight,
+        .slope = slope,
+        .width = width,
+        .font_size_in_pt = font_size_in_pt,
+    };
+    auto append_family_name = [&](CSSStyleValue const& family) {
+        if (family.is_keyword()) {
+            if (auto family_name = generic_font_family_name(family.to_keyword()); family_name.has_value())
+                cache_key.family_names.append(family_name.release_value());
+        } else if (family.is_string()) {
+            cache_key.family_names.append(family.as_string().string_value());
+        } else if (family.is_custom_ident()) {
+            cache_key.family_names.append(family.as_custom_ident().custom_ident());
         }
-    } else if (font_family.is_keyword()) {
-        if (auto other_font_list = find_generic_font(font_family.to_keyword()))
-            font_list->extend(*other_font_list);
-    } else if (font_family.is_string()) {
-        if (auto other_font_list = find_font(font_family.as_string().string_value()))
-            font_list->extend(*other_font_list);
-    } else if (font_family.is_custom_ident()) {
-        if (auto other_font_list = find_font(font_family.as_custom_ident().custom_ident()))
+    };
+    if (font_family.is_value_list()) {
+        for (auto const& family : static_cast<StyleValueList const&>(font_family).values())
+            append_family_name(*family);
+    } else {
+        append_family_name(font_family);
+    }
+
+    if (auto cached_font_list = m_font_cascade_list_cache.get(cache_key); cached_font_list.has_value())
+        return *cached_font_list;
+
+    auto font_list = Gfx::FontCascadeList::create();
+    for (auto const& family_name : cache_key.family_names) {
+        if (auto other_font_list = find_font(family_name))
             font_list->extend(*other_font_list);
     }
 
@@ -2482,11 +2555,20 @@ RefPtr<Gfx::FontCascadeList const> StyleComputer::compute_font_for_style_values(
     // the requested code point, there is still a font available to provide a fallback glyph.
     font_list->set_last_resort_font(*default_font);
 
+    if (m_font_cascade_list_cache.size() >= maximum_font_cascade_list_cache_size)
+        m_font_cascade_list_cache.clear();
+    m_font_cascade_list_cache.set(move(cache_key), font_list);
+
     return font_list;
 }
 
 void StyleComputer::compute_font(ComputedProperties& style, DOM::Element const* element, Optional<CSS::PseudoElement> pseudo_element) const
 {
+    auto start_time = MonotonicTime::now();
+    ScopeGuard record_time = [&] {
+        m_statistics.time_in_compute_font += MonotonicTime::now() - start_time;
+    };
+
     // To compute the font, first ensure that we've defaulted the relevant CSS font properties.
     // FIXME: This should be more sophisticated.
     compute_defaulted_property_value(style, element, CSS::PropertyID::FontFamily, pseudo_element);
@@ -2579,7 +2661,7 @@ void StyleComputer::absolutize_values(ComputedProperties& style, GC::Ptr<DOM::El
     };
 
     // "A percentage value specifies an absolute font size relative to the parent element’s computed font-size. Negative percentages are invalid."
-    auto& font_size_value_slot = style.m_property_values[to_underlying(CSS::PropertyID::FontSize)];
+    auto& font_size_value_slot = style.mutable_value_slot(CSS::PropertyID::FontSize);
     if (font_size_value_slot && font_size_value_slot->is_percentage()) {
         auto parent_font_size = get_inherit_value(CSS::PropertyID::FontSize, element)->as_length().length().to_px(viewport_rect(), font_metrics, m_root_element_font_metrics);
         font_size_value_slot = LengthStyleValue::create(
@@ -2594,7 +2676,7 @@ void StyleComputer::absolutize_values(ComputedProperties& style, GC::Ptr<DOM::El
     //       We have to resolve them right away, so that the *computed* line-height is ready for inheritance.
     //       We can't simply absolutize *all* percentage values against the font size,
     //       because most percentages are relative to containing block metrics.
-    auto& line_height_value_slot = style.m_property_values[to_underlying(CSS::PropertyID::LineHeight)];
+    auto& line_height_value_slot = style.mutable_value_slot(CSS::PropertyID::LineHeight);
     if (line_height_value_slot && line_height_value_slot->is_percentage()) {
         line_height_value_slot = LengthStyleValue::create(
             Length::make_px(CSSPixels::nearest_value_for(font_size * static_cast<double>(line_height_value_slot->as_percentage().percentage().as_fraction()))));
@@ -2607,11 +2689,15 @@ void StyleComputer::absolutize_values(ComputedProperties& style, GC::Ptr<DOM::El
     if (line_height_value_slot && line_height_value_slot->is_length())
         line_height_value_slot = LengthStyleValue::create(Length::make_px(line_height));
 
-    for (size_t i = 0; i < style.m_property_values.size(); ++i) {
-        auto& value_slot = style.m_property_values[i];
+    for (size_t i = 0; i < ComputedProperties::number_of_properties; ++i) {
+        auto property_id = static_cast<PropertyID>(i);
+        auto const& value_slot = style.value_slot(property_id);
         if (!value_slot)
             continue;
-        value_slot = value_slot->absolutized(viewport_rect(), font_metrics, m_root_element_font_metrics);
+        // Only write values that actually change, so we don't unshare property groups for nothing.
+        auto absolutized_value = value_slot->absolutized(viewport_rect(), font_metrics, m_root_element_font_metrics);
+        if (absolutized_value.ptr() != value_slot.ptr())
+            style.mutable_value_slot(property_id) = move(absolutized_value);
     }
 
     style.set_line_height({}, line_height);
@@ -3115,6 +3201,9 @@ GC::Ref<ComputedProperties> StyleComputer::compute_properties(DOM::Element& elem
         start_needed_transitions(*previous_style, computed_style, element, pseudo_element);
     }
 
+    // 10. Share storage with other elements that ended up with the same values for a whole group of properties
+    computed_style->intern_property_groups();
+
     return computed_style;
 }
 
@@ -3177,6 +3266,72 @@ void StyleComputer::collect_selector_insights(Selector const& selector, Selector
     }
 }
 
+void StyleComputer::add_style_producing_rule_to_rule_caches(CSSRule const& rule, CSSStyleSheet const& sheet, GC::Ptr<DOM::ShadowRoot const> shadow_root, RuleCaches& rule_caches, CascadeOrigin cascade_origin, size_t style_sheet_index, size_t rule_index, SelectorInsights& insights)
+{
+    SelectorList const& absolutized_selectors = [&]() {
+        if (rule.type() == CSSRule::Type::Style)
+            return static_cast<CSSStyleRule const&>(rule).absolutized_selectors();
+        if (rule.type() == CSSRule::Type::NestedDeclarations)
+            return static_cast<CSSNestedDeclarations const&>(rule).parent_style_rule().absolutized_selectors();
+        VERIFY_NOT_REACHED();
+    }();
+
+    for (auto const& selector : absolutized_selectors) {
+        m_style_invalidation_data->build_invalidation_sets_for_selector(selector);
+    }
+
+    for (CSS::Selector const& selector : absolutized_selectors) {
+        MatchingRule matching_rule {
+            shadow_root,
+            &rule,
+            sheet,
+            sheet.default_namespace(),
+            selector,
+            style_sheet_index,
+            rule_index,
+            selector.specificity(),
+            cascade_origin,
+            false,
+        };
+
+        auto const& qualified_layer_name = matching_rule.qualified_layer_name();
+        auto& rule_cache = qualified_layer_name.is_empty() ? rule_caches.main : *rule_caches.by_layer.ensure(qualified_layer_name, [] { return make<RuleCache>(); });
+
+        bool contains_root_pseudo_class = false;
+        Optional<CSS::PseudoElement> pseudo_element;
+
+        collect_selector_insights(selector, insights);
+
+        for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
+            if (!matching_rule.contains_pseudo_element) {
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoElement) {
+                    matching_rule.contains_pseudo_element = true;
+                    pseudo_element = simple_selector.pseudo_element().type();
+                }
+            }
+            if (!contains_root_pseudo_class) {
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
+                    && simple_selector.pseudo_class().type == CSS::PseudoClass::Root) {
+                    contains_root_pseudo_class = true;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < to_underlying(PseudoClass::__Count); ++i) {
+            auto pseudo_class = static_cast<PseudoClass>(i);
+            // If we're not building a rule cache for this pseudo class, just ignore it.
+            if (!m_pseudo_class_rule_cache[i])
+                continue;
+            if (selector.contains_pseudo_class(pseudo_class)) {
+                // For pseudo class rule caches we intentionally pass no pseudo-element, because we don't want to bucket pseudo class rules by pseudo-element type.
+                m_pseudo_class_rule_cache[i]->add_rule(matching_rule, {}, contains_root_pseudo_class);
+            }
+        }
+
+        rule_cache.add_rule(matching_rule, pseudo_element, contains_root_pseudo_class);
+    }
+}
+
 void StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_origin, SelectorInsights& insights)
 {
     Vector<MatchingRule> matching_rules;
@@ -3204,71 +3359,18 @@ void StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_ori
 
         size_t rule_index = 0;
         sheet.for_each_effective_style_producing_rule([&](auto const& rule) {
-            SelectorList const& absolutized_selectors = [&]() {
-                if (rule.type() == CSSRule::Type::Style)
-                    return static_cast<CSSStyleRule const&>(rule).absolutized_selectors();
-                if (rule.type() == CSSRule::Type::NestedDeclarations)
-                    return static_cast<CSSNestedDeclarations const&>(rule).parent_style_rule().absolutized_selectors();
-                VERIFY_NOT_REACHED();
-            }();
-
-            for (auto const& selector : absolutized_selectors) {
-                m_style_invalidation_data->build_invalidation_sets_for_selector(selector);
-            }
-
-            for (CSS::Selector const& selector : absolutized_selectors) {
-                MatchingRule matching_rule {
-                    shadow_root,
-                    &rule,
-                    sheet,
-                    sheet.default_namespace(),
-                    selector,
-                    style_sheet_index,
-                    rule_index,
-                    selector.specificity(),
-                    cascade_origin,
-                    false,
-                };
-
-                auto const& qualified_layer_name = matching_rule.qualified_layer_name();
-                auto& rule_cache = qualified_layer_name.is_empty() ? rule_caches.main : *rule_caches.by_layer.ensure(qualified_layer_name, [] { return make<RuleCache>(); });
-
-                bool contains_root_pseudo_class = false;
-                Optional<CSS::PseudoElement> pseudo_element;
-
-                collect_selector_insights(selector, insights);
-
-                for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
-                    if (!matching_rule.contains_pseudo_element) {
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoElement) {
-                            matching_rule.contains_pseudo_element = true;
-                            pseudo_element = simple_selector.pseudo_element().type();
-                        }
-                    }
-                    if (!contains_root_pseudo_class) {
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
-                            && simple_selector.pseudo_class().type == CSS::PseudoClass::Root) {
-                            contains_root_pseudo_class = true;
-                        }
-                    }
-                }
-
-                for (size_t i = 0; i < to_underlying(PseudoClass::__Count); ++i) {
-                    auto pseudo_class = static_cast<PseudoClass>(i);
-                    // If we're not building a rule cache for this pseudo class, just ignore it.
-                    if (!m_pseudo_class_rule_cache[i])
-                        continue;
-                    if (selector.contains_pseudo_class(pseudo_class)) {
-                        // For pseudo class rule caches we intentionally pass no pseudo-element, because we don't want to bucket pseudo class rules by pseudo-element type.
-                        m_pseudo_class_rule_cache[i]->add_rule(matching_rule, {}, contains_root_pseudo_class);
-                    }
-                }
-
-                rule_cache.add_rule(matching_rule, pseudo_element, contains_root_pseudo_class);
-            }
+            add_style_producing_rule_to_rule_caches(rule, sheet, shadow_root, rule_caches, cascade_origin, style_sheet_index, rule_index, insights);
             ++rule_index;
         });
 
+        if (cascade_origin == CascadeOrigin::Author) {
+            m_author_style_sheets_in_rule_cache.ensure(&sheet).append({
+                .shadow_root = shadow_root,
+                .style_sheet_index = style_sheet_index,
+                .rule_count = rule_index,
+            });
+        }
+
         // Loosely based on https://drafts.csswg.org/css-animations-2/#keyframe-processing
         sheet.for_each_effective_keyframes_at_rule([&](CSSKeyframesRule const& rule) {
             auto keyframe_set = adopt_ref(*new Animations::KeyframeEffect::KeyFrameSet);
@@ -3409,6 +3511,7 @@ void StyleComputer::build_rule_cache()
 void StyleComputer::invalidate_rule_cache()
 {
     m_author_rule_cache = nullptr;
+    reset_style_sharing_cache();
 
     // NOTE: We could be smarter about keeping the user rule cache, and style sheet.
     //       Currently we are re-parsing the user style sheet every time we build the caches,
@@ -3422,10 +3525,76 @@ void StyleComputer::invalidate_rule_cache()
 
     m_pseudo_class_rule_cache = {};
     m_style_invalidation_data = nullptr;
+    m_author_style_sheets_in_rule_cache.clear();
+}
+
+StyleComputer::StyleSheetInRuleCache* StyleComputer::find_author_style_sheet_in_rule_cache(CSSStyleSheet const& sheet, GC::Ptr<DOM::ShadowRoot const> shadow_root)
+{
+    auto it = m_author_style_sheets_in_rule_cache.find(&sheet);
+    if (it == m_author_style_sheets_in_rule_cache.end())
+        return nullptr;
+    for (auto& entry : it->value) {
+        if (entry.shadow_root == shadow_root)
+            return &entry;
+    }
+    return nullptr;
+}
+
+// Only top-level style rules without nested rules are handled incrementally. Anything else (at-rules, nested rules,
+// rules in layers) may affect the rule indices of other rules or the layer order, so it needs a full rebuild.
+static bool can_update_rule_cache_incrementally_for(CSSRule const& rule)
+{
+    if (rule.type() != CSSRule::Type::Style || rule.parent_rule())
+        return false;
+    return static_cast<CSSStyleRule const&>(rule).css_rules().length() == 0;
+}
+
+bool StyleComputer::add_appended_rule_to_rule_cache(CSSStyleSheet const& sheet, GC::Ptr<DOM::ShadowRoot const> shadow_root, CSSRule const& rule)
+{
+    // If there is no rule cache, the next style update builds it from scratch anyway.
+    if (!has_valid_rule_cache())
+        return true;
+    if (!can_update_rule_cache_incrementally_for(rule))
+        return false;
+    auto* sheet_in_rule_cache = find_author_style_sheet_in_rule_cache(sheet, shadow_root);
+    if (!sheet_in_rule_cache)
+        return false;
+
+    // The rule comes after every other rule in its style sheet, so it can take the next rule index without
+    // renumbering anything.
+    auto& rule_caches = shadow_root
+        ? *m_author_rule_cache->for_shadow_roots.ensure(*shadow_root, [] { return make<RuleCaches>(); })
+        : m_author_rule_cache->for_document;
+    add_style_producing_rule_to_rule_caches(rule, sheet, shadow_root, rule_caches, CascadeOrigin::Author, sheet_in_rule_cache->style_sheet_index, sheet_in_rule_cache->rule_count++, *m_selector_insights);
+    return true;
+}
+
+bool StyleComputer::remove_rule_from_rule_cache(CSSStyleSheet const& sheet, GC::Ptr<DOM::ShadowRoot const> shadow_root, CSSRule const& rule)
+{
+    if (!has_valid_rule_cache())
+        return true;
+    if (!can_update_rule_cache_incrementally_for(rule))
+        return false;
+    if (!find_author_style_sheet_in_rule_cache(sheet, shadow_root))
+        return false;
+
+    // NOTE: Removing a rule leaves a gap in the rule indices of its style sheet, which doesn't affect the cascade order.
+    //       We also keep the rule's invalidation sets and selector insights; they only ever cause extra invalidation.
+    if (!shadow_root) {
+        m_author_rule_cache->for_document.main.remove_rule(rule);
+    } else if (auto it = m_author_rule_cache->for_shadow_roots.find(*shadow_root); it != m_author_rule_cache->for_shadow_roots.end()) {
+        it->value->main.remove_rule(rule);
+    }
+    for (auto& pseudo_class_rule_cache : m_pseudo_class_rule_cache) {
+        if (pseudo_class_rule_cache)
+            pseudo_class_rule_cache->remove_rule(rule);
+    }
+    return true;
 }
 
 void StyleComputer::did_load_font(FlyString const&)
 {
+    m_font_cascade_list_cache.clear();
     document().invalidate_style(DOM::StyleInvalidationReason::CSSFontLoaded);
 }
 
@@ -3457,6 +3626,8 @@ Optional<FontLoader&> StyleComputer::load_font_face(ParsedFontFace const& font_f
         return {};
     }
 
+    m_font_cascade_list_cache.clear();
+
     auto loader = make<FontLoader>(*this, font_face.parent_style_sheet(), font_face.font_family(), font_face.unicode_ranges(), move(urls), move(on_load));
     auto& loader_ref = *loader;
     auto maybe_font_loaders_list = m_loaded_fonts.get(key);
@@ -3487,6 +3658,7 @@ void StyleComputer::load_fonts_from_sheet(CSSStyleSheet& sheet)
 
 void StyleComputer::unload_fonts_from_sheet(CSSStyleSheet& sheet)
 {
+    m_font_cascade_list_cache.clear();
     for (auto& [_, font_loader_list] : m_loaded_fonts) {
         font_loader_list.remove_all_matching([&](auto& font_loader) {
             return sheet.has_associated_font_loader(*font_loader);
@@ -3578,6 +3750,127 @@ void StyleComputer::pop_ancestor(DOM::Element const& element)
     });
 }
 
+// Whether an element's style is a function of nothing but its tag, attributes, pseudo-class state and parent's style,
+// so that it can both give its style to, and take its style from, another such element.
+static bool can_participate_in_style_sharing(DOM::Element const& element)
+{
+    if (!element.is_html_element() || !element.parent_element())
+        return false;
+    if (element.use_pseudo_element().has_value() || element.shadow_root() || element.in_top_layer())
+        return false;
+    if (element.has_associated_animations() || element.cached_animation_name_source({}) || element.cached_transition_property_source({}))
+        return false;
+    return true;
+}
+
+static bool has_same_attributes(DOM::Element const& element, DOM::Element const& other)
+{
+    auto attribute_count = element.attribute_list_size();
+    if (attribute_count != other.attribute_list_size())
+        return false;
+    for (size_t i = 0; i < attribute_count; ++i) {
+        auto const* attribute = element.attributes()->item(i);
+        auto const* other_attribute = other.attributes()->item(i);
+        if (attribute->local_name() != other_attribute->local_name()
+            || attribute->namespace_uri() != other_attribute->namespace_uri()
+            || attribute->value() != other_attribute->value())
+            return false;
+    }
+    return true;
+}
+
+static bool only_selector_list_pseudo_classes(PseudoClassBitmap const& pseudo_classes)
+{
+    for (size_t i = 0; i < to_underlying(PseudoClass::__Count); ++i) {
+        auto pseudo_class = static_cast<PseudoClass>(i);
+        if (pseudo_classes.get(pseudo_class) && !first_is_one_of(pseudo_class, PseudoClass::Is, PseudoClass::Where, PseudoClass::Not))
+            return false;
+    }
+    return true;
+}
+
+GC::Ptr<ComputedProperties> StyleComputer::share_style_with_recently_styled_element(DOM::Element& element)
+{
+    if (!can_participate_in_style_sharing(element))
+        return {};
+
+    auto style_sharing_source = [&](DOM::Element const& shared_element) {
+        return m_style_sharing_sources.get(&shared_element).value_or(&shared_element);
+    };
+
+    auto const& parent = *element.parent_element();
+    for (auto const& candidate : m_style_sharing_candidates) {
+        if (candidate.ptr() == &element || !can_participate_in_style_sharing(*candidate))
+            continue;
+        if (candidate->local_name() != element.local_name() || candidate->namespace_uri() != element.namespace_uri())
+            continue;
+
+        // Siblings inherit from the same parent. Cousins inherit from parents that shared style with each other, which
+        // (recursively) means that their ancestors agree on everything except pseudo-class state, see below.
+        auto const& candidate_parent = *candidate->parent_element();
+        bool is_sibling = &candidate_parent == &parent;
+        if (!is_sibling && style_sharing_source(candidate_parent) != style_sharing_source(parent))
+            continue;
+
+        // If anything other than the candidate's own tag, attributes and pseudo-class state was looked at while
+        // matching selectors against it, its style may not carry over to another element.
+        if (candidate->style_affected_by_structural_changes()
+            || candidate->affected_by_has_pseudo_class_in_subject_position()
+            || candidate->affected_by_has_pseudo_class_in_non_subject_position()
+            || candidate->affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
+            continue;
+
+        auto candidate_style = candidate->computed_properties();
+        auto candidate_cascaded_properties = candidate->cascaded_properties({});
+        if (!candidate_style || !candidate_cascaded_properties)
+            continue;
+        if (candidate_style->animation_name_source() || candidate_style->transition_property_source() || !candidate_style->animated_property_values().is_empty())
+            continue;
+
+        if (!has_same_attributes(element, *candidate))
+            continue;
+
+        // The attempted pseudo-class matches don't record which element they were attempted against. For siblings,
+        // every ancestor is shared, so only the elements themselves can differ. For cousins, the ancestors' state
+        // may differ too, so we only allow pseudo-classes that merely combine other selectors.
+        auto const& attempted_pseudo_class_matches = candidate_style->m_attempted_pseudo_class_matches;
+        if (!is_sibling && !only_selector_list_pseudo_classes(attempted_pseudo_class_matches))
+            continue;
+        if (!SelectorEngine::matches_same_pseudo_classes(element, *candidate, attempted_pseudo_class_matches))
+            continue;
+
+        element.set_cascaded_properties({}, candidate_cascaded_properties);
+        element.set_custom_properties({}, candidate->custom_properties({}));
+        if (candidate->style_uses_css_custom_properties())
+            element.set_style_uses_css_custom_properties(true);
+        m_style_sharing_sources.set(&element, style_sharing_source(*candidate));
+        return candidate_style->clone();
+    }
+    return {};
+}
+
+void StyleComputer::add_style_sharing_candidate(DOM::Element& element)
+{
+    if (can_participate_in_style_sharing(element))
+        m_style_sharing_candidates.enqueue(&element);
+}
+
+void StyleComputer::reset_style_sharing_cache()
+{
+    m_style_sharing_candidates.clear();
+    m_style_sharing_sources.clear();
+}
+
+void StyleComputer::enable_nth_index_cache()
+{
+    m_nth_index_cache = make<NthIndexCache>();
+}
+
+void StyleComputer::disable_nth_index_cache()
+{
+    m_nth_index_cache = nullptr;
+}
+
 size_t StyleComputer::number_of_css_font_faces_with_loading_in_progress() const
 {
     size_t count = 0;
@@ -3670,6 +3963,27 @@ void RuleCache::add_rule(MatchingRule const& matching_rule, Optional<PseudoEleme
     }
 }
 
+void RuleCache::remove_rule(CSSRule const& rule)
+{
+    auto remove_from = [&](Vector<MatchingRule>& rules) {
+        rules.remove_all_matching([&](MatchingRule const& matching_rule) { return matching_rule.rule == &rule; });
+    };
+    auto remove_from_buckets = [&](auto& buckets) {
+        for (auto& it : buckets)
+            remove_from(it.value);
+        buckets.remove_all_matching([](auto const&, auto const& rules) { return rules.is_empty(); });
+    };
+
+    remove_from_buckets(rules_by_id);
+    remove_from_buckets(rules_by_class);
+    remove_from_buckets(rules_by_tag_name);
+    remove_from_buckets(rules_by_attribute_name);
+    for (auto& rules : rules_by_pseudo_element)
+        remove_from(rules);
+    remove_from(root_rules);
+    remove_from(other_rules);
+}
+
 void RuleCache::for_each_matching_rules(DOM::Element const& element, Optional<PseudoElement> pseudo_element, Function<IterationDecision(Vector<MatchingRule> const&)> callback) const
 {
     for (auto const& class_name : element.class_names()) {
@@ -7,9 +7,12 @@
 
 #pragma once
 
+#include <AK/CircularQueue.h>
 #include <AK/HashMap.h>
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
+#include <AK/Time.h>
+#include <LibGfx/Font/FontSupport.h>
 #include <LibGfx/Font/Typeface.h>
 #include <LibGfx/FontCascadeList.h>
 #include <LibWeb/Animations/KeyframeEffect.h>
@@ -109,6 +112,18 @@ struct OwnFontFaceKey {
     int slope { 0 };
 };
 
+// Everything the font matching in StyleComputer::compute_font_for_style_values() depends on, once the font size is resolved.
+struct FontCascadeListKey {
+    // The entries of the font-family list, with generic families replaced by the platform's font for them.
+    Vector<FlyString, 4> family_names;
+    int weight { 0 };
+    int slope { 0 };
+    int width { 0 };
+    float font_size_in_pt { 0 };
+
+    [[nodiscard]] bool operator==(FontCascadeListKey const&) const = default;
+};
+
 struct RuleCache {
     HashMap<FlyString, Vector<MatchingRule>> rules_by_id;
     HashMap<FlyString, Vector<MatchingRule>> rules_by_class;
@@ -121,9 +136,31 @@ struct RuleCache {
     HashMap<FlyString, NonnullRefPtr<Animations::KeyframeEffect::KeyFrameSet>> rules_by_animation_keyframes;
 
     void add_rule(MatchingRule const&, Optional<PseudoElement>, bool contains_root_pseudo_class);
+    void remove_rule(CSSRule const&);
     void for_each_matching_rules(DOM::Element const&, Optional<PseudoElement>, Function<IterationDecision(Vector<MatchingRule> const&)> callback) const;
 };
 
+// Counters describing the work done by style computation, so we can tell why a given style update was slow.
+struct StyleComputationStatistics {
+    struct RuleMatchingCounts {
+        u64 rules_tested { 0 };
+        u64 rules_matched { 0 };
+    };
+
+    u64 elements_restyled { 0 };
+    u64 elements_with_inherited_style_recomputed { 0 };
+
+    RuleMatchingCounts author_rules;
+    RuleMatchingCounts user_rules;
+    RuleMatchingCounts user_agent_rules;
+
+    u64 ancestor_filter_checks { 0 };
+    u64 ancestor_filter_rejects { 0 };
+
+    AK::Duration time_in_collect_matching_rules;
+    AK::Duration time_in_compute_font;
+};
+
 class FontLoader;
 
 class StyleComputer {
@@ -155,16 +192,34 @@ public:
     [[nodiscard]] GC::Ref<ComputedProperties> compute_style(DOM::Element&, Optional<CSS::PseudoElement> = {}) const;
     [[nodiscard]] GC::Ptr<ComputedProperties> compute_pseudo_element_style_if_needed(DOM::Element&, Optional<CSS::PseudoElement>) const;
 
+    // Style sharing: while updating style, an element whose style would be computed from exactly the same inputs as a
+    // recently styled sibling (or cousin) reuses a copy of that sibling's style instead of running the cascade.
+    [[nodiscard]] GC::Ptr<ComputedProperties> share_style_with_recently_styled_element(DOM::Element&);
+    void add_style_sharing_candidate(DOM::Element&);
+    void reset_style_sharing_cache();
+
+    // While updating style, selector matching can remember the positions of elements among their siblings, since the
+    // DOM doesn't change until the update is done.
+    void enable_nth_index_cache();
+    void disable_nth_index_cache();
+
     [[nodiscard]] RuleCache const& get_pseudo_class_rule_cache(PseudoClass) const;
 
     [[nodiscard]] Vector<MatchingRule const*> collect_matching_rules(DOM::Element const&, CascadeOrigin, Optional<CSS::PseudoElement>, PseudoClassBitmap& attempted_psuedo_class_matches, FlyString const& qualified_layer_name = {}) const;
 
     InvalidationSet invalidation_set_for_properties(Vector<InvalidationSet::Property> const&) const;
+    SiblingInvalidationSet sibling_invalidation_set_for_properties(Vector<InvalidationSet::Property> const&) const;
     bool invalidation_property_used_in_has_selector(InvalidationSet::Property const&) const;
 
     [[nodiscard]] bool has_valid_rule_cache() const { return m_author_rule_cache; }
     void invalidate_rule_cache();
 
+    // Keep an existing rule cache up to date when a rule is appended to or removed from an author style sheet.
+    // These return false if the change can't be applied incrementally, in which case the caller has to invalidate
+    // the whole rule cache.
+    [[nodiscard]] bool add_appended_rule_to_rule_cache(CSSStyleSheet const&, GC::Ptr<DOM::ShadowRoot const>, CSSRule const&);
+    [[nodiscard]] bool remove_rule_from_rule_cache(CSSStyleSheet const&, GC::Ptr<DOM::ShadowRoot const>, CSSRule const&);
+
     Gfx::Font const& initial_font() const;
 
     void did_load_font(FlyString const& family_name);
@@ -200,6 +255,11 @@ public:
 
     [[nodiscard]] inline bool should_reject_with_ancestor_filter(Selector const&) const;
 
+    // Statistics for the style update in progress, and for the last one that completed.
+    StyleComputationStatistics& statistics() const { return m_statistics; }
+    StyleComputationStatistics const& last_style_update_statistics() const { return m_last_style_update_statistics; }
+    void did_finish_style_update(Badge<DOM::Document>);
+
 private:
     enum class ComputeStyleMode {
         Normal,
@@ -273,6 +333,14 @@ private:
     };
 
     void make_rule_cache_for_cascade_origin(CascadeOrigin, SelectorInsights&);
+    void add_style_producing_rule_to_rule_caches(CSSRule const&, CSSStyleSheet const&, GC::Ptr<DOM::ShadowRoot const>, RuleCaches&, CascadeOrigin, size_t style_sheet_index, size_t rule_index, SelectorInsights&);
+
+    struct StyleSheetInRuleCache {
+        GC::Ptr<DOM::ShadowRoot const> shadow_root;
+        size_t style_sheet_index { 0 };
+        size_t rule_count { 0 };
+    };
+    [[nodiscard]] StyleSheetInRuleCache* find_author_style_sheet_in_rule_cache(CSSStyleSheet const&, GC::Ptr<DOM::ShadowRoot const>);
 
     [[nodiscard]] RuleCache const* rule_cache_for_cascade_origin(CascadeOrigin, FlyString const& qualified_layer_name, GC::Ptr<DOM::ShadowRoot const>) const;
 
@@ -284,11 +352,21 @@ private:
     OwnPtr<RuleCachesForDocumentAndShadowRoots> m_author_rule_cache;
     OwnPtr<RuleCachesForDocumentAndShadowRoots> m_user_rule_cache;
     OwnPtr<RuleCachesForDocumentAndShadowRoots> m_user_agent_rule_cache;
+    // The author style sheets that went into m_author_rule_cache. A sheet can be adopted by several trees, so it can appear
+    // once per shadow root.
+    HashMap<CSSStyleSheet const*, Vector<StyleSheetInRuleCache>> m_author_style_sheets_in_rule_cache;
     GC::Root<CSSStyleSheet> m_user_style_sheet;
 
     using FontLoaderList = Vector<NonnullOwnPtr<FontLoader>>;
     HashMap<OwnFontFaceKey, FontLoaderList> m_loaded_fonts;
 
+    // OPTIMIZATION: Matching fonts is expensive, but pages use only a handful of distinct fonts, so we remember the font
+    //               cascade list each combination resolved to. Sharing the lists this way also lets them keep their
+    //               per-code-point fallback caches warm across elements. This has to be cleared whenever the set of
+    //               web fonts or their loading state changes.
+    static constexpr size_t maximum_font_cascade_list_cache_size = 1024;
+    mutable HashMap<FontCascadeListKey, NonnullRefPtr<Gfx::FontCascadeList const>> m_font_cascade_list_cache;
+
     [[nodiscard]] Length::FontMetrics const& root_element_font_metrics_for_element(GC::Ptr<DOM::Element const>) const;
 
     Length::FontMetrics m_default_font_metrics;
@@ -297,6 +375,16 @@ private:
     CSSPixelRect m_viewport_rect;
 
     CountingBloomFilter<u8, 14> m_ancestor_filter;
+
+    static constexpr size_t max_style_sharing_candidates = 16;
+    CircularQueue<GC::Ptr<DOM::Element>, max_style_sharing_candidates> m_style_sharing_candidates;
+    // Maps each element that shared style in the current style update to the element its style originally came from.
+    HashMap<DOM::Element const*, DOM::Element const*> m_style_sharing_sources;
+
+    OwnPtr<NthIndexCache> m_nth_index_cache;
+
+    mutable StyleComputationStatistics m_statistics;
+    StyleComputationStatistics m_last_style_update_statistics;
 };
 
 class FontLoader : public Weakable<FontLoader> {
@@ -314,9 +402,10 @@ public:
     bool is_loading() const;
 
 private:
-    ErrorOr<NonnullRefPtr<Gfx::Typeface const>> try_load_font(Fetch::Infrastructure::Response const&, ByteBuffer const&);
+    static Optional<Gfx::FontFormat> font_format_for(Fetch::Infrastructure::Response const&, ByteBuffer const&);
 
     void font_did_load_or_fail(RefPtr<Gfx::Typeface const>);
+    void font_did_fail_to_decode();
 
     StyleComputer& m_style_computer;
     GC::Ptr<CSSStyleSheet> m_parent_style_sheet;
@@ -4,12 +4,20 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Checked.h>
 #include <AK/GenericShorthands.h>
 #include <LibWeb/CSS/Selector.h>
 #include <LibWeb/CSS/StyleInvalidationData.h>
 
 namespace Web::CSS {
 
+void SiblingInvalidationSet::include_all_from(SiblingInvalidationSet const& other)
+{
+    max_distance = max(max_distance, other.max_distance);
+    invalidate_descendants_of_siblings |= other.invalidate_descendants_of_siblings;
+    invalidation_set.include_all_from(other.invalidation_set);
+}
+
 // Iterates over the given selector, grouping consecutive simple selectors that have no combinator (Combinator::None).
 // For example, given "div:not(.a) + .b[foo]", the callback is invoked twice:
 // once for "div:not(.a)" and once for ".b[foo]".
@@ -106,7 +114,12 @@ enum class InsideNthChildPseudoClass {
     Yes
 };
 
-static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidationData& style_invalidation_data, Selector const& selector, InsideNthChildPseudoClass inside_nth_child_pseudo_class);
+enum class SelectorNesting {
+    TopLevel,
+    InsidePseudoClassArgument,
+};
+
+static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidationData& style_invalidation_data, Selector const& selector, InsideNthChildPseudoClass inside_nth_child_pseudo_class, SelectorNesting);
 
 static void add_invalidation_sets_to_cover_scope_leakage_of_relative_selector_in_has_pseudo_class(Selector const& selector, StyleInvalidationData& style_invalidation_data);
 
@@ -158,7 +171,7 @@ static void build_invalidation_sets_for_simple_selector(Selector::SimpleSelector
             inside_nth_child_pseudo_class_for_nested = InsideNthChildPseudoClass::Yes;
         }
         for (auto const& nested_selector : pseudo_class.argument_selector_list) {
-            auto rightmost_invalidation_set_for_selector = build_invalidation_sets_for_selector_impl(style_invalidation_data, *nested_selector, inside_nth_child_pseudo_class_for_nested);
+            auto rightmost_invalidation_set_for_selector = build_invalidation_sets_for_selector_impl(style_invalidation_data, *nested_selector, inside_nth_child_pseudo_class_for_nested, SelectorNesting::InsidePseudoClassArgument);
             invalidation_set.include_all_from(rightmost_invalidation_set_for_selector);
         }
         break;
@@ -209,7 +222,7 @@ static void add_invalidation_sets_to_cover_scope_leakage_of_relative_selector_in
     });
 }
 
-static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidationData& style_invalidation_data, Selector const& selector, InsideNthChildPseudoClass inside_nth_child_pseudo_class)
+static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidationData& style_invalidation_data, Selector const& selector, InsideNthChildPseudoClass inside_nth_child_pseudo_class, SelectorNesting selector_nesting)
 {
     auto const& compound_selectors = selector.compound_selectors();
     int compound_selector_index = compound_selectors.size() - 1;
@@ -217,6 +230,12 @@ static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidati
 
     InvalidationSet invalidation_set_for_rightmost_selector;
     Selector::Combinator previous_compound_combinator = Selector::Combinator::None;
+
+    // While walking leftwards, we keep track of the run of sibling combinators directly to the right of the current
+    // compound selector, and whether there is a descendant or child combinator further to the right of that run.
+    bool in_sibling_combinator_run = false;
+    size_t sibling_combinator_run_distance = 0;
+    bool seen_descendant_or_child_combinator = false;
     for_each_consecutive_simple_selector_group(selector, [&](Vector<Selector::SimpleSelector const&> const& simple_selectors, Selector::Combinator combinator, bool is_rightmost) {
         // Collect properties used in :has() so we can decide if only specific properties
         // trigger descendant invalidation or if the entire document must be invalidated.
@@ -259,18 +278,42 @@ static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidati
             }
         } else {
             VERIFY(previous_compound_combinator != Selector::Combinator::None);
+
+            bool is_sibling_combinator = AK::first_is_one_of(previous_compound_combinator, Selector::Combinator::NextSibling, Selector::Combinator::SubsequentSibling);
+            if (is_sibling_combinator) {
+                auto distance = previous_compound_combinator == Selector::Combinator::NextSibling ? 1 : SiblingInvalidationSet::unbounded_distance;
+                sibling_combinator_run_distance = in_sibling_combinator_run ? AK::Checked<size_t>::saturating_add(sibling_combinator_run_distance, distance) : distance;
+            }
+
+            // Inside pseudo-class arguments, the argument's subject is not the element being styled, so the siblings
+            // of the mutated element are not necessarily the elements that need invalidation.
+            bool can_use_sibling_invalidation_set = is_sibling_combinator
+                && selector_nesting == SelectorNesting::TopLevel
+                && inside_nth_child_pseudo_class == InsideNthChildPseudoClass::No;
+
             for (auto const& simple_selector : simple_selectors) {
                 InvalidationSet s;
                 build_invalidation_sets_for_simple_selector(simple_selector, s, ExcludePropertiesNestedInNotPseudoClass::No, style_invalidation_data, inside_nth_child_pseudo_class);
                 s.for_each_property([&](auto const& invalidation_property) {
+                    if (can_use_sibling_invalidation_set) {
+                        SiblingInvalidationSet sibling_invalidation_set;
+                        sibling_invalidation_set.max_distance = sibling_combinator_run_distance;
+                        sibling_invalidation_set.invalidate_descendants_of_siblings = seen_descendant_or_child_combinator;
+                        if (invalidation_set_for_rightmost_selector.is_empty())
+                            sibling_invalidation_set.invalidation_set.set_needs_invalidate_whole_subtree();
+                        else
+                            sibling_invalidation_set.invalidation_set.include_all_from(invalidation_set_for_rightmost_selector);
+                        style_invalidation_data.sibling_invalidation_sets.ensure(invalidation_property, [] { return SiblingInvalidationSet {}; }).include_all_from(sibling_invalidation_set);
+                        return IterationDecision::Continue;
+                    }
+
                     auto& descendant_invalidation_set = style_invalidation_data.descendant_invalidation_sets.ensure(invalidation_property, [] {
                         return InvalidationSet {};
                     });
                     // If the rightmost selector's invalidation set is empty, it means there's no
                     // specific property-based invalidation, so we fall back to invalidating the whole subtree.
-                    // If combinator to the right of current compound selector is NextSibling or SubsequentSibling,
-                    // we also need to invalidate the whole subtree, because we don't support sibling invalidation sets.
-                    if (AK::first_is_one_of(previous_compound_combinator, Selector::Combinator::NextSibling, Selector::Combinator::SubsequentSibling)) {
+                    // Sibling combinators we can't describe with a sibling invalidation set also invalidate the whole subtree.
+                    if (is_sibling_combinator) {
                         descendant_invalidation_set.set_needs_invalidate_whole_subtree();
                     } else if (invalidation_set_for_rightmost_selector.is_empty()) {
                         descendant_invalidation_set.set_needs_invalidate_whole_subtree();
@@ -281,6 +324,10 @@ static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidati
                     return IterationDecision::Continue;
                 });
             }
+
+            in_sibling_combinator_run = is_sibling_combinator;
+            if (!is_sibling_combinator)
+                seen_descendant_or_child_combinator = true;
         }
 
         previous_compound_combinator = combinator;
@@ -291,7 +338,7 @@ static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidati
 
 void StyleInvalidationData::build_invalidation_sets_for_selector(Selector const& selector)
 {
-    (void)build_invalidation_sets_for_selector_impl(*this, selector, InsideNthChildPseudoClass::No);
+    (void)build_invalidation_sets_for_selector_impl(*this, selector, InsideNthChildPseudoClass::No, SelectorNesting::TopLevel);
 }
 
 }
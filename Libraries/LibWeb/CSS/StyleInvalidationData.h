@@ -7,13 +7,35 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <AK/NumericLimits.h>
 #include <LibWeb/CSS/InvalidationSet.h>
 #include <LibWeb/Forward.h>
 
 namespace Web::CSS {
 
+// Describes the following siblings of an element that may need style invalidation when one of its properties changes,
+// because the property is used to the left of a sibling combinator (like ".a" in ".a + .b" or ".a ~ .b .c").
+struct SiblingInvalidationSet {
+    static constexpr size_t unbounded_distance = NumericLimits<size_t>::max();
+
+    // How many following element siblings can be affected. Unbounded when a subsequent-sibling combinator is involved.
+    size_t max_distance { 0 };
+
+    // Whether the elements to invalidate are in the subtrees of those siblings (".a + .b .c") rather than the siblings
+    // themselves (".a + .b").
+    bool invalidate_descendants_of_siblings { false };
+
+    // The properties elements need to have in order to be invalidated. If this needs whole subtree invalidation, every
+    // affected sibling is invalidated along with its subtree.
+    InvalidationSet invalidation_set;
+
+    bool is_empty() const { return max_distance == 0; }
+    void include_all_from(SiblingInvalidationSet const&);
+};
+
 struct StyleInvalidationData {
     HashMap<InvalidationSet::Property, InvalidationSet> descendant_invalidation_sets;
+    HashMap<InvalidationSet::Property, SiblingInvalidationSet> sibling_invalidation_sets;
     HashTable<FlyString> ids_used_in_has_selectors;
     HashTable<FlyString> class_names_used_in_has_selectors;
     HashTable<FlyString> attribute_names_used_in_has_selectors;
@@ -5,9 +5,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCompress/Brotli.h>
 #include <LibCompress/Deflate.h>
 #include <LibCompress/Gzip.h>
 #include <LibCompress/Zlib.h>
+#include <LibCompress/Zstd.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/TypedArray.h>
@@ -22,6 +24,10 @@ namespace Web::Compression {
 
 GC_DEFINE_ALLOCATOR(CompressionStream);
 
+// Chunks are fed to the compressor in slices of this size, and whatever output each slice produced is enqueued before
+// the next one, so that the compressed form of a large chunk never has to be buffered all at once.
+static constexpr size_t compression_slice_size = 64 * KiB;
+
 // https://compression.spec.whatwg.org/#dom-compressionstream-compressionstream
 WebIDL::ExceptionOr<GC::Ref<CompressionStream>> CompressionStream::construct_impl(JS::Realm& realm, Bindings::CompressionFormat format)
 {
@@ -31,12 +37,16 @@ WebIDL::ExceptionOr<GC::Ref<CompressionStream>> CompressionStream::construct_imp
 
     auto compressor = [&, input_stream = MaybeOwned<Stream> { *input_stream }]() mutable -> ErrorOr<Compressor> {
         switch (format) {
+        case Bindings::CompressionFormat::Brotli:
+            return TRY(Compress::BrotliCompressor::create(move(input_stream)));
         case Bindings::CompressionFormat::Deflate:
             return TRY(Compress::ZlibCompressor::create(move(input_stream)));
         case Bindings::CompressionFormat::DeflateRaw:
             return TRY(Compress::DeflateCompressor::create(move(input_stream)));
         case Bindings::CompressionFormat::Gzip:
             return TRY(Compress::GzipCompressor::create(move(input_stream)));
+        case Bindings::CompressionFormat::Zstd:
+            return TRY(Compress::ZstdCompressor::create(move(input_stream)));
         }
 
         VERIFY_NOT_REACHED();
@@ -113,26 +123,35 @@ WebIDL::ExceptionOr<void> CompressionStream::compress_and_enqueue_chunk(JS::Valu
     if (!WebIDL::is_buffer_source_type(chunk))
         return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Chunk is not a BufferSource type"sv };
 
-    // 2. Let buffer be the result of compressing chunk with cs's format and context.
-    auto maybe_buffer = [&]() -> ErrorOr<ByteBuffer> {
-        auto chunk_buffer = TRY(WebIDL::get_buffer_source_copy(chunk.as_object()));
-        return compress(move(chunk_buffer), Finish::No);
-    }();
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to compress chunk: {}", maybe_buffer.error())) };
+    auto chunk_buffer = WebIDL::get_buffer_source_copy(chunk.as_object());
+    if (chunk_buffer.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to compress chunk: {}", chunk_buffer.error())) };
 
-    auto buffer = maybe_buffer.release_value();
+    // OPTIMIZATION: The chunk is compressed one slice at a time, and the output of every slice is enqueued right away.
+    for (auto input = chunk_buffer.value().bytes(); !input.is_empty();) {
+        auto slice = input.trim(compression_slice_size);
+        input = input.slice(slice.size());
 
-    // 3. If buffer is empty, return.
-    if (buffer.is_empty())
-        return {};
+        // 2. Let buffer be the result of compressing chunk with cs's format and context.
+        auto maybe_buffer = compress(slice, Finish::No);
+        if (maybe_buffer.is_error())
+            return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to compress chunk: {}", maybe_buffer.error())) };
 
-    // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
-    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
-    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
+        auto buffer = maybe_buffer.release_value();
+
+        // 3. If buffer is empty, return.
+        // NOTE: The compressor may simply not have produced any output for this slice yet, so move on to the next one.
+        if (buffer.is_empty())
+            continue;
+
+        // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
+        auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
+        auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
+
+        // 5. For each Uint8Array array, enqueue array in cs's transform.
+        TRY(Streams::transform_stream_default_controller_enqueue(*m_transform->controller(), array));
+    }
 
-    // 5. For each Uint8Array array, enqueue array in cs's transform.
-    TRY(Streams::transform_stream_default_controller_enqueue(*m_transform->controller(), array));
     return {};
 }
 
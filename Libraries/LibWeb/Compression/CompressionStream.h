@@ -22,7 +22,9 @@ namespace Web::Compression {
 using Compressor = Variant<
     NonnullOwnPtr<Compress::ZlibCompressor>,
     NonnullOwnPtr<Compress::DeflateCompressor>,
-    NonnullOwnPtr<Compress::GzipCompressor>>;
+    NonnullOwnPtr<Compress::GzipCompressor>,
+    NonnullOwnPtr<Compress::BrotliCompressor>,
+    NonnullOwnPtr<Compress::ZstdCompressor>>;
 
 // https://compression.spec.whatwg.org/#compressionstream
 class CompressionStream final
@@ -5,9 +5,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCompress/Brotli.h>
 #include <LibCompress/Deflate.h>
 #include <LibCompress/Gzip.h>
 #include <LibCompress/Zlib.h>
+#include <LibCompress/Zstd.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/TypedArray.h>
@@ -22,6 +24,10 @@ namespace Web::Compression {
 
 GC_DEFINE_ALLOCATOR(DecompressionStream);
 
+// Decompressed data is enqueued in pieces of at most this size, so that a small chunk that decompresses to a lot of data
+// never has to be held in one allocation.
+static constexpr size_t decompressed_piece_size = 64 * KiB;
+
 // https://compression.spec.whatwg.org/#dom-decompressionstream-decompressionstream
 WebIDL::ExceptionOr<GC::Ref<DecompressionStream>> DecompressionStream::construct_impl(JS::Realm& realm, Bindings::CompressionFormat format)
 {
@@ -31,12 +37,16 @@ WebIDL::ExceptionOr<GC::Ref<DecompressionStream>> DecompressionStream::construct
 
     auto decompressor = [&, input_stream = MaybeOwned<Stream> { *input_stream }]() mutable -> ErrorOr<Decompressor> {
         switch (format) {
+        case Bindings::CompressionFormat::Brotli:
+            return TRY(Compress::BrotliDecompressor::create(move(input_stream)));
         case Bindings::CompressionFormat::Deflate:
             return TRY(Compress::ZlibDecompressor::create(move(input_stream)));
         case Bindings::CompressionFormat::DeflateRaw:
             return TRY(Compress::DeflateDecompressor::create(move(input_stream)));
         case Bindings::CompressionFormat::Gzip:
             return TRY(Compress::GzipDecompressor::create((move(input_stream))));
+        case Bindings::CompressionFormat::Zstd:
+            return TRY(Compress::ZstdDecompressor::create(move(input_stream)));
         }
 
         VERIFY_NOT_REACHED();
@@ -115,32 +125,38 @@ WebIDL::ExceptionOr<void> DecompressionStream::decompress_and_enqueue_chunk(JS::
 
     // 2. Let buffer be the result of decompressing chunk with ds's format and context. If this results in an error,
     //    then throw a TypeError.
-    auto maybe_buffer = [&]() -> ErrorOr<ByteBuffer> {
-        auto chunk_buffer = TRY(WebIDL::get_buffer_source_copy(chunk.as_object()));
-        TRY(m_input_stream->write_until_depleted(move(chunk_buffer)));
-
-        auto decompressed = TRY(ByteBuffer::create_uninitialized(4096));
-        auto size = TRY(m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<size_t> {
-            return TRY(decompressor->read_some(decompressed.bytes())).size();
-        }));
-        return decompressed.slice(0, size);
-    }();
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress chunk: {}", maybe_buffer.error())) };
-
-    auto buffer = maybe_buffer.release_value();
-
-    // 3. If buffer is empty, return.
-    if (buffer.is_empty())
-        return {};
-
-    // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
-    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
-    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
-
-    // 5. For each Uint8Array array, enqueue array in ds's transform.
-    m_transform->enqueue(array);
-    return {};
+    auto chunk_buffer = WebIDL::get_buffer_source_copy(chunk.as_object());
+    if (chunk_buffer.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress chunk: {}", chunk_buffer.error())) };
+    if (auto result = m_input_stream->write_until_depleted(chunk_buffer.release_value()); result.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress chunk: {}", result.error())) };
+
+    // OPTIMIZATION: Everything the input so far decompresses to is enqueued right away, rather than leaving it in the
+    //               decompressor until the stream is flushed. That keeps memory use bounded by the size of the chunks,
+    //               instead of growing with the size of the whole stream.
+    while (true) {
+        auto maybe_buffer = m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<ByteBuffer> {
+            auto buffer = TRY(ByteBuffer::create_uninitialized(decompressed_piece_size));
+            auto size = TRY(decompressor->read_some_available(buffer.bytes())).size();
+            buffer.trim(size, false);
+            return buffer;
+        });
+        if (maybe_buffer.is_error())
+            return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress chunk: {}", maybe_buffer.error())) };
+
+        auto buffer = maybe_buffer.release_value();
+
+        // 3. If buffer is empty, return.
+        if (buffer.is_empty())
+            return {};
+
+        // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
+        auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
+        auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
+
+        // 5. For each Uint8Array array, enqueue array in ds's transform.
+        m_transform->enqueue(array);
+    }
 }
 
 // https://compression.spec.whatwg.org/#decompress-flush-and-enqueue
@@ -149,28 +165,37 @@ WebIDL::ExceptionOr<void> DecompressionStream::decompress_flush_and_enqueue()
     auto& realm = this->realm();
 
     // 1. Let buffer be the result of decompressing an empty input with ds's format and context, with the finish flag.
-    auto maybe_buffer = m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<ByteBuffer> {
-        return TRY(decompressor->read_until_eof());
-    });
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress flush: {}", maybe_buffer.error())) };
-
-    auto buffer = maybe_buffer.release_value();
-
-    // Note: LibCompress already throws an error if we call read_until_eof and no more progress can be made
-    // 2. If the end of the compressed input has not been reached, then throw a TypeError.
-    VERIFY(m_decompressor.visit([](auto const& decompressor) { return decompressor->is_eof(); }));
-
-    // 3. If buffer is empty, return.
-    if (buffer.is_empty())
-        return {};
-
-    // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
-    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
-    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
+    // NOTE: Everything available has already been decompressed while enqueueing the chunks, so this only has to drain
+    //       what is left in the decompressor.
+    while (!m_decompressor.visit([](auto const& decompressor) { return decompressor->is_eof(); })) {
+        auto maybe_buffer = m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<ByteBuffer> {
+            auto buffer = TRY(ByteBuffer::create_uninitialized(decompressed_piece_size));
+            auto size = TRY(decompressor->read_some(buffer.bytes())).size();
+            buffer.trim(size, false);
+            return buffer;
+        });
+
+        // Note: LibCompress already throws an error if we call read_some and no more progress can be made
+        // 2. If the end of the compressed input has not been reached, then throw a TypeError.
+        if (maybe_buffer.is_error())
+            return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress flush: {}", maybe_buffer.error())) };
+
+        auto buffer = maybe_buffer.release_value();
+
+        // 3. If buffer is empty, return.
+        // NOTE: This only means that the decompressor consumed input without producing output yet, so keep draining it
+        //       until it reaches the end of the compressed data.
+        if (buffer.is_empty())
+            continue;
+
+        // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
+        auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
+        auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
+
+        // 5. For each Uint8Array array, enqueue array in ds's transform.
+        m_transform->enqueue(array);
+    }
 
-    // 5. For each Uint8Array array, enqueue array in ds's transform.
-    m_transform->enqueue(array);
     return {};
 }
 
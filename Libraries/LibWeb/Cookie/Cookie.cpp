@@ -31,6 +31,18 @@ String Cookie::expiry_time_to_string() const
     return time_to_string(expiry_time);
 }
 
+static u64 s_cookie_store_version { 0 };
+
+u64 cookie_store_version()
+{
+    return s_cookie_store_version;
+}
+
+void cookie_store_did_change()
+{
+    ++s_cookie_store_version;
+}
+
 StringView same_site_to_string(SameSite same_site)
 {
     switch (same_site) {
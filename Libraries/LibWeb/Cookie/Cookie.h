@@ -43,6 +43,18 @@ struct Cookie {
     bool persistent { false };
 };
 
+// A serialized cookie-string, along with the time at which the first of the cookies it was made of expires. From that
+// point on, the cookie-string is stale.
+struct CookieString {
+    String value;
+    UnixDateTime expiry_time { UnixDateTime::latest() };
+};
+
+// Processes keep copies of cookie-strings around to avoid asking the cookie store for them over and over. This version
+// changes whenever the store might have changed in a way they can't tell from the expiry time.
+u64 cookie_store_version();
+void cookie_store_did_change();
+
 StringView same_site_to_string(SameSite same_site_mode);
 SameSite same_site_from_string(StringView same_site_mode);
 
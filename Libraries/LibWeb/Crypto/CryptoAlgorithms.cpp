@@ -3685,34 +3685,60 @@ WebIDL::ExceptionOr<GC::Ref<CryptoKey>> HKDF::import_key(AlgorithmParams const&,
     return key;
 }
 
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const& algorithm, ByteBuffer const& data)
+static Optional<::Crypto::Hash::HashKind> sha_hash_kind(StringView algorithm_name)
 {
-    auto& algorithm_name = algorithm.name;
-
-    ::Crypto::Hash::HashKind hash_kind;
-    if (algorithm_name == "SHA-1") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA1;
-    } else if (algorithm_name == "SHA-256") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA256;
-    } else if (algorithm_name == "SHA-384") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA384;
-    } else if (algorithm_name == "SHA-512") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA512;
-    } else {
-        return WebIDL::NotSupportedError::create(m_realm, MUST(String::formatted("Invalid hash function '{}'", algorithm_name)));
-    }
+    if (algorithm_name == "SHA-1"sv)
+        return ::Crypto::Hash::HashKind::SHA1;
+    if (algorithm_name == "SHA-256"sv)
+        return ::Crypto::Hash::HashKind::SHA256;
+    if (algorithm_name == "SHA-384"sv)
+        return ::Crypto::Hash::HashKind::SHA384;
+    if (algorithm_name == "SHA-512"sv)
+        return ::Crypto::Hash::HashKind::SHA512;
+    return {};
+}
 
+static ErrorOr<ByteBuffer> sha_digest(::Crypto::Hash::HashKind hash_kind, ReadonlyBytes data)
+{
     ::Crypto::Hash::Manager hash { hash_kind };
     hash.update(data);
 
     auto digest = hash.digest();
-    auto result_buffer = ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
+    return ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
+}
+
+WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const& algorithm, ByteBuffer const& data)
+{
+    auto& algorithm_name = algorithm.name;
+
+    auto hash_kind = sha_hash_kind(algorithm_name);
+    if (!hash_kind.has_value())
+        return WebIDL::NotSupportedError::create(m_realm, MUST(String::formatted("Invalid hash function '{}'", algorithm_name)));
+
+    auto result_buffer = sha_digest(*hash_kind, data);
     if (result_buffer.is_error())
         return WebIDL::OperationError::create(m_realm, "Failed to create result buffer"_string);
 
     return JS::ArrayBuffer::create(m_realm, result_buffer.release_value());
 }
 
+WebIDL::ExceptionOr<Optional<AlgorithmMethods::BackgroundOperation>> SHA::digest_in_background(AlgorithmParams const& algorithm, ByteBuffer& data)
+{
+    // Below this size, hashing is cheap enough that a round trip to a background thread isn't worth it.
+    static constexpr size_t minimum_size_for_background_digest = 1 * MiB;
+
+    if (data.size() < minimum_size_for_background_digest)
+        return OptionalNone {};
+
+    auto hash_kind = sha_hash_kind(algorithm.name);
+    if (!hash_kind.has_value())
+        return WebIDL::NotSupportedError::create(m_realm, MUST(String::formatted("Invalid hash function '{}'", algorithm.name)));
+
+    return BackgroundOperation { [hash_kind = *hash_kind, data = move(data)]() {
+        return sha_digest(hash_kind, data);
+    } };
+}
+
 // https://w3c.github.io/webcrypto/#ecdsa-operations
 WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> ECDSA::generate_key(AlgorithmParams const& params, bool extractable, Vector<Bindings::KeyUsage> const& key_usages)
 {
@@ -6859,6 +6885,34 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParam
     return JS::ArrayBuffer::create(realm, maybe_result.release_value());
 }
 
+WebIDL::ExceptionOr<Optional<AlgorithmMethods::BackgroundOperation>> PBKDF2::derive_bits_in_background(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
+{
+    // Below this many iterations, deriving the key is cheap enough that a round trip to a background thread isn't worth it.
+    static constexpr u32 minimum_iterations_for_background_derivation = 10'000;
+
+    auto const& normalized_algorithm = static_cast<PBKDF2Params const&>(params);
+    if (normalized_algorithm.iterations < minimum_iterations_for_background_derivation)
+        return OptionalNone {};
+
+    // NOTE: These are the same steps as derive_bits(), except that the PBKDF2 operation itself is performed by the
+    //       returned operation.
+    if (!length_optional.has_value() || *length_optional % 8 != 0)
+        return WebIDL::OperationError::create(m_realm, "Length must be greater than 0 and divisible by 8"_string);
+
+    auto const& hash_algorithm = TRY(normalized_algorithm.hash.name(m_realm->vm()));
+    auto hash_kind = sha_hash_kind(hash_algorithm);
+    if (!hash_kind.has_value())
+        return WebIDL::NotSupportedError::create(m_realm, MUST(String::formatted("Invalid hash function '{}'", hash_algorithm)));
+
+    auto password = TRY_OR_THROW_OOM(m_realm->vm(), ByteBuffer::copy(key->handle().get<ByteBuffer>()));
+    auto salt = TRY_OR_THROW_OOM(m_realm->vm(), ByteBuffer::copy(normalized_algorithm.salt));
+
+    return BackgroundOperation { [hash_kind = *hash_kind, password = move(password), salt = move(salt), iterations = normalized_algorithm.iterations, derived_key_length_bytes = *length_optional / 8]() -> ErrorOr<ByteBuffer> {
+        ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
+        return pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
+    } };
+}
+
 // https://w3c.github.io/webcrypto/#pbkdf2-operations
 WebIDL::ExceptionOr<JS::Value> PBKDF2::get_key_length(AlgorithmParams const&)
 {
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AK/EnumBits.h>
+#include <AK/Function.h>
 #include <AK/String.h>
 #include <LibCrypto/BigInt/UnsignedBigInteger.h>
 #include <LibGC/Ptr.h>
@@ -331,6 +332,24 @@ public:
         return WebIDL::NotSupportedError::create(m_realm, "deriveBits is not supported"_string);
     }
 
+    // The part of an operation that doesn't touch the JS heap, and so can be performed on a background thread. It
+    // produces the contents of the ArrayBuffer that the operation results in.
+    using BackgroundOperation = Function<ErrorOr<ByteBuffer>()>;
+
+    // Operations that can take long enough to block the event loop noticeably may be split up: any error in the
+    // parameters is returned right away, and the expensive part is returned as a BackgroundOperation. Returning
+    // OptionalNone means that the operation should be performed with digest() or derive_bits() as usual.
+    // NOTE: If digest_in_background() returns an operation, the operation takes ownership of data.
+    virtual WebIDL::ExceptionOr<Optional<BackgroundOperation>> digest_in_background(AlgorithmParams const&, ByteBuffer&)
+    {
+        return OptionalNone {};
+    }
+
+    virtual WebIDL::ExceptionOr<Optional<BackgroundOperation>> derive_bits_in_background(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>)
+    {
+        return OptionalNone {};
+    }
+
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&)
     {
         return WebIDL::NotSupportedError::create(m_realm, "importKey is not supported"_string);
@@ -520,6 +539,7 @@ class PBKDF2 : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> derive_bits(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
+    virtual WebIDL::ExceptionOr<Optional<BackgroundOperation>> derive_bits_in_background(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
     virtual WebIDL::ExceptionOr<JS::Value> get_key_length(AlgorithmParams const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new PBKDF2(realm)); }
@@ -534,6 +554,7 @@ private:
 class SHA : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> digest(AlgorithmParams const&, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<Optional<BackgroundOperation>> digest_in_background(AlgorithmParams const&, ByteBuffer& data) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new SHA(realm)); }
 
@@ -12,11 +12,13 @@
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/SubtleCryptoPrototype.h>
 #include <LibWeb/Crypto/KeyAlgorithms.h>
 #include <LibWeb/Crypto/SubtleCrypto.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
@@ -247,6 +249,37 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::decrypt(AlgorithmIdentifier const& algori
     return promise;
 }
 
+// Performs an operation on a background thread, and then settles the promise in a task queued on the crypto task source.
+static void perform_in_background(JS::Realm& realm, GC::Ref<WebIDL::Promise> promise, AlgorithmMethods::BackgroundOperation operation)
+{
+    auto settle_promise = [realm = GC::make_root(realm), promise = GC::make_root(promise)](Optional<ByteBuffer> result) {
+        HTML::queue_global_task(HTML::Task::Source::Crypto, realm->global_object(), GC::create_function(realm->heap(), [&realm = *realm, promise = GC::Ref { *promise }, result = move(result)]() mutable {
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+            if (!result.has_value()) {
+                WebIDL::reject_promise(realm, promise, WebIDL::OperationError::create(realm, "Operation failed"_string));
+                return;
+            }
+
+            WebIDL::resolve_promise(realm, promise, JS::ArrayBuffer::create(realm, result.release_value()));
+        }));
+    };
+
+    // NOTE: The action never fails, so that the result is always delivered on this thread. Errors from the background
+    //       thread would otherwise be reported from there if the event loop goes away in the meantime.
+    (void)Threading::BackgroundAction<Optional<ByteBuffer>>::construct(
+        [operation = move(operation)](auto&) -> ErrorOr<Optional<ByteBuffer>> {
+            auto result = operation();
+            if (result.is_error())
+                return OptionalNone {};
+            return result.release_value();
+        },
+        [settle_promise = move(settle_promise)](Optional<ByteBuffer> result) -> ErrorOr<void> {
+            settle_promise(move(result));
+            return {};
+        });
+}
+
 // https://w3c.github.io/webcrypto/#dfn-SubtleCrypto-method-digest
 GC::Ref<WebIDL::Promise> SubtleCrypto::digest(AlgorithmIdentifier const& algorithm, GC::Root<WebIDL::BufferSource> const& data)
 {
@@ -275,11 +308,22 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(AlgorithmIdentifier const& algorit
     auto promise = WebIDL::create_promise(realm);
 
     // 6. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() mutable -> void {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
         // 7. If the following steps or referenced procedures say to throw an error, reject promise with the returned error and then terminate the algorithm.
         // FIXME: Need spec reference to https://webidl.spec.whatwg.org/#reject
 
+        // OPTIMIZATION: Hashing large inputs takes long enough to freeze the page, so it is done on a background thread.
+        auto background_operation = algorithm_object.methods->digest_in_background(*algorithm_object.parameter, data_buffer);
+        if (background_operation.is_exception()) {
+            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), background_operation.release_error()).release_value());
+            return;
+        }
+        if (auto operation = background_operation.release_value(); operation.has_value()) {
+            perform_in_background(realm, promise, operation.release_value());
+            return;
+        }
+
         // 8. Let result be the result of performing the digest operation specified by normalizedAlgorithm using algorithm, with data as message.
         auto result = algorithm_object.methods->digest(*algorithm_object.parameter, data_buffer);
 
@@ -631,6 +675,18 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::derive_bits(AlgorithmIdentifier algorithm
             return;
         }
 
+        // OPTIMIZATION: Key derivation with many iterations takes long enough to freeze the page, so it is done on a
+        //               background thread.
+        auto background_operation = normalized_algorithm.methods->derive_bits_in_background(*normalized_algorithm.parameter, base_key, length_optional);
+        if (background_operation.is_exception()) {
+            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), background_operation.release_error()).release_value());
+            return;
+        }
+        if (auto operation = background_operation.release_value(); operation.has_value()) {
+            perform_in_background(realm, promise, operation.release_value());
+            return;
+        }
+
         // 9. Let result be the result of creating an ArrayBuffer containing the result of performing the derive bits operation specified by normalizedAlgorithm using baseKey, algorithm and length.
         auto result = normalized_algorithm.methods->derive_bits(*normalized_algorithm.parameter, base_key, length_optional);
         if (result.is_error()) {
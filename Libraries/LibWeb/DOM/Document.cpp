@@ -87,6 +87,7 @@
 #include <LibWeb/HTML/BeforeUnloadEvent.h>
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/BrowsingContextGroup.h>
+#include <LibWeb/HTML/CanvasRenderingContext2D.h>
 #include <LibWeb/HTML/CustomElements/CustomElementDefinition.h>
 #include <LibWeb/HTML/CustomElements/CustomElementReactionNames.h>
 #include <LibWeb/HTML/CustomElements/CustomElementRegistry.h>
@@ -99,6 +100,7 @@
 #include <LibWeb/HTML/HTMLAreaElement.h>
 #include <LibWeb/HTML/HTMLBaseElement.h>
 #include <LibWeb/HTML/HTMLBodyElement.h>
+#include <LibWeb/HTML/HTMLCanvasElement.h>
 #include <LibWeb/HTML/HTMLDialogElement.h>
 #include <LibWeb/HTML/HTMLDocument.h>
 #include <LibWeb/HTML/HTMLEmbedElement.h>
@@ -534,6 +536,7 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_page);
     visitor.visit(m_window);
     visitor.visit(m_layout_root);
+    visitor.visit(m_layout_nodes_needing_paint_only_properties_resolved);
     visitor.visit(m_style_sheets);
     visitor.visit(m_hovered_node);
     visitor.visit(m_inspected_node);
@@ -612,6 +615,7 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_local_storage_holder);
     visitor.visit(m_session_storage_holder);
     visitor.visit(m_render_blocking_elements);
+    visitor.visit(m_canvases_with_deferred_drawing);
     visitor.visit(m_policy_container);
 }
 
@@ -1238,6 +1242,25 @@ void Document::invalidate_layout_tree(InvalidateLayoutTreeReason reason)
     schedule_layout_update();
 }
 
+void Document::invalidate_layout_tree_for_top_layer_change(Element& element)
+{
+    // An element's box moves between its place in the flow and the viewport when it enters or leaves the top layer.
+    // Rebuild the element itself, so it gets a box in its new place.
+    element.set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::TopLayerChange);
+
+    // If it currently has a box, also rebuild its parent, so the box (and any anonymous wrappers) leave the old place.
+    if (element.layout_node()) {
+        auto* parent = element.parent_or_shadow_host();
+        if (!parent || parent->is_document()) {
+            tear_down_layout_tree();
+        } else {
+            parent->set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::TopLayerChange);
+        }
+    }
+
+    schedule_layout_update();
+}
+
 static void propagate_scrollbar_width_to_viewport(Element& root_element, Layout::Viewport& viewport)
 {
     // https://drafts.csswg.org/css-scrollbars/#scrollbar-width
@@ -1304,7 +1327,7 @@ void Document::update_layout(UpdateLayoutReason reason)
 
     update_style();
 
-    if (m_layout_root && !m_layout_root->needs_layout_update())
+    if (m_layout_root && !m_layout_root->needs_layout_update() && !m_layout_root->child_needs_layout_update())
         return;
 
     // NOTE: If this is a document hosting <template> contents, layout is unnecessary.
@@ -1320,6 +1343,9 @@ void Document::update_layout(UpdateLayoutReason reason)
     auto* document_element = this->document_element();
     auto viewport_rect = navigable->viewport_rect();
 
+    // Boxes may move anywhere during layout, so the whole viewport must be repainted afterwards.
+    add_damaged_rect(viewport_rect);
+
     auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
 
     if (!m_layout_root || needs_layout_tree_update() || child_needs_layout_tree_update() || needs_full_layout_tree_update()) {
@@ -1338,8 +1364,10 @@ void Document::update_layout(UpdateLayoutReason reason)
         }
     }
 
+    u32 next_layout_node_index = 0;
     m_layout_root->for_each_in_inclusive_subtree([&](auto& layout_node) {
         layout_node.recompute_containing_block({});
+        layout_node.set_index_in_layout_tree({}, next_layout_node_index++);
         return TraversalDecision::Continue;
     });
 
@@ -1421,6 +1449,10 @@ void Document::update_layout(UpdateLayoutReason reason)
             && paintable_box.dom_node()->is_element()
             && paintable_box.computed_values().content_visibility() == CSS::ContentVisibility::Auto) {
             paintable_boxes_with_auto_content_visibility.append(paintable_box);
+
+            // Remember how large the contents were while they were laid out, as a placeholder for when they are skipped.
+            if (auto const* box = as_if<Layout::Box>(paintable_box.layout_node_with_style_and_box_metrics()); box && !box->skipped_contents_size().has_value())
+                as<Element>(*paintable_box.dom_node()).set_last_remembered_content_size(paintable_box.content_size());
         }
         return TraversalDecision::Continue;
     });
@@ -1458,8 +1490,10 @@ void Document::update_layout(UpdateLayoutReason reason)
     if (is<Element>(node)) {
         if (needs_full_style_update || node.needs_style_update()) {
             node_invalidation = static_cast<Element&>(node).recompute_style();
+            ++style_computer.statistics().elements_restyled;
         } else if (needs_inherited_style_update) {
             node_invalidation = static_cast<Element&>(node).recompute_inherited_style();
+            ++style_computer.statistics().elements_with_inherited_style_recomputed;
         }
         is_display_none = static_cast<Element&>(node).computed_properties()->display().is_none();
     }
@@ -1564,10 +1598,20 @@ void Document::update_style()
     evaluate_media_rules();
 
     style_computer().reset_ancestor_filter();
+    style_computer().reset_style_sharing_cache();
+    style_computer().enable_nth_index_cache();
 
     auto invalidation = update_style_recursively(*this, style_computer(), false);
+    style_computer().reset_style_sharing_cache();
+    style_computer().disable_nth_index_cache();
+
+    style_computer().did_finish_style_update({});
+    m_style_invalidations_before_last_style_update = exchange(m_style_invalidations_since_last_style_update, {});
+
+    // NOTE: Elements that need repainting have invalidated their own stacking contexts, and a relayout or rebuild
+    //       invalidates everything, so we only need to drop the display list itself here.
     if (!invalidation.is_none())
-        invalidate_display_list();
+        invalidate_cached_display_list();
     if (invalidation.rebuild_stacking_context_tree)
         invalidate_stacking_context_tree();
     m_needs_full_style_update = false;
@@ -1596,14 +1640,38 @@ void Document::update_paint_and_hit_testing_properties_if_needed()
         paintable->refresh_scroll_state();
     }
 
-    if (!m_needs_to_resolve_paint_only_properties)
+    auto layout_nodes = move(m_layout_nodes_needing_paint_only_properties_resolved);
+
+    if (!m_needs_to_resolve_paint_only_properties) {
+        for (auto& node : layout_nodes) {
+            // NOTE: Nodes that were removed from the layout tree since don't have anything left to resolve.
+            if (&node->root() != layout_node())
+                continue;
+            for (auto& paintable : node->paintables()) {
+                paintable.for_each_in_inclusive_subtree([](Painting::Paintable& descendant) {
+                    descendant.resolve_paint_properties();
+                    descendant.did_resolve_paint_properties();
+                    return TraversalDecision::Continue;
+                });
+            }
+        }
         return;
+    }
+
     m_needs_to_resolve_paint_only_properties = false;
     if (auto* paintable = this->paintable()) {
         paintable->resolve_paint_only_properties();
     }
 }
 
+void Document::set_needs_to_resolve_paint_only_properties(Layout::Node& layout_node)
+{
+    if (m_needs_to_resolve_paint_only_properties)
+        return;
+    if (!m_layout_nodes_needing_paint_only_properties_resolved.contains_slow(layout_node))
+        m_layout_nodes_needing_paint_only_properties_resolved.append(layout_node);
+}
+
 void Document::set_normal_link_color(Color color)
 {
     m_normal_link_color = color;
@@ -1725,14 +1793,10 @@ void Document::set_highlighted_node(GC::Ptr<Node> node, Optional<CSS::PseudoElem
     if (m_highlighted_node == node && m_highlighted_pseudo_element == pseudo_element)
         return;
 
-    if (auto layout_node = highlighted_layout_node(); layout_node && layout_node->first_paintable())
-        layout_node->first_paintable()->set_needs_display();
-
+    // NOTE: The inspector overlay labels the highlighted node outside of its box, so repaint the whole viewport.
     m_highlighted_node = node;
     m_highlighted_pseudo_element = pseudo_element;
-
-    if (auto layout_node = highlighted_layout_node(); layout_node && layout_node->first_paintable())
-        layout_node->first_paintable()->set_needs_display();
+    set_needs_display();
 }
 
 GC::Ptr<Layout::Node> Document::highlighted_layout_node()
@@ -1966,7 +2030,7 @@ GC::Ref<NodeList> Document::get_elements_by_name(FlyString const& name)
 GC::Ref<HTMLCollection> Document::applets()
 {
     if (!m_applets)
-        m_applets = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](auto&) { return false; });
+        m_applets = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](auto&) { return false; }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
     return *m_applets;
 }
 
@@ -1976,7 +2040,7 @@ GC::Ref<HTMLCollection> Document::anchors()
     if (!m_anchors) {
         m_anchors = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLAnchorElement>(element) && element.name().has_value();
-        });
+        }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
     }
     return *m_anchors;
 }
@@ -1987,7 +2051,7 @@ GC::Ref<HTMLCollection> Document::images()
     if (!m_images) {
         m_images = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLImageElement>(element);
-        });
+        }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
     }
     return *m_images;
 }
@@ -1998,7 +2062,7 @@ GC::Ref<HTMLCollection> Document::embeds()
     if (!m_embeds) {
         m_embeds = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLEmbedElement>(element);
-        });
+        }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
     }
     return *m_embeds;
 }
@@ -2026,7 +2090,7 @@ GC::Ref<HTMLCollection> Document::forms()
     if (!m_forms) {
         m_forms = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLFormElement>(element);
-        });
+        }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
     }
     return *m_forms;
 }
@@ -2037,7 +2101,7 @@ GC::Ref<HTMLCollection> Document::scripts()
     if (!m_scripts) {
         m_scripts = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLScriptElement>(element);
-        });
+        }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
     }
     return *m_scripts;
 }
@@ -3151,7 +3215,22 @@ WebIDL::ExceptionOr<String> Document::cookie(Cookie::Source source)
 
     // Otherwise, the user agent must return the cookie-string for the document's URL for a "non-HTTP" API, decoded using
     // UTF-8 decode without BOM.
-    return page().client().page_did_request_cookie(m_url, source);
+    if (source != Cookie::Source::NonHttp)
+        return page().client().page_did_request_cookie(m_url, source).value;
+
+    if (m_cached_cookie_string.has_value()) {
+        auto const& cached = *m_cached_cookie_string;
+        if (cached.cookie_store_version == Cookie::cookie_store_version() && cached.url == m_url && UnixDateTime::now() < cached.cookie_string.expiry_time)
+            return cached.cookie_string.value;
+    }
+
+    // NOTE: The version is read before asking for the cookie-string, so that a change that happens in the meantime
+    //       invalidates it right away.
+    auto cookie_store_version = Cookie::cookie_store_version();
+    auto cookie_string = page().client().page_did_request_cookie(m_url, source);
+    m_cached_cookie_string = CachedCookieString { m_url, cookie_string, cookie_store_version };
+
+    return cookie_string.value;
 }
 
 // https://html.spec.whatwg.org/multipage/dom.html#dom-document-cookie
@@ -3463,6 +3542,10 @@ void Document::evaluate_media_queries_and_report_changes()
         return it.is_null();
     });
 
+    // NOTE: Also not in the spec, but this lets media queries skip evaluation if nothing they depend on has changed.
+    if (auto window = this->window())
+        window->update_media_feature_states();
+
     // 1. For each MediaQueryList object target that has doc as its document,
     //    in the order they were created, oldest first, run these substeps:
     for (auto& media_query_list_ptr : m_media_query_lists) {
@@ -3500,6 +3583,8 @@ void Document::evaluate_media_rules()
     if (!window)
         return;
 
+    window->update_media_feature_states();
+
     bool any_media_queries_changed_match_state = false;
     for_each_active_css_style_sheet([&](CSS::CSSStyleSheet& style_sheet, auto) {
         if (style_sheet.evaluate_media_queries(*window))
@@ -4295,7 +4380,7 @@ void Document::set_browsing_context(HTML::BrowsingContext* browsing_context)
 }
 
 // https://html.spec.whatwg.org/multipage/document-lifecycle.html#unload-a-document
-void Document::unload(GC::Ptr<Document>)
+void Document::unload(GC::Ptr<Document> new_document)
 {
     // FIXME: 1. Assert: this is running as part of a task queued on oldDocument's event loop.
 
@@ -4307,7 +4392,8 @@ void Document::unload(GC::Ptr<Document>)
     //           set unloadTimingInfo to null.
 
     // 5. Let intendToStoreInBfcache be true if the user agent intends to keep oldDocument alive in a session history entry, such that it can later be used for history traversal.
-    auto intend_to_store_in_bfcache = false;
+    // NOTE: Documents that can't be kept alive have already been made unsalvageable by the navigation that is unloading them.
+    auto intend_to_store_in_bfcache = new_document && m_salvageable;
 
     // 6. Let eventLoop be oldDocument's relevant agent's event loop.
     auto& event_loop = *HTML::relevant_agent(*this).event_loop;
@@ -4359,7 +4445,8 @@ void Document::unload(GC::Ptr<Document>)
 
     // FIXME: 17. Set oldDocument's has been scrolled by the user to false.
 
-    // FIXME: 18. Run any unloading document cleanup steps for oldDocument that are defined by this specification and other applicable specifications.
+    // 18. Run any unloading document cleanup steps for oldDocument that are defined by this specification and other applicable specifications.
+    run_unloading_cleanup_steps();
 
     // 19. If oldDocument's salvageable state is false, then destroy oldDocument.
     if (!m_salvageable) {
@@ -4428,6 +4515,14 @@ void Document::unload_a_document_and_its_descendants(GC::Ptr<Document> new_docum
         return number_unloaded == unloaded_documents_count;
     }));
 
+    // NOTE: A document that is still salvageable is being kept alive in its session history entry, so it can be
+    //       reactivated by a later history traversal instead of being loaded again.
+    if (m_salvageable) {
+        if (after_all_unloads)
+            after_all_unloads->function()();
+        return;
+    }
+
     destroy_a_document_and_its_descendants(move(after_all_unloads));
 }
 
@@ -5235,8 +5330,49 @@ void Document::update_for_history_step_application(GC::Ref<HTML::SessionHistoryE
     // 9. Otherwise, if documentsEntryChanged is false and doNotReactivate is false, then:
     // NOTE: This is for bfcache restoration
     if (!documents_entry_changed && !do_not_reactivate) {
-        // FIXME: 1. Assert: entriesForNavigationAPI is given.
-        // FIXME: 2. Reactivate document given entry and entriesForNavigationAPI.
+        // 1. Assert: entriesForNavigationAPI is given.
+        VERIFY(entries_for_navigation_api.has_value());
+
+        // 2. Reactivate document given entry and entriesForNavigationAPI.
+        reactivate(entry, *entries_for_navigation_api);
+    }
+}
+
+// https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+void Document::reactivate(GC::Ref<HTML::SessionHistoryEntry> reactivated_entry, Vector<GC::Ref<HTML::SessionHistoryEntry>> const& new_navigation_api_state)
+{
+    // FIXME: 1. For each formControl of form controls in document with an autofill field name of "off", invoke the reset algorithm for formControl.
+
+    // FIXME: 2. If document's suspended timer handles is not empty:
+    //           1. Assert: document's suspension time is not zero.
+    //           2. Let suspendDuration be the current high resolution time minus document's suspension time.
+    //           3. Let activeTimers be document's relevant global object's map of active timers.
+    //           4. For each handle in document's suspended timer handles, if activeTimers[handle] exists, then increase activeTimers[handle] by suspendDuration.
+
+    // 3. Update the navigation API entries for reactivation given document's relevant global object's navigation API, newNavigationAPIState, and reactivatedEntry.
+    auto& window = as<HTML::Window>(HTML::relevant_global_object(*this));
+    window.navigation()->update_the_navigation_api_entries_for_reactivation(new_navigation_api_state, reactivated_entry);
+
+    // AD-HOC: The layout tree was torn down when this document stopped being active, and the UI still shows the
+    //         document that was unloaded, so bring both up to date with this document again.
+    set_needs_display();
+    if (auto navigable = this->navigable(); navigable && navigable->is_top_level_traversable()) {
+        page().client().page_did_finish_loading(url());
+        page().client().page_did_change_title(title().to_byte_string());
+    }
+
+    // 4. If document's current document readiness is "complete", and document's page showing is false:
+    if (m_readiness == HTML::DocumentReadyState::Complete && !m_page_showing) {
+        // 1. Set document's page showing to true.
+        set_page_showing(true);
+
+        // FIXME: 2. Set document's has been revealed to false.
+
+        // 3. Update the visibility state of document to "visible".
+        update_the_visibility_state(HTML::VisibilityState::Visible);
+
+        // 4. Fire a page transition event named pageshow at document's relevant global object with true.
+        window.fire_a_page_transition_event(HTML::EventNames::pageshow, true);
     }
 }
 
@@ -5815,7 +5951,7 @@ JS::Value Document::named_item_value(FlyString const& name) const
     // 4. Otherwise return an HTMLCollection rooted at the Document node, whose filter matches only named elements with the name name.
     return HTMLCollection::create(*const_cast<Document*>(this), HTMLCollection::Scope::Descendants, [name](auto& element) {
         return is_named_element_with_name(element, name);
-    });
+    }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
 }
 
 // https://drafts.csswg.org/resize-observer-1/#calculate-depth-for-node
@@ -6117,7 +6253,7 @@ void Document::add_an_element_to_the_top_layer(GC::Ref<Element> element)
     // FIXME: 4. At the UA !important cascade origin, add a rule targeting el containing an overlay: auto declaration.
     element->set_rendered_in_top_layer(true);
     element->set_needs_style_update(true);
-    invalidate_layout_tree(InvalidateLayoutTreeReason::DocumentAddAnElementToTheTopLayer);
+    invalidate_layout_tree_for_top_layer_change(element);
 }
 
 // https://drafts.csswg.org/css-position-4/#request-an-element-to-be-removed-from-the-top-layer
@@ -6132,7 +6268,7 @@ void Document::request_an_element_to_be_remove_from_the_top_layer(GC::Ref<Elemen
     // FIXME: 3. Remove the UA !important overlay: auto rule targeting el.
     element->set_rendered_in_top_layer(false);
     element->set_needs_style_update(true);
-    invalidate_layout_tree(InvalidateLayoutTreeReason::DocumentRequestAnElementToBeRemovedFromTheTopLayer);
+    invalidate_layout_tree_for_top_layer_change(element);
 
     // 4. Append el to doc’s pending top layer removals.
     m_top_layer_pending_removals.set(element);
@@ -6172,6 +6308,30 @@ void Document::process_top_layer_removals()
     }
 }
 
+void Document::register_canvas_with_deferred_drawing(Badge<HTML::CanvasRenderingContext2D>, HTML::CanvasRenderingContext2D& context)
+{
+    m_canvases_with_deferred_drawing.set(context);
+}
+
+void Document::flush_deferred_canvas_drawing()
+{
+    for (auto& context : m_canvases_with_deferred_drawing)
+        context->flush_deferred_drawing();
+    m_canvases_with_deferred_drawing.clear();
+}
+
+void Document::register_placeholder_canvas(Badge<HTML::HTMLCanvasElement>, HTML::HTMLCanvasElement& canvas)
+{
+    m_placeholder_canvases.append(canvas);
+}
+
+void Document::update_placeholder_canvases()
+{
+    m_placeholder_canvases.remove_all_matching([](auto const& canvas) { return canvas.is_null(); });
+    for (auto const& canvas : m_placeholder_canvases)
+        canvas->update_placeholder_frame();
+}
+
 // https://html.spec.whatwg.org/multipage/popover.html#topmost-auto-popover
 GC::Ptr<HTML::HTMLElement> Document::topmost_auto_or_hint_popover()
 {
@@ -6410,11 +6570,13 @@ void Document::set_needs_display(InvalidateDisplayList should_invalidate_display
     set_needs_display(viewport_rect(), should_invalidate_display_list);
 }
 
-void Document::set_needs_display(CSSPixelRect const&, InvalidateDisplayList should_invalidate_display_list)
+void Document::set_needs_display(CSSPixelRect const& rect, InvalidateDisplayList should_invalidate_display_list)
 {
     // FIXME: Ignore updates outside the visible viewport rect.
     //        This requires accounting for fixed-position elements in the input rect, which we don't do yet.
 
+    add_damaged_rect(rect);
+
     if (should_invalidate_display_list == InvalidateDisplayList::Yes) {
         invalidate_display_list();
     }
@@ -6434,7 +6596,27 @@ void Document::set_needs_display(CSSPixelRect const&, InvalidateDisplayList shou
     }
 }
 
+void Document::add_damaged_rect(CSSPixelRect const& rect)
+{
+    if (m_damaged_rect.has_value())
+        m_damaged_rect->unite(rect);
+    else
+        m_damaged_rect = rect;
+}
+
+Optional<CSSPixelRect> Document::take_damaged_rect()
+{
+    return exchange(m_damaged_rect, {});
+}
+
 void Document::invalidate_display_list()
+{
+    // NOTE: This makes the commands cached by every stacking context stale as well.
+    ++m_display_list_generation;
+    invalidate_cached_display_list();
+}
+
+void Document::invalidate_cached_display_list()
 {
     m_cached_display_list.clear();
 
@@ -6619,6 +6801,25 @@ ElementByIdMap& Document::element_by_id() const
     return *m_element_by_id;
 }
 
+Optional<CSS::SelectorList> Document::parse_selector_for_query(StringView selector_text) const
+{
+    // NOTE: Scripts tend to query a small set of selector strings over and over, so a small cache covers them well.
+    static constexpr size_t max_cached_query_selectors = 256;
+
+    auto key = MUST(String::from_utf8(selector_text));
+    if (auto cached = m_query_selector_cache.get(key); cached.has_value())
+        return cached.value();
+
+    auto selectors = parse_selector(CSS::Parser::ParsingParams { *this }, selector_text);
+    if (!selectors.has_value())
+        return {};
+
+    if (m_query_selector_cache.size() >= max_cached_query_selectors)
+        m_query_selector_cache.clear();
+    m_query_selector_cache.set(move(key), selectors.value());
+    return selectors;
+}
+
 GC::Ptr<Element> ElementByIdMap::get(FlyString const& element_id) const
 {
     if (auto elements = m_map.get(element_id); elements.has_value() && !elements->is_empty()) {
@@ -50,9 +50,7 @@ enum class QuirksMode {
     Yes
 };
 
-#define ENUMERATE_INVALIDATE_LAYOUT_TREE_REASONS(X)       \
-    X(DocumentAddAnElementToTheTopLayer)                  \
-    X(DocumentRequestAnElementToBeRemovedFromTheTopLayer) \
+#define ENUMERATE_INVALIDATE_LAYOUT_TREE_REASONS(X) \
     X(ShadowRootSetInnerHTML)
 
 enum class InvalidateLayoutTreeReason {
@@ -105,6 +103,7 @@ enum class InvalidateLayoutTreeReason {
     X(HTMLInputElementHeight)              \
     X(HTMLInputElementWidth)               \
     X(InternalsHitTest)                    \
+    X(InternalsMeasureRenderingUpdate)     \
     X(MediaQueryListMatches)               \
     X(NodeNameOrDescription)               \
     X(RangeGetClientRects)                 \
@@ -583,6 +582,10 @@ public:
     }
 
     bool needs_full_style_update() const { return m_needs_full_style_update; }
+
+    void record_style_invalidation(StyleInvalidationReason reason) { ++m_style_invalidations_since_last_style_update[to_underlying(reason)]; }
+    using StyleInvalidationCounts = Array<u32, to_underlying(StyleInvalidationReason::__Count)>;
+    StyleInvalidationCounts const& style_invalidations_before_last_style_update() const { return m_style_invalidations_before_last_style_update; }
     void set_needs_full_style_update(bool b) { m_needs_full_style_update = b; }
 
     [[nodiscard]] bool needs_full_layout_tree_update() const { return m_needs_full_layout_tree_update; }
@@ -685,6 +688,7 @@ public:
 
     void make_active();
 
+    bool is_salvageable() const { return m_salvageable; }
     void set_salvageable(bool value) { m_salvageable = value; }
 
     void make_unsalvageable(String reason);
@@ -714,6 +718,7 @@ public:
     GC::Ref<HTML::SourceSnapshotParams> snapshot_source_snapshot_params() const;
 
     void update_for_history_step_application(GC::Ref<HTML::SessionHistoryEntry>, bool do_not_reactivate, size_t script_history_length, size_t script_history_index, Optional<Bindings::NavigationType> navigation_type, Optional<Vector<GC::Ref<HTML::SessionHistoryEntry>>> entries_for_navigation_api = {}, GC::Ptr<HTML::SessionHistoryEntry> previous_entry_for_activation = {}, bool update_navigation_api = true);
+    void reactivate(GC::Ref<HTML::SessionHistoryEntry> reactivated_entry, Vector<GC::Ref<HTML::SessionHistoryEntry>> const& new_navigation_api_state);
 
     HashMap<URL::URL, GC::Ptr<HTML::SharedResourceRequest>>& shared_resource_requests();
 
@@ -763,6 +768,9 @@ public:
     GC::Ptr<Element const> scrolling_element() const;
 
     void set_needs_to_resolve_paint_only_properties() { m_needs_to_resolve_paint_only_properties = true; }
+    // Only resolves the paint-only properties of the paintables of this layout node and their descendants, which is
+    // enough when nothing but its paint-only properties changed (e.g. while animating transform or opacity).
+    void set_needs_to_resolve_paint_only_properties(Layout::Node&);
     void set_needs_animated_style_update() { m_needs_animated_style_update = true; }
 
     virtual JS::Value named_item_value(FlyString const& name) const override;
@@ -787,6 +795,12 @@ public:
     void remove_an_element_from_the_top_layer_immediately(GC::Ref<Element>);
     void process_top_layer_removals();
 
+    void register_canvas_with_deferred_drawing(Badge<HTML::CanvasRenderingContext2D>, HTML::CanvasRenderingContext2D&);
+    void flush_deferred_canvas_drawing();
+
+    void register_placeholder_canvas(Badge<HTML::HTMLCanvasElement>, HTML::HTMLCanvasElement&);
+    void update_placeholder_canvases();
+
     OrderedHashTable<GC::Ref<Element>> const& top_layer_elements() const { return m_top_layer_elements; }
 
     // AD-HOC: These lists are managed dynamically instead of being generated as needed.
@@ -832,9 +846,16 @@ public:
     void set_needs_display(InvalidateDisplayList = InvalidateDisplayList::Yes);
     void set_needs_display(CSSPixelRect const&, InvalidateDisplayList = InvalidateDisplayList::Yes);
 
+    // Returns the union of the absolute rects that need repainting since the last call, if any were recorded.
+    Optional<CSSPixelRect> take_damaged_rect();
+
     RefPtr<Painting::DisplayList> record_display_list(HTML::PaintConfig);
 
     void invalidate_display_list();
+    // Drops the display list, but keeps the commands cached by stacking contexts that weren't invalidated.
+    void invalidate_cached_display_list();
+    bool has_cached_display_list() const { return m_cached_display_list; }
+    u64 display_list_generation() const { return m_display_list_generation; }
 
     Unicode::Segmenter& grapheme_segmenter() const;
     Unicode::Segmenter& word_segmenter() const;
@@ -900,6 +921,9 @@ public:
 
     ElementByIdMap& element_by_id() const;
 
+    // Parses a selector string for querySelector(), matches() and friends, reusing the result for repeated strings.
+    Optional<CSS::SelectorList> parse_selector_for_query(StringView) const;
+
     auto& script_blocking_style_sheet_set() { return m_script_blocking_style_sheet_set; }
     auto const& script_blocking_style_sheet_set() const { return m_script_blocking_style_sheet_set; }
 
@@ -916,6 +940,8 @@ private:
     void invalidate_style_of_elements_affected_by_has();
 
     void tear_down_layout_tree();
+    void invalidate_layout_tree_for_top_layer_change(Element&);
+    void add_damaged_rect(CSSPixelRect const&);
 
     void update_active_element();
 
@@ -962,6 +988,9 @@ private:
     URL::URL m_url;
     mutable OwnPtr<ElementByIdMap> m_element_by_id;
 
+    // NOTE: Parsed selector strings, keyed by their source text. Selector parsing doesn't depend on document state.
+    mutable HashMap<String, CSS::SelectorList> m_query_selector_cache;
+
     GC::Ptr<HTML::Window> m_window;
 
     GC::Ptr<Layout::Viewport> m_layout_root;
@@ -1066,6 +1095,9 @@ private:
     Vector<WeakPtr<CSS::MediaQueryList>> m_media_query_lists;
 
     bool m_needs_full_style_update { false };
+    // How often each kind of style invalidation happened leading up to the last style update, and since then.
+    StyleInvalidationCounts m_style_invalidations_before_last_style_update {};
+    StyleInvalidationCounts m_style_invalidations_since_last_style_update {};
     bool m_needs_full_layout_tree_update { false };
 
     bool m_needs_animated_style_update { false };
@@ -1187,6 +1219,7 @@ private:
     bool m_design_mode_enabled { false };
 
     bool m_needs_to_resolve_paint_only_properties { true };
+    Vector<GC::Ref<Layout::Node>> m_layout_nodes_needing_paint_only_properties_resolved;
 
     mutable GC::Ptr<WebIDL::ObservableArray> m_adopted_style_sheets;
 
@@ -1228,8 +1261,20 @@ private:
 
     bool m_enable_cookies_on_file_domains { false };
 
+    // OPTIMIZATION: Scripts tend to read document.cookie over and over, so we hold on to the last cookie-string we got
+    //               until the cookie store changes, one of its cookies expires, or the document's URL changes.
+    struct CachedCookieString {
+        URL::URL url;
+        Cookie::CookieString cookie_string;
+        u64 cookie_store_version { 0 };
+    };
+    Optional<CachedCookieString> m_cached_cookie_string;
+
     Optional<HTML::PaintConfig> m_cached_display_list_paint_config;
     RefPtr<Painting::DisplayList> m_cached_display_list;
+    u64 m_display_list_generation { 0 };
+
+    Optional<CSSPixelRect> m_damaged_rect;
 
     mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
     mutable OwnPtr<Unicode::Segmenter> m_word_segmenter;
@@ -1261,6 +1306,13 @@ private:
     // https://html.spec.whatwg.org/multipage/dom.html#render-blocking-element-set
     HashTable<GC::Ref<Element>> m_render_blocking_elements;
 
+    // Canvas contexts that recorded drawing commands which have to be replayed onto their canvas before the next frame.
+    HashTable<GC::Ref<HTML::CanvasRenderingContext2D>> m_canvases_with_deferred_drawing;
+
+    // https://html.spec.whatwg.org/multipage/canvas.html#offscreencanvas-placeholder
+    // Canvas elements whose control was transferred to an OffscreenCanvas, and which present the frames it commits.
+    Vector<WeakPtr<HTML::HTMLCanvasElement>> m_placeholder_canvases;
+
     HashTable<WeakPtr<Node>> m_pending_nodes_for_style_invalidation_due_to_presence_of_has;
 };
 
@@ -11,6 +11,7 @@
 #include <AK/Debug.h>
 #include <AK/IterationDecision.h>
 #include <AK/NumericLimits.h>
+#include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibUnicode/CharacterTypes.h>
@@ -661,6 +662,10 @@ void Element::run_attribute_change_steps(FlyString const& local_name, Optional<S
     if (old_value != value) {
         invalidate_style_after_attribute_change(local_name, old_value, value);
         document().bump_dom_tree_version();
+        if (local_name.is_one_of(HTML::AttributeNames::id, HTML::AttributeNames::name, HTML::AttributeNames::class_))
+            did_change_subtree(SubtreeChange::Structure);
+        else
+            did_change_subtree(SubtreeChange::Attribute);
     }
 }
 
@@ -697,21 +702,24 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style()
     m_sibling_invalidation_distance = 0;
 
     auto& style_computer = document().style_computer();
-    auto new_computed_properties = style_computer.compute_style(*this);
-
-    // Tables must not inherit -libweb-* values for text-align.
-    // FIXME: Find the spec for this.
-    if (is<HTML::HTMLTableElement>(*this)) {
-        auto text_align = new_computed_properties->text_align();
-        if (text_align == CSS::TextAlign::LibwebLeft || text_align == CSS::TextAlign::LibwebCenter || text_align == CSS::TextAlign::LibwebRight)
-            new_computed_properties->set_property(CSS::PropertyID::TextAlign, CSS::CSSKeywordValue::create(CSS::Keyword::Start));
+    GC::Ptr<CSS::ComputedProperties> new_computed_properties = style_computer.share_style_with_recently_styled_element(*this);
+    if (!new_computed_properties) {
+        new_computed_properties = style_computer.compute_style(*this);
+
+        // Tables must not inherit -libweb-* values for text-align.
+        // FIXME: Find the spec for this.
+        if (is<HTML::HTMLTableElement>(*this)) {
+            auto text_align = new_computed_properties->text_align();
+            if (text_align == CSS::TextAlign::LibwebLeft || text_align == CSS::TextAlign::LibwebCenter || text_align == CSS::TextAlign::LibwebRight)
+                new_computed_properties->set_property(CSS::PropertyID::TextAlign, CSS::CSSKeywordValue::create(CSS::Keyword::Start));
+        }
     }
 
     bool had_list_marker = false;
 
     CSS::RequiredInvalidationAfterStyleChange invalidation;
     if (m_computed_properties) {
-        invalidation = compute_required_invalidation(*m_computed_properties, new_computed_properties);
+        invalidation = compute_required_invalidation(*m_computed_properties, *new_computed_properties);
         had_list_marker = m_computed_properties->display().is_list_item();
     } else {
         invalidation = CSS::RequiredInvalidationAfterStyleChange::full();
@@ -720,7 +728,8 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style()
     auto old_display_is_none = m_computed_properties ? m_computed_properties->display().is_none() : true;
     auto new_display_is_none = new_computed_properties->display().is_none();
 
-    set_computed_properties(move(new_computed_properties));
+    set_computed_properties(new_computed_properties);
+    style_computer.add_style_sharing_candidate(*this);
 
     if (old_display_is_none != new_display_is_none) {
         for_each_shadow_including_inclusive_descendant([&](auto& node) {
@@ -971,7 +980,7 @@ GC::Ptr<ShadowRoot> Element::shadow_root_for_bindings() const
 WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 {
     // 1. Let s be the result of parse a selector from selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams(document()), selectors);
+    auto maybe_selectors = document().parse_selector_for_query(selectors);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -991,7 +1000,7 @@ WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 WebIDL::ExceptionOr<DOM::Element const*> Element::closest(StringView selectors) const
 {
     // 1. Let s be the result of parse a selector from selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams(document()), selectors);
+    auto maybe_selectors = document().parse_selector_for_query(selectors);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -3196,11 +3205,9 @@ bool Element::check_visibility(Optional<CheckVisibilityOptions> options)
     }
 
     // 5. If the contentVisibilityAuto dictionary member of options is true and an ancestor of this in the flat tree skips its contents due to content-visibility: auto, return false.
-    // FIXME: Currently we do not skip any content if content-visibility is auto: https://drafts.csswg.org/css-contain-2/#proximity-to-the-viewport
-    auto const skipped_contents_due_to_content_visibility_auto = false;
-    if (options->content_visibility_auto && skipped_contents_due_to_content_visibility_auto) {
-        for (auto* element = this; element; element = element->parent_element()) {
-            if (element->computed_properties()->content_visibility() == CSS::ContentVisibility::Auto)
+    if (options->content_visibility_auto) {
+        for (auto* element = parent_element(); element; element = element->parent_element()) {
+            if (element->computed_properties()->content_visibility() == CSS::ContentVisibility::Auto && element->skips_its_contents())
                 return false;
         }
     }
@@ -3212,6 +3219,13 @@ bool Element::check_visibility(Optional<CheckVisibilityOptions> options)
 // https://drafts.csswg.org/css-contain/#proximity-to-the-viewport
 void Element::determine_proximity_to_the_viewport()
 {
+    auto skipped_its_contents = skips_its_contents();
+    ScopeGuard invalidate_if_skipping_changed = [&] {
+        // Skipped contents don't get boxes, so starting or stopping to skip them needs a layout tree update.
+        if (skips_its_contents() != skipped_its_contents)
+            set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::ContentVisibilityAutoStateChange);
+    };
+
     // An element that has content-visibility: auto is in one of three states when it comes to its proximity to the viewport:
 
     // - The element is close to the viewport: In this state, the element is considered "on-screen": its paint
@@ -3222,8 +3236,10 @@ void Element::determine_proximity_to_the_viewport()
     // viewport soon. A margin of 50% is suggested as a reasonable default.
     viewport_rect.inflate(viewport_rect.width(), viewport_rect.height());
     // FIXME: We don't have paint containment or the overflow clip edge yet, so this is just using the absolute rect for now.
-    if (paintable_box()->absolute_rect().intersects(viewport_rect))
+    if (paintable_box()->absolute_rect().intersects(viewport_rect)) {
         m_proximity_to_the_viewport = ProximityToTheViewport::CloseToTheViewport;
+        return;
+    }
 
     // FIXME: If a filter (see [FILTER-EFFECTS-1]) with non local effects includes the element as part of its input, the user
     //        agent should also treat the element as relevant to the user when the filter’s output can affect the rendering
@@ -3258,17 +3274,11 @@ bool Element::is_relevant_to_the_user()
         return true;
 
     // Either the element or its contents are placed in the top layer.
-    bool is_in_top_layer = false;
-    for_each_in_inclusive_subtree_of_type<Element>([&](auto& element) {
-        if (element.in_top_layer()) {
-            is_in_top_layer = true;
-            return TraversalDecision::Break;
-        }
-
-        return TraversalDecision::Continue;
-    });
-    if (is_in_top_layer)
-        return true;
+    // NOTE: The top layer is usually tiny, so look through it rather than through this element's subtree.
+    for (auto const& element : document().top_layer_elements()) {
+        if (is_inclusive_ancestor_of(*element))
+            return true;
+    }
 
     // FIXME: The element has a flat tree descendant that is captured in a view transition.
 
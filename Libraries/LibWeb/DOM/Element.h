@@ -429,6 +429,11 @@ public:
     // https://drafts.csswg.org/css-contain-2/#skips-its-contents
     bool skips_its_contents();
 
+    // The content box size of this element the last time its contents were laid out, used as a placeholder while a
+    // content-visibility: auto element skips its contents.
+    Optional<CSSPixelSize> const& last_remembered_content_size() const { return m_last_remembered_content_size; }
+    void set_last_remembered_content_size(CSSPixelSize size) { m_last_remembered_content_size = size; }
+
     bool matches_enabled_pseudo_class() const;
     bool matches_disabled_pseudo_class() const;
     bool matches_checked_pseudo_class() const;
@@ -616,6 +621,7 @@ private:
 
     // https://drafts.csswg.org/css-contain/#proximity-to-the-viewport
     ProximityToTheViewport m_proximity_to_the_viewport { ProximityToTheViewport::NotDetermined };
+    Optional<CSSPixelSize> m_last_remembered_content_size;
 
     // https://html.spec.whatwg.org/multipage/grouping-content.html#ordinal-value
     Optional<i32> m_ordinal_value;
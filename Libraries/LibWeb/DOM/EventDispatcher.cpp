@@ -121,6 +121,20 @@ bool EventDispatcher::inner_invoke(Event& event, Vector<GC::Root<DOM::DOMEventLi
     return found;
 }
 
+// The table of legacy event types from step 9.2 of https://dom.spec.whatwg.org/#concept-event-listener-invoke
+static Optional<FlyString> legacy_event_type_for(FlyString const& type)
+{
+    if (type == HTML::EventNames::animationend)
+        return HTML::EventNames::webkitAnimationEnd;
+    if (type == HTML::EventNames::animationiteration)
+        return HTML::EventNames::webkitAnimationIteration;
+    if (type == HTML::EventNames::animationstart)
+        return HTML::EventNames::webkitAnimationStart;
+    if (type == HTML::EventNames::transitionend)
+        return HTML::EventNames::webkitTransitionEnd;
+    return {};
+}
+
 // https://dom.spec.whatwg.org/#concept-event-listener-invoke
 void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Phase phase, bool& legacy_output_did_listeners_throw)
 {
@@ -147,6 +161,18 @@ void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Pha
     // 5. Initialize event’s currentTarget attribute to struct’s invocation target.
     event.set_current_target(struct_.invocation_target.ptr());
 
+    // OPTIMIZATION: Most targets on an event path have no listener for the event's type, in which case cloning their
+    //               listener list below would be wasted work, as inner invoke would not find anything to call.
+    //               This also covers the legacy event types tried for trusted events in step 9.
+    {
+        auto const& current_target = *event.current_target();
+        Optional<FlyString> legacy_type;
+        if (event.is_trusted())
+            legacy_type = legacy_event_type_for(event.type());
+        if (!current_target.has_event_listener(event.type()) && (!legacy_type.has_value() || !current_target.has_event_listener(*legacy_type)))
+            return;
+    }
+
     // 6. Let listeners be a clone of event’s currentTarget attribute value’s event listener list.
     // NOTE: This avoids event listeners added after this point from being run. Note that removal still has an effect due to the removed field.
     auto listeners = event.current_target()->event_listener_list();
@@ -164,16 +190,10 @@ void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Pha
 
         // 2. If event’s type attribute value is a match for any of the strings in the first column in the following table,
         //    set event’s type attribute value to the string in the second column on the same row as the matching string, and return otherwise.
-        if (event.type() == HTML::EventNames::animationend)
-            event.set_type(HTML::EventNames::webkitAnimationEnd);
-        else if (event.type() == HTML::EventNames::animationiteration)
-            event.set_type(HTML::EventNames::webkitAnimationIteration);
-        else if (event.type() == HTML::EventNames::animationstart)
-            event.set_type(HTML::EventNames::webkitAnimationStart);
-        else if (event.type() == HTML::EventNames::transitionend)
-            event.set_type(HTML::EventNames::webkitTransitionEnd);
-        else
+        auto legacy_type = legacy_event_type_for(event.type());
+        if (!legacy_type.has_value())
             return;
+        event.set_type(legacy_type.release_value());
 
         // 3. Inner invoke with event, listeners, phase, invocationTargetInShadowTree, and legacyOutputDidListenersThrowFlag if given.
         inner_invoke(event, listeners, phase, invocation_target_in_shadow_tree, legacy_output_did_listeners_throw);
@@ -17,16 +17,17 @@ namespace Web::DOM {
 
 GC_DEFINE_ALLOCATOR(HTMLCollection);
 
-GC::Ref<HTMLCollection> HTMLCollection::create(ParentNode& root, Scope scope, Function<bool(Element const&)> filter)
+GC::Ref<HTMLCollection> HTMLCollection::create(ParentNode& root, Scope scope, Function<bool(Element const&)> filter, FilterInputs filter_inputs)
 {
-    return root.realm().create<HTMLCollection>(root, scope, move(filter));
+    return root.realm().create<HTMLCollection>(root, scope, move(filter), filter_inputs);
 }
 
-HTMLCollection::HTMLCollection(ParentNode& root, Scope scope, Function<bool(Element const&)> filter)
+HTMLCollection::HTMLCollection(ParentNode& root, Scope scope, Function<bool(Element const&)> filter, FilterInputs filter_inputs)
     : PlatformObject(root.realm())
     , m_root(root)
     , m_filter(move(filter))
     , m_scope(scope)
+    , m_filter_inputs(filter_inputs)
 {
     m_legacy_platform_object_flags = LegacyPlatformObjectFlags {
         .supports_indexed_properties = true,
@@ -74,10 +75,22 @@ void HTMLCollection::update_name_to_element_mappings_if_needed() const
     }
 }
 
+u64 HTMLCollection::current_root_version() const
+{
+    switch (m_filter_inputs) {
+    case FilterInputs::AnyAttribute:
+        return m_root->subtree_version();
+    case FilterInputs::StructureAndIdentifyingAttributes:
+        return m_root->subtree_structure_version();
+    }
+    VERIFY_NOT_REACHED();
+}
+
 void HTMLCollection::update_cache_if_needed() const
 {
-    // Nothing to do, the DOM hasn't updated since we last built the cache.
-    if (m_cached_dom_tree_version == root()->document().dom_tree_version())
+    // Nothing to do, nothing the filter depends on has changed in our subtree since we last built the cache.
+    auto root_version = current_root_version();
+    if (m_cached_root_version == root_version)
         return;
 
     m_cached_elements.clear();
@@ -95,7 +108,7 @@ void HTMLCollection::update_cache_if_needed() const
             return IterationDecision::Continue;
         });
     }
-    m_cached_dom_tree_version = root()->document().dom_tree_version();
+    m_cached_root_version = root_version;
 }
 
 GC::RootVector<GC::Ref<Element>> HTMLCollection::collect_matching_elements() const
@@ -30,7 +30,16 @@ public:
         Children,
         Descendants,
     };
-    [[nodiscard]] static GC::Ref<HTMLCollection> create(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter);
+
+    // What the filter looks at, which decides which changes to the root's subtree make the collection rebuild its cache.
+    // Filters that only look at the tree structure, tag names, or the id, name and class attributes don't need to
+    // react to changes to any other attribute.
+    enum class FilterInputs {
+        AnyAttribute,
+        StructureAndIdentifyingAttributes,
+    };
+
+    [[nodiscard]] static GC::Ref<HTMLCollection> create(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter, FilterInputs = FilterInputs::AnyAttribute);
 
     virtual ~HTMLCollection() override;
 
@@ -46,7 +55,7 @@ public:
     virtual bool is_supported_property_name(FlyString const&) const override;
 
 protected:
-    HTMLCollection(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter);
+    HTMLCollection(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter, FilterInputs = FilterInputs::AnyAttribute);
 
     virtual void initialize(JS::Realm&) override;
 
@@ -59,7 +68,9 @@ private:
     void update_cache_if_needed() const;
     void update_name_to_element_mappings_if_needed() const;
 
-    mutable u64 m_cached_dom_tree_version { 0 };
+    u64 current_root_version() const;
+
+    mutable Optional<u64> m_cached_root_version;
     mutable Vector<GC::Ref<Element>> m_cached_elements;
     mutable OwnPtr<OrderedHashMap<FlyString, GC::Ref<Element>>> m_cached_name_to_element_mappings;
 
@@ -67,6 +78,7 @@ private:
     Function<bool(Element const&)> m_filter;
 
     Scope m_scope { Scope::Descendants };
+    FilterInputs m_filter_inputs { FilterInputs::AnyAttribute };
 };
 
 }
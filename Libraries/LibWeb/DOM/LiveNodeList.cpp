@@ -33,6 +33,7 @@ void LiveNodeList::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_root);
+    visitor.visit(m_cached_child);
 }
 
 GC::RootVector<Node*> LiveNodeList::collection() const
@@ -87,10 +88,46 @@ u32 LiveNodeList::length() const
 Node const* LiveNodeList::item(u32 index) const
 {
     // The item(index) method must return the indexth node in the collection. If there is no indexth node in the collection, then the method must return null.
+    if (m_scope == Scope::Children)
+        return child_item(index);
+
     auto nodes = collection();
     if (index >= nodes.size())
         return nullptr;
     return nodes[index];
 }
 
+// OPTIMIZATION: Indexing into a list of children is usually done in order (e.g. `for (i = 0; i < childNodes.length; ++i)`),
+//               so we step from the most recently returned child instead of collecting the whole list each time. That
+//               child stays at its position until the root's child indices change.
+Node const* LiveNodeList::child_item(u32 index) const
+{
+    Node const* child = nullptr;
+    u32 child_index = 0;
+
+    if (m_cached_child && m_cached_child_version == m_root->child_indices_version() && m_cached_child_index <= index) {
+        child = m_cached_child;
+        child_index = m_cached_child_index;
+    } else {
+        child = m_root->first_child();
+        while (child && !m_filter(*child))
+            child = child->next_sibling();
+    }
+
+    while (child && child_index < index) {
+        do {
+            child = child->next_sibling();
+        } while (child && !m_filter(*child));
+        ++child_index;
+    }
+
+    if (!child)
+        return nullptr;
+
+    m_cached_child = child;
+    m_cached_child_index = child_index;
+    m_cached_child_version = m_root->child_indices_version();
+    return child;
+}
+
 }
@@ -12,7 +12,7 @@
 
 namespace Web::DOM {
 
-// FIXME: Just like HTMLCollection, LiveNodeList currently does no caching.
+// FIXME: Just like HTMLCollection, LiveNodeList does no caching beyond remembering its position in a list of children.
 
 class LiveNodeList : public NodeList {
     WEB_PLATFORM_OBJECT(LiveNodeList, NodeList);
@@ -39,10 +39,15 @@ private:
     virtual void visit_edges(Cell::Visitor&) override;
 
     GC::RootVector<Node*> collection() const;
+    Node const* child_item(u32 index) const;
 
     GC::Ref<Node const> m_root;
     Function<bool(Node const&)> m_filter;
     Scope m_scope { Scope::Descendants };
+
+    mutable GC::Ptr<Node const> m_cached_child;
+    mutable u32 m_cached_child_index { 0 };
+    mutable u64 m_cached_child_version { 0 };
 };
 
 }
@@ -146,18 +146,19 @@ Attr const* NamedNodeMap::get_attribute(FlyString const& qualified_name, size_t*
     if (item_index)
         *item_index = 0;
 
+    if (m_attributes.is_empty())
+        return nullptr;
+
     // 1. If element is in the HTML namespace and its node document is an HTML document, then set qualifiedName to qualifiedName in ASCII lowercase.
+    // NOTE: Lowercasing returns the same FlyString when there is nothing to lowercase, which is the common case.
     bool compare_as_lowercase = associated_element().namespace_uri() == Namespace::HTML && associated_element().document().is_html_document();
+    auto const& name_to_find = compare_as_lowercase ? qualified_name.to_ascii_lowercase() : qualified_name;
 
     // 2. Return the first attribute in element’s attribute list whose qualified name is qualifiedName; otherwise null.
+    // NOTE: FlyStrings are interned, so this is a pointer comparison per attribute.
     for (auto const& attribute : m_attributes) {
-        if (compare_as_lowercase) {
-            if (attribute->name().equals_ignoring_ascii_case(qualified_name) && !AK::any_of(attribute->name().bytes(), is_ascii_upper_alpha))
-                return attribute;
-        } else {
-            if (attribute->name() == qualified_name)
-                return attribute;
-        }
+        if (attribute->name() == name_to_find)
+            return attribute;
 
         if (item_index)
             ++(*item_index);
@@ -178,14 +179,18 @@ Attr const* NamedNodeMap::get_attribute_ns(Optional<FlyString> const& namespace_
     if (item_index)
         *item_index = 0;
 
+    if (m_attributes.is_empty())
+        return nullptr;
+
     // 1. If namespace is the empty string, then set it to null.
     Optional<FlyString> normalized_namespace;
     if (namespace_ != String {})
         normalized_namespace = namespace_;
 
     // 2. Return the attribute in element’s attribute list whose namespace is namespace and local name is localName, if any; otherwise null.
+    // NOTE: The local name is compared first, as it is by far the more selective of the two.
     for (auto const& attribute : m_attributes) {
-        if (attribute->namespace_uri() == normalized_namespace && attribute->local_name() == local_name)
+        if (attribute->local_name() == local_name && attribute->namespace_uri() == normalized_namespace)
             return attribute.ptr();
         if (item_index)
             ++(*item_index);
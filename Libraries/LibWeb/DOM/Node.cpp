@@ -233,6 +233,7 @@ void Node::set_text_content(Optional<String> const& maybe_content)
         set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeSetTextContent);
     }
 
+    did_change_subtree(SubtreeChange::Structure);
     document().bump_dom_tree_version();
 }
 
@@ -403,7 +404,7 @@ GC::Ptr<HTML::Navigable> Node::navigable() const
     return navigable;
 }
 
-[[maybe_unused]] static StringView to_string(StyleInvalidationReason reason)
+StringView to_string(StyleInvalidationReason reason)
 {
 #define __ENUMERATE_STYLE_INVALIDATION_REASON(reason) \
     case StyleInvalidationReason::reason:             \
@@ -415,11 +416,22 @@ GC::Ptr<HTML::Navigable> Node::navigable() const
     }
 }
 
+void Node::did_change_subtree(SubtreeChange change)
+{
+    for (auto* node = this; node; node = node->parent()) {
+        if (change == SubtreeChange::Structure)
+            ++node->m_subtree_structure_version;
+        ++node->m_subtree_version;
+    }
+}
+
 void Node::invalidate_style(StyleInvalidationReason reason)
 {
     if (is_character_data())
         return;
 
+    document().record_style_invalidation(reason);
+
     if (document().style_computer().may_have_has_selectors()) {
         if (reason == StyleInvalidationReason::NodeRemove) {
             if (auto* parent = parent_or_shadow_host(); parent) {
@@ -511,9 +523,10 @@ void Node::invalidate_style(StyleInvalidationReason reason, Vector<CSS::Invalida
     }
 
     auto invalidation_set = document().style_computer().invalidation_set_for_properties(properties);
+    auto sibling_invalidation_set = document().style_computer().sibling_invalidation_set_for_properties(properties);
     if (options.invalidate_self)
         invalidation_set.set_needs_invalidate_self();
-    if (invalidation_set.is_empty())
+    if (invalidation_set.is_empty() && sibling_invalidation_set.is_empty())
         return;
 
     if (invalidation_set.needs_invalidate_whole_subtree()) {
@@ -521,21 +534,23 @@ void Node::invalidate_style(StyleInvalidationReason reason, Vector<CSS::Invalida
         return;
     }
 
+    document().record_style_invalidation(reason);
+
     if (invalidation_set.needs_invalidate_self()) {
         set_needs_style_update(true);
     }
 
-    auto invalidate_entire_subtree = [&](Node& subtree_root) {
+    auto invalidate_entire_subtree = [&](Node& subtree_root, CSS::InvalidationSet const& subtree_invalidation_set) {
         subtree_root.for_each_shadow_including_inclusive_descendant([&](Node& node) {
             if (!node.is_element())
                 return TraversalDecision::Continue;
             auto& element = static_cast<Element&>(node);
             bool needs_style_recalculation = false;
-            if (invalidation_set.needs_invalidate_whole_subtree()) {
+            if (subtree_invalidation_set.needs_invalidate_whole_subtree()) {
                 VERIFY_NOT_REACHED();
             }
 
-            if (element.includes_properties_from_invalidation_set(invalidation_set)) {
+            if (element.includes_properties_from_invalidation_set(subtree_invalidation_set)) {
                 needs_style_recalculation = true;
             } else if (options.invalidate_elements_that_use_css_custom_properties && element.style_uses_css_custom_properties()) {
                 needs_style_recalculation = true;
@@ -546,12 +561,24 @@ void Node::invalidate_style(StyleInvalidationReason reason, Vector<CSS::Invalida
         });
     };
 
-    invalidate_entire_subtree(*this);
+    if (!invalidation_set.is_empty())
+        invalidate_entire_subtree(*this, invalidation_set);
 
-    if (invalidation_set.needs_invalidate_whole_subtree()) {
-        for (auto* sibling = next_sibling(); sibling; sibling = sibling->next_sibling()) {
-            if (sibling->is_element())
-                invalidate_entire_subtree(*sibling);
+    // Properties used to the left of a sibling combinator only affect the following siblings (or their descendants)
+    // that are within reach of the combinators.
+    size_t sibling_distance = 0;
+    for (auto* sibling = next_sibling(); sibling && sibling_distance < sibling_invalidation_set.max_distance; sibling = sibling->next_sibling()) {
+        auto* element = as_if<Element>(sibling);
+        if (!element)
+            continue;
+        ++sibling_distance;
+        if (sibling_invalidation_set.invalidation_set.needs_invalidate_whole_subtree()) {
+            element->set_entire_subtree_needs_style_update(true);
+            element->set_needs_style_update(true);
+        } else if (sibling_invalidation_set.invalidate_descendants_of_siblings) {
+            invalidate_entire_subtree(*element, sibling_invalidation_set.invalidation_set);
+        } else if (element->includes_properties_from_invalidation_set(sibling_invalidation_set.invalidation_set)) {
+            element->set_needs_style_update(true);
         }
     }
 
@@ -838,6 +865,7 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
     //       an ordinal value (default from constructor).
     // FIXME: This will not work if the child or the parent is not an element. Is insert_before even possible in this situation?
 
+    did_change_subtree(SubtreeChange::Structure);
     document().bump_dom_tree_version();
 }
 
@@ -1060,6 +1088,7 @@ void Node::remove(bool suppress_observers)
     // 17. Run the children changed steps for parent.
     parent->children_changed(nullptr);
 
+    parent->did_change_subtree(SubtreeChange::Structure);
     document().bump_dom_tree_version();
 }
 
@@ -1389,6 +1418,8 @@ WebIDL::ExceptionOr<void> Node::move_node(Node& new_parent, Node* child)
     // 26. Queue a tree mutation record for newParent with « node », « », newPreviousSibling, and child.
     new_parent.queue_tree_mutation_record({ *this }, {}, new_previous_sibling, child);
 
+    old_parent->did_change_subtree(SubtreeChange::Structure);
+    new_parent.did_change_subtree(SubtreeChange::Structure);
     document().bump_dom_tree_version();
 
     return {};
@@ -2502,13 +2533,18 @@ void Node::queue_mutation_record(FlyString const& type, Optional<FlyString> cons
     auto& document = this->document();
     auto& page = document.page();
 
-    // NOTE: We defer garbage collection until the end of the scope, since we can't safely use MutationObserver* as a hashmap key otherwise.
+    // NOTE: We defer garbage collection until the end of the scope, since we can't safely hold on to MutationObserver* in interested_observers otherwise.
     // FIXME: This is a total hack.
     GC::DeferGC defer_gc(heap());
 
     // 1. Let interestedObservers be an empty map.
-    // mutationObserver -> mappedOldValue
-    OrderedHashMap<MutationObserver*, Optional<String>> interested_observers;
+    // NOTE: There are rarely more than a handful of interested observers, so this map is a small vector of
+    //       mutationObserver -> mappedOldValue entries in insertion order, which doesn't allocate in the common case.
+    struct InterestedObserver {
+        MutationObserver* observer { nullptr };
+        Optional<String> mapped_old_value;
+    };
+    Vector<InterestedObserver, 4> interested_observers;
 
     // 2. Let nodes be the inclusive ancestors of target.
     // 3. For each node in nodes, and then for each registered of node’s registered observer list:
@@ -2535,12 +2571,21 @@ void Node::queue_mutation_record(FlyString const& type, Optional<FlyString> cons
                 auto mutation_observer = registered_observer->observer();
 
                 // 2. If interestedObservers[mo] does not exist, then set interestedObservers[mo] to null.
-                if (!interested_observers.contains(mutation_observer))
-                    interested_observers.set(mutation_observer, {});
+                InterestedObserver* interested_observer = nullptr;
+                for (auto& entry : interested_observers) {
+                    if (entry.observer == mutation_observer.ptr()) {
+                        interested_observer = &entry;
+                        break;
+                    }
+                }
+                if (!interested_observer) {
+                    interested_observers.append({ mutation_observer.ptr(), {} });
+                    interested_observer = &interested_observers.last();
+                }
 
                 // 3. If either type is "attributes" and options["attributeOldValue"] is true, or type is "characterData" and options["characterDataOldValue"] is true, then set interestedObservers[mo] to oldValue.
                 if ((type == MutationType::attributes && options.attribute_old_value.has_value() && options.attribute_old_value.value()) || (type == MutationType::characterData && options.character_data_old_value.has_value() && options.character_data_old_value.value()))
-                    interested_observers.set(mutation_observer, old_value);
+                    interested_observer->mapped_old_value = old_value;
             }
         }
     }
@@ -2564,10 +2609,10 @@ void Node::queue_mutation_record(FlyString const& type, Optional<FlyString> cons
     for (auto& interested_observer : interested_observers) {
         // 1. Let record be a new MutationRecord object with its type set to type, target set to target, attributeName set to name, attributeNamespace set to namespace, oldValue set to mappedOldValue,
         //    addedNodes set to addedNodes, removedNodes set to removedNodes, previousSibling set to previousSibling, and nextSibling set to nextSibling.
-        auto record = MutationRecord::create(realm(), type, *this, added_nodes_list, removed_nodes_list, previous_sibling, next_sibling, string_attribute_name, string_attribute_namespace, /* mappedOldValue */ interested_observer.value);
+        auto record = MutationRecord::create(realm(), type, *this, added_nodes_list, removed_nodes_list, previous_sibling, next_sibling, string_attribute_name, string_attribute_namespace, /* mappedOldValue */ interested_observer.mapped_old_value);
 
         // 2. Enqueue record to observer’s record queue.
-        interested_observer.key->enqueue_record({}, move(record));
+        interested_observer.observer->enqueue_record({}, move(record));
     }
 
     // 5. Queue a mutation observer microtask.
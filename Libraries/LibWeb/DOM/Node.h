@@ -89,8 +89,11 @@ enum class StyleInvalidationReason {
 #define __ENUMERATE_STYLE_INVALIDATION_REASON(reason) reason,
     ENUMERATE_STYLE_INVALIDATION_REASONS(__ENUMERATE_STYLE_INVALIDATION_REASON)
 #undef __ENUMERATE_STYLE_INVALIDATION_REASON
+    __Count,
 };
 
+[[nodiscard]] StringView to_string(StyleInvalidationReason);
+
 #define ENUMERATE_SET_NEEDS_LAYOUT_REASONS(X)         \
     X(CharacterDataReplaceData)                       \
     X(FinalizeACrossDocumentNavigation)               \
@@ -113,6 +116,7 @@ enum class SetNeedsLayoutReason {
 [[nodiscard]] StringView to_string(SetNeedsLayoutReason);
 
 #define ENUMERATE_SET_NEEDS_LAYOUT_TREE_UPDATE_REASONS(X) \
+    X(ContentVisibilityAutoStateChange)                   \
     X(ElementSetInnerHTML)                                \
     X(DetailsElementOpenedOrClosed)                       \
     X(HTMLInputElementSrcAttribute)                       \
@@ -125,7 +129,8 @@ enum class SetNeedsLayoutReason {
     X(NodeSetTextContent)                                 \
     X(None)                                               \
     X(SVGGraphicsElementTransformChange)                  \
-    X(StyleChange)
+    X(StyleChange)                                        \
+    X(TopLayerChange)
 
 enum class SetNeedsLayoutTreeUpdateReason {
 #define ENUMERATE_SET_NEEDS_LAYOUT_TREE_UPDATE_REASON(e) e,
@@ -327,6 +332,18 @@ public:
     virtual void adopted_from(Document&) { }
     virtual WebIDL::ExceptionOr<void> cloned(Node&, bool) const { return {}; }
 
+    // AD-HOC: These numbers increment whenever something in this node's inclusive subtree changes, so that caches of a
+    //         subtree (such as live HTMLCollections) aren't invalidated by mutations elsewhere in the document.
+    //         The structure version covers children being added or removed, and changes to the id, name or class
+    //         attributes; the subtree version additionally covers changes to any other attribute.
+    enum class SubtreeChange {
+        Structure,
+        Attribute,
+    };
+    void did_change_subtree(SubtreeChange);
+    u64 subtree_structure_version() const { return m_subtree_structure_version; }
+    u64 subtree_version() const { return m_subtree_version; }
+
     Layout::Node const* layout_node() const { return m_layout_node; }
     Layout::Node* layout_node() { return m_layout_node; }
 
@@ -480,6 +497,9 @@ protected:
     bool m_child_needs_style_update { false };
     bool m_entire_subtree_needs_style_update { false };
 
+    u64 m_subtree_structure_version { 0 };
+    u64 m_subtree_version { 0 };
+
     UniqueNodeID m_unique_id;
 
     // https://dom.spec.whatwg.org/#registered-observer-list
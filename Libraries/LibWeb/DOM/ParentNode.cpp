@@ -9,6 +9,7 @@
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/NodeOperations.h>
 #include <LibWeb/DOM/ParentNode.h>
@@ -47,12 +48,37 @@ enum class ReturnMatches {
     First,
     All,
 };
+
+// If every element matched by the selector must carry one specific ID, returns that ID.
+static Optional<FlyString> id_required_by_subject_of(CSS::Selector const& selector)
+{
+    if (selector.compound_selectors().is_empty())
+        return {};
+    for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
+        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Id)
+            return simple_selector.name();
+    }
+    return {};
+}
+
+// Looks up an element-by-ID map that is guaranteed to contain every element of node's subtree that has an ID, or null.
+static ElementByIdMap const* element_by_id_map_covering(ParentNode const& node)
+{
+    if (!node.is_connected())
+        return nullptr;
+    auto const& root = node.root();
+    if (root.is_document())
+        return &static_cast<Document const&>(root).element_by_id();
+    if (root.is_shadow_root())
+        return &static_cast<ShadowRoot const&>(root).element_by_id();
+    return nullptr;
+}
 // https://dom.spec.whatwg.org/#scope-match-a-selectors-string
 static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_match_a_selectors_string(ParentNode& node, StringView selector_text, ReturnMatches return_matches)
 {
     // To scope-match a selectors string selectors against a node, run these steps:
     // 1. Let s be the result of parse a selector selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams { node.document() }, selector_text);
+    auto maybe_selectors = node.document().parse_selector_for_query(selector_text);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -67,6 +93,34 @@ static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_m
     // 3. Return the result of match a selector against a tree with s and node’s root using scoping root node.
     GC::Ptr<Element> single_result;
     Vector<GC::Root<Node>> results;
+
+    // OPTIMIZATION: When the subject of a lone selector requires an ID, only the elements carrying that ID can match.
+    //               The ID map keeps those in tree order, so we can test them instead of walking the whole subtree.
+    //               In quirks mode IDs match case-insensitively, which the map can't answer.
+    if (selectors.size() == 1 && !node.document().in_quirks_mode()) {
+        auto required_id = id_required_by_subject_of(selectors.first());
+        auto const* element_by_id_map = required_id.has_value() ? element_by_id_map_covering(node) : nullptr;
+        if (element_by_id_map) {
+            element_by_id_map->for_each_element_with_id(*required_id, [&](Element& element) {
+                if (!node.is_ancestor_of(element))
+                    return IterationDecision::Continue;
+                SelectorEngine::MatchContext context;
+                if (!SelectorEngine::matches(selectors.first(), element, nullptr, context, {}, node))
+                    return IterationDecision::Continue;
+                if (return_matches == ReturnMatches::First) {
+                    single_result = &element;
+                    return IterationDecision::Break;
+                }
+                results.append(element);
+                return IterationDecision::Continue;
+            });
+
+            if (return_matches == ReturnMatches::First)
+                return { single_result };
+            return { StaticNodeList::create(node.realm(), move(results)) };
+        }
+    }
+
     // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
     node.for_each_in_subtree_of_type<Element>([&](auto& element) {
         for (auto& selector : selectors) {
@@ -138,7 +192,7 @@ GC::Ref<HTMLCollection> ParentNode::children()
     if (!m_children) {
         m_children = HTMLCollection::create(*this, HTMLCollection::Scope::Children, [](Element const&) {
             return true;
-        });
+        }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
     }
     return *m_children;
 }
@@ -151,7 +205,7 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name(FlyString const& qu
     if (qualified_name == "*") {
         return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const&) {
             return true;
-        });
+        }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
     }
 
     // 2. Otherwise, if root’s node document is an HTML document, return a HTMLCollection rooted at root, whose filter matches the following descendant elements:
@@ -164,13 +218,13 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name(FlyString const& qu
 
             // - Whose namespace is not the HTML namespace and whose qualified name is qualifiedName.
             return element.qualified_name() == qualified_name;
-        });
+        }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
     }
 
     // 3. Otherwise, return a HTMLCollection rooted at root, whose filter matches descendant elements whose qualified name is qualifiedName.
     return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [qualified_name](Element const& element) {
         return element.qualified_name() == qualified_name;
-    });
+    }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
 }
 
 // https://dom.spec.whatwg.org/#concept-getelementsbytagnamens
@@ -185,27 +239,27 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name_ns(Optional<FlyStri
     if (namespace_ == "*" && local_name == "*") {
         return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const&) {
             return true;
-        });
+        }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
     }
 
     // 3. Otherwise, if namespace is "*" (U+002A), return a HTMLCollection rooted at root, whose filter matches descendant elements whose local name is localName.
     if (namespace_ == "*") {
         return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [local_name](Element const& element) {
             return element.local_name() == local_name;
-        });
+        }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
     }
 
     // 4. Otherwise, if localName is "*" (U+002A), return a HTMLCollection rooted at root, whose filter matches descendant elements whose namespace is namespace.
     if (local_name == "*") {
         return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [namespace_](Element const& element) {
             return element.namespace_uri() == namespace_;
-        });
+        }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
     }
 
     // 5. Otherwise, return a HTMLCollection rooted at root, whose filter matches descendant elements whose namespace is namespace and local name is localName.
     return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [namespace_, local_name](Element const& element) {
         return element.namespace_uri() == namespace_ && element.local_name() == local_name;
-    });
+    }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
 }
 
 // https://dom.spec.whatwg.org/#dom-parentnode-prepend
@@ -273,7 +327,7 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_class_name(StringView class_
                 return false;
         }
         return !list_of_class_names.is_empty();
-    });
+    }, HTMLCollection::FilterInputs::StructureAndIdentifyingAttributes);
 }
 
 GC::Ptr<Element> ParentNode::get_element_by_id(FlyString const& id) const
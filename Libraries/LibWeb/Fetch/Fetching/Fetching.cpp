@@ -77,6 +77,51 @@ bool g_http_cache_enabled;
         _temporary_result.release_value();                                                           \
     })
 
+// NOTE: Everything needed to lay out and render the page comes first, then whatever script and fetches might need, and
+//       then images and media, which the page can be shown without.
+static RequestServer::RequestPriority determine_request_priority(Infrastructure::Request const& request)
+{
+    using enum RequestServer::RequestPriority;
+    using Destination = Infrastructure::Request::Destination;
+
+    auto priority = [&] {
+        if (!request.destination().has_value())
+            return High;
+
+        switch (*request.destination()) {
+        case Destination::Document:
+        case Destination::Frame:
+        case Destination::IFrame:
+        case Destination::Style:
+        case Destination::Font:
+            return Highest;
+        case Destination::Script:
+        case Destination::JSON:
+            return request.render_blocking() ? High : Medium;
+        case Destination::Image:
+        case Destination::Audio:
+        case Destination::Video:
+        case Destination::Track:
+            return Low;
+        case Destination::Report:
+            return Lowest;
+        default:
+            return Medium;
+        }
+    }();
+
+    if (request.render_blocking() && priority < High)
+        priority = High;
+
+    // The fetchpriority attribute and the priority member of RequestInit nudge the default by one step either way.
+    if (request.priority() == Infrastructure::Request::Priority::High && priority != Highest)
+        priority = static_cast<RequestServer::RequestPriority>(to_underlying(priority) + 1);
+    else if (request.priority() == Infrastructure::Request::Priority::Low && priority != Lowest)
+        priority = static_cast<RequestServer::RequestPriority>(to_underlying(priority) - 1);
+
+    return priority;
+}
+
 // https://fetch.spec.whatwg.org/#concept-fetch
 WebIDL::ExceptionOr<GC::Ref<Infrastructure::FetchController>> fetch(JS::Realm& realm, Infrastructure::Request& request, Infrastructure::FetchAlgorithms const& algorithms, UseParallelQueue use_parallel_queue)
 {
@@ -253,6 +298,8 @@ WebIDL::ExceptionOr<GC::Ref<Infrastructure::FetchController>> fetch(JS::Realm& r
     //     in setting request’s priority to a user-agent-defined object.
     // NOTE: The user-agent-defined object could encompass stream weight and dependency for HTTP/2, and equivalent
     //       information used to prioritize dispatch and processing of HTTP/1 fetches.
+    if (!request.internal_priority().has_value())
+        request.set_internal_priority(Infrastructure::Request::InternalPriority { determine_request_priority(request) });
 
     // 16. If request is a subresource request, then:
     if (request.is_subresource_request()) {
@@ -1930,7 +1977,7 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> http_network_or_cache_fetch(JS::Re
                     auto document = Bindings::principal_host_defined_environment_settings_object(HTML::principal_realm(realm)).responsible_document();
                     if (!document)
                         return String {};
-                    return document->page().client().page_did_request_cookie(http_request->current_url(), Cookie::Source::Http);
+                    return document->page().client().page_did_request_cookie(http_request->current_url(), Cookie::Source::Http).value;
                 })();
 
                 // 2. If cookies is not the empty string, then append (`Cookie`, cookies) to httpRequest’s header list.
@@ -2299,6 +2346,17 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
     load_request.set_page(page);
     load_request.set_method(ByteString::copy(request->method()));
 
+    if (auto partition_key = Infrastructure::determine_the_network_partition_key(*request); partition_key.has_value() && !partition_key->top_level_origin.is_opaque())
+        load_request.set_cache_partition_key(partition_key->top_level_origin.serialize().to_byte_string());
+
+    if (request->internal_priority().has_value())
+        load_request.set_priority(request->internal_priority()->priority);
+
+    // NOTE: Navigations are where handshake latency is most visible. GET is a safe method, so a bodyless GET navigation
+    //       may be sent as TLS early data, which an attacker could replay.
+    if (request->is_navigation_request() && request->method() == "GET"sv.bytes() && request->body().has<Empty>())
+        load_request.set_allow_tls_early_data(true);
+
     for (auto const& header : *request->header_list())
         load_request.set_header(ByteString::copy(header.name), ByteString::copy(header.value));
 
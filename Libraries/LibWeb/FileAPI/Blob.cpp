@@ -132,19 +132,34 @@ Blob::Blob(JS::Realm& realm)
 
 Blob::Blob(JS::Realm& realm, ByteBuffer byte_buffer, String type)
     : PlatformObject(realm)
-    , m_byte_buffer(move(byte_buffer))
     , m_type(move(type))
 {
+    set_bytes(move(byte_buffer));
 }
 
 Blob::Blob(JS::Realm& realm, ByteBuffer byte_buffer)
     : PlatformObject(realm)
-    , m_byte_buffer(move(byte_buffer))
 {
+    set_bytes(move(byte_buffer));
+}
+
+Blob::Blob(JS::Realm& realm, NonnullRefPtr<BlobData const> data, ReadonlyBytes bytes, String type)
+    : PlatformObject(realm)
+    , m_type(move(type))
+    , m_data(move(data))
+    , m_bytes(bytes)
+{
+    VERIFY(m_bytes.is_empty() || (m_bytes.data() >= m_data->bytes().data() && m_bytes.end() <= m_data->bytes().end()));
 }
 
 Blob::~Blob() = default;
 
+void Blob::set_bytes(ByteBuffer bytes)
+{
+    m_data = BlobData::create(move(bytes));
+    m_bytes = m_data->bytes();
+}
+
 void Blob::initialize(JS::Realm& realm)
 {
     WEB_SET_PROTOTYPE_FOR_INTERFACE(Blob);
@@ -162,7 +177,7 @@ WebIDL::ExceptionOr<void> Blob::serialization_steps(HTML::SerializationRecord& r
     TRY(HTML::serialize_string(vm, record, m_type));
 
     // 2. Set serialized.[[ByteSequence]] to value’s underlying byte sequence.
-    TRY(HTML::serialize_bytes(vm, record, m_byte_buffer.bytes()));
+    TRY(HTML::serialize_bytes(vm, record, m_bytes));
 
     return {};
 }
@@ -178,7 +193,7 @@ WebIDL::ExceptionOr<void> Blob::deserialization_steps(ReadonlySpan<u32> const& r
     m_type = TRY(HTML::deserialize_string(vm, record, position));
 
     // 2. Set value’s underlying byte sequence to serialized.[[ByteSequence]].
-    m_byte_buffer = TRY(HTML::deserialize_bytes(vm, record, position));
+    set_bytes(TRY(HTML::deserialize_bytes(vm, record, position)));
 
     return {};
 }
@@ -192,7 +207,13 @@ GC::Ref<Blob> Blob::create(JS::Realm& realm, Optional<Vector<BlobPart>> const& b
 
     ByteBuffer byte_buffer {};
     // 2. Let bytes be the result of processing blob parts given blobParts and options.
-    if (blob_parts.has_value()) {
+    // OPTIMIZATION: A blob that is made up of a single other blob has the same bytes as that blob, so we share them.
+    Blob const* blob_with_same_bytes = nullptr;
+    if (blob_parts.has_value() && blob_parts->size() == 1) {
+        if (auto const* blob = blob_parts->first().get_pointer<GC::Root<Blob>>(); blob && (*blob)->m_data)
+            blob_with_same_bytes = blob->ptr();
+    }
+    if (blob_parts.has_value() && !blob_with_same_bytes) {
         byte_buffer = MUST(process_blob_parts(blob_parts.value(), options));
     }
 
@@ -213,6 +234,8 @@ GC::Ref<Blob> Blob::create(JS::Realm& realm, Optional<Vector<BlobPart>> const& b
     }
 
     // 4. Return a Blob object referring to bytes as its associated byte sequence, with its size set to the length of bytes, and its type set to the value of t from the substeps above.
+    if (blob_with_same_bytes)
+        return realm.create<Blob>(realm, *blob_with_same_bytes->m_data, blob_with_same_bytes->m_bytes, move(type));
     return realm.create<Blob>(realm, move(byte_buffer), move(type));
 }
 
@@ -235,8 +258,6 @@ WebIDL::ExceptionOr<GC::Ref<Blob>> Blob::slice(Optional<i64> start, Optional<i64
 // https://w3c.github.io/FileAPI/#slice-blob
 WebIDL::ExceptionOr<GC::Ref<Blob>> Blob::slice_blob(Optional<i64> start, Optional<i64> end, Optional<String> const& content_type)
 {
-    auto& vm = realm().vm();
-
     // 1. Let originalSize be blob’s size.
     auto original_size = size();
 
@@ -304,8 +325,10 @@ WebIDL::ExceptionOr<GC::Ref<Blob>> Blob::slice_blob(Optional<i64> start, Optiona
     // a. S refers to span consecutive bytes from blob’s associated byte sequence, beginning with the byte at byte-order position relativeStart.
     // b. S.size = span.
     // c. S.type = relativeContentType.
-    auto byte_buffer = TRY_OR_THROW_OOM(vm, m_byte_buffer.slice(relative_start, span));
-    return realm().create<Blob>(realm(), move(byte_buffer), move(relative_content_type));
+    // OPTIMIZATION: The slice refers to the bytes of this blob rather than to a copy of them.
+    if (!m_data)
+        return realm().create<Blob>(realm(), ByteBuffer {}, move(relative_content_type));
+    return realm().create<Blob>(realm(), *m_data, m_bytes.slice(relative_start, span), move(relative_content_type));
 }
 
 // https://w3c.github.io/FileAPI/#dom-blob-stream
@@ -332,16 +355,19 @@ GC::Ref<Streams::ReadableStream> Blob::get_stream()
         //    NOTE: for simplicity the chunk is the entire buffer for now.
         {
             // 1. Let bytes be the byte sequence that results from reading a chunk from blob, or failure if a chunk cannot be read.
-            auto bytes = m_byte_buffer;
+            // NOTE: We hold on to the data of the blob rather than copying its bytes here, as they are copied into the
+            //       ArrayBuffer anyway.
+            auto data = m_data;
+            auto bytes = m_bytes;
 
             // 2. Queue a global task on the file reading task source given blob’s relevant global object to perform the following steps:
-            HTML::queue_global_task(HTML::Task::Source::FileReading, realm.global_object(), GC::create_function(heap(), [stream, bytes = move(bytes)]() {
+            HTML::queue_global_task(HTML::Task::Source::FileReading, realm.global_object(), GC::create_function(heap(), [stream, data = move(data), bytes]() {
                 auto& realm = stream->realm();
                 HTML::TemporaryExecutionContext const execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
                 // 1. If bytes is failure, then error stream with a failure reason and abort these steps.
                 // 2. Let chunk be a new Uint8Array wrapping an ArrayBuffer containing bytes. If creating the ArrayBuffer throws an exception, then error stream with that exception and abort these steps.
-                auto array_buffer = JS::ArrayBuffer::create(realm, bytes);
+                auto array_buffer = JS::ArrayBuffer::create(realm, MUST(ByteBuffer::copy(bytes)));
                 auto chunk = JS::Uint8Array::create(realm, bytes.size(), *array_buffer);
 
                 // 3. Enqueue chunk in stream.
@@ -99,7 +99,7 @@ WebIDL::ExceptionOr<void> File::serialization_steps(HTML::SerializationRecord& r
     TRY(HTML::serialize_string(vm, record, m_type));
 
     // 2. Set serialized.[[ByteSequence]] to value’s underlying byte sequence.
-    TRY(HTML::serialize_bytes(vm, record, m_byte_buffer.bytes()));
+    TRY(HTML::serialize_bytes(vm, record, raw_bytes()));
 
     // 3. Set serialized.[[Name]] to the value of value’s name attribute.
     TRY(HTML::serialize_string(vm, record, m_name));
@@ -121,7 +121,7 @@ WebIDL::ExceptionOr<void> File::deserialization_steps(ReadonlySpan<u32> const& r
     m_type = TRY(HTML::deserialize_string(vm, record, position));
 
     // 2. Set value’s underlying byte sequence to serialized.[[ByteSequence]].
-    m_byte_buffer = TRY(HTML::deserialize_bytes(vm, record, position));
+    set_bytes(TRY(HTML::deserialize_bytes(vm, record, position)));
 
     // 3. Initialize the value of value’s name attribute to serialized.[[Name]].
     m_name = TRY(HTML::deserialize_string(vm, record, position));
@@ -274,6 +274,7 @@ class MediaList;
 class MediaQuery;
 class MediaQueryList;
 class MediaQueryListEvent;
+class NthIndexCache;
 class Number;
 class NumberOrCalculated;
 class NumberStyleValue;
@@ -660,6 +661,7 @@ class TrackEvent;
 class TraversableNavigable;
 class UserActivation;
 class ValidityState;
+class VideoPlaybackQuality;
 class VideoTrack;
 class VideoTrackList;
 class Window;
@@ -869,8 +871,11 @@ class AutoplayAllowlist;
 namespace Web::Platform {
 
 class AudioCodecPlugin;
+class IncrementalImageDecoder;
 class Timer;
 
+enum class ImageDecodePriority : u8;
+
 }
 
 namespace Web::ReferrerPolicy {
@@ -897,6 +902,14 @@ class PerformanceResourceTiming;
 
 }
 
+namespace Web::Scheduling {
+
+class Scheduler;
+
+struct SchedulerPostTaskOptions;
+
+}
+
 namespace Web::Selection {
 
 class Selection;
@@ -905,6 +918,8 @@ class Selection;
 
 namespace Web::ServiceWorker {
 
+class Cache;
+class CacheStorage;
 class ServiceWorker;
 class ServiceWorkerContainer;
 class ServiceWorkerRegistration;
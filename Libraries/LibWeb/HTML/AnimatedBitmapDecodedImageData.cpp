@@ -4,9 +4,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/MemoryReporting.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
 #include <LibJS/Runtime/Realm.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
 
 namespace Web::HTML {
@@ -18,42 +20,298 @@ ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> AnimatedBitmapDecodedImageData:
     return realm.create<AnimatedBitmapDecodedImageData>(move(frames), loop_count, animated);
 }
 
+ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> AnimatedBitmapDecodedImageData::create_with_frame_source(JS::Realm& realm, Vector<Frame>&& initial_frames, size_t frame_count, size_t loop_count, NonnullRefPtr<Platform::AnimationFrameSource> frame_source, Gfx::ColorSpace color_space)
+{
+    VERIFY(!initial_frames.is_empty());
+    VERIFY(initial_frames.size() <= frame_count);
+
+    TRY(initial_frames.try_resize(frame_count));
+    auto data = realm.create<AnimatedBitmapDecodedImageData>(move(initial_frames), loop_count, true);
+    data->m_frame_source = move(frame_source);
+    data->m_color_space = move(color_space);
+    return data;
+}
+
 AnimatedBitmapDecodedImageData::AnimatedBitmapDecodedImageData(Vector<Frame>&& frames, size_t loop_count, bool animated)
     : m_frames(move(frames))
     , m_loop_count(loop_count)
     , m_animated(animated)
+    , m_intrinsic_size(m_frames.first().bitmap->size())
 {
 }
 
 AnimatedBitmapDecodedImageData::~AnimatedBitmapDecodedImageData() = default;
 
+void AnimatedBitmapDecodedImageData::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_document);
+}
+
+// How much memory the decoded frames of evictable images in this process may take up before the least recently
+// visible ones that aren't near any viewport are dropped.
+static constexpr size_t decoded_image_memory_budget = 256 * MiB;
+
+static size_t s_resident_decoded_image_bytes = 0;
+static size_t s_evictable_image_count = 0;
+static size_t s_evictable_image_encoded_bytes = 0;
+
+// Evictable images whose frames are resident but that aren't near the viewport of any element, least recently
+// visible first.
+static AnimatedBitmapDecodedImageData::EvictableList s_evictable_images;
+
+void AnimatedBitmapDecodedImageData::finalize()
+{
+    Base::finalize();
+
+    if (m_document) {
+        if (!m_is_evicted)
+            s_resident_decoded_image_bytes -= decoded_size_in_bytes();
+        --s_evictable_image_count;
+        s_evictable_image_encoded_bytes -= m_encoded_data.size();
+    }
+    m_evictable_list_node.remove();
+
+    // NOTE: Elements that are swept along with us may still tell us that they've left the viewport.
+    m_document = nullptr;
+}
+
+size_t AnimatedBitmapDecodedImageData::decoded_size_in_bytes() const
+{
+    size_t size = 0;
+    for (auto const& frame : m_frames) {
+        if (frame.bitmap)
+            size += static_cast<size_t>(frame.bitmap->width()) * frame.bitmap->height() * sizeof(Gfx::ARGB32);
+    }
+    return size;
+}
+
+void AnimatedBitmapDecodedImageData::make_evictable(ByteBuffer encoded_data, DOM::Document& document)
+{
+    // NOTE: Animations that are decoded on demand already keep only a few of their frames in memory.
+    VERIFY(!m_frame_source);
+    VERIFY(!m_document);
+
+    m_encoded_data = move(encoded_data);
+    m_document = document;
+    s_resident_decoded_image_bytes += decoded_size_in_bytes();
+    ++s_evictable_image_count;
+    s_evictable_image_encoded_bytes += m_encoded_data.size();
+
+    // NOTE: Until any element reports this image as being near its viewport, it is just as evictable as an image that
+    //       was scrolled away from.
+    s_evictable_images.append(*this);
+    evict_images_over_budget();
+}
+
+void AnimatedBitmapDecodedImageData::did_enter_viewport()
+{
+    ++m_viewport_client_count;
+    if (!m_document || m_viewport_client_count != 1)
+        return;
+
+    m_evictable_list_node.remove();
+    if (m_is_evicted)
+        redecode();
+}
+
+void AnimatedBitmapDecodedImageData::did_leave_viewport()
+{
+    VERIFY(m_viewport_client_count > 0);
+    --m_viewport_client_count;
+    if (!m_document || m_viewport_client_count != 0 || m_is_evicted)
+        return;
+
+    s_evictable_images.append(*this);
+    evict_images_over_budget();
+}
+
+void AnimatedBitmapDecodedImageData::evict_images_over_budget()
+{
+    while (s_resident_decoded_image_bytes > decoded_image_memory_budget && !s_evictable_images.is_empty())
+        s_evictable_images.take_first()->evict();
+}
+
+void AnimatedBitmapDecodedImageData::evict_all_evictable_images()
+{
+    while (!s_evictable_images.is_empty())
+        s_evictable_images.take_first()->evict();
+}
+
+void AnimatedBitmapDecodedImageData::report_memory_usage(Core::MemoryReports& reports)
+{
+    reports.add("images/decoded-frames"_string, s_resident_decoded_image_bytes);
+    reports.add("images/encoded-data"_string, s_evictable_image_encoded_bytes, s_evictable_image_count);
+}
+
+void AnimatedBitmapDecodedImageData::evict()
+{
+    VERIFY(!m_is_evicted);
+    s_resident_decoded_image_bytes -= decoded_size_in_bytes();
+    for (auto& frame : m_frames)
+        frame.bitmap = nullptr;
+    m_is_evicted = true;
+
+    // NOTE: The display list holds on to the bitmaps it was recorded with, so it has to be recorded again for their
+    //       memory to actually be released.
+    m_document->set_needs_display();
+}
+
+void AnimatedBitmapDecodedImageData::redecode()
+{
+    if (m_has_pending_redecode)
+        return;
+    m_has_pending_redecode = true;
+
+    auto on_success = [strong_this = GC::Root(*this)](Platform::DecodedImage& result) -> ErrorOr<void> {
+        strong_this->did_redecode(result);
+        return {};
+    };
+    auto on_failure = [strong_this = GC::Root(*this)](Error& error) {
+        dbgln("Failed to decode evicted image again: {}", error);
+        strong_this->m_has_pending_redecode = false;
+    };
+    (void)Platform::ImageCodecPlugin::the().decode_image(m_encoded_data.bytes(), move(on_success), move(on_failure), Platform::ImageDecodePriority::Visible);
+}
+
+void AnimatedBitmapDecodedImageData::did_redecode(Platform::DecodedImage& result)
+{
+    m_has_pending_redecode = false;
+
+    auto& frames = result.frames;
+    if (!m_is_evicted || frames.size() != m_frames.size())
+        return;
+
+    for (size_t i = 0; i < frames.size(); ++i)
+        m_frames[i].bitmap = Gfx::ImmutableBitmap::create(*frames[i].bitmap, Gfx::AlphaType::Premultiplied, result.color_space);
+    m_is_evicted = false;
+    s_resident_decoded_image_bytes += decoded_size_in_bytes();
+
+    if (m_viewport_client_count == 0) {
+        s_evictable_images.append(*this);
+        evict_images_over_budget();
+    }
+
+    m_document->set_needs_display();
+}
+
+// How many frames past the one being shown are kept decoded for animations that are decoded on demand.
+static constexpr size_t frames_kept_ahead = 8;
+
+// Once fewer than this many frames past the one being shown are decoded, the next batch is requested.
+static constexpr size_t minimum_frames_decoded_ahead = 4;
+
+// Used for frames that have not been decoded in time, as their real duration isn't known yet.
+static constexpr int fallback_frame_duration = 100;
+
 RefPtr<Gfx::ImmutableBitmap> AnimatedBitmapDecodedImageData::bitmap(size_t frame_index, Gfx::IntSize) const
 {
     if (frame_index >= m_frames.size())
         return nullptr;
-    return m_frames[frame_index].bitmap;
+    if (!m_frame_source)
+        return m_frames[frame_index].bitmap;
+
+    did_show_frame(frame_index);
+
+    // If a frame was not decoded in time, keep showing the last one that was.
+    for (size_t i = 0; i < m_frames.size(); ++i) {
+        auto index = (frame_index + m_frames.size() - i) % m_frames.size();
+        if (m_frames[index].bitmap)
+            return m_frames[index].bitmap;
+    }
+    return nullptr;
 }
 
 int AnimatedBitmapDecodedImageData::frame_duration(size_t frame_index) const
 {
     if (frame_index >= m_frames.size())
         return 0;
+    if (!m_frame_source)
+        return m_frames[frame_index].duration;
+
+    did_show_frame(frame_index);
+
+    if (!m_frames[frame_index].bitmap)
+        return fallback_frame_duration;
     return m_frames[frame_index].duration;
 }
 
+bool AnimatedBitmapDecodedImageData::should_keep_frame(size_t frame_index) const
+{
+    // NOTE: The first frame is always kept, as it determines our intrinsic size and is shown whenever the animation
+    //       isn't running.
+    if (frame_index == 0)
+        return true;
+    auto distance_ahead = (frame_index + m_frames.size() - m_current_frame_index) % m_frames.size();
+    return distance_ahead <= frames_kept_ahead;
+}
+
+void AnimatedBitmapDecodedImageData::did_show_frame(size_t frame_index) const
+{
+    if (frame_index != m_current_frame_index) {
+        m_current_frame_index = frame_index;
+        for (size_t i = 0; i < m_frames.size(); ++i) {
+            if (m_frames[i].bitmap && !should_keep_frame(i))
+                m_frames[i].bitmap = nullptr;
+        }
+    }
+
+    request_frames_ahead_of(frame_index);
+}
+
+void AnimatedBitmapDecodedImageData::request_frames_ahead_of(size_t frame_index) const
+{
+    if (m_has_pending_frame_request)
+        return;
+
+    for (size_t i = 0; i <= frames_kept_ahead; ++i) {
+        auto index = (frame_index + i) % m_frames.size();
+        if (m_frames[index].bitmap)
+            continue;
+        if (i > minimum_frames_decoded_ahead && index != frame_index)
+            return;
+
+        m_has_pending_frame_request = true;
+        m_frame_source->request_frames(index, frames_kept_ahead, [this](size_t first_frame_index, Vector<Platform::Frame> frames) {
+            const_cast<AnimatedBitmapDecodedImageData&>(*this).did_decode_frames(first_frame_index, move(frames));
+        });
+        return;
+    }
+}
+
+void AnimatedBitmapDecodedImageData::did_decode_frames(size_t first_frame_index, Vector<Platform::Frame> frames)
+{
+    m_has_pending_frame_request = false;
+
+    for (size_t i = 0; i < frames.size(); ++i) {
+        auto frame_index = first_frame_index + i;
+        if (frame_index >= m_frames.size())
+            break;
+        if (!frames[i].bitmap || !should_keep_frame(frame_index))
+            continue;
+
+        m_frames[frame_index] = {
+            .bitmap = Gfx::ImmutableBitmap::create(*frames[i].bitmap, Gfx::AlphaType::Premultiplied, m_color_space),
+            .duration = static_cast<int>(frames[i].duration),
+        };
+    }
+
+    request_frames_ahead_of(m_current_frame_index);
+}
+
 Optional<CSSPixels> AnimatedBitmapDecodedImageData::intrinsic_width() const
 {
-    return m_frames.first().bitmap->width();
+    return m_intrinsic_size.width();
 }
 
 Optional<CSSPixels> AnimatedBitmapDecodedImageData::intrinsic_height() const
 {
-    return m_frames.first().bitmap->height();
+    return m_intrinsic_size.height();
 }
 
 Optional<CSSPixelFraction> AnimatedBitmapDecodedImageData::intrinsic_aspect_ratio() const
 {
-    return CSSPixels(m_frames.first().bitmap->width()) / CSSPixels(m_frames.first().bitmap->height());
+    return CSSPixels(m_intrinsic_size.width()) / CSSPixels(m_intrinsic_size.height());
 }
 
 }
@@ -6,8 +6,13 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
+#include <AK/IntrusiveList.h>
+#include <LibCore/Forward.h>
 #include <LibGfx/ImmutableBitmap.h>
+#include <LibWeb/Forward.h>
 #include <LibWeb/HTML/DecodedImageData.h>
+#include <LibWeb/Platform/ImageCodecPlugin.h>
 
 namespace Web::HTML {
 
@@ -22,8 +27,26 @@ public:
     };
 
     static ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> create(JS::Realm&, Vector<Frame>&&, size_t loop_count, bool animated);
+
+    // Creates an animation of which only the first frames have been decoded. The rest are requested from the frame
+    // source shortly before they are shown, and only a few frames around the current one are kept in memory.
+    static ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> create_with_frame_source(JS::Realm&, Vector<Frame>&& initial_frames, size_t frame_count, size_t loop_count, NonnullRefPtr<Platform::AnimationFrameSource>, Gfx::ColorSpace);
+
     virtual ~AnimatedBitmapDecodedImageData() override;
 
+    // Lets the decoded frames be dropped while the image isn't near the viewport of any element, whenever the decoded
+    // images of this process exceed their memory budget. They are decoded again from the given encoded data once the
+    // image comes back near the viewport, after which the document is repainted.
+    void make_evictable(ByteBuffer encoded_data, DOM::Document&);
+
+    // Drops the decoded frames of every evictable image that isn't near any viewport, no matter how much memory the
+    // decoded images of this process take up.
+    static void evict_all_evictable_images();
+
+    // Reports the memory taken up by the resident frames of evictable images, and by the encoded data they keep around
+    // to decode those frames again.
+    static void report_memory_usage(Core::MemoryReports&);
+
     virtual RefPtr<Gfx::ImmutableBitmap> bitmap(size_t frame_index, Gfx::IntSize = {}) const override;
     virtual int frame_duration(size_t frame_index) const override;
 
@@ -35,12 +58,50 @@ public:
     virtual Optional<CSSPixels> intrinsic_height() const override;
     virtual Optional<CSSPixelFraction> intrinsic_aspect_ratio() const override;
 
+    virtual void did_enter_viewport() override;
+    virtual void did_leave_viewport() override;
+
 private:
     AnimatedBitmapDecodedImageData(Vector<Frame>&&, size_t loop_count, bool animated);
 
-    Vector<Frame> m_frames;
+    virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
+
+    size_t decoded_size_in_bytes() const;
+    void evict();
+    void redecode();
+    void did_redecode(Platform::DecodedImage&);
+    static void evict_images_over_budget();
+
+    void did_show_frame(size_t frame_index) const;
+    void request_frames_ahead_of(size_t frame_index) const;
+    void did_decode_frames(size_t first_frame_index, Vector<Platform::Frame>);
+    bool should_keep_frame(size_t frame_index) const;
+
+    // NOTE: For animations that are decoded on demand, frames that have not been decoded yet or that have been dropped
+    //       again have a null bitmap. Which frames are resident changes as the animation is painted.
+    mutable Vector<Frame> m_frames;
     size_t m_loop_count { 0 };
     bool m_animated { false };
+
+    RefPtr<Platform::AnimationFrameSource> m_frame_source;
+    Gfx::ColorSpace m_color_space;
+    mutable size_t m_current_frame_index { 0 };
+    mutable bool m_has_pending_frame_request { false };
+
+    Gfx::IntSize m_intrinsic_size;
+
+    // NOTE: Only images that have been made evictable are counted against the decoded image memory budget.
+    ByteBuffer m_encoded_data;
+    GC::Ptr<DOM::Document> m_document;
+    size_t m_viewport_client_count { 0 };
+    bool m_is_evicted { false };
+    bool m_has_pending_redecode { false };
+
+    IntrusiveListNode<AnimatedBitmapDecodedImageData> m_evictable_list_node;
+
+public:
+    using EvictableList = IntrusiveList<&AnimatedBitmapDecodedImageData::m_evictable_list_node>;
 };
 
 }
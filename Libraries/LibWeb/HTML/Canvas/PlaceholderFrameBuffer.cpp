@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/ImmutableBitmap.h>
+#include <LibWeb/HTML/Canvas/PlaceholderFrameBuffer.h>
+
+namespace Web::HTML {
+
+// NOTE: Frame N is always stored in slot N % 2, so a single atomic is all both sides need to agree on.
+struct PlaceholderFrameBuffer::Header {
+    Atomic<u64> frame_number { 0 };
+};
+static_assert(sizeof(Atomic<u64>) == sizeof(u64));
+
+static constexpr Gfx::BitmapFormat frame_format = Gfx::BitmapFormat::RGBA8888;
+static constexpr Gfx::AlphaType frame_alpha_type = Gfx::AlphaType::Premultiplied;
+static constexpr size_t header_size = 64;
+
+size_t PlaceholderFrameBuffer::buffer_size_for(Gfx::IntSize size)
+{
+    return header_size + 2 * static_cast<size_t>(size.width()) * size.height() * sizeof(u32);
+}
+
+ErrorOr<NonnullRefPtr<PlaceholderFrameBuffer>> PlaceholderFrameBuffer::create(Gfx::IntSize size)
+{
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(buffer_size_for(size)));
+    new (buffer.data<u8>()) Header;
+    return adopt_ref(*new PlaceholderFrameBuffer(move(buffer), size));
+}
+
+ErrorOr<NonnullRefPtr<PlaceholderFrameBuffer>> PlaceholderFrameBuffer::create_from_anonymous_buffer(Core::AnonymousBuffer buffer, Gfx::IntSize size)
+{
+    if (!buffer.is_valid() || buffer.size() < buffer_size_for(size))
+        return Error::from_string_literal("Placeholder frame buffer is too small");
+    return adopt_ref(*new PlaceholderFrameBuffer(move(buffer), size));
+}
+
+PlaceholderFrameBuffer::PlaceholderFrameBuffer(Core::AnonymousBuffer buffer, Gfx::IntSize size)
+    : m_buffer(move(buffer))
+    , m_size(size)
+    , m_last_taken_frame_number(header().frame_number.load(AK::MemoryOrder::memory_order_acquire))
+{
+}
+
+PlaceholderFrameBuffer::Header& PlaceholderFrameBuffer::header()
+{
+    return *reinterpret_cast<Header*>(m_buffer.data<u8>());
+}
+
+size_t PlaceholderFrameBuffer::frame_size_in_bytes() const
+{
+    return static_cast<size_t>(m_size.width()) * m_size.height() * sizeof(u32);
+}
+
+u8* PlaceholderFrameBuffer::frame_slot(u32 index)
+{
+    return m_buffer.data<u8>() + header_size + index * frame_size_in_bytes();
+}
+
+void PlaceholderFrameBuffer::commit(Gfx::Bitmap const& bitmap)
+{
+    if (bitmap.size() != m_size || bitmap.format() != frame_format || bitmap.alpha_type() != frame_alpha_type)
+        return;
+
+    auto& header = this->header();
+    auto next_frame_number = header.frame_number.load(AK::MemoryOrder::memory_order_relaxed) + 1;
+    auto* slot = frame_slot(next_frame_number % 2);
+
+    auto row_size = static_cast<size_t>(m_size.width()) * sizeof(u32);
+    for (int y = 0; y < m_size.height(); ++y)
+        memcpy(slot + y * row_size, bitmap.scanline_u8(y), row_size);
+
+    header.frame_number.store(next_frame_number, AK::MemoryOrder::memory_order_release);
+}
+
+RefPtr<Gfx::ImmutableBitmap> PlaceholderFrameBuffer::take_new_frame()
+{
+    if (m_size.is_empty())
+        return nullptr;
+
+    auto& header = this->header();
+
+    // The committing side starts overwriting the slot we are copying from as soon as it publishes the frame after it.
+    // If that happens mid-copy we try again with the newer frame, and eventually give up until the next rendering
+    // update rather than stalling it on a producer that keeps committing frames faster than we can copy them.
+    static constexpr int maximum_attempts = 3;
+    for (int attempt = 0; attempt < maximum_attempts; ++attempt) {
+        auto frame_number = header.frame_number.load(AK::MemoryOrder::memory_order_acquire);
+        if (frame_number == m_last_taken_frame_number)
+            return nullptr;
+
+        auto bitmap_or_error = Gfx::Bitmap::create(frame_format, frame_alpha_type, m_size);
+        if (bitmap_or_error.is_error())
+            return nullptr;
+        auto bitmap = bitmap_or_error.release_value();
+
+        auto const* slot = frame_slot(frame_number % 2);
+        auto row_size = static_cast<size_t>(m_size.width()) * sizeof(u32);
+        for (int y = 0; y < m_size.height(); ++y)
+            memcpy(bitmap->scanline_u8(y), slot + y * row_size, row_size);
+
+        if (header.frame_number.load(AK::MemoryOrder::memory_order_acquire) != frame_number)
+            continue;
+
+        m_last_taken_frame_number = frame_number;
+        return Gfx::ImmutableBitmap::create(move(bitmap));
+    }
+    return nullptr;
+}
+
+}
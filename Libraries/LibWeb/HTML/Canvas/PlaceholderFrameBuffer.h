@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/RefCounted.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibGfx/Forward.h>
+#include <LibGfx/Size.h>
+
+namespace Web::HTML {
+
+// The frames an OffscreenCanvas commits to its placeholder canvas element. They live in shared memory, so that an
+// OffscreenCanvas which was transferred to a worker (and therefore possibly to another process) can present frames
+// without having to go through the event loop of the placeholder's document.
+//
+// There are two frame slots: the committing side always writes into the one that isn't being presented, and then
+// publishes it by bumping the frame number.
+class PlaceholderFrameBuffer final : public RefCounted<PlaceholderFrameBuffer> {
+public:
+    static ErrorOr<NonnullRefPtr<PlaceholderFrameBuffer>> create(Gfx::IntSize);
+    static ErrorOr<NonnullRefPtr<PlaceholderFrameBuffer>> create_from_anonymous_buffer(Core::AnonymousBuffer, Gfx::IntSize);
+
+    static size_t buffer_size_for(Gfx::IntSize);
+
+    Core::AnonymousBuffer const& anonymous_buffer() const { return m_buffer; }
+    Gfx::IntSize size() const { return m_size; }
+
+    // Called by the OffscreenCanvas. Frames of a different size than the placeholder are dropped.
+    void commit(Gfx::Bitmap const&);
+
+    // Called by the placeholder canvas element. Returns null if no frame was committed since the last call.
+    RefPtr<Gfx::ImmutableBitmap> take_new_frame();
+
+private:
+    PlaceholderFrameBuffer(Core::AnonymousBuffer, Gfx::IntSize);
+
+    struct Header;
+    Header& header();
+    u8* frame_slot(u32 index);
+    size_t frame_size_in_bytes() const;
+
+    Core::AnonymousBuffer m_buffer;
+    Gfx::IntSize m_size;
+    u64 m_last_taken_frame_number { 0 };
+};
+
+}
@@ -24,27 +24,37 @@ WebIDL::ExceptionOr<GC::Ref<CanvasGradient>> CanvasGradient::create_radial(JS::R
     if (r1 < 0)
         return WebIDL::IndexSizeError::create(realm, "The r1 passed is less than 0"_string);
 
-    auto radial_gradient = TRY_OR_THROW_OOM(realm.vm(), Gfx::CanvasRadialGradientPaintStyle::create(Gfx::FloatPoint { x0, y0 }, r0, Gfx::FloatPoint { x1, y1 }, r1));
-    return realm.create<CanvasGradient>(realm, *radial_gradient);
+    auto create_gradient = [=] -> ErrorOr<NonnullRefPtr<Gfx::GradientPaintStyle>> {
+        return TRY(Gfx::CanvasRadialGradientPaintStyle::create(Gfx::FloatPoint { x0, y0 }, r0, Gfx::FloatPoint { x1, y1 }, r1));
+    };
+    auto radial_gradient = TRY_OR_THROW_OOM(realm.vm(), create_gradient());
+    return realm.create<CanvasGradient>(realm, *radial_gradient, move(create_gradient));
 }
 
 // https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-createlineargradient
 WebIDL::ExceptionOr<GC::Ref<CanvasGradient>> CanvasGradient::create_linear(JS::Realm& realm, double x0, double y0, double x1, double y1)
 {
-    auto linear_gradient = TRY_OR_THROW_OOM(realm.vm(), Gfx::CanvasLinearGradientPaintStyle::create(Gfx::FloatPoint { x0, y0 }, Gfx::FloatPoint { x1, y1 }));
-    return realm.create<CanvasGradient>(realm, *linear_gradient);
+    auto create_gradient = [=] -> ErrorOr<NonnullRefPtr<Gfx::GradientPaintStyle>> {
+        return TRY(Gfx::CanvasLinearGradientPaintStyle::create(Gfx::FloatPoint { x0, y0 }, Gfx::FloatPoint { x1, y1 }));
+    };
+    auto linear_gradient = TRY_OR_THROW_OOM(realm.vm(), create_gradient());
+    return realm.create<CanvasGradient>(realm, *linear_gradient, move(create_gradient));
 }
 
 // https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-createconicgradient
 WebIDL::ExceptionOr<GC::Ref<CanvasGradient>> CanvasGradient::create_conic(JS::Realm& realm, double start_angle, double x, double y)
 {
-    auto conic_gradient = TRY_OR_THROW_OOM(realm.vm(), Gfx::CanvasConicGradientPaintStyle::create(Gfx::FloatPoint { x, y }, start_angle));
-    return realm.create<CanvasGradient>(realm, *conic_gradient);
+    auto create_gradient = [=] -> ErrorOr<NonnullRefPtr<Gfx::GradientPaintStyle>> {
+        return TRY(Gfx::CanvasConicGradientPaintStyle::create(Gfx::FloatPoint { x, y }, start_angle));
+    };
+    auto conic_gradient = TRY_OR_THROW_OOM(realm.vm(), create_gradient());
+    return realm.create<CanvasGradient>(realm, *conic_gradient, move(create_gradient));
 }
 
-CanvasGradient::CanvasGradient(JS::Realm& realm, Gfx::GradientPaintStyle& gradient)
+CanvasGradient::CanvasGradient(JS::Realm& realm, Gfx::GradientPaintStyle& gradient, CreateGradient create_gradient)
     : PlatformObject(realm)
     , m_gradient(gradient)
+    , m_create_gradient(move(create_gradient))
 {
 }
 
@@ -70,6 +80,14 @@ WebIDL::ExceptionOr<void> CanvasGradient::add_color_stop(double offset, StringVi
     if (!parsed_color.has_value())
         return WebIDL::SyntaxError::create(realm(), "Could not parse color for CanvasGradient"_string);
 
+    if (m_gradient->ref_count() > 1) {
+        auto gradient = TRY_OR_THROW_OOM(realm().vm(), m_create_gradient());
+        Vector<Gfx::ColorStop> color_stops;
+        TRY_OR_THROW_OOM(realm().vm(), color_stops.try_append(m_gradient->color_stops().data(), m_gradient->color_stops().size()));
+        gradient->set_color_stops(move(color_stops));
+        m_gradient = move(gradient);
+    }
+
     // 4. Place a new stop on the gradient, at offset offset relative to the whole gradient, and with the color parsed color.
     TRY_OR_THROW_OOM(realm().vm(), m_gradient->add_color_stop(offset, parsed_color.value()));
 
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/Function.h>
 #include <LibGfx/PaintStyle.h>
 #include <LibWeb/Bindings/PlatformObject.h>
 
@@ -28,11 +29,17 @@ public:
     NonnullRefPtr<Gfx::PaintStyle> to_gfx_paint_style() { return m_gradient; }
 
 private:
-    CanvasGradient(JS::Realm&, Gfx::GradientPaintStyle& gradient);
+    using CreateGradient = Function<ErrorOr<NonnullRefPtr<Gfx::GradientPaintStyle>>()>;
+
+    CanvasGradient(JS::Realm&, Gfx::GradientPaintStyle& gradient, CreateGradient);
 
     virtual void initialize(JS::Realm&) override;
 
     NonnullRefPtr<Gfx::GradientPaintStyle> m_gradient;
+
+    // NOTE: Canvas contexts hold on to the gradient until their deferred drawing is flushed. Adding a color stop must
+    //       not change how that drawing turns out, so a gradient that is still referenced is replaced with a new one.
+    CreateGradient m_create_gradient;
 };
 
 }
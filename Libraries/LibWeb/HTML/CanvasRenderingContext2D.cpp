@@ -196,6 +196,9 @@ WebIDL::ExceptionOr<void> CanvasRenderingContext2D::draw_image_internal(CanvasIm
 
 void CanvasRenderingContext2D::did_draw(Gfx::FloatRect const&)
 {
+    if (m_painter && m_painter->has_pending_commands())
+        canvas_element().document().register_canvas_with_deferred_drawing({}, *this);
+
     // FIXME: Make use of the rect to reduce the invalidated area when possible.
     if (!canvas_element().paintable())
         return;
@@ -205,20 +208,34 @@ void CanvasRenderingContext2D::did_draw(Gfx::FloatRect const&)
 Gfx::Painter* CanvasRenderingContext2D::painter()
 {
     allocate_painting_surface_if_needed();
-    auto surface = canvas_element().surface();
-    if (!m_painter && surface) {
+    if (!m_painter && m_surface) {
         canvas_element().document().invalidate_display_list();
-        m_painter = make<Gfx::PainterSkia>(*canvas_element().surface());
+        m_painter = make<Gfx::DeferredPainter>(make<Gfx::PainterSkia>(*m_surface));
     }
     return m_painter.ptr();
 }
 
+RefPtr<Gfx::PaintingSurface> CanvasRenderingContext2D::surface()
+{
+    flush_deferred_drawing();
+    return m_surface;
+}
+
+void CanvasRenderingContext2D::flush_deferred_drawing()
+{
+    if (m_painter)
+        m_painter->flush();
+}
+
 void CanvasRenderingContext2D::set_size(Gfx::IntSize const& size)
 {
     if (m_size == size)
         return;
     m_size = size;
     m_surface = nullptr;
+
+    // NOTE: The painter draws into the old surface, so commands that are still pending would never show up anyway.
+    m_painter = nullptr;
 }
 
 void CanvasRenderingContext2D::allocate_painting_surface_if_needed()
@@ -229,11 +246,14 @@ void CanvasRenderingContext2D::allocate_painting_surface_if_needed()
     // FIXME: implement context attribute .color_space
     // FIXME: implement context attribute .color_type
     // FIXME: implement context attribute .desynchronized
-    // FIXME: implement context attribute .will_read_frequently
 
     auto color_type = m_context_attributes.alpha ? Gfx::BitmapFormat::BGRA8888 : Gfx::BitmapFormat::BGRx8888;
 
-    auto skia_backend_context = canvas_element().navigable()->traversable_navigable()->skia_backend_context();
+    // https://html.spec.whatwg.org/multipage/canvas.html#concept-canvas-will-read-frequently
+    // When a canvas is read back often, keeping it in system memory is much cheaper than a GPU readback on every call.
+    RefPtr<Gfx::SkiaBackendContext> skia_backend_context;
+    if (!m_context_attributes.will_read_frequently)
+        skia_backend_context = canvas_element().navigable()->traversable_navigable()->skia_backend_context();
     m_surface = Gfx::PaintingSurface::create_with_size(skia_backend_context, canvas_element().bitmap_size_for_canvas(), color_type, Gfx::AlphaType::Premultiplied);
 
     // https://html.spec.whatwg.org/multipage/canvas.html#the-canvas-settings:concept-canvas-alpha
@@ -245,6 +265,27 @@ void CanvasRenderingContext2D::allocate_painting_surface_if_needed()
     }
 }
 
+CanvasRenderingContext2D::ShapedText const& CanvasRenderingContext2D::shaped_text(StringView text)
+{
+    auto font_cascade_list = this->font_cascade_list();
+    if (font_cascade_list != m_shaped_text_cache_font_cascade_list) {
+        m_shaped_text_cache.clear();
+        m_shaped_text_cache_font_cascade_list = font_cascade_list;
+    }
+
+    if (auto it = m_shaped_text_cache.find(text); it != m_shaped_text_cache.end())
+        return it->value;
+
+    if (m_shaped_text_cache.size() >= maximum_shaped_text_cache_size)
+        m_shaped_text_cache.clear();
+
+    ShapedText shaped_text;
+    for (auto const& glyph_run : Gfx::shape_text({ 0, 0 }, Utf8View(text), *font_cascade_list))
+        shaped_text.path.glyph_run(glyph_run);
+    shaped_text.width = shaped_text.path.bounding_box().width();
+    return m_shaped_text_cache.ensure(String::from_utf8_without_validation(text.bytes()), [&] { return move(shaped_text); });
+}
+
 Gfx::Path CanvasRenderingContext2D::text_path(StringView text, float x, float y, Optional<double> max_width)
 {
     if (max_width.has_value() && max_width.value() <= 0)
@@ -254,13 +295,9 @@ Gfx::Path CanvasRenderingContext2D::text_path(StringView text, float x, float y,
 
     auto const& font_cascade_list = this->font_cascade_list();
     auto const& font = font_cascade_list->first();
-    auto glyph_runs = Gfx::shape_text({ x, y }, Utf8View(text), *font_cascade_list);
-    Gfx::Path path;
-    for (auto const& glyph_run : glyph_runs) {
-        path.glyph_run(glyph_run);
-    }
+    auto const& shaped_text = this->shaped_text(text);
 
-    auto text_width = path.bounding_box().width();
+    auto text_width = shaped_text.width;
     Gfx::AffineTransform transform = {};
 
     // https://html.spec.whatwg.org/multipage/canvas.html#text-preparation-algorithm:
@@ -297,7 +334,9 @@ Gfx::Path CanvasRenderingContext2D::text_path(StringView text, float x, float y,
         transform = Gfx::AffineTransform {}.set_translation({ 0, font.pixel_size() }).multiply(transform);
     }
 
-    return path.copy_transformed(transform);
+    // NOTE: The cached outline starts at the origin, so it has to be moved to (x, y) before the adjustments above.
+    transform.multiply(Gfx::AffineTransform {}.set_translation({ x, y }));
+    return shaped_text.path.copy_transformed(transform);
 }
 
 void CanvasRenderingContext2D::fill_text(StringView text, float x, float y, Optional<double> max_width)
@@ -472,9 +511,9 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     auto image_data = TRY(ImageData::create(realm(), abs_width, abs_height, settings));
 
     // NOTE: We don't attempt to create the underlying bitmap here; if it doesn't exist, it's like copying only transparent black pixels (which is a no-op).
-    if (!canvas_element().surface())
+    auto surface = canvas_element().surface();
+    if (!surface)
         return image_data;
-    auto const snapshot = Gfx::ImmutableBitmap::create_snapshot_from_painting_surface(*canvas_element().surface());
 
     // 5. Let the source rectangle be the rectangle whose corners are the four points (sx, sy), (sx+sw, sy), (sx+sw, sy+sh), (sx, sy+sh).
     auto source_rect = Gfx::Rect { x, y, abs_width, abs_height };
@@ -485,17 +524,15 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     if (width < 0 || height < 0) {
         source_rect = source_rect.translated(min(width, 0), min(height, 0));
     }
-    auto source_rect_intersected = source_rect.intersected(snapshot->rect());
 
     // 6. Set the pixel values of imageData to be the pixels of this's output bitmap in the area specified by the source rectangle in the bitmap's coordinate space units, converted from this's color space to imageData's colorSpace using 'relative-colorimetric' rendering intent.
     // NOTE: Internally we must use premultiplied alpha, but ImageData should hold unpremultiplied alpha. This conversion
     //       might result in a loss of precision, but is according to spec.
     //       See: https://html.spec.whatwg.org/multipage/canvas.html#premultiplied-alpha-and-the-2d-rendering-context
-    VERIFY(snapshot->alpha_type() == Gfx::AlphaType::Premultiplied);
+    // OPTIMIZATION: The ImageData's bitmap wraps its Uint8ClampedArray, so we read the pixels straight into the array and
+    //               let Skia do the unpremultiplying and swizzling in a single vectorized pass.
     VERIFY(image_data->bitmap().alpha_type() == Gfx::AlphaType::Unpremultiplied);
-
-    auto painter = Gfx::Painter::create(image_data->bitmap());
-    painter->draw_bitmap(image_data->bitmap().rect().to_type<float>(), *snapshot, source_rect_intersected, Gfx::ScalingMode::NearestNeighbor, {}, 1, Gfx::CompositingAndBlendingOperator::SourceOver);
+    surface->read_into_bitmap(image_data->bitmap(), source_rect.location());
 
     // 7. Set the pixels values of imageData for areas of the source rectangle that are outside of the output bitmap to transparent black.
     // NOTE: No-op, already done during creation.
@@ -511,18 +548,18 @@ void CanvasRenderingContext2D::put_image_data(ImageData& image_data, float x, fl
     // given imageData, this's output bitmap, dx, dy, 0, 0, imageData's width, and imageData's height.
     // FIXME: "put pixels from an ImageData onto a bitmap" is a spec algorithm.
     //        https://html.spec.whatwg.org/multipage/canvas.html#dom-context2d-putimagedata-common
-    if (auto* painter = this->painter()) {
-        auto dst_rect = Gfx::FloatRect(x, y, image_data.width(), image_data.height());
-        painter->draw_bitmap(
-            dst_rect,
-            Gfx::ImmutableBitmap::create(image_data.bitmap(), Gfx::AlphaType::Unpremultiplied),
-            image_data.bitmap().rect(),
-            Gfx::ScalingMode::NearestNeighbor,
-            drawing_state().filter,
-            1.0f,
-            Gfx::CompositingAndBlendingOperator::SourceOver);
-        did_draw(dst_rect);
-    }
+    if (!painter())
+        return;
+
+    // NOTE: Pending drawing has to land before the pixels are replaced.
+    flush_deferred_drawing();
+
+    // NOTE: The current transformation matrix, clipping region, compositing and shadows don't affect putImageData(),
+    //       which just replaces the pixels in the destination rectangle. So rather than painting the ImageData, we write
+    //       its pixels directly, converting them from unpremultiplied RGBA in the process.
+    auto destination = Gfx::IntPoint { static_cast<int>(x), static_cast<int>(y) };
+    m_surface->write_from_bitmap(image_data.bitmap(), destination);
+    did_draw(Gfx::FloatRect(x, y, image_data.width(), image_data.height()));
 }
 
 // https://html.spec.whatwg.org/multipage/canvas.html#reset-the-rendering-context-to-its-default-state
@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/String.h>
+#include <LibGfx/DeferredPainter.h>
 #include <LibGfx/Forward.h>
 #include <LibGfx/Painter.h>
 #include <LibGfx/Path.h>
@@ -125,9 +127,13 @@ public:
 
     void set_size(Gfx::IntSize const&);
 
-    RefPtr<Gfx::PaintingSurface> surface() { return m_surface; }
+    // NOTE: Drawing commands are recorded and replayed onto the surface in batches. Anything that reads from the
+    //       surface has to go through here, so that it sees all drawing done so far.
+    RefPtr<Gfx::PaintingSurface> surface();
     void allocate_painting_surface_if_needed();
 
+    void flush_deferred_drawing();
+
 private:
     CanvasRenderingContext2D(JS::Realm&, HTMLCanvasElement&, CanvasRenderingContext2DSettings);
 
@@ -152,6 +158,13 @@ private:
     [[nodiscard]] Gfx::Path rect_path(float x, float y, float width, float height);
     [[nodiscard]] Gfx::Path text_path(StringView text, float x, float y, Optional<double> max_width);
 
+    // The outline of a string shaped with the current font, with its baseline starting at the origin.
+    struct ShapedText {
+        Gfx::Path path;
+        float width { 0 };
+    };
+    ShapedText const& shaped_text(StringView text);
+
     Gfx::Color clear_color() const;
 
     void stroke_internal(Gfx::Path const&);
@@ -161,7 +174,7 @@ private:
     void paint_shadow_for_stroke_internal(Gfx::Path const&);
 
     GC::Ref<HTMLCanvasElement> m_element;
-    OwnPtr<Gfx::Painter> m_painter;
+    OwnPtr<Gfx::DeferredPainter> m_painter;
 
     // https://html.spec.whatwg.org/multipage/canvas.html#concept-canvas-origin-clean
     bool m_origin_clean { true };
@@ -169,6 +182,13 @@ private:
     Gfx::IntSize m_size;
     RefPtr<Gfx::PaintingSurface> m_surface;
     CanvasRenderingContext2DSettings m_context_attributes;
+
+    // OPTIMIZATION: Canvas-based grids and spreadsheets draw the same short strings over and over, so we keep the shaped
+    //               outlines of recently drawn strings around. The cache only holds strings shaped with a single font,
+    //               and is dropped whenever text is drawn with a different one.
+    static constexpr size_t maximum_shaped_text_cache_size = 256;
+    RefPtr<Gfx::FontCascadeList const> m_shaped_text_cache_font_cascade_list;
+    HashMap<String, ShapedText> m_shaped_text_cache;
 };
 
 enum class CanvasImageSourceUsability {
@@ -31,6 +31,11 @@ public:
     virtual Optional<CSSPixels> intrinsic_height() const = 0;
     virtual Optional<CSSPixelFraction> intrinsic_aspect_ratio() const = 0;
 
+    // Called by image elements as they come near to and leave the viewport. Image data that isn't near the viewport
+    // of any element may drop its decoded bitmaps to stay within the process' decoded image memory budget.
+    virtual void did_enter_viewport() { }
+    virtual void did_leave_viewport() { }
+
 protected:
     DecodedImageData();
 };
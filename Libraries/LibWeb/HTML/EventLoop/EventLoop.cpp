@@ -6,6 +6,7 @@
  */
 
 #include <LibCore/EventLoop.h>
+#include <LibGC/PostponeGC.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/CSS/FontFaceSet.h>
@@ -14,6 +15,7 @@
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/EventLoop/FrameTimings.h>
 #include <LibWeb/HTML/Scripting/Agent.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
@@ -32,11 +34,13 @@ namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(EventLoop);
 
+// Idle periods shorter than this are not worth interrupting with a garbage collection that may run past their deadline.
+static constexpr double minimum_idle_time_for_garbage_collection_in_ms = 10;
+
 EventLoop::EventLoop(Type type)
     : m_type(type)
 {
     m_task_queue = heap().allocate<TaskQueue>(*this);
-    m_microtask_queue = heap().allocate<TaskQueue>(*this);
 
     m_rendering_task_function = GC::create_function(heap(), [this] {
         update_the_rendering();
@@ -49,7 +53,8 @@ void EventLoop::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_task_queue);
-    visitor.visit(m_microtask_queue);
+    for (size_t i = m_first_microtask_index; i < m_microtask_queue.size(); ++i)
+        visitor.visit(m_microtask_queue[i]);
     visitor.visit(m_currently_running_task);
     visitor.visit(m_backup_incumbent_realm_stack);
     visitor.visit(m_rendering_task_function);
@@ -171,6 +176,8 @@ void EventLoop::process()
         task_start_time = HighResolutionTime::unsafe_shared_current_time();
 
         // 3. Set oldestTask to the first runnable task in taskQueue, and remove it from taskQueue.
+        // NOTE: Our task queue stands in for one task queue per priority, so this takes the first runnable task of the
+        //       highest priority that has one, unless a lower priority has been waiting for too long.
         oldest_task = task_queue->take_first_runnable();
 
         // FIXME: 4. If oldestTask's document is not null, then record task start time given taskStartTime and oldestTask's document.
@@ -216,10 +223,16 @@ void EventLoop::process()
         for (auto& win : same_loop_windows()) {
             win->start_an_idle_period();
         }
+
+        // Non-standard: Use the idle period to collect garbage if a collection is coming up anyway and there's time for
+        //               it before the next frame, and to give memory emptied by garbage collection back to the OS.
+        if (compute_deadline() - m_last_idle_period_start_time >= minimum_idle_time_for_garbage_collection_in_ms)
+            heap().collect_garbage_if_due_soon();
+        heap().release_empty_blocks();
     }
 
     // If there are eligible tasks in the queue, schedule a new round of processing. :^)
-    if (m_task_queue->has_runnable_tasks() || (!m_microtask_queue->is_empty() && !m_performing_a_microtask_checkpoint)) {
+    if (m_task_queue->has_runnable_tasks() || (has_pending_microtasks() && !m_performing_a_microtask_checkpoint)) {
         schedule();
     }
 }
@@ -278,7 +291,7 @@ void EventLoop::process_input_events() const
                     case MouseEvent::Type::MouseUp:
                         return page.handle_mouseup(mouse_event.position, mouse_event.screen_position, mouse_event.button, mouse_event.buttons, mouse_event.modifiers);
                     case MouseEvent::Type::MouseMove:
-                        return page.handle_mousemove(mouse_event.position, mouse_event.screen_position, mouse_event.buttons, mouse_event.modifiers);
+                        return page.handle_mousemove(mouse_event.position, mouse_event.screen_position, mouse_event.buttons, mouse_event.modifiers, event.coalesced_mouse_moves);
                     case MouseEvent::Type::MouseWheel:
                         return page.handle_mousewheel(mouse_event.position, mouse_event.screen_position, mouse_event.button, mouse_event.buttons, mouse_event.modifiers, mouse_event.wheel_delta_x, mouse_event.wheel_delta_y);
                     case MouseEvent::Type::DoubleClick:
@@ -320,6 +333,12 @@ void EventLoop::update_the_rendering()
         m_running_rendering_task = false;
     };
 
+    // Not in the spec: Avoid interrupting input handling and rendering with garbage collection where we can.
+    GC::PostponeGC const postpone_gc { heap() };
+
+    auto frame = FrameTimings::the().begin_frame();
+    FrameTimings::Scope const frame_timing_scope { FrameTimings::Stage::UpdateTheRendering, frame };
+
     process_input_events();
 
     // 1. Let frameTimestamp be eventLoop's last render opportunity time.
@@ -353,6 +372,14 @@ void EventLoop::update_the_rendering()
         return true;
     });
 
+    // OPTIMIZATION: When the input events we just processed did nothing but scroll, present that right away with the
+    //               display list we already have. Otherwise scrolling would have to wait for animation frame
+    //               callbacks and style and layout updates, which can take a while on busy pages.
+    for (auto& document : docs) {
+        if (auto navigable = document->navigable(); navigable->is_traversable())
+            navigable->paint_next_frame_if_only_scrolled();
+    }
+
     // FIXME: 4. Unnecessary rendering: Remove from docs any Document object doc for which all of the following are true:
 
     // FIXME: 5. Remove from docs all Document objects for which the user agent believes that it's preferable to skip updating the rendering for other reasons.
@@ -386,12 +413,15 @@ void EventLoop::update_the_rendering()
     // FIXME: 13. For each doc of docs, if the user agent detects that the backing storage associated with a CanvasRenderingContext2D or an OffscreenCanvasRenderingContext2D, context, has been lost, then it must run the context lost steps for each such context:
 
     // 14. For each doc of docs, run the animation frame callbacks for doc, passing in the relative high resolution time given frameTimestamp and doc's relevant global object as the timestamp.
+    auto animation_frame_callbacks_start_time = MonotonicTime::now();
     for (auto& document : docs) {
         auto now = HighResolutionTime::relative_high_resolution_time(frame_timestamp, relevant_global_object(*document));
         run_animation_frame_callbacks(*document, now);
     }
+    FrameTimings::the().record(FrameTimings::Stage::AnimationFrameCallbacks, frame, animation_frame_callbacks_start_time, MonotonicTime::now());
 
     // FIXME: 15. Let unsafeStyleAndLayoutStartTime be the unsafe shared current time.
+    auto style_and_layout_start_time = MonotonicTime::now();
 
     // 16. For each doc of docs:
     for (auto& document : docs) {
@@ -452,6 +482,8 @@ void EventLoop::update_the_rendering()
         }
     }
 
+    FrameTimings::the().record(FrameTimings::Stage::StyleAndLayout, frame, style_and_layout_start_time, MonotonicTime::now());
+
     // FIXME: 17. For each doc of docs, if the focused area of doc is not a focusable area, then run the focusing steps for doc's viewport, and set doc's relevant global object's navigation API's focus changed during ongoing navigation to false.
 
     // FIXME: 18. For each doc of docs, perform pending transition operations for doc. [CSSVIEWTRANSITIONS]
@@ -467,6 +499,13 @@ void EventLoop::update_the_rendering()
     // FIXME: 21. For each doc of docs, mark paint timing for doc.
 
     // 22. For each doc of docs, update the rendering or user interface of doc and its node navigable to reflect the current state.
+    // NOTE: Canvas drawing is recorded and only replayed onto the canvas once per frame, so it has to land before painting.
+    //       Placeholder canvases pick up whatever frame their OffscreenCanvas committed last, possibly from another thread.
+    for (auto& document : docs) {
+        document->flush_deferred_canvas_drawing();
+        document->update_placeholder_canvases();
+    }
+
     for (auto& document : docs) {
         auto navigable = document->navigable();
         if (!navigable->is_traversable())
@@ -508,12 +547,13 @@ TaskID queue_a_task(HTML::Task::Source source, GC::Ptr<EventLoop> event_loop, GC
     auto task = HTML::Task::create(event_loop->vm(), source, document, steps);
 
     // 8. Let queue be the task queue to which source is associated on event loop.
-    auto& queue = source == HTML::Task::Source::Microtask ? event_loop->microtask_queue() : event_loop->task_queue();
-
     // 9. Append task to queue.
-    queue.add(task);
+    if (source == HTML::Task::Source::Microtask)
+        event_loop->enqueue_microtask(steps);
+    else
+        event_loop->task_queue().add(task);
 
-    return queue.last_added_task()->id();
+    return task->id();
 }
 
 // https://html.spec.whatwg.org/multipage/webappapis.html#queue-a-global-task
@@ -534,7 +574,7 @@ TaskID queue_global_task(HTML::Task::Source source, JS::Object& global_object, G
 }
 
 // https://html.spec.whatwg.org/multipage/webappapis.html#queue-a-microtask
-void queue_a_microtask(DOM::Document const* document, GC::Ref<GC::Function<void()>> steps)
+void queue_a_microtask([[maybe_unused]] DOM::Document const* document, GC::Ref<GC::Function<void()>> steps)
 {
     // 1. If event loop was not given, set event loop to the implied event loop.
     auto& event_loop = HTML::main_thread_event_loop();
@@ -545,13 +585,17 @@ void queue_a_microtask(DOM::Document const* document, GC::Ref<GC::Function<void(
     // 4. Set microtask's steps to steps.
     // 5. Set microtask's source to the microtask task source.
     // 6. Set microtask's document to document.
-    auto& vm = event_loop.vm();
-    auto microtask = HTML::Task::create(vm, HTML::Task::Source::Microtask, document, steps);
-
-    // FIXME: 7. Set microtask's script evaluation environment settings object set to an empty set.
+    // 7. Set microtask's script evaluation environment settings object set to an empty set.
+    // NOTE: Microtasks run regardless of their document, so their steps are all we need to keep.
 
     // 8. Enqueue microtask on event loop's microtask queue.
-    event_loop.microtask_queue().enqueue(microtask);
+    event_loop.enqueue_microtask(steps);
+}
+
+void EventLoop::enqueue_microtask(GC::Ref<GC::Function<void()>> steps)
+{
+    m_microtask_queue.append(steps);
+    schedule();
 }
 
 void perform_a_microtask_checkpoint()
@@ -577,19 +621,19 @@ void EventLoop::perform_a_microtask_checkpoint()
     m_performing_a_microtask_checkpoint = true;
 
     // 3. While the event loop's microtask queue is not empty:
-    while (!m_microtask_queue->is_empty()) {
+    while (has_pending_microtasks()) {
         // 1. Let oldestMicrotask be the result of dequeuing from the event loop's microtask queue.
-        auto oldest_microtask = m_microtask_queue->dequeue();
+        auto oldest_microtask = m_microtask_queue[m_first_microtask_index++];
 
-        // 2. Set the event loop's currently running task to oldestMicrotask.
-        m_currently_running_task = oldest_microtask;
+        // FIXME: 2. Set the event loop's currently running task to oldestMicrotask.
 
         // 3. Run oldestMicrotask.
-        oldest_microtask->execute();
+        oldest_microtask->function()();
 
-        // 4. Set the event loop's currently running task back to null.
-        m_currently_running_task = nullptr;
+        // FIXME: 4. Set the event loop's currently running task back to null.
     }
+    m_microtask_queue.clear_with_capacity();
+    m_first_microtask_index = 0;
 
     // 4. For each environment settings object settingsObject whose responsible event loop is this event loop, notify about rejected promises given settingsObject's global object.
     auto environments = GC::RootVector { heap(), m_related_environment_settings_objects };
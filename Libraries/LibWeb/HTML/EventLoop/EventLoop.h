@@ -50,8 +50,10 @@ public:
     TaskQueue& task_queue() { return *m_task_queue; }
     TaskQueue const& task_queue() const { return *m_task_queue; }
 
-    TaskQueue& microtask_queue() { return *m_microtask_queue; }
-    TaskQueue const& microtask_queue() const { return *m_microtask_queue; }
+    // NOTE: Microtasks are never removed from their queue and are always runnable, so instead of a task, we only keep
+    //       their steps around.
+    void enqueue_microtask(GC::Ref<GC::Function<void()>> steps);
+    bool has_pending_microtasks() const { return m_first_microtask_index < m_microtask_queue.size(); }
 
     void spin_until(GC::Ref<GC::Function<bool()>> goal_condition);
     void spin_processing_tasks_with_source_until(Task::Source, GC::Ref<GC::Function<bool()>> goal_condition);
@@ -103,7 +105,12 @@ private:
     Type m_type { Type::Window };
 
     GC::Ptr<TaskQueue> m_task_queue;
-    GC::Ptr<TaskQueue> m_microtask_queue;
+
+    // https://html.spec.whatwg.org/multipage/webappapis.html#microtask-queue
+    // NOTE: Dequeuing only advances m_first_microtask_index. The queue is emptied once it has been drained, keeping its
+    //       capacity, so that queueing microtasks doesn't allocate in the steady state.
+    Vector<GC::Ref<GC::Function<void()>>> m_microtask_queue;
+    size_t m_first_microtask_index { 0 };
 
     // https://html.spec.whatwg.org/multipage/webappapis.html#currently-running-task
     GC::Ptr<Task> m_currently_running_task { nullptr };
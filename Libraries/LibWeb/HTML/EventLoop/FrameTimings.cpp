@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <LibWeb/HTML/EventLoop/FrameTimings.h>
+
+namespace Web::HTML {
+
+FrameTimings& FrameTimings::the()
+{
+    static FrameTimings s_the;
+    return s_the;
+}
+
+void FrameTimings::record(Stage stage, u64 frame, MonotonicTime start, MonotonicTime end)
+{
+    Threading::MutexLocker const locker { m_spans_mutex };
+    m_spans.enqueue(Span { stage, frame, start, end });
+}
+
+StringView stage_name(FrameTimings::Stage stage)
+{
+    switch (stage) {
+    case FrameTimings::Stage::UpdateTheRendering:
+        return "Update the rendering"sv;
+    case FrameTimings::Stage::AnimationFrameCallbacks:
+        return "Animation frame callbacks"sv;
+    case FrameTimings::Stage::StyleAndLayout:
+        return "Style and layout"sv;
+    case FrameTimings::Stage::PaintRecording:
+        return "Paint recording"sv;
+    case FrameTimings::Stage::Replay:
+        return "Display list replay"sv;
+    case FrameTimings::Stage::Present:
+        return "Present"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+String FrameTimings::to_chrome_trace_json() const
+{
+    JsonArray events;
+    {
+        Threading::MutexLocker const locker { m_spans_mutex };
+        for (auto const& span : m_spans) {
+            JsonObject args;
+            args.set("frame"sv, span.frame);
+
+            // Replays happen on the rendering thread, everything else on the event loop's thread.
+            JsonObject event;
+            event.set("name"sv, stage_name(span.stage));
+            event.set("ph"sv, "X"sv);
+            event.set("pid"sv, 1);
+            event.set("tid"sv, span.stage == Stage::Replay ? 2 : 1);
+            event.set("ts"sv, static_cast<double>(span.start.nanoseconds()) / 1000.0);
+            event.set("dur"sv, static_cast<double>((span.end - span.start).to_nanoseconds()) / 1000.0);
+            event.set("args"sv, move(args));
+            events.must_append(move(event));
+        }
+    }
+
+    JsonObject trace;
+    trace.set("traceEvents"sv, move(events));
+    return trace.serialized();
+}
+
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/CircularQueue.h>
+#include <AK/Noncopyable.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <LibThreading/Mutex.h>
+
+namespace Web::HTML {
+
+// Keeps the timings of the most recent rendering updates, so that slow frames can be attributed to the stage of the
+// pipeline that caused them. The spans can be dumped in the Chrome trace event format.
+class FrameTimings {
+    AK_MAKE_NONCOPYABLE(FrameTimings);
+    AK_MAKE_NONMOVABLE(FrameTimings);
+
+public:
+    enum class Stage : u8 {
+        UpdateTheRendering,
+        AnimationFrameCallbacks,
+        StyleAndLayout,
+        PaintRecording,
+        Replay,
+        Present,
+    };
+
+    static FrameTimings& the();
+
+    u64 begin_frame() { return ++m_current_frame; }
+    u64 current_frame() const { return m_current_frame; }
+
+    void record(Stage, u64 frame, MonotonicTime start, MonotonicTime end);
+
+    String to_chrome_trace_json() const;
+
+    class Scope {
+        AK_MAKE_NONCOPYABLE(Scope);
+        AK_MAKE_NONMOVABLE(Scope);
+
+    public:
+        Scope(Stage stage, u64 frame)
+            : m_stage(stage)
+            , m_frame(frame)
+            , m_start(MonotonicTime::now())
+        {
+        }
+
+        ~Scope() { FrameTimings::the().record(m_stage, m_frame, m_start, MonotonicTime::now()); }
+
+    private:
+        Stage m_stage;
+        u64 m_frame { 0 };
+        MonotonicTime m_start;
+    };
+
+private:
+    FrameTimings() = default;
+
+    struct Span {
+        Stage stage;
+        u64 frame { 0 };
+        MonotonicTime start;
+        MonotonicTime end;
+    };
+
+    static constexpr size_t max_span_count = 4096;
+
+    Atomic<u64> m_current_frame { 0 };
+
+    mutable Threading::Mutex m_spans_mutex;
+    CircularQueue<Span, max_span_count> m_spans;
+};
+
+StringView stage_name(FrameTimings::Stage);
+
+}
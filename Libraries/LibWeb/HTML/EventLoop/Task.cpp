@@ -20,14 +20,35 @@ static IDAllocator s_unique_task_source_allocator { static_cast<int>(Task::Sourc
     return next_task_id++;
 }
 
+Task::Priority Task::default_priority_for_source(Source source)
+{
+    switch (source) {
+    case Source::UserInteraction:
+        // Responding to input is what makes a page feel responsive, so it goes before everything else.
+        return Priority::Input;
+    case Source::Rendering:
+        return Priority::Rendering;
+    case Source::IdleTask:
+        return Priority::Background;
+    default:
+        return Priority::UserVisible;
+    }
+}
+
 GC::Ref<Task> Task::create(JS::VM& vm, Source source, GC::Ptr<DOM::Document const> document, GC::Ref<GC::Function<void()>> steps)
 {
-    return vm.heap().allocate<Task>(source, document, move(steps));
+    return create(vm, source, default_priority_for_source(source), document, move(steps));
+}
+
+GC::Ref<Task> Task::create(JS::VM& vm, Source source, Priority priority, GC::Ptr<DOM::Document const> document, GC::Ref<GC::Function<void()>> steps)
+{
+    return vm.heap().allocate<Task>(source, priority, document, move(steps));
 }
 
-Task::Task(Source source, GC::Ptr<DOM::Document const> document, GC::Ref<GC::Function<void()>> steps)
+Task::Task(Source source, Priority priority, GC::Ptr<DOM::Document const> document, GC::Ref<GC::Function<void()>> steps)
     : m_id(allocate_task_id())
     , m_source(source)
+    , m_priority(priority)
     , m_steps(steps)
     , m_document(document)
 {
@@ -80,18 +80,42 @@ public:
         // https://w3c.github.io/media-capabilities/#media-capabilities-task-source
         MediaCapabilities,
 
+        // https://w3c.github.io/webcrypto/#dfn-crypto-task-source
+        Crypto,
+
+        // https://wicg.github.io/scheduling-apis/#posted-task-task-source
+        PostedTask,
+
         // !!! IMPORTANT: Keep this field last!
         // This serves as the base value of all unique task sources.
         // Some elements, such as the HTMLMediaElement, must have a unique task source per instance.
         UniqueTaskSourceStart
     };
 
+    // The order in which the event loop picks tasks from its task queue. Tasks of a higher priority run first, but
+    // tasks of a lower priority are not starved forever. All tasks from one task source share their priority, so that
+    // they still run in the order they were queued in.
+    // NOTE: The last three are the task priorities of the Prioritized Task Scheduling API, with user-visible being
+    //       the priority of every task source that doesn't ask for another one.
+    enum class Priority : u8 {
+        Input,
+        Rendering,
+        UserBlocking,
+        UserVisible,
+        Background,
+    };
+    static constexpr size_t priority_count = to_underlying(Priority::Background) + 1;
+
+    static Priority default_priority_for_source(Source);
+
     static GC::Ref<Task> create(JS::VM&, Source, GC::Ptr<DOM::Document const>, GC::Ref<GC::Function<void()>> steps);
+    static GC::Ref<Task> create(JS::VM&, Source, Priority, GC::Ptr<DOM::Document const>, GC::Ref<GC::Function<void()>> steps);
 
     virtual ~Task() override;
 
     [[nodiscard]] TaskID id() const { return m_id; }
     Source source() const { return m_source; }
+    Priority priority() const { return m_priority; }
     void execute();
 
     DOM::Document const* document() const;
@@ -99,12 +123,13 @@ public:
     bool is_runnable() const;
 
 private:
-    Task(Source, GC::Ptr<DOM::Document const>, GC::Ref<GC::Function<void()>> steps);
+    Task(Source, Priority, GC::Ptr<DOM::Document const>, GC::Ref<GC::Function<void()>> steps);
 
     virtual void visit_edges(Visitor&) override;
 
     TaskID m_id {};
     Source m_source { Source::Unspecified };
+    Priority m_priority { Priority::UserVisible };
     GC::Ref<GC::Function<void()>> m_steps;
     GC::Ptr<DOM::Document const> m_document;
 };
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
+#include <AK/AnyOf.h>
 #include <LibGC/RootVector.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/EventLoop/TaskQueue.h>
@@ -23,27 +25,120 @@ void TaskQueue::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_event_loop);
-    visitor.visit(m_tasks);
+    for (auto& level : m_levels)
+        visitor.visit(level.tasks);
+    visitor.visit(m_last_added_task);
+}
+
+GC::Ref<Task> TaskQueue::PriorityLevel::take(size_t index)
+{
+    if (index != first_task_index)
+        return *tasks.take(index);
+
+    GC::Ref<HTML::Task> task = *tasks[first_task_index];
+    tasks[first_task_index++] = nullptr;
+
+    if (first_task_index == tasks.size()) {
+        tasks.clear_with_capacity();
+        first_task_index = 0;
+    } else if (first_task_index >= 32 && first_task_index * 2 >= tasks.size()) {
+        tasks.remove(0, first_task_index);
+        first_task_index = 0;
+    }
+    return task;
+}
+
+void TaskQueue::PriorityLevel::remove_tasks_matching(Function<bool(GC::Ref<HTML::Task>)> const& filter)
+{
+    // NOTE: The cleared slots before first_task_index never match, so they stay where they are.
+    tasks.remove_all_matching([&](auto& task) {
+        return task && filter(*task);
+    });
+
+    if (is_empty()) {
+        tasks.clear_with_capacity();
+        first_task_index = 0;
+    }
+}
+
+bool TaskQueue::is_empty() const
+{
+    return all_of(m_levels, [](auto& level) { return level.is_empty(); });
 }
 
 void TaskQueue::add(GC::Ref<Task> task)
 {
-    m_tasks.append(task);
+    m_levels[to_underlying(task->priority())].tasks.append(task);
+    m_last_added_task = task;
     m_event_loop->schedule();
 }
 
+GC::Ptr<Task> TaskQueue::dequeue()
+{
+    for (auto& level : m_levels) {
+        if (level.is_empty())
+            continue;
+        auto task = level.take(level.first_task_index);
+        if (m_last_added_task == task)
+            m_last_added_task = nullptr;
+        return task;
+    }
+    return nullptr;
+}
+
+bool TaskQueue::is_eligible_to_run(Task const& task) const
+{
+    if (m_event_loop->running_rendering_task() && task.source() == Task::Source::Rendering)
+        return false;
+    return task.is_runnable();
+}
+
+Optional<size_t> TaskQueue::first_runnable_task_index(PriorityLevel const& level) const
+{
+    for (size_t i = level.first_task_index; i < level.tasks.size(); ++i) {
+        if (is_eligible_to_run(*level.tasks[i]))
+            return i;
+    }
+    return {};
+}
+
+// A priority level whose runnable tasks have been passed over for this many tasks of other levels gets to run its
+// next task regardless of its priority, so that a steady stream of high priority tasks can't starve it.
+static constexpr size_t max_times_passed_over = 16;
+
 GC::Ptr<Task> TaskQueue::take_first_runnable()
 {
     if (m_event_loop->execution_paused())
         return nullptr;
 
-    for (size_t i = 0; i < m_tasks.size(); ++i) {
-        if (m_event_loop->running_rendering_task() && m_tasks[i]->source() == Task::Source::Rendering)
+    Array<Optional<size_t>, Task::priority_count> runnable_task_indices;
+    Optional<size_t> chosen_level;
+    for (size_t i = 0; i < m_levels.size(); ++i) {
+        runnable_task_indices[i] = first_runnable_task_index(m_levels[i]);
+        if (!runnable_task_indices[i].has_value())
             continue;
-        if (m_tasks[i]->is_runnable())
-            return m_tasks.take(i);
+        if (!chosen_level.has_value()) {
+            chosen_level = i;
+        } else if (m_levels[i].times_passed_over >= max_times_passed_over) {
+            chosen_level = i;
+            break;
+        }
     }
-    return nullptr;
+
+    if (!chosen_level.has_value())
+        return nullptr;
+
+    for (size_t i = 0; i < m_levels.size(); ++i) {
+        if (i == *chosen_level)
+            m_levels[i].times_passed_over = 0;
+        else if (runnable_task_indices[i].has_value())
+            ++m_levels[i].times_passed_over;
+    }
+
+    auto task = m_levels[*chosen_level].take(*runnable_task_indices[*chosen_level]);
+    if (m_last_added_task == task)
+        m_last_added_task = nullptr;
+    return task;
 }
 
 bool TaskQueue::has_runnable_tasks() const
@@ -51,35 +146,35 @@ bool TaskQueue::has_runnable_tasks() const
     if (m_event_loop->execution_paused())
         return false;
 
-    for (auto& task : m_tasks) {
-        if (m_event_loop->running_rendering_task() && task->source() == Task::Source::Rendering)
-            continue;
-        if (task->is_runnable())
-            return true;
-    }
-    return false;
+    return any_of(m_levels, [&](auto& level) { return first_runnable_task_index(level).has_value(); });
 }
 
 void TaskQueue::remove_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
-    m_tasks.remove_all_matching([&](auto& task) {
-        return filter(*task);
-    });
+    for (auto& level : m_levels) {
+        level.remove_tasks_matching([&](GC::Ref<Task> task) {
+            if (!filter(*task))
+                return false;
+            if (m_last_added_task == task)
+                m_last_added_task = nullptr;
+            return true;
+        });
+    }
 }
 
 GC::RootVector<GC::Ref<Task>> TaskQueue::take_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
     GC::RootVector<GC::Ref<Task>> matching_tasks(heap());
 
-    for (size_t i = 0; i < m_tasks.size();) {
-        auto& task = m_tasks.at(i);
-
-        if (filter(*task)) {
+    for (auto& level : m_levels) {
+        level.remove_tasks_matching([&](GC::Ref<Task> task) {
+            if (!filter(*task))
+                return false;
+            if (m_last_added_task == task)
+                m_last_added_task = nullptr;
             matching_tasks.append(task);
-            m_tasks.remove(i);
-        } else {
-            ++i;
-        }
+            return true;
+        });
     }
 
     return matching_tasks;
@@ -87,18 +182,14 @@ GC::RootVector<GC::Ref<Task>> TaskQueue::take_tasks_matching(Function<bool(HTML:
 
 Task const* TaskQueue::last_added_task() const
 {
-    if (m_tasks.is_empty())
-        return nullptr;
-    return m_tasks.last();
+    return m_last_added_task.ptr();
 }
 
 bool TaskQueue::has_rendering_tasks() const
 {
-    for (auto const& task : m_tasks) {
-        if (task->source() == Task::Source::Rendering)
-            return true;
-    }
-    return false;
+    // NOTE: Rendering tasks always have the rendering priority, so they can only be in that level.
+    auto const& level = m_levels[to_underlying(Task::Priority::Rendering)];
+    return any_of(level.pending_tasks(), [](auto& task) { return task->source() == Task::Source::Rendering; });
 }
 
 }
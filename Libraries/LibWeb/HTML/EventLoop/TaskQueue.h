@@ -6,7 +6,8 @@
 
 #pragma once
 
-#include <AK/Queue.h>
+#include <AK/Array.h>
+#include <AK/Vector.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/HTML/EventLoop/Task.h>
 
@@ -20,7 +21,7 @@ public:
     explicit TaskQueue(HTML::EventLoop&);
     virtual ~TaskQueue() override;
 
-    bool is_empty() const { return m_tasks.is_empty(); }
+    bool is_empty() const;
 
     bool has_runnable_tasks() const;
     bool has_rendering_tasks() const;
@@ -29,12 +30,7 @@ public:
     GC::Ptr<HTML::Task> take_first_runnable();
 
     void enqueue(GC::Ref<HTML::Task> task) { add(task); }
-    GC::Ptr<HTML::Task> dequeue()
-    {
-        if (m_tasks.is_empty())
-            return {};
-        return m_tasks.take_first();
-    }
+    GC::Ptr<HTML::Task> dequeue();
 
     void remove_tasks_matching(Function<bool(HTML::Task const&)>);
     GC::RootVector<GC::Ref<Task>> take_tasks_matching(Function<bool(HTML::Task const&)>);
@@ -44,9 +40,30 @@ public:
 private:
     virtual void visit_edges(Visitor&) override;
 
+    // The tasks of one priority, in the order they were added.
+    struct PriorityLevel {
+        // NOTE: Taking the first task only clears its slot and advances first_task_index, so that it is O(1). The
+        //       cleared slots are reclaimed once they make up most of the vector.
+        Vector<GC::Ptr<HTML::Task>> tasks;
+        size_t first_task_index { 0 };
+
+        // How many tasks of a higher priority have run since this level last ran one, while it had a runnable task.
+        size_t times_passed_over { 0 };
+
+        bool is_empty() const { return first_task_index == tasks.size(); }
+        ReadonlySpan<GC::Ptr<HTML::Task>> pending_tasks() const { return tasks.span().slice(first_task_index); }
+        GC::Ref<HTML::Task> take(size_t index);
+        void remove_tasks_matching(Function<bool(GC::Ref<HTML::Task>)> const&);
+    };
+
+    bool is_eligible_to_run(HTML::Task const&) const;
+    Optional<size_t> first_runnable_task_index(PriorityLevel const&) const;
+
     GC::Ref<HTML::EventLoop> m_event_loop;
 
-    Vector<GC::Ref<HTML::Task>> m_tasks;
+    Array<PriorityLevel, HTML::Task::priority_count> m_levels;
+
+    GC::Ptr<HTML::Task> m_last_added_task;
 };
 
 }
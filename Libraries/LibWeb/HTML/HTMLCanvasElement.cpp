@@ -20,6 +20,7 @@
 #include <LibWeb/HTML/CanvasRenderingContext2D.h>
 #include <LibWeb/HTML/HTMLCanvasElement.h>
 #include <LibWeb/HTML/Numbers.h>
+#include <LibWeb/HTML/OffscreenCanvas.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/Layout/CanvasBox.h>
@@ -243,6 +244,9 @@ JS::ThrowCompletionOr<HTMLCanvasElement::RenderingContext> HTMLCanvasElement::ge
 
     // 3. Run the steps in the cell of the following table whose column header matches this canvas element's canvas context mode and whose row header matches contextId:
     // NOTE: See the spec for the full table.
+    if (is_placeholder())
+        return JS::throw_completion(WebIDL::InvalidStateError::create(realm(), "Canvas control was transferred to an OffscreenCanvas"_string));
+
     if (type == "2d"sv) {
         if (TRY(create_2d_context(options)) == HasOrCreatedContext::Yes)
             return GC::make_root(*m_context.get<GC::Ref<HTML::CanvasRenderingContext2D>>());
@@ -383,6 +387,48 @@ WebIDL::ExceptionOr<void> HTMLCanvasElement::to_blob(GC::Ref<WebIDL::CallbackTyp
     return {};
 }
 
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-canvas-transfercontroltooffscreen
+WebIDL::ExceptionOr<GC::Ref<OffscreenCanvas>> HTMLCanvasElement::transfer_control_to_offscreen()
+{
+    // 1. If this canvas element's context mode is not set to none, throw an "InvalidStateError" DOMException.
+    if (!m_context.has<Empty>() || is_placeholder())
+        return WebIDL::InvalidStateError::create(realm(), "Canvas already has a rendering context"_string);
+
+    // 2. Let offscreenCanvas be a new OffscreenCanvas object with its width and height equal to the values of the width
+    //    and height content attributes of this canvas element.
+    auto size = bitmap_size_for_canvas();
+    auto offscreen_canvas = TRY(OffscreenCanvas::construct_impl(realm(), size.width(), size.height()));
+
+    // 3. Set the placeholder canvas element of offscreenCanvas to a weak reference to this canvas element.
+    // NOTE: The OffscreenCanvas commits its frames to a shared frame buffer instead, which it keeps when transferred to a worker.
+    m_placeholder_frame_buffer = TRY_OR_THROW_OOM(vm(), PlaceholderFrameBuffer::create(size));
+    offscreen_canvas->set_placeholder_frame_buffer(*m_placeholder_frame_buffer);
+    document().register_placeholder_canvas({}, *this);
+
+    // 4. Set this canvas element's context mode to placeholder.
+    // NOTE: This is implied by having a placeholder frame buffer.
+
+    // 5. Set this canvas element's placeholder OffscreenCanvas to offscreenCanvas.
+    // NOTE: The placeholder OffscreenCanvas is only used to propagate size changes, which we don't support yet.
+
+    // 6. Return offscreenCanvas.
+    return offscreen_canvas;
+}
+
+void HTMLCanvasElement::update_placeholder_frame()
+{
+    if (!m_placeholder_frame_buffer)
+        return;
+
+    auto frame = m_placeholder_frame_buffer->take_new_frame();
+    if (!frame)
+        return;
+
+    m_placeholder_frame = move(frame);
+    if (auto* paintable = this->paintable())
+        paintable->set_needs_display();
+}
+
 void HTMLCanvasElement::present()
 {
     if (auto surface = this->surface())
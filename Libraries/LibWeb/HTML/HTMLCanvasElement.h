@@ -7,7 +7,9 @@
 #pragma once
 
 #include <LibGfx/Forward.h>
+#include <LibGfx/ImmutableBitmap.h>
 #include <LibGfx/PaintingSurface.h>
+#include <LibWeb/HTML/Canvas/PlaceholderFrameBuffer.h>
 #include <LibWeb/HTML/HTMLElement.h>
 #include <LibWeb/WebIDL/Types.h>
 
@@ -42,8 +44,15 @@ public:
     String to_data_url(StringView type, JS::Value quality);
     WebIDL::ExceptionOr<void> to_blob(GC::Ref<WebIDL::CallbackType> callback, StringView type, JS::Value quality);
 
+    WebIDL::ExceptionOr<GC::Ref<OffscreenCanvas>> transfer_control_to_offscreen();
+
     void present();
 
+    // https://html.spec.whatwg.org/multipage/canvas.html#offscreencanvas-placeholder
+    bool is_placeholder() const { return !m_placeholder_frame_buffer.is_null(); }
+    RefPtr<Gfx::ImmutableBitmap> placeholder_frame() const { return m_placeholder_frame; }
+    void update_placeholder_frame();
+
     RefPtr<Gfx::PaintingSurface> surface() const;
     void allocate_painting_surface_if_needed();
 
@@ -65,6 +74,10 @@ private:
     void notify_context_about_canvas_size_change();
 
     Variant<GC::Ref<HTML::CanvasRenderingContext2D>, GC::Ref<WebGL::WebGLRenderingContext>, GC::Ref<WebGL::WebGL2RenderingContext>, Empty> m_context;
+
+    // NOTE: Only set in the "placeholder" context mode, i.e. after our control was transferred to an OffscreenCanvas.
+    RefPtr<PlaceholderFrameBuffer> m_placeholder_frame_buffer;
+    RefPtr<Gfx::ImmutableBitmap> m_placeholder_frame;
 };
 
 }
@@ -61,6 +61,9 @@ void HTMLImageElement::finalize()
 {
     Base::finalize();
     document().unregister_viewport_client(*this);
+
+    if (m_image_data_near_viewport)
+        m_image_data_near_viewport->did_leave_viewport();
 }
 
 void HTMLImageElement::initialize(JS::Realm& realm)
@@ -88,6 +91,7 @@ void HTMLImageElement::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_current_request);
     visitor.visit(m_pending_request);
+    visitor.visit(m_image_data_near_viewport);
     visitor.visit(m_document_observer);
     visit_lazy_loading_element(visitor);
 }
@@ -207,7 +211,24 @@ RefPtr<Gfx::ImmutableBitmap> HTMLImageElement::current_image_bitmap(Gfx::IntSize
 
 void HTMLImageElement::set_visible_in_viewport(bool)
 {
-    // FIXME: Loosen grip on image data when it's not visible, e.g via volatile memory.
+    update_whether_image_data_is_near_viewport();
+}
+
+void HTMLImageElement::update_whether_image_data_is_near_viewport()
+{
+    // NOTE: Images that aren't being rendered count as being near the viewport, as they may still be painted elsewhere,
+    //       e.g. by drawing them onto a canvas.
+    GC::Ptr<DecodedImageData> image_data;
+    if (decode_priority() != Platform::ImageDecodePriority::Offscreen)
+        image_data = m_current_request->image_data();
+
+    if (image_data == m_image_data_near_viewport)
+        return;
+    if (m_image_data_near_viewport)
+        m_image_data_near_viewport->did_leave_viewport();
+    m_image_data_near_viewport = image_data;
+    if (m_image_data_near_viewport)
+        m_image_data_near_viewport->did_enter_viewport();
 }
 
 // https://html.spec.whatwg.org/multipage/embedded-content.html#dom-img-width
@@ -587,6 +608,7 @@ void HTMLImageElement::update_the_image_data_impl(bool restart_animations, bool
 
             // 5. Prepare the current request for presentation given the img element.
             m_current_request->prepare_for_presentation(*this);
+            update_whether_image_data_is_near_viewport();
 
             // 6. Set the current request's current pixel density to selected pixel density.
             // FIXME: Spec bug! `selected_pixel_density` can be undefined here, per the spec.
@@ -797,6 +819,7 @@ void HTMLImageElement::add_callbacks_to_image_request(GC::Ref<ImageRequest> imag
 
                 // 2. Set image request to the completely available state.
                 image_request->set_state(ImageRequest::State::CompletelyAvailable);
+                update_whether_image_data_is_near_viewport();
 
                 // 3. Add the image to the list of available images using the key key, with the ignore higher-layer caching flag set.
                 document().list_of_available_images().add(key, *image_data, true);
@@ -839,9 +862,56 @@ void HTMLImageElement::add_callbacks_to_image_request(GC::Ref<ImageRequest> imag
                 dispatch_event(DOM::Event::create(realm(), HTML::EventNames::error));
 
             m_load_event_delayer.clear();
+        },
+        [this, image_request]() {
+            // AD-HOC: An image request becomes partially available once some of its data has been decoded, which for
+            //         us is whenever a partial image is decoded while the rest is still arriving. This is only done for
+            //         the current request, so that a pending request doesn't replace an image that is already shown.
+            if (image_request != m_current_request)
+                return;
+            if (image_request->state() != ImageRequest::State::Unavailable && image_request->state() != ImageRequest::State::PartiallyAvailable)
+                return;
+
+            auto image_data = image_request->shared_resource_request()->partial_image_data();
+            if (!image_data)
+                return;
+
+            auto had_image_data = image_request->image_data() != nullptr;
+            image_request->set_image_data(image_data);
+            image_request->set_state(ImageRequest::State::PartiallyAvailable);
+
+            // NOTE: The first partial image tells us the image's dimensions, later ones only change its pixels.
+            if (!had_image_data) {
+                set_needs_style_update(true);
+                if (auto layout_node = this->layout_node())
+                    layout_node->set_needs_layout_update(DOM::SetNeedsLayoutReason::HTMLImageElementUpdateTheImageData);
+            }
+            if (auto paintable = this->paintable())
+                paintable->set_needs_display();
+        },
+        [this]() {
+            return decode_priority();
         });
 }
 
+Platform::ImageDecodePriority HTMLImageElement::decode_priority() const
+{
+    // NOTE: Images that haven't been laid out yet may well end up in the viewport.
+    auto const* paintable_box = this->paintable_box();
+    if (!paintable_box)
+        return Platform::ImageDecodePriority::NearViewport;
+
+    auto viewport_rect = document().viewport_rect();
+    auto image_rect = paintable_box->absolute_rect();
+    if (image_rect.intersects(viewport_rect))
+        return Platform::ImageDecodePriority::Visible;
+
+    // Anything within a viewport's distance of the viewport is likely to be scrolled into view soon.
+    if (image_rect.intersects(viewport_rect.inflated(viewport_rect.width() * 2, viewport_rect.height() * 2)))
+        return Platform::ImageDecodePriority::NearViewport;
+    return Platform::ImageDecodePriority::Offscreen;
+}
+
 void HTMLImageElement::did_set_viewport_rect(CSSPixelRect const& viewport_rect)
 {
     if (viewport_rect.size() == m_last_seen_viewport_size)
@@ -942,6 +1012,7 @@ void HTMLImageElement::react_to_changes_in_the_environment()
 
             // 6. Prepare image request for presentation given the img element.
             image_request->prepare_for_presentation(*this);
+            update_whether_image_data_is_near_viewport();
             // FIXME: This is ad-hoc, updating the layout here should probably be handled by prepare_for_presentation().
             set_needs_style_update(true);
             if (auto layout_node = this->layout_node())
@@ -137,6 +137,8 @@ private:
     void handle_successful_fetch(URL::URL const&, StringView mime_type, ImageRequest&, ByteBuffer, bool maybe_omit_events, URL::URL const& previous_url);
     void handle_failed_fetch();
     void add_callbacks_to_image_request(GC::Ref<ImageRequest>, bool maybe_omit_events, String const& url_string, String const& previous_url);
+    Platform::ImageDecodePriority decode_priority() const;
+    void update_whether_image_data_is_near_viewport();
 
     void animate();
 
@@ -162,6 +164,9 @@ private:
 
     SourceSet m_source_set;
 
+    // The image data we've told that it's near our viewport, so that it keeps its decoded bitmaps in memory.
+    GC::Ptr<DecodedImageData> m_image_data_near_viewport;
+
     CSSPixelSize m_last_seen_viewport_size;
 };
 
@@ -538,6 +538,7 @@ void HTMLObjectElement::load_image()
     m_document_load_event_delayer_for_resource_load.empend(document());
 
     m_resource_request = HTML::SharedResourceRequest::get_or_create(realm(), document().page(), *url);
+    m_resource_request->keep_decoded_image_resident();
     m_resource_request->add_callbacks(
         [this] {
             run_object_representation_completed_steps(Representation::Image);
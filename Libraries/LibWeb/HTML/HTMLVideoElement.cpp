@@ -6,6 +6,7 @@
  */
 
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/YUVData.h>
 #include <LibWeb/Bindings/HTMLVideoElementPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/CSS/ComputedProperties.h>
@@ -18,8 +19,11 @@
 #include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
 #include <LibWeb/HTML/AudioTrackList.h>
 #include <LibWeb/HTML/HTMLVideoElement.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/VideoPlaybackQuality.h>
 #include <LibWeb/HTML/VideoTrack.h>
 #include <LibWeb/HTML/VideoTrackList.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
 #include <LibWeb/Layout/VideoBox.h>
 #include <LibWeb/Painting/Paintable.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
@@ -109,6 +113,29 @@ u32 HTMLVideoElement::video_height() const
     return m_video_height;
 }
 
+// https://w3c.github.io/media-playback-quality/#dom-htmlvideoelement-getvideoplaybackquality
+GC::Ref<VideoPlaybackQuality> HTMLVideoElement::get_video_playback_quality() const
+{
+    // 1. Let playbackQuality be a new instance of VideoPlaybackQuality.
+    // 2. Set playbackQuality.creationTime to the value returned by a call to now().
+    auto creation_time = HighResolutionTime::current_high_resolution_time(HTML::relevant_global_object(*this));
+
+    // 3. Set playbackQuality.totalVideoFrames to the number of frames that would have been displayed if no frames are
+    //    dropped, which is the number of frames presented plus those that were dropped.
+    // 4. Set playbackQuality.droppedVideoFrames to the total number of frames dropped.
+    u64 dropped_video_frames = 0;
+    u64 total_video_frames = 0;
+    if (m_video_track) {
+        dropped_video_frames = m_video_track->number_of_dropped_frames();
+        total_video_frames = m_video_track->number_of_presented_frames() + dropped_video_frames;
+    }
+
+    // 5. Set playbackQuality.corruptedVideoFrames to the total number of corrupted frames.
+    // 6. Return playbackQuality.
+    auto clamp_to_unsigned_long = [](u64 value) { return static_cast<WebIDL::UnsignedLong>(min<u64>(value, NumericLimits<WebIDL::UnsignedLong>::max())); };
+    return VideoPlaybackQuality::create(realm(), creation_time, clamp_to_unsigned_long(dropped_video_frames), clamp_to_unsigned_long(total_video_frames));
+}
+
 void HTMLVideoElement::set_video_track(GC::Ptr<HTML::VideoTrack> video_track)
 {
     set_needs_style_update(true);
@@ -121,13 +148,29 @@ void HTMLVideoElement::set_video_track(GC::Ptr<HTML::VideoTrack> video_track)
     m_video_track = video_track;
 }
 
-void HTMLVideoElement::set_current_frame(Badge<VideoTrack>, RefPtr<Gfx::Bitmap> frame, double position)
+void HTMLVideoElement::set_current_frame(Badge<VideoTrack>, RefPtr<Gfx::Bitmap> frame, RefPtr<Gfx::YUVData> yuv_data, double position)
 {
-    m_current_frame = { move(frame), position };
+    m_current_frame = { move(frame), move(yuv_data), position };
     if (paintable())
         paintable()->set_needs_display();
 }
 
+RefPtr<Gfx::Bitmap> HTMLVideoElement::bitmap() const
+{
+    if (m_current_frame.frame || !m_current_frame.yuv_data)
+        return m_current_frame.frame;
+
+    // NOTE: Painting draws the YUV planes directly, so only convert them for the callers that need RGB pixels, and
+    //       only once per frame.
+    auto bitmap_or_error = m_current_frame.yuv_data->to_bitmap();
+    if (bitmap_or_error.is_error()) {
+        dbgln("Failed to convert video frame to a bitmap: {}", bitmap_or_error.error());
+        return nullptr;
+    }
+    m_current_frame.frame = bitmap_or_error.release_value();
+    return m_current_frame.frame;
+}
+
 void HTMLVideoElement::on_playing()
 {
     if (m_video_track)
@@ -16,7 +16,10 @@
 namespace Web::HTML {
 
 struct VideoFrame {
+    // Frames are usually kept as the decoder's YUV planes, which are converted to RGB while painting. Frames that need
+    // a color conversion painting can't do arrive as an RGB bitmap instead.
     RefPtr<Gfx::Bitmap> frame;
+    RefPtr<Gfx::YUVData> yuv_data;
     double position { 0.0 };
 };
 
@@ -38,15 +41,14 @@ public:
 
     void set_video_track(GC::Ptr<VideoTrack>);
 
-    void set_current_frame(Badge<VideoTrack>, RefPtr<Gfx::Bitmap> frame, double position);
+    GC::Ref<VideoPlaybackQuality> get_video_playback_quality() const;
+
+    void set_current_frame(Badge<VideoTrack>, RefPtr<Gfx::Bitmap> frame, RefPtr<Gfx::YUVData> yuv_data, double position);
     VideoFrame const& current_frame() const { return m_current_frame; }
     RefPtr<Gfx::Bitmap> const& poster_frame() const { return m_poster_frame; }
 
     // FIXME: This is a hack for images used as CanvasImageSource. Do something more elegant.
-    RefPtr<Gfx::Bitmap> bitmap() const
-    {
-        return current_frame().frame;
-    }
+    RefPtr<Gfx::Bitmap> bitmap() const;
 
 private:
     HTMLVideoElement(DOM::Document&, DOM::QualifiedName);
@@ -71,7 +73,7 @@ private:
     WebIDL::ExceptionOr<void> determine_element_poster_frame(Optional<String> const& poster);
 
     GC::Ptr<HTML::VideoTrack> m_video_track;
-    VideoFrame m_current_frame;
+    mutable VideoFrame m_current_frame;
     RefPtr<Gfx::Bitmap> m_poster_frame;
 
     u32 m_video_width { 0 };
@@ -25,6 +25,7 @@
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/BrowsingContextGroup.h>
 #include <LibWeb/HTML/DocumentState.h>
+#include <LibWeb/HTML/EventLoop/FrameTimings.h>
 #include <LibWeb/HTML/HTMLIFrameElement.h>
 #include <LibWeb/HTML/HistoryHandlingBehavior.h>
 #include <LibWeb/HTML/Navigable.h>
@@ -2564,15 +2565,62 @@ void Navigable::paint_next_frame()
 
     auto viewport_rect = page().css_to_device_rect(this->viewport_rect());
     PaintConfig paint_config { .paint_overlay = true, .should_show_line_box_borders = m_should_show_line_box_borders, .canvas_fill_rect = Gfx::IntRect { {}, viewport_rect.size().to_type<int>() } };
-    start_display_list_rendering(*painting_surface, paint_config, [this, viewport_rect, backing_store_id] {
+    auto damage_rect = damage_rect_for_next_frame(*painting_surface, paint_config);
+    start_display_list_rendering(*painting_surface, paint_config, damage_rect, [this, viewport_rect, backing_store_id, frame = FrameTimings::the().current_frame()] {
         if (!is_top_level_traversable())
             return;
+        FrameTimings::Scope const present_scope { FrameTimings::Stage::Present, frame };
         auto& traversable = *page().top_level_traversable();
         traversable.page().client().page_did_paint(viewport_rect.to_type<int>(), backing_store_id);
     });
 }
 
-void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surface, PaintConfig paint_config, Function<void()>&& callback)
+void Navigable::paint_next_frame_if_only_scrolled()
+{
+    // NOTE: We don't want to hold up the frame that is painted at the end of the rendering update, in case something
+    //       else changes by then, so this is only done while no other frame is being rasterized.
+    if (!m_needs_repaint || m_number_of_queued_rasterization_tasks != 0)
+        return;
+
+    // Everything but scrolling invalidates the cached display list.
+    auto document = active_document();
+    if (!document || !document->paintable() || !document->has_cached_display_list())
+        return;
+
+    paint_next_frame();
+}
+
+Optional<Gfx::IntRect> Navigable::damage_rect_for_next_frame(Gfx::PaintingSurface& painting_surface, PaintConfig const& paint_config)
+{
+    // The document's damage is in absolute coordinates. If it didn't record any, we don't know what changed.
+    Optional<Gfx::IntRect> damage_rect;
+    if (auto document = active_document()) {
+        if (auto damaged_rect = document->take_damaged_rect(); damaged_rect.has_value()) {
+            auto viewport_relative_rect = damaged_rect->translated(-viewport_rect().location());
+            damage_rect = page().enclosing_device_rect(viewport_relative_rect).to_type<int>().inflated(2, 2);
+        }
+    }
+
+    // The surface we're about to paint into holds whichever frame was last painted into it. Unless that was the
+    // previous frame, it's also missing everything the previous frame repainted.
+    Optional<Gfx::IntRect> rect_to_repaint;
+    if (damage_rect.has_value()) {
+        if (m_previous_frame.painting_surface == &painting_surface && m_previous_frame.paint_config == paint_config) {
+            rect_to_repaint = damage_rect;
+        } else if (m_frame_before_previous.painting_surface == &painting_surface
+            && m_frame_before_previous.paint_config == paint_config
+            && m_previous_frame.paint_config == paint_config
+            && m_previous_frame.damage_rect.has_value()) {
+            rect_to_repaint = damage_rect->united(*m_previous_frame.damage_rect);
+        }
+    }
+
+    m_frame_before_previous = move(m_previous_frame);
+    m_previous_frame = { painting_surface, damage_rect, paint_config };
+    return rect_to_repaint;
+}
+
+void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surface, PaintConfig paint_config, Optional<Gfx::IntRect> damage_rect, Function<void()>&& callback)
 {
     m_needs_repaint = false;
     auto document = active_document();
@@ -2581,13 +2629,15 @@ void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surf
         return;
     }
     document->paintable()->refresh_scroll_state();
+    auto paint_recording_start_time = MonotonicTime::now();
     auto display_list = document->record_display_list(paint_config);
+    FrameTimings::the().record(FrameTimings::Stage::PaintRecording, FrameTimings::the().current_frame(), paint_recording_start_time, MonotonicTime::now());
     if (!display_list) {
         callback();
         return;
     }
     auto scroll_state_snapshot = document->paintable()->scroll_state().snapshot();
-    m_rendering_thread.enqueue_rendering_task(*display_list, move(scroll_state_snapshot), painting_surface, move(callback));
+    m_rendering_thread.enqueue_rendering_task(*display_list, move(scroll_state_snapshot), painting_surface, damage_rect, move(callback));
 }
 
 }
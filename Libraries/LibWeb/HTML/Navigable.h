@@ -208,7 +208,10 @@ public:
     bool is_ready_to_paint() const;
     void ready_to_paint();
     void paint_next_frame();
-    void start_display_list_rendering(Gfx::PaintingSurface&, PaintConfig, Function<void()>&& callback);
+    // Paints the next frame if nothing but scroll offsets changed since the last one, which only takes replaying the
+    // display list we already have with the new scroll state.
+    void paint_next_frame_if_only_scrolled();
+    void start_display_list_rendering(Gfx::PaintingSurface&, PaintConfig, Optional<Gfx::IntRect> damage_rect, Function<void()>&& callback);
 
     bool needs_repaint() const { return m_needs_repaint; }
     void set_needs_repaint() { m_needs_repaint = true; }
@@ -243,6 +246,8 @@ private:
 
     void inform_the_navigation_api_about_aborting_navigation();
 
+    Optional<Gfx::IntRect> damage_rect_for_next_frame(Gfx::PaintingSurface&, PaintConfig const&);
+
     // https://html.spec.whatwg.org/multipage/document-sequences.html#nav-id
     String m_id;
 
@@ -285,6 +290,17 @@ private:
     bool m_should_show_line_box_borders { false };
     i32 m_number_of_queued_rasterization_tasks { 0 };
     GC::Ref<Painting::BackingStoreManager> m_backing_store_manager;
+
+    // What was painted into the backing stores by the last two frames, so the next frame knows which parts of
+    // the store it's about to paint into are out of date. A missing damage rect means the whole frame was repainted.
+    struct PaintedFrame {
+        RefPtr<Gfx::PaintingSurface> painting_surface;
+        Optional<Gfx::IntRect> damage_rect;
+        PaintConfig paint_config;
+    };
+    PaintedFrame m_previous_frame;
+    PaintedFrame m_frame_before_previous;
+
     RefPtr<Gfx::SkiaBackendContext> m_skia_backend_context;
     RenderingThread m_rendering_thread;
 };
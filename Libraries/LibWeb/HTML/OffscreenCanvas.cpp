@@ -5,10 +5,13 @@
  */
 
 #include <AK/Tuple.h>
+#include <LibIPC/File.h>
 #include <LibWeb/Bindings/OffscreenCanvasPrototype.h>
 #include <LibWeb/HTML/Canvas/SerializeBitmap.h>
 #include <LibWeb/HTML/OffscreenCanvas.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/OffscreenCanvasRenderingContext2D.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
@@ -19,6 +22,8 @@ namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(OffscreenCanvas);
 
+constexpr u8 IPC_FILE_TAG = 0xA5;
+
 GC::Ref<OffscreenCanvas> OffscreenCanvas::create(JS::Realm& realm, WebIDL::UnsignedLong width,
     WebIDL::UnsignedLong height)
 {
@@ -80,25 +85,63 @@ OffscreenCanvas::OffscreenCanvas(JS::Realm& realm, RefPtr<Gfx::Bitmap> bitmap)
 
 OffscreenCanvas::~OffscreenCanvas() = default;
 
-WebIDL::ExceptionOr<void> OffscreenCanvas::transfer_steps(HTML::TransferDataHolder&)
+// https://html.spec.whatwg.org/multipage/canvas.html#the-offscreencanvas-interface:transfer-steps
+WebIDL::ExceptionOr<void> OffscreenCanvas::transfer_steps(HTML::TransferDataHolder& data_holder)
 {
-    // FIXME: Implement this
-    dbgln("(STUBBED) OffscreenCanvas::transfer_steps(HTML::TransferDataHolder&)");
+    // 1. If value's context mode is not equal to none, then throw an "InvalidStateError" DOMException.
+    if (!m_context.has<Empty>())
+        return WebIDL::InvalidStateError::create(realm(), "Cannot transfer an OffscreenCanvas that has a rendering context"_string);
+
+    // 2. Set value's context mode to detached.
+    // NOTE: The caller marks us as detached.
+
+    // 3. Let width and height be the dimensions of value's bitmap.
+    auto size = bitmap_size_for_canvas();
+
+    // 4. Unset value's bitmap.
+    m_bitmap = nullptr;
+
+    // 5. Set dataHolder.[[Width]] to width and dataHolder.[[Height]] to height.
+    data_holder.data.append(size.width());
+    data_holder.data.append(size.height());
+
+    // 6. Set dataHolder.[[PlaceholderCanvas]] to be a weak reference to value's placeholder canvas element, if value has one, or null if it does not.
+    if (auto frame_buffer = move(m_placeholder_frame_buffer)) {
+        auto fd = TRY_OR_THROW_OOM(vm(), IPC::File::clone_fd(frame_buffer->anonymous_buffer().fd()));
+        data_holder.fds.append(move(fd));
+        data_holder.data.append(IPC_FILE_TAG);
+    } else {
+        data_holder.data.append(0);
+    }
+
     return {};
 }
 
-WebIDL::ExceptionOr<void> OffscreenCanvas::transfer_receiving_steps(HTML::TransferDataHolder&)
+// https://html.spec.whatwg.org/multipage/canvas.html#the-offscreencanvas-interface:transfer-receiving-steps
+WebIDL::ExceptionOr<void> OffscreenCanvas::transfer_receiving_steps(HTML::TransferDataHolder& data_holder)
 {
-    // FIXME: Implement this
-    dbgln("(STUBBED) OffscreenCanvas::transfer_receiving_steps(HTML::TransferDataHolder&)");
+    Gfx::IntSize size { static_cast<int>(data_holder.data.take_first()), static_cast<int>(data_holder.data.take_first()) };
+    auto fd_tag = data_holder.data.take_first();
+
+    // 1. Initialize value's bitmap to a rectangular array of transparent black pixels with width given by dataHolder.[[Width]] and height given by dataHolder.[[Height]].
+    set_new_bitmap_size(size);
+
+    // 2. If dataHolder.[[PlaceholderCanvas]] is not null, set value's placeholder canvas element to dataHolder.[[PlaceholderCanvas]] (while maintaining the weak reference semantics).
+    if (fd_tag == IPC_FILE_TAG) {
+        auto fd = data_holder.fds.take_first();
+        auto buffer = TRY_OR_THROW_OOM(vm(), Core::AnonymousBuffer::create_from_anon_fd(fd.take_fd(), PlaceholderFrameBuffer::buffer_size_for(size)));
+        m_placeholder_frame_buffer = TRY_OR_THROW_OOM(vm(), PlaceholderFrameBuffer::create_from_anonymous_buffer(move(buffer), size));
+    } else if (fd_tag != 0) {
+        dbgln("Unexpected byte {:x} in OffscreenCanvas transfer data", fd_tag);
+        VERIFY_NOT_REACHED();
+    }
+
     return {};
 }
 
 HTML::TransferType OffscreenCanvas::primary_interface() const
 {
-    // FIXME: Implement this
-    dbgln("(STUBBED) OffscreenCanvas::primary_interface()");
-    return {};
+    return HTML::TransferType::OffscreenCanvas;
 }
 
 WebIDL::UnsignedLong OffscreenCanvas::width() const
@@ -156,6 +199,31 @@ void OffscreenCanvas::set_new_bitmap_size(Gfx::IntSize new_size)
             // Do nothing.
         });
 }
+
+void OffscreenCanvas::did_draw(Badge<OffscreenCanvasRenderingContext2D>)
+{
+    if (!m_placeholder_frame_buffer || m_has_pending_placeholder_commit)
+        return;
+
+    // https://html.spec.whatwg.org/multipage/canvas.html#offscreencanvas-placeholder
+    // When an OffscreenCanvas object whose placeholder canvas element is set has its bitmap changed, the user agent
+    // must update the rendering of the placeholder canvas element.
+    // OPTIMIZATION: Everything drawn within one task ends up in a single frame, which we commit from our own event loop.
+    //               The placeholder picks it up straight from shared memory when its document updates the rendering, so
+    //               a canvas driven from a worker never needs anything from the main thread's event loop to present.
+    m_has_pending_placeholder_commit = true;
+    queue_global_task(Task::Source::Rendering, relevant_global_object(*this), GC::create_function(heap(), [this] {
+        m_has_pending_placeholder_commit = false;
+        commit_to_placeholder();
+    }));
+}
+
+void OffscreenCanvas::commit_to_placeholder()
+{
+    if (m_placeholder_frame_buffer && m_bitmap)
+        m_placeholder_frame_buffer->commit(*m_bitmap);
+}
+
 RefPtr<Gfx::Bitmap> OffscreenCanvas::bitmap() const
 {
     return m_bitmap;
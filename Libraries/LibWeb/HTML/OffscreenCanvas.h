@@ -6,11 +6,13 @@
 
 #pragma once
 
+#include <AK/Badge.h>
 #include <LibGfx/Bitmap.h>
 #include <LibWeb/Bindings/PlatformObject.h>
 #include <LibWeb/Bindings/Transferable.h>
 #include <LibWeb/DOM/EventTarget.h>
 #include <LibWeb/Forward.h>
+#include <LibWeb/HTML/Canvas/PlaceholderFrameBuffer.h>
 #include <LibWeb/WebIDL/Types.h>
 
 namespace Web::HTML {
@@ -62,6 +64,10 @@ public:
 
     GC::Ref<WebIDL::Promise> convert_to_blob(Optional<ImageEncodeOptions> options);
 
+    // https://html.spec.whatwg.org/multipage/canvas.html#offscreencanvas-placeholder
+    void set_placeholder_frame_buffer(NonnullRefPtr<PlaceholderFrameBuffer> frame_buffer) { m_placeholder_frame_buffer = move(frame_buffer); }
+    void did_draw(Badge<OffscreenCanvasRenderingContext2D>);
+
     void set_oncontextlost(GC::Ptr<WebIDL::CallbackType>);
     GC::Ptr<WebIDL::CallbackType> oncontextlost();
     void set_oncontextrestored(GC::Ptr<WebIDL::CallbackType>);
@@ -81,10 +87,16 @@ private:
 
     void reset_context_to_default_state();
     void set_new_bitmap_size(Gfx::IntSize new_size);
+    void commit_to_placeholder();
 
     Variant<GC::Ref<HTML::OffscreenCanvasRenderingContext2D>, GC::Ref<WebGL::WebGLRenderingContext>, GC::Ref<WebGL::WebGL2RenderingContext>, Empty> m_context;
 
     RefPtr<Gfx::Bitmap> m_bitmap;
+
+    // NOTE: Rather than a reference to the placeholder canvas element, which may live in another process if we were
+    //       transferred to a worker, we hold on to the shared memory that the placeholder presents frames from.
+    RefPtr<PlaceholderFrameBuffer> m_placeholder_frame_buffer;
+    bool m_has_pending_placeholder_commit { false };
 };
 
 }
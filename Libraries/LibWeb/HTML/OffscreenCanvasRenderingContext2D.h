@@ -134,15 +134,24 @@ private:
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
-    virtual Gfx::Painter* painter_for_canvas_state() override
-    {
-        dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::painter_for_canvas_state()");
-        return nullptr;
-    }
+    virtual Gfx::Painter* painter_for_canvas_state() override { return painter(); }
     virtual Gfx::Path& path_for_canvas_state() override { return path(); }
 
+    void fill_internal(Gfx::Path const&, Gfx::WindingRule);
+    void stroke_internal(Gfx::Path const&);
+    void did_draw();
+
+    Gfx::Color clear_color() const;
+
     GC::Ref<OffscreenCanvas> m_canvas;
     Gfx::IntSize m_size;
+
+    // The canvas replaces its bitmap when it is resized or transferred to an ImageBitmap, so we keep track of the one
+    // our painter draws into.
+    RefPtr<Gfx::Bitmap> m_painted_bitmap;
+    RefPtr<Gfx::PaintingSurface> m_surface;
+    OwnPtr<Gfx::Painter> m_painter;
+
     CanvasRenderingContext2DSettings m_context_attributes;
 };
 
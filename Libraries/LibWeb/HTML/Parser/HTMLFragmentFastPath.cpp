@@ -0,0 +1,461 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AnyOf.h>
+#include <AK/CharacterTypes.h>
+#include <AK/GenericLexer.h>
+#include <AK/StringBuilder.h>
+#include <AK/Utf8View.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/ElementFactory.h>
+#include <LibWeb/DOM/Text.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/HTMLFormElement.h>
+#include <LibWeb/HTML/Parser/Entities.h>
+#include <LibWeb/HTML/Parser/HTMLFragmentFastPath.h>
+#include <LibWeb/HTML/Parser/HTMLParser.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Namespace.h>
+
+namespace Web::HTML {
+
+// How the "in body" insertion mode treats a start tag, restricted to the elements the fast path accepts.
+enum class StartTagKind {
+    // Handled by "any other start tag": the element is simply inserted.
+    Ordinary,
+    // Formatting elements are pushed onto the list of active formatting elements. As long as everything is
+    // properly nested, that list only ever holds elements that are also on the stack of open elements, so
+    // reconstructing it is a no-op and the adoption agency algorithm reduces to popping the current node.
+    Formatting,
+    // address, div, section and friends close an open p element.
+    ClosesParagraph,
+    // h1-h6 close an open p element and an open heading.
+    Heading,
+    // li closes an open p element and an open li, unless a special element other than address, div or p is in between.
+    ListItem,
+    // Void elements are inserted and immediately popped.
+    Void,
+    // hr is a void element that also closes an open p element.
+    VoidClosesParagraph,
+};
+
+static Optional<StartTagKind> start_tag_kind(FlyString const& tag_name)
+{
+    if (tag_name.is_one_of(
+            TagNames::abbr, TagNames::bdi, TagNames::bdo, TagNames::cite, TagNames::data, TagNames::del,
+            TagNames::dfn, TagNames::ins, TagNames::kbd, TagNames::mark, TagNames::q, TagNames::samp,
+            TagNames::span, TagNames::sub, TagNames::sup, TagNames::time, TagNames::var))
+        return StartTagKind::Ordinary;
+    if (tag_name.is_one_of(
+            TagNames::a, TagNames::b, TagNames::big, TagNames::code, TagNames::em, TagNames::font, TagNames::i,
+            TagNames::s, TagNames::small, TagNames::strike, TagNames::strong, TagNames::tt, TagNames::u))
+        return StartTagKind::Formatting;
+    if (tag_name.is_one_of(
+            TagNames::address, TagNames::article, TagNames::aside, TagNames::blockquote, TagNames::center,
+            TagNames::details, TagNames::dialog, TagNames::dir, TagNames::div, TagNames::dl, TagNames::figcaption,
+            TagNames::figure, TagNames::footer, TagNames::header, TagNames::hgroup, TagNames::main, TagNames::menu,
+            TagNames::nav, TagNames::ol, TagNames::p, TagNames::search, TagNames::section, TagNames::summary, TagNames::ul))
+        return StartTagKind::ClosesParagraph;
+    if (tag_name.is_one_of(TagNames::h1, TagNames::h2, TagNames::h3, TagNames::h4, TagNames::h5, TagNames::h6))
+        return StartTagKind::Heading;
+    if (tag_name == TagNames::li)
+        return StartTagKind::ListItem;
+    if (tag_name.is_one_of(TagNames::br, TagNames::img, TagNames::wbr))
+        return StartTagKind::Void;
+    if (tag_name == TagNames::hr)
+        return StartTagKind::VoidClosesParagraph;
+    return {};
+}
+
+// The fast path assumes that resetting the insertion mode lands in "in body" and that the tokenizer starts in the
+// data state, which holds for HTML context elements other than these.
+static bool is_supported_context_element(DOM::Element const& context_element)
+{
+    if (context_element.namespace_uri() != Namespace::HTML)
+        return false;
+    return !context_element.local_name().is_one_of(
+        TagNames::caption, TagNames::colgroup, TagNames::frameset, TagNames::head, TagNames::html, TagNames::iframe,
+        TagNames::noembed, TagNames::noframes, TagNames::noscript, TagNames::plaintext, TagNames::script,
+        TagNames::select, TagNames::style, TagNames::table, TagNames::tbody, TagNames::td, TagNames::template_,
+        TagNames::textarea, TagNames::tfoot, TagNames::th, TagNames::thead, TagNames::title, TagNames::tr,
+        TagNames::xmp);
+}
+
+static bool is_html_whitespace(char c)
+{
+    // NOTE: U+000D never gets here, since the fast path rejects input that would need newline normalization.
+    return c == '\t' || c == '\n' || c == '\f' || c == ' ';
+}
+
+class FragmentFastPathParser {
+public:
+    FragmentFastPathParser(DOM::Document& document, StringView markup, bool form_element_pointer_is_set)
+        : m_document(document)
+        , m_lexer(markup)
+        , m_form_element_pointer_is_set(form_element_pointer_is_set)
+    {
+    }
+
+    bool parse()
+    {
+        while (!m_lexer.is_eof()) {
+            if (!parse_text())
+                return false;
+            if (m_lexer.is_eof())
+                break;
+            if (!parse_tag())
+                return false;
+        }
+
+        // Unclosed elements would be closed implicitly by the full parser, which we don't try to replicate.
+        return m_stack_of_open_elements.is_empty();
+    }
+
+    Vector<GC::Root<DOM::Node>> take_top_level_nodes() { return move(m_top_level_nodes); }
+
+private:
+    enum class InAttribute {
+        No,
+        Yes,
+    };
+
+    // Consumes character data up to the next tag.
+    bool parse_text()
+    {
+        StringBuilder builder;
+        while (!m_lexer.is_eof()) {
+            auto c = m_lexer.peek();
+            if (c == '<') {
+                auto next = m_lexer.peek(1);
+                if (is_ascii_alpha(next) || next == '/' || next == '!' || next == '?')
+                    break;
+                builder.append(m_lexer.consume());
+                continue;
+            }
+            if (c == '&') {
+                if (!consume_character_reference(builder, InAttribute::No))
+                    return false;
+                continue;
+            }
+            if (c == '\0' || c == '\r')
+                return false;
+            builder.append(m_lexer.consume());
+        }
+
+        if (!builder.is_empty())
+            append_node(m_document->realm().create<DOM::Text>(m_document, builder.to_string_without_validation()));
+        return true;
+    }
+
+    bool parse_tag()
+    {
+        VERIFY(m_lexer.next_is('<'));
+        auto next = m_lexer.peek(1);
+        if (next == '/')
+            return parse_end_tag();
+        if (!is_ascii_alpha(next))
+            return false;
+        return parse_start_tag();
+    }
+
+    Optional<FlyString> consume_tag_name()
+    {
+        auto name = m_lexer.consume_while([](char c) { return is_ascii_alphanumeric(c); });
+        if (name.is_empty())
+            return {};
+        auto next = m_lexer.peek();
+        if (next != '>' && next != '/' && !is_html_whitespace(next))
+            return {};
+        return FlyString::from_utf8_without_validation(name.bytes()).to_ascii_lowercase();
+    }
+
+    bool parse_start_tag()
+    {
+        m_lexer.ignore();
+        auto tag_name = consume_tag_name();
+        if (!tag_name.has_value())
+            return false;
+        auto kind = start_tag_kind(*tag_name);
+        if (!kind.has_value())
+            return false;
+
+        Vector<FlyString> attribute_names;
+        Vector<String> attribute_values;
+        bool self_closing = false;
+        while (true) {
+            m_lexer.ignore_while(is_html_whitespace);
+            if (m_lexer.consume_specific('>'))
+                break;
+            if (m_lexer.consume_specific("/>"sv)) {
+                self_closing = true;
+                break;
+            }
+            if (!parse_attribute(attribute_names, attribute_values))
+                return false;
+        }
+
+        bool is_void = kind == StartTagKind::Void || kind == StartTagKind::VoidClosesParagraph;
+        // The full parser ignores the self-closing flag on non-void elements, leaving them open.
+        if (self_closing && !is_void)
+            return false;
+
+        switch (*kind) {
+        case StartTagKind::Ordinary:
+            break;
+        case StartTagKind::Void:
+            // <img> is form-associated, and would be associated with the form element pointer.
+            if (*tag_name == TagNames::img && m_form_element_pointer_is_set)
+                return false;
+            break;
+        case StartTagKind::Formatting:
+            // A nested <a> runs the adoption agency algorithm for the outer one.
+            if (*tag_name == TagNames::a && has_open_element(TagNames::a))
+                return false;
+            break;
+        case StartTagKind::ClosesParagraph:
+        case StartTagKind::VoidClosesParagraph:
+            if (has_open_element(TagNames::p))
+                return false;
+            break;
+        case StartTagKind::Heading:
+            if (has_open_element(TagNames::p))
+                return false;
+            if (!m_stack_of_open_elements.is_empty() && start_tag_kind(m_stack_of_open_elements.last()->local_name()) == StartTagKind::Heading)
+                return false;
+            break;
+        case StartTagKind::ListItem:
+            for (auto i = m_stack_of_open_elements.size(); i > 0; --i) {
+                auto const& node = m_stack_of_open_elements[i - 1];
+                if (node->local_name() == TagNames::li)
+                    return false;
+                if (HTMLParser::is_special_tag(node->local_name(), Namespace::HTML) && !node->local_name().is_one_of(TagNames::address, TagNames::div, TagNames::p))
+                    break;
+            }
+            if (has_open_element(TagNames::p))
+                return false;
+            break;
+        }
+
+        auto element = MUST(DOM::create_element(m_document, *tag_name, Namespace::HTML));
+        for (size_t i = 0; i < attribute_names.size(); ++i)
+            element->append_attribute(attribute_names[i], attribute_values[i]);
+        append_node(element);
+
+        if (!is_void)
+            m_stack_of_open_elements.append(element);
+        return true;
+    }
+
+    bool parse_attribute(Vector<FlyString>& names, Vector<String>& values)
+    {
+        auto raw_name = m_lexer.consume_while([](char c) {
+            return is_ascii_alphanumeric(c) || c == '-' || c == '_' || c == ':' || c == '.';
+        });
+        if (raw_name.is_empty())
+            return false;
+        auto name = FlyString::from_utf8_without_validation(raw_name.bytes()).to_ascii_lowercase();
+
+        // Custom element definitions would need to be looked up for elements with an "is" attribute.
+        if (name == AttributeNames::is)
+            return false;
+        // The full parser drops duplicate attributes.
+        if (names.contains_slow(name))
+            return false;
+
+        String value;
+        m_lexer.ignore_while(is_html_whitespace);
+        if (m_lexer.consume_specific('=')) {
+            m_lexer.ignore_while(is_html_whitespace);
+            auto parsed_value = parse_attribute_value();
+            if (!parsed_value.has_value())
+                return false;
+            value = parsed_value.release_value();
+        }
+
+        // What follows must be the end of the tag or the next attribute.
+        auto next = m_lexer.peek();
+        if (next != '>' && next != '/' && !is_html_whitespace(next) && !is_ascii_alpha(next))
+            return false;
+
+        names.append(move(name));
+        values.append(move(value));
+        return true;
+    }
+
+    Optional<String> parse_attribute_value()
+    {
+        StringBuilder builder;
+        auto quote = m_lexer.peek();
+        if (quote == '"' || quote == '\'') {
+            m_lexer.ignore();
+            while (true) {
+                if (m_lexer.is_eof())
+                    return {};
+                auto c = m_lexer.peek();
+                if (c == quote) {
+                    m_lexer.ignore();
+                    break;
+                }
+                if (c == '&') {
+                    if (!consume_character_reference(builder, InAttribute::Yes))
+                        return {};
+                    continue;
+                }
+                if (c == '\0' || c == '\r')
+                    return {};
+                builder.append(m_lexer.consume());
+            }
+            // A quoted value must be followed by whitespace or the end of the tag.
+            auto next = m_lexer.peek();
+            if (next != '>' && next != '/' && !is_html_whitespace(next))
+                return {};
+            return builder.to_string_without_validation();
+        }
+
+        auto unquoted = m_lexer.consume_while([](char c) { return c != '>' && !is_html_whitespace(c); });
+        if (unquoted.is_empty())
+            return {};
+        for (auto c : unquoted) {
+            if (c == '"' || c == '\'' || c == '<' || c == '=' || c == '`' || c == '&' || c == '\0' || c == '\r')
+                return {};
+        }
+        // A trailing slash would be part of the value rather than a self-closing flag.
+        if (unquoted.ends_with('/'))
+            return {};
+        return String::from_utf8_without_validation(unquoted.bytes());
+    }
+
+    bool parse_end_tag()
+    {
+        m_lexer.ignore(2);
+        auto tag_name = consume_tag_name();
+        if (!tag_name.has_value())
+            return false;
+        m_lexer.ignore_while(is_html_whitespace);
+        if (!m_lexer.consume_specific('>'))
+            return false;
+
+        // Anything other than closing the current node involves implied end tags, ignored tags or the adoption agency algorithm.
+        if (m_stack_of_open_elements.is_empty() || m_stack_of_open_elements.last()->local_name() != *tag_name)
+            return false;
+        m_stack_of_open_elements.take_last();
+        return true;
+    }
+
+    // https://html.spec.whatwg.org/multipage/parsing.html#character-reference-state
+    bool consume_character_reference(StringBuilder& builder, InAttribute in_attribute)
+    {
+        VERIFY(m_lexer.next_is('&'));
+        auto next = m_lexer.peek(1);
+
+        if (next == '#')
+            return consume_numeric_character_reference(builder);
+
+        if (!is_ascii_alphanumeric(next)) {
+            builder.append(m_lexer.consume());
+            return true;
+        }
+
+        // https://html.spec.whatwg.org/multipage/parsing.html#named-character-reference-state
+        NamedCharacterReferenceMatcher matcher;
+        size_t consumed = 0;
+        auto remaining = m_lexer.remaining().substring_view(1);
+        while (consumed < remaining.length() && matcher.try_consume_ascii_char(remaining[consumed]))
+            ++consumed;
+        consumed -= matcher.overconsumed_code_points();
+
+        auto code_points = matcher.code_points();
+        if (!code_points.has_value()) {
+            // Ambiguous ampersand: the ampersand and what follows are kept as they are.
+            builder.append(m_lexer.consume());
+            return true;
+        }
+
+        if (in_attribute == InAttribute::Yes && !matcher.last_match_ends_with_semicolon()) {
+            auto following = consumed < remaining.length() ? remaining[consumed] : '\0';
+            if (following == '=' || is_ascii_alphanumeric(following)) {
+                // For historical reasons, the reference is kept as it is.
+                builder.append(m_lexer.consume());
+                return true;
+            }
+        }
+
+        m_lexer.ignore(1 + consumed);
+        builder.append_code_point(code_points->first);
+        if (auto second_code_point = named_character_reference_second_codepoint_value(code_points->second); second_code_point.has_value())
+            builder.append_code_point(*second_code_point);
+        return true;
+    }
+
+    // https://html.spec.whatwg.org/multipage/parsing.html#numeric-character-reference-state
+    bool consume_numeric_character_reference(StringBuilder& builder)
+    {
+        m_lexer.ignore(2);
+        bool is_hexadecimal = m_lexer.consume_specific('x') || m_lexer.consume_specific('X');
+        auto digits = m_lexer.consume_while([&](char c) { return is_hexadecimal ? is_ascii_hex_digit(c) : is_ascii_digit(c); });
+        if (digits.is_empty() || digits.length() > 8)
+            return false;
+        m_lexer.consume_specific(';');
+
+        u32 code_point = 0;
+        for (auto c : digits)
+            code_point = code_point * (is_hexadecimal ? 16 : 10) + parse_ascii_hex_digit(c);
+
+        // Other values are either replaced or remapped by the numeric character reference end state.
+        bool passes_through_unchanged = code_point == '\t' || code_point == '\n' || code_point == '\f'
+            || (code_point >= 0x20 && code_point <= 0x7E)
+            || (code_point >= 0xA0 && code_point <= 0xD7FF)
+            || (code_point >= 0xE000 && code_point <= 0x10FFFF);
+        if (!passes_through_unchanged)
+            return false;
+
+        builder.append_code_point(code_point);
+        return true;
+    }
+
+    void append_node(GC::Ref<DOM::Node> node)
+    {
+        if (m_stack_of_open_elements.is_empty()) {
+            m_top_level_nodes.append(GC::make_root(*node));
+            return;
+        }
+        MUST(m_stack_of_open_elements.last()->append_child(node));
+    }
+
+    bool has_open_element(FlyString const& tag_name) const
+    {
+        // NOTE: None of the elements we accept is a scope boundary, so an open element is always in (button) scope.
+        return any_of(m_stack_of_open_elements, [&](auto const& element) { return element->local_name() == tag_name; });
+    }
+
+    GC::Ref<DOM::Document> m_document;
+    GenericLexer m_lexer;
+    bool m_form_element_pointer_is_set { false };
+
+    // NOTE: Every open element is a descendant of one of the rooted top-level nodes, which keeps it alive.
+    Vector<GC::Ref<DOM::Element>> m_stack_of_open_elements;
+    Vector<GC::Root<DOM::Node>> m_top_level_nodes;
+};
+
+Optional<Vector<GC::Root<DOM::Node>>> try_parse_html_fragment_fast_path(DOM::Element& context_element, StringView markup)
+{
+    if (!is_supported_context_element(context_element))
+        return {};
+
+    // The full parser would replace invalid sequences with U+FFFD.
+    if (!Utf8View { markup }.validate())
+        return {};
+
+    // NOTE: The nodes are created directly in the context element's document, which is where the full algorithm
+    //       adopts them to once it is done.
+    bool form_element_pointer_is_set = context_element.first_ancestor_of_type<HTMLFormElement>() != nullptr;
+    FragmentFastPathParser parser { context_element.document(), markup, form_element_pointer_is_set };
+    if (!parser.parse())
+        return {};
+    return parser.take_top_level_nodes();
+}
+
+}
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/StringView.h>
+#include <AK/Vector.h>
+#include <LibGC/Root.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+// Builds the result of the HTML fragment parsing algorithm directly, without setting up a temporary document and a
+// full parser, for the common subset of markup whose tree construction is trivial: properly nested phrasing,
+// formatting and block elements with plain attributes and text. Returns an empty Optional if markup falls outside
+// that subset, in which case the caller must run the full algorithm instead.
+Optional<Vector<GC::Root<DOM::Node>>> try_parse_html_fragment_fast_path(DOM::Element& context_element, StringView markup);
+
+}
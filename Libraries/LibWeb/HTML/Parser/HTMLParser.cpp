@@ -10,6 +10,7 @@
 #include <AK/SourceLocation.h>
 #include <AK/Utf32View.h>
 #include <LibTextCodec/Decoder.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/CSS/StyleValues/LengthStyleValue.h>
@@ -36,7 +37,9 @@
 #include <LibWeb/HTML/HTMLTableElement.h>
 #include <LibWeb/HTML/HTMLTemplateElement.h>
 #include <LibWeb/HTML/Parser/HTMLEncodingDetection.h>
+#include <LibWeb/HTML/Parser/HTMLFragmentFastPath.h>
 #include <LibWeb/HTML/Parser/HTMLParser.h>
+#include <LibWeb/HTML/Parser/HTMLPreloadScanner.h>
 #include <LibWeb/HTML/Parser/HTMLToken.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/Scripting/SimilarOriginWindowAgent.h>
@@ -157,7 +160,12 @@ static bool is_html_integration_point(DOM::Element const& element)
 }
 
 HTMLParser::HTMLParser(DOM::Document& document, StringView input, StringView encoding)
-    : m_tokenizer(input, encoding)
+    : HTMLParser(document, HTMLTokenizer::decode_input(input, encoding), encoding)
+{
+}
+
+HTMLParser::HTMLParser(DOM::Document& document, HTMLTokenizer::DecodedInput input, StringView encoding)
+    : m_tokenizer(move(input))
     , m_scripting_enabled(document.is_scripting_enabled())
     , m_document(document)
 {
@@ -263,6 +271,12 @@ void HTMLParser::run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point
     }
 
     flush_character_insertions();
+
+    // NOTE: Once parsing has stopped, the tokenizer will not produce any more tokens. The parser itself stays alive until
+    //       the load event has fired (and beyond, if anything else holds on to it), so free the decoded input right away.
+    //       The document keeps its own reference to the source text.
+    if (m_stop_parsing)
+        m_tokenizer.release_input();
 }
 
 void HTMLParser::run(const URL::URL& url, HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point)
@@ -3199,6 +3213,19 @@ void HTMLParser::decrement_script_nesting_level()
     --m_script_nesting_level;
 }
 
+// https://html.spec.whatwg.org/multipage/parsing.html#start-the-speculative-html-parser
+void HTMLParser::start_the_speculative_html_parser()
+{
+    // NOTE: Instead of building a speculative mock tree, we only scan the remaining input for resources to fetch.
+    //       The input only grows through document.write(), so unless it did, the last scan already covered it.
+    if (m_input_length_at_last_speculative_parse == m_tokenizer.input_length())
+        return;
+    m_input_length_at_last_speculative_parse = m_tokenizer.input_length();
+
+    HTMLPreloadScanner scanner { *m_document, m_speculatively_fetched_urls };
+    scanner.scan(m_tokenizer.unconsumed_input());
+}
+
 // https://html.spec.whatwg.org/multipage/parsing.html#parsing-main-incdata
 void HTMLParser::handle_text(HTMLToken& token)
 {
@@ -3293,7 +3320,8 @@ void HTMLParser::handle_text(HTMLToken& token)
                     // 2. Set the pending parsing-blocking script to null.
                     auto the_script = document().take_pending_parsing_blocking_script({});
 
-                    // FIXME: 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    // 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    start_the_speculative_html_parser();
 
                     // 4. Block the tokenizer for this instance of the HTML parser, such that the event loop will not run tasks that invoke the tokenizer.
                     m_tokenizer.set_blocked(true);
@@ -3312,7 +3340,8 @@ void HTMLParser::handle_text(HTMLToken& token)
                     if (m_aborted)
                         return;
 
-                    // FIXME: 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // NOTE: The speculative parser runs to completion when it is started, so there's nothing to stop.
 
                     // 8. Unblock the tokenizer for this instance of the HTML parser, such that tasks that invoke the tokenizer can again be run.
                     m_tokenizer.set_blocked(false);
@@ -4998,6 +5027,11 @@ DOM::Document& HTMLParser::document()
 // https://html.spec.whatwg.org/multipage/parsing.html#parsing-html-fragments
 Vector<GC::Root<DOM::Node>> HTMLParser::parse_html_fragment(DOM::Element& context_element, StringView markup, AllowDeclarativeShadowRoots allow_declarative_shadow_roots)
 {
+    // OPTIMIZATION: Most fragments (e.g. from templating code) are simple, properly nested markup that can be turned
+    //               into nodes directly, without setting up a temporary document and a full parser.
+    if (auto children = try_parse_html_fragment_fast_path(context_element, markup); children.has_value())
+        return children.release_value();
+
     // 1. Let document be a Document node whose type is "html".
     auto temp_document = DOM::Document::create_for_fragment_parsing(context_element.realm());
     temp_document->set_document_type(DOM::Document::Type::HTML);
@@ -5113,6 +5147,36 @@ GC::Ref<HTMLParser> HTMLParser::create_with_uncertain_encoding(DOM::Document& do
     return document.realm().create<HTMLParser>(document, input, encoding);
 }
 
+void HTMLParser::create_with_uncertain_encoding_async(DOM::Document& document, ByteBuffer input, Optional<MimeSniff::MimeType> maybe_mime_type, Function<void(GC::Ref<HTMLParser>)> on_complete)
+{
+    // Below this size, decoding is cheap enough that a round trip to the background thread isn't worth it.
+    static constexpr size_t minimum_size_for_background_decoding = 1 * MiB;
+
+    if (input.size() < minimum_size_for_background_decoding) {
+        on_complete(create_with_uncertain_encoding(document, input, move(maybe_mime_type)));
+        return;
+    }
+
+    // Sniffing the encoding only looks at the start of the input, but needs the document, so it stays on this thread.
+    ByteString encoding;
+    if (document.has_encoding()) {
+        encoding = document.encoding().value().to_byte_string();
+    } else {
+        encoding = run_encoding_sniffing_algorithm(document, input, maybe_mime_type);
+        dbgln_if(HTML_PARSER_DEBUG, "The encoding sniffing algorithm returned encoding '{}'", encoding);
+    }
+
+    (void)Threading::BackgroundAction<HTMLTokenizer::DecodedInput>::construct(
+        [input = move(input), encoding](auto&) -> ErrorOr<HTMLTokenizer::DecodedInput> {
+            return HTMLTokenizer::decode_input(input, encoding);
+        },
+        [document = GC::make_root(document), encoding, on_complete = move(on_complete)](HTMLTokenizer::DecodedInput decoded_input) -> ErrorOr<void> {
+            on_complete(document->realm().create<HTMLParser>(*document, move(decoded_input), encoding));
+            return {};
+        },
+        OptionalNone {}, Threading::BackgroundActionPriority::High);
+}
+
 GC::Ref<HTMLParser> HTMLParser::create(DOM::Document& document, StringView input, StringView encoding)
 {
     return document.realm().create<HTMLParser>(document, input, encoding);
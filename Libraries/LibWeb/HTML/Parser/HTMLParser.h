@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <AK/HashTable.h>
 #include <LibGfx/Color.h>
 #include <LibJS/Heap/Cell.h>
+#include <LibURL/URL.h>
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/HTML/Parser/HTMLTokenizer.h>
 #include <LibWeb/HTML/Parser/ListOfActiveFormattingElements.h>
@@ -62,6 +64,10 @@ public:
 
     static GC::Ref<HTMLParser> create_for_scripting(DOM::Document&);
     static GC::Ref<HTMLParser> create_with_uncertain_encoding(DOM::Document&, ByteBuffer const& input, Optional<MimeSniff::MimeType> maybe_mime_type = {});
+
+    // Like create_with_uncertain_encoding(), but large inputs are decoded on a background thread. on_complete is
+    // always invoked on the main thread, synchronously if the input was small enough to be decoded right away.
+    static void create_with_uncertain_encoding_async(DOM::Document&, ByteBuffer input, Optional<MimeSniff::MimeType>, Function<void(GC::Ref<HTMLParser>)> on_complete);
     static GC::Ref<HTMLParser> create(DOM::Document&, StringView input, StringView encoding);
 
     void run(HTMLTokenizer::StopAtInsertionPoint = HTMLTokenizer::StopAtInsertionPoint::No);
@@ -103,6 +109,7 @@ public:
 
 private:
     HTMLParser(DOM::Document&, StringView input, StringView encoding);
+    HTMLParser(DOM::Document&, HTMLTokenizer::DecodedInput, StringView encoding);
     HTMLParser(DOM::Document&);
 
     virtual void visit_edges(Cell::Visitor&) override;
@@ -172,6 +179,7 @@ private:
     void increment_script_nesting_level();
     void decrement_script_nesting_level();
     void reset_the_insertion_mode_appropriately();
+    void start_the_speculative_html_parser();
 
     void adjust_mathml_attributes(HTMLToken&);
     void adjust_svg_tag_names(HTMLToken&);
@@ -212,6 +220,11 @@ private:
     bool m_aborted { false };
     bool m_parser_pause_flag { false };
     bool m_stop_parsing { false };
+
+    // The URLs fetched by the speculative HTML parser, and how much input there was when it last ran, so that the
+    // same input isn't scanned again while the parser blocks on each of its scripts.
+    HashTable<URL::URL> m_speculatively_fetched_urls;
+    Optional<size_t> m_input_length_at_last_speculative_parse;
     size_t m_script_nesting_level { 0 };
 
     JS::Realm& realm();
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/Parser/HTMLPreloadScanner.h>
+#include <LibWeb/HTML/Parser/HTMLToken.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+#include <LibWeb/HTML/PotentialCORSRequest.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Infra/CharacterTypes.h>
+#include <LibWeb/Loader/ResourceLoader.h>
+#include <LibWeb/MimeSniff/MimeType.h>
+
+namespace Web::Fetch::Fetching {
+
+extern bool g_http_cache_enabled;
+
+}
+
+namespace Web::HTML {
+
+HTMLPreloadScanner::HTMLPreloadScanner(DOM::Document& document, HashTable<URL::URL>& speculatively_fetched_urls)
+    : m_document(document)
+    , m_speculatively_fetched_urls(speculatively_fetched_urls)
+    , m_base_url(document.base_url())
+{
+}
+
+void HTMLPreloadScanner::scan(StringView input)
+{
+    HTMLTokenizer tokenizer { input, "utf-8" };
+
+    for (;;) {
+        auto token = tokenizer.next_token();
+        if (!token.has_value() || token->is_end_of_file())
+            break;
+
+        if (token->is_start_tag()) {
+            process_start_tag(*token, tokenizer);
+            continue;
+        }
+
+        if (token->is_end_tag()) {
+            auto const& tag_name = token->tag_name();
+            if (tag_name == TagNames::template_ && m_template_depth > 0)
+                --m_template_depth;
+            else if (tag_name.is_one_of(TagNames::svg, TagNames::math) && m_foreign_content_depth > 0)
+                --m_foreign_content_depth;
+        }
+    }
+}
+
+void HTMLPreloadScanner::process_start_tag(HTMLToken const& token, HTMLTokenizer& tokenizer)
+{
+    using Destination = Fetch::Infrastructure::Request::Destination;
+    using Priority = Fetch::Infrastructure::Request::Priority;
+
+    auto const& tag_name = token.tag_name();
+
+    if (tag_name.is_one_of(TagNames::svg, TagNames::math)) {
+        if (!token.is_self_closing())
+            ++m_foreign_content_depth;
+        return;
+    }
+
+    // Inside foreign content, the tree builder doesn't switch the tokenizer into the text states, and elements
+    // with HTML tag names aren't HTML elements.
+    if (m_foreign_content_depth > 0)
+        return;
+
+    // Mirror the tokenizer state changes the tree builder makes for these elements, so that their contents aren't
+    // mistaken for markup.
+    if (tag_name == TagNames::script)
+        tokenizer.switch_to(HTMLTokenizer::State::ScriptData);
+    else if (tag_name.is_one_of(TagNames::title, TagNames::textarea))
+        tokenizer.switch_to(HTMLTokenizer::State::RCDATA);
+    else if (tag_name.is_one_of(TagNames::style, TagNames::xmp, TagNames::iframe, TagNames::noembed, TagNames::noframes)
+        || (tag_name == TagNames::noscript && m_document->is_scripting_enabled()))
+        tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+    else if (tag_name == TagNames::plaintext)
+        tokenizer.switch_to(HTMLTokenizer::State::PLAINTEXT);
+
+    if (tag_name == TagNames::template_) {
+        ++m_template_depth;
+        return;
+    }
+
+    // Template contents are inert, so nothing inside them is fetched.
+    if (m_template_depth > 0)
+        return;
+
+    auto cors_setting = cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin));
+
+    if (tag_name == TagNames::base) {
+        // Only the first base element with an href attribute sets the document base URL.
+        if (m_seen_base_element)
+            return;
+        if (auto href = token.attribute(AttributeNames::href); href.has_value()) {
+            m_seen_base_element = true;
+            if (auto url = DOMURL::parse(*href, m_base_url, m_document->encoding_or_default()); url.has_value())
+                m_base_url = url.release_value();
+        }
+        return;
+    }
+
+    if (tag_name == TagNames::script) {
+        auto src = token.attribute(AttributeNames::src);
+        if (!src.has_value() || src->is_empty())
+            return;
+
+        auto type = token.attribute(AttributeNames::type).map([](auto const& type) {
+            return MUST(type.trim(Infra::ASCII_WHITESPACE));
+        });
+        if (type.has_value() && type->equals_ignoring_ascii_case("module"sv)) {
+            // Module scripts are always fetched in CORS mode, omitting credentials only when asked to.
+            if (cors_setting == CORSSettingAttribute::NoCORS)
+                cors_setting = CORSSettingAttribute::Anonymous;
+        } else if (type.has_value() && !type->is_empty() && !MimeSniff::is_javascript_mime_type_essence_match(*type)) {
+            return;
+        } else if (token.has_attribute(AttributeNames::nomodule)) {
+            return;
+        }
+
+        speculatively_fetch(*src, Destination::Script, cors_setting, Priority::High);
+        return;
+    }
+
+    if (tag_name == TagNames::link) {
+        auto href = token.attribute(AttributeNames::href);
+        auto rel = token.attribute(AttributeNames::rel);
+        if (!href.has_value() || href->is_empty() || !rel.has_value())
+            return;
+
+        bool is_stylesheet = false;
+        bool is_alternate = false;
+        for (auto keyword : rel->bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace)) {
+            if (keyword.equals_ignoring_ascii_case("stylesheet"sv))
+                is_stylesheet = true;
+            else if (keyword.equals_ignoring_ascii_case("alternate"sv))
+                is_alternate = true;
+        }
+        if (is_stylesheet && !is_alternate)
+            speculatively_fetch(*href, Destination::Style, cors_setting, Priority::High);
+        return;
+    }
+
+    if (tag_name == TagNames::img) {
+        // Which candidate a srcset selects depends on layout, so only plain sources are fetched ahead of time.
+        if (token.has_attribute(AttributeNames::srcset))
+            return;
+        if (auto src = token.attribute(AttributeNames::src); src.has_value() && !src->is_empty())
+            speculatively_fetch(*src, Destination::Image, cors_setting, Priority::Low);
+        return;
+    }
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-fetch
+void HTMLPreloadScanner::speculatively_fetch(StringView url_string, Fetch::Infrastructure::Request::Destination destination, CORSSettingAttribute cors_setting, Fetch::Infrastructure::Request::Priority priority)
+{
+    auto url = DOMURL::parse(url_string, m_base_url, m_document->encoding_or_default());
+    if (!url.has_value() || !url->scheme().is_one_of("http"sv, "https"sv))
+        return;
+    if (m_speculatively_fetched_urls.set(*url) != HashSetResult::InsertedNewEntry)
+        return;
+
+    // Without an HTTP cache, a speculatively fetched response could not be reused by the real fetch, so only get a
+    // connection to the resource's origin ready instead.
+    if (!Fetch::Fetching::g_http_cache_enabled) {
+        if (!url->origin().is_same_origin(m_document->origin()))
+            ResourceLoader::the().preconnect(*url);
+        return;
+    }
+
+    auto& realm = m_document->realm();
+    auto& vm = realm.vm();
+
+    auto request = create_potential_CORS_request(vm, *url, destination, cors_setting);
+    request->set_client(&m_document->relevant_settings_object());
+    request->set_priority(priority);
+
+    (void)Fetch::Fetching::fetch(realm, request, Fetch::Infrastructure::FetchAlgorithms::create(vm, {}));
+}
+
+}
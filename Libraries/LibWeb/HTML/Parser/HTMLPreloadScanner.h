@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashTable.h>
+#include <AK/StringView.h>
+#include <LibGC/Ptr.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/HTML/CORSSettingAttribute.h>
+
+namespace Web::HTML {
+
+class HTMLToken;
+class HTMLTokenizer;
+
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-html-parsing
+// While the parser is blocked on a parser-blocking script, tokenizes the rest of the input with a separate tokenizer
+// and starts fetching the scripts, style sheets and images it finds, so that they are not only discovered once the
+// script has run. This is a short-lived stack object; the URLs already fetched are remembered by the parser.
+class HTMLPreloadScanner {
+    AK_MAKE_NONCOPYABLE(HTMLPreloadScanner);
+    AK_MAKE_NONMOVABLE(HTMLPreloadScanner);
+
+public:
+    HTMLPreloadScanner(DOM::Document&, HashTable<URL::URL>& speculatively_fetched_urls);
+
+    void scan(StringView input);
+
+private:
+    void process_start_tag(HTMLToken const&, HTMLTokenizer&);
+    void speculatively_fetch(StringView url, Fetch::Infrastructure::Request::Destination, CORSSettingAttribute, Fetch::Infrastructure::Request::Priority);
+
+    GC::Ref<DOM::Document> m_document;
+    HashTable<URL::URL>& m_speculatively_fetched_urls;
+    URL::URL m_base_url;
+    bool m_seen_base_element { false };
+    size_t m_template_depth { 0 };
+    size_t m_foreign_content_depth { 0 };
+};
+
+}
@@ -5,9 +5,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BuiltinWrappers.h>
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/GenericShorthands.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/SourceLocation.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/HTML/Parser/Entities.h>
@@ -237,6 +240,49 @@ void HTMLTokenizer::skip(size_t count)
     }
 }
 
+// Returns the length of the run at the start of input that contains none of the code points the quoted attribute
+// value states treat specially: the quote itself, '&', U+0000 and '\r', which input preprocessing normalizes.
+static size_t length_of_plain_attribute_value_run(ReadonlySpan<u32> input, u32 quote)
+{
+    using namespace AK::SIMD;
+
+    auto quotes = expand4(quote);
+    auto ampersands = expand4(static_cast<u32>('&'));
+    auto nulls = expand4(0u);
+    auto carriage_returns = expand4(static_cast<u32>('\r'));
+
+    size_t i = 0;
+    for (; i + 4 <= input.size(); i += 4) {
+        auto chunk = load_unaligned<u32x4>(&input[i]);
+        i32x4 matches = (chunk == quotes) | (chunk == ampersands) | (chunk == nulls) | (chunk == carriage_returns);
+        if (auto bits = maskbits(matches); bits != 0)
+            return i + count_trailing_zeroes(static_cast<u32>(bits));
+    }
+    for (; i < input.size(); ++i) {
+        if (first_is_one_of(input[i], quote, '&', 0u, '\r'))
+            return i;
+    }
+    return input.size();
+}
+
+void HTMLTokenizer::consume_plain_attribute_value_run(u32 quote, StopAtInsertionPoint stop_at_insertion_point)
+{
+    auto end = static_cast<ssize_t>(m_decoded_input.size());
+    if (stop_at_insertion_point == StopAtInsertionPoint::Yes && m_insertion_point.defined)
+        end = min(end, m_insertion_point.position);
+    if (m_current_offset >= end)
+        return;
+
+    auto input = m_decoded_input.span().slice(m_current_offset, end - m_current_offset);
+    auto run_length = length_of_plain_attribute_value_run(input, quote);
+    if (run_length == 0)
+        return;
+
+    for (auto code_point : input.trim(run_length))
+        m_current_builder.append_code_point(code_point);
+    skip(run_length);
+}
+
 Optional<u32> HTMLTokenizer::peek_code_point(ssize_t offset, StopAtInsertionPoint stop_at_insertion_point) const
 {
     auto it = m_current_offset + offset;
@@ -1315,6 +1361,7 @@ _StartOfFunction:
                 ANYTHING_ELSE
                 {
                     m_current_builder.append_code_point(current_input_character.value());
+                    consume_plain_attribute_value_run('"', stop_at_insertion_point);
                     continue;
                 }
             }
@@ -1347,6 +1394,7 @@ _StartOfFunction:
                 ANYTHING_ELSE
                 {
                     m_current_builder.append_code_point(current_input_character.value());
+                    consume_plain_attribute_value_run('\'', stop_at_insertion_point);
                     continue;
                 }
             }
@@ -2883,16 +2931,49 @@ HTMLTokenizer::HTMLTokenizer()
 }
 
 HTMLTokenizer::HTMLTokenizer(StringView input, ByteString const& encoding)
+    : HTMLTokenizer(decode_input(input, encoding))
+{
+}
+
+HTMLTokenizer::HTMLTokenizer(DecodedInput input)
+{
+    m_source = move(input.source);
+    m_decoded_input = move(input.code_points);
+    m_current_offset = 0;
+    m_prev_offset = 0;
+    m_source_positions.empend(0u, 0u);
+}
+
+HTMLTokenizer::DecodedInput HTMLTokenizer::decode_input(StringView input, StringView encoding)
 {
     auto decoder = TextCodec::decoder_for(encoding);
     VERIFY(decoder.has_value());
-    m_source = MUST(decoder->to_utf8(input));
-    m_decoded_input.ensure_capacity(m_source.bytes().size());
-    for (auto code_point : m_source.code_points())
-        m_decoded_input.append(code_point);
+
+    DecodedInput decoded_input;
+    decoded_input.source = MUST(decoder->to_utf8(input));
+    decoded_input.code_points.ensure_capacity(decoded_input.source.bytes().size());
+    for (auto code_point : decoded_input.source.code_points())
+        decoded_input.code_points.append(code_point);
+    return decoded_input;
+}
+
+String HTMLTokenizer::unconsumed_input() const
+{
+    StringBuilder builder;
+    for (auto code_point : m_decoded_input.span().slice(m_current_offset))
+        builder.append_code_point(code_point);
+    return MUST(builder.to_string());
+}
+
+void HTMLTokenizer::release_input()
+{
+    abort();
+    m_source = {};
+    m_decoded_input.clear();
     m_current_offset = 0;
     m_prev_offset = 0;
-    m_source_positions.empend(0u, 0u);
+    m_insertion_point = {};
+    m_old_insertion_point = {};
 }
 
 void HTMLTokenizer::insert_input_at_insertion_point(StringView input)
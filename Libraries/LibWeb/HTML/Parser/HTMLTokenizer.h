@@ -105,6 +105,14 @@ public:
     explicit HTMLTokenizer();
     explicit HTMLTokenizer(StringView input, ByteString const& encoding);
 
+    // Decoding doesn't touch any state, so large inputs can be decoded away from the main thread.
+    struct DecodedInput {
+        String source;
+        Vector<u32> code_points;
+    };
+    static DecodedInput decode_input(StringView input, StringView encoding);
+    explicit HTMLTokenizer(DecodedInput);
+
     enum class State {
 #define __ENUMERATE_TOKENIZER_STATE(state) state,
         ENUMERATE_TOKENIZER_STATES
@@ -130,6 +138,10 @@ public:
 
     auto const& source() const { return m_source; }
 
+    // The input that hasn't been consumed yet, including anything inserted by document.write().
+    String unconsumed_input() const;
+    size_t input_length() const { return m_decoded_input.size(); }
+
     void insert_input_at_insertion_point(StringView input);
     void insert_eof();
     bool is_eof_inserted();
@@ -151,8 +163,12 @@ public:
     // This permanently cuts off the tokenizer input stream.
     void abort() { m_aborted = true; }
 
+    // Like abort(), but also frees the input, for when the parser has stopped and won't ask for more tokens.
+    void release_input();
+
 private:
     void skip(size_t count);
+    void consume_plain_attribute_value_run(u32 quote, StopAtInsertionPoint);
     Optional<u32> next_code_point(StopAtInsertionPoint);
     Optional<u32> peek_code_point(ssize_t offset, StopAtInsertionPoint) const;
 
@@ -5,6 +5,9 @@
  */
 
 #include <LibCore/EventLoop.h>
+#include <LibCore/System.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibWeb/HTML/EventLoop/FrameTimings.h>
 #include <LibWeb/HTML/RenderingThread.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 
@@ -61,7 +64,19 @@ void RenderingThread::rendering_thread_loop()
             break;
         }
 
-        m_skia_player->execute(*task->display_list, task->scroll_state_snapshot, task->painting_surface);
+        if (!surface_already_contains(*task->display_list, task->scroll_state_snapshot, *task->painting_surface)) {
+            FrameTimings::Scope const replay_scope { FrameTimings::Stage::Replay, task->frame };
+            auto paint_rect = task->damage_rect.value_or(task->painting_surface->rect());
+            if (auto tile_count = tile_count_for(*task->display_list, *task->painting_surface, paint_rect); tile_count > 1) {
+                auto replay_duration = rasterize_in_tiles(*task->display_list, task->scroll_state_snapshot, *task->painting_surface, paint_rect, tile_count);
+                record_replay_cost(paint_rect, replay_duration);
+            } else {
+                auto replay_start = MonotonicTime::now();
+                m_skia_player->execute(*task->display_list, task->scroll_state_snapshot, task->painting_surface, task->damage_rect);
+                record_replay_cost(paint_rect, MonotonicTime::now() - replay_start);
+            }
+            remember_rendered_frame(task->display_list, task->scroll_state_snapshot, task->painting_surface);
+        }
         if (m_exit)
             break;
         m_main_thread_event_loop.deferred_invoke([callback = move(task->callback)] {
@@ -70,10 +85,116 @@ void RenderingThread::rendering_thread_loop()
     }
 }
 
-void RenderingThread::enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshot&& scroll_state_snapshot, NonnullRefPtr<Gfx::PaintingSurface> painting_surface, Function<void()>&& callback)
+bool RenderingThread::surface_already_contains(Painting::DisplayList const& display_list, Painting::ScrollStateSnapshot const& scroll_state_snapshot, Gfx::PaintingSurface const& painting_surface) const
+{
+    if (display_list.has_externally_updated_content())
+        return false;
+
+    for (auto const& frame : m_rendered_frames) {
+        if (frame.painting_surface.ptr() == &painting_surface)
+            return frame.display_list.ptr() == &display_list && frame.scroll_state_snapshot == scroll_state_snapshot;
+    }
+    return false;
+}
+
+size_t RenderingThread::tile_count_for(Painting::DisplayList const& display_list, Gfx::PaintingSurface const& painting_surface, Gfx::IntRect const& paint_rect)
+{
+    // GPU surfaces are rasterized by a single backend context, so tiling would only serialize on its lock.
+    if (m_skia_backend_context || !painting_surface.bitmap())
+        return 1;
+
+    // Canvas surfaces and nested display lists may be snapshotted while being replayed, which must not happen
+    // concurrently from several threads.
+    if (display_list.has_externally_updated_content())
+        return 1;
+
+    auto tile_count_by_height = static_cast<size_t>(paint_rect.height() / min_tile_height);
+    auto estimated_replay_nanoseconds = m_replay_nanoseconds_per_pixel * static_cast<double>(paint_rect.width()) * static_cast<double>(paint_rect.height());
+    auto tile_count_by_cost = static_cast<size_t>(estimated_replay_nanoseconds / static_cast<double>(min_tile_replay_duration.to_nanoseconds()));
+    auto tile_count = min(tile_count_by_height, tile_count_by_cost);
+    if (tile_count < 2)
+        return 1;
+
+    if (!m_tile_workers_initialized) {
+        m_tile_workers_initialized = true;
+        auto worker_count = max(Core::System::hardware_concurrency(), 1u) - 1;
+        for (unsigned i = 0; i < worker_count; ++i) {
+            auto thread = Threading::WorkerThread<Error>::create("Tile rasterizer"sv);
+            if (thread.is_error()) {
+                dbgln("Failed to create tile rasterizer thread: {}", thread.error());
+                break;
+            }
+            m_tile_workers.append({ make<Painting::DisplayListPlayerSkia>(), thread.release_value(), {} });
+        }
+    }
+
+    return min(tile_count, m_tile_workers.size() + 1);
+}
+
+AK::Duration RenderingThread::rasterize_in_tiles(Painting::DisplayList& display_list, Painting::ScrollStateSnapshot const& scroll_state_snapshot, Gfx::PaintingSurface& painting_surface, Gfx::IntRect const& paint_rect, size_t tile_count)
+{
+    VERIFY(tile_count > 1 && tile_count <= m_tile_workers.size() + 1);
+
+    auto tile_height = ceil_div(paint_rect.height(), static_cast<int>(tile_count));
+    auto tile_rect_for = [&](size_t index) {
+        auto tile_rect = paint_rect;
+        tile_rect.set_y(paint_rect.y() + static_cast<int>(index) * tile_height);
+        tile_rect.set_height(min(tile_height, paint_rect.bottom() - tile_rect.y()));
+        return tile_rect;
+    };
+
+    // Every band gets its own surface wrapping the same pixels, and is clipped to its own rows, so the workers
+    // never write to the same memory.
+    auto bitmap = painting_surface.bitmap();
+    for (size_t i = 1; i < tile_count; ++i) {
+        auto tile_surface = Gfx::PaintingSurface::wrap_bitmap(*bitmap);
+        auto& worker = m_tile_workers[i - 1];
+        auto started = worker.thread->start_task([&worker, &display_list, &scroll_state_snapshot, tile_surface = move(tile_surface), tile_rect = tile_rect_for(i)]() -> ErrorOr<void> {
+            auto replay_start = MonotonicTime::now();
+            worker.player->execute(display_list, scroll_state_snapshot, tile_surface, tile_rect);
+            worker.replay_duration = MonotonicTime::now() - replay_start;
+            return {};
+        });
+        VERIFY(started);
+    }
+
+    auto replay_start = MonotonicTime::now();
+    m_skia_player->execute(display_list, scroll_state_snapshot, painting_surface, tile_rect_for(0));
+    auto replay_duration = MonotonicTime::now() - replay_start;
+
+    // The cost that matters for the next decision is the total work, not how long we waited for it.
+    for (size_t i = 1; i < tile_count; ++i) {
+        auto& worker = m_tile_workers[i - 1];
+        MUST(worker.thread->wait_until_task_is_finished());
+        replay_duration += worker.replay_duration;
+    }
+
+    painting_surface.flush();
+    return replay_duration;
+}
+
+void RenderingThread::record_replay_cost(Gfx::IntRect const& paint_rect, AK::Duration replay_duration)
+{
+    auto pixel_count = static_cast<double>(paint_rect.width()) * static_cast<double>(paint_rect.height());
+    if (pixel_count <= 0)
+        return;
+    m_replay_nanoseconds_per_pixel = static_cast<double>(replay_duration.to_nanoseconds()) / pixel_count;
+}
+
+void RenderingThread::remember_rendered_frame(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshot const& scroll_state_snapshot, NonnullRefPtr<Gfx::PaintingSurface> painting_surface)
+{
+    m_rendered_frames.remove_first_matching([&](auto const& frame) {
+        return frame.painting_surface == painting_surface;
+    });
+    if (m_rendered_frames.size() == max_remembered_frames)
+        m_rendered_frames.take_first();
+    m_rendered_frames.append({ move(display_list), scroll_state_snapshot, move(painting_surface) });
+}
+
+void RenderingThread::enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshot&& scroll_state_snapshot, NonnullRefPtr<Gfx::PaintingSurface> painting_surface, Optional<Gfx::IntRect> damage_rect, Function<void()>&& callback)
 {
     Threading::MutexLocker const locker { m_rendering_task_mutex };
-    m_rendering_tasks.enqueue(Task { move(display_list), move(scroll_state_snapshot), move(painting_surface), move(callback) });
+    m_rendering_tasks.enqueue(Task { move(display_list), move(scroll_state_snapshot), move(painting_surface), damage_rect, move(callback), FrameTimings::the().current_frame() });
     m_rendering_task_ready_wake_condition.signal();
 }
 
@@ -8,10 +8,12 @@
 
 #include <AK/Noncopyable.h>
 #include <AK/Queue.h>
+#include <AK/Time.h>
 #include <LibCore/Promise.h>
 #include <LibThreading/ConditionVariable.h>
 #include <LibThreading/Mutex.h>
 #include <LibThreading/Thread.h>
+#include <LibThreading/WorkerThread.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
@@ -29,10 +31,15 @@ public:
     void start(DisplayListPlayerType);
     void set_skia_player(OwnPtr<Painting::DisplayListPlayerSkia>&& player) { m_skia_player = move(player); }
     void set_skia_backend_context(RefPtr<Gfx::SkiaBackendContext> context) { m_skia_backend_context = move(context); }
-    void enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList>, Painting::ScrollStateSnapshot&&, NonnullRefPtr<Gfx::PaintingSurface>, Function<void()>&& callback);
+    void enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList>, Painting::ScrollStateSnapshot&&, NonnullRefPtr<Gfx::PaintingSurface>, Optional<Gfx::IntRect> damage_rect, Function<void()>&& callback);
 
 private:
     void rendering_thread_loop();
+    bool surface_already_contains(Painting::DisplayList const&, Painting::ScrollStateSnapshot const&, Gfx::PaintingSurface const&) const;
+    size_t tile_count_for(Painting::DisplayList const&, Gfx::PaintingSurface const&, Gfx::IntRect const& paint_rect);
+    AK::Duration rasterize_in_tiles(Painting::DisplayList&, Painting::ScrollStateSnapshot const&, Gfx::PaintingSurface&, Gfx::IntRect const& paint_rect, size_t tile_count);
+    void record_replay_cost(Gfx::IntRect const& paint_rect, AK::Duration);
+    void remember_rendered_frame(NonnullRefPtr<Painting::DisplayList>, Painting::ScrollStateSnapshot const&, NonnullRefPtr<Gfx::PaintingSurface>);
 
     Core::EventLoop& m_main_thread_event_loop;
     DisplayListPlayerType m_display_list_player_type;
@@ -48,13 +55,45 @@ private:
         NonnullRefPtr<Painting::DisplayList> display_list;
         Painting::ScrollStateSnapshot scroll_state_snapshot;
         NonnullRefPtr<Gfx::PaintingSurface> painting_surface;
+        Optional<Gfx::IntRect> damage_rect;
         Function<void()> callback;
+        u64 frame { 0 };
     };
     // NOTE: Queue will only contain multiple items in case tasks were scheduled by screenshot requests.
     //       Otherwise, it will contain only one item at a time.
     Queue<Task> m_rendering_tasks;
     Threading::Mutex m_rendering_task_mutex;
     Threading::ConditionVariable m_rendering_task_ready_wake_condition { m_rendering_task_mutex };
+
+    // The last frame rasterized into each of the most recently used surfaces. Backing stores are reused across
+    // frames, so a surface that was last given the same display list and scroll state doesn't need to be repainted.
+    // NOTE: This is only accessed from the rendering thread.
+    struct RenderedFrame {
+        NonnullRefPtr<Painting::DisplayList> display_list;
+        Painting::ScrollStateSnapshot scroll_state_snapshot;
+        NonnullRefPtr<Gfx::PaintingSurface> painting_surface;
+    };
+    static constexpr size_t max_remembered_frames = 2;
+    Vector<RenderedFrame, max_remembered_frames> m_rendered_frames;
+
+    // Expensive replays into large CPU-backed surfaces (such as full page screenshots) are split into horizontal bands
+    // that are rasterized in parallel. The first band is painted by m_skia_player on the rendering thread, and every
+    // other band by its own worker. Each worker keeps its player, and with it the player's caches, across frames, and
+    // is always given the same band, so it mostly paints the same content as last time.
+    // NOTE: This is only accessed from the rendering thread.
+    struct TileWorker {
+        NonnullOwnPtr<Painting::DisplayListPlayerSkia> player;
+        NonnullOwnPtr<Threading::WorkerThread<Error>> thread;
+        AK::Duration replay_duration;
+    };
+    static constexpr int min_tile_height = 256;
+    Vector<TileWorker> m_tile_workers;
+    bool m_tile_workers_initialized { false };
+
+    // Whether to split a replay is decided from the measured cost of the previous one, per painted pixel. Every band
+    // has to be expected to take at least this long, or waking up the workers would cost more than it saves.
+    static constexpr AK::Duration min_tile_replay_duration = AK::Duration::from_milliseconds(4);
+    double m_replay_nanoseconds_per_pixel { 0 };
 };
 
 }
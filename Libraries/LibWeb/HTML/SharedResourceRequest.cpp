@@ -47,6 +47,7 @@ SharedResourceRequest::~SharedResourceRequest() = default;
 void SharedResourceRequest::finalize()
 {
     Base::finalize();
+    m_incremental_decoder = nullptr;
     auto& shared_resource_requests = m_document->shared_resource_requests();
     shared_resource_requests.remove(m_url);
 }
@@ -60,8 +61,11 @@ void SharedResourceRequest::visit_edges(JS::Cell::Visitor& visitor)
     for (auto& callback : m_callbacks) {
         visitor.visit(callback.on_finish);
         visitor.visit(callback.on_fail);
+        visitor.visit(callback.on_partial_image);
+        visitor.visit(callback.decode_priority);
     }
     visitor.visit(m_image_data);
+    visitor.visit(m_partial_image_data);
 }
 
 GC::Ptr<DecodedImageData> SharedResourceRequest::image_data() const
@@ -69,6 +73,17 @@ GC::Ptr<DecodedImageData> SharedResourceRequest::image_data() const
     return m_image_data;
 }
 
+void SharedResourceRequest::keep_decoded_image_resident()
+{
+    if (m_keeps_decoded_image_resident)
+        return;
+    m_keeps_decoded_image_resident = true;
+
+    // NOTE: If the image has already been decoded, hold on to it the same way an element that has it near its viewport would.
+    if (m_image_data)
+        m_image_data->did_enter_viewport();
+}
+
 GC::Ptr<Fetch::Infrastructure::FetchController> SharedResourceRequest::fetch_controller()
 {
     return m_fetch_controller.ptr();
@@ -79,6 +94,15 @@ void SharedResourceRequest::set_fetch_controller(GC::Ptr<Fetch::Infrastructure::
     m_fetch_controller = move(fetch_controller);
 }
 
+// Partial images are decoded by starting over from the beginning of the data, so we only pass new data along to the
+// decoder in chunks of at least this size.
+static constexpr size_t minimum_incremental_decode_chunk_size = 16 * KiB;
+
+static bool can_decode_incrementally(StringView mime_type)
+{
+    return mime_type.is_one_of("image/jpeg"sv, "image/png"sv);
+}
+
 void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infrastructure::Request> request)
 {
     Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
@@ -102,6 +126,26 @@ void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infr
             return;
         }
 
+        auto extracted_mime_type = response->header_list()->extract_mime_type();
+        if (extracted_mime_type.has_value() && can_decode_incrementally(extracted_mime_type->essence().bytes_as_string_view())) {
+            m_incremental_decoder = Platform::ImageCodecPlugin::the().start_incremental_decode([this](NonnullRefPtr<Gfx::Bitmap> bitmap, Gfx::ColorSpace color_space) {
+                handle_partial_image(move(bitmap), move(color_space));
+            });
+        }
+
+        // OPTIMIZATION: Read images that can be shown before they have finished loading as their data arrives.
+        if (m_incremental_decoder) {
+            auto process_body_chunk = GC::create_function(heap(), [this](ByteBuffer chunk) {
+                handle_body_chunk(move(chunk));
+            });
+            auto process_end_of_body = GC::create_function(heap(), [this, process_body] {
+                m_incremental_decoder = nullptr;
+                process_body->function()(move(m_received_data));
+            });
+            response->body()->incrementally_read(process_body_chunk, process_end_of_body, process_body_error, GC::Ref { realm.global_object() });
+            return;
+        }
+
         response->body()->fully_read(realm, process_body, process_body_error, GC::Ref { realm.global_object() });
     };
 
@@ -116,7 +160,7 @@ void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infr
     set_fetch_controller(fetch_controller);
 }
 
-void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail)
+void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partial_image, Function<Platform::ImageDecodePriority()> decode_priority)
 {
     if (m_state == State::Finished) {
         if (on_finish)
@@ -135,8 +179,62 @@ void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<v
         callbacks.on_finish = GC::create_function(vm().heap(), move(on_finish));
     if (on_fail)
         callbacks.on_fail = GC::create_function(vm().heap(), move(on_fail));
+    if (on_partial_image)
+        callbacks.on_partial_image = GC::create_function(vm().heap(), move(on_partial_image));
+    if (decode_priority)
+        callbacks.decode_priority = GC::create_function(vm().heap(), move(decode_priority));
 
+    auto on_partial_image_callback = callbacks.on_partial_image;
     m_callbacks.append(move(callbacks));
+
+    if (m_partial_image_data && on_partial_image_callback)
+        on_partial_image_callback->function()();
+}
+
+void SharedResourceRequest::handle_body_chunk(ByteBuffer chunk)
+{
+    m_received_data.append(chunk.bytes());
+
+    if (!m_incremental_decoder || m_received_data.size() - m_bytes_sent_to_incremental_decoder < minimum_incremental_decode_chunk_size)
+        return;
+
+    m_incremental_decoder->append_data(m_received_data.bytes().slice(m_bytes_sent_to_incremental_decoder));
+    m_bytes_sent_to_incremental_decoder = m_received_data.size();
+}
+
+Platform::ImageDecodePriority SharedResourceRequest::decode_priority() const
+{
+    // NOTE: An image that is shared by several users is decoded as soon as the most urgent of them needs it.
+    Optional<Platform::ImageDecodePriority> priority;
+    for (auto const& callback : m_callbacks) {
+        if (!callback.decode_priority)
+            continue;
+        auto callback_priority = callback.decode_priority->function()();
+        if (!priority.has_value() || callback_priority > *priority)
+            priority = callback_priority;
+    }
+    return priority.value_or(Platform::ImageDecodePriority::NearViewport);
+}
+
+void SharedResourceRequest::handle_partial_image(NonnullRefPtr<Gfx::Bitmap> bitmap, Gfx::ColorSpace color_space)
+{
+    if (m_state != State::Fetching)
+        return;
+
+    Vector<AnimatedBitmapDecodedImageData::Frame> frames;
+    frames.append(AnimatedBitmapDecodedImageData::Frame {
+        .bitmap = Gfx::ImmutableBitmap::create(*bitmap, Gfx::AlphaType::Premultiplied, color_space),
+        .duration = 0,
+    });
+    auto image_data = AnimatedBitmapDecodedImageData::create(m_document->realm(), move(frames), 0, false);
+    if (image_data.is_error())
+        return;
+    m_partial_image_data = image_data.release_value();
+
+    for (auto& callback : m_callbacks) {
+        if (callback.on_partial_image)
+            callback.on_partial_image->function()();
+    }
 }
 
 void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string, StringView mime_type, ByteBuffer data)
@@ -157,7 +255,9 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
         return;
     }
 
-    auto handle_successful_bitmap_decode = [strong_this = GC::Root(*this)](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
+    // NOTE: The encoded data is kept around so that the decoded image can be dropped while it's offscreen, and decoded
+    //       again once it's scrolled back into view.
+    auto handle_successful_bitmap_decode = [strong_this = GC::Root(*this), encoded_data = MUST(ByteBuffer::copy(data))](Web::Platform::DecodedImage& result) mutable -> ErrorOr<void> {
         Vector<AnimatedBitmapDecodedImageData::Frame> frames;
         for (auto& frame : result.frames) {
             frames.append(AnimatedBitmapDecodedImageData::Frame {
@@ -165,7 +265,14 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
                 .duration = static_cast<int>(frame.duration),
             });
         }
-        strong_this->m_image_data = AnimatedBitmapDecodedImageData::create(strong_this->m_document->realm(), move(frames), result.loop_count, result.is_animated).release_value_but_fixme_should_propagate_errors();
+        if (result.frame_source) {
+            strong_this->m_image_data = AnimatedBitmapDecodedImageData::create_with_frame_source(strong_this->m_document->realm(), move(frames), result.frame_count, result.loop_count, result.frame_source.release_nonnull(), result.color_space).release_value_but_fixme_should_propagate_errors();
+        } else {
+            auto image_data = AnimatedBitmapDecodedImageData::create(strong_this->m_document->realm(), move(frames), result.loop_count, result.is_animated).release_value_but_fixme_should_propagate_errors();
+            if (!strong_this->m_keeps_decoded_image_resident)
+                image_data->make_evictable(move(encoded_data), *strong_this->m_document);
+            strong_this->m_image_data = image_data;
+        }
         strong_this->handle_successful_resource_load();
         return {};
     };
@@ -174,12 +281,14 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
         strong_this->handle_failed_fetch();
     };
 
-    (void)Web::Platform::ImageCodecPlugin::the().decode_image(data.bytes(), move(handle_successful_bitmap_decode), move(handle_failed_decode));
+    (void)Web::Platform::ImageCodecPlugin::the().decode_image(data.bytes(), move(handle_successful_bitmap_decode), move(handle_failed_decode), decode_priority());
 }
 
 void SharedResourceRequest::handle_failed_fetch()
 {
     m_state = State::Failed;
+    m_incremental_decoder = nullptr;
+    m_partial_image_data = nullptr;
     for (auto& callback : m_callbacks) {
         if (callback.on_fail)
             callback.on_fail->function()();
@@ -190,6 +299,7 @@ void SharedResourceRequest::handle_failed_fetch()
 void SharedResourceRequest::handle_successful_resource_load()
 {
     m_state = State::Finished;
+    m_partial_image_data = nullptr;
     for (auto& callback : m_callbacks) {
         if (callback.on_finish)
             callback.on_finish->function()();
@@ -8,8 +8,10 @@
 
 #include <AK/Error.h>
 #include <AK/OwnPtr.h>
+#include <AK/RefPtr.h>
 #include <LibGC/Function.h>
 #include <LibGC/Root.h>
+#include <LibGfx/ColorSpace.h>
 #include <LibGfx/Size.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Forward.h>
@@ -29,16 +31,25 @@ public:
 
     [[nodiscard]] GC::Ptr<DecodedImageData> image_data() const;
 
+    // A still image of whatever has been received so far, while the resource is being fetched.
+    [[nodiscard]] GC::Ptr<DecodedImageData> partial_image_data() const { return m_partial_image_data; }
+
     [[nodiscard]] GC::Ptr<Fetch::Infrastructure::FetchController> fetch_controller();
     void set_fetch_controller(GC::Ptr<Fetch::Infrastructure::FetchController>);
 
     void fetch_resource(JS::Realm&, GC::Ref<Fetch::Infrastructure::Request>);
 
-    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail);
+    // The optional decode priority callback tells us how soon the caller will need the decoded image, once its data has
+    // been fetched.
+    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partial_image = {}, Function<Platform::ImageDecodePriority()> decode_priority = {});
 
     bool is_fetching() const;
     bool needs_fetching() const;
 
+    // By default, the decoded image may be dropped while no image element has it near its viewport. Users that paint
+    // the image without telling it about the viewport must keep it resident instead.
+    void keep_decoded_image_resident();
+
 private:
     explicit SharedResourceRequest(GC::Ref<Page>, URL::URL, GC::Ref<DOM::Document>);
 
@@ -48,6 +59,9 @@ private:
     void handle_successful_fetch(URL::URL const&, StringView mime_type, ByteBuffer data);
     void handle_failed_fetch();
     void handle_successful_resource_load();
+    void handle_body_chunk(ByteBuffer);
+    void handle_partial_image(NonnullRefPtr<Gfx::Bitmap>, Gfx::ColorSpace);
+    Platform::ImageDecodePriority decode_priority() const;
 
     enum class State {
         New,
@@ -63,11 +77,20 @@ private:
     struct Callbacks {
         GC::Ptr<GC::Function<void()>> on_finish;
         GC::Ptr<GC::Function<void()>> on_fail;
+        GC::Ptr<GC::Function<void()>> on_partial_image;
+        GC::Ptr<GC::Function<Platform::ImageDecodePriority()>> decode_priority;
     };
     Vector<Callbacks> m_callbacks;
 
     URL::URL m_url;
     GC::Ptr<DecodedImageData> m_image_data;
+    bool m_keeps_decoded_image_resident { false };
+
+    // Only used while fetching images that can be shown before they have finished loading.
+    RefPtr<Platform::IncrementalImageDecoder> m_incremental_decoder;
+    ByteBuffer m_received_data;
+    size_t m_bytes_sent_to_incremental_decoder { 0 };
+    GC::Ptr<DecodedImageData> m_partial_image_data;
     GC::Ptr<Fetch::Infrastructure::FetchController> m_fetch_controller;
 
     GC::Ptr<DOM::Document> m_document;
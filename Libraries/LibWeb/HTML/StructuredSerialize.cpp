@@ -7,6 +7,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Endian.h>
 #include <AK/StdLibExtras.h>
 #include <AK/String.h>
 #include <AK/Vector.h>
@@ -48,6 +49,7 @@
 #include <LibWeb/Geometry/DOMRectReadOnly.h>
 #include <LibWeb/HTML/ImageData.h>
 #include <LibWeb/HTML/MessagePort.h>
+#include <LibWeb/HTML/OffscreenCanvas.h>
 #include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/Streams/ReadableStream.h>
 #include <LibWeb/Streams/TransformStream.h>
@@ -535,19 +537,25 @@ WebIDL::ExceptionOr<void> serialize_bytes(JS::VM& vm, Vector<u32>& vector, Reado
     // Append size of the buffer to the serialized structure.
     u64 const size = bytes.size();
     serialize_primitive_type(vector, size);
-    // Append the bytes of the buffer to the serialized structure.
-    u64 byte_position = 0;
-    while (byte_position < size) {
-        u32 combined_value = 0;
-        for (u8 i = 0; i < 4; ++i) {
-            u8 const byte = bytes[byte_position];
-            combined_value |= byte << (i * 8);
-            byte_position++;
-            if (byte_position == size)
-                break;
-        }
-        TRY_OR_THROW_OOM(vm, vector.try_append(combined_value));
+
+    // Append the bytes of the buffer to the serialized structure, four bytes per u32 with the first one in the lowest
+    // bits. The padding in the last u32 is zero.
+    auto position = vector.size();
+    auto word_count = ceil_div(bytes.size(), sizeof(u32));
+    TRY_OR_THROW_OOM(vm, vector.try_resize(position + word_count));
+
+    if (word_count > 0)
+        vector[position + word_count - 1] = 0;
+
+    if constexpr (HostIsLittleEndian) {
+        // OPTIMIZATION: On little-endian hosts, that layout is just the bytes themselves.
+        if (!bytes.is_empty())
+            memcpy(vector.data() + position, bytes.data(), bytes.size());
+    } else {
+        for (size_t i = 0; i < bytes.size(); ++i)
+            vector[position + i / 4] |= static_cast<u32>(bytes[i]) << ((i % 4) * 8);
     }
+
     return {};
 }
 
@@ -608,26 +616,24 @@ WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, Vector<u32>& vector
             return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot serialize detached ArrayBuffer"_string);
 
         // 2. Let size be value.[[ArrayBufferByteLength]].
-        auto size = array_buffer.byte_length();
-
         // 3. Let dataCopy be ? CreateByteDataBlock(size).
         //    NOTE: This can throw a RangeError exception upon allocation failure.
-        auto data_copy = TRY(JS::create_byte_data_block(vm, size));
-
         // 4. Perform CopyDataBlockBytes(dataCopy, 0, value.[[ArrayBufferData]], 0, size).
-        JS::copy_data_block_bytes(data_copy.buffer(), 0, array_buffer.buffer(), 0, size);
+        // OPTIMIZATION: serialize_bytes() copies the data block straight into the serialized record, which then serves as
+        //               dataCopy. There is no need for another copy in between.
+        auto data = array_buffer.buffer().bytes();
 
         // 5. If value has an [[ArrayBufferMaxByteLength]] internal slot, then set serialized to { [[Type]]: "ResizableArrayBuffer",
         //    [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size, [[ArrayBufferMaxByteLength]]: value.[[ArrayBufferMaxByteLength]] }.
         if (!array_buffer.is_fixed_length()) {
             serialize_enum(vector, ValueTag::ResizeableArrayBuffer);
-            TRY(serialize_bytes(vm, vector, data_copy.buffer().bytes()));
+            TRY(serialize_bytes(vm, vector, data));
             serialize_primitive_type(vector, array_buffer.max_byte_length());
         }
         // 6. Otherwise, set serialized to { [[Type]]: "ArrayBuffer", [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size }.
         else {
             serialize_enum(vector, ValueTag::ArrayBuffer);
-            TRY(serialize_bytes(vm, vector, data_copy.buffer().bytes()));
+            TRY(serialize_bytes(vm, vector, data));
         }
     }
     return {};
@@ -1139,16 +1145,22 @@ WebIDL::ExceptionOr<ByteBuffer> deserialize_bytes(JS::VM& vm, ReadonlySpan<u32>
 {
     u64 const size = deserialize_primitive_type<u64>(vector, position);
 
+    // NOTE: Serialized data can come from another process, so don't trust the size to fit in what's left of it.
+    auto word_count = size / sizeof(u32) + (size % sizeof(u32) != 0);
+    if (word_count > vector.size() - position)
+        return WebIDL::DataCloneError::create(*vm.current_realm(), "Serialized data is truncated"_string);
+
     auto bytes = TRY_OR_THROW_OOM(vm, ByteBuffer::create_uninitialized(size));
-    u64 byte_position = 0;
-    while (position < vector.size() && byte_position < size) {
-        for (u8 i = 0; i < 4; ++i) {
-            bytes[byte_position++] = (vector[position] >> (i * 8) & 0xFF);
-            if (byte_position == size)
-                break;
-        }
-        position++;
+
+    if constexpr (HostIsLittleEndian) {
+        if (size > 0)
+            memcpy(bytes.data(), vector.offset_pointer(position), size);
+    } else {
+        for (size_t i = 0; i < size; ++i)
+            bytes[i] = static_cast<u8>(vector[position + i / 4] >> ((i % 4) * 8));
     }
+
+    position += word_count;
     return bytes;
 }
 
@@ -1245,7 +1257,6 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
                 // 3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
                 // 4. Set dataHolder.[[ArrayBufferMaxByteLength]] to transferable.[[ArrayBufferMaxByteLength]].
                 serialize_enum<TransferType>(data_holder.data, TransferType::ResizableArrayBuffer);
-                MUST(serialize_bytes(vm, data_holder.data, array_buffer->buffer().bytes())); // serializes both byte length and bytes
                 serialize_primitive_type<size_t>(data_holder.data, array_buffer->max_byte_length());
             }
 
@@ -1255,12 +1266,12 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
                 // 2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
                 // 3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
                 serialize_enum<TransferType>(data_holder.data, TransferType::ArrayBuffer);
-                MUST(serialize_bytes(vm, data_holder.data, array_buffer->buffer().bytes())); // serializes both byte length and bytes
             }
 
             // 3. Perform ? DetachArrayBuffer(transferable).
             // NOTE: Specifications can use the [[ArrayBufferDetachKey]] internal slot to prevent ArrayBuffers from being detached. This is used in WebAssembly JavaScript Interface, for example. See: https://html.spec.whatwg.org/multipage/references.html#refsWASMJS
-            TRY(JS::detach_array_buffer(vm, *array_buffer));
+            // OPTIMIZATION: The data block is moved into the data holder as part of detaching, rather than copied.
+            data_holder.array_buffer_data = TRY(JS::detach_array_buffer_and_take_data(vm, *array_buffer));
         }
 
         // 5. Otherwise:
@@ -1302,6 +1313,8 @@ static bool is_interface_exposed_on_target_realm(TransferType name, JS::Realm& r
         return intrinsics.is_exposed("WritableStream"sv);
     case TransferType::TransformStream:
         return intrinsics.is_exposed("TransformStream"sv);
+    case TransferType::OffscreenCanvas:
+        return intrinsics.is_exposed("OffscreenCanvas"sv);
     case TransferType::Unknown:
         dbgln("Unknown interface type for transfer: {}", to_underlying(name));
         break;
@@ -1334,6 +1347,11 @@ static WebIDL::ExceptionOr<GC::Ref<Bindings::PlatformObject>> create_transferred
         TRY(transform_stream->transfer_receiving_steps(transfer_data_holder));
         return transform_stream;
     }
+    case TransferType::OffscreenCanvas: {
+        auto offscreen_canvas = OffscreenCanvas::create(target_realm, 0, 0);
+        TRY(offscreen_canvas->transfer_receiving_steps(transfer_data_holder));
+        return offscreen_canvas;
+    }
     case TransferType::ArrayBuffer:
     case TransferType::ResizableArrayBuffer:
         dbgln("ArrayBuffer ({}) is not a platform object.", to_underlying(name));
@@ -1374,10 +1392,7 @@ WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_tran
         //       [[ArrayBufferData]] is instead just getting transferred into the new ArrayBuffer. This could be true, for example,
         //       when both the source and target realms are in the same process.
         if (type == TransferType::ArrayBuffer) {
-            auto bytes = TRY(deserialize_bytes(vm, transfer_data_holder.data, data_holder_position));
-            JS::ArrayBuffer* data = TRY(JS::allocate_array_buffer(vm, target_realm.intrinsics().array_buffer_constructor(), bytes.size()));
-            bytes.span().copy_to(data->buffer().span());
-            value = JS::Value(data);
+            value = JS::ArrayBuffer::create(target_realm, move(transfer_data_holder.array_buffer_data));
         }
 
         // 3. Otherwise, if transferDataHolder.[[Type]] is "ResizableArrayBuffer", then set value to a new ArrayBuffer object
@@ -1386,12 +1401,10 @@ WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_tran
         //     [[ArrayBufferMaxByteLength]] internal slot value is transferDataHolder.[[ArrayBufferMaxByteLength]].
         // NOTE: For the same reason as the previous step, this step is also unlikely to throw an exception.
         else if (type == TransferType::ResizableArrayBuffer) {
-            auto bytes = TRY(deserialize_bytes(vm, transfer_data_holder.data, data_holder_position));
             auto max_byte_length = deserialize_primitive_type<size_t>(transfer_data_holder.data, data_holder_position);
-            JS::ArrayBuffer* data = TRY(JS::allocate_array_buffer(vm, target_realm.intrinsics().array_buffer_constructor(), bytes.size()));
+            auto data = JS::ArrayBuffer::create(target_realm, move(transfer_data_holder.array_buffer_data));
             data->set_max_byte_length(max_byte_length);
-            bytes.span().copy_to(data->buffer().span());
-            value = JS::Value(data);
+            value = data;
         }
 
         // 4. Otherwise:
@@ -1483,6 +1496,7 @@ ErrorOr<void> encode(Encoder& encoder, ::Web::HTML::TransferDataHolder const& da
 {
     TRY(encoder.encode(data_holder.data));
     TRY(encoder.encode(data_holder.fds));
+    TRY(encoder.encode(data_holder.array_buffer_data));
     return {};
 }
 
@@ -1499,7 +1513,8 @@ ErrorOr<::Web::HTML::TransferDataHolder> decode(Decoder& decoder)
 {
     auto data = TRY(decoder.decode<Vector<u32>>());
     auto fds = TRY(decoder.decode<Vector<IPC::File>>());
-    return ::Web::HTML::TransferDataHolder { move(data), move(fds) };
+    auto array_buffer_data = TRY(decoder.decode<ByteBuffer>());
+    return ::Web::HTML::TransferDataHolder { move(data), move(fds), move(array_buffer_data) };
 }
 
 template<>
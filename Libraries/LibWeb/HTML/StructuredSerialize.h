@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <AK/Result.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
@@ -27,6 +28,10 @@ namespace Web::HTML {
 struct TransferDataHolder {
     Vector<u32> data;
     Vector<IPC::File> fds;
+
+    // The [[ArrayBufferData]] of a transferred ArrayBuffer, which is kept out of data so that it can be handed over
+    // without copying.
+    ByteBuffer array_buffer_data;
 };
 
 struct SerializedTransferRecord {
@@ -52,6 +57,7 @@ enum class TransferType : u8 {
     ReadableStream = 4,
     WritableStream = 5,
     TransformStream = 6,
+    OffscreenCanvas = 7,
 };
 
 WebIDL::ExceptionOr<SerializationRecord> structured_serialize(JS::VM& vm, JS::Value);
@@ -10,12 +10,16 @@
 #include <LibGfx/SkiaBackendContext.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/Fetch/Infrastructure/FetchRecord.h>
 #include <LibWeb/Geolocation/GeolocationCoordinates.h>
 #include <LibWeb/HTML/BrowsingContextGroup.h>
 #include <LibWeb/HTML/DocumentState.h>
+#include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/HTML/HTMLMediaElement.h>
 #include <LibWeb/HTML/Navigation.h>
 #include <LibWeb/HTML/NavigationParams.h>
 #include <LibWeb/HTML/Parser/HTMLParser.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/SessionHistoryEntry.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
@@ -28,6 +32,12 @@ namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(TraversableNavigable);
 
+// The number of documents, besides the active document, that are kept alive in session history for back/forward traversal.
+static constexpr size_t max_documents_in_back_forward_cache = 6;
+
+static constexpr double foreground_heap_growth_factor = 1.0;
+static constexpr double background_heap_growth_factor = 0.5;
+
 TraversableNavigable::TraversableNavigable(GC::Ref<Page> page)
     : Navigable(page, page->client().is_svg_page_client())
     , m_storage_shed(StorageAPI::StorageShed::create(page->heap()))
@@ -363,6 +373,62 @@ Vector<GC::Root<Navigable>> TraversableNavigable::get_all_navigables_that_might_
     return results;
 }
 
+// AD-HOC: Returns the reason why displayedDocument can't be kept alive in its session history entry when navigating to
+//         targetEntry, or nothing if it can be reactivated by a later traversal back to that entry.
+static Optional<String> back_forward_cache_blocking_reason(Navigable& navigable, DOM::Document& displayed_document, SessionHistoryEntry const& target_entry)
+{
+    // NOTE: Restoring child navigables would also require restoring their nested histories, so only documents of
+    //       top-level traversables without any child navigables are kept.
+    if (!navigable.is_top_level_traversable())
+        return "not-top-level"_string;
+    if (!displayed_document.document_tree_child_navigables().is_empty())
+        return "child-navigables"_string;
+
+    // NOTE: Reloads and replacements take over the step of the displayed document's entry, so nothing would be left to
+    //       traverse back to.
+    if (target_entry.step() == navigable.active_session_history_entry()->step())
+        return "replaced"_string;
+
+    if (displayed_document.readiness() != DocumentReadyState::Complete)
+        return "loading"_string;
+
+    auto window = displayed_document.window();
+    if (!window)
+        return {};
+
+    if (window->has_event_listener(EventNames::unload))
+        return "unload-listener"_string;
+
+    // NOTE: Open connections would keep delivering events to a document that is no longer fully active, and the
+    //       unloading cleanup steps would close them anyway.
+    if (window->has_open_web_sockets())
+        return "websocket"_string;
+    if (window->has_open_event_sources())
+        return "event-source"_string;
+
+    // NOTE: Nothing suspends the playback of a document that is no longer fully active yet, so it would keep playing
+    //       while hidden.
+    auto has_playing_media = false;
+    displayed_document.for_each_in_subtree_of_type<HTMLMediaElement>([&](auto const& media_element) {
+        if (media_element.paused())
+            return TraversalDecision::Continue;
+        has_playing_media = true;
+        return TraversalDecision::Break;
+    });
+    if (has_playing_media)
+        return "media"_string;
+
+    // NOTE: The responses of fetches that are still in flight would be delivered to a document that is no longer
+    //       fully active, or lost when the aborted document is reactivated.
+    for (auto const& fetch_record : displayed_document.relevant_settings_object().fetch_group()) {
+        auto controller = fetch_record->fetch_controller();
+        if (!fetch_record->request()->done() && controller && controller->state() == Fetch::Infrastructure::FetchController::State::Ongoing)
+            return "in-flight-fetch"_string;
+    }
+
+    return {};
+}
+
 // https://html.spec.whatwg.org/multipage/browsing-the-web.html#deactivate-a-document-for-a-cross-document-navigation
 static void deactivate_a_document_for_cross_document_navigation(GC::Ref<DOM::Document> displayed_document, Optional<UserNavigationInvolvement>, GC::Ref<SessionHistoryEntry> target_entry, GC::Ref<GC::Function<void()>> after_potential_unloads)
 {
@@ -385,6 +451,11 @@ static void deactivate_a_document_for_cross_document_navigation(GC::Ref<DOM::Doc
         // 2. Set the ongoing navigation for navigable to null.
         navigable->set_ongoing_navigation({});
 
+        // AD-HOC: Make displayedDocument unsalvageable if it can't be kept alive for a later traversal, so that
+        //         unloading it also destroys it.
+        if (auto reason = back_forward_cache_blocking_reason(*navigable, displayed_document, target_entry); reason.has_value())
+            displayed_document->make_unsalvageable(reason.release_value());
+
         // 3. Unload a document and its descendants given displayedDocument, targetEntry's document, afterPotentialUnloads, and firePageSwapBeforeUnload.
         displayed_document->unload_a_document_and_its_descendants(target_entry->document(), after_potential_unloads);
     }
@@ -862,6 +933,8 @@ TraversableNavigable::HistoryStepResult TraversableNavigable::apply_the_history_
     m_current_session_history_step = target_step;
 
     // Not in the spec:
+    evict_documents_from_back_forward_cache(max_documents_in_back_forward_cache);
+
     auto back_enabled = m_current_session_history_step > 0;
     VERIFY(m_session_history_entries.size() > 0);
     auto forward_enabled = can_go_forward();
@@ -1084,6 +1157,13 @@ void TraversableNavigable::clear_the_forward_session_history()
     // 2. Let step be the navigable's current session history step.
     auto step = current_session_history_step();
 
+    // AD-HOC: Documents that were kept alive in the removed entries can never be traversed back to.
+    HashTable<GC::Ref<DOM::Document>> documents_of_removed_entries;
+    for (auto const& entry : m_session_history_entries) {
+        if (auto document = entry->document(); document && entry->step().get<int>() > step)
+            documents_of_removed_entries.set(*document);
+    }
+
     // 3. Let entryLists be the ordered set « navigable's session history entries ».
     Vector<Vector<GC::Ref<SessionHistoryEntry>>&> entry_lists;
     entry_lists.append(session_history_entries());
@@ -1105,6 +1185,56 @@ void TraversableNavigable::clear_the_forward_session_history()
             }
         }
     }
+
+    for (auto const& entry : m_session_history_entries) {
+        if (auto document = entry->document())
+            documents_of_removed_entries.remove(*document);
+    }
+    for (auto& document : documents_of_removed_entries) {
+        if (document != active_document() && !document->has_been_destroyed())
+            document->destroy();
+    }
+}
+
+void TraversableNavigable::evict_documents_from_back_forward_cache(size_t maximum_cached_documents)
+{
+    struct CachedDocument {
+        GC::Ref<DOM::Document> document;
+        int distance_from_current_step { 0 };
+    };
+    Vector<CachedDocument> cached_documents;
+
+    // NOTE: Entries created by same-document navigations share their document, so it's kept alive for as long as any
+    //       of them is close enough to the current step.
+    auto active_document = this->active_document();
+    for (auto const& entry : m_session_history_entries) {
+        auto document = entry->document();
+        if (!document || document == active_document || !document->is_salvageable())
+            continue;
+
+        auto distance = abs(entry->step().get<int>() - m_current_session_history_step);
+        if (auto cached_document = cached_documents.find_if([&](auto const& cached_document) { return cached_document.document == document; }); !cached_document.is_end())
+            cached_document->distance_from_current_step = min(cached_document->distance_from_current_step, distance);
+        else
+            cached_documents.append({ *document, distance });
+    }
+
+    if (cached_documents.size() <= maximum_cached_documents)
+        return;
+
+    quick_sort(cached_documents, [](auto const& a, auto const& b) {
+        return a.distance_from_current_step < b.distance_from_current_step;
+    });
+
+    for (auto const& cached_document : cached_documents.span().slice(maximum_cached_documents)) {
+        for (auto& entry : m_session_history_entries) {
+            if (entry->document() == cached_document.document)
+                entry->document_state()->set_document(nullptr);
+        }
+
+        // NOTE: A later traversal to one of the document's entries will load it again.
+        cached_document.document->destroy();
+    }
 }
 
 bool TraversableNavigable::can_go_forward() const
@@ -1354,6 +1484,18 @@ void TraversableNavigable::set_system_visibility_state(VisibilityState visibilit
             document->update_the_visibility_state(visibility_state);
         }));
     }
+
+    // Not in the spec: Keep the heap smaller while none of the pages in this process are visible, since nobody will
+    //                  notice the extra time spent collecting garbage.
+    auto any_traversable_is_visible = false;
+    for (auto navigable : all_navigables()) {
+        auto* traversable = as_if<TraversableNavigable>(*navigable);
+        if (traversable && traversable->is_top_level_traversable() && traversable->system_visibility_state() == VisibilityState::Visible) {
+            any_traversable_is_visible = true;
+            break;
+        }
+    }
+    heap().set_heap_growth_factor(any_traversable_is_visible ? foreground_heap_growth_factor : background_heap_growth_factor);
 }
 
 // https://html.spec.whatwg.org/multipage/interaction.html#currently-focused-area-of-a-top-level-traversable
@@ -1414,7 +1556,7 @@ void TraversableNavigable::process_screenshot_requests()
             auto bitmap = Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, rect.size().to_type<int>()).release_value_but_fixme_should_propagate_errors();
             auto painting_surface = Gfx::PaintingSurface::wrap_bitmap(*bitmap);
             PaintConfig paint_config { .canvas_fill_rect = rect.to_type<int>() };
-            start_display_list_rendering(painting_surface, paint_config, [bitmap, &client] {
+            start_display_list_rendering(painting_surface, paint_config, {}, [bitmap, &client] {
                 client.page_did_take_screenshot(bitmap->to_shareable_bitmap());
             });
         } else {
@@ -1423,7 +1565,7 @@ void TraversableNavigable::process_screenshot_requests()
             auto bitmap = Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, rect.size().to_type<int>()).release_value_but_fixme_should_propagate_errors();
             auto painting_surface = Gfx::PaintingSurface::wrap_bitmap(*bitmap);
             PaintConfig paint_config { .paint_overlay = true, .canvas_fill_rect = rect.to_type<int>() };
-            start_display_list_rendering(painting_surface, paint_config, [bitmap, &client] {
+            start_display_list_rendering(painting_surface, paint_config, {}, [bitmap, &client] {
                 client.page_did_take_screenshot(bitmap->to_shareable_bitmap());
             });
         }
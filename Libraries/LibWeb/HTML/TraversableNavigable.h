@@ -117,6 +117,10 @@ public:
     Geolocation::EmulatedPositionData const& emulated_position_data() const;
     void set_emulated_position_data(Geolocation::EmulatedPositionData data);
 
+    // Destroys the documents kept alive in session history for back/forward traversal that are farthest away from the
+    // current session history step, until no more than the given number of them are left.
+    void evict_documents_from_back_forward_cache(size_t maximum_cached_documents);
+
     void process_screenshot_requests();
     void queue_screenshot_task(Optional<UniqueNodeID> node_id)
     {
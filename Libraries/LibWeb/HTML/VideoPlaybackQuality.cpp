@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/VideoPlaybackQualityPrototype.h>
+#include <LibWeb/HTML/VideoPlaybackQuality.h>
+
+namespace Web::HTML {
+
+GC_DEFINE_ALLOCATOR(VideoPlaybackQuality);
+
+GC::Ref<VideoPlaybackQuality> VideoPlaybackQuality::create(JS::Realm& realm, HighResolutionTime::DOMHighResTimeStamp creation_time, WebIDL::UnsignedLong dropped_video_frames, WebIDL::UnsignedLong total_video_frames)
+{
+    return realm.create<VideoPlaybackQuality>(realm, creation_time, dropped_video_frames, total_video_frames);
+}
+
+VideoPlaybackQuality::VideoPlaybackQuality(JS::Realm& realm, HighResolutionTime::DOMHighResTimeStamp creation_time, WebIDL::UnsignedLong dropped_video_frames, WebIDL::UnsignedLong total_video_frames)
+    : PlatformObject(realm)
+    , m_creation_time(creation_time)
+    , m_dropped_video_frames(dropped_video_frames)
+    , m_total_video_frames(total_video_frames)
+{
+}
+
+VideoPlaybackQuality::~VideoPlaybackQuality() = default;
+
+void VideoPlaybackQuality::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(VideoPlaybackQuality);
+    Base::initialize(realm);
+}
+
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::HTML {
+
+// https://w3c.github.io/media-playback-quality/#videoplaybackquality-interface
+class VideoPlaybackQuality final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(VideoPlaybackQuality, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(VideoPlaybackQuality);
+
+public:
+    [[nodiscard]] static GC::Ref<VideoPlaybackQuality> create(JS::Realm&, HighResolutionTime::DOMHighResTimeStamp creation_time, WebIDL::UnsignedLong dropped_video_frames, WebIDL::UnsignedLong total_video_frames);
+    virtual ~VideoPlaybackQuality() override;
+
+    HighResolutionTime::DOMHighResTimeStamp creation_time() const { return m_creation_time; }
+    WebIDL::UnsignedLong dropped_video_frames() const { return m_dropped_video_frames; }
+    WebIDL::UnsignedLong total_video_frames() const { return m_total_video_frames; }
+
+    // NOTE: We never present corrupted frames; a frame that fails to decode stops playback with a decoder error instead.
+    WebIDL::UnsignedLong corrupted_video_frames() const { return 0; }
+
+private:
+    VideoPlaybackQuality(JS::Realm&, HighResolutionTime::DOMHighResTimeStamp creation_time, WebIDL::UnsignedLong dropped_video_frames, WebIDL::UnsignedLong total_video_frames);
+
+    virtual void initialize(JS::Realm&) override;
+
+    HighResolutionTime::DOMHighResTimeStamp m_creation_time { 0 };
+    WebIDL::UnsignedLong m_dropped_video_frames { 0 };
+    WebIDL::UnsignedLong m_total_video_frames { 0 };
+};
+
+}
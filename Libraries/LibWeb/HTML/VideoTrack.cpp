@@ -31,11 +31,15 @@ VideoTrack::VideoTrack(JS::Realm& realm, GC::Ref<HTMLMediaElement> media_element
     , m_media_element(media_element)
     , m_playback_manager(move(playback_manager))
 {
-    m_playback_manager->on_video_frame = [this](auto frame) {
+    m_playback_manager->on_video_frame = [this](Media::PresentableVideoFrame frame) {
         auto playback_position = static_cast<double>(position().to_milliseconds()) / 1000.0;
 
-        if (is<HTMLVideoElement>(*m_media_element))
-            as<HTMLVideoElement>(*m_media_element).set_current_frame({}, move(frame), playback_position);
+        if (is<HTMLVideoElement>(*m_media_element)) {
+            auto& video_element = as<HTMLVideoElement>(*m_media_element);
+            frame.visit(
+                [&](NonnullRefPtr<Gfx::Bitmap>& bitmap) { video_element.set_current_frame({}, move(bitmap), nullptr, playback_position); },
+                [&](NonnullRefPtr<Gfx::YUVData>& yuv_data) { video_element.set_current_frame({}, nullptr, move(yuv_data), playback_position); });
+        }
 
         m_media_element->set_current_playback_position(playback_position);
     };
@@ -135,6 +139,16 @@ u64 VideoTrack::pixel_height() const
     return m_playback_manager->selected_video_track().video_data().pixel_height;
 }
 
+u64 VideoTrack::number_of_presented_frames() const
+{
+    return m_playback_manager->number_of_presented_frames();
+}
+
+u64 VideoTrack::number_of_dropped_frames() const
+{
+    return m_playback_manager->number_of_skipped_frames();
+}
+
 // https://html.spec.whatwg.org/multipage/media.html#dom-videotrack-selected
 void VideoTrack::set_selected(bool selected)
 {
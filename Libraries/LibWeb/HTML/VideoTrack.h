@@ -34,6 +34,9 @@ public:
     u64 pixel_width() const;
     u64 pixel_height() const;
 
+    u64 number_of_presented_frames() const;
+    u64 number_of_dropped_frames() const;
+
     String const& id() const { return m_id; }
     String const& kind() const { return m_kind; }
     String const& label() const { return m_label; }
@@ -306,6 +306,42 @@ Page const& Window::page() const
     return associated_document().page();
 }
 
+static u64 s_media_feature_generation = 0;
+
+u64 Window::current_media_feature_generation()
+{
+    return s_media_feature_generation;
+}
+
+static String serialize_media_feature(Optional<CSS::MediaFeatureValue> const& value)
+{
+    if (!value.has_value())
+        return {};
+    return value->to_string();
+}
+
+u64 Window::media_feature_changed_in_generation(CSS::MediaFeatureID media_feature) const
+{
+    if (auto it = m_media_feature_states.find(media_feature); it != m_media_feature_states.end())
+        return it->value.changed_in_generation;
+
+    // A feature we haven't seen before counts as having just changed.
+    auto generation = ++s_media_feature_generation;
+    m_media_feature_states.set(media_feature, { .value = serialize_media_feature(query_media_feature(media_feature)), .changed_in_generation = generation });
+    return generation;
+}
+
+void Window::update_media_feature_states()
+{
+    for (auto& it : m_media_feature_states) {
+        auto value = serialize_media_feature(query_media_feature(it.key));
+        if (value == it.value.value)
+            continue;
+        it.value.value = move(value);
+        it.value.changed_in_generation = ++s_media_feature_generation;
+    }
+}
+
 Optional<CSS::MediaFeatureValue> Window::query_media_feature(CSS::MediaFeatureID media_feature) const
 {
     // FIXME: Many of these should be dependent on the hardware
@@ -8,12 +8,14 @@
 #pragma once
 
 #include <AK/Badge.h>
+#include <AK/HashMap.h>
 #include <AK/RefPtr.h>
 #include <AK/TypeCasts.h>
 #include <LibGC/Heap.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/WindowGlobalMixin.h>
+#include <LibWeb/CSS/MediaFeatureID.h>
 #include <LibWeb/DOM/EventTarget.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/HTML/BarProp.h>
@@ -133,6 +135,12 @@ public:
 
     Optional<CSS::MediaFeatureValue> query_media_feature(CSS::MediaFeatureID) const;
 
+    // Media queries remember the generation they were last evaluated in, and only need to be evaluated again once a
+    // media feature they depend on has changed in a later generation. Generations are shared by all windows.
+    static u64 current_media_feature_generation();
+    u64 media_feature_changed_in_generation(CSS::MediaFeatureID) const;
+    void update_media_feature_states();
+
     void fire_a_page_transition_event(FlyString const& event_name, bool persisted);
 
     WebIDL::ExceptionOr<GC::Ref<Storage>> local_storage();
@@ -297,6 +305,14 @@ private:
 
     GC::Ptr<DOM::Event> m_current_event;
 
+    // The serialized value of every media feature a media query has asked about, as of the last call to
+    // update_media_feature_states().
+    struct MediaFeatureState {
+        String value;
+        u64 changed_in_generation { 0 };
+    };
+    mutable HashMap<CSS::MediaFeatureID, MediaFeatureState> m_media_feature_states;
+
     // https://html.spec.whatwg.org/multipage/webappapis.html#resolved-module-set
     // A global object has a resolved module set, a set of specifier resolution records, initially empty.
     //
@@ -41,6 +41,7 @@
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
 #include <LibWeb/ResourceTiming/PerformanceResourceTiming.h>
+#include <LibWeb/Scheduling/Scheduler.h>
 #include <LibWeb/ServiceWorker/CacheStorage.h>
 #include <LibWeb/UserTiming/PerformanceMark.h>
 #include <LibWeb/UserTiming/PerformanceMeasure.h>
@@ -80,6 +81,7 @@ void WindowOrWorkerGlobalScopeMixin::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_registered_event_sources);
     visitor.visit(m_crypto);
     visitor.visit(m_cache_storage);
+    visitor.visit(m_scheduler);
     visitor.visit(m_resource_timing_secondary_buffer);
 }
 
@@ -817,6 +819,15 @@ void WindowOrWorkerGlobalScopeMixin::forcibly_close_all_event_sources()
         event_source->forcibly_close();
 }
 
+bool WindowOrWorkerGlobalScopeMixin::has_open_event_sources() const
+{
+    for (auto const& event_source : m_registered_event_sources) {
+        if (event_source->ready_state() != EventSource::ReadyState::Closed)
+            return true;
+    }
+    return false;
+}
+
 void WindowOrWorkerGlobalScopeMixin::register_web_socket(Badge<WebSockets::WebSocket>, GC::Ref<WebSockets::WebSocket> web_socket)
 {
     m_registered_web_sockets.append(web_socket);
@@ -839,6 +850,15 @@ WindowOrWorkerGlobalScopeMixin::AffectedAnyWebSockets WindowOrWorkerGlobalScopeM
     return affected_any_web_sockets;
 }
 
+bool WindowOrWorkerGlobalScopeMixin::has_open_web_sockets() const
+{
+    for (auto const& web_socket : m_registered_web_sockets) {
+        if (web_socket.ready_state() != Requests::WebSocket::ReadyState::Closed)
+            return true;
+    }
+    return false;
+}
+
 // https://html.spec.whatwg.org/multipage/timers-and-user-prompts.html#run-steps-after-a-timeout
 void WindowOrWorkerGlobalScopeMixin::run_steps_after_a_timeout(i32 timeout, Function<void()> completion_step)
 {
@@ -1090,4 +1110,16 @@ GC::Ref<ServiceWorker::CacheStorage> WindowOrWorkerGlobalScopeMixin::caches()
     return GC::Ref { *m_cache_storage };
 }
 
+// https://wicg.github.io/scheduling-apis/#dom-windoworworkerglobalscope-scheduler
+GC::Ref<Scheduling::Scheduler> WindowOrWorkerGlobalScopeMixin::scheduler()
+{
+    auto& platform_object = this_impl();
+    auto& realm = platform_object.realm();
+
+    // The scheduler attribute's getter steps are to return this's scheduler.
+    if (!m_scheduler)
+        m_scheduler = Scheduling::Scheduler::create(realm);
+    return GC::Ref { *m_scheduler };
+}
+
 }
@@ -73,6 +73,7 @@ public:
     void register_event_source(Badge<EventSource>, GC::Ref<EventSource>);
     void unregister_event_source(Badge<EventSource>, GC::Ref<EventSource>);
     void forcibly_close_all_event_sources();
+    [[nodiscard]] bool has_open_event_sources() const;
 
     void register_web_socket(Badge<WebSockets::WebSocket>, GC::Ref<WebSockets::WebSocket>);
     void unregister_web_socket(Badge<WebSockets::WebSocket>, GC::Ref<WebSockets::WebSocket>);
@@ -82,6 +83,7 @@ public:
         Yes,
     };
     AffectedAnyWebSockets make_disappear_all_web_sockets();
+    [[nodiscard]] bool has_open_web_sockets() const;
 
     void run_steps_after_a_timeout(i32 timeout, Function<void()> completion_step);
 
@@ -103,6 +105,8 @@ public:
 
     [[nodiscard]] GC::Ref<ServiceWorker::CacheStorage> caches();
 
+    [[nodiscard]] GC::Ref<Scheduling::Scheduler> scheduler();
+
 protected:
     void initialize(JS::Realm&);
     void visit_edges(JS::Cell::Visitor&);
@@ -151,6 +155,8 @@ private:
 
     GC::Ptr<ServiceWorker::CacheStorage> m_cache_storage;
 
+    GC::Ptr<Scheduling::Scheduler> m_scheduler;
+
     bool m_error_reporting_mode { false };
 
     WebSockets::WebSocket::List m_registered_web_sockets;
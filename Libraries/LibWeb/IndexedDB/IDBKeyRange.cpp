@@ -48,14 +48,27 @@ void IDBKeyRange::visit_edges(Visitor& visitor)
 bool IDBKeyRange::is_in_range(GC::Ref<Key> key) const
 {
     // A key is in a key range range if both of the following conditions are fulfilled:
+    return satisfies_lower_bound(key) && satisfies_upper_bound(key);
+}
 
+bool IDBKeyRange::satisfies_lower_bound(GC::Ref<Key> key) const
+{
     // The range’s lower bound is null, or it is less than key, or it is both equal to key and the range’s lower open flag is false.
-    auto lower_bound_in_range = this->lower_key() == nullptr || Key::less_than(*this->lower_key(), key) || (Key::equals(key, *this->lower_key()) && !this->lower_open());
+    if (!m_lower_bound)
+        return true;
 
+    auto comparison = Key::compare_two_keys(*m_lower_bound, key);
+    return comparison < 0 || (comparison == 0 && !m_lower_open);
+}
+
+bool IDBKeyRange::satisfies_upper_bound(GC::Ref<Key> key) const
+{
     // The range’s upper bound is null, or it is greater than key, or it is both equal to key and the range’s upper open flag is false.
-    auto upper_bound_in_range = this->upper_key() == nullptr || Key::greater_than(*this->upper_key(), key) || (Key::equals(key, *this->upper_key()) && !this->upper_open());
+    if (!m_upper_bound)
+        return true;
 
-    return lower_bound_in_range && upper_bound_in_range;
+    auto comparison = Key::compare_two_keys(*m_upper_bound, key);
+    return comparison > 0 || (comparison == 0 && !m_upper_open);
 }
 
 // https://w3c.github.io/IndexedDB/#dom-idbkeyrange-only
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Span.h>
 #include <AK/Types.h>
 #include <LibGC/Heap.h>
 #include <LibGC/Ptr.h>
@@ -51,6 +52,38 @@ public:
     GC::Ptr<Key> lower_key() const { return m_lower_bound; }
     GC::Ptr<Key> upper_key() const { return m_upper_bound; }
 
+    // The two conditions of is_in_range(). Keys that fail the first one sort before all keys in range, and keys that
+    // fail the second one sort after them.
+    bool satisfies_lower_bound(GC::Ref<Key>) const;
+    bool satisfies_upper_bound(GC::Ref<Key>) const;
+
+    struct RecordPositions {
+        size_t start { 0 };
+        size_t end { 0 };
+    };
+
+    // Returns the positions of the first record in range and of the one after the last record in range. The records
+    // have to be sorted by key, which puts all records in range next to each other.
+    template<typename RecordType>
+    RecordPositions positions_in_range(Span<RecordType> records) const
+    {
+        auto partition_point = [&](size_t low, auto predicate) {
+            auto high = records.size();
+            while (low < high) {
+                auto middle = low + (high - low) / 2;
+                if (predicate(records[middle].key))
+                    low = middle + 1;
+                else
+                    high = middle;
+            }
+            return low;
+        };
+
+        auto start = partition_point(0, [&](auto key) { return !satisfies_lower_bound(key); });
+        auto end = partition_point(start, [&](auto key) { return satisfies_upper_bound(key); });
+        return { start, end };
+    }
+
 protected:
     explicit IDBKeyRange(JS::Realm&, GC::Ptr<Key> lower_bound, GC::Ptr<Key> upper_bound, LowerOpen lower_open, UpperOpen upper_open);
     virtual void initialize(JS::Realm&) override;
@@ -4,7 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
+#include <LibWeb/IndexedDB/IDBKeyRange.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
 
@@ -49,13 +49,28 @@ void Index::set_name(String name)
     m_name = move(name);
 }
 
-bool Index::has_record_with_key(GC::Ref<Key> key)
+// Returns the position of the first record that doesn't sort before the given key and value. Without a value, this is
+// the first record whose key is not less than the given key.
+static size_t lower_bound_for_key(ReadonlySpan<IndexRecord> records, GC::Ref<Key> key, GC::Ptr<Key> value = {})
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(record.key, key);
-    });
+    size_t low = 0;
+    size_t high = records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        auto key_comparison = Key::compare_two_keys(records[middle].key, key);
+        auto is_before = key_comparison < 0 || (key_comparison == 0 && value && Key::less_than(records[middle].value, *value));
+        if (is_before)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
 
-    return index != m_records.end();
+bool Index::has_record_with_key(GC::Ref<Key> key)
+{
+    auto position = lower_bound_for_key(m_records, key);
+    return position < m_records.size() && Key::equals(m_records[position].key, key);
 }
 
 // https://w3c.github.io/IndexedDB/#index-referenced-value
@@ -63,13 +78,7 @@ HTML::SerializationRecord Index::referenced_value(IndexRecord const& index_recor
 {
     // Records in an index are said to have a referenced value.
     // This is the value of the record in the index’s referenced object store which has a key equal to the index’s record’s value.
-    return m_object_store
-        ->records()
-        .first_matching([&](auto const& store_record) {
-            return Key::equals(store_record.key, index_record.value);
-        })
-        .value()
-        .value;
+    return m_object_store->record_with_key(index_record.value).value().value;
 }
 
 void Index::clear_records()
@@ -79,51 +88,41 @@ void Index::clear_records()
 
 Optional<IndexRecord&> Index::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto [start, end] = range->positions_in_range(m_records.span());
+    if (start == end)
+        return {};
+    return m_records[start];
 }
 
 GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
-    GC::ConservativeVector<IndexRecord> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    auto [start, end] = range->positions_in_range(m_records.span());
+    if (count.has_value())
+        end = min(end, start + *count);
 
-        if (count.has_value() && records.size() >= *count)
-            break;
-    }
+    GC::ConservativeVector<IndexRecord> records(range->heap());
+    records.ensure_capacity(end - start);
+    for (auto i = start; i < end; ++i)
+        records.unchecked_append(m_records[i]);
 
     return records;
 }
 
 u64 Index::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
-    return count;
+    auto [start, end] = range->positions_in_range(m_records.span());
+    return end - start;
 }
 
 void Index::store_a_record(IndexRecord const& record)
 {
-    m_records.append(record);
-
     // NOTE: The record is stored in index’s list of records such that the list is sorted primarily on the records keys, and secondarily on the records values, in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        auto key_comparison = Key::compare_two_keys(a.key, b.key);
-        if (key_comparison != 0)
-            return key_comparison < 0;
-
-        return Key::compare_two_keys(a.value, b.value) < 0;
-    });
+    m_records.insert(lower_bound_for_key(m_records, record.key, record.value), record);
 }
 
 void Index::remove_records_with_value_in_range(GC::Ref<IDBKeyRange> range)
 {
+    // NOTE: The records are sorted by key rather than by value, so this has to look at all of them.
     m_records.remove_all_matching([&](auto const& record) {
         return range->is_in_range(record.value);
     });
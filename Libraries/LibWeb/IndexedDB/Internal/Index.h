@@ -59,6 +59,7 @@ private:
     GC::Ref<ObjectStore> m_object_store;
 
     // The index has a list of records which hold the data stored in the index.
+    // NOTE: The list is kept sorted by key and then by value, so lookups and range queries use binary search.
     Vector<IndexRecord> m_records;
 
     // An index has a name, which is a name. At any one time, the name is unique within index’s referenced object store.
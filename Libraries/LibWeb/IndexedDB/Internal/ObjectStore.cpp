@@ -4,7 +4,6 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
 #include <LibWeb/IndexedDB/IDBKeyRange.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
 
@@ -41,47 +40,58 @@ void ObjectStore::visit_edges(Visitor& visitor)
     }
 }
 
+// Returns the position of the first record whose key is not less than the given key.
+static size_t lower_bound_for_key(ReadonlySpan<Record> records, GC::Ref<Key> key)
+{
+    size_t low = 0;
+    size_t high = records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (Key::less_than(records[middle].key, key))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
 void ObjectStore::remove_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    m_records.remove_all_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto [start, end] = range->positions_in_range(m_records.span());
+    m_records.remove(start, end - start);
 }
 
 bool ObjectStore::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(key, record.key);
-    });
+    return record_with_key(key).has_value();
+}
 
-    return index != m_records.end();
+Optional<Record const&> ObjectStore::record_with_key(GC::Ref<Key> key) const
+{
+    auto position = lower_bound_for_key(m_records, key);
+    if (position == m_records.size() || !Key::equals(m_records[position].key, key))
+        return {};
+    return m_records[position];
 }
 
 void ObjectStore::store_a_record(Record const& record)
 {
-    m_records.append(record);
-
     // NOTE: The record is stored in the object store’s list of records such that the list is sorted according to the key of the records in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        return Key::compare_two_keys(a.key, b.key) < 0;
-    });
+    m_records.insert(lower_bound_for_key(m_records, record.key), record);
 }
 
 u64 ObjectStore::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
-    return count;
+    auto [start, end] = range->positions_in_range(m_records.span());
+    return end - start;
 }
 
 Optional<Record&> ObjectStore::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto [start, end] = range->positions_in_range(m_records.span());
+    if (start == end)
+        return {};
+    return m_records[start];
 }
 
 void ObjectStore::clear_records()
@@ -91,14 +101,14 @@ void ObjectStore::clear_records()
 
 GC::ConservativeVector<Record> ObjectStore::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
-    GC::ConservativeVector<Record> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    auto [start, end] = range->positions_in_range(m_records.span());
+    if (count.has_value())
+        end = min(end, start + *count);
 
-        if (count.has_value() && records.size() >= *count)
-            break;
-    }
+    GC::ConservativeVector<Record> records(range->heap());
+    records.ensure_capacity(end - start);
+    for (auto i = start; i < end; ++i)
+        records.unchecked_append(m_records[i]);
 
     return records;
 }
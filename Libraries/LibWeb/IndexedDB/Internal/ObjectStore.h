@@ -52,6 +52,7 @@ public:
 
     void remove_records_in_range(GC::Ref<IDBKeyRange> range);
     bool has_record_with_key(GC::Ref<Key> key);
+    Optional<Record const&> record_with_key(GC::Ref<Key> key) const;
     void store_a_record(Record const& record);
     u64 count_records_in_range(GC::Ref<IDBKeyRange> range);
     Optional<Record&> first_in_range(GC::Ref<IDBKeyRange> range);
@@ -80,6 +81,7 @@ private:
     Optional<KeyGenerator> m_key_generator;
 
     // An object store has a list of records
+    // NOTE: The list is kept sorted by key, so lookups and range queries use binary search.
     Vector<Record> m_records;
 };
 
@@ -9,6 +9,7 @@
 #include <LibUnicode/TimeZone.h>
 #include <LibWeb/Bindings/InternalsPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/DOM/EventTarget.h>
@@ -18,6 +19,7 @@
 #include <LibWeb/Internals/Internals.h>
 #include <LibWeb/Page/InputEvent.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 
@@ -83,6 +85,71 @@ JS::Object* Internals::hit_test(double x, double y)
     return nullptr;
 }
 
+JS::Object* Internals::style_update_statistics()
+{
+    auto& active_document = window().associated_document();
+    auto const& statistics = active_document.style_computer().last_style_update_statistics();
+
+    auto result = JS::Object::create(realm(), nullptr);
+    auto set = [&](JS::Object& object, FlyString const& name, JS::Value value) {
+        object.define_direct_property(name, value, JS::default_attributes);
+    };
+    auto set_count = [&](JS::Object& object, FlyString const& name, u64 count) {
+        set(object, name, JS::Value(static_cast<double>(count)));
+    };
+    auto create_rule_matching_counts = [&](CSS::StyleComputationStatistics::RuleMatchingCounts const& counts) {
+        auto object = JS::Object::create(realm(), nullptr);
+        set_count(object, "tested"_fly_string, counts.rules_tested);
+        set_count(object, "matched"_fly_string, counts.rules_matched);
+        return object;
+    };
+
+    set_count(result, "elementsRestyled"_fly_string, statistics.elements_restyled);
+    set_count(result, "elementsWithInheritedStyleRecomputed"_fly_string, statistics.elements_with_inherited_style_recomputed);
+    set(result, "authorRules"_fly_string, create_rule_matching_counts(statistics.author_rules));
+    set(result, "userRules"_fly_string, create_rule_matching_counts(statistics.user_rules));
+    set(result, "userAgentRules"_fly_string, create_rule_matching_counts(statistics.user_agent_rules));
+    set_count(result, "ancestorFilterChecks"_fly_string, statistics.ancestor_filter_checks);
+    set_count(result, "ancestorFilterRejects"_fly_string, statistics.ancestor_filter_rejects);
+    set(result, "collectMatchingRulesTime"_fly_string, JS::Value(statistics.time_in_collect_matching_rules.to_microseconds() / 1000.0));
+    set(result, "computeFontTime"_fly_string, JS::Value(statistics.time_in_compute_font.to_microseconds() / 1000.0));
+
+    auto invalidations = JS::Object::create(realm(), nullptr);
+    auto const& invalidation_counts = active_document.style_invalidations_before_last_style_update();
+    for (size_t i = 0; i < invalidation_counts.size(); ++i) {
+        if (invalidation_counts[i] == 0)
+            continue;
+        auto reason = DOM::to_string(static_cast<DOM::StyleInvalidationReason>(i));
+        set_count(invalidations, MUST(FlyString::from_utf8(reason)), invalidation_counts[i]);
+    }
+    set(result, "invalidations"_fly_string, invalidations);
+
+    return result;
+}
+
+JS::Object* Internals::measure_rendering_update()
+{
+    auto& active_document = window().associated_document();
+
+    auto start_time = MonotonicTime::now();
+    active_document.update_style();
+    auto style_end_time = MonotonicTime::now();
+    active_document.update_layout(DOM::UpdateLayoutReason::InternalsMeasureRenderingUpdate);
+    auto layout_end_time = MonotonicTime::now();
+    (void)active_document.record_display_list({});
+    auto paint_end_time = MonotonicTime::now();
+
+    auto to_milliseconds = [](AK::Duration duration) {
+        return JS::Value(duration.to_microseconds() / 1000.0);
+    };
+
+    auto result = JS::Object::create(realm(), nullptr);
+    result->define_direct_property("style"_fly_string, to_milliseconds(style_end_time - start_time), JS::default_attributes);
+    result->define_direct_property("layout"_fly_string, to_milliseconds(layout_end_time - style_end_time), JS::default_attributes);
+    result->define_direct_property("paint"_fly_string, to_milliseconds(paint_end_time - layout_end_time), JS::default_attributes);
+    return result;
+}
+
 void Internals::send_text(HTML::HTMLElement& target, String const& text, WebIDL::UnsignedShort modifiers)
 {
     auto& page = this->page();
@@ -27,6 +27,8 @@ public:
 
     void gc();
     JS::Object* hit_test(double x, double y);
+    JS::Object* style_update_statistics();
+    JS::Object* measure_rendering_update();
 
     void send_text(HTML::HTMLElement&, String const&, WebIDL::UnsignedShort modifiers);
     void send_key(HTML::HTMLElement&, String const&, WebIDL::UnsignedShort modifiers);
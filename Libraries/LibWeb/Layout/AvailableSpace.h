@@ -42,6 +42,8 @@ public:
 
     String to_string() const;
 
+    unsigned hash() const { return pair_int_hash(to_underlying(m_type), AK::Traits<CSSPixels>::hash(m_value)); }
+
     bool operator==(AvailableSize const& other) const = default;
     bool operator<(AvailableSize const& other) const { return m_value < other.m_value; }
 
@@ -97,6 +99,14 @@ public:
 
 }
 
+template<>
+struct AK::Traits<Web::Layout::AvailableSpace> : public AK::DefaultTraits<Web::Layout::AvailableSpace> {
+    static unsigned hash(Web::Layout::AvailableSpace const& available_space)
+    {
+        return pair_int_hash(available_space.width.hash(), available_space.height.hash());
+    }
+};
+
 template<>
 struct AK::Formatter<Web::Layout::AvailableSize> : Formatter<StringView> {
     ErrorOr<void> format(FormatBuilder& builder, Web::Layout::AvailableSize const& available_size)
@@ -8,6 +8,7 @@
 
 #include <AK/OwnPtr.h>
 #include <LibJS/Heap/Cell.h>
+#include <LibWeb/Layout/AvailableSpace.h>
 #include <LibWeb/Layout/Node.h>
 
 namespace Web::Layout {
@@ -22,6 +23,10 @@ struct IntrinsicSizes {
     Optional<CSSPixels> max_content_width;
     HashMap<CSSPixels, Optional<CSSPixels>> min_content_height;
     HashMap<CSSPixels, Optional<CSSPixels>> max_content_height;
+
+    // Used border box sizes of the table box inside a table wrapper, keyed by the space available inside the wrapper.
+    HashMap<AvailableSpace, CSSPixels> table_box_width_inside_table_wrapper;
+    HashMap<AvailableSpace, CSSPixels> table_box_height_inside_table_wrapper;
 };
 
 class Box : public NodeWithStyleAndBoxModelMetrics {
@@ -44,6 +49,11 @@ public:
     void set_natural_height(Optional<CSSPixels> height) { m_natural_height = height; }
     void set_natural_aspect_ratio(Optional<CSSPixelFraction> ratio) { m_natural_aspect_ratio = ratio; }
 
+    // https://drafts.csswg.org/css-contain-2/#skips-its-contents
+    // While a content-visibility: auto box skips its contents, it is sized as if its contents had this size.
+    Optional<CSSPixelSize> const& skipped_contents_size() const { return m_skipped_contents_size; }
+    void set_skipped_contents_size(Badge<TreeBuilder>, CSSPixelSize size) { m_skipped_contents_size = size; }
+
     // https://www.w3.org/TR/css-sizing-4/#preferred-aspect-ratio
     Optional<CSSPixelFraction> preferred_aspect_ratio() const;
     bool has_preferred_aspect_ratio() const { return preferred_aspect_ratio().has_value(); }
@@ -76,6 +86,7 @@ private:
     virtual bool is_box() const final { return true; }
 
     Optional<CSSPixels> m_natural_width;
+    Optional<CSSPixelSize> m_skipped_contents_size;
     Optional<CSSPixels> m_natural_height;
     Optional<CSSPixelFraction> m_natural_aspect_ratio;
 
@@ -344,6 +344,9 @@ Optional<CSSPixels> FormattingContext::compute_auto_height_for_absolutely_positi
 // https://www.w3.org/TR/CSS22/visudet.html#root-height
 CSSPixels FormattingContext::compute_auto_height_for_block_formatting_context_root(Box const& root) const
 {
+    if (auto const& skipped_contents_size = root.skipped_contents_size(); skipped_contents_size.has_value())
+        return skipped_contents_size->height();
+
     // 10.6.7 'Auto' heights for block formatting context roots
     Optional<CSSPixels> top;
     Optional<CSSPixels> bottom;
@@ -434,17 +437,23 @@ CSSPixels FormattingContext::compute_table_box_width_inside_table_wrapper(Box co
     });
     VERIFY(table_box.has_value());
 
-    LayoutState throwaway_state;
+    // The table is measured in a throwaway state, so the result only depends on the subtree and the space available
+    // inside it. Remember it across layout passes until the wrapper's intrinsic sizes are invalidated.
+    auto inner_available_space = m_state.get(*table_box).available_inner_space_or_constraints_from(available_space);
+    auto& cache = box.cached_intrinsic_sizes().table_box_width_inside_table_wrapper;
+    auto table_used_width = cache.ensure(inner_available_space, [&] {
+        LayoutState throwaway_state;
 
-    auto& table_box_state = throwaway_state.get_mutable(*table_box);
-    auto const& table_box_computed_values = table_box->computed_values();
-    table_box_state.border_left = table_box_computed_values.border_left().width;
-    table_box_state.border_right = table_box_computed_values.border_right().width;
+        auto& table_box_state = throwaway_state.get_mutable(*table_box);
+        auto const& table_box_computed_values = table_box->computed_values();
+        table_box_state.border_left = table_box_computed_values.border_left().width;
+        table_box_state.border_right = table_box_computed_values.border_right().width;
 
-    auto context = make<TableFormattingContext>(throwaway_state, LayoutMode::IntrinsicSizing, *table_box, this);
-    context->run_until_width_calculation(m_state.get(*table_box).available_inner_space_or_constraints_from(available_space));
+        auto context = make<TableFormattingContext>(throwaway_state, LayoutMode::IntrinsicSizing, *table_box, this);
+        context->run_until_width_calculation(inner_available_space);
 
-    auto table_used_width = throwaway_state.get(*table_box).border_box_width();
+        return throwaway_state.get(*table_box).border_box_width();
+    });
     return available_space.width.is_definite() ? min(table_used_width, available_width) : table_used_width;
 }
 
@@ -473,12 +482,6 @@ CSSPixels FormattingContext::compute_table_box_height_inside_table_wrapper(Box c
     // table-wrapper can't have borders or paddings but it might have margin taken from table-root.
     auto available_height = height_of_containing_block - margin_top.to_px(box) - margin_bottom.to_px(box);
 
-    LayoutState throwaway_state;
-
-    auto context = create_independent_formatting_context_if_needed(throwaway_state, LayoutMode::IntrinsicSizing, box);
-    VERIFY(context);
-    context->run(m_state.get(box).available_inner_space_or_constraints_from(available_space));
-
     Optional<Box const&> table_box;
     box.for_each_in_subtree_of_type<Box>([&](Box const& child_box) {
         if (child_box.display().is_table_inside()) {
@@ -489,7 +492,17 @@ CSSPixels FormattingContext::compute_table_box_height_inside_table_wrapper(Box c
     });
     VERIFY(table_box.has_value());
 
-    auto table_used_height = throwaway_state.get(*table_box).border_box_height();
+    auto inner_available_space = m_state.get(box).available_inner_space_or_constraints_from(available_space);
+    auto& cache = box.cached_intrinsic_sizes().table_box_height_inside_table_wrapper;
+    auto table_used_height = cache.ensure(inner_available_space, [&] {
+        LayoutState throwaway_state;
+
+        auto context = create_independent_formatting_context_if_needed(throwaway_state, LayoutMode::IntrinsicSizing, box);
+        VERIFY(context);
+        context->run(inner_available_space);
+
+        return throwaway_state.get(*table_box).border_box_height();
+    });
     return available_space.height.is_definite() ? min(table_used_height, available_height) : table_used_height;
 }
 
@@ -1447,6 +1460,9 @@ CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box)
     if (box.has_natural_width())
         return *box.natural_width();
 
+    if (auto const& skipped_contents_size = box.skipped_contents_size(); skipped_contents_size.has_value())
+        return skipped_contents_size->width();
+
     auto& cache = box.cached_intrinsic_sizes().min_content_width;
     if (cache.has_value())
         return cache.value();
@@ -1479,6 +1495,9 @@ CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box)
     if (box.has_natural_width())
         return *box.natural_width();
 
+    if (auto const& skipped_contents_size = box.skipped_contents_size(); skipped_contents_size.has_value())
+        return skipped_contents_size->width();
+
     auto& cache = box.cached_intrinsic_sizes().max_content_width;
     if (cache.has_value())
         return cache.value();
@@ -1516,6 +1535,9 @@ CSSPixels FormattingContext::calculate_min_content_height(Layout::Box const& box
     if (box.has_natural_height())
         return *box.natural_height();
 
+    if (auto const& skipped_contents_size = box.skipped_contents_size(); skipped_contents_size.has_value())
+        return skipped_contents_size->height();
+
     auto& cache = box.cached_intrinsic_sizes().min_content_height.ensure(width);
     if (cache.has_value())
         return cache.value();
@@ -1547,6 +1569,9 @@ CSSPixels FormattingContext::calculate_max_content_height(Layout::Box const& box
     if (box.has_natural_height())
         return *box.natural_height();
 
+    if (auto const& skipped_contents_size = box.skipped_contents_size(); skipped_contents_size.has_value())
+        return skipped_contents_size->height();
+
     auto& cache_slot = box.cached_intrinsic_sizes().max_content_height.ensure(width);
     if (cache_slot.has_value())
         return cache_slot.value();
@@ -453,9 +453,11 @@ FoundUnoccupiedPlace OccupationGrid::find_unoccupied_place(GridDimension dimensi
         while (row_index <= max_row_index()) {
             while (column_index <= max_column_index()) {
                 auto enough_span_for_span = column_index + column_span - 1 <= max_column_index();
-                if (enough_span_for_span && !is_occupied(column_index, row_index))
+                auto occupied_columns = occupied_columns_at(column_index, row_index);
+                if (enough_span_for_span && !occupied_columns.has_value())
                     return FoundUnoccupiedPlace::Yes;
-                column_index++;
+                // Skip over the whole run of occupied columns at once.
+                column_index = occupied_columns.has_value() ? occupied_columns->end : column_index + 1;
             }
             row_index++;
             column_index = min_column_index();
@@ -2330,21 +2332,48 @@ void GridFormattingContext::init_grid_lines(GridDimension dimension)
 
 void OccupationGrid::set_occupied(int column_start, int column_end, int row_start, int row_end)
 {
+    if (column_start >= column_end || row_start >= row_end)
+        return;
+
+    m_min_column_index = min(m_min_column_index, column_start);
+    m_max_column_index = max(m_max_column_index, column_end - 1);
+    m_min_row_index = min(m_min_row_index, row_start);
+    m_max_row_index = max(m_max_row_index, row_end - 1);
+
     for (int row_index = row_start; row_index < row_end; row_index++) {
-        for (int column_index = column_start; column_index < column_end; column_index++) {
-            m_min_column_index = min(m_min_column_index, column_index);
-            m_max_column_index = max(m_max_column_index, column_index);
-            m_min_row_index = min(m_min_row_index, row_index);
-            m_max_row_index = max(m_max_row_index, row_index);
+        auto& runs = m_occupied_columns_by_row.ensure(row_index);
 
-            m_occupation_grid.set(GridPosition { .row = row_index, .column = column_index });
+        // Merge the new run with every run it overlaps or touches, keeping the runs sorted.
+        OccupiedColumns merged_run { column_start, column_end };
+        size_t index = 0;
+        while (index < runs.size() && runs[index].end < merged_run.start)
+            index++;
+        while (index < runs.size() && runs[index].start <= merged_run.end) {
+            merged_run.start = min(merged_run.start, runs[index].start);
+            merged_run.end = max(merged_run.end, runs[index].end);
+            runs.remove(index);
         }
+        runs.insert(index, merged_run);
     }
 }
 
+Optional<OccupationGrid::OccupiedColumns> OccupationGrid::occupied_columns_at(int column_index, int row_index) const
+{
+    auto runs = m_occupied_columns_by_row.get(row_index);
+    if (!runs.has_value())
+        return {};
+    for (auto const& run : *runs) {
+        if (column_index < run.start)
+            break;
+        if (column_index < run.end)
+            return run;
+    }
+    return {};
+}
+
 bool OccupationGrid::is_occupied(int column_index, int row_index) const
 {
-    return m_occupation_grid.contains(GridPosition { row_index, column_index });
+    return occupied_columns_at(column_index, row_index).has_value();
 }
 
 int GridItem::gap_adjusted_row() const
@@ -33,12 +33,6 @@ enum class Alignment {
     Unsafe,
 };
 
-struct GridPosition {
-    int row;
-    int column;
-    inline bool operator==(GridPosition const&) const = default;
-};
-
 struct GridItem {
     GC::Ref<Box const> box;
     LayoutState::UsedValues& used_values;
@@ -170,7 +164,17 @@ public:
     FoundUnoccupiedPlace find_unoccupied_place(GridDimension dimension, int& column_index, int& row_index, int column_span, int row_span) const;
 
 private:
-    HashTable<GridPosition> m_occupation_grid;
+    // A run of occupied columns [start, end) within a row.
+    struct OccupiedColumns {
+        int start { 0 };
+        int end { 0 };
+    };
+
+    Optional<OccupiedColumns> occupied_columns_at(int column_index, int row_index) const;
+
+    // Occupied cells are stored as sorted, non-overlapping column runs per row, so large items and large grids don't
+    // cost one entry per cell.
+    HashMap<int, Vector<OccupiedColumns>> m_occupied_columns_by_row;
 
     int m_min_column_index { 0 };
     int m_max_column_index { 0 };
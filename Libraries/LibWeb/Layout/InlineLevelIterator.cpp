@@ -581,7 +581,10 @@ Optional<InlineLevelIterator::Item> InlineLevelIterator::next_without_lookahead(
         }
 
         auto shape_features = create_and_merge_font_features();
-        auto glyph_run = Gfx::shape_text({ x, 0 }, letter_spacing.to_float(), chunk.view, chunk.font, text_type, shape_features);
+        // Chunks that start after a tab stop are positioned while shaping, so only the others can be reused.
+        auto glyph_run = x == 0
+            ? text_node.shape_chunk(chunk, letter_spacing.to_float(), text_type, shape_features)
+            : Gfx::shape_text({ x, 0 }, letter_spacing.to_float(), chunk.view, chunk.font, text_type, shape_features);
 
         CSSPixels chunk_width = CSSPixels::nearest_value_for(glyph_run->width() + x);
 
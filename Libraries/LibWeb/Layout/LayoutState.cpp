@@ -22,32 +22,64 @@ LayoutState::~LayoutState()
 {
 }
 
-LayoutState::UsedValues& LayoutState::get_mutable(NodeWithStyle const& node)
+LayoutState::UsedValues const* LayoutState::try_get(NodeWithStyle const& node) const
 {
-    if (auto* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
-        return *used_values;
+    auto index = node.index_in_layout_tree();
+    if (!index.has_value())
+        return m_used_values_for_unindexed_nodes.get(node).value_or(nullptr);
+
+    auto page_index = *index / used_values_page_size;
+    if (page_index >= m_used_values_pages.size() || !m_used_values_pages[page_index])
+        return nullptr;
+    return (*m_used_values_pages[page_index])[*index % used_values_page_size];
+}
 
+LayoutState::UsedValues& LayoutState::create_used_values(NodeWithStyle const& node)
+{
+    // NOTE: The containing block's used values have to exist first, and creating them may allocate used values too.
     auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
 
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
-    used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    if (m_used_values_chunks.is_empty() || m_used_values_chunks.last()->size() == m_used_values_chunks.last()->capacity()) {
+        auto chunk_size = m_used_values_chunks.is_empty() ? min_used_values_chunk_size : min(m_used_values_chunks.last()->capacity() * 2, max_used_values_chunk_size);
+        auto chunk = make<Vector<UsedValues>>();
+        chunk->ensure_capacity(chunk_size);
+        m_used_values_chunks.append(move(chunk));
+    }
+    auto& chunk = *m_used_values_chunks.last();
+    chunk.empend();
+    auto& used_values = chunk.last();
+    used_values.set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
+    m_used_values.append(&used_values);
+
+    auto index = node.index_in_layout_tree();
+    if (!index.has_value()) {
+        m_used_values_for_unindexed_nodes.set(node, &used_values);
+        return used_values;
+    }
+
+    auto page_index = *index / used_values_page_size;
+    if (page_index >= m_used_values_pages.size())
+        m_used_values_pages.resize(page_index + 1);
+    if (!m_used_values_pages[page_index]) {
+        m_used_values_pages[page_index] = make<UsedValuesPage>();
+        m_used_values_pages[page_index]->fill(nullptr);
+    }
+    (*m_used_values_pages[page_index])[*index % used_values_page_size] = &used_values;
+    return used_values;
+}
+
+LayoutState::UsedValues& LayoutState::get_mutable(NodeWithStyle const& node)
+{
+    if (auto* used_values = const_cast<UsedValues*>(try_get(node)))
+        return *used_values;
+    return create_used_values(node);
 }
 
 LayoutState::UsedValues const& LayoutState::get(NodeWithStyle const& node) const
 {
-    if (auto const* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
+    if (auto const* used_values = try_get(node))
         return *used_values;
-
-    auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
-
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
-    const_cast<LayoutState*>(this)->used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    return const_cast<LayoutState*>(this)->create_used_values(node);
 }
 
 // https://www.w3.org/TR/css-overflow-3/#scrollable-overflow
@@ -140,8 +172,8 @@ void LayoutState::resolve_relative_positions()
 {
     // This function resolves relative position offsets of fragments that belong to inline paintables.
     // It runs *after* the paint tree has been constructed, so it modifies paintable node & fragment offsets directly.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto* used_values_pointer : m_used_values) {
+        auto& used_values = *used_values_pointer;
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         for (auto& paintable : node.paintables()) {
@@ -230,7 +262,7 @@ void LayoutState::commit(Box& root)
                 auto& inline_node = const_cast<InlineNode&>(static_cast<InlineNode const&>(*parent));
                 auto line_paintable = inline_node.create_paintable_for_line_with_index(line_index);
                 line_paintable->add_fragment(fragment);
-                if (auto const* used_values = used_values_per_layout_node.get(inline_node).value_or(nullptr))
+                if (auto const* used_values = try_get(inline_node))
                     transfer_box_model_metrics(line_paintable->box_model(), *used_values);
                 if (!inline_node_paintables.contains(line_paintable.ptr())) {
                     inline_node_paintables.set(line_paintable.ptr());
@@ -242,8 +274,8 @@ void LayoutState::commit(Box& root)
         return false;
     };
 
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto* used_values_pointer : m_used_values) {
+        auto& used_values = *used_values_pointer;
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         auto paintable = node.create_paintable();
@@ -304,15 +336,15 @@ void LayoutState::commit(Box& root)
         auto line_paintable = inline_node->create_paintable_for_line_with_index(0);
         inline_node->add_paintable(line_paintable);
         inline_node_paintables.set(line_paintable.ptr());
-        if (auto const* used_values = used_values_per_layout_node.get(*inline_node).value_or(nullptr))
+        if (auto const* used_values = try_get(*inline_node))
             transfer_box_model_metrics(line_paintable->box_model(), *used_values);
     }
 
     // Resolve relative positions for regular boxes (not line box fragments):
     // NOTE: This needs to occur before fragments are transferred into the corresponding inline paintables, because
     //       after this transfer, the containing_line_box_fragment will no longer be valid.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto* used_values_pointer : m_used_values) {
+        auto& used_values = *used_values_pointer;
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         if (!node.is_box())
@@ -398,8 +430,8 @@ void LayoutState::commit(Box& root)
     }
 
     // Measure overflow in scroll containers.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto* used_values_pointer : m_used_values) {
+        auto& used_values = *used_values_pointer;
         if (!used_values.node().is_box())
             continue;
         auto const& box = static_cast<Layout::Box const&>(used_values.node());
@@ -413,8 +445,8 @@ void LayoutState::commit(Box& root)
             paintable_box.set_scroll_offset(paintable_box.scroll_offset());
     }
 
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto* used_values_pointer : m_used_values) {
+        auto& used_values = *used_values_pointer;
         auto& node = used_values.node();
         for (auto& paintable : node.paintables()) {
             Painting::PaintableBox* paintable_box = nullptr;
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/HashMap.h>
 #include <LibGfx/Path.h>
 #include <LibGfx/Point.h>
@@ -204,11 +205,30 @@ struct LayoutState {
 
     UsedValues& get_mutable(NodeWithStyle const&);
     UsedValues const& get(NodeWithStyle const&) const;
-
-    OrderedHashMap<GC::Ref<Layout::Node const>, NonnullOwnPtr<UsedValues>> used_values_per_layout_node;
+    UsedValues const* try_get(NodeWithStyle const&) const;
 
 private:
     void resolve_relative_positions();
+
+    UsedValues& create_used_values(NodeWithStyle const&);
+
+    // Used values are allocated in chunks that never reallocate, so references to them stay valid. Chunks start out
+    // small, as most throwaway states for intrinsic sizing only touch a handful of nodes.
+    static constexpr size_t min_used_values_chunk_size = 8;
+    static constexpr size_t max_used_values_chunk_size = 256;
+    Vector<NonnullOwnPtr<Vector<UsedValues>>> m_used_values_chunks;
+
+    // All used values, in the order they were created.
+    Vector<UsedValues*> m_used_values;
+
+    // Used values by the layout node's index in the layout tree. The table is split into pages that are allocated on
+    // demand, so a state that only touches a small part of the tree stays small.
+    static constexpr size_t used_values_page_size = 256;
+    using UsedValuesPage = Array<UsedValues*, used_values_page_size>;
+    Vector<OwnPtr<UsedValuesPage>> m_used_values_pages;
+
+    // Nodes created since the layout tree was last numbered.
+    HashMap<GC::Ref<Layout::Node const>, UsedValues*> m_used_values_for_unindexed_nodes;
 };
 
 inline CSSPixels clamp_to_max_dimension_value(CSSPixels value)
@@ -1451,11 +1451,41 @@ void Node::set_needs_layout_update(DOM::SetNeedsLayoutReason reason)
         return IterationDecision::Continue;
     });
 
-    for (auto* ancestor = parent(); ancestor; ancestor = ancestor->parent()) {
+    // Ancestors up to and including the nearest relayout boundary may change size, so they need layout. Changes inside
+    // the boundary can't affect the size of anything above it.
+    auto* ancestor = parent();
+    for (; ancestor; ancestor = ancestor->parent()) {
         if (ancestor->m_needs_layout_update)
-            break;
+            return;
         ancestor->m_needs_layout_update = true;
+        if (ancestor->is_relayout_boundary())
+            break;
     }
+    if (!ancestor)
+        return;
+
+    for (ancestor = ancestor->parent(); ancestor; ancestor = ancestor->parent()) {
+        if (ancestor->m_needs_layout_update || ancestor->m_child_needs_layout_update)
+            break;
+        ancestor->m_child_needs_layout_update = true;
+    }
+}
+
+bool Node::is_relayout_boundary() const
+{
+    if (!is<Box>(*this) || !has_size_containment())
+        return false;
+
+    // NOTE: Without layout containment, the contents can still affect what's outside of the box, e.g. through floats
+    //       that overhang it, or descendants establishing the baseline of the box or being positioned relative to an
+    //       ancestor outside of it.
+    if (!has_layout_containment())
+        return false;
+
+    // NOTE: Size containment makes the box's intrinsic size ignore its contents, but an automatic or percentage size
+    //       could still be resolved against its contents or its surroundings.
+    auto const& computed_values = this->computed_values();
+    return computed_values.width().is_length() && computed_values.height().is_length();
 }
 
 }
@@ -45,9 +45,21 @@ public:
     DOM::Element const* pseudo_element_generator() const;
     DOM::Element* pseudo_element_generator();
 
+    // A node needs layout if something about it or its descendants changed in a way that can affect its size, and so
+    // its cached intrinsic sizes are stale. The ancestors of a relayout boundary only have child_needs_layout_update()
+    // set when something inside the boundary changes, as that can't affect their size.
     bool needs_layout_update() const { return m_needs_layout_update; }
+    bool child_needs_layout_update() const { return m_child_needs_layout_update; }
     void set_needs_layout_update(DOM::SetNeedsLayoutReason);
-    void reset_needs_layout_update() { m_needs_layout_update = false; }
+    void reset_needs_layout_update()
+    {
+        m_needs_layout_update = false;
+        m_child_needs_layout_update = false;
+    }
+
+    // A box whose layout is isolated from its contents: it has size and layout containment (e.g. from contain: strict)
+    // and a fixed width and height.
+    bool is_relayout_boundary() const;
 
     bool is_generated() const { return m_generated_for.has_value(); }
     Optional<CSS::PseudoElement> generated_for_pseudo_element() const { return m_generated_for; }
@@ -137,6 +149,11 @@ public:
 
     void recompute_containing_block(Badge<DOM::Document>);
 
+    // A dense index assigned in tree order before each layout, so LayoutState can keep used values in a flat table.
+    // Nodes created since the tree was last numbered don't have one.
+    Optional<u32> index_in_layout_tree() const { return m_index_in_layout_tree; }
+    void set_index_in_layout_tree(Badge<DOM::Document>, u32 index) { m_index_in_layout_tree = index; }
+
     [[nodiscard]] Box const* static_position_containing_block() const;
     [[nodiscard]] Box* static_position_containing_block() { return const_cast<Box*>(const_cast<Node const*>(this)->static_position_containing_block()); }
 
@@ -224,9 +241,12 @@ private:
     bool m_has_been_wrapped_in_table_wrapper { false };
 
     bool m_needs_layout_update { false };
+    bool m_child_needs_layout_update { false };
 
     Optional<CSS::PseudoElement> m_generated_for {};
 
+    Optional<u32> m_index_in_layout_tree;
+
     u32 m_initial_quote_nesting_level { 0 };
 };
 
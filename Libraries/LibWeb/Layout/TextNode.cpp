@@ -309,6 +309,61 @@ void TextNode::invalidate_text_for_rendering()
 {
     m_text_for_rendering = {};
     m_grapheme_segmenter.clear();
+    m_shaped_chunks.clear();
+}
+
+bool TextNode::ShapedChunkKey::operator==(ShapedChunkKey const& other) const
+{
+    if (start != other.start || length != other.length || font != other.font || text_type != other.text_type || letter_spacing != other.letter_spacing)
+        return false;
+    if (features.size() != other.features.size())
+        return false;
+    for (size_t i = 0; i < features.size(); ++i) {
+        if (StringView { features[i].tag, sizeof(features[i].tag) } != StringView { other.features[i].tag, sizeof(other.features[i].tag) } || features[i].value != other.features[i].value)
+            return false;
+    }
+    return true;
+}
+
+unsigned TextNode::ShapedChunkKeyTraits::hash(ShapedChunkKey const& key)
+{
+    auto hash = pair_int_hash(Traits<size_t>::hash(key.start), Traits<size_t>::hash(key.length));
+    hash = pair_int_hash(hash, ptr_hash(key.font));
+    hash = pair_int_hash(hash, to_underlying(key.text_type));
+    hash = pair_int_hash(hash, Traits<float>::hash(key.letter_spacing));
+    for (auto const& feature : key.features)
+        hash = pair_int_hash(hash, pair_int_hash(string_hash(feature.tag, sizeof(feature.tag)), feature.value));
+    return hash;
+}
+
+NonnullRefPtr<Gfx::GlyphRun> TextNode::shape_chunk(Chunk const& chunk, float letter_spacing, Gfx::GlyphRun::TextType text_type, Gfx::ShapeFeatures const& features) const
+{
+    // Line boxes merge and truncate the glyph runs they are given, so hand out a copy of the cached run.
+    auto copy_of = [](Gfx::GlyphRun const& glyph_run) {
+        auto glyphs = glyph_run.glyphs();
+        return adopt_ref(*new Gfx::GlyphRun(move(glyphs), glyph_run.font(), glyph_run.text_type(), glyph_run.width()));
+    };
+
+    ShapedChunkKey key {
+        .start = chunk.start,
+        .length = chunk.length,
+        .font = chunk.font.ptr(),
+        .text_type = text_type,
+        .letter_spacing = letter_spacing,
+        .features = features,
+    };
+
+    auto text = chunk.view.as_string();
+    if (auto it = m_shaped_chunks.find(key); it != m_shaped_chunks.end() && it->value.text == text)
+        return copy_of(*it->value.glyph_run);
+
+    auto glyph_run = Gfx::shape_text({ 0, 0 }, letter_spacing, chunk.view, chunk.font, text_type, features);
+
+    // Keep a node whose style keeps changing (e.g. an animated letter-spacing) from growing its cache forever.
+    if (m_shaped_chunks.size() >= max_shaped_chunk_cache_size)
+        m_shaped_chunks.clear();
+    m_shaped_chunks.set(move(key), { .text = ByteString { text }, .glyph_run = copy_of(*glyph_run) });
+    return glyph_run;
 }
 
 String const& TextNode::text_for_rendering() const
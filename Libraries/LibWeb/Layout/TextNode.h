@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
 #include <AK/Utf8View.h>
 #include <LibGfx/TextLayout.h>
 #include <LibUnicode/Segmenter.h>
@@ -66,13 +68,41 @@ public:
 
     Unicode::Segmenter& grapheme_segmenter() const;
 
+    // Shapes a chunk of this node's text for rendering, reusing the result of an earlier layout pass or intrinsic
+    // size probe where possible. The returned glyph run is always a fresh copy that the caller may modify.
+    NonnullRefPtr<Gfx::GlyphRun> shape_chunk(Chunk const&, float letter_spacing, Gfx::GlyphRun::TextType, Gfx::ShapeFeatures const&) const;
+
     virtual GC::Ptr<Painting::Paintable> create_paintable() const override;
 
 private:
     virtual bool is_text_node() const final { return true; }
 
+    struct ShapedChunkKey {
+        size_t start { 0 };
+        size_t length { 0 };
+        Gfx::Font const* font { nullptr };
+        Gfx::GlyphRun::TextType text_type;
+        float letter_spacing { 0 };
+        Gfx::ShapeFeatures features;
+
+        bool operator==(ShapedChunkKey const&) const;
+    };
+
+    struct ShapedChunkKeyTraits : public DefaultTraits<ShapedChunkKey> {
+        static unsigned hash(ShapedChunkKey const&);
+    };
+
+    struct ShapedChunk {
+        // The shaped text, so that a cached run is never used for text that changed underneath it.
+        ByteString text;
+        NonnullRefPtr<Gfx::GlyphRun const> glyph_run;
+    };
+
+    static constexpr size_t max_shaped_chunk_cache_size = 4096;
+
     Optional<String> m_text_for_rendering;
     mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
+    mutable HashMap<ShapedChunkKey, ShapedChunk, ShapedChunkKeyTraits> m_shaped_chunks;
 };
 
 template<>
@@ -488,6 +488,11 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     } else {
         if (is<DOM::Element>(dom_node)) {
             auto& element = static_cast<DOM::Element&>(dom_node);
+            // An element that left the top layer leaves its ::backdrop box behind in the viewport.
+            if (!element.rendered_in_top_layer()) {
+                if (auto backdrop = element.get_pseudo_element_node(CSS::PseudoElement::Backdrop); backdrop && backdrop->parent())
+                    backdrop->remove();
+            }
             element.clear_pseudo_element_nodes({});
             VERIFY(!element.needs_style_update());
             style = element.computed_properties();
@@ -524,29 +529,45 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
         m_layout_root = layout_node;
     } else if (should_create_layout_node) {
         // Decide whether to replace an existing node (partial tree update) or insert a new one appropriately.
+        // NOTE: An element that just entered the top layer moves from its place in the flow to the viewport, so its old
+        //       node is not in the right place to be replaced.
         bool const may_replace_existing_layout_node = must_create_subtree == MustCreateSubtree::No
             && old_layout_node
             && old_layout_node->parent()
+            && (!context.layout_top_layer || old_layout_node->parent() == m_ancestor_stack.last().ptr())
             && old_layout_node != layout_node;
         if (may_replace_existing_layout_node) {
             old_layout_node->parent()->replace_child(*layout_node, *old_layout_node);
-        } else if (layout_node->is_svg_box()) {
-            m_ancestor_stack.last()->append_child(*layout_node);
         } else {
-            insert_node_into_inline_or_block_ancestor(*layout_node, display, AppendOrPrepend::Append);
+            // The old node may still be attached somewhere else, e.g. in the viewport after leaving the top layer.
+            if (old_layout_node && old_layout_node->parent() && old_layout_node != layout_node)
+                old_layout_node->remove();
+            if (layout_node->is_svg_box())
+                m_ancestor_stack.last()->append_child(*layout_node);
+            else
+                insert_node_into_inline_or_block_ancestor(*layout_node, display, AppendOrPrepend::Append);
         }
     }
 
     auto shadow_root = is<DOM::Element>(dom_node) ? as<DOM::Element>(dom_node).shadow_root() : nullptr;
 
-    auto element_has_content_visibility_hidden = [&dom_node]() {
+    auto element_skips_its_contents = [&dom_node]() {
         if (is<DOM::Element>(dom_node)) {
             auto& element = static_cast<DOM::Element&>(dom_node);
-            return element.computed_properties()->content_visibility() == CSS::ContentVisibility::Hidden;
+            return element.skips_its_contents();
         }
         return false;
     }();
 
+    // https://drafts.csswg.org/css-contain-2/#valdef-content-visibility-auto
+    // While a content-visibility: auto element skips its contents, it is size contained. Size it as it was the last
+    // time its contents were laid out, so that content coming in and out of view doesn't shift the rest of the page.
+    if (should_create_layout_node && element_skips_its_contents) {
+        auto& element = static_cast<DOM::Element&>(dom_node);
+        if (auto* box = as_if<Box>(*layout_node); box && element.computed_properties()->content_visibility() == CSS::ContentVisibility::Auto)
+            box->set_skipped_contents_size({}, element.last_remembered_content_size().value_or({}));
+    }
+
     auto prior_quote_nesting_level = m_quote_nesting_level;
 
     if (should_create_layout_node) {
@@ -556,11 +577,11 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
             CSS::resolve_counters(element_reference);
         }
 
-        update_layout_tree_before_children(dom_node, *layout_node, context, element_has_content_visibility_hidden);
+        update_layout_tree_before_children(dom_node, *layout_node, context, element_skips_its_contents);
     }
 
     if (should_create_layout_node || dom_node.child_needs_layout_tree_update()) {
-        if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+        if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children() && !element_skips_its_contents) {
             push_parent(as<NodeWithStyle>(*layout_node));
             if (shadow_root) {
                 for (auto* node = shadow_root->first_child(); node; node = node->next_sibling()) {
@@ -613,7 +634,7 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     }
 
     if (should_create_layout_node) {
-        update_layout_tree_after_children(dom_node, *layout_node, context, element_has_content_visibility_hidden);
+        update_layout_tree_after_children(dom_node, *layout_node, context, element_skips_its_contents);
         wrap_in_button_layout_tree_if_needed(dom_node, *layout_node);
 
         // If we completely finished inserting a block level element into an inline parent, we need to fix up the tree so
@@ -702,10 +723,10 @@ void TreeBuilder::wrap_in_button_layout_tree_if_needed(DOM::Node& dom_node, GC::
     }
 }
 
-void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context&, bool element_has_content_visibility_hidden)
+void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context&, bool element_skips_its_contents)
 {
     // Add node for the ::before pseudo-element.
-    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_skips_its_contents) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         push_parent(as<NodeWithStyle>(*layout_node));
         create_pseudo_element_if_needed(element, CSS::PseudoElement::Before, AppendOrPrepend::Prepend);
@@ -713,7 +734,7 @@ void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Re
     }
 }
 
-void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context& context, bool element_has_content_visibility_hidden)
+void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context& context, bool element_skips_its_contents)
 {
     auto& document = dom_node.document();
     auto& style_computer = document.style_computer();
@@ -749,7 +770,7 @@ void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref
     }
 
     // Add nodes for the ::after pseudo-element.
-    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_skips_its_contents) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         push_parent(as<NodeWithStyle>(*layout_node));
         create_pseudo_element_if_needed(element, CSS::PseudoElement::After, AppendOrPrepend::Append);
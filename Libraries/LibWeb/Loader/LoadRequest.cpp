@@ -23,7 +23,7 @@ LoadRequest LoadRequest::create_for_url_on_page(const URL::URL& url, Page* page)
     request.set_url(url);
 
     if (page) {
-        auto cookie = page->client().page_did_request_cookie(url, Cookie::Source::Http);
+        auto cookie = page->client().page_did_request_cookie(url, Cookie::Source::Http).value;
         if (!cookie.is_empty())
             request.set_header("Cookie", cookie.to_byte_string());
         request.set_page(*page);
@@ -13,6 +13,7 @@
 #include <LibURL/URL.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Page/Page.h>
+#include <RequestServer/RequestPriority.h>
 
 namespace Web {
 
@@ -46,6 +47,19 @@ public:
     GC::Ptr<Page> page() const { return m_page.ptr(); }
     void set_page(Page& page) { m_page = page; }
 
+    // Identifies the network partition this request belongs to for RequestServer's disk cache. Requests without one
+    // bypass that cache.
+    ByteString const& cache_partition_key() const { return m_cache_partition_key; }
+    void set_cache_partition_key(ByteString cache_partition_key) { m_cache_partition_key = move(cache_partition_key); }
+
+    RequestServer::RequestPriority priority() const { return m_priority; }
+    void set_priority(RequestServer::RequestPriority priority) { m_priority = priority; }
+
+    // Whether RequestServer may send this request as TLS 1.3 early data on a resumed connection. Early data can be
+    // replayed by an attacker, so this is off unless the request is known to be safe to repeat.
+    bool allow_tls_early_data() const { return m_allow_tls_early_data; }
+    void set_allow_tls_early_data(bool allow_tls_early_data) { m_allow_tls_early_data = allow_tls_early_data; }
+
     unsigned hash() const
     {
         auto body_hash = string_hash((char const*)m_body.data(), m_body.size());
@@ -80,6 +94,9 @@ private:
     ByteString m_method { "GET" };
     HashMap<ByteString, ByteString, CaseInsensitiveStringTraits> m_headers;
     ByteBuffer m_body;
+    ByteString m_cache_partition_key;
+    RequestServer::RequestPriority m_priority { RequestServer::RequestPriority::Medium };
+    bool m_allow_tls_early_data { false };
     Core::ElapsedTimer m_load_timer;
     GC::Root<Page> m_page;
     bool m_main_resource { false };
@@ -531,7 +531,7 @@ RefPtr<Requests::Request> ResourceLoader::start_network_request(LoadRequest cons
     if (!headers.contains("User-Agent"))
         headers.set("User-Agent", m_user_agent.to_byte_string());
 
-    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), headers, request.body(), proxy);
+    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), headers, request.body(), proxy, request.cache_partition_key(), request.priority(), request.allow_tls_early_data());
     if (!protocol_request) {
         log_failure(request, "Failed to initiate load"sv);
         return nullptr;
@@ -716,7 +716,7 @@ EventResult EventHandler::handle_mousedown(CSSPixelPoint viewport_position, CSSP
     return EventResult::Handled;
 }
 
-EventResult EventHandler::handle_mousemove(CSSPixelPoint viewport_position, CSSPixelPoint screen_position, u32 buttons, u32 modifiers)
+EventResult EventHandler::handle_mousemove(CSSPixelPoint viewport_position, CSSPixelPoint screen_position, u32 buttons, u32 modifiers, ReadonlySpan<CoalescedMousePosition> coalesced_positions)
 {
     if (should_ignore_device_input_event())
         return EventResult::Dropped;
@@ -759,8 +759,16 @@ EventResult EventHandler::handle_mousemove(CSSPixelPoint viewport_position, CSSP
         auto node = dom_node_for_event_dispatch(*paintable);
 
         if (node && is<HTML::HTMLIFrameElement>(*node)) {
-            if (auto content_navigable = static_cast<HTML::HTMLIFrameElement&>(*node).content_navigable())
-                return content_navigable->event_handler().handle_mousemove(viewport_position.translated(compute_mouse_event_offset({}, *paintable)), screen_position, buttons, modifiers);
+            if (auto content_navigable = static_cast<HTML::HTMLIFrameElement&>(*node).content_navigable()) {
+                auto iframe_offset = compute_mouse_event_offset({}, *paintable);
+
+                Vector<CoalescedMousePosition> translated_coalesced_positions;
+                translated_coalesced_positions.ensure_capacity(coalesced_positions.size());
+                for (auto const& position : coalesced_positions)
+                    translated_coalesced_positions.unchecked_append({ position.viewport_position.translated(iframe_offset), position.screen_position });
+
+                return content_navigable->event_handler().handle_mousemove(viewport_position.translated(iframe_offset), screen_position, buttons, modifiers, translated_coalesced_positions);
+            }
             return EventResult::Dropped;
         }
 
@@ -787,13 +795,44 @@ EventResult EventHandler::handle_mousemove(CSSPixelPoint viewport_position, CSSP
                 hovered_node_cursor = resolve_cursor(static_cast<Layout::NodeWithStyle&>(*layout_node), cursor_data, Gfx::StandardCursor::Arrow);
             }
 
+            // https://w3c.github.io/pointerevents/#coalesced-events
+            // The mouse moves that were merged into this one are exposed through getCoalescedEvents(), followed by this
+            // event itself.
+            Vector<GC::Ref<UIEvents::PointerEvent>> coalesced_events;
+            if (!coalesced_positions.is_empty()) {
+                auto previous_screen_position = m_mousemove_previous_screen_position;
+                coalesced_events.ensure_capacity(coalesced_positions.size() + 1);
+
+                auto append_coalesced_event = [&](CSSPixelPoint coalesced_viewport_position, CSSPixelPoint coalesced_screen_position) {
+                    auto coalesced_page_offset = compute_mouse_event_page_offset(coalesced_viewport_position);
+                    auto coalesced_offset = compute_mouse_event_offset(coalesced_page_offset, *layout_node->first_paintable());
+                    auto coalesced_movement = compute_mouse_event_movement(coalesced_screen_position);
+                    m_mousemove_previous_screen_position = coalesced_screen_position;
+
+                    auto coalesced_event = UIEvents::PointerEvent::create_from_platform_event(node->realm(), UIEvents::EventNames::pointermove, coalesced_screen_position, coalesced_page_offset, coalesced_viewport_position, coalesced_offset, coalesced_movement, UIEvents::MouseButton::Primary, buttons, modifiers).release_value_but_fixme_should_propagate_errors();
+                    coalesced_event->set_bubbles(false);
+                    coalesced_event->set_cancelable(false);
+                    coalesced_event->set_target(node.ptr());
+                    coalesced_events.unchecked_append(coalesced_event);
+                };
+
+                for (auto const& position : coalesced_positions)
+                    append_coalesced_event(position.viewport_position, position.screen_position);
+                append_coalesced_event(viewport_position, screen_position);
+
+                m_mousemove_previous_screen_position = previous_screen_position;
+            }
+
             auto page_offset = compute_mouse_event_page_offset(viewport_position);
             auto offset = compute_mouse_event_offset(page_offset, *layout_node->first_paintable());
             auto movement = compute_mouse_event_movement(screen_position);
 
             m_mousemove_previous_screen_position = screen_position;
 
-            bool continue_ = node->dispatch_event(UIEvents::PointerEvent::create_from_platform_event(node->realm(), UIEvents::EventNames::pointermove, screen_position, page_offset, viewport_position, offset, movement, UIEvents::MouseButton::Primary, buttons, modifiers).release_value_but_fixme_should_propagate_errors());
+            auto pointer_event = UIEvents::PointerEvent::create_from_platform_event(node->realm(), UIEvents::EventNames::pointermove, screen_position, page_offset, viewport_position, offset, movement, UIEvents::MouseButton::Primary, buttons, modifiers).release_value_but_fixme_should_propagate_errors();
+            pointer_event->set_coalesced_events(move(coalesced_events));
+
+            bool continue_ = node->dispatch_event(pointer_event);
             if (!continue_)
                 return EventResult::Cancelled;
             continue_ = node->dispatch_event(UIEvents::MouseEvent::create_from_platform_event(node->realm(), UIEvents::EventNames::mousemove, screen_position, page_offset, viewport_position, offset, movement, UIEvents::MouseButton::Primary, buttons, modifiers).release_value_but_fixme_should_propagate_errors());
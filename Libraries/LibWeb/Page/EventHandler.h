@@ -21,6 +21,11 @@
 
 namespace Web {
 
+struct CoalescedMousePosition {
+    CSSPixelPoint viewport_position;
+    CSSPixelPoint screen_position;
+};
+
 class EventHandler {
 public:
     explicit EventHandler(Badge<HTML::Navigable>, HTML::Navigable&);
@@ -28,7 +33,7 @@ public:
 
     EventResult handle_mouseup(CSSPixelPoint, CSSPixelPoint screen_position, unsigned button, unsigned buttons, unsigned modifiers);
     EventResult handle_mousedown(CSSPixelPoint, CSSPixelPoint screen_position, unsigned button, unsigned buttons, unsigned modifiers);
-    EventResult handle_mousemove(CSSPixelPoint, CSSPixelPoint screen_position, unsigned buttons, unsigned modifiers);
+    EventResult handle_mousemove(CSSPixelPoint, CSSPixelPoint screen_position, unsigned buttons, unsigned modifiers, ReadonlySpan<CoalescedMousePosition> coalesced_positions = {});
     EventResult handle_mousewheel(CSSPixelPoint, CSSPixelPoint screen_position, unsigned button, unsigned buttons, unsigned modifiers, int wheel_delta_x, int wheel_delta_y);
     EventResult handle_doubleclick(CSSPixelPoint, CSSPixelPoint screen_position, unsigned button, unsigned buttons, unsigned modifiers);
 
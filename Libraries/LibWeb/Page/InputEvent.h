@@ -85,10 +85,18 @@ struct DragEvent {
 
 using InputEvent = Variant<KeyEvent, MouseEvent, DragEvent>;
 
+// A mouse move that was merged into a later one before it could be handled. These are kept so that the pointermove
+// event dispatched for the later mouse move can still expose them through getCoalescedEvents().
+struct CoalescedMouseMove {
+    Web::DevicePixelPoint position;
+    Web::DevicePixelPoint screen_position;
+};
+
 struct QueuedInputEvent {
     u64 page_id { 0 };
     InputEvent event;
     size_t coalesced_event_count { 0 };
+    Vector<CoalescedMouseMove> coalesced_mouse_moves;
 };
 
 }
@@ -204,9 +204,14 @@ EventResult Page::handle_mousedown(DevicePixelPoint position, DevicePixelPoint s
     return top_level_traversable()->event_handler().handle_mousedown(device_to_css_point(position), device_to_css_point(screen_position), button, buttons, modifiers);
 }
 
-EventResult Page::handle_mousemove(DevicePixelPoint position, DevicePixelPoint screen_position, unsigned buttons, unsigned modifiers)
+EventResult Page::handle_mousemove(DevicePixelPoint position, DevicePixelPoint screen_position, unsigned buttons, unsigned modifiers, ReadonlySpan<CoalescedMouseMove> coalesced_mouse_moves)
 {
-    return top_level_traversable()->event_handler().handle_mousemove(device_to_css_point(position), device_to_css_point(screen_position), buttons, modifiers);
+    Vector<CoalescedMousePosition> coalesced_positions;
+    coalesced_positions.ensure_capacity(coalesced_mouse_moves.size());
+    for (auto const& mouse_move : coalesced_mouse_moves)
+        coalesced_positions.unchecked_append({ device_to_css_point(mouse_move.position), device_to_css_point(mouse_move.screen_position) });
+
+    return top_level_traversable()->event_handler().handle_mousemove(device_to_css_point(position), device_to_css_point(screen_position), buttons, modifiers, coalesced_positions);
 }
 
 EventResult Page::handle_mousewheel(DevicePixelPoint position, DevicePixelPoint screen_position, unsigned button, unsigned buttons, unsigned modifiers, DevicePixels wheel_delta_x, DevicePixels wheel_delta_y)
@@ -44,6 +44,9 @@ void CanvasPaintable::paint(PaintContext& context, PaintPhase phase) const
             const_cast<HTML::HTMLCanvasElement&>(layout_box().dom_node()).present();
             auto scaling_mode = to_gfx_scaling_mode(computed_values().image_rendering(), surface->rect(), canvas_rect.to_type<int>());
             context.display_list_recorder().draw_painting_surface(canvas_rect.to_type<int>(), *layout_box().dom_node().surface(), surface->rect(), scaling_mode);
+        } else if (auto frame = layout_box().dom_node().placeholder_frame()) {
+            auto scaling_mode = to_gfx_scaling_mode(computed_values().image_rendering(), frame->rect(), canvas_rect.to_type<int>());
+            context.display_list_recorder().draw_scaled_immutable_bitmap(canvas_rect.to_type<int>(), canvas_rect.to_type<int>(), *frame, scaling_mode);
         }
     }
 }
@@ -4,11 +4,24 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Math.h>
+#include <LibGfx/Font/Font.h>
 #include <LibWeb/Painting/Command.h>
 #include <LibWeb/Painting/ShadowPainting.h>
 
 namespace Web::Painting {
 
+Gfx::IntRect DrawGlyphRun::bounding_rect() const
+{
+    // NOTE: The rect is that of the fragment the glyphs belong to, but glyphs may overhang it (italics, diacritics,
+    //       vertical text, or a line-height smaller than the font), so pad it generously to never cull visible ink.
+    auto font_size = static_cast<int>(ceil(glyph_run->font().pixel_size() * scale));
+    auto padding = max(font_size, rect.height());
+    if (orientation == Gfx::Orientation::Vertical)
+        padding = max(padding, rect.width());
+    return rect.inflated(padding * 2, padding * 2);
+}
+
 void DrawGlyphRun::translate_by(Gfx::IntPoint const& offset)
 {
     rect.translate_by(offset);
@@ -25,6 +25,7 @@
 #include <LibGfx/Size.h>
 #include <LibGfx/TextAlignment.h>
 #include <LibGfx/TextLayout.h>
+#include <LibGfx/YUVData.h>
 #include <LibWeb/CSS/ComputedValues.h>
 #include <LibWeb/CSS/Enums.h>
 #include <LibWeb/Painting/BorderRadiiData.h>
@@ -46,6 +47,7 @@ struct DrawGlyphRun {
     Color color;
     Gfx::Orientation orientation { Gfx::Orientation::Horizontal };
 
+    [[nodiscard]] Gfx::IntRect bounding_rect() const;
     void translate_by(Gfx::IntPoint const& offset);
 };
 
@@ -81,6 +83,20 @@ struct DrawScaledImmutableBitmap {
     }
 };
 
+struct DrawScaledYUVData {
+    Gfx::IntRect dst_rect;
+    Gfx::IntRect clip_rect;
+    NonnullRefPtr<Gfx::YUVData const> yuv_data;
+    Gfx::ScalingMode scaling_mode;
+
+    [[nodiscard]] Gfx::IntRect bounding_rect() const { return clip_rect; }
+    void translate_by(Gfx::IntPoint const& offset)
+    {
+        dst_rect.translate_by(offset);
+        clip_rect.translate_by(offset);
+    }
+};
+
 struct DrawRepeatedImmutableBitmap {
     struct Repeat {
         bool x { false };
@@ -454,6 +470,7 @@ using Command = Variant<
     FillRect,
     DrawPaintingSurface,
     DrawScaledImmutableBitmap,
+    DrawScaledYUVData,
     DrawRepeatedImmutableBitmap,
     Save,
     SaveLayer,
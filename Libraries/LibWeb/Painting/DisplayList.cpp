@@ -8,11 +8,6 @@
 
 namespace Web::Painting {
 
-void DisplayList::append(Command&& command, Optional<i32> scroll_frame_id)
-{
-    m_commands.append({ scroll_frame_id, move(command) });
-}
-
 static Optional<Gfx::IntRect> command_bounding_rectangle(Command const& command)
 {
     return command.visit(
@@ -35,12 +30,56 @@ static bool command_is_clip_or_mask(Command const& command)
         });
 }
 
-void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface)
+// A drawing command has a bounding rect that moves along with scrolling, and leaves the painter state untouched.
+static Optional<Gfx::IntRect> drawing_command_bounding_rect(Command const& command)
+{
+    if (command.has<PaintScrollBar>() || command_is_clip_or_mask(command))
+        return {};
+    return command.visit(
+        [&](auto const& command) -> Optional<Gfx::IntRect> {
+            if constexpr (requires { command.bounding_rect(); command.translate_by(Gfx::IntPoint {}); })
+                return command.bounding_rect();
+            else
+                return {};
+        });
+}
+
+void DisplayList::append(Command&& command, Optional<i32> scroll_frame_id)
+{
+    if (command.has<DrawPaintingSurface>() || command.has<PaintNestedDisplayList>())
+        m_has_externally_updated_content = true;
+
+    if (auto bounding_rect = drawing_command_bounding_rect(command); bounding_rect.has_value()) {
+        auto index = m_commands.size();
+        if (!m_drawing_command_runs.is_empty() && m_drawing_command_runs.last().end == index && m_drawing_command_runs.last().scroll_frame_id == scroll_frame_id) {
+            auto& run = m_drawing_command_runs.last();
+            run.end = index + 1;
+            run.bounding_rect.unite(*bounding_rect);
+        } else {
+            m_drawing_command_runs.append({ index, index + 1, scroll_frame_id, *bounding_rect });
+        }
+    }
+
+    m_commands.append({ scroll_frame_id, move(command) });
+}
+
+void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface, Optional<Gfx::IntRect> damage_rect)
 {
     if (surface) {
         surface->lock_context();
     }
+    if (damage_rect.has_value()) {
+        // Clip the whole replay to the damage rect, so that commands outside of it get culled.
+        VERIFY(surface);
+        m_surfaces.append(*surface);
+        save({});
+        add_clip_rect({ *damage_rect });
+    }
     execute_impl(display_list, scroll_state, surface);
+    if (damage_rect.has_value()) {
+        restore({});
+        (void)m_surfaces.take_last();
+    }
     if (surface) {
         surface->unlock_context();
     }
@@ -60,8 +99,39 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
 
     VERIFY(!m_surfaces.is_empty());
 
+    auto scroll_offset_for_frame = [&](Optional<i32> scroll_frame_id) -> Gfx::IntPoint {
+        if (!scroll_frame_id.has_value())
+            return {};
+        auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(scroll_frame_id.value());
+        return cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>();
+    };
+
+    auto const& drawing_command_runs = display_list.drawing_command_runs();
+    size_t next_drawing_command_run = 0;
+
     for (size_t command_index = 0; command_index < commands.size(); command_index++) {
+        while (next_drawing_command_run < drawing_command_runs.size() && drawing_command_runs[next_drawing_command_run].start < command_index)
+            ++next_drawing_command_run;
+        if (next_drawing_command_run < drawing_command_runs.size() && drawing_command_runs[next_drawing_command_run].start == command_index) {
+            // Nothing inside a run of drawing commands changes the clip, so if the whole run is clipped out, we can skip
+            // all of its commands without looking at them individually.
+            auto const& run = drawing_command_runs[next_drawing_command_run];
+            auto bounding_rect = run.bounding_rect.translated(scroll_offset_for_frame(run.scroll_frame_id));
+            if (bounding_rect.is_empty() || would_be_fully_clipped_by_painter(bounding_rect)) {
+                command_index = run.end - 1;
+                continue;
+            }
+        }
+
         auto scroll_frame_id = commands[command_index].scroll_frame_id;
+
+        // Check the bounding rect before copying the command, which can be expensive.
+        if (auto bounding_rect = drawing_command_bounding_rect(commands[command_index].command); bounding_rect.has_value()) {
+            bounding_rect->translate_by(scroll_offset_for_frame(scroll_frame_id));
+            if (bounding_rect->is_empty() || would_be_fully_clipped_by_painter(*bounding_rect))
+                continue;
+        }
+
         auto command = commands[command_index].command;
 
         if (command.has<PaintScrollBar>()) {
@@ -77,8 +147,7 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         }
 
         if (scroll_frame_id.has_value()) {
-            auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(scroll_frame_id.value());
-            auto scroll_offset = cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>();
+            auto scroll_offset = scroll_offset_for_frame(scroll_frame_id);
             command.visit(
                 [&](auto& command) {
                     if constexpr (requires { command.translate_by(scroll_offset); }) {
@@ -111,6 +180,7 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         else HANDLE_COMMAND(FillRect, fill_rect)
         else HANDLE_COMMAND(DrawPaintingSurface, draw_painting_surface)
         else HANDLE_COMMAND(DrawScaledImmutableBitmap, draw_scaled_immutable_bitmap)
+        else HANDLE_COMMAND(DrawScaledYUVData, draw_scaled_yuv_data)
         else HANDLE_COMMAND(DrawRepeatedImmutableBitmap, draw_repeated_immutable_bitmap)
         else HANDLE_COMMAND(AddClipRect, add_clip_rect)
         else HANDLE_COMMAND(Save, save)
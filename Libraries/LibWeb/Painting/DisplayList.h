@@ -14,6 +14,7 @@
 #include <LibGfx/Forward.h>
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibGfx/PaintStyle.h>
+#include <LibIPC/Forward.h>
 #include <LibWeb/CSS/Enums.h>
 #include <LibWeb/Painting/Command.h>
 #include <LibWeb/Painting/ScrollState.h>
@@ -26,7 +27,8 @@ class DisplayListPlayer {
 public:
     virtual ~DisplayListPlayer() = default;
 
-    void execute(DisplayList&, ScrollStateSnapshot const&, RefPtr<Gfx::PaintingSurface>);
+    // If a damage rect is given, only the part of the surface inside it is repainted.
+    void execute(DisplayList&, ScrollStateSnapshot const&, RefPtr<Gfx::PaintingSurface>, Optional<Gfx::IntRect> damage_rect = {});
 
 protected:
     Gfx::PaintingSurface& surface() const { return m_surfaces.last(); }
@@ -38,6 +40,7 @@ private:
     virtual void fill_rect(FillRect const&) = 0;
     virtual void draw_painting_surface(DrawPaintingSurface const&) = 0;
     virtual void draw_scaled_immutable_bitmap(DrawScaledImmutableBitmap const&) = 0;
+    virtual void draw_scaled_yuv_data(DrawScaledYUVData const&) = 0;
     virtual void draw_repeated_immutable_bitmap(DrawRepeatedImmutableBitmap const&) = 0;
     virtual void save(Save const&) = 0;
     virtual void save_layer(SaveLayer const&) = 0;
@@ -93,14 +96,40 @@ public:
 
     AK::SegmentedVector<CommandListItem, 512> const& commands() const { return m_commands; }
 
+    // A run of consecutive commands that only draw, i.e. don't change clip, transform or other painter state, within
+    // the same scroll frame. If the run's combined bounding rect is entirely clipped, it can be skipped at once.
+    struct DrawingCommandRun {
+        size_t start { 0 };
+        size_t end { 0 };
+        Optional<i32> scroll_frame_id;
+        Gfx::IntRect bounding_rect;
+    };
+    Vector<DrawingCommandRun> const& drawing_command_runs() const { return m_drawing_command_runs; }
+
     void set_device_pixels_per_css_pixel(double device_pixels_per_css_pixel) { m_device_pixels_per_css_pixel = device_pixels_per_css_pixel; }
     double device_pixels_per_css_pixel() const { return m_device_pixels_per_css_pixel; }
 
+    // True if the result of replaying this list can change without the list itself changing, e.g. because it draws
+    // a canvas surface or the display list of a nested document.
+    bool has_externally_updated_content() const { return m_has_externally_updated_content; }
+
 private:
     DisplayList() = default;
 
     AK::SegmentedVector<CommandListItem, 512> m_commands;
+    Vector<DrawingCommandRun> m_drawing_command_runs;
     double m_device_pixels_per_css_pixel;
+    bool m_has_externally_updated_content { false };
 };
 
 }
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder&, Web::Painting::DisplayList const&);
+
+template<>
+ErrorOr<NonnullRefPtr<Web::Painting::DisplayList>> decode(Decoder&);
+
+}
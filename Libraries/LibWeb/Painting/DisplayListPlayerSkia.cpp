@@ -9,11 +9,13 @@
 #include <core/SkBlurTypes.h>
 #include <core/SkCanvas.h>
 #include <core/SkFont.h>
+#include <core/SkImage.h>
 #include <core/SkMaskFilter.h>
 #include <core/SkPath.h>
 #include <core/SkPathEffect.h>
 #include <core/SkRRect.h>
 #include <core/SkSurface.h>
+#include <core/SkTextBlob.h>
 #include <effects/SkDashPathEffect.h>
 #include <effects/SkGradientShader.h>
 #include <effects/SkImageFilters.h>
@@ -41,6 +43,8 @@ DisplayListPlayerSkia::DisplayListPlayerSkia()
 {
 }
 
+DisplayListPlayerSkia::~DisplayListPlayerSkia() = default;
+
 static SkRRect to_skia_rrect(auto const& rect, CornerRadii const& corner_radii)
 {
     SkRRect rrect;
@@ -73,41 +77,74 @@ void DisplayListPlayerSkia::flush()
     if (m_context)
         m_context->flush_and_submit(&surface().sk_surface());
     surface().flush();
+
+    // Only the outermost surface is flushed once per frame; masks are painted into their own nested surfaces.
+    if (m_surfaces.size() == 1)
+        evict_unused_cached_resources();
 }
 
-void DisplayListPlayerSkia::draw_glyph_run(DrawGlyphRun const& command)
+sk_sp<SkTextBlob> DisplayListPlayerSkia::text_blob_for_glyph_run(DrawGlyphRun const& command)
 {
-    auto const& gfx_font = command.glyph_run->font();
-    auto sk_font = gfx_font.skia_font(command.scale);
+    auto& glyph_run = *command.glyph_run;
+    if (auto it = m_text_blob_cache.find(&glyph_run); it != m_text_blob_cache.end() && it->value.scale == command.scale) {
+        it->value.last_used_frame = m_frame_count;
+        return it->value.text_blob;
+    }
 
-    auto glyph_count = command.glyph_run->glyphs().size();
-    Vector<SkGlyphID> glyphs;
-    glyphs.ensure_capacity(glyph_count);
-    Vector<SkPoint> positions;
-    positions.ensure_capacity(glyph_count);
+    auto const& gfx_font = glyph_run.font();
+    auto sk_font = gfx_font.skia_font(command.scale);
     auto font_ascent = gfx_font.pixel_metrics().ascent;
-    for (auto const& glyph : command.glyph_run->glyphs()) {
-        auto transformed_glyph = glyph;
-        transformed_glyph.position.set_y(glyph.position.y() + font_ascent);
+
+    SkTextBlobBuilder builder;
+    auto const& run_buffer = builder.allocRunPos(sk_font, glyph_run.glyphs().size());
+    for (size_t i = 0; i < glyph_run.glyphs().size(); ++i) {
+        auto transformed_glyph = glyph_run.glyphs()[i];
+        transformed_glyph.position.set_y(transformed_glyph.position.y() + font_ascent);
         transformed_glyph.position = transformed_glyph.position.scaled(command.scale);
-        auto const& point = transformed_glyph.position;
-        glyphs.append(transformed_glyph.glyph_id);
-        positions.append(to_skia_point(point));
+        run_buffer.glyphs[i] = transformed_glyph.glyph_id;
+        run_buffer.points()[i] = to_skia_point(transformed_glyph.position);
     }
+    auto text_blob = builder.make();
+
+    m_text_blob_cache.set(&glyph_run, CachedTextBlob { .glyph_run = glyph_run, .scale = command.scale, .text_blob = text_blob, .last_used_frame = m_frame_count });
+    return text_blob;
+}
+
+void DisplayListPlayerSkia::evict_unused_cached_resources()
+{
+    // Keep whatever the previous frame used too, since the backing stores alternate between two display lists.
+    auto is_unused = [&](auto const&, auto const& entry) {
+        return entry.last_used_frame + 1 < m_frame_count;
+    };
+    m_text_blob_cache.remove_all_matching(is_unused);
+    m_box_shadow_mask_cache.remove_all_matching(is_unused);
+    m_downscaled_image_cache.remove_all_matching(is_unused);
+    ++m_frame_count;
+}
+
+void DisplayListPlayerSkia::draw_glyph_run(DrawGlyphRun const& command)
+{
+    if (command.glyph_run->is_empty())
+        return;
+
+    auto text_blob = text_blob_for_glyph_run(command);
+    if (!text_blob)
+        return;
 
     SkPaint paint;
     paint.setColor(to_skia_color(command.color));
 
     auto& canvas = surface().canvas();
+    auto translation = to_skia_point(command.translation);
     switch (command.orientation) {
     case Gfx::Orientation::Horizontal:
-        canvas.drawGlyphs(glyphs.size(), glyphs.data(), positions.data(), to_skia_point(command.translation), sk_font, paint);
+        canvas.drawTextBlob(text_blob, translation.x(), translation.y(), paint);
         break;
     case Gfx::Orientation::Vertical:
         canvas.save();
         canvas.translate(command.rect.width(), 0);
         canvas.rotate(90, command.rect.top_left().x(), command.rect.top_left().y());
-        canvas.drawGlyphs(glyphs.size(), glyphs.data(), positions.data(), to_skia_point(command.translation), sk_font, paint);
+        canvas.drawTextBlob(text_blob, translation.x(), translation.y(), paint);
         canvas.restore();
         break;
     }
@@ -133,6 +170,33 @@ void DisplayListPlayerSkia::draw_painting_surface(DrawPaintingSurface const& com
     canvas.drawImageRect(image, src_rect, dst_rect, to_skia_sampling_options(command.scaling_mode), &paint, SkCanvas::kStrict_SrcRectConstraint);
 }
 
+sk_sp<SkImage> DisplayListPlayerSkia::downscaled_image_for(DrawScaledImmutableBitmap const& command)
+{
+    // Only downscale by at least half in both directions, where resampling on every frame is the most wasteful.
+    auto const& bitmap = *command.bitmap;
+    auto size = command.dst_rect.size();
+    if (size.is_empty() || size.width() * 2 > bitmap.width() || size.height() * 2 > bitmap.height())
+        return nullptr;
+    if (bitmap.sk_image()->isTextureBacked())
+        return nullptr;
+
+    if (auto it = m_downscaled_image_cache.find(&bitmap); it != m_downscaled_image_cache.end() && it->value.size == size && it->value.scaling_mode == command.scaling_mode) {
+        it->value.last_used_frame = m_frame_count;
+        return it->value.image;
+    }
+
+    SkBitmap scaled_bitmap;
+    if (!scaled_bitmap.tryAllocPixels(bitmap.sk_image()->imageInfo().makeWH(size.width(), size.height())))
+        return nullptr;
+    if (!bitmap.sk_image()->scalePixels(scaled_bitmap.pixmap(), to_skia_sampling_options(command.scaling_mode)))
+        return nullptr;
+    scaled_bitmap.setImmutable();
+    auto image = scaled_bitmap.asImage();
+
+    m_downscaled_image_cache.set(&bitmap, DownscaledImage { .bitmap = bitmap, .size = size, .scaling_mode = command.scaling_mode, .image = image, .last_used_frame = m_frame_count });
+    return image;
+}
+
 void DisplayListPlayerSkia::draw_scaled_immutable_bitmap(DrawScaledImmutableBitmap const& command)
 {
     auto dst_rect = to_skia_rect(command.dst_rect);
@@ -141,7 +205,29 @@ void DisplayListPlayerSkia::draw_scaled_immutable_bitmap(DrawScaledImmutableBitm
     SkPaint paint;
     canvas.save();
     canvas.clipRect(clip_rect);
-    canvas.drawImageRect(command.bitmap->sk_image(), dst_rect, to_skia_sampling_options(command.scaling_mode), &paint);
+    if (auto downscaled_image = downscaled_image_for(command))
+        canvas.drawImage(downscaled_image, dst_rect.x(), dst_rect.y(), SkSamplingOptions(SkFilterMode::kNearest), &paint);
+    else
+        canvas.drawImageRect(command.bitmap->sk_image(), dst_rect, to_skia_sampling_options(command.scaling_mode), &paint);
+    canvas.restore();
+}
+
+void DisplayListPlayerSkia::draw_scaled_yuv_data(DrawScaledYUVData const& command)
+{
+    // NOTE: The planes are converted to RGB by a shader as they are drawn, so the frame is never copied into an
+    //       intermediate RGB bitmap.
+    auto const& yuv_data = *command.yuv_data;
+    auto dst_rect = command.dst_rect.to_type<float>();
+    SkMatrix matrix;
+    matrix.setScale(dst_rect.width() / yuv_data.width(), dst_rect.height() / yuv_data.height());
+    matrix.postTranslate(dst_rect.x(), dst_rect.y());
+
+    SkPaint paint;
+    paint.setShader(Gfx::to_skia_shader(yuv_data, to_skia_sampling_options(command.scaling_mode), matrix));
+    auto& canvas = surface().canvas();
+    canvas.save();
+    canvas.clipRect(to_skia_rect(command.clip_rect));
+    canvas.drawRect(to_skia_rect(command.dst_rect), paint);
     canvas.restore();
 }
 
@@ -449,6 +535,43 @@ static void add_spread_distance_to_border_radius(int& border_radius, int spread_
     }
 }
 
+DisplayListPlayerSkia::BoxShadowMask const& DisplayListPlayerSkia::outer_box_shadow_mask(CornerRadii const& corner_radii, int blur_radius)
+{
+    BoxShadowMaskKey key { corner_radii, blur_radius };
+    if (auto it = m_box_shadow_mask_cache.find(key); it != m_box_shadow_mask_cache.end()) {
+        it->value.last_used_frame = m_frame_count;
+        return it->value;
+    }
+
+    // The mask is the smallest rounded rect whose straight edges are at least a blur extent away from the corners,
+    // so a one pixel wide center can be stretched without changing the blurred profile. The blur's sigma is half the
+    // blur radius, and its visible extent is three sigma.
+    auto blur_extent = (blur_radius * 3 + 1) / 2;
+    auto left = max(corner_radii.top_left.horizontal_radius, corner_radii.bottom_left.horizontal_radius);
+    auto right = max(corner_radii.top_right.horizontal_radius, corner_radii.bottom_right.horizontal_radius);
+    auto top = max(corner_radii.top_left.vertical_radius, corner_radii.top_right.vertical_radius);
+    auto bottom = max(corner_radii.bottom_left.vertical_radius, corner_radii.bottom_right.vertical_radius);
+    Gfx::IntRect shape_rect { blur_extent, blur_extent, left + right + blur_extent * 2 + 1, top + bottom + blur_extent * 2 + 1 };
+
+    auto mask_surface = SkSurfaces::Raster(SkImageInfo::MakeA8(shape_rect.width() + blur_extent * 2, shape_rect.height() + blur_extent * 2));
+    VERIFY(mask_surface);
+    auto& mask_canvas = *mask_surface->getCanvas();
+    mask_canvas.clear(SK_ColorTRANSPARENT);
+    SkPaint paint;
+    paint.setAntiAlias(true);
+    paint.setColor(SK_ColorBLACK);
+    paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, blur_radius / 2));
+    mask_canvas.drawRRect(to_skia_rrect(shape_rect, corner_radii), paint);
+
+    BoxShadowMask mask {
+        .image = mask_surface->makeImageSnapshot(),
+        .center = { shape_rect.x() + left + blur_extent, shape_rect.y() + top + blur_extent, 1, 1 },
+        .blur_extent = blur_extent,
+        .last_used_frame = m_frame_count,
+    };
+    return m_box_shadow_mask_cache.ensure(key, [&] { return move(mask); });
+}
+
 void DisplayListPlayerSkia::paint_outer_box_shadow(PaintOuterBoxShadow const& command)
 {
     auto const& outer_box_shadow_params = command.box_shadow_params;
@@ -481,6 +604,18 @@ void DisplayListPlayerSkia::paint_outer_box_shadow(PaintOuterBoxShadow const& co
     SkPaint paint;
     paint.setAntiAlias(true);
     paint.setColor(to_skia_color(color));
+
+    if (blur_radius > 0) {
+        auto const& mask = outer_box_shadow_mask(corner_radii, blur_radius);
+        auto mask_rect = shadow_rect.inflated(mask.blur_extent * 2, mask.blur_extent * 2);
+        // The corners of the mask can only be drawn unscaled if the shadow is at least as large as the mask shape.
+        if (mask_rect.width() >= mask.image->width() - 1 && mask_rect.height() >= mask.image->height() - 1) {
+            canvas.drawImageNine(mask.image.get(), SkIRect::MakeXYWH(mask.center.x(), mask.center.y(), mask.center.width(), mask.center.height()), to_skia_rect(mask_rect), SkFilterMode::kNearest, &paint);
+            canvas.restore();
+            return;
+        }
+    }
+
     paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, blur_radius / 2));
     auto shadow_rounded_rect = to_skia_rrect(shadow_rect, corner_radii);
     canvas.drawRRect(shadow_rounded_rect, paint);
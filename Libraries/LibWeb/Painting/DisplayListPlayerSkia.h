@@ -6,11 +6,38 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <LibGfx/PaintingSurface.h>
 #include <LibGfx/SkiaBackendContext.h>
 #include <LibWeb/Painting/DisplayListRecorder.h>
 
+#include <core/SkRefCnt.h>
+
 class GrDirectContext;
+class SkImage;
+class SkTextBlob;
+
+namespace Web::Painting {
+
+struct BoxShadowMaskKey {
+    CornerRadii corner_radii;
+    int blur_radius { 0 };
+
+    bool operator==(BoxShadowMaskKey const&) const = default;
+};
+
+}
+
+template<>
+struct AK::Traits<Web::Painting::BoxShadowMaskKey> : public AK::DefaultTraits<Web::Painting::BoxShadowMaskKey> {
+    static unsigned hash(Web::Painting::BoxShadowMaskKey const& key)
+    {
+        auto hash = int_hash(key.blur_radius);
+        for (auto const& corner : { key.corner_radii.top_left, key.corner_radii.top_right, key.corner_radii.bottom_right, key.corner_radii.bottom_left })
+            hash = pair_int_hash(hash, pair_int_hash(corner.horizontal_radius, corner.vertical_radius));
+        return hash;
+    }
+};
 
 namespace Web::Painting {
 
@@ -18,6 +45,7 @@ class DisplayListPlayerSkia final : public DisplayListPlayer {
 public:
     DisplayListPlayerSkia(RefPtr<Gfx::SkiaBackendContext>);
     DisplayListPlayerSkia();
+    ~DisplayListPlayerSkia();
 
 private:
     void flush() override;
@@ -25,6 +53,7 @@ private:
     void fill_rect(FillRect const&) override;
     void draw_painting_surface(DrawPaintingSurface const&) override;
     void draw_scaled_immutable_bitmap(DrawScaledImmutableBitmap const&) override;
+    void draw_scaled_yuv_data(DrawScaledYUVData const&) override;
     void draw_repeated_immutable_bitmap(DrawRepeatedImmutableBitmap const&) override;
     void add_clip_rect(AddClipRect const&) override;
     void save(Save const&) override;
@@ -62,7 +91,48 @@ private:
 
     bool would_be_fully_clipped_by_painter(Gfx::IntRect) const override;
 
+    sk_sp<SkTextBlob> text_blob_for_glyph_run(DrawGlyphRun const&);
+
+    struct BoxShadowMask {
+        sk_sp<SkImage> image;
+        Gfx::IntRect center;
+        int blur_extent { 0 };
+        u64 last_used_frame { 0 };
+    };
+    BoxShadowMask const& outer_box_shadow_mask(CornerRadii const&, int blur_radius);
+
+    sk_sp<SkImage> downscaled_image_for(DrawScaledImmutableBitmap const&);
+
+    void evict_unused_cached_resources();
+
     RefPtr<Gfx::SkiaBackendContext> m_context;
+
+    // Text blobs built from the glyph runs painted in the last couple of frames. Glyph runs are shared between
+    // display lists for as long as the text isn't relaid out, so this avoids rebuilding them on every repaint.
+    struct CachedTextBlob {
+        NonnullRefPtr<Gfx::GlyphRun const> glyph_run;
+        float scale { 0 };
+        sk_sp<SkTextBlob> text_blob;
+        u64 last_used_frame { 0 };
+    };
+    HashMap<Gfx::GlyphRun const*, CachedTextBlob> m_text_blob_cache;
+
+    // Blurred outer box shadows only depend on the corner radii and the blur radius, so they are rendered once into
+    // an alpha mask and stretched over the shadow rect as a nine-patch.
+    HashMap<BoxShadowMaskKey, BoxShadowMask> m_box_shadow_mask_cache;
+
+    // Bitmaps that are drawn much smaller than their natural size (e.g. photo thumbnails) are resampled once to the
+    // size they are drawn at, instead of on every frame. Reusing the same small image also lets the GPU backend keep
+    // its texture upload around.
+    struct DownscaledImage {
+        NonnullRefPtr<Gfx::ImmutableBitmap const> bitmap;
+        Gfx::IntSize size;
+        Gfx::ScalingMode scaling_mode;
+        sk_sp<SkImage> image;
+        u64 last_used_frame { 0 };
+    };
+    HashMap<Gfx::ImmutableBitmap const*, DownscaledImage> m_downscaled_image_cache;
+    u64 m_frame_count { 0 };
 };
 
 }
@@ -206,6 +206,18 @@ void DisplayListRecorder::draw_scaled_immutable_bitmap(Gfx::IntRect const& dst_r
     });
 }
 
+void DisplayListRecorder::draw_scaled_yuv_data(Gfx::IntRect const& dst_rect, Gfx::IntRect const& clip_rect, Gfx::YUVData const& yuv_data, Gfx::ScalingMode scaling_mode)
+{
+    if (dst_rect.is_empty())
+        return;
+    append(DrawScaledYUVData {
+        .dst_rect = dst_rect,
+        .clip_rect = clip_rect,
+        .yuv_data = yuv_data,
+        .scaling_mode = scaling_mode,
+    });
+}
+
 void DisplayListRecorder::draw_repeated_immutable_bitmap(Gfx::IntRect dst_rect, Gfx::IntRect clip_rect, NonnullRefPtr<Gfx::ImmutableBitmap const> bitmap, Gfx::ScalingMode scaling_mode, DrawRepeatedImmutableBitmap::Repeat repeat)
 {
     append(DrawRepeatedImmutableBitmap {
@@ -0,0 +1,1002 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <AK/ScopeGuard.h>
+#include <AK/TypeList.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/Font/Font.h>
+#include <LibGfx/Font/FontData.h>
+#include <LibGfx/Font/Typeface.h>
+#include <LibGfx/ShareableBitmap.h>
+#include <LibGfx/YUVData.h>
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
+#include <LibWeb/Painting/DisplayList.h>
+
+#include <core/SkImage.h>
+#include <core/SkPixmap.h>
+
+namespace Web::Painting {
+
+// Display lists are serialized as a stream of commands. Typefaces and bitmaps are often referenced by many commands,
+// so each of them is written out the first time it is referenced and then only referred to by its index. Nested
+// display lists (masks and iframes) share these tables with the list they are nested in.
+
+static constexpr size_t max_nested_display_list_depth = 64;
+static constexpr int max_yuv_data_dimension = 16384;
+
+enum class PaintStyleKind : u8 {
+    None,
+    Linear,
+    Radial,
+};
+
+class DisplayListEncoder {
+public:
+    explicit DisplayListEncoder(IPC::Encoder& encoder)
+        : m_encoder(encoder)
+    {
+    }
+
+    ErrorOr<void> encode(DisplayList const& display_list)
+    {
+        TRY(m_encoder.encode(display_list.device_pixels_per_css_pixel()));
+        TRY(m_encoder.encode_size(display_list.commands().size()));
+        for (auto const& item : display_list.commands()) {
+            TRY(m_encoder.encode(item.scroll_frame_id));
+            TRY(m_encoder.encode(item.command.index()));
+            TRY(item.command.visit([&](auto const& command) { return encode_command(command); }));
+        }
+        return {};
+    }
+
+private:
+    template<typename T>
+    ErrorOr<void> write(T const& value) { return m_encoder.encode(value); }
+
+    template<typename T>
+    ErrorOr<void> write(Optional<T> const& value)
+    {
+        TRY(write(value.has_value()));
+        if (value.has_value())
+            TRY(write(*value));
+        return {};
+    }
+
+    template<typename T>
+    ErrorOr<void> write(ReadonlySpan<T> values)
+    {
+        TRY(m_encoder.encode_size(values.size()));
+        for (auto const& value : values)
+            TRY(write(value));
+        return {};
+    }
+
+    template<typename T, size_t inline_capacity>
+    ErrorOr<void> write(Vector<T, inline_capacity> const& values) { return write(values.span()); }
+
+    template<typename T, typename... Ts>
+    ErrorOr<void> write_fields(T const& field, Ts const&... fields)
+    {
+        TRY(write(field));
+        if constexpr (sizeof...(fields) > 0)
+            TRY(write_fields(fields...));
+        return {};
+    }
+
+    ErrorOr<void> write(CSSPixels const& value) { return m_encoder.encode(value.raw_value()); }
+    ErrorOr<void> write(CSSPixelFraction const& value) { return write_fields(value.numerator(), value.denominator()); }
+    ErrorOr<void> write(CornerRadius const& value) { return write_fields(value.horizontal_radius, value.vertical_radius); }
+    ErrorOr<void> write(CornerRadii const& value) { return write_fields(value.top_left, value.top_right, value.bottom_right, value.bottom_left); }
+    ErrorOr<void> write(BorderRadiusData const& value) { return write_fields(value.horizontal_radius, value.vertical_radius); }
+    ErrorOr<void> write(BorderRadiiData const& value) { return write_fields(value.top_left, value.top_right, value.bottom_right, value.bottom_left); }
+    ErrorOr<void> write(Gfx::ColorStop const& value) { return write_fields(value.color, value.position, value.transition_hint); }
+    ErrorOr<void> write(ColorStop const& value) { return write_fields(value.color, value.position, value.transition_hint); }
+    ErrorOr<void> write(ColorStopData const& value) { return write_fields(value.list, value.repeat_length); }
+    ErrorOr<void> write(CSS::InterpolationMethod const& value) { return write_fields(value.color_space, value.hue_method); }
+    ErrorOr<void> write(LinearGradientData const& value) { return write_fields(value.gradient_angle, value.color_stops, value.interpolation_method); }
+    ErrorOr<void> write(ConicGradientData const& value) { return write_fields(value.start_angle, value.color_stops, value.interpolation_method); }
+    ErrorOr<void> write(RadialGradientData const& value) { return write_fields(value.color_stops, value.interpolation_method); }
+    ErrorOr<void> write(Gfx::AffineTransform const& value) { return write_fields(value.a(), value.b(), value.c(), value.d(), value.e(), value.f()); }
+    ErrorOr<void> write(StackingContextTransform const& value) { return write_fields(value.origin, value.matrix); }
+    ErrorOr<void> write(DrawRepeatedImmutableBitmap::Repeat const& value) { return write_fields(value.x, value.y); }
+
+    ErrorOr<void> write(PaintBoxShadowParams const& value)
+    {
+        return write_fields(value.color, value.placement, value.corner_radii, value.offset_x, value.offset_y, value.blur_radius, value.spread_distance, value.device_content_rect);
+    }
+
+    ErrorOr<void> write(Gfx::FloatMatrix4x4 const& value)
+    {
+        for (size_t i = 0; i < 4; ++i) {
+            for (size_t j = 0; j < 4; ++j)
+                TRY(write(value.elements()[i][j]));
+        }
+        return {};
+    }
+
+    ErrorOr<void> write(PaintStyle const& value)
+    {
+        if (!value)
+            return write(PaintStyleKind::None);
+
+        auto const& paint_style = *value;
+        if (auto const* linear = as_if<SVGLinearGradientPaintStyle>(paint_style)) {
+            TRY(write_fields(PaintStyleKind::Linear, linear->start_point(), linear->end_point()));
+        } else if (auto const* radial = as_if<SVGRadialGradientPaintStyle>(paint_style)) {
+            TRY(write_fields(PaintStyleKind::Radial, radial->start_center(), radial->start_radius(), radial->end_center(), radial->end_radius()));
+        } else {
+            VERIFY_NOT_REACHED();
+        }
+        TRY(write(paint_style.color_stops()));
+        TRY(write_fields(paint_style.gradient_transform(), paint_style.spread_method()));
+        return {};
+    }
+
+    ErrorOr<void> write(Gfx::Font const& font)
+    {
+        auto const& typeface = font.typeface();
+        if (auto id = m_typeface_ids.get(&typeface); id.has_value()) {
+            TRY(write(*id));
+        } else {
+            auto new_id = static_cast<u32>(m_typeface_ids.size());
+            m_typeface_ids.set(&typeface, new_id);
+            TRY(write_fields(new_id, typeface.ttc_index()));
+            TRY(m_encoder.encode<u64>(typeface.buffer().size()));
+            TRY(m_encoder.append(typeface.buffer().data(), typeface.buffer().size()));
+        }
+        return write(font.point_size());
+    }
+
+    ErrorOr<void> write(NonnullRefPtr<Gfx::YUVData const> const& yuv_data)
+    {
+        auto chroma_subsampled_horizontally = yuv_data->chroma_size().width() != yuv_data->width();
+        auto chroma_subsampled_vertically = yuv_data->chroma_size().height() != yuv_data->height();
+        TRY(write_fields(yuv_data->size(), yuv_data->bit_depth(), chroma_subsampled_horizontally, chroma_subsampled_vertically, yuv_data->matrix_coefficients(), yuv_data->range()));
+        for (size_t plane = 0; plane < Gfx::YUVData::plane_count; ++plane) {
+            auto data = yuv_data->plane_data(plane);
+            TRY(m_encoder.append(data.data(), data.size()));
+        }
+        return {};
+    }
+
+    ErrorOr<void> write(NonnullRefPtr<Gfx::GlyphRun const> const& glyph_run)
+    {
+        TRY(write_fields(glyph_run->font(), glyph_run->text_type(), glyph_run->width()));
+        TRY(m_encoder.encode_size(glyph_run->glyphs().size()));
+        for (auto const& glyph : glyph_run->glyphs())
+            TRY(write_fields(glyph.position, glyph.glyph_id));
+        return {};
+    }
+
+    ErrorOr<void> write_bitmap(Gfx::Bitmap const& bitmap)
+    {
+        auto shareable_bitmap = bitmap.to_shareable_bitmap();
+        if (!shareable_bitmap.is_valid())
+            return Error::from_string_literal("Failed to share bitmap of display list");
+        return write(shareable_bitmap);
+    }
+
+    ErrorOr<void> write(NonnullRefPtr<Gfx::ImmutableBitmap const> const& immutable_bitmap)
+    {
+        if (auto id = m_bitmap_ids.get(immutable_bitmap.ptr()); id.has_value())
+            return write(*id);
+
+        auto new_id = static_cast<u32>(m_bitmap_ids.size());
+        m_bitmap_ids.set(immutable_bitmap.ptr(), new_id);
+        TRY(write(new_id));
+
+        RefPtr<Gfx::Bitmap const> bitmap = immutable_bitmap->bitmap();
+        if (!bitmap) {
+            // Snapshots of painting surfaces only have an SkImage, so read back its pixels.
+            auto pixels = TRY(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, immutable_bitmap->size()));
+            auto image_info = SkImageInfo::Make(pixels->width(), pixels->height(), kBGRA_8888_SkColorType, kPremul_SkAlphaType);
+            SkPixmap const pixmap(image_info, pixels->begin(), pixels->pitch());
+            if (!immutable_bitmap->sk_image()->readPixels(pixmap, 0, 0))
+                return Error::from_string_literal("Failed to read back a GPU-backed bitmap of display list");
+            bitmap = move(pixels);
+        }
+        TRY(write_bitmap(*bitmap));
+        return write_fields(immutable_bitmap->alpha_type(), immutable_bitmap->color_space());
+    }
+
+    ErrorOr<void> write(NonnullRefPtr<Gfx::PaintingSurface const> const& surface)
+    {
+        auto bitmap = surface->bitmap();
+        if (!bitmap)
+            return Error::from_string_literal("GPU-backed painting surfaces of display list can't be serialized");
+        return write_bitmap(*bitmap);
+    }
+
+    ErrorOr<void> write(RefPtr<DisplayList> const& display_list)
+    {
+        TRY(write(display_list != nullptr));
+        if (display_list)
+            TRY(encode(*display_list));
+        return {};
+    }
+
+    ErrorOr<void> encode_command(DrawGlyphRun const& command) { return write_fields(command.glyph_run, command.scale, command.rect, command.translation, command.color, command.orientation); }
+    ErrorOr<void> encode_command(FillRect const& command) { return write_fields(command.rect, command.color); }
+    ErrorOr<void> encode_command(DrawPaintingSurface const& command) { return write_fields(command.dst_rect, command.surface, command.src_rect, command.scaling_mode); }
+    ErrorOr<void> encode_command(DrawScaledImmutableBitmap const& command) { return write_fields(command.dst_rect, command.clip_rect, command.bitmap, command.scaling_mode); }
+    ErrorOr<void> encode_command(DrawScaledYUVData const& command) { return write_fields(command.dst_rect, command.clip_rect, command.yuv_data, command.scaling_mode); }
+    ErrorOr<void> encode_command(DrawRepeatedImmutableBitmap const& command) { return write_fields(command.dst_rect, command.clip_rect, command.bitmap, command.scaling_mode, command.repeat); }
+    ErrorOr<void> encode_command(Save const&) { return {}; }
+    ErrorOr<void> encode_command(SaveLayer const&) { return {}; }
+    ErrorOr<void> encode_command(Restore const&) { return {}; }
+    ErrorOr<void> encode_command(Translate const& command) { return write(command.delta); }
+    ErrorOr<void> encode_command(AddClipRect const& command) { return write(command.rect); }
+    ErrorOr<void> encode_command(PushStackingContext const& command) { return write_fields(command.opacity, command.compositing_and_blending_operator, command.isolate, command.source_paintable_rect, command.transform, command.clip_path); }
+    ErrorOr<void> encode_command(PopStackingContext const&) { return {}; }
+    ErrorOr<void> encode_command(PaintLinearGradient const& command) { return write_fields(command.gradient_rect, command.linear_gradient_data); }
+    ErrorOr<void> encode_command(PaintRadialGradient const& command) { return write_fields(command.rect, command.radial_gradient_data, command.center, command.size); }
+    ErrorOr<void> encode_command(PaintConicGradient const& command) { return write_fields(command.rect, command.conic_gradient_data, command.position); }
+    ErrorOr<void> encode_command(PaintOuterBoxShadow const& command) { return write(command.box_shadow_params); }
+    ErrorOr<void> encode_command(PaintInnerBoxShadow const& command) { return write(command.box_shadow_params); }
+    ErrorOr<void> encode_command(PaintTextShadow const& command) { return write_fields(command.glyph_run, command.glyph_run_scale, command.shadow_bounding_rect, command.text_rect, command.draw_location, command.blur_radius, command.color); }
+    ErrorOr<void> encode_command(FillRectWithRoundedCorners const& command) { return write_fields(command.rect, command.color, command.corner_radii); }
+    ErrorOr<void> encode_command(FillPathUsingColor const& command) { return write_fields(command.path_bounding_rect, command.path, command.color, command.winding_rule, command.aa_translation); }
+    ErrorOr<void> encode_command(FillPathUsingPaintStyle const& command) { return write_fields(command.path_bounding_rect, command.path, command.paint_style, command.winding_rule, command.opacity, command.aa_translation); }
+    ErrorOr<void> encode_command(StrokePathUsingColor const& command) { return write_fields(command.cap_style, command.join_style, command.miter_limit, command.dash_array, command.dash_offset, command.path_bounding_rect, command.path, command.color, command.thickness, command.aa_translation); }
+    ErrorOr<void> encode_command(StrokePathUsingPaintStyle const& command) { return write_fields(command.cap_style, command.join_style, command.miter_limit, command.dash_array, command.dash_offset, command.path_bounding_rect, command.path, command.paint_style, command.thickness, command.opacity, command.aa_translation); }
+    ErrorOr<void> encode_command(DrawEllipse const& command) { return write_fields(command.rect, command.color, command.thickness); }
+    ErrorOr<void> encode_command(FillEllipse const& command) { return write_fields(command.rect, command.color); }
+    ErrorOr<void> encode_command(DrawLine const& command) { return write_fields(command.color, command.from, command.to, command.thickness, command.style, command.alternate_color); }
+    ErrorOr<void> encode_command(ApplyBackdropFilter const& command) { return write_fields(command.backdrop_region, command.border_radii_data, command.backdrop_filter); }
+    ErrorOr<void> encode_command(DrawRect const& command) { return write_fields(command.rect, command.color, command.rough); }
+    ErrorOr<void> encode_command(DrawTriangleWave const& command) { return write_fields(command.p1, command.p2, command.color, command.amplitude, command.thickness); }
+    ErrorOr<void> encode_command(AddRoundedRectClip const& command) { return write_fields(command.corner_radii, command.border_rect, command.corner_clip); }
+    ErrorOr<void> encode_command(AddMask const& command) { return write_fields(command.display_list, command.rect); }
+    ErrorOr<void> encode_command(PaintNestedDisplayList const& command) { return write_fields(command.display_list, command.scroll_state_snapshot, command.rect); }
+    ErrorOr<void> encode_command(PaintScrollBar const& command) { return write_fields(command.scroll_frame_id, command.gutter_rect, command.thumb_rect, command.scroll_size, command.thumb_color, command.track_color, command.vertical); }
+    ErrorOr<void> encode_command(ApplyOpacity const& command) { return write(command.opacity); }
+    ErrorOr<void> encode_command(ApplyCompositeAndBlendingOperator const& command) { return write(command.compositing_and_blending_operator); }
+    ErrorOr<void> encode_command(ApplyFilter const& command) { return write(command.filter); }
+    ErrorOr<void> encode_command(ApplyTransform const& command) { return write_fields(command.origin, command.matrix); }
+    ErrorOr<void> encode_command(ApplyMaskBitmap const& command) { return write_fields(command.origin, command.bitmap, command.kind); }
+
+    IPC::Encoder& m_encoder;
+    HashMap<Gfx::Typeface const*, u32> m_typeface_ids;
+    HashMap<Gfx::ImmutableBitmap const*, u32> m_bitmap_ids;
+};
+
+class DisplayListDecoder {
+public:
+    explicit DisplayListDecoder(IPC::Decoder& decoder)
+        : m_decoder(decoder)
+    {
+    }
+
+    ErrorOr<NonnullRefPtr<DisplayList>> decode();
+
+private:
+    template<typename T>
+    ErrorOr<T> read() { return m_decoder.decode<T>(); }
+
+    template<typename T>
+    ErrorOr<T> decode_command();
+
+    template<size_t Index = 0>
+    ErrorOr<Command> decode_command_with_index(size_t index)
+    {
+        using CommandTypes = TypeList<Command>;
+        if constexpr (Index < CommandTypes::size) {
+            if (index == Index)
+                return Command { TRY(decode_command<typename CommandTypes::template Type<Index>>()) };
+            return decode_command_with_index<Index + 1>(index);
+        } else {
+            return Error::from_string_literal("IPC: Invalid display list command");
+        }
+    }
+
+    ErrorOr<NonnullRefPtr<Gfx::Font>> read_font();
+    ErrorOr<NonnullRefPtr<Gfx::Bitmap>> read_bitmap();
+
+    IPC::Decoder& m_decoder;
+    size_t m_depth { 0 };
+    Vector<NonnullRefPtr<Gfx::Typeface>> m_typefaces;
+    Vector<NonnullRefPtr<Gfx::ImmutableBitmap>> m_bitmaps;
+};
+
+ErrorOr<NonnullRefPtr<Gfx::Font>> DisplayListDecoder::read_font()
+{
+    auto id = TRY(read<u32>());
+    if (id == m_typefaces.size()) {
+        auto ttc_index = TRY(read<unsigned>());
+        auto size = TRY(read<u64>());
+        auto buffer = TRY(ByteBuffer::create_uninitialized(size));
+        TRY(m_decoder.decode_into(buffer.bytes()));
+        m_typefaces.append(TRY(Gfx::Typeface::try_load_from_font_data(Gfx::FontData::create_from_byte_buffer(move(buffer)), ttc_index)));
+    } else if (id > m_typefaces.size()) {
+        return Error::from_string_literal("IPC: Invalid display list typeface");
+    }
+    auto point_size = TRY(read<float>());
+    return m_typefaces[id]->font(point_size);
+}
+
+ErrorOr<NonnullRefPtr<Gfx::Bitmap>> DisplayListDecoder::read_bitmap()
+{
+    auto shareable_bitmap = TRY(read<Gfx::ShareableBitmap>());
+    if (!shareable_bitmap.is_valid())
+        return Error::from_string_literal("IPC: Invalid display list bitmap");
+    return *shareable_bitmap.bitmap();
+}
+
+template<>
+ErrorOr<CSSPixels> DisplayListDecoder::read() { return CSSPixels::from_raw(TRY(read<int>())); }
+
+template<>
+ErrorOr<CSSPixelFraction> DisplayListDecoder::read()
+{
+    auto numerator = TRY(read<CSSPixels>());
+    auto denominator = TRY(read<CSSPixels>());
+    return CSSPixelFraction { numerator, denominator };
+}
+
+template<>
+ErrorOr<CornerRadius> DisplayListDecoder::read()
+{
+    auto horizontal_radius = TRY(read<int>());
+    auto vertical_radius = TRY(read<int>());
+    return CornerRadius { horizontal_radius, vertical_radius };
+}
+
+template<>
+ErrorOr<CornerRadii> DisplayListDecoder::read()
+{
+    return CornerRadii {
+        .top_left = TRY(read<CornerRadius>()),
+        .top_right = TRY(read<CornerRadius>()),
+        .bottom_right = TRY(read<CornerRadius>()),
+        .bottom_left = TRY(read<CornerRadius>()),
+    };
+}
+
+template<>
+ErrorOr<BorderRadiusData> DisplayListDecoder::read()
+{
+    auto horizontal_radius = TRY(read<CSSPixels>());
+    auto vertical_radius = TRY(read<CSSPixels>());
+    return BorderRadiusData { horizontal_radius, vertical_radius };
+}
+
+template<>
+ErrorOr<BorderRadiiData> DisplayListDecoder::read()
+{
+    return BorderRadiiData {
+        .top_left = TRY(read<BorderRadiusData>()),
+        .top_right = TRY(read<BorderRadiusData>()),
+        .bottom_right = TRY(read<BorderRadiusData>()),
+        .bottom_left = TRY(read<BorderRadiusData>()),
+    };
+}
+
+template<>
+ErrorOr<Gfx::ColorStop> DisplayListDecoder::read()
+{
+    return Gfx::ColorStop {
+        .color = TRY(read<Color>()),
+        .position = TRY(read<float>()),
+        .transition_hint = TRY(read<Optional<float>>()),
+    };
+}
+
+template<>
+ErrorOr<ColorStop> DisplayListDecoder::read()
+{
+    return ColorStop {
+        .color = TRY(read<Color>()),
+        .position = TRY(read<float>()),
+        .transition_hint = TRY(read<Optional<float>>()),
+    };
+}
+
+template<>
+ErrorOr<ColorStopData> DisplayListDecoder::read()
+{
+    auto size = TRY(m_decoder.decode_size());
+    ColorStopList list;
+    TRY(list.try_ensure_capacity(size));
+    for (size_t i = 0; i < size; ++i)
+        list.unchecked_append(TRY(read<Gfx::ColorStop>()));
+    return ColorStopData { .list = move(list), .repeat_length = TRY(read<Optional<float>>()) };
+}
+
+template<>
+ErrorOr<CSS::InterpolationMethod> DisplayListDecoder::read()
+{
+    return CSS::InterpolationMethod {
+        .color_space = TRY(read<CSS::GradientSpace>()),
+        .hue_method = TRY(read<CSS::HueMethod>()),
+    };
+}
+
+template<>
+ErrorOr<LinearGradientData> DisplayListDecoder::read()
+{
+    return LinearGradientData {
+        .gradient_angle = TRY(read<float>()),
+        .color_stops = TRY(read<ColorStopData>()),
+        .interpolation_method = TRY(read<CSS::InterpolationMethod>()),
+    };
+}
+
+template<>
+ErrorOr<ConicGradientData> DisplayListDecoder::read()
+{
+    return ConicGradientData {
+        .start_angle = TRY(read<float>()),
+        .color_stops = TRY(read<ColorStopData>()),
+        .interpolation_method = TRY(read<CSS::InterpolationMethod>()),
+    };
+}
+
+template<>
+ErrorOr<RadialGradientData> DisplayListDecoder::read()
+{
+    return RadialGradientData {
+        .color_stops = TRY(read<ColorStopData>()),
+        .interpolation_method = TRY(read<CSS::InterpolationMethod>()),
+    };
+}
+
+template<>
+ErrorOr<Gfx::AffineTransform> DisplayListDecoder::read()
+{
+    float values[6];
+    for (auto& value : values)
+        value = TRY(read<float>());
+    return Gfx::AffineTransform { values[0], values[1], values[2], values[3], values[4], values[5] };
+}
+
+template<>
+ErrorOr<Gfx::FloatMatrix4x4> DisplayListDecoder::read()
+{
+    Gfx::FloatMatrix4x4 matrix;
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 4; ++j)
+            matrix.elements()[i][j] = TRY(read<float>());
+    }
+    return matrix;
+}
+
+template<>
+ErrorOr<StackingContextTransform> DisplayListDecoder::read()
+{
+    return StackingContextTransform {
+        .origin = TRY(read<Gfx::FloatPoint>()),
+        .matrix = TRY(read<Gfx::FloatMatrix4x4>()),
+    };
+}
+
+template<>
+ErrorOr<DrawRepeatedImmutableBitmap::Repeat> DisplayListDecoder::read()
+{
+    return DrawRepeatedImmutableBitmap::Repeat {
+        .x = TRY(read<bool>()),
+        .y = TRY(read<bool>()),
+    };
+}
+
+template<>
+ErrorOr<PaintBoxShadowParams> DisplayListDecoder::read()
+{
+    return PaintBoxShadowParams {
+        .color = TRY(read<Color>()),
+        .placement = TRY(read<ShadowPlacement>()),
+        .corner_radii = TRY(read<CornerRadii>()),
+        .offset_x = TRY(read<int>()),
+        .offset_y = TRY(read<int>()),
+        .blur_radius = TRY(read<int>()),
+        .spread_distance = TRY(read<int>()),
+        .device_content_rect = TRY(read<Gfx::IntRect>()),
+    };
+}
+
+template<>
+ErrorOr<Optional<Gfx::AffineTransform>> DisplayListDecoder::read()
+{
+    if (!TRY(read<bool>()))
+        return Optional<Gfx::AffineTransform> {};
+    return TRY(read<Gfx::AffineTransform>());
+}
+
+template<>
+ErrorOr<PaintStyle> DisplayListDecoder::read()
+{
+    RefPtr<SVGGradientPaintStyle> paint_style;
+    switch (TRY(read<PaintStyleKind>())) {
+    case PaintStyleKind::None:
+        return PaintStyle {};
+    case PaintStyleKind::Linear: {
+        auto start_point = TRY(read<Gfx::FloatPoint>());
+        auto end_point = TRY(read<Gfx::FloatPoint>());
+        paint_style = SVGLinearGradientPaintStyle::create(start_point, end_point);
+        break;
+    }
+    case PaintStyleKind::Radial: {
+        auto start_center = TRY(read<Gfx::FloatPoint>());
+        auto start_radius = TRY(read<float>());
+        auto end_center = TRY(read<Gfx::FloatPoint>());
+        auto end_radius = TRY(read<float>());
+        paint_style = SVGRadialGradientPaintStyle::create(start_center, start_radius, end_center, end_radius);
+        break;
+    }
+    default:
+        return Error::from_string_literal("IPC: Invalid display list paint style");
+    }
+
+    auto color_stop_count = TRY(m_decoder.decode_size());
+    for (size_t i = 0; i < color_stop_count; ++i)
+        paint_style->add_color_stop(TRY(read<ColorStop>()), false);
+    if (auto gradient_transform = TRY(read<Optional<Gfx::AffineTransform>>()); gradient_transform.has_value())
+        paint_style->set_gradient_transform(*gradient_transform);
+    paint_style->set_spread_method(TRY(read<SVGGradientPaintStyle::SpreadMethod>()));
+    return paint_style;
+}
+
+template<>
+ErrorOr<NonnullRefPtr<Gfx::GlyphRun const>> DisplayListDecoder::read()
+{
+    auto font = TRY(read_font());
+    auto text_type = TRY(read<Gfx::GlyphRun::TextType>());
+    auto width = TRY(read<float>());
+    auto glyph_count = TRY(m_decoder.decode_size());
+    Vector<Gfx::DrawGlyph> glyphs;
+    TRY(glyphs.try_ensure_capacity(glyph_count));
+    for (size_t i = 0; i < glyph_count; ++i) {
+        auto position = TRY(read<Gfx::FloatPoint>());
+        auto glyph_id = TRY(read<u32>());
+        glyphs.unchecked_append({ position, glyph_id });
+    }
+    return adopt_ref(*new Gfx::GlyphRun(move(glyphs), move(font), text_type, width));
+}
+
+template<>
+ErrorOr<NonnullRefPtr<Gfx::ImmutableBitmap const>> DisplayListDecoder::read()
+{
+    auto id = TRY(read<u32>());
+    if (id < m_bitmaps.size())
+        return m_bitmaps[id];
+    if (id > m_bitmaps.size())
+        return Error::from_string_literal("IPC: Invalid display list bitmap");
+
+    auto bitmap = TRY(read_bitmap());
+    auto alpha_type = TRY(read<Gfx::AlphaType>());
+    auto color_space = TRY(read<Gfx::ColorSpace>());
+    auto immutable_bitmap = Gfx::ImmutableBitmap::create(move(bitmap), alpha_type, move(color_space));
+    m_bitmaps.append(immutable_bitmap);
+    return immutable_bitmap;
+}
+
+template<>
+ErrorOr<NonnullRefPtr<Gfx::YUVData const>> DisplayListDecoder::read()
+{
+    auto size = TRY(read<Gfx::IntSize>());
+    auto bit_depth = TRY(read<u8>());
+    auto chroma_subsampled_horizontally = TRY(read<bool>());
+    auto chroma_subsampled_vertically = TRY(read<bool>());
+    auto matrix_coefficients = TRY(read<Gfx::YUVMatrixCoefficients>());
+    auto range = TRY(read<Gfx::YUVRange>());
+    if (size.is_empty() || size.width() > max_yuv_data_dimension || size.height() > max_yuv_data_dimension || bit_depth < 8 || bit_depth > 16)
+        return Error::from_string_literal("IPC: Invalid display list YUV data");
+
+    auto yuv_data = TRY(Gfx::YUVData::create(size, bit_depth, chroma_subsampled_horizontally, chroma_subsampled_vertically));
+    yuv_data->set_matrix_coefficients(matrix_coefficients);
+    yuv_data->set_range(range);
+    for (size_t plane = 0; plane < Gfx::YUVData::plane_count; ++plane)
+        TRY(m_decoder.decode_into(yuv_data->plane_data(plane)));
+    return yuv_data;
+}
+
+template<>
+ErrorOr<NonnullRefPtr<Gfx::PaintingSurface const>> DisplayListDecoder::read()
+{
+    auto bitmap = TRY(read_bitmap());
+    return Gfx::PaintingSurface::wrap_bitmap(*bitmap);
+}
+
+template<>
+ErrorOr<RefPtr<DisplayList>> DisplayListDecoder::read()
+{
+    if (!TRY(read<bool>()))
+        return RefPtr<DisplayList> {};
+    return TRY(decode());
+}
+
+template<>
+ErrorOr<DrawGlyphRun> DisplayListDecoder::decode_command()
+{
+    return DrawGlyphRun {
+        .glyph_run = TRY(read<NonnullRefPtr<Gfx::GlyphRun const>>()),
+        .scale = TRY(read<double>()),
+        .rect = TRY(read<Gfx::IntRect>()),
+        .translation = TRY(read<Gfx::FloatPoint>()),
+        .color = TRY(read<Color>()),
+        .orientation = TRY(read<Gfx::Orientation>()),
+    };
+}
+
+template<>
+ErrorOr<FillRect> DisplayListDecoder::decode_command()
+{
+    return FillRect {
+        .rect = TRY(read<Gfx::IntRect>()),
+        .color = TRY(read<Color>()),
+    };
+}
+
+template<>
+ErrorOr<DrawPaintingSurface> DisplayListDecoder::decode_command()
+{
+    return DrawPaintingSurface {
+        .dst_rect = TRY(read<Gfx::IntRect>()),
+        .surface = TRY(read<NonnullRefPtr<Gfx::PaintingSurface const>>()),
+        .src_rect = TRY(read<Gfx::IntRect>()),
+        .scaling_mode = TRY(read<Gfx::ScalingMode>()),
+    };
+}
+
+template<>
+ErrorOr<DrawScaledImmutableBitmap> DisplayListDecoder::decode_command()
+{
+    return DrawScaledImmutableBitmap {
+        .dst_rect = TRY(read<Gfx::IntRect>()),
+        .clip_rect = TRY(read<Gfx::IntRect>()),
+        .bitmap = TRY(read<NonnullRefPtr<Gfx::ImmutableBitmap const>>()),
+        .scaling_mode = TRY(read<Gfx::ScalingMode>()),
+    };
+}
+
+template<>
+ErrorOr<DrawScaledYUVData> DisplayListDecoder::decode_command()
+{
+    return DrawScaledYUVData {
+        .dst_rect = TRY(read<Gfx::IntRect>()),
+        .clip_rect = TRY(read<Gfx::IntRect>()),
+        .yuv_data = TRY(read<NonnullRefPtr<Gfx::YUVData const>>()),
+        .scaling_mode = TRY(read<Gfx::ScalingMode>()),
+    };
+}
+
+template<>
+ErrorOr<DrawRepeatedImmutableBitmap> DisplayListDecoder::decode_command()
+{
+    return DrawRepeatedImmutableBitmap {
+        .dst_rect = TRY(read<Gfx::IntRect>()),
+        .clip_rect = TRY(read<Gfx::IntRect>()),
+        .bitmap = TRY(read<NonnullRefPtr<Gfx::ImmutableBitmap const>>()),
+        .scaling_mode = TRY(read<Gfx::ScalingMode>()),
+        .repeat = TRY(read<DrawRepeatedImmutableBitmap::Repeat>()),
+    };
+}
+
+template<>
+ErrorOr<Save> DisplayListDecoder::decode_command() { return Save {}; }
+
+template<>
+ErrorOr<SaveLayer> DisplayListDecoder::decode_command() { return SaveLayer {}; }
+
+template<>
+ErrorOr<Restore> DisplayListDecoder::decode_command() { return Restore {}; }
+
+template<>
+ErrorOr<Translate> DisplayListDecoder::decode_command() { return Translate { .delta = TRY(read<Gfx::IntPoint>()) }; }
+
+template<>
+ErrorOr<AddClipRect> DisplayListDecoder::decode_command() { return AddClipRect { .rect = TRY(read<Gfx::IntRect>()) }; }
+
+template<>
+ErrorOr<PushStackingContext> DisplayListDecoder::decode_command()
+{
+    return PushStackingContext {
+        .opacity = TRY(read<float>()),
+        .compositing_and_blending_operator = TRY(read<Gfx::CompositingAndBlendingOperator>()),
+        .isolate = TRY(read<bool>()),
+        .source_paintable_rect = TRY(read<Gfx::IntRect>()),
+        .transform = TRY(read<StackingContextTransform>()),
+        .clip_path = TRY(read<Optional<Gfx::Path>>()),
+    };
+}
+
+template<>
+ErrorOr<PopStackingContext> DisplayListDecoder::decode_command() { return PopStackingContext {}; }
+
+template<>
+ErrorOr<PaintLinearGradient> DisplayListDecoder::decode_command()
+{
+    return PaintLinearGradient {
+        .gradient_rect = TRY(read<Gfx::IntRect>()),
+        .linear_gradient_data = TRY(read<LinearGradientData>()),
+    };
+}
+
+template<>
+ErrorOr<PaintRadialGradient> DisplayListDecoder::decode_command()
+{
+    return PaintRadialGradient {
+        .rect = TRY(read<Gfx::IntRect>()),
+        .radial_gradient_data = TRY(read<RadialGradientData>()),
+        .center = TRY(read<Gfx::IntPoint>()),
+        .size = TRY(read<Gfx::IntSize>()),
+    };
+}
+
+template<>
+ErrorOr<PaintConicGradient> DisplayListDecoder::decode_command()
+{
+    return PaintConicGradient {
+        .rect = TRY(read<Gfx::IntRect>()),
+        .conic_gradient_data = TRY(read<ConicGradientData>()),
+        .position = TRY(read<Gfx::IntPoint>()),
+    };
+}
+
+template<>
+ErrorOr<PaintOuterBoxShadow> DisplayListDecoder::decode_command() { return PaintOuterBoxShadow { .box_shadow_params = TRY(read<PaintBoxShadowParams>()) }; }
+
+template<>
+ErrorOr<PaintInnerBoxShadow> DisplayListDecoder::decode_command() { return PaintInnerBoxShadow { .box_shadow_params = TRY(read<PaintBoxShadowParams>()) }; }
+
+template<>
+ErrorOr<PaintTextShadow> DisplayListDecoder::decode_command()
+{
+    return PaintTextShadow {
+        .glyph_run = TRY(read<NonnullRefPtr<Gfx::GlyphRun const>>()),
+        .glyph_run_scale = TRY(read<double>()),
+        .shadow_bounding_rect = TRY(read<Gfx::IntRect>()),
+        .text_rect = TRY(read<Gfx::IntRect>()),
+        .draw_location = TRY(read<Gfx::FloatPoint>()),
+        .blur_radius = TRY(read<int>()),
+        .color = TRY(read<Color>()),
+    };
+}
+
+template<>
+ErrorOr<FillRectWithRoundedCorners> DisplayListDecoder::decode_command()
+{
+    return FillRectWithRoundedCorners {
+        .rect = TRY(read<Gfx::IntRect>()),
+        .color = TRY(read<Color>()),
+        .corner_radii = TRY(read<CornerRadii>()),
+    };
+}
+
+template<>
+ErrorOr<FillPathUsingColor> DisplayListDecoder::decode_command()
+{
+    return FillPathUsingColor {
+        .path_bounding_rect = TRY(read<Gfx::IntRect>()),
+        .path = TRY(read<Gfx::Path>()),
+        .color = TRY(read<Color>()),
+        .winding_rule = TRY(read<Gfx::WindingRule>()),
+        .aa_translation = TRY(read<Gfx::FloatPoint>()),
+    };
+}
+
+template<>
+ErrorOr<FillPathUsingPaintStyle> DisplayListDecoder::decode_command()
+{
+    return FillPathUsingPaintStyle {
+        .path_bounding_rect = TRY(read<Gfx::IntRect>()),
+        .path = TRY(read<Gfx::Path>()),
+        .paint_style = TRY(read<PaintStyle>()),
+        .winding_rule = TRY(read<Gfx::WindingRule>()),
+        .opacity = TRY(read<float>()),
+        .aa_translation = TRY(read<Gfx::FloatPoint>()),
+    };
+}
+
+template<>
+ErrorOr<StrokePathUsingColor> DisplayListDecoder::decode_command()
+{
+    return StrokePathUsingColor {
+        .cap_style = TRY(read<Gfx::Path::CapStyle>()),
+        .join_style = TRY(read<Gfx::Path::JoinStyle>()),
+        .miter_limit = TRY(read<float>()),
+        .dash_array = TRY(read<Vector<float>>()),
+        .dash_offset = TRY(read<float>()),
+        .path_bounding_rect = TRY(read<Gfx::IntRect>()),
+        .path = TRY(read<Gfx::Path>()),
+        .color = TRY(read<Color>()),
+        .thickness = TRY(read<float>()),
+        .aa_translation = TRY(read<Gfx::FloatPoint>()),
+    };
+}
+
+template<>
+ErrorOr<StrokePathUsingPaintStyle> DisplayListDecoder::decode_command()
+{
+    return StrokePathUsingPaintStyle {
+        .cap_style = TRY(read<Gfx::Path::CapStyle>()),
+        .join_style = TRY(read<Gfx::Path::JoinStyle>()),
+        .miter_limit = TRY(read<float>()),
+        .dash_array = TRY(read<Vector<float>>()),
+        .dash_offset = TRY(read<float>()),
+        .path_bounding_rect = TRY(read<Gfx::IntRect>()),
+        .path = TRY(read<Gfx::Path>()),
+        .paint_style = TRY(read<PaintStyle>()),
+        .thickness = TRY(read<float>()),
+        .opacity = TRY(read<float>()),
+        .aa_translation = TRY(read<Gfx::FloatPoint>()),
+    };
+}
+
+template<>
+ErrorOr<DrawEllipse> DisplayListDecoder::decode_command()
+{
+    return DrawEllipse {
+        .rect = TRY(read<Gfx::IntRect>()),
+        .color = TRY(read<Color>()),
+        .thickness = TRY(read<int>()),
+    };
+}
+
+template<>
+ErrorOr<FillEllipse> DisplayListDecoder::decode_command()
+{
+    return FillEllipse {
+        .rect = TRY(read<Gfx::IntRect>()),
+        .color = TRY(read<Color>()),
+    };
+}
+
+template<>
+ErrorOr<DrawLine> DisplayListDecoder::decode_command()
+{
+    return DrawLine {
+        .color = TRY(read<Color>()),
+        .from = TRY(read<Gfx::IntPoint>()),
+        .to = TRY(read<Gfx::IntPoint>()),
+        .thickness = TRY(read<int>()),
+        .style = TRY(read<Gfx::LineStyle>()),
+        .alternate_color = TRY(read<Color>()),
+    };
+}
+
+template<>
+ErrorOr<ApplyBackdropFilter> DisplayListDecoder::decode_command()
+{
+    return ApplyBackdropFilter {
+        .backdrop_region = TRY(read<Gfx::IntRect>()),
+        .border_radii_data = TRY(read<BorderRadiiData>()),
+        .backdrop_filter = TRY(read<Optional<Gfx::Filter>>()),
+    };
+}
+
+template<>
+ErrorOr<DrawRect> DisplayListDecoder::decode_command()
+{
+    return DrawRect {
+        .rect = TRY(read<Gfx::IntRect>()),
+        .color = TRY(read<Color>()),
+        .rough = TRY(read<bool>()),
+    };
+}
+
+template<>
+ErrorOr<DrawTriangleWave> DisplayListDecoder::decode_command()
+{
+    return DrawTriangleWave {
+        .p1 = TRY(read<Gfx::IntPoint>()),
+        .p2 = TRY(read<Gfx::IntPoint>()),
+        .color = TRY(read<Color>()),
+        .amplitude = TRY(read<int>()),
+        .thickness = TRY(read<int>()),
+    };
+}
+
+template<>
+ErrorOr<AddRoundedRectClip> DisplayListDecoder::decode_command()
+{
+    return AddRoundedRectClip {
+        .corner_radii = TRY(read<CornerRadii>()),
+        .border_rect = TRY(read<Gfx::IntRect>()),
+        .corner_clip = TRY(read<CornerClip>()),
+    };
+}
+
+template<>
+ErrorOr<AddMask> DisplayListDecoder::decode_command()
+{
+    return AddMask {
+        .display_list = TRY(read<RefPtr<DisplayList>>()),
+        .rect = TRY(read<Gfx::IntRect>()),
+    };
+}
+
+template<>
+ErrorOr<PaintNestedDisplayList> DisplayListDecoder::decode_command()
+{
+    return PaintNestedDisplayList {
+        .display_list = TRY(read<RefPtr<DisplayList>>()),
+        .scroll_state_snapshot = TRY(read<ScrollStateSnapshot>()),
+        .rect = TRY(read<Gfx::IntRect>()),
+    };
+}
+
+template<>
+ErrorOr<PaintScrollBar> DisplayListDecoder::decode_command()
+{
+    return PaintScrollBar {
+        .scroll_frame_id = TRY(read<int>()),
+        .gutter_rect = TRY(read<Gfx::IntRect>()),
+        .thumb_rect = TRY(read<Gfx::IntRect>()),
+        .scroll_size = TRY(read<CSSPixelFraction>()),
+        .thumb_color = TRY(read<Color>()),
+        .track_color = TRY(read<Color>()),
+        .vertical = TRY(read<bool>()),
+    };
+}
+
+template<>
+ErrorOr<ApplyOpacity> DisplayListDecoder::decode_command() { return ApplyOpacity { .opacity = TRY(read<float>()) }; }
+
+template<>
+ErrorOr<ApplyCompositeAndBlendingOperator> DisplayListDecoder::decode_command()
+{
+    return ApplyCompositeAndBlendingOperator { .compositing_and_blending_operator = TRY(read<Gfx::CompositingAndBlendingOperator>()) };
+}
+
+template<>
+ErrorOr<ApplyFilter> DisplayListDecoder::decode_command() { return ApplyFilter { .filter = TRY(read<Gfx::Filter>()) }; }
+
+template<>
+ErrorOr<ApplyTransform> DisplayListDecoder::decode_command()
+{
+    return ApplyTransform {
+        .origin = TRY(read<Gfx::FloatPoint>()),
+        .matrix = TRY(read<Gfx::FloatMatrix4x4>()),
+    };
+}
+
+template<>
+ErrorOr<ApplyMaskBitmap> DisplayListDecoder::decode_command()
+{
+    return ApplyMaskBitmap {
+        .origin = TRY(read<Gfx::IntPoint>()),
+        .bitmap = TRY(read<NonnullRefPtr<Gfx::ImmutableBitmap const>>()),
+        .kind = TRY(read<Gfx::Bitmap::MaskKind>()),
+    };
+}
+
+ErrorOr<NonnullRefPtr<DisplayList>> DisplayListDecoder::decode()
+{
+    if (m_depth >= max_nested_display_list_depth)
+        return Error::from_string_literal("IPC: Display list is nested too deeply");
+    ++m_depth;
+    ScopeGuard decrement_depth = [&] { --m_depth; };
+
+    auto display_list = DisplayList::create();
+    display_list->set_device_pixels_per_css_pixel(TRY(read<double>()));
+    auto command_count = TRY(m_decoder.decode_size());
+    for (size_t i = 0; i < command_count; ++i) {
+        auto scroll_frame_id = TRY(read<Optional<i32>>());
+        auto index = TRY(read<Command::IndexType>());
+        display_list->append(TRY(decode_command_with_index(index)), scroll_frame_id);
+    }
+    return display_list;
+}
+
+}
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder& encoder, Web::Painting::DisplayList const& display_list)
+{
+    return Web::Painting::DisplayListEncoder { encoder }.encode(display_list);
+}
+
+template<>
+ErrorOr<NonnullRefPtr<Web::Painting::DisplayList>> decode(Decoder& decoder)
+{
+    return Web::Painting::DisplayListDecoder { decoder }.decode();
+}
+
+}
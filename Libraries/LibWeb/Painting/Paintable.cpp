@@ -153,11 +153,86 @@ StackingContext* Paintable::enclosing_stacking_context()
     VERIFY_NOT_REACHED();
 }
 
-void Paintable::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
+bool Paintable::is_painted_at_its_absolute_rect() const
+{
+    for (auto const* paintable = this; paintable; paintable = paintable->parent()) {
+        if (paintable->is_fixed_position() || paintable->is_sticky_position())
+            return false;
+        if (!paintable->is_paintable_box())
+            continue;
+        auto const& paintable_box = static_cast<PaintableBox const&>(*paintable);
+        if (paintable_box.has_css_transform())
+            return false;
+        if (paintable_box.computed_values().filter().has_value() || paintable_box.computed_values().backdrop_filter().has_value())
+            return false;
+        if (!paintable_box.is_viewport() && paintable_box.own_scroll_frame())
+            return false;
+    }
+    return true;
+}
+
+static CSSPixelRect absolute_repaint_rect_for_fragment(PaintableFragment const& fragment)
+{
+    // Glyphs may overhang their fragment (e.g. italics), and the caret is painted just past its end, so pad the
+    // fragment by its own height to be safe.
+    auto rect = fragment.absolute_rect();
+    auto padding = fragment.height();
+    rect.inflate(padding, padding, padding, padding);
+
+    for (auto const& shadow : fragment.layout_node().computed_values().text_shadow()) {
+        auto inflate = shadow.spread_distance + shadow.blur_radius;
+        rect.unite(rect.inflated(inflate, inflate, inflate, inflate).translated(shadow.offset_x, shadow.offset_y));
+    }
+    return rect;
+}
+
+void Paintable::invalidate_display_list()
 {
     auto& document = const_cast<DOM::Document&>(this->document());
-    if (should_invalidate_display_list == InvalidateDisplayList::Yes)
+
+    // NOTE: The viewport is repainted whenever "everything" needs repainting, so treat it as such.
+    if (is_paintable_box() && static_cast<PaintableBox const&>(*this).is_viewport()) {
         document.invalidate_display_list();
+        return;
+    }
+
+    for (auto* paintable = this; paintable; paintable = paintable->parent()) {
+        if (!paintable->is_paintable_box())
+            continue;
+        if (auto* stacking_context = static_cast<PaintableBox&>(*paintable).stacking_context()) {
+            stacking_context->invalidate_cached_commands();
+            document.invalidate_cached_display_list();
+            return;
+        }
+    }
+
+    // The stacking context tree hasn't been built yet, so there's nothing cached to keep.
+    document.invalidate_display_list();
+}
+
+void Paintable::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
+{
+    if (should_invalidate_display_list == InvalidateDisplayList::Yes)
+        invalidate_display_list();
+
+    damage_visual_rect();
+
+    // NOTE: Style changes reach us before the paint-only properties they affect are resolved, so the rect damaged above
+    //       may be stale. Damage the new one as well once they've been resolved.
+    m_needs_display_after_resolving_paint_properties = true;
+}
+
+void Paintable::did_resolve_paint_properties()
+{
+    if (!m_needs_display_after_resolving_paint_properties)
+        return;
+    m_needs_display_after_resolving_paint_properties = false;
+    damage_visual_rect();
+}
+
+void Paintable::damage_visual_rect()
+{
+    auto& document = const_cast<DOM::Document&>(this->document());
 
     auto* containing_block = this->containing_block();
     if (!containing_block)
@@ -165,8 +240,14 @@ void Paintable::set_needs_display(InvalidateDisplayList should_invalidate_displa
 
     if (!is<Painting::PaintableWithLines>(*containing_block))
         return;
+
+    if (!is_painted_at_its_absolute_rect()) {
+        document.set_needs_display(InvalidateDisplayList::No);
+        return;
+    }
+
     static_cast<Painting::PaintableWithLines const&>(*containing_block).for_each_fragment([&](auto& fragment) {
-        document.set_needs_display(fragment.absolute_rect(), InvalidateDisplayList::No);
+        document.set_needs_display(absolute_repaint_rect_for_fragment(fragment), InvalidateDisplayList::No);
         return IterationDecision::Continue;
     });
 }
@@ -105,7 +105,15 @@ public:
 
     GC::Ptr<HTML::Navigable> navigable() const;
 
-    virtual void set_needs_display(InvalidateDisplayList = InvalidateDisplayList::Yes);
+    void set_needs_display(InvalidateDisplayList = InvalidateDisplayList::Yes);
+
+    // Invalidates the display list, along with the commands cached for the stacking contexts containing this paintable.
+    void invalidate_display_list();
+
+    // Returns false if this paintable may end up somewhere other than its absolute rect, because it or one of its
+    // ancestors is transformed, filtered, fixed, sticky or scrolled. Repaints of such paintables can't be limited to
+    // a damage rect.
+    [[nodiscard]] bool is_painted_at_its_absolute_rect() const;
 
     PaintableBox* containing_block() const;
 
@@ -138,6 +146,11 @@ public:
 
     virtual void resolve_paint_properties() { }
 
+    // Must be called right after resolve_paint_properties(). A paintable that needed display before its paint-only
+    // properties (box shadows, outlines, transforms, ...) were resolved was damaged using the stale values, so its
+    // freshly resolved visual rect is damaged as well.
+    void did_resolve_paint_properties();
+
     virtual void finalize() override
     {
         if (m_list_node.is_in_list())
@@ -151,6 +164,10 @@ protected:
 
     virtual void visit_edges(Cell::Visitor&) override;
 
+    // Adds the area this paintable is drawn in to the document's damage, or damages everything if that area can't be
+    // determined from the absolute rect alone.
+    virtual void damage_visual_rect();
+
 private:
     IntrusiveListNode<Paintable> m_list_node;
     GC::Ptr<DOM::Node> m_dom_node;
@@ -166,6 +183,7 @@ private:
     bool m_absolutely_positioned : 1 { false };
     bool m_floating : 1 { false };
     bool m_inline : 1 { false };
+    bool m_needs_display_after_resolving_paint_properties : 1 { false };
 };
 
 inline DOM::Node* HitTestResult::dom_node()
@@ -1316,9 +1316,19 @@ TraversalDecision PaintableWithLines::hit_test(CSSPixelPoint position, HitTestTy
     return TraversalDecision::Continue;
 }
 
-void PaintableBox::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
+void PaintableBox::damage_visual_rect()
 {
-    document().set_needs_display(absolute_rect(), should_invalidate_display_list);
+    if (!is_painted_at_its_absolute_rect()) {
+        document().set_needs_display(InvalidateDisplayList::No);
+        return;
+    }
+
+    auto rect = absolute_paint_rect();
+    if (auto const& outline = outline_data(); outline.has_value()) {
+        auto outline_extent = max(CSSPixels(0), max(outline->top.width, max(outline->right.width, max(outline->bottom.width, outline->left.width))) + outline_offset());
+        rect.inflate(outline_extent, outline_extent, outline_extent, outline_extent);
+    }
+    document().set_needs_display(rect, InvalidateDisplayList::No);
 }
 
 Optional<CSSPixelRect> PaintableBox::get_masking_area() const
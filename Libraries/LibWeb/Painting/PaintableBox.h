@@ -132,8 +132,6 @@ public:
     DOM::Node const* dom_node() const { return layout_node_with_style_and_box_metrics().dom_node(); }
     DOM::Node* dom_node() { return layout_node_with_style_and_box_metrics().dom_node(); }
 
-    virtual void set_needs_display(InvalidateDisplayList = InvalidateDisplayList::Yes) override;
-
     void apply_scroll_offset(PaintContext&) const;
     void reset_scroll_offset(PaintContext&) const;
 
@@ -193,7 +191,12 @@ public:
     BorderRadiiData const& border_radii_data() const { return m_border_radii_data; }
     void set_border_radii_data(BorderRadiiData const& border_radii_data) { m_border_radii_data = border_radii_data; }
 
-    void set_box_shadow_data(Vector<ShadowData> box_shadow_data) { m_box_shadow_data = move(box_shadow_data); }
+    void set_box_shadow_data(Vector<ShadowData> box_shadow_data)
+    {
+        m_box_shadow_data = move(box_shadow_data);
+        // NOTE: Outer shadows are part of the paint rect.
+        m_absolute_paint_rect.clear();
+    }
     Vector<ShadowData> const& box_shadow_data() const { return m_box_shadow_data; }
 
     void set_transform(Gfx::FloatMatrix4x4 transform) { m_transform = transform; }
@@ -273,6 +276,8 @@ protected:
     virtual CSSPixelRect compute_absolute_rect() const;
     virtual CSSPixelRect compute_absolute_paint_rect() const;
 
+    virtual void damage_visual_rect() override;
+
     struct ScrollbarData {
         CSSPixelRect gutter_rect;
         CSSPixelRect thumb_rect;
@@ -51,6 +51,13 @@ static Gfx::WindingRule to_gfx_winding_rule(SVG::FillRule fill_rule)
     }
 }
 
+SVGPathPaintable::DevicePaths& SVGPathPaintable::device_paths(Gfx::AffineTransform const& transform) const
+{
+    if (!m_device_paths.has_value() || m_device_paths->transform != transform)
+        m_device_paths = DevicePaths { .transform = transform, .path = computed_path()->copy_transformed(transform), .closed_path = {} };
+    return *m_device_paths;
+}
+
 void SVGPathPaintable::paint(PaintContext& context, PaintPhase phase) const
 {
     if (!is_visible() || !computed_path().has_value())
@@ -72,16 +79,20 @@ void SVGPathPaintable::paint(PaintContext& context, PaintPhase phase) const
     auto maybe_view_box = svg_node->dom_node().view_box();
 
     auto paint_transform = computed_transforms().svg_to_device_pixels_transform(context);
-    auto path = computed_path()->copy_transformed(paint_transform);
+    auto& device_paths = this->device_paths(paint_transform);
+    auto const& path = device_paths.path;
 
     // Fills are computed as though all subpaths are closed (https://svgwg.org/svg2-draft/painting.html#FillProperties)
-    auto closed_path = [&] {
+    auto closed_path = [&]() -> Gfx::Path const& {
         // We need to fill the path before applying the stroke, however the filled
         // path must be closed, whereas the stroke path may not necessary be closed.
         // Copy the path and close it for filling, but use the previous path for stroke
-        auto copy = path;
-        copy.close_all_subpaths();
-        return copy;
+        if (!device_paths.closed_path.has_value()) {
+            auto copy = path;
+            copy.close_all_subpaths();
+            device_paths.closed_path = move(copy);
+        }
+        return *device_paths.closed_path;
     };
 
     auto svg_viewport = [&] {
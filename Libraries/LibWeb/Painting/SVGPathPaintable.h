@@ -28,6 +28,7 @@ public:
     void set_computed_path(Gfx::Path path)
     {
         m_computed_path = move(path);
+        m_device_paths.clear();
     }
 
     Optional<Gfx::Path> const& computed_path() const { return m_computed_path; }
@@ -36,6 +37,18 @@ protected:
     SVGPathPaintable(Layout::SVGGraphicsBox const&);
 
     Optional<Gfx::Path> m_computed_path = {};
+
+private:
+    struct DevicePaths {
+        Gfx::AffineTransform transform;
+        Gfx::Path path;
+        Optional<Gfx::Path> closed_path;
+    };
+    DevicePaths& device_paths(Gfx::AffineTransform const&) const;
+
+    // The computed path mapped to device pixels for the transform it was last painted with. Repaints that don't
+    // change the transform reuse the same paths, so the painter can reuse their tessellation as well.
+    mutable Optional<DevicePaths> m_device_paths;
 };
 
 }
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
 #include <LibWeb/Painting/ScrollState.h>
 
 namespace Web::Painting {
@@ -18,3 +20,37 @@ ScrollStateSnapshot ScrollStateSnapshot::create(Vector<NonnullRefPtr<ScrollFrame
 }
 
 }
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder& encoder, Web::Painting::ScrollStateSnapshot const& snapshot)
+{
+    TRY(encoder.encode<u64>(snapshot.entries.size()));
+    for (auto const& entry : snapshot.entries) {
+        TRY(encoder.encode(entry.cumulative_offset.x().raw_value()));
+        TRY(encoder.encode(entry.cumulative_offset.y().raw_value()));
+        TRY(encoder.encode(entry.own_offset.x().raw_value()));
+        TRY(encoder.encode(entry.own_offset.y().raw_value()));
+    }
+    return {};
+}
+
+template<>
+ErrorOr<Web::Painting::ScrollStateSnapshot> decode(Decoder& decoder)
+{
+    auto size = TRY(decoder.decode<u64>());
+
+    Web::Painting::ScrollStateSnapshot snapshot;
+    TRY(snapshot.entries.try_ensure_capacity(size));
+    for (u64 i = 0; i < size; ++i) {
+        auto cumulative_offset_x = Web::CSSPixels::from_raw(TRY(decoder.decode<int>()));
+        auto cumulative_offset_y = Web::CSSPixels::from_raw(TRY(decoder.decode<int>()));
+        auto own_offset_x = Web::CSSPixels::from_raw(TRY(decoder.decode<int>()));
+        auto own_offset_y = Web::CSSPixels::from_raw(TRY(decoder.decode<int>()));
+        snapshot.entries.unchecked_append({ { cumulative_offset_x, cumulative_offset_y }, { own_offset_x, own_offset_y } });
+    }
+    return snapshot;
+}
+
+}
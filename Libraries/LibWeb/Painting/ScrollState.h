@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/NonnullOwnPtr.h>
+#include <LibIPC/Forward.h>
 #include <LibWeb/Painting/ScrollFrame.h>
 
 namespace Web::Painting {
@@ -29,10 +30,19 @@ public:
         return entries[id].own_offset;
     }
 
+    bool operator==(ScrollStateSnapshot const&) const = default;
+
 private:
+    template<typename T>
+    friend ErrorOr<void> IPC::encode(IPC::Encoder&, T const&);
+    template<typename T>
+    friend ErrorOr<T> IPC::decode(IPC::Decoder&);
+
     struct Entry {
         CSSPixelPoint cumulative_offset;
         CSSPixelPoint own_offset;
+
+        bool operator==(Entry const&) const = default;
     };
     Vector<Entry> entries;
 };
@@ -93,3 +103,13 @@ private:
 };
 
 }
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder&, Web::Painting::ScrollStateSnapshot const&);
+
+template<>
+ErrorOr<Web::Painting::ScrollStateSnapshot> decode(Decoder&);
+
+}
@@ -12,6 +12,8 @@
 #include <LibGfx/AffineTransform.h>
 #include <LibGfx/Matrix4x4.h>
 #include <LibGfx/Rect.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/HTML/Navigable.h>
 #include <LibWeb/Layout/ReplacedBox.h>
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Painting/Blending.h>
@@ -285,7 +287,54 @@ static Gfx::FloatMatrix4x4 matrix_with_scaled_translation(Gfx::FloatMatrix4x4 ma
     return matrix;
 }
 
+void StackingContext::invalidate_cached_commands()
+{
+    for (auto* stacking_context = this; stacking_context; stacking_context = stacking_context->parent())
+        stacking_context->m_cached_commands.clear();
+}
+
 void StackingContext::paint(PaintContext& context) const
+{
+    auto& display_list = context.display_list_recorder().display_list();
+    auto display_list_generation = paintable_box().document().display_list_generation();
+    // NOTE: The caret and focus indicators are only painted into the focused navigable.
+    auto navigable = paintable_box().navigable();
+    auto navigable_is_focused = navigable && navigable->is_focused();
+
+    if (m_cached_commands.has_value()
+        && m_cached_commands->display_list_generation == display_list_generation
+        && m_cached_commands->device_pixels_per_css_pixel == context.device_pixels_per_css_pixel()
+        && m_cached_commands->should_paint_overlay == context.should_paint_overlay()
+        && m_cached_commands->should_show_line_box_borders == context.should_show_line_box_borders()
+        && m_cached_commands->navigable_is_focused == navigable_is_focused) {
+        for (auto const& item : m_cached_commands->commands)
+            display_list.append(Command { item.command }, item.scroll_frame_id);
+        return;
+    }
+
+    auto first_command_index = display_list.commands().size();
+    paint_uncached(context);
+
+    // NOTE: The root stacking context is recorded into every display list anyway, so there's no point in caching it.
+    if (!m_parent)
+        return;
+
+    CachedCommands cached_commands {
+        .commands = {},
+        .display_list_generation = display_list_generation,
+        .device_pixels_per_css_pixel = context.device_pixels_per_css_pixel(),
+        .should_paint_overlay = context.should_paint_overlay(),
+        .should_show_line_box_borders = context.should_show_line_box_borders(),
+        .navigable_is_focused = navigable_is_focused,
+    };
+    auto const& commands = display_list.commands();
+    cached_commands.commands.ensure_capacity(commands.size() - first_command_index);
+    for (auto i = first_command_index; i < commands.size(); ++i)
+        cached_commands.commands.unchecked_append(commands[i]);
+    m_cached_commands = move(cached_commands);
+}
+
+void StackingContext::paint_uncached(PaintContext& context) const
 {
     auto opacity = paintable_box().computed_values().opacity();
     if (opacity == 0.0f)
@@ -8,6 +8,7 @@
 
 #include <AK/Vector.h>
 #include <LibGfx/Matrix4x4.h>
+#include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/Paintable.h>
 
 namespace Web::Painting {
@@ -46,6 +47,9 @@ public:
 
     void set_last_paint_generation_id(u64 generation_id);
 
+    // Drops the commands cached for this stacking context and all of its ancestors, since they include ours.
+    void invalidate_cached_commands();
+
 private:
     GC::Ref<PaintableBox> m_paintable;
     StackingContext* const m_parent { nullptr };
@@ -58,6 +62,19 @@ private:
 
     static void paint_child(PaintContext&, StackingContext const&);
     void paint_internal(PaintContext&) const;
+    void paint_uncached(PaintContext&) const;
+
+    // The commands recorded the last time this stacking context was painted, which are appended as-is to the next
+    // display list if nothing inside the stacking context was invalidated since.
+    struct CachedCommands {
+        Vector<DisplayList::CommandListItem> commands;
+        u64 display_list_generation { 0 };
+        double device_pixels_per_css_pixel { 0 };
+        bool should_paint_overlay { false };
+        bool should_show_line_box_borders { false };
+        bool navigable_is_focused { false };
+    };
+    mutable Optional<CachedCommands> m_cached_commands;
 };
 
 }
@@ -134,6 +134,12 @@ void VideoPaintable::paint(PaintContext& context, PaintPhase phase) const
         context.display_list_recorder().draw_scaled_immutable_bitmap(dst_rect, dst_rect, Gfx::ImmutableBitmap::create(*frame), scaling_mode);
     };
 
+    auto paint_yuv_frame = [&](Gfx::YUVData const& yuv_data) {
+        auto scaling_mode = to_gfx_scaling_mode(computed_values().image_rendering(), yuv_data.rect(), video_rect.to_type<int>());
+        auto dst_rect = video_rect.to_type<int>();
+        context.display_list_recorder().draw_scaled_yuv_data(dst_rect, dst_rect, yuv_data, scaling_mode);
+    };
+
     auto paint_transparent_black = [&]() {
         static constexpr auto transparent_black = Gfx::Color::from_argb(0x00'00'00'00);
         context.display_list_recorder().fill_rect(video_rect.to_type<int>(), transparent_black);
@@ -155,7 +161,9 @@ void VideoPaintable::paint(PaintContext& context, PaintPhase phase) const
     case Representation::LastRenderedVideoFrame:
         // FIXME: We likely need to cache all (or a subset of) decoded video frames along with their position. We at least
         //        will need the first video frame and the last-rendered video frame.
-        if (current_frame.frame)
+        if (current_frame.yuv_data)
+            paint_yuv_frame(*current_frame.yuv_data);
+        else if (current_frame.frame)
             paint_frame(current_frame.frame);
         if (paint_user_agent_controls)
             paint_loaded_video_controls();
@@ -316,6 +316,7 @@ void ViewportPaintable::resolve_paint_only_properties()
     // - Outlines
     for_each_in_inclusive_subtree([&](Paintable& paintable) {
         paintable.resolve_paint_properties();
+        paintable.did_resolve_paint_properties();
         return TraversalDecision::Continue;
     });
 }
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/RefCounted.h>
 #include <AK/RefPtr.h>
 #include <AK/Vector.h>
 #include <LibCore/Promise.h>
@@ -20,11 +21,41 @@ struct Frame {
     size_t duration { 0 };
 };
 
+// Decodes the frames of a large animation as they are needed, rather than all of them up front. The animation's
+// decoder is released along with the last reference to its frame source.
+class AnimationFrameSource : public RefCounted<AnimationFrameSource> {
+public:
+    virtual ~AnimationFrameSource() = default;
+
+    using FramesCallback = Function<void(size_t first_frame_index, Vector<Frame>)>;
+    virtual void request_frames(size_t first_frame_index, size_t count, ESCAPING FramesCallback) = 0;
+};
+
+// Decodes an image while its data is still arriving, so that it can be painted before it has finished loading. The
+// decode ends along with the last reference to it.
+class IncrementalImageDecoder : public RefCounted<IncrementalImageDecoder> {
+public:
+    virtual ~IncrementalImageDecoder() = default;
+
+    virtual void append_data(ReadonlyBytes) = 0;
+};
+
+// How soon a decoded image is needed, going by where it is on the page.
+enum class ImageDecodePriority : u8 {
+    Offscreen,
+    NearViewport,
+    Visible,
+};
+
 struct DecodedImage {
     bool is_animated { false };
     u32 loop_count { 0 };
+    size_t frame_count { 0 };
     Vector<Frame> frames;
     Gfx::ColorSpace color_space;
+
+    // Set if `frames` only holds the first few of the animation's `frame_count` frames.
+    RefPtr<AnimationFrameSource> frame_source;
 };
 
 class ImageCodecPlugin {
@@ -34,7 +65,11 @@ public:
 
     virtual ~ImageCodecPlugin();
 
-    virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected) = 0;
+    virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected, ImageDecodePriority = ImageDecodePriority::NearViewport) = 0;
+
+    // Returns null if images can't be decoded before all of their data has arrived.
+    using PartialImageCallback = Function<void(NonnullRefPtr<Gfx::Bitmap>, Gfx::ColorSpace)>;
+    virtual RefPtr<IncrementalImageDecoder> start_incremental_decode(ESCAPING PartialImageCallback) { return nullptr; }
 };
 
 }
@@ -158,6 +158,7 @@ void SVGImageElement::fetch_the_document(URL::URL const& url)
 {
     m_load_event_delayer.emplace(document());
     m_resource_request = HTML::SharedResourceRequest::get_or_create(realm(), document().page(), url);
+    m_resource_request->keep_decoded_image_resident();
     m_resource_request->add_callbacks(
         [this] {
             m_load_event_delayer.clear();
@@ -100,8 +100,10 @@ void SVGPathElement::attribute_changed(FlyString const& name, Optional<String> c
 {
     Base::attribute_changed(name, old_value, value, namespace_);
 
-    if (name == "d")
+    if (name == "d") {
         m_instructions = AttributeParser::parse_path_data(value.value_or(String {}));
+        m_path.clear();
+    }
 }
 
 Gfx::Path path_from_path_instructions(ReadonlySpan<PathInstruction> instructions)
@@ -274,7 +276,9 @@ Gfx::Path path_from_path_instructions(ReadonlySpan<PathInstruction> instructions
 
 Gfx::Path SVGPathElement::get_path(CSSPixelSize)
 {
-    return path_from_path_instructions(m_instructions);
+    if (!m_path.has_value())
+        m_path = path_from_path_instructions(m_instructions);
+    return *m_path;
 }
 
 }
@@ -30,6 +30,11 @@ private:
     virtual void initialize(JS::Realm&) override;
 
     Vector<PathInstruction> m_instructions;
+
+    // The path built from m_instructions, kept until the "d" attribute changes. Copies of a Gfx::Path share their
+    // underlying geometry, so handing the same path out on every relayout also lets the painter reuse whatever it
+    // derived from it.
+    Optional<Gfx::Path> m_path;
 };
 
 [[nodiscard]] Gfx::Path path_from_path_instructions(ReadonlySpan<PathInstruction>);
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/AbortSignal.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Agent.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/Scheduling/Scheduler.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::Scheduling {
+
+GC_DEFINE_ALLOCATOR(Scheduler);
+
+GC::Ref<Scheduler> Scheduler::create(JS::Realm& realm)
+{
+    return realm.create<Scheduler>(realm);
+}
+
+Scheduler::Scheduler(JS::Realm& realm)
+    : PlatformObject(realm)
+{
+}
+
+Scheduler::~Scheduler() = default;
+
+void Scheduler::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(Scheduler);
+    Base::initialize(realm);
+}
+
+static HTML::Task::Priority to_task_priority(Bindings::TaskPriority priority)
+{
+    switch (priority) {
+    case Bindings::TaskPriority::UserBlocking:
+        return HTML::Task::Priority::UserBlocking;
+    case Bindings::TaskPriority::UserVisible:
+        return HTML::Task::Priority::UserVisible;
+    case Bindings::TaskPriority::Background:
+        return HTML::Task::Priority::Background;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// https://wicg.github.io/scheduling-apis/#queue-a-scheduler-task
+GC::Ref<HTML::Task> Scheduler::create_a_scheduler_task(HTML::Task::Priority priority, GC::Ref<GC::Function<void()>> steps)
+{
+    // NOTE: The scheduler task queues are the priority levels of the event loop's task queue, so selecting the
+    //       scheduler task queue for a priority amounts to giving the task that priority.
+    auto& global = HTML::relevant_global_object(*this);
+
+    // 1. Let document be global's associated Document if global is a Window object; otherwise null.
+    GC::Ptr<DOM::Document> document;
+    if (auto* window = as_if<HTML::Window>(global))
+        document = &window->associated_document();
+
+    // 2. Let task be a new task.
+    // 3. Set task's steps to steps.
+    // 4. Set task's source to the posted task task source.
+    // 5. Set task's document to document.
+    // 6. Set task's script evaluation environment settings object set to an empty set.
+    return HTML::Task::create(vm(), HTML::Task::Source::PostedTask, priority, document, steps);
+}
+
+void Scheduler::queue_a_scheduler_task(GC::Ref<HTML::Task> task)
+{
+    // 7. Enqueue task in queue's tasks.
+    HTML::relevant_agent(HTML::relevant_global_object(*this)).event_loop->task_queue().add(task);
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-scheduler-posttask
+GC::Ref<WebIDL::Promise> Scheduler::post_task(WebIDL::CallbackType& callback, SchedulerPostTaskOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // The postTask(callback, options) method steps are to return the result of scheduling a postTask task for this
+    // given callback and options.
+    // https://wicg.github.io/scheduling-apis/#schedule-a-posttask-task
+
+    // 1. Let result be a new promise.
+    auto result = WebIDL::create_promise(realm);
+
+    // 2. Let signal be options["signal"] if options["signal"] exists, or otherwise null.
+    auto signal = options.signal;
+
+    // 3. If signal is not null and it is aborted, then reject result with signal's abort reason and return result.
+    if (signal && signal->aborted()) {
+        WebIDL::reject_promise(realm, result, signal->reason());
+        return result;
+    }
+
+    // 4. Let state be a new scheduling state.
+    // 5. Set state's abort source to signal.
+    // 6. If options["priority"] exists, then set state's priority source to the result of creating a fixed priority
+    //    unabortable task signal given options["priority"].
+    // FIXME: 7. Otherwise if signal is not null and implements the TaskSignal interface, then set state's priority source to signal.
+    // 8. If state's priority source is null, then set state's priority source to the result of creating a fixed
+    //    priority unabortable task signal given "user-visible".
+    auto priority = to_task_priority(options.priority.value_or(Bindings::TaskPriority::UserVisible));
+
+    // 9. Let handle be the result of creating a task handle given result and signal.
+    // NOTE: The task is created right away rather than when it is enqueued, so that its ID identifies the handle.
+    auto task = create_a_scheduler_task(priority, GC::create_function(realm.heap(), [&realm, callback = GC::Ref { callback }, result] {
+        // 1. Let event loop be the scheduler's relevant agent's event loop.
+        // FIXME: 2. Set event loop's current scheduling state to state.
+
+        // 3. Let callbackResult be the result of invoking callback with « » and "rethrow". If that threw an
+        //    exception, then reject result with that. Otherwise, resolve result with callbackResult.
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+        auto callback_result = WebIDL::invoke_callback(*callback, {}, WebIDL::ExceptionBehavior::Rethrow, {});
+        if (callback_result.is_abrupt())
+            WebIDL::reject_promise(realm, result, callback_result.release_value());
+        else
+            WebIDL::resolve_promise(realm, result, callback_result.release_value());
+
+        // FIXME: 4. Set event loop's current scheduling state to null.
+    }));
+
+    // 10. If signal is not null, then add handle's abort steps to signal.
+    if (signal) {
+        // To signal the task handle abort steps:
+        (void)signal->add_abort_algorithm([this, &realm, result, signal, task_id = task->id()] {
+            // 1. Reject handle's result with signal's abort reason.
+            WebIDL::reject_promise(realm, result, signal->reason());
+
+            // 2. If task is not null, then remove task from handle's queue.
+            HTML::relevant_agent(HTML::relevant_global_object(*this)).event_loop->task_queue().remove_tasks_matching([task_id](auto const& task) {
+                return task.id() == task_id;
+            });
+        });
+    }
+
+    // 11. Let enqueueSteps be the following steps:
+    auto enqueue_steps = [this, task, signal] {
+        // NOTE: A delayed task whose signal was aborted in the meantime has already had its promise rejected.
+        if (signal && signal->aborted())
+            return;
+
+        // 1. Set handle's queue to the result of selecting the scheduler task queue for scheduler given state's
+        //    priority source and false.
+        // 2. Schedule a task to invoke an algorithm for scheduler given handle and the steps above.
+        queue_a_scheduler_task(task);
+    };
+
+    // 12. Let delay be options["delay"].
+    auto delay = options.delay;
+
+    // 13. If delay is greater than 0, then run steps after a timeout given scheduler's relevant global object,
+    //     "scheduler-postTask", delay, and the following steps:
+    if (delay > 0) {
+        auto& global = as<HTML::WindowOrWorkerGlobalScopeMixin>(HTML::relevant_global_object(*this));
+        global.run_steps_after_a_timeout(static_cast<i32>(min<WebIDL::UnsignedLongLong>(delay, NumericLimits<i32>::max())), [enqueue_steps = move(enqueue_steps)] {
+            // 1. Run enqueueSteps.
+            enqueue_steps();
+        });
+    }
+    // 14. Otherwise, run enqueueSteps.
+    else {
+        enqueue_steps();
+    }
+
+    // 15. Return result.
+    return result;
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-scheduler-yield
+GC::Ref<WebIDL::Promise> Scheduler::yield()
+{
+    auto& realm = this->realm();
+
+    // The yield() method steps are to return the result of scheduling a yield continuation for this.
+    // https://wicg.github.io/scheduling-apis/#schedule-a-yield-continuation
+
+    // 1. Let result be a new promise.
+    auto result = WebIDL::create_promise(realm);
+
+    // FIXME: 2. Let inheritedState be the scheduler's relevant agent's event loop's current scheduling state.
+    // FIXME: 3. Let abortSource be inheritedState's abort source if inheritedState is not null, or otherwise null.
+    // FIXME: 4. If abortSource is not null and abortSource is aborted, then reject result with abortSource's abort reason and return result.
+
+    // 5. Let prioritySource be inheritedState's priority source if inheritedState is not null, or otherwise null.
+    // 6. If prioritySource is null, then set prioritySource to the result of creating a fixed priority unabortable
+    //    task signal given "user-visible".
+    auto priority = HTML::Task::Priority::UserVisible;
+
+    // 7. Let handle be the result of creating a task handle given result and abortSource.
+    // FIXME: 8. If abortSource is not null, then add handle's abort steps to abortSource.
+
+    // 9. Set handle's queue to the result of selecting the scheduler task queue for scheduler given prioritySource and true.
+    // FIXME: Continuations should run before the other tasks of their priority, but they currently queue up behind them.
+
+    // 10. Schedule a task to invoke an algorithm for scheduler given handle and the following steps:
+    queue_a_scheduler_task(create_a_scheduler_task(priority, GC::create_function(realm.heap(), [&realm, result] {
+        // 1. Resolve result.
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+        WebIDL::resolve_promise(realm, result, JS::js_undefined());
+    })));
+
+    // 11. Return result.
+    return result;
+}
+
+}
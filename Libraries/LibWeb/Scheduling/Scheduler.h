@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Bindings/SchedulerPrototype.h>
+#include <LibWeb/HTML/EventLoop/Task.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::Scheduling {
+
+// https://wicg.github.io/scheduling-apis/#dictdef-schedulerposttaskoptions
+struct SchedulerPostTaskOptions {
+    GC::Ptr<DOM::AbortSignal> signal;
+    Optional<Bindings::TaskPriority> priority;
+    WebIDL::UnsignedLongLong delay { 0 };
+};
+
+// https://wicg.github.io/scheduling-apis/#scheduler
+class Scheduler final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(Scheduler, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(Scheduler);
+
+public:
+    [[nodiscard]] static GC::Ref<Scheduler> create(JS::Realm&);
+    virtual ~Scheduler() override;
+
+    GC::Ref<WebIDL::Promise> post_task(WebIDL::CallbackType& callback, SchedulerPostTaskOptions const& options);
+    GC::Ref<WebIDL::Promise> yield();
+
+private:
+    explicit Scheduler(JS::Realm&);
+
+    virtual void initialize(JS::Realm&) override;
+
+    GC::Ref<HTML::Task> create_a_scheduler_task(HTML::Task::Priority, GC::Ref<GC::Function<void()>> steps);
+    void queue_a_scheduler_task(GC::Ref<HTML::Task>);
+};
+
+}
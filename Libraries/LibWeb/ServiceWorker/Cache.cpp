@@ -0,0 +1,659 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/Array.h>
+#include <LibWeb/Bindings/CachePrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/AbortSignal.h>
+#include <LibWeb/Fetch/FetchMethod.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/ServiceWorker/Cache.h>
+#include <LibWeb/WebIDL/DOMException.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+
+namespace Web::ServiceWorker {
+
+GC_DEFINE_ALLOCATOR(Cache);
+
+static size_t s_total_byte_size_of_request_response_lists = 0;
+
+RequestResponseList::~RequestResponseList()
+{
+    s_total_byte_size_of_request_response_lists -= m_byte_size;
+}
+
+size_t RequestResponseList::byte_size_of(RequestResponse const& entry)
+{
+    auto byte_size_of_header_list = [](Vector<Fetch::Infrastructure::Header> const& header_list) {
+        size_t byte_size = 0;
+        for (auto const& header : header_list)
+            byte_size += header.name.size() + header.value.size();
+        return byte_size;
+    };
+
+    auto byte_size = entry.request.url.serialize().bytes().size() + entry.request.method.size() + byte_size_of_header_list(entry.request.header_list);
+    byte_size += entry.response.status_message.size() + byte_size_of_header_list(entry.response.header_list);
+    for (auto const& url : entry.response.url_list)
+        byte_size += url.serialize().bytes().size();
+    if (entry.response.body.has_value())
+        byte_size += entry.response.body->size();
+    return byte_size;
+}
+
+bool RequestResponseList::try_replace_matching(Function<bool(RequestResponse const&)> const& predicate, RequestResponse new_entry)
+{
+    size_t freed_byte_size = 0;
+    for (auto const& entry : m_entries) {
+        if (predicate(entry))
+            freed_byte_size += byte_size_of(entry);
+    }
+
+    auto added_byte_size = byte_size_of(new_entry);
+    if (s_total_byte_size_of_request_response_lists - freed_byte_size + added_byte_size > maximum_total_byte_size)
+        return false;
+
+    remove_all_matching(predicate);
+    m_entries.append(move(new_entry));
+    m_byte_size += added_byte_size;
+    s_total_byte_size_of_request_response_lists += added_byte_size;
+    return true;
+}
+
+bool RequestResponseList::remove_all_matching(Function<bool(RequestResponse const&)> const& predicate)
+{
+    return m_entries.remove_all_matching([&](auto const& entry) {
+        if (!predicate(entry))
+            return false;
+        auto byte_size = byte_size_of(entry);
+        m_byte_size -= byte_size;
+        s_total_byte_size_of_request_response_lists -= byte_size;
+        return true;
+    });
+}
+
+void RequestResponseList::clear()
+{
+    m_entries.clear();
+    s_total_byte_size_of_request_response_lists -= m_byte_size;
+    m_byte_size = 0;
+}
+
+GC::Ref<Cache> Cache::create(JS::Realm& realm, NonnullRefPtr<RequestResponseList> request_response_list)
+{
+    return realm.create<Cache>(realm, move(request_response_list));
+}
+
+Cache::Cache(JS::Realm& realm, NonnullRefPtr<RequestResponseList> request_response_list)
+    : Bindings::PlatformObject(realm)
+    , m_request_response_list(move(request_response_list))
+{
+}
+
+void Cache::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(Cache);
+    Base::initialize(realm);
+}
+
+static WebIDL::ExceptionOr<GC::Ref<Fetch::Infrastructure::Request>> request_from_request_info(JS::Realm& realm, Fetch::RequestInfo const& request)
+{
+    // If request is a Request object, then set r to request’s request.
+    if (auto const* request_object = request.get_pointer<GC::Root<Fetch::Request>>())
+        return (*request_object)->request();
+
+    // Else if request is a string, then set r to the associated request of the result of invoking the initial value of
+    // Request as constructor with request as its argument. If this throws an exception, return a promise rejected with
+    // that exception.
+    auto request_object = TRY(Fetch::Request::construct_impl(realm, request));
+    return request_object->request();
+}
+
+static Optional<ByteBuffer> get_header(ReadonlySpan<Fetch::Infrastructure::Header> header_list, StringView name)
+{
+    Optional<ByteBuffer> value;
+
+    for (auto const& header : header_list) {
+        if (!StringView { header.name }.equals_ignoring_ascii_case(name))
+            continue;
+
+        if (!value.has_value()) {
+            value = header.value;
+        } else {
+            value->append(", "sv.bytes());
+            value->append(header.value);
+        }
+    }
+
+    return value;
+}
+
+// The field-values of the Vary header of a response, if it has one.
+static Vector<StringView> vary_field_values(ByteBuffer const& vary)
+{
+    Vector<StringView> field_values;
+    for (auto field_value : StringView { vary }.split_view(',')) {
+        if (auto trimmed = field_value.trim_whitespace(); !trimmed.is_empty())
+            field_values.append(trimmed);
+    }
+    return field_values;
+}
+
+static bool response_has_vary_wildcard(ReadonlySpan<Fetch::Infrastructure::Header> header_list)
+{
+    auto vary = get_header(header_list, "Vary"sv);
+    if (!vary.has_value())
+        return false;
+
+    return vary_field_values(*vary).contains_slow("*"sv);
+}
+
+// https://w3c.github.io/ServiceWorker/#request-matches-cached-item-algorithm
+static bool request_matches_cached_item(Fetch::Infrastructure::Request const& request_query, CachedRequest const& request, CachedResponse const* response, CacheQueryOptions const& options)
+{
+    // 1. If options["ignoreMethod"] is false and request’s method is not `GET`, return false.
+    if (!options.ignore_method && request.method.bytes() != "GET"sv.bytes())
+        return false;
+
+    // 2. Let queryURL be requestQuery’s url.
+    auto query_url = request_query.url();
+
+    // 3. Let cachedURL be request’s url.
+    auto cached_url = request.url;
+
+    // 4. If options["ignoreSearch"] is true, then:
+    if (options.ignore_search) {
+        // 1. Set cachedURL’s query to the empty string.
+        cached_url.set_query({});
+
+        // 2. Set queryURL’s query to the empty string.
+        query_url.set_query({});
+    }
+
+    // 5. If queryURL does not equal cachedURL with exclude fragment flag set, then return false.
+    if (!query_url.equals(cached_url, URL::ExcludeFragment::Yes))
+        return false;
+
+    // 6. If response is null, options["ignoreVary"] is true, or response’s header list does not contain `Vary`, then
+    //    return true.
+    if (!response || options.ignore_vary)
+        return true;
+    auto vary = get_header(response->header_list, "Vary"sv);
+    if (!vary.has_value())
+        return true;
+
+    // 7. Let fieldValues be the list containing the elements corresponding to the field-values of the Vary header for
+    //    the value of the header with name `Vary`.
+    // 8. For each fieldValue in fieldValues:
+    for (auto field_value : vary_field_values(*vary)) {
+        // 1. If fieldValue matches "*", or the combined value given fieldValue and request’s header list does not match
+        //    the combined value given fieldValue and requestQuery’s header list, then return false.
+        if (field_value == "*"sv)
+            return false;
+        if (get_header(request.header_list, field_value) != get_header(request_query.header_list()->span(), field_value))
+            return false;
+    }
+
+    // 9. Return true.
+    return true;
+}
+
+static CachedRequest snapshot_request(Fetch::Infrastructure::Request const& request)
+{
+    return {
+        .url = request.url(),
+        .method = MUST(ByteBuffer::copy(request.method())),
+        .header_list = *request.header_list(),
+    };
+}
+
+static CachedResponse snapshot_response(Fetch::Infrastructure::Response const& response, Optional<ByteBuffer> body)
+{
+    return {
+        .type = response.type(),
+        .status = response.status(),
+        .status_message = MUST(ByteBuffer::copy(response.status_message())),
+        .header_list = *response.header_list(),
+        .url_list = response.url_list(),
+        .body = move(body),
+    };
+}
+
+static GC::Ref<Fetch::Request> create_request_object(JS::Realm& realm, CachedRequest const& cached_request)
+{
+    auto& vm = realm.vm();
+
+    auto request = Fetch::Infrastructure::Request::create(vm);
+    request->set_url(cached_request.url);
+    request->set_method(cached_request.method);
+    for (auto const& header : cached_request.header_list)
+        request->header_list()->append(Fetch::Infrastructure::Header::copy(header));
+
+    return Fetch::Request::create(realm, request, Fetch::Headers::Guard::Immutable, MUST(DOM::AbortSignal::construct_impl(realm)));
+}
+
+static GC::Ref<Fetch::Response> create_response_object(JS::Realm& realm, CachedResponse const& cached_response)
+{
+    auto& vm = realm.vm();
+
+    auto response = Fetch::Infrastructure::Response::create(vm);
+    response->set_type(cached_response.type);
+    response->set_status(cached_response.status);
+    response->set_status_message(cached_response.status_message);
+    response->set_url_list(cached_response.url_list);
+    for (auto const& header : cached_response.header_list)
+        response->header_list()->append(Fetch::Infrastructure::Header::copy(header));
+
+    // NOTE: Every response object gets a body of its own, as reading from it is what disturbs it.
+    if (cached_response.body.has_value())
+        response->set_body(Fetch::Infrastructure::byte_sequence_as_body(realm, *cached_response.body));
+
+    return Fetch::Response::create(realm, response, Fetch::Headers::Guard::Immutable);
+}
+
+static JS::Value create_frozen_array(JS::Realm& realm, GC::RootVector<JS::Value> const& values)
+{
+    auto array = JS::Array::create_from(realm, values);
+    MUST(array->set_integrity_level(JS::Object::IntegrityLevel::Frozen));
+    return array;
+}
+
+WebIDL::ExceptionOr<Vector<RequestResponse const*>> Cache::matching_entries(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options) const
+{
+    Vector<RequestResponse const*> entries;
+
+    // If request is undefined, every entry matches.
+    if (!request.has_value()) {
+        for (auto const& entry : m_request_response_list->entries())
+            entries.append(&entry);
+        return entries;
+    }
+
+    auto request_query = TRY(request_from_request_info(realm(), *request));
+
+    // If r’s method is not `GET` and options.ignoreMethod is false, nothing matches.
+    if (request_query->method() != "GET"sv.bytes() && !options.ignore_method)
+        return entries;
+
+    // https://w3c.github.io/ServiceWorker/#query-cache
+    for (auto const& entry : m_request_response_list->entries()) {
+        if (request_matches_cached_item(request_query, entry.request, &entry.response, options))
+            entries.append(&entry);
+    }
+
+    return entries;
+}
+
+WebIDL::ExceptionOr<GC::Ptr<Fetch::Response>> Cache::match_response(Fetch::RequestInfo const& request, CacheQueryOptions const& options)
+{
+    auto entries = TRY(matching_entries(request, options));
+    if (entries.is_empty())
+        return nullptr;
+
+    // FIXME: Opaque responses should be subject to the cross-origin resource policy check.
+    return create_response_object(realm(), entries.first()->response);
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-match
+GC::Ref<WebIDL::Promise> Cache::match(Fetch::RequestInfo const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let promise be a new promise.
+    // 2. Run these substeps in parallel:
+    //     1. Let p be the result of running the algorithm specified in matchAll(request, options) method with request
+    //        and options.
+    //     2. Wait until p settles.
+    //     3. If p rejects with an exception, then reject promise with that exception.
+    //     4. Else if p resolves with an array, responses, then:
+    //         1. If responses is an empty array, then resolve promise with undefined.
+    //         2. Else, resolve promise with the first element of responses.
+    // 3. Return promise.
+    // NOTE: The entries are in memory, so we look them up right away instead of going through matchAll().
+    auto response = match_response(request, options);
+    if (response.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, response.release_error());
+
+    if (auto response_object = response.release_value())
+        return WebIDL::create_resolved_promise(realm, response_object);
+    return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-matchall
+GC::Ref<WebIDL::Promise> Cache::match_all(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let r be null.
+    // 2. If the optional argument request is not omitted, then:
+    //     1. If request is a Request object, then:
+    //         1. Set r to request’s request.
+    //         2. If r’s method is not `GET` and options.ignoreMethod is false, return a promise resolved with an
+    //            empty array.
+    //     2. Else if request is a string, then:
+    //         1. Set r to the associated request of the result of invoking the initial value of Request as
+    //            constructor with request as its argument. If this throws an exception, return a promise rejected
+    //            with that exception.
+    // 3. Let realm be this's relevant realm.
+    // 4. Let promise be a new promise.
+    // 5. Run these substeps in parallel:
+    //     1. Let responses be an empty list.
+    //     2. If the optional argument request is omitted, then:
+    //         1. For each requestResponse of the relevant request response list:
+    //             1. Add a copy of requestResponse’s response to responses.
+    //     3. Else:
+    //         1. Let requestResponses be the result of running Query Cache with r and options.
+    //         2. For each requestResponse of requestResponses:
+    //             1. Add a copy of requestResponse’s response to responses.
+    auto entries = matching_entries(request, options);
+    if (entries.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, entries.release_error());
+
+    // FIXME: 4. For each response in responses:
+    //            1. If response’s type is "opaque" and cross-origin resource policy check with promise’s relevant
+    //               settings object’s origin, promise’s relevant settings object, "", and response’s internal
+    //               response returns blocked, then reject promise with a TypeError and abort these steps.
+
+    //     5. Queue a task, on promise’s relevant settings object’s responsible event loop using the DOM manipulation
+    //        task source, to perform the following steps:
+    //         1. Let responseList be a list.
+    //         2. For each response in responses:
+    //             1. Add a new Response object associated with response and a new Headers object whose guard is
+    //                "immutable".
+    //         3. Resolve promise with a frozen array created from responseList, in realm.
+    GC::RootVector<JS::Value> response_list(heap());
+    for (auto const* entry : entries.value())
+        response_list.append(create_response_object(realm, entry->response));
+
+    // 6. Return promise.
+    return WebIDL::create_resolved_promise(realm, create_frozen_array(realm, response_list));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-add
+GC::Ref<WebIDL::Promise> Cache::add(Fetch::RequestInfo const& request)
+{
+    // 1. Let requests be an array containing only request.
+    Vector<Fetch::RequestInfo> requests { request };
+
+    // 2. Let responseArrayPromise be the result of running the algorithm specified in addAll(requests) passing requests.
+    auto response_array_promise = add_all(requests);
+
+    // 3. Return the result of reacting to responseArrayPromise with a fulfillment handler that returns undefined.
+    return WebIDL::upon_fulfillment(response_array_promise, GC::create_function(heap(), [](JS::Value) -> WebIDL::ExceptionOr<JS::Value> {
+        return JS::js_undefined();
+    }));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-addAll
+GC::Ref<WebIDL::Promise> Cache::add_all(Vector<Fetch::RequestInfo> const& requests)
+{
+    auto& realm = this->realm();
+    auto& vm = realm.vm();
+
+    // 1. Let responsePromises be an empty list.
+    Vector<GC::Ref<WebIDL::Promise>> response_promises;
+
+    // 2. Let requestList be an empty list.
+    GC::RootVector<GC::Ref<Fetch::Request>> request_list(heap());
+
+    // 3. For each request whose type is Request in requests:
+    //     1. Let r be request’s request.
+    //     2. If r’s method is not `GET`, return a promise rejected with a TypeError.
+    for (auto const& request : requests) {
+        if (auto const* request_object = request.get_pointer<GC::Root<Fetch::Request>>()) {
+            if ((*request_object)->request()->method() != "GET"sv.bytes())
+                return WebIDL::create_rejected_promise_from_exception(realm, vm.throw_completion<JS::TypeError>("Only GET requests can be cached"sv));
+        }
+    }
+
+    // 4. For each request in requests:
+    for (auto const& request : requests) {
+        // 1. Let r be the associated request of the result of invoking the initial value of Request as constructor
+        //    with request as its argument. If this throws an exception, return a promise rejected with that exception.
+        auto request_object = Fetch::Request::construct_impl(realm, request);
+        if (request_object.is_exception())
+            return WebIDL::create_rejected_promise_from_exception(realm, request_object.release_error());
+        auto r = request_object.value()->request();
+
+        // 2. If r’s url’s scheme is not one of "http" and "https", then return a promise rejected with a TypeError.
+        if (!r->url().scheme().is_one_of("http"sv, "https"sv))
+            return WebIDL::create_rejected_promise_from_exception(realm, vm.throw_completion<JS::TypeError>("Only HTTP(S) requests can be cached"sv));
+
+        // FIXME: 3. If r’s client’s global object is a ServiceWorkerGlobalScope object, set request’s service-workers
+        //           mode to "none".
+
+        // 4. Set r’s initiator to "fetch" and destination to "subresource".
+        r->set_initiator(Fetch::Infrastructure::Request::Initiator::Fetch);
+        r->set_destination({});
+
+        // 5. Add r to requestList.
+        request_list.append(request_object.value());
+    }
+
+    for (auto request_object : request_list) {
+        // 6. Let responsePromise be a new promise.
+        // 7. Run the following substeps in parallel:
+        //     1. Fetch r.
+        //     2. To processResponse for response, run these substeps:
+        //         1. If response’s type is "error", or response’s status is not an ok status or is 206, reject
+        //            responsePromise with a TypeError.
+        //         2. Else if response’s header list contains a header named `Vary`, then:
+        //             1. Let fieldValues be the list containing the elements corresponding to the field-values of the
+        //                Vary header.
+        //             2. For each fieldValue of fieldValues:
+        //                 1. If fieldValue matches "*", then reject responsePromise with a TypeError.
+        //         3. Else, resolve responsePromise with response.
+        // NOTE: We use the fetch() method to do the fetching, which gives us a promise for a Response object already.
+        auto fetch_promise = Fetch::fetch(vm, GC::Root { request_object });
+        auto response_promise = WebIDL::upon_fulfillment(fetch_promise, GC::create_function(heap(), [&vm](JS::Value response_value) -> WebIDL::ExceptionOr<JS::Value> {
+            auto& response = as<Fetch::Response>(response_value.as_object());
+            auto inner_response = response.response();
+
+            if (inner_response->type() == Fetch::Infrastructure::Response::Type::Error || !Fetch::Infrastructure::is_ok_status(inner_response->status()) || inner_response->status() == 206)
+                return vm.throw_completion<JS::TypeError>("Response is not cacheable"sv);
+            if (response_has_vary_wildcard(inner_response->header_list()->span()))
+                return vm.throw_completion<JS::TypeError>("Response varies on every header"sv);
+            return response_value;
+        }));
+
+        // 8. Add responsePromise to responsePromises.
+        response_promises.append(response_promise);
+    }
+
+    // 9. Let p be the result of getting a promise to wait for all of responsePromises.
+    auto p = WebIDL::get_promise_for_wait_for_all(realm, response_promises);
+
+    // 10. Return the result of reacting to p with a fulfillment handler that, when called with argument responses,
+    //     performs the following substeps:
+    return WebIDL::upon_fulfillment(p, GC::create_function(heap(), [this, &realm, request_list = move(request_list)](JS::Value responses) -> WebIDL::ExceptionOr<JS::Value> {
+        auto& responses_array = responses.as_object();
+
+        // 1. Let operations be an empty list.
+        // 2. Let index be zero.
+        // 3. For each response in responses, create a cache operation that puts requestList[index] and response.
+        // FIXME: The puts should be done as a single batch, so that either all of them are stored or none are. We
+        //        store each response as soon as its body has been read instead.
+        Vector<GC::Ref<WebIDL::Promise>> put_promises;
+        for (size_t index = 0; index < request_list.size(); ++index) {
+            auto& response = as<Fetch::Response>(MUST(responses_array.get(index)).as_object());
+            put_promises.append(put(GC::Root { request_list[index] }, response));
+        }
+
+        return WebIDL::get_promise_for_wait_for_all(realm, put_promises)->promise();
+    }));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-put
+GC::Ref<WebIDL::Promise> Cache::put(Fetch::RequestInfo const& request, GC::Ref<Fetch::Response> response)
+{
+    auto& realm = this->realm();
+    auto& vm = realm.vm();
+
+    // 1. Let innerRequest be null.
+    // 2. If request is a Request object, then set innerRequest to request’s request.
+    // 3. Else:
+    //     1. Let requestObj be the result of invoking Request's constructor with request as its argument. If this
+    //        throws an exception, return a promise rejected with exception.
+    //     2. Set innerRequest to requestObj’s request.
+    auto inner_request_or_error = request_from_request_info(realm, request);
+    if (inner_request_or_error.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, inner_request_or_error.release_error());
+    auto inner_request = inner_request_or_error.release_value();
+
+    // 4. If innerRequest’s url’s scheme is not one of "http" and "https", or innerRequest’s method is not `GET`,
+    //    return a promise rejected with a TypeError.
+    if (!inner_request->url().scheme().is_one_of("http"sv, "https"sv) || inner_request->method() != "GET"sv.bytes())
+        return WebIDL::create_rejected_promise_from_exception(realm, vm.throw_completion<JS::TypeError>("Only HTTP(S) GET requests can be cached"sv));
+
+    // 5. Let innerResponse be response’s response.
+    auto inner_response = response->response();
+
+    // 6. If innerResponse’s status is 206, return a promise rejected with a TypeError.
+    if (inner_response->status() == 206)
+        return WebIDL::create_rejected_promise_from_exception(realm, vm.throw_completion<JS::TypeError>("Partial responses can't be cached"sv));
+
+    // 7. If innerResponse’s header list contains a header named `Vary`, then:
+    //     1. Let fieldValues be the list containing the items corresponding to the Vary header’s field-values.
+    //     2. For each fieldValue in fieldValues:
+    //         1. If fieldValue matches "*", return a promise rejected with a TypeError.
+    if (response_has_vary_wildcard(inner_response->header_list()->span()))
+        return WebIDL::create_rejected_promise_from_exception(realm, vm.throw_completion<JS::TypeError>("Response varies on every header"sv));
+
+    // 8. If innerResponse’s body is disturbed or locked, return a promise rejected with a TypeError.
+    if (response->is_unusable())
+        return WebIDL::create_rejected_promise_from_exception(realm, vm.throw_completion<JS::TypeError>("Response body is unusable"sv));
+
+    // 9. Let clonedResponse be the result of cloning innerResponse.
+    // 10. Let bodyReadPromise be a promise resolved with undefined.
+    // 11. If innerResponse’s body is non-null, run these substeps:
+    //     1. Let stream be innerResponse’s body’s stream.
+    //     2. Let reader be the result of getting a reader for stream.
+    //     3. Let bodyReadPromise be the result of reading all bytes from reader.
+    // NOTE: We store the bytes that were read rather than a clone of the response, which is the same as long as
+    //       nobody else reads from the response's body.
+    // 12. Let operations be an empty list.
+    // 13. Let operation be a cache batch operation.
+    // 14. Set operation’s type to "put".
+    // 15. Set operation’s request to innerRequest.
+    // 16. Set operation’s response to clonedResponse.
+    // 17. Append operation to operations.
+    // 18. Let realm be this’s relevant realm.
+    // 19. Let cacheJobPromise be the result of transforming bodyReadPromise with a fulfillment handler that runs
+    //     Batch Cache Operations with operations, then resolves with undefined.
+    auto cache_job_promise = WebIDL::create_promise(realm);
+
+    auto store = [this, &realm, cache_job_promise, inner_request, inner_response](Optional<ByteBuffer> body) {
+        // https://w3c.github.io/ServiceWorker/#batch-cache-operations-algorithm
+        // For a "put" operation, we remove every entry whose request matches this one, and then append the new one.
+        RequestResponse new_entry { snapshot_request(inner_request), snapshot_response(inner_response, move(body)) };
+        auto stored = m_request_response_list->try_replace_matching([&](auto const& entry) {
+            return request_matches_cached_item(inner_request, entry.request, nullptr, {});
+        },
+            move(new_entry));
+
+        HTML::TemporaryExecutionContext execution_context { realm };
+
+        // If the cache write operation in the previous two steps failed due to exceeding the granted quota limit, throw a QuotaExceededError.
+        if (!stored) {
+            auto error = WebIDL::QuotaExceededError::create(realm, MUST(String::formatted("Unable to store more than {} bytes in caches", RequestResponseList::maximum_total_byte_size)));
+            WebIDL::reject_promise(realm, cache_job_promise, error);
+            return;
+        }
+
+        WebIDL::resolve_promise(realm, cache_job_promise, JS::js_undefined());
+    };
+
+    auto body = inner_response->body();
+    if (!body) {
+        store({});
+        return cache_job_promise;
+    }
+
+    auto process_body = GC::create_function(heap(), [store = move(store)](ByteBuffer bytes) {
+        store(move(bytes));
+    });
+    auto process_body_error = GC::create_function(heap(), [&realm, cache_job_promise](JS::Value error) {
+        HTML::TemporaryExecutionContext execution_context { realm };
+        WebIDL::reject_promise(realm, cache_job_promise, error);
+    });
+    body->fully_read(realm, process_body, process_body_error, GC::Ref { HTML::relevant_global_object(*this) });
+
+    // 20. Return cacheJobPromise.
+    return cache_job_promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-delete
+GC::Ref<WebIDL::Promise> Cache::delete_(Fetch::RequestInfo const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let r be null.
+    // 2. If request is a Request object, then:
+    //     1. Set r to request’s request.
+    //     2. If r’s method is not `GET` and options.ignoreMethod is false, return a promise resolved with false.
+    // 3. Else if request is a string, then:
+    //     1. Set r to the associated request of the result of invoking the initial value of Request as constructor
+    //        with request as its argument. If this throws an exception, return a promise rejected with that exception.
+    auto request_query_or_error = request_from_request_info(realm, request);
+    if (request_query_or_error.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, request_query_or_error.release_error());
+    auto request_query = request_query_or_error.release_value();
+
+    if (request_query->method() != "GET"sv.bytes() && !options.ignore_method)
+        return WebIDL::create_resolved_promise(realm, JS::Value { false });
+
+    // 4. Let operations be an empty list.
+    // 5. Let operation be a cache batch operation whose type is "delete", request is r, and options is options.
+    // 6. Append operation to operations.
+    // 7. Let r be the result of running Batch Cache Operations with operations... and resolve with whether any
+    //    entries were removed.
+    auto removed = m_request_response_list->remove_all_matching([&](auto const& entry) {
+        return request_matches_cached_item(request_query, entry.request, &entry.response, options);
+    });
+
+    return WebIDL::create_resolved_promise(realm, JS::Value { removed });
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-keys
+GC::Ref<WebIDL::Promise> Cache::keys(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let r be null.
+    // 2. If the optional argument request is not omitted, then set r as in matchAll().
+    // 3. Let realm be this’s relevant realm.
+    // 4. Let promise be a new promise.
+    // 5. Run these substeps in parallel:
+    //     1. Let requests be an empty list.
+    //     2. If the optional argument request is omitted, then:
+    //         1. For each requestResponse of the relevant request response list:
+    //             1. Add requestResponse’s request to requests.
+    //     3. Else:
+    //         1. Let requestResponses be the result of running Query Cache with r and options.
+    //         2. For each requestResponse of requestResponses:
+    //             1. Add requestResponse’s request to requests.
+    auto entries = matching_entries(request, options);
+    if (entries.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, entries.release_error());
+
+    //     4. Queue a task, on promise’s relevant settings object’s responsible event loop using the DOM manipulation
+    //        task source, to perform the following steps:
+    //         1. Let requestList be a list.
+    //         2. For each request of requests:
+    //             1. Add a new Request object associated with request and a new associated Headers object whose
+    //                guard is "immutable".
+    //         3. Resolve promise with a frozen array created from requestList, in realm.
+    GC::RootVector<JS::Value> request_list(heap());
+    for (auto const* entry : entries.value())
+        request_list.append(create_request_object(realm, entry->request));
+
+    // 6. Return promise.
+    return WebIDL::create_resolved_promise(realm, create_frozen_array(realm, request_list));
+}
+
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Function.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/Vector.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Headers.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Statuses.h>
+#include <LibWeb/Fetch/Request.h>
+#include <LibWeb/Fetch/Response.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::ServiceWorker {
+
+// https://w3c.github.io/ServiceWorker/#dictdef-cachequeryoptions
+struct CacheQueryOptions {
+    bool ignore_search { false };
+    bool ignore_method { false };
+    bool ignore_vary { false };
+};
+
+// The request and response of a cache entry. Unlike the fetch requests and responses they are made from, these are
+// plain data that doesn't belong to any realm, so that every Cache object of an origin can refer to the same entries.
+struct CachedRequest {
+    URL::URL url;
+    ByteBuffer method;
+    Vector<Fetch::Infrastructure::Header> header_list;
+};
+
+struct CachedResponse {
+    Fetch::Infrastructure::Response::Type type { Fetch::Infrastructure::Response::Type::Default };
+    Fetch::Infrastructure::Status status { 200 };
+    ByteBuffer status_message;
+    Vector<Fetch::Infrastructure::Header> header_list;
+    Vector<URL::URL> url_list;
+    Optional<ByteBuffer> body;
+};
+
+struct RequestResponse {
+    CachedRequest request;
+    CachedResponse response;
+};
+
+// https://w3c.github.io/ServiceWorker/#dfn-request-response-list
+// FIXME: This is only part of the storage the spec asks for. Entries live in the memory of this process until it exits,
+//        or until memory pressure makes us drop them. They aren't persisted to disk or shared with other processes, and
+//        nothing counts them against the origin's storage quota yet.
+class RequestResponseList final : public RefCounted<RequestResponseList> {
+public:
+    static NonnullRefPtr<RequestResponseList> create() { return adopt_ref(*new RequestResponseList); }
+    ~RequestResponseList();
+
+    Vector<RequestResponse> const& entries() const { return m_entries; }
+
+    // Removes the entries that match the predicate and appends the given one, unless that would take all entries in
+    // this process above maximum_total_byte_size. In that case, nothing changes and false is returned.
+    [[nodiscard]] bool try_replace_matching(Function<bool(RequestResponse const&)> const& predicate, RequestResponse);
+
+    // Returns whether any entries were removed.
+    bool remove_all_matching(Function<bool(RequestResponse const&)> const& predicate);
+
+    void clear();
+
+    // NOTE: Since response bodies are kept in memory in their entirety, this bounds the size of all request response
+    //       lists of this process together.
+    static constexpr size_t maximum_total_byte_size = 64 * MiB;
+
+private:
+    RequestResponseList() = default;
+
+    static size_t byte_size_of(RequestResponse const&);
+
+    Vector<RequestResponse> m_entries;
+    size_t m_byte_size { 0 };
+};
+
+// https://w3c.github.io/ServiceWorker/#cache-interface
+class Cache : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(Cache, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(Cache);
+
+public:
+    [[nodiscard]] static GC::Ref<Cache> create(JS::Realm&, NonnullRefPtr<RequestResponseList>);
+
+    GC::Ref<WebIDL::Promise> match(Fetch::RequestInfo const& request, CacheQueryOptions const& options);
+    GC::Ref<WebIDL::Promise> match_all(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options);
+    GC::Ref<WebIDL::Promise> add(Fetch::RequestInfo const& request);
+    GC::Ref<WebIDL::Promise> add_all(Vector<Fetch::RequestInfo> const& requests);
+    GC::Ref<WebIDL::Promise> put(Fetch::RequestInfo const& request, GC::Ref<Fetch::Response> response);
+    GC::Ref<WebIDL::Promise> delete_(Fetch::RequestInfo const& request, CacheQueryOptions const& options);
+    GC::Ref<WebIDL::Promise> keys(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options);
+
+    // Returns the first response that matches the request, which is what match() resolves with.
+    WebIDL::ExceptionOr<GC::Ptr<Fetch::Response>> match_response(Fetch::RequestInfo const& request, CacheQueryOptions const& options);
+
+private:
+    Cache(JS::Realm&, NonnullRefPtr<RequestResponseList>);
+
+    virtual void initialize(JS::Realm&) override;
+
+    // The entries that matchAll() and keys() are made from. They are only valid until the list is modified.
+    WebIDL::ExceptionOr<Vector<RequestResponse const*>> matching_entries(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options) const;
+
+    // https://w3c.github.io/ServiceWorker/#dfn-relevant-request-response-list
+    NonnullRefPtr<RequestResponseList> m_request_response_list;
+};
+
+}
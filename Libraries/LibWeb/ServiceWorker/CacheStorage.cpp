@@ -4,15 +4,36 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibJS/Runtime/Array.h>
 #include <LibWeb/Bindings/CacheStoragePrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/ServiceWorker/CacheStorage.h>
+#include <LibWeb/StorageAPI/StorageKey.h>
+#include <LibWeb/WebIDL/DOMException.h>
 #include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::ServiceWorker {
 
 GC_DEFINE_ALLOCATOR(CacheStorage);
 
+// NOTE: Caches only live as long as this process does. Every CacheStorage object of a storage key in this process
+//       shares the same name to cache map, so that frames and workers of the same origin see the same caches.
+static HashMap<String, NameToCacheMap>& name_to_cache_maps()
+{
+    static HashMap<String, NameToCacheMap> maps;
+    return maps;
+}
+
+void CacheStorage::clear_all_caches()
+{
+    for (auto& [storage_key, name_to_cache_map] : name_to_cache_maps()) {
+        for (auto& [cache_name, cache] : name_to_cache_map)
+            cache->clear();
+    }
+    name_to_cache_maps().clear();
+}
+
 CacheStorage::CacheStorage(JS::Realm& realm)
     : Bindings::PlatformObject(realm)
 {
@@ -24,17 +45,152 @@ void CacheStorage::initialize(JS::Realm& realm)
     WEB_SET_PROTOTYPE_FOR_INTERFACE(CacheStorage);
 }
 
-// https://w3c.github.io/ServiceWorker/#cache-storage-open
-GC::Ref<WebIDL::Promise> CacheStorage::open(String const&)
+// https://w3c.github.io/ServiceWorker/#relevant-name-to-cache-map
+NameToCacheMap* CacheStorage::relevant_name_to_cache_map()
 {
-    return WebIDL::create_rejected_promise(realm(), WebIDL::NotSupportedError::create(realm(), "CacheStorage.open() is not yet implemented"_string));
+    // The relevant name to cache map for a CacheStorage object is the name to cache map associated with the result of
+    // running obtain a local storage bottle map with the object’s relevant settings object and "caches".
+    auto storage_key = StorageAPI::obtain_a_storage_key(HTML::relevant_settings_object(*this));
+    if (!storage_key.has_value())
+        return nullptr;
+
+    return &name_to_cache_maps().ensure(storage_key->to_string());
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-match
+GC::Ref<WebIDL::Promise> CacheStorage::match(Fetch::RequestInfo const& request, MultiCacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    auto* name_to_cache_map = relevant_name_to_cache_map();
+    if (!name_to_cache_map)
+        return WebIDL::create_rejected_promise(realm, WebIDL::SecurityError::create(realm, "Failed to obtain a storage key"_string));
+
+    // 1. If options["cacheName"] exists, then:
+    if (options.cache_name.has_value()) {
+        // 1. Return a new promise promise and run the following substeps in parallel:
+        //     1. For each cacheName → cache of the relevant name to cache map:
+        //         1. If options["cacheName"] matches cacheName, then:
+        //             1. Resolve promise with the result of running the algorithm specified in match(request, options)
+        //                method of Cache interface with request and options (providing cache as thisArgument to the
+        //                [[Call]] internal method of match(request, options).)
+        //             2. Abort these steps.
+        //     2. Resolve promise with undefined.
+        auto cache = name_to_cache_map->get(*options.cache_name);
+        if (!cache.has_value())
+            return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+        return Cache::create(realm, *cache)->match(request, options);
+    }
+
+    // 2. Else:
+    //     1. Let promise be a promise resolved with undefined.
+    //     2. For each cacheName → cache of the relevant name to cache map:
+    //         1. Set promise to the result of reacting to itself with a fulfillment handler that, when called with
+    //            argument response, performs the following substeps:
+    //             1. If response is not undefined, return response.
+    //             2. Return the result of running the algorithm specified in match(request, options) method of Cache
+    //                interface with request and options as the arguments (providing cache as thisArgument to the
+    //                [[Call]] internal method of match(request, options).)
+    //     3. Return promise.
+    // NOTE: The caches are in memory, so we can look through them in order right away.
+    for (auto const& [cache_name, cache] : *name_to_cache_map) {
+        auto response = Cache::create(realm, cache)->match_response(request, options);
+        if (response.is_exception())
+            return WebIDL::create_rejected_promise_from_exception(realm, response.release_error());
+        if (auto response_object = response.release_value())
+            return WebIDL::create_resolved_promise(realm, response_object);
+    }
+
+    return WebIDL::create_resolved_promise(realm, JS::js_undefined());
 }
 
 // https://w3c.github.io/ServiceWorker/#cache-storage-has
-GC::Ref<WebIDL::Promise> CacheStorage::has(String const&)
+GC::Ref<WebIDL::Promise> CacheStorage::has(String const& cache_name)
+{
+    auto& realm = this->realm();
+
+    auto* name_to_cache_map = relevant_name_to_cache_map();
+    if (!name_to_cache_map)
+        return WebIDL::create_rejected_promise(realm, WebIDL::SecurityError::create(realm, "Failed to obtain a storage key"_string));
+
+    // 1. Let promise be a new promise.
+    // 2. Run the following substeps in parallel:
+    //     1. For each key → value of the relevant name to cache map:
+    //         1. If cacheName matches key, resolve promise with true and abort these steps.
+    //     2. Resolve promise with false.
+    // 3. Return promise.
+    return WebIDL::create_resolved_promise(realm, JS::Value { name_to_cache_map->contains(cache_name) });
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-open
+GC::Ref<WebIDL::Promise> CacheStorage::open(String const& cache_name)
+{
+    auto& realm = this->realm();
+
+    auto* name_to_cache_map = relevant_name_to_cache_map();
+    if (!name_to_cache_map)
+        return WebIDL::create_rejected_promise(realm, WebIDL::SecurityError::create(realm, "Failed to obtain a storage key"_string));
+
+    // 1. Let promise be a new promise.
+    // 2. Run the following substeps in parallel:
+    //     1. For each key → value of the relevant name to cache map:
+    //         1. If cacheName matches key, then:
+    //             1. Resolve promise with a new Cache object that represents value.
+    //             2. Abort these steps.
+    //     2. Let cache be a new request response list.
+    //     3. Set the relevant name to cache map[cacheName] to cache. If this cache write operation failed due to
+    //        exceeding the granted quota limit, reject promise with a "QuotaExceededError" DOMException and abort
+    //        these steps.
+    //     4. Resolve promise with a new Cache object that represents cache.
+    // 3. Return promise.
+    auto cache = name_to_cache_map->ensure(cache_name, [] { return RequestResponseList::create(); });
+    return WebIDL::create_resolved_promise(realm, Cache::create(realm, move(cache)));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-delete
+GC::Ref<WebIDL::Promise> CacheStorage::delete_(String const& cache_name)
 {
-    dbgln("FIXME: CacheStorage::has() is not implemented yet");
-    return WebIDL::create_rejected_promise(realm(), JS::Value(false));
+    auto& realm = this->realm();
+
+    auto* name_to_cache_map = relevant_name_to_cache_map();
+    if (!name_to_cache_map)
+        return WebIDL::create_rejected_promise(realm, WebIDL::SecurityError::create(realm, "Failed to obtain a storage key"_string));
+
+    // 1. Let promise be the result of running the algorithm specified in has(cacheName) method with cacheName.
+    // 2. Return the result of reacting to promise with a fulfillment handler that, when called with argument
+    //    cacheExists, performs the following substeps:
+    //     1. If cacheExists is false, then:
+    //         1. Return false.
+    //     2. Let cacheJobPromise be a new promise.
+    //     3. Run the following substeps in parallel:
+    //         1. Remove the relevant name to cache map[cacheName].
+    //         2. Resolve cacheJobPromise with true.
+    //     4. Return cacheJobPromise.
+    // NOTE: Cache objects that were handed out before keep working on the removed request response list.
+    return WebIDL::create_resolved_promise(realm, JS::Value { name_to_cache_map->remove(cache_name) });
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-keys
+GC::Ref<WebIDL::Promise> CacheStorage::keys()
+{
+    auto& realm = this->realm();
+
+    auto* name_to_cache_map = relevant_name_to_cache_map();
+    if (!name_to_cache_map)
+        return WebIDL::create_rejected_promise(realm, WebIDL::SecurityError::create(realm, "Failed to obtain a storage key"_string));
+
+    // 1. Let promise be a new promise.
+    // 2. Run the following substeps in parallel:
+    //     1. Let cacheKeys be the result of getting the keys of the relevant name to cache map.
+    //        NOTE: The items in the result ordered set are in the order that their corresponding entry was added to
+    //              the name to cache map.
+    //     2. Resolve promise with cacheKeys.
+    // 3. Return promise.
+    GC::RootVector<JS::Value> cache_keys(heap());
+    for (auto const& cache_name : name_to_cache_map->keys())
+        cache_keys.append(JS::PrimitiveString::create(realm.vm(), cache_name));
+
+    return WebIDL::create_resolved_promise(realm, JS::Array::create_from(realm, cache_keys));
 }
 
 }
@@ -6,24 +6,44 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/ServiceWorker/Cache.h>
 #include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::ServiceWorker {
 
+// https://w3c.github.io/ServiceWorker/#dictdef-multicachequeryoptions
+struct MultiCacheQueryOptions : public CacheQueryOptions {
+    Optional<String> cache_name;
+};
+
+// https://w3c.github.io/ServiceWorker/#dfn-name-to-cache-map
+using NameToCacheMap = OrderedHashMap<String, NonnullRefPtr<RequestResponseList>>;
+
 // https://w3c.github.io/ServiceWorker/#cachestorage-interface
 class CacheStorage : public Bindings::PlatformObject {
     WEB_PLATFORM_OBJECT(CacheStorage, Bindings::PlatformObject);
     GC_DECLARE_ALLOCATOR(CacheStorage);
 
 public:
+    GC::Ref<WebIDL::Promise> match(Fetch::RequestInfo const& request, MultiCacheQueryOptions const& options);
     GC::Ref<WebIDL::Promise> has(String const& cache_name);
     GC::Ref<WebIDL::Promise> open(String const& cache_name);
+    GC::Ref<WebIDL::Promise> delete_(String const& cache_name);
+    GC::Ref<WebIDL::Promise> keys();
+
+    // Drops every cache of every storage key in this process, e.g. under memory pressure. Like a storage bucket being
+    // evicted, this empties the caches that existing Cache objects refer to as well.
+    static void clear_all_caches();
 
 private:
     explicit CacheStorage(JS::Realm&);
 
     virtual void initialize(JS::Realm&) override;
+
+    // https://w3c.github.io/ServiceWorker/#relevant-name-to-cache-map
+    NameToCacheMap* relevant_name_to_cache_map();
 };
 
 }
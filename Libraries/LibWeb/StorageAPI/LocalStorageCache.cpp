@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/StorageAPI/LocalStorageCache.h>
+
+namespace Web::StorageAPI {
+
+static size_t size_of_item(String const& key, String const& value)
+{
+    return key.bytes().size() + value.bytes().size();
+}
+
+void LocalStorageArea::set(String const& key, String const& value)
+{
+    if (auto existing_value = items.get(key); existing_value.has_value())
+        size_in_bytes -= size_of_item(key, *existing_value);
+    items.set(key, value);
+    size_in_bytes += size_of_item(key, value);
+}
+
+void LocalStorageArea::remove(String const& key)
+{
+    if (auto existing_value = items.get(key); existing_value.has_value()) {
+        size_in_bytes -= size_of_item(key, *existing_value);
+        items.remove(key);
+    }
+}
+
+void LocalStorageArea::clear()
+{
+    items.clear();
+    size_in_bytes = 0;
+}
+
+LocalStorageCache& LocalStorageCache::the()
+{
+    static LocalStorageCache cache;
+    return cache;
+}
+
+LocalStorageCache::CachedArea& LocalStorageCache::cached_area(Page& page, String const& storage_key)
+{
+    auto& cached_area = *m_areas.ensure(storage_key, [] { return make<CachedArea>(); });
+
+    if (cached_area.needs_refetch) {
+        auto snapshot = page.client().page_did_request_storage_area(StorageEndpointType::LocalStorage, storage_key);
+
+        cached_area.area.clear();
+        for (auto const& [key, value] : snapshot.items)
+            cached_area.area.set(key, value);
+        cached_area.sequence_number = snapshot.sequence_number;
+
+        // NOTE: The browser process handled all of our earlier writes before it took the snapshot.
+        cached_area.pending_writes.clear();
+        cached_area.pending_clears = 0;
+        cached_area.needs_refetch = false;
+    }
+
+    return cached_area;
+}
+
+LocalStorageArea const& LocalStorageCache::area(Page& page, String const& storage_key)
+{
+    return cached_area(page, storage_key).area;
+}
+
+void LocalStorageCache::set_item(Page& page, String const& storage_key, String const& key, String const& value)
+{
+    auto& cached_area = this->cached_area(page, storage_key);
+    cached_area.area.set(key, value);
+    ++cached_area.pending_writes.ensure(key, [] { return 0; });
+
+    page.client().page_did_set_storage_item(StorageEndpointType::LocalStorage, storage_key, key, value);
+}
+
+void LocalStorageCache::remove_item(Page& page, String const& storage_key, String const& key)
+{
+    auto& cached_area = this->cached_area(page, storage_key);
+    cached_area.area.remove(key);
+    ++cached_area.pending_writes.ensure(key, [] { return 0; });
+
+    page.client().page_did_remove_storage_item(StorageEndpointType::LocalStorage, storage_key, key);
+}
+
+void LocalStorageCache::clear(Page& page, String const& storage_key)
+{
+    auto& cached_area = this->cached_area(page, storage_key);
+    cached_area.area.clear();
+    ++cached_area.pending_clears;
+
+    page.client().page_did_clear_storage(StorageEndpointType::LocalStorage, storage_key);
+}
+
+LocalStorageCache::CachedArea* LocalStorageCache::cached_area_for_change(String const& storage_key, u64 sequence_number)
+{
+    // NOTE: Areas that nobody in this process has used yet are fetched with the change already applied, and so are
+    //       areas waiting to be fetched again.
+    auto it = m_areas.find(storage_key);
+    if (it == m_areas.end() || it->value->needs_refetch)
+        return nullptr;
+
+    // Changes that were sent before our copy of the area was taken are already part of it.
+    auto& cached_area = *it->value;
+    if (sequence_number <= cached_area.sequence_number)
+        return nullptr;
+
+    cached_area.sequence_number = sequence_number;
+    return &cached_area;
+}
+
+void LocalStorageCache::did_change(String const& storage_key, u64 sequence_number, Optional<String> const& key, Optional<String> const& value, bool is_own_change)
+{
+    auto* cached_area = cached_area_for_change(storage_key, sequence_number);
+    if (!cached_area)
+        return;
+
+    // Our own changes were applied to our copy when we made them.
+    if (is_own_change) {
+        if (!key.has_value()) {
+            VERIFY(cached_area->pending_clears > 0);
+            --cached_area->pending_clears;
+            return;
+        }
+
+        auto pending_writes = cached_area->pending_writes.find(*key);
+        VERIFY(pending_writes != cached_area->pending_writes.end());
+        if (--pending_writes->value == 0)
+            cached_area->pending_writes.remove(pending_writes);
+        return;
+    }
+
+    // Everything another process changed before our pending clear is wiped by that clear anyway.
+    if (cached_area->pending_clears > 0)
+        return;
+
+    auto& area = cached_area->area;
+
+    if (!key.has_value()) {
+        // Our pending writes land after this clear, so the keys they touch keep the values we gave them.
+        if (cached_area->pending_writes.is_empty()) {
+            area.clear();
+            return;
+        }
+
+        Vector<String> keys_to_remove;
+        for (auto const& it : area.items) {
+            if (!cached_area->pending_writes.contains(it.key))
+                keys_to_remove.append(it.key);
+        }
+        for (auto const& key_to_remove : keys_to_remove)
+            area.remove(key_to_remove);
+        return;
+    }
+
+    // A key we have a pending write for ends up with the value we gave it.
+    if (cached_area->pending_writes.contains(*key))
+        return;
+
+    if (!value.has_value())
+        area.remove(*key);
+    else
+        area.set(*key, *value);
+}
+
+void LocalStorageCache::did_reject_change(String const& storage_key, u64 sequence_number)
+{
+    // The browser process dropped one of our writes, so our copy has a change nobody else has. As we can't know what
+    // the key looked like before it, fetch the whole area again the next time it's used.
+    if (auto* cached_area = cached_area_for_change(storage_key, sequence_number))
+        cached_area->needs_refetch = true;
+}
+
+}
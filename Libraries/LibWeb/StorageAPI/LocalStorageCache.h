@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::StorageAPI {
+
+// The contents of one storage key's local storage, as seen by this process.
+struct LocalStorageArea {
+    OrderedHashMap<String, String> items;
+    // The sum of the sizes of all keys and values, which is what the quota applies to.
+    size_t size_in_bytes { 0 };
+
+    void set(String const& key, String const& value);
+    void remove(String const& key);
+    void clear();
+};
+
+// A copy of a storage area handed out by the browser process, along with the sequence number of the last change that
+// went into it.
+struct LocalStorageSnapshot {
+    OrderedHashMap<String, String> items;
+    u64 sequence_number { 0 };
+};
+
+// The authoritative copy of local storage lives in the StorageJar of the browser process. Every document in this
+// process that uses local storage goes through this cache instead: the whole area of a storage key is fetched in one
+// go the first time it's used, reads are answered from that copy, and writes are applied to it immediately and then
+// sent to the browser process without waiting for a reply.
+//
+// The browser process numbers every change it applies, and sends each one to every process, including the one that
+// made it. A change from another process that the browser applied before one of our own pending writes to the same
+// key (or before our pending clear) is superseded by ours, so it's skipped. That way every process ends up in the
+// order the browser process applied the changes in. Should the browser process reject one of our writes (because
+// another process filled the area in the meantime), the whole area is fetched again.
+class LocalStorageCache {
+public:
+    static LocalStorageCache& the();
+
+    LocalStorageArea const& area(Page&, String const& storage_key);
+
+    void set_item(Page&, String const& storage_key, String const& key, String const& value);
+    void remove_item(Page&, String const& storage_key, String const& key);
+    void clear(Page&, String const& storage_key);
+
+    // A null key means the area was cleared, and a null value means the key was removed.
+    void did_change(String const& storage_key, u64 sequence_number, Optional<String> const& key, Optional<String> const& value, bool is_own_change);
+    void did_reject_change(String const& storage_key, u64 sequence_number);
+
+private:
+    struct CachedArea {
+        LocalStorageArea area;
+        u64 sequence_number { 0 };
+
+        // Our writes that the browser process hasn't confirmed yet: how many there are per key, and how many clears.
+        HashMap<String, size_t> pending_writes;
+        size_t pending_clears { 0 };
+
+        bool needs_refetch { true };
+    };
+
+    CachedArea& cached_area(Page&, String const& storage_key);
+    CachedArea* cached_area_for_change(String const& storage_key, u64 sequence_number);
+
+    HashMap<String, NonnullOwnPtr<CachedArea>> m_areas;
+};
+
+}
@@ -104,34 +104,52 @@ void LocalStorageBottle::visit_edges(GC::Cell::Visitor& visitor)
     visitor.visit(m_page);
 }
 
+LocalStorageArea const& LocalStorageBottle::area() const
+{
+    return LocalStorageCache::the().area(m_page, m_serialized_storage_key);
+}
+
 size_t LocalStorageBottle::size() const
 {
-    return m_page->client().page_did_request_storage_keys(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string()).size();
+    return area().items.size();
 }
 
 Vector<String> LocalStorageBottle::keys() const
 {
-    return m_page->client().page_did_request_storage_keys(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string());
+    return area().items.keys();
 }
 
 Optional<String> LocalStorageBottle::get(String const& key) const
 {
-    return m_page->client().page_did_request_storage_item(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string(), key);
+    if (auto value = area().items.get(key); value.has_value())
+        return value.value();
+    return OptionalNone {};
 }
 
 WebView::StorageOperationError LocalStorageBottle::set(String const& key, String const& value)
 {
-    return m_page->client().page_did_set_storage_item(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string(), key, value);
+    if (m_quota.has_value()) {
+        auto const& area = this->area();
+        auto current_size = area.size_in_bytes;
+        if (auto existing_value = area.items.get(key); existing_value.has_value())
+            current_size -= key.bytes().size() + existing_value->bytes().size();
+        size_t new_size = key.bytes().size() + value.bytes().size();
+        if (current_size + new_size > m_quota.value())
+            return WebView::StorageOperationError::QuotaExceededError;
+    }
+
+    LocalStorageCache::the().set_item(m_page, m_serialized_storage_key, key, value);
+    return WebView::StorageOperationError::None;
 }
 
 void LocalStorageBottle::clear()
 {
-    m_page->client().page_did_clear_storage(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string());
+    LocalStorageCache::the().clear(m_page, m_serialized_storage_key);
 }
 
 void LocalStorageBottle::remove(String const& key)
 {
-    m_page->client().page_did_remove_storage_item(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string(), key);
+    LocalStorageCache::the().remove_item(m_page, m_serialized_storage_key, key);
 }
 
 size_t SessionStorageBottle::size() const
@@ -12,6 +12,7 @@
 #include <LibGC/Ptr.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/StorageAPI/LocalStorageCache.h>
 #include <LibWeb/StorageAPI/StorageEndpoint.h>
 #include <LibWeb/StorageAPI/StorageKey.h>
 #include <LibWeb/StorageAPI/StorageType.h>
@@ -73,11 +74,15 @@ private:
         : StorageBottle(quota)
         , m_page(move(page))
         , m_storage_key(move(key))
+        , m_serialized_storage_key(m_storage_key.to_string())
     {
     }
 
+    LocalStorageArea const& area() const;
+
     GC::Ref<Page> m_page;
     StorageKey m_storage_key;
+    String m_serialized_storage_key;
 };
 
 class SessionStorageBottle final : public StorageBottle {
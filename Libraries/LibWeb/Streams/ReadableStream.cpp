@@ -299,25 +299,32 @@ WebIDL::ExceptionOr<void> ReadableStream::pull_from_bytes(ByteBuffer bytes)
     // 5. Let pullSize be the smaller value of available and desiredSize.
     auto pull_size = min(available, desired_size);
 
-    // 6. Let pulled be the first pullSize bytes of bytes.
-    auto pulled = pull_size == available ? move(bytes) : MUST(bytes.slice(0, pull_size));
-
-    // 7. Remove the first pullSize bytes from bytes.
-    if (pull_size != available)
-        bytes = MUST(bytes.slice(pull_size, available - pull_size));
-
     // 8. If stream’s current BYOB request view is non-null, then:
     if (auto byob_view = current_byob_request_view()) {
+        // 6. Let pulled be the first pullSize bytes of bytes.
         // 1. Write pulled into stream’s current BYOB request view.
-        byob_view->write(pulled);
+        // OPTIMIZATION: The bytes are written straight into the view, rather than being sliced off into a buffer first.
+        byob_view->write(bytes.bytes().trim(pull_size));
 
         // 2. Perform ? ReadableByteStreamControllerRespond(stream.[[controller]], pullSize).
         TRY(readable_byte_stream_controller_respond(controller, pull_size));
+
+        // 7. Remove the first pullSize bytes from bytes.
+        // AD-HOC: Our callers don't hold on to bytes, so whatever didn't fit into the view would be lost. Enqueue it
+        //         instead, which is where the next read will look for it.
+        if (pull_size != available) {
+            auto remaining_bytes = TRY_OR_THROW_OOM(vm(), bytes.slice(pull_size, available - pull_size));
+            auto array_buffer = JS::ArrayBuffer::create(realm, move(remaining_bytes));
+            auto view = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
+
+            TRY(readable_byte_stream_controller_enqueue(controller, view));
+        }
     }
     // 9. Otherwise,
     else {
         // 1. Set view to the result of creating a Uint8Array from pulled in stream’s relevant Realm.
-        auto array_buffer = JS::ArrayBuffer::create(realm, move(pulled));
+        // NOTE: Without a BYOB request view, pulled is all of bytes, so the buffer is handed over as is.
+        auto array_buffer = JS::ArrayBuffer::create(realm, move(bytes));
         auto view = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
 
         // 2. Perform ? ReadableByteStreamControllerEnqueue(stream.[[controller]], view).
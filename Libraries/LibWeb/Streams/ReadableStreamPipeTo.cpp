@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/TemporaryChange.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/Streams/ReadableStreamDefaultReader.h>
@@ -102,6 +103,7 @@ void ReadableStreamPipeTo::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_signal);
     visitor.visit(m_pending_writes);
     visitor.visit(m_unwritten_chunks);
+    visitor.visit(m_read_request);
 }
 
 void ReadableStreamPipeTo::process()
@@ -109,6 +111,8 @@ void ReadableStreamPipeTo::process()
     if (check_for_error_and_close_states())
         return;
 
+    react_to_closed_promises();
+
     auto ready_promise = m_writer->ready();
 
     if (ready_promise && WebIDL::is_promise_fulfilled(*ready_promise)) {
@@ -128,8 +132,25 @@ void ReadableStreamPipeTo::process()
 
     if (ready_promise)
         WebIDL::react_to_promise(*ready_promise, when_ready, shutdown);
+}
+
+void ReadableStreamPipeTo::react_to_closed_promises()
+{
+    // NOTE: The reader and writer keep their closed promises for as long as we hold on to them, so reacting to them
+    //       once is enough. Doing so for every chunk would pile up reactions that all do the same thing.
+    if (m_reacting_to_closed_promises)
+        return;
+    m_reacting_to_closed_promises = true;
+
+    auto shutdown = GC::create_function(heap(), [this](JS::Value) -> WebIDL::ExceptionOr<JS::Value> {
+        check_for_error_and_close_states();
+        return JS::js_undefined();
+    });
+
     if (auto promise = m_reader->closed())
         WebIDL::react_to_promise(*promise, shutdown, shutdown);
+    if (auto promise = m_writer->closed())
+        WebIDL::react_to_promise(*promise, shutdown, shutdown);
 }
 
 void ReadableStreamPipeTo::set_abort_signal(GC::Ref<DOM::AbortSignal> signal, DOM::AbortSignal::AbortSignal::AbortAlgorithmID signal_id)
@@ -223,9 +244,14 @@ void ReadableStreamPipeTo::read_chunk()
         if (check_for_error_and_close_states())
             return;
 
+        // NOTE: Chunks that are read while we are draining the source are written by the drain loop itself.
+        if (m_draining_source)
+            return;
+
         HTML::queue_a_microtask(nullptr, GC::create_function(m_realm->heap(), [this]() {
             HTML::TemporaryExecutionContext execution_context { m_realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
-            write_chunk();
+            write_unwritten_chunks();
+            drain_queued_chunks();
             process();
         }));
     });
@@ -240,11 +266,40 @@ void ReadableStreamPipeTo::read_chunk()
         return JS::js_undefined();
     });
 
-    auto read_request = heap().allocate<ReadableStreamPipeToReadRequest>(on_chunk, on_complete, shutdown);
-    readable_stream_default_reader_read(m_reader, read_request);
+    m_read_request = heap().allocate<ReadableStreamPipeToReadRequest>(on_chunk, on_complete, shutdown);
+    readable_stream_default_reader_read(m_reader, *m_read_request);
+}
 
-    if (auto promise = m_writer->closed())
-        WebIDL::react_to_promise(*promise, shutdown, shutdown);
+// OPTIMIZATION: When the source has chunks queued up, reading one of them completes right away. So while there is room
+//               in the destination, we read and write those chunks in a loop, instead of going through a microtask and
+//               the writer's ready promise for every single one of them.
+void ReadableStreamPipeTo::drain_queued_chunks()
+{
+    if (!m_read_request)
+        return;
+
+    TemporaryChange draining_source { m_draining_source, true };
+
+    while (source_has_queued_chunks()) {
+        // Backpressure must be enforced: while WritableStreamDefaultWriterGetDesiredSize(writer) is ≤ 0 or is null,
+        // the user agent must not read from reader.
+        auto desired_size = writable_stream_default_writer_get_desired_size(m_writer);
+        if (!desired_size.has_value() || *desired_size <= 0)
+            break;
+
+        if (check_for_error_and_close_states())
+            break;
+
+        readable_stream_default_reader_read(m_reader, *m_read_request);
+        write_unwritten_chunks();
+    }
+}
+
+bool ReadableStreamPipeTo::source_has_queued_chunks() const
+{
+    return m_source->controller()->visit([](auto const& controller) {
+        return !controller->queue().is_empty();
+    });
 }
 
 void ReadableStreamPipeTo::write_chunk()
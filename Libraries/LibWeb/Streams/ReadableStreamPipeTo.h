@@ -42,9 +42,14 @@ private:
 
     virtual void visit_edges(Cell::Visitor& visitor) override;
 
+    void react_to_closed_promises();
+
     void read_chunk();
     void write_chunk();
 
+    void drain_queued_chunks();
+    bool source_has_queued_chunks() const;
+
     void write_unwritten_chunks();
     void wait_for_pending_writes_to_complete(Function<void()> on_complete);
 
@@ -71,11 +76,15 @@ private:
     Vector<GC::Ref<WebIDL::Promise>> m_pending_writes;
     Vector<JS::Value, 1> m_unwritten_chunks;
 
+    GC::Ptr<ReadRequest> m_read_request;
+
     bool m_prevent_close { false };
     bool m_prevent_abort { false };
     bool m_prevent_cancel { false };
 
     bool m_shutting_down { false };
+    bool m_reacting_to_closed_promises { false };
+    bool m_draining_source { false };
 };
 
 }
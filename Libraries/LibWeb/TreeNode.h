@@ -66,12 +66,33 @@ public:
     size_t index() const
     {
         // The index of an object is its number of preceding siblings, or 0 if it has none.
+        if (!m_parent)
+            return 0;
+
+        // OPTIMIZATION: Count from the nearest preceding sibling whose index we already know, and remember the result.
+        //               Walking a child list in order this way only ever looks at each child once.
+        auto version = m_parent->m_child_indices_version;
+        if (m_cached_index_version == version)
+            return m_cached_index;
+
         size_t index = 0;
-        for (auto* node = previous_sibling(); node; node = node->previous_sibling())
+        for (T const* node = m_previous_sibling; node; node = node->m_previous_sibling) {
+            if (node->m_cached_index_version == version) {
+                index += node->m_cached_index + 1;
+                break;
+            }
             ++index;
+        }
+
+        m_cached_index = index;
+        m_cached_index_version = version;
         return index;
     }
 
+    // Changes whenever the index of any of this node's children may have changed, i.e. on any mutation of the child
+    // list other than appending a child. Versions are never reused, not even across nodes.
+    u64 child_indices_version() const { return m_child_indices_version; }
+
     // // https://dom.spec.whatwg.org/#concept-tree-root
     T& root()
     {
@@ -457,6 +478,14 @@ private:
     T* m_last_child { nullptr };
     T* m_next_sibling { nullptr };
     T* m_previous_sibling { nullptr };
+
+    void invalidate_child_indices() { m_child_indices_version = ++s_last_child_indices_version; }
+
+    inline static u64 s_last_child_indices_version { 0 };
+    u64 m_child_indices_version { ++s_last_child_indices_version };
+
+    mutable size_t m_cached_index { 0 };
+    mutable u64 m_cached_index_version { 0 };
 };
 
 template<typename T>
@@ -479,6 +508,8 @@ inline void TreeNode<T>::remove_child(GC::Ref<T> node)
     node->m_next_sibling = nullptr;
     node->m_previous_sibling = nullptr;
     node->m_parent = nullptr;
+
+    invalidate_child_indices();
 }
 
 template<typename T>
@@ -515,6 +546,8 @@ inline void TreeNode<T>::replace_child(GC::Ref<T> new_child, GC::Ref<T> old_chil
     old_child->m_next_sibling = nullptr;
     old_child->m_previous_sibling = nullptr;
     old_child->m_parent = nullptr;
+
+    invalidate_child_indices();
 }
 
 template<typename T>
@@ -538,6 +571,8 @@ inline void TreeNode<T>::insert_before(GC::Ref<T> node, GC::Ptr<T> child)
     child->m_previous_sibling = node;
 
     node->m_parent = static_cast<T*>(this);
+
+    invalidate_child_indices();
 }
 
 template<typename T>
@@ -552,6 +587,7 @@ inline void TreeNode<T>::prepend_child(GC::Ref<T> node)
     m_first_child = node.ptr();
     if (!m_last_child)
         m_last_child = m_first_child;
+    invalidate_child_indices();
     node->inserted_into(static_cast<T&>(*this));
 
     static_cast<T*>(this)->children_changed();
@@ -71,7 +71,8 @@ void Instance::initialize(JS::Realm& realm)
             [&](Wasm::MemoryAddress const& address) {
                 Optional<GC::Ptr<Memory>> object = m_memory_instances.get(address);
                 if (!object.has_value()) {
-                    object = realm.create<Memory>(realm, address, Memory::Shared::No);
+                    auto shared = cache.abstract_machine().store().get(address)->type().is_shared() ? Memory::Shared::Yes : Memory::Shared::No;
+                    object = realm.create<Memory>(realm, address, shared);
                     m_memory_instances.set(address, *object);
                 }
 
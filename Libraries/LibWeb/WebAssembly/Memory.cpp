@@ -30,7 +30,7 @@ WebIDL::ExceptionOr<GC::Ref<Memory>> Memory::construct_impl(JS::Realm& realm, Me
         return vm.throw_completion<JS::TypeError>("Maximum has to be specified for shared memory."sv);
 
     Wasm::Limits limits { descriptor.initial, move(descriptor.maximum) };
-    Wasm::MemoryType memory_type { move(limits) };
+    Wasm::MemoryType memory_type { move(limits), shared ? Wasm::MemoryType::Shared::Yes : Wasm::MemoryType::Shared::No };
 
     auto& cache = Detail::get_cache(realm);
     auto address = cache.abstract_machine().store().allocate(memory_type);
@@ -135,13 +135,15 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> Memory::create_a_fixed_length_memo
     // 3. If share is shared,
     if (shared == Shared::Yes) {
         // 1. Let block be a Shared Data Block which is identified with the underlying memory of memaddr.
-        auto bytes = memory->data();
+        // NOTE: Shared memories reserve their maximum size up front, so their data never moves.
+        JS::DataBlock block { &memory->data(), JS::DataBlock::Shared::Yes };
 
         // 2. Let buffer be a new SharedArrayBuffer with the internal slots [[ArrayBufferData]] and [[ArrayBufferByteLength]].
-        array_buffer = TRY(JS::allocate_shared_array_buffer(vm, realm.intrinsics().shared_array_buffer_constructor(), bytes.size()));
-        bytes.span().copy_to(array_buffer->buffer().span());
-        // 3. FIXME: Set buffer.[[ArrayBufferData]] to block.
-        // 4. FIXME: Set buffer.[[ArrayBufferByteLength]] to the length of block.
+        array_buffer = TRY(JS::allocate_shared_array_buffer(vm, realm.intrinsics().shared_array_buffer_constructor(), 0));
+
+        // 3. Set buffer.[[ArrayBufferData]] to block.
+        // 4. Set buffer.[[ArrayBufferByteLength]] to the length of block.
+        array_buffer->set_data_block(move(block));
 
         // 5. Perform ! SetIntegrityLevel(buffer, "frozen").
         MUST(array_buffer->set_integrity_level(JS::Object::IntegrityLevel::Frozen));
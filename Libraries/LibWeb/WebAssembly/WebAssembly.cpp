@@ -6,9 +6,13 @@
  */
 
 #include <AK/ByteBuffer.h>
+#include <AK/HashMap.h>
 #include <AK/MemoryStream.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
+#include <AK/StringHash.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <LibJS/Runtime/Agent.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -22,7 +26,9 @@
 #include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/ResponsePrototype.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
 #include <LibWeb/Fetch/Response.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/WebAssembly/Global.h>
@@ -48,7 +54,14 @@ HashMap<GC::Ptr<JS::Object>, WebAssemblyCache> s_caches;
 
 WebAssemblyCache& get_cache(JS::Realm& realm)
 {
-    return s_caches.ensure(realm.global_object());
+    if (auto it = s_caches.find(realm.global_object()); it != s_caches.end())
+        return it->value;
+
+    auto& cache = s_caches.ensure(realm.global_object());
+    // memory.atomic.wait traps on agents that cannot suspend, like the main thread of a window.
+    if (JS::agent_can_suspend(realm.vm()))
+        cache.abstract_machine().enable_blocking();
+    return cache;
 }
 
 }
@@ -271,10 +284,11 @@ JS::ThrowCompletionOr<NonnullOwnPtr<Wasm::ModuleInstance>> instantiate_module(JS
                         cache.add_imported_object(function);
                         Wasm::HostFunction host_function {
                             [&](auto&, auto& arguments) -> Wasm::Result {
-                                GC::RootVector<JS::Value> argument_values { vm.heap() };
+                                GC::RootVector<JS::Value, 8> argument_values { vm.heap() };
+                                argument_values.ensure_capacity(arguments.size());
                                 size_t index = 0;
                                 for (auto& entry : arguments) {
-                                    argument_values.append(to_js_value(vm, entry, type.parameters()[index]));
+                                    argument_values.unchecked_append(to_js_value(vm, entry, type.parameters()[index]));
                                     ++index;
                                 }
 
@@ -409,20 +423,141 @@ JS::ThrowCompletionOr<NonnullOwnPtr<Wasm::ModuleInstance>> instantiate_module(JS
     return instance_result.release_value();
 }
 
+// Parsed and validated modules, keyed by a digest of their bytes, so that compiling the same module again (e.g. when
+// a page is reloaded) skips parsing and validation. Like the HTTP cache, entries are partitioned by origin, so that
+// how long a compilation takes can't reveal which modules other sites have loaded.
+class CompiledModuleCache {
+public:
+    using Digest = Crypto::Hash::SHA256::DigestType;
+
+    static CompiledModuleCache& the()
+    {
+        static CompiledModuleCache cache;
+        return cache;
+    }
+
+    static Optional<String> partition_for(JS::Realm& realm)
+    {
+        auto const& origin = HTML::principal_realm_settings_object(realm).origin();
+        if (origin.is_opaque())
+            return {};
+        return origin.serialize();
+    }
+
+    RefPtr<Wasm::Module> get(String const& partition, Digest const& digest)
+    {
+        Key key { partition, digest };
+        auto it = m_entries.find(key);
+        if (it == m_entries.end())
+            return {};
+
+        // Re-insert the entry to mark it as the most recently used one.
+        auto entry = it->value;
+        m_entries.remove(it);
+        m_entries.set(move(key), entry);
+        return entry.module;
+    }
+
+    void add(String partition, Digest digest, NonnullRefPtr<Wasm::Module> module, size_t byte_size)
+    {
+        if (byte_size > maximum_total_byte_size)
+            return;
+
+        Key key { move(partition), digest };
+        if (auto existing = m_entries.get(key); existing.has_value())
+            m_total_byte_size -= existing->byte_size;
+        m_entries.set(move(key), { move(module), byte_size });
+        m_total_byte_size += byte_size;
+
+        while (m_total_byte_size > maximum_total_byte_size) {
+            auto least_recently_used = m_entries.begin();
+            m_total_byte_size -= least_recently_used->value.byte_size;
+            m_entries.remove(least_recently_used);
+        }
+    }
+
+    void clear()
+    {
+        m_entries.clear();
+        m_total_byte_size = 0;
+    }
+
+private:
+    // This bounds the size of the modules' binaries; the parsed modules take up a small multiple of that.
+    static constexpr size_t maximum_total_byte_size = 256 * MiB;
+
+    struct Key {
+        String partition;
+        Digest digest;
+
+        bool operator==(Key const&) const = default;
+    };
+
+    struct KeyTraits : public DefaultTraits<Key> {
+        static unsigned hash(Key const& key)
+        {
+            auto digest = key.digest.bytes();
+            return pair_int_hash(key.partition.hash(), string_hash(reinterpret_cast<char const*>(digest.data()), digest.size()));
+        }
+    };
+
+    struct Entry {
+        NonnullRefPtr<Wasm::Module> module;
+        size_t byte_size { 0 };
+    };
+
+    OrderedHashMap<Key, Entry, KeyTraits> m_entries;
+    size_t m_total_byte_size { 0 };
+};
+
 // // https://webassembly.github.io/spec/js-api/#compile-a-webassembly-module
 JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module(JS::VM& vm, ByteBuffer data)
 {
+    auto partition = CompiledModuleCache::partition_for(*vm.current_realm());
+    auto digest = Crypto::Hash::SHA256::hash(data);
+    if (partition.has_value()) {
+        if (auto module = CompiledModuleCache::the().get(*partition, digest))
+            return compile_a_parsed_webassembly_module(vm, module.release_nonnull());
+    }
+
     FixedMemoryStream stream { data.bytes() };
     auto module_result = Wasm::Module::parse(stream);
     if (module_result.is_error()) {
         return vm.throw_completion<CompileError>(Wasm::parse_error_to_byte_string(module_result.error()));
     }
 
+    auto compiled_module = TRY(compile_a_parsed_webassembly_module(vm, module_result.value()));
+    if (partition.has_value())
+        CompiledModuleCache::the().add(partition.release_value(), digest, module_result.release_value(), data.size());
+    return compiled_module;
+}
+
+static JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_streamed_webassembly_module(JS::VM& vm, Wasm::StreamingModuleParser& parser, Crypto::Hash::SHA256& hasher, size_t byte_size)
+{
+    auto partition = CompiledModuleCache::partition_for(*vm.current_realm());
+    auto digest = hasher.digest();
+    if (partition.has_value()) {
+        if (auto module = CompiledModuleCache::the().get(*partition, digest))
+            return compile_a_parsed_webassembly_module(vm, module.release_nonnull());
+    }
+
+    auto module_result = parser.finish();
+    if (module_result.is_error())
+        return vm.throw_completion<CompileError>(Wasm::parse_error_to_byte_string(module_result.error()));
+
+    auto compiled_module = TRY(compile_a_parsed_webassembly_module(vm, module_result.value()));
+    if (partition.has_value())
+        CompiledModuleCache::the().add(partition.release_value(), digest, module_result.release_value(), byte_size);
+    return compiled_module;
+}
+
+JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_parsed_webassembly_module(JS::VM& vm, NonnullRefPtr<Wasm::Module> module)
+{
     auto& cache = get_cache(*vm.current_realm());
-    if (auto validation_result = cache.abstract_machine().validate(module_result.value()); validation_result.is_error()) {
+    if (auto validation_result = cache.abstract_machine().validate(module); validation_result.is_error()) {
         return vm.throw_completion<CompileError>(validation_result.error().error_string);
     }
-    auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module_result.release_value());
+    auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(move(module));
     cache.add_compiled_module(compiled_module);
     return compiled_module;
 }
@@ -460,16 +595,17 @@ JS::NativeFunction* create_native_function(JS::VM& vm, Wasm::FunctionAddress add
         [address, type = type.release_value(), instance](JS::VM& vm) -> JS::ThrowCompletionOr<JS::Value> {
             (void)instance;
             auto& realm = *vm.current_realm();
-            Vector<Wasm::Value> values;
+            // Most exports take a handful of arguments, keep them off the heap.
+            Vector<Wasm::Value, 8> values;
             values.ensure_capacity(type.parameters().size());
 
             // Grab as many values as needed and convert them.
             size_t index = 0;
             for (auto& type : type.parameters())
-                values.append(TRY(to_webassembly_value(vm, vm.argument(index++), type)));
+                values.unchecked_append(TRY(to_webassembly_value(vm, vm.argument(index++), type)));
 
             auto& cache = get_cache(realm);
-            auto result = cache.abstract_machine().invoke(address, move(values));
+            auto result = cache.abstract_machine().invoke(address, values.span());
             // FIXME: Use the convoluted mapping of errors defined in the spec.
             if (result.is_trap()) {
                 if (auto ptr = result.trap().data.get_pointer<Wasm::ExternallyManagedTrap>())
@@ -520,10 +656,14 @@ JS::ThrowCompletionOr<Wasm::Value> to_webassembly_value(JS::VM& vm, JS::Value va
         return Wasm::Value { integer };
     }
     case Wasm::ValueType::I32: {
+        if (value.is_int32())
+            return Wasm::Value { value.as_i32() };
         auto _i32 = TRY(value.to_i32(vm));
         return Wasm::Value { static_cast<i32>(_i32) };
     }
     case Wasm::ValueType::F64: {
+        if (value.is_number())
+            return Wasm::Value { value.as_double() };
         auto number = TRY(value.to_double(vm));
         return Wasm::Value { static_cast<double>(number) };
     }
@@ -628,6 +768,11 @@ JS::Value to_js_value(JS::VM& vm, Wasm::Value& wasm_value, Wasm::ValueType type)
 
 }
 
+void clear_compiled_module_cache()
+{
+    Detail::CompiledModuleCache::the().clear();
+}
+
 // https://webassembly.github.io/spec/js-api/#asynchronously-compile-a-webassembly-module
 GC::Ref<WebIDL::Promise> asynchronously_compile_webassembly_module(JS::VM& vm, ByteBuffer bytes, HTML::Task::Source task_source)
 {
@@ -779,6 +924,12 @@ GC::Ref<WebIDL::Promise> instantiate_promise_of_module(JS::VM& vm, GC::Ref<WebID
 }
 
 // https://webassembly.github.io/spec/web-api/index.html#compile-a-potential-webassembly-response
+struct StreamingCompilation : public RefCounted<StreamingCompilation> {
+    NonnullRefPtr<Wasm::StreamingModuleParser> parser { make_ref_counted<Wasm::StreamingModuleParser>() };
+    NonnullOwnPtr<Crypto::Hash::SHA256> hasher { Crypto::Hash::SHA256::create() };
+    size_t byte_size { 0 };
+};
+
 GC::Ref<WebIDL::Promise> compile_potential_webassembly_response(JS::VM& vm, GC::Ref<WebIDL::Promise> source)
 {
     auto& realm = *vm.current_realm();
@@ -828,42 +979,53 @@ GC::Ref<WebIDL::Promise> compile_potential_webassembly_response(JS::VM& vm, GC::
         }
 
         // 8. Consume response’s body as an ArrayBuffer, and let bodyPromise be the result.
-        auto body_promise_or_error = response_object.array_buffer();
-        if (body_promise_or_error.is_error()) {
-            auto throw_completion = Bindings::exception_to_throw_completion(realm.vm(), body_promise_or_error.release_error());
-            WebIDL::reject_promise(realm, return_value, throw_completion.value());
+        // 9. Upon fulfillment of bodyPromise with value bodyArrayBuffer:
+        //     1. Let stableBytes be a copy of the bytes held by the buffer bodyArrayBuffer.
+        //     2. Asynchronously compile the WebAssembly module stableBytes using the networking task source and resolve returnValue with the result.
+        // 10. Upon rejection of bodyPromise with reason reason:
+        //     1. Reject returnValue with reason.
+        // NOTE: Rather than waiting for the whole body, we read it incrementally and parse each section of the module
+        //       as soon as it has arrived, so parsing overlaps with the download. Validation still happens once the
+        //       whole module has been parsed.
+        if (response_object.is_unusable()) {
+            WebIDL::reject_promise(realm, return_value, vm.throw_completion<JS::TypeError>("Body is unusable"sv).value());
             return JS::js_undefined();
         }
-        auto body_promise = body_promise_or_error.release_value();
 
-        // 9. Upon fulfillment of bodyPromise with value bodyArrayBuffer:
-        auto body_fulfillment_steps = GC::create_function(vm.heap(), [&vm, return_value](JS::Value body_array_buffer) -> WebIDL::ExceptionOr<JS::Value> {
-            // 1. Let stableBytes be a copy of the bytes held by the buffer bodyArrayBuffer.
-            VERIFY(body_array_buffer.is_object());
-            auto stable_bytes = WebIDL::get_buffer_source_copy(body_array_buffer.as_object());
-            if (stable_bytes.is_error()) {
-                VERIFY(stable_bytes.error().code() == ENOMEM);
-                WebIDL::reject_promise(HTML::relevant_realm(*return_value->promise()), return_value, vm.throw_completion<JS::InternalError>(vm.error_message(JS::VM::ErrorMessage::OutOfMemory)).value());
-                return JS::js_undefined();
-            }
+        auto compilation = make_ref_counted<StreamingCompilation>();
 
-            // 2. Asynchronously compile the WebAssembly module stableBytes using the networking task source and resolve returnValue with the result.
-            auto result = asynchronously_compile_webassembly_module(vm, stable_bytes.release_value(), HTML::Task::Source::Networking);
+        auto process_body_chunk = GC::create_function(vm.heap(), [compilation](ByteBuffer bytes) {
+            // A parse error is remembered by the parser and reported once the body has been read.
+            (void)compilation->parser->append(bytes);
+            compilation->hasher->update(bytes);
+            compilation->byte_size += bytes.size();
+        });
 
-            // Need to manually convert WebIDL promise to an ECMAScript value here to resolve
-            WebIDL::resolve_promise(HTML::relevant_realm(*return_value->promise()), return_value, result->promise());
+        auto process_end_of_body = GC::create_function(vm.heap(), [&vm, compilation, return_value]() {
+            auto& realm = HTML::relevant_realm(*return_value->promise());
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
 
-            return JS::js_undefined();
+            auto compiled_module_or_error = Detail::compile_a_streamed_webassembly_module(vm, compilation->parser, *compilation->hasher, compilation->byte_size);
+            if (compiled_module_or_error.is_error()) {
+                WebIDL::reject_promise(realm, return_value, compiled_module_or_error.error_value());
+                return;
+            }
+
+            auto module_object = realm.create<Module>(realm, compiled_module_or_error.release_value());
+            WebIDL::resolve_promise(realm, return_value, module_object);
         });
 
-        // 10. Upon rejection of bodyPromise with reason reason:
-        auto body_rejection_steps = GC::create_function(vm.heap(), [return_value](JS::Value reason) -> WebIDL::ExceptionOr<JS::Value> {
-            // 1. Reject returnValue with reason.
+        auto process_body_error = GC::create_function(vm.heap(), [return_value](JS::Value reason) {
             WebIDL::reject_promise(HTML::relevant_realm(*return_value->promise()), return_value, reason);
-            return JS::js_undefined();
         });
 
-        WebIDL::react_to_promise(body_promise, body_fulfillment_steps, body_rejection_steps);
+        // A null body is read as an empty byte sequence.
+        if (!response->body()) {
+            process_end_of_body->function()();
+            return JS::js_undefined();
+        }
+
+        response->body()->incrementally_read(process_body_chunk, process_end_of_body, process_body_error, { realm.global_object() });
 
         return JS::js_undefined();
     });
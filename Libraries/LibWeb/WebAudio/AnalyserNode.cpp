@@ -77,26 +77,40 @@ Vector<f32> AnalyserNode::apply_a_blackman_window(Vector<f32> const& x) const
 }
 
 // https://webaudio.github.io/web-audio-api/#fourier-transform
-static Vector<f32> apply_a_fourier_transform(Vector<f32> const& input)
+Vector<f32> AnalyserNode::apply_a_fourier_transform(Vector<f32> const& x_hat)
 {
-    dbgln("FIXME: Analyser node: implement apply a fourier transform");
-    auto result = Vector<f32>();
-    result.resize(input.size());
-    return result;
+    if (!m_fft.has_value() || m_fft->size() != m_fft_size)
+        m_fft = MUST(Audio::FFT::create(m_fft_size));
+
+    Vector<f32> real = x_hat;
+    Vector<f32> imaginary;
+    imaginary.resize(m_fft_size);
+    m_fft->transform(real.span(), imaginary.span());
+
+    // X[k] = 1/N * sum(x_hat[n] * e^(-2 * pi * i * k * n / N)) for k = 0, ..., N/2 - 1
+    auto bin_count = frequency_bin_count();
+    Vector<f32> magnitudes;
+    magnitudes.resize(bin_count);
+    Audio::compute_magnitudes(real.span().trim(bin_count), imaginary.span().trim(bin_count), magnitudes.span());
+    Audio::scale(magnitudes.span(), 1.0f / static_cast<f32>(m_fft_size));
+    return magnitudes;
 }
 
 // https://webaudio.github.io/web-audio-api/#smoothing-over-time
 Vector<f32> AnalyserNode::smoothing_over_time(Vector<f32> const& current_block)
 {
-    auto X = apply_a_fourier_transform(current_block);
+    // NOTE: The current block already holds the magnitudes |X[k]|.
+    auto bin_count = frequency_bin_count();
+    if (m_previous_block.size() != bin_count) {
+        m_previous_block.clear();
+        m_previous_block.resize(bin_count);
+    }
 
-    // FIXME: Naive
     Vector<f32> result;
-    result.ensure_capacity(m_fft_size);
-    for (unsigned long i = 0; i < m_fft_size; i++) {
-        // FIXME: Complex modulus on X[i]
-        result.unchecked_append(m_smoothing_time_constant * m_previous_block[i] + (1.f - m_smoothing_time_constant) * abs(X[i]));
-    }
+    result.resize(bin_count);
+    auto smoothing_time_constant = static_cast<f32>(m_smoothing_time_constant);
+    Audio::add_scaled(result.span(), m_previous_block.span(), smoothing_time_constant);
+    Audio::add_scaled(result.span(), current_block.span(), 1.f - smoothing_time_constant);
 
     m_previous_block = result;
 
@@ -110,7 +124,7 @@ Vector<f32> AnalyserNode::conversion_to_dB(Vector<f32> const& X_hat) const
     result.ensure_capacity(X_hat.size());
     // FIXME: Naive
     for (auto x : X_hat)
-        result.unchecked_append(20.0f * AK::log(x));
+        result.unchecked_append(20.0f * AK::log10(x));
 
     return result;
 }
@@ -172,9 +186,7 @@ WebIDL::ExceptionOr<void> AnalyserNode::get_byte_frequency_data(GC::Root<WebIDL:
     //      more scaffolding
     //
 
-    // current_frequency_data returns a vector of size m_fftSize
-    // FIXME: Ensure sizes are correct after the fourier transform is implemented
-    //        Spec says to write frequencyBinCount bytes, not fftSize
+    // current_frequency_data returns a vector of size frequencyBinCount
     Vector<f32> dB_data = current_frequency_data();
     Vector<u8> byte_data;
     byte_data.ensure_capacity(dB_data.size());
@@ -264,7 +276,7 @@ WebIDL::ExceptionOr<void> AnalyserNode::set_fft_size(unsigned long fft_size)
 
     // reset previous block to 0s
     m_previous_block = Vector<f32>();
-    m_previous_block.resize(fft_size);
+    m_previous_block.resize(fft_size / 2);
 
     m_fft_size = fft_size;
 
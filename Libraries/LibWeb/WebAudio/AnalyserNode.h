@@ -7,6 +7,7 @@
 #pragma once
 
 #include <LibJS/Forward.h>
+#include <LibMedia/Audio/DSP.h>
 #include <LibWeb/Bindings/PlatformObject.h>
 #include <LibWeb/WebAudio/AudioNode.h>
 #include <LibWeb/WebIDL/Buffers.h>
@@ -72,9 +73,17 @@ private:
     // https://webaudio.github.io/web-audio-api/#blackman-window
     Vector<f32> apply_a_blackman_window(Vector<f32> const& x) const;
 
+    // https://webaudio.github.io/web-audio-api/#fourier-transform
+    // NOTE: This returns the magnitudes |X[k]| of the frequencyBinCount frequency bins, which is all that the
+    //       following steps use of the real and imaginary data.
+    Vector<f32> apply_a_fourier_transform(Vector<f32> const& x_hat);
+
     // https://webaudio.github.io/web-audio-api/#smoothing-over-time
     Vector<f32> smoothing_over_time(Vector<f32> const& current_block);
 
+    // Created when first needed, and whenever fftSize changes.
+    Optional<Audio::FFT> m_fft;
+
     // https://webaudio.github.io/web-audio-api/#previous-block
     Vector<f32> m_previous_block;
 
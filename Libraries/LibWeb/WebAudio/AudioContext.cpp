@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibMedia/Audio/PlaybackStream.h>
 #include <LibWeb/Bindings/AudioContextPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/DOM/Event.h>
@@ -12,8 +13,12 @@
 #include <LibWeb/HTML/MessagePort.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/Platform/Timer.h>
 #include <LibWeb/WebAudio/AudioContext.h>
 #include <LibWeb/WebAudio/AudioDestinationNode.h>
+#include <LibWeb/WebAudio/AudioParam.h>
+#include <LibWeb/WebAudio/RenderGraph.h>
 #include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::WebAudio {
@@ -121,6 +126,13 @@ void AudioContext::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_pending_resume_promises);
+    visitor.visit(m_render_graph_retry_timer);
+}
+
+void AudioContext::finalize()
+{
+    Base::finalize();
+    suspend_output();
 }
 
 // https://www.w3.org/TR/webaudio/#dom-audiocontext-getoutputtimestamp
@@ -253,7 +265,8 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> AudioContext::suspend()
     // 7. Queue a control message to suspend the AudioContext.
     // FIXME: Implement control message queue to run following steps on the rendering thread
 
-    // FIXME: 7.1: Attempt to release system resources.
+    // 7.1: Attempt to release system resources.
+    suspend_output();
 
     // 7.2: Set the [[rendering thread state]] on the AudioContext to suspended.
     set_rendering_state(Bindings::AudioContextState::Suspended);
@@ -306,7 +319,9 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> AudioContext::close()
     // 5. Queue a control message to close the AudioContext.
     // FIXME: Implement control message queue to run following steps on the rendering thread
 
-    // FIXME: 5.1: Attempt to release system resources.
+    // 5.1: Attempt to release system resources.
+    suspend_output();
+    m_output_stream = nullptr;
 
     // 5.2: Set the [[rendering thread state]] to "suspended".
     set_rendering_state(Bindings::AudioContextState::Suspended);
@@ -335,11 +350,106 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> AudioContext::close()
     return promise;
 }
 
-// FIXME: Actually implement the rendering thread
 bool AudioContext::start_rendering_audio_graph()
 {
-    bool render_result = true;
-    return render_result;
+    // NOTE: Opening the output can fail, but only happens once the graph has something to play. Until then, there's
+    //       nothing that could fail here.
+    audio_graph_did_change();
+    return true;
+}
+
+double AudioContext::current_time() const
+{
+    // https://webaudio.github.io/web-audio-api/#dom-baseaudiocontext-currenttime
+    // This is the time in seconds of the sample frame immediately following the last sample-frame in the block of
+    // audio most recently processed by the context’s rendering graph.
+    if (!m_rendering_thread)
+        return 0;
+    return static_cast<double>(m_rendering_thread->rendered_frame_count()) / sample_rate();
+}
+
+void AudioContext::audio_graph_did_change()
+{
+    if (m_has_pending_render_graph_update || state() == Bindings::AudioContextState::Closed)
+        return;
+
+    // NOTE: Building a graph on the web is usually a flurry of calls, so we only compile it once they are all done.
+    m_has_pending_render_graph_update = true;
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [this] {
+        update_render_graph();
+    }));
+}
+
+void AudioContext::audio_param_value_did_change(AudioParam const& param)
+{
+    // OPTIMIZATION: Setting a value doesn't require compiling the whole graph again, unless the queue to the rendering
+    //               thread is full. The new graph will then have the new value.
+    if (!m_rendering_thread || !m_rendering_thread->set_param_value(bit_cast<RenderParamID>(&param), param.value()))
+        audio_graph_did_change();
+}
+
+void AudioContext::update_render_graph()
+{
+    m_has_pending_render_graph_update = false;
+    if (state() == Bindings::AudioContextState::Closed)
+        return;
+
+    if (!m_rendering_thread)
+        m_rendering_thread = RenderingThread::create(sample_rate());
+    m_rendering_thread->collect_retired_graphs();
+
+    auto graph = RenderGraph::compile(*m_destination);
+    auto has_scheduled_sources = graph->has_scheduled_sources();
+    if (!m_rendering_thread->replace_graph(move(graph))) {
+        // The rendering thread is too far behind to take a new graph right now, so try again in a bit.
+        m_has_pending_render_graph_update = true;
+        if (!m_render_graph_retry_timer) {
+            m_render_graph_retry_timer = Platform::Timer::create_single_shot(heap(), 10, GC::create_function(heap(), [this] {
+                update_render_graph();
+            }));
+        }
+        m_render_graph_retry_timer->restart();
+        return;
+    }
+
+    if (has_scheduled_sources && rendering_state() == Bindings::AudioContextState::Running)
+        start_output();
+}
+
+void AudioContext::start_output()
+{
+    if (m_output_is_playing || m_failed_to_open_output)
+        return;
+
+    if (m_output_stream) {
+        (void)m_output_stream->resume();
+        m_output_is_playing = true;
+        return;
+    }
+
+    // FIXME: Pick the latency based on the latencyHint the context was created with.
+    static constexpr u32 target_latency_ms = 20;
+
+    auto output_stream_or_error = Audio::PlaybackStream::create(Audio::OutputState::Playing, static_cast<u32>(sample_rate()), RenderingThread::output_channel_count, target_latency_ms,
+        [rendering_thread = NonnullRefPtr { *m_rendering_thread }](Bytes buffer, Audio::PcmSampleFormat format, size_t sample_count) {
+            return rendering_thread->render(buffer, format, sample_count);
+        });
+    if (output_stream_or_error.is_error()) {
+        dbgln("AudioContext: Failed to open the audio output: {}", output_stream_or_error.error());
+        m_failed_to_open_output = true;
+        return;
+    }
+
+    m_output_stream = output_stream_or_error.release_value();
+    m_output_is_playing = true;
+}
+
+void AudioContext::suspend_output()
+{
+    if (!m_output_is_playing)
+        return;
+    (void)m_output_stream->discard_buffer_and_suspend();
+    m_output_is_playing = false;
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audiocontext-createmediaelementsource
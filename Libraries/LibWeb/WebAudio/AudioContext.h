@@ -6,10 +6,12 @@
 
 #pragma once
 
+#include <LibMedia/Audio/Forward.h>
 #include <LibWeb/Bindings/AudioContextPrototype.h>
 #include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/MediaElementAudioSourceNode.h>
+#include <LibWeb/WebAudio/RenderingThread.h>
 
 namespace Web::WebAudio {
 
@@ -42,6 +44,10 @@ public:
 
     WebIDL::ExceptionOr<GC::Ref<MediaElementAudioSourceNode>> create_media_element_source(GC::Ptr<HTML::HTMLMediaElement>);
 
+    virtual double current_time() const override;
+    virtual void audio_graph_did_change() override;
+    virtual void audio_param_value_did_change(AudioParam const&) override;
+
 private:
     explicit AudioContext(JS::Realm& realm)
         : BaseAudioContext(realm)
@@ -50,6 +56,7 @@ private:
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
 
     double m_base_latency { 0 };
     double m_output_latency { 0 };
@@ -59,6 +66,20 @@ private:
     bool m_suspended_by_user = false;
 
     bool start_rendering_audio_graph();
+
+    void update_render_graph();
+    void start_output();
+    void suspend_output();
+
+    RefPtr<RenderingThread> m_rendering_thread;
+    bool m_has_pending_render_graph_update { false };
+    GC::Ptr<Platform::Timer> m_render_graph_retry_timer;
+
+    // NOTE: The output stream is only opened once there is something to play, so that contexts that are never used
+    //       to make any sound don't tie up an audio device.
+    RefPtr<Audio::PlaybackStream> m_output_stream;
+    bool m_output_is_playing { false };
+    bool m_failed_to_open_output { false };
 };
 
 }
@@ -83,6 +83,8 @@ WebIDL::ExceptionOr<GC::Ref<AudioNode>> AudioNode::connect(GC::Ref<AudioNode> de
     // Connect destination_node input to node's output.
     destination_node->m_input_connections.append(input_connection);
 
+    m_context->audio_graph_did_change();
+
     return destination_node;
 }
 
@@ -112,6 +114,9 @@ WebIDL::ExceptionOr<void> AudioNode::connect(GC::Ref<AudioParam> destination_par
 
     // Connect node's output to destination_param.
     m_param_connections.append(param_connection);
+    destination_param->did_connect_input_node({}, *this);
+
+    m_context->audio_graph_did_change();
 
     return {};
 }
@@ -198,6 +203,11 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioParam> destination_
     return {};
 }
 
+void AudioNode::audio_graph_did_change()
+{
+    m_context->audio_graph_did_change();
+}
+
 // https://webaudio.github.io/web-audio-api/#dom-audionode-channelcount
 WebIDL::ExceptionOr<void> AudioNode::set_channel_count(WebIDL::UnsignedLong channel_count)
 {
@@ -207,6 +217,7 @@ WebIDL::ExceptionOr<void> AudioNode::set_channel_count(WebIDL::UnsignedLong chan
         return WebIDL::NotSupportedError::create(realm(), "Invalid channel count"_string);
 
     m_channel_count = channel_count;
+    audio_graph_did_change();
     return {};
 }
 
@@ -214,11 +225,12 @@ WebIDL::ExceptionOr<void> AudioNode::set_channel_count(WebIDL::UnsignedLong chan
 WebIDL::ExceptionOr<void> AudioNode::set_channel_count_mode(Bindings::ChannelCountMode channel_count_mode)
 {
     m_channel_count_mode = channel_count_mode;
+    audio_graph_did_change();
     return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-channelcountmode
-Bindings::ChannelCountMode AudioNode::channel_count_mode()
+Bindings::ChannelCountMode AudioNode::channel_count_mode() const
 {
     return m_channel_count_mode;
 }
@@ -231,7 +243,7 @@ WebIDL::ExceptionOr<void> AudioNode::set_channel_interpretation(Bindings::Channe
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-channelinterpretation
-Bindings::ChannelInterpretation AudioNode::channel_interpretation()
+Bindings::ChannelInterpretation AudioNode::channel_interpretation() const
 {
     return m_channel_interpretation;
 }
@@ -80,18 +80,23 @@ public:
     virtual WebIDL::UnsignedLong channel_count() const { return m_channel_count; }
 
     virtual WebIDL::ExceptionOr<void> set_channel_count_mode(Bindings::ChannelCountMode);
-    Bindings::ChannelCountMode channel_count_mode();
+    Bindings::ChannelCountMode channel_count_mode() const;
     virtual WebIDL::ExceptionOr<void> set_channel_interpretation(Bindings::ChannelInterpretation);
-    Bindings::ChannelInterpretation channel_interpretation();
+    Bindings::ChannelInterpretation channel_interpretation() const;
 
     WebIDL::ExceptionOr<void> initialize_audio_node_options(AudioNodeOptions const& given_options, AudioNodeDefaultOptions const& default_options);
 
+    Vector<AudioNodeConnection> const& input_connections() const { return m_input_connections; }
+
 protected:
     AudioNode(JS::Realm&, GC::Ref<BaseAudioContext>, WebIDL::UnsignedLong channel_count = 2);
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
+    // Lets the context know that it has to render the graph differently.
+    void audio_graph_did_change();
+
 private:
     GC::Ref<BaseAudioContext> m_context;
     WebIDL::UnsignedLong m_channel_count { 2 };
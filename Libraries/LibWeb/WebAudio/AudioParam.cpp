@@ -46,6 +46,7 @@ float AudioParam::value() const
 void AudioParam::set_value(float value)
 {
     m_current_value = value;
+    m_context->audio_param_value_did_change(*this);
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-automationrate
@@ -155,6 +156,7 @@ void AudioParam::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_context);
+    visitor.visit(m_input_nodes);
 }
 
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Badge.h>
 #include <LibJS/Forward.h>
 #include <LibWeb/Bindings/AudioParamPrototype.h>
 #include <LibWeb/Bindings/PlatformObject.h>
@@ -46,6 +47,10 @@ public:
     WebIDL::ExceptionOr<GC::Ref<AudioParam>> cancel_scheduled_values(double cancel_time);
     WebIDL::ExceptionOr<GC::Ref<AudioParam>> cancel_and_hold_at_time(double cancel_time);
 
+    // The nodes whose output is connected to this param.
+    Vector<GC::Ref<AudioNode>> const& input_nodes() const { return m_input_nodes; }
+    void did_connect_input_node(Badge<AudioNode>, AudioNode& node) { m_input_nodes.append(node); }
+
 private:
     AudioParam(JS::Realm&, GC::Ref<BaseAudioContext>, float default_value, float min_value, float max_value, Bindings::AutomationRate, FixedAutomationRate = FixedAutomationRate::No);
 
@@ -63,6 +68,8 @@ private:
 
     FixedAutomationRate m_fixed_automation_rate { FixedAutomationRate::No };
 
+    Vector<GC::Ref<AudioNode>> m_input_nodes;
+
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 };
@@ -47,10 +47,12 @@ WebIDL::ExceptionOr<void> AudioScheduledSourceNode::start(double when)
     // 3. Set the internal slot [[source started]] on this AudioScheduledSourceNode to true.
     set_source_started(true);
 
-    // FIXME: 4. Queue a control message to start the AudioScheduledSourceNode, including the parameter values in the message.
-    // FIXME: 5. Send a control message to the associated AudioContext to start running its rendering thread only when all the following conditions are met:
-
-    dbgln("FIXME: Implement AudioScheduledSourceNode::start");
+    // 4. Queue a control message to start the AudioScheduledSourceNode, including the parameter values in the message.
+    // 5. Send a control message to the associated AudioContext to start running its rendering thread only when all the following conditions are met:
+    // NOTE: The start time is part of the render graph, so recompiling the graph sends both control messages. The
+    //       context only starts its rendering thread once the graph contains a started source.
+    m_start_time = when;
+    audio_graph_did_change();
     return {};
 }
 
@@ -66,9 +68,9 @@ WebIDL::ExceptionOr<void> AudioScheduledSourceNode::stop(double when)
     if (when < 0)
         return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "when must not be negative"sv };
 
-    // FIXME: 3. Queue a control message to stop the AudioScheduledSourceNode, including the parameter values in the message.
-
-    dbgln("FIXME: Implement AudioScheduledSourceNode::stop");
+    // 3. Queue a control message to stop the AudioScheduledSourceNode, including the parameter values in the message.
+    m_stop_time = when;
+    audio_graph_did_change();
     return {};
 }
 
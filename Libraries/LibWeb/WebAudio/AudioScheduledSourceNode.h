@@ -24,6 +24,10 @@ public:
     WebIDL::ExceptionOr<void> start(double when = 0);
     WebIDL::ExceptionOr<void> stop(double when = 0);
 
+    // The context times at which start() and stop() asked this node to start and stop playing.
+    Optional<double> start_time() const { return m_start_time; }
+    Optional<double> stop_time() const { return m_stop_time; }
+
 protected:
     AudioScheduledSourceNode(JS::Realm&, GC::Ref<BaseAudioContext>);
 
@@ -36,6 +40,9 @@ protected:
 private:
     // https://webaudio.github.io/web-audio-api/#dom-audioscheduledsourcenode-source-started-slot
     bool m_source_started { false };
+
+    Optional<double> m_start_time;
+    Optional<double> m_stop_time;
 };
 
 }
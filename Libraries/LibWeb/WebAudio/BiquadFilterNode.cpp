@@ -33,6 +33,7 @@ BiquadFilterNode::~BiquadFilterNode() = default;
 void BiquadFilterNode::set_type(Bindings::BiquadFilterType type)
 {
     m_type = type;
+    audio_graph_did_change();
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-biquadfilternode-type
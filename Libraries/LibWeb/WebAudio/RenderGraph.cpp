@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <AK/TypeCasts.h>
+#include <LibMedia/Audio/DSP.h>
+#include <LibWeb/WebAudio/AudioDestinationNode.h>
+#include <LibWeb/WebAudio/AudioParam.h>
+#include <LibWeb/WebAudio/BiquadFilterNode.h>
+#include <LibWeb/WebAudio/ConstantSourceNode.h>
+#include <LibWeb/WebAudio/GainNode.h>
+#include <LibWeb/WebAudio/OscillatorNode.h>
+#include <LibWeb/WebAudio/RenderGraph.h>
+
+namespace Web::WebAudio {
+
+class RenderGraphCompiler {
+public:
+    explicit RenderGraphCompiler(RenderGraph& graph)
+        : m_graph(graph)
+    {
+    }
+
+    // Returns the index of the compiled node, or nothing if the node is part of a cycle.
+    Optional<size_t> compile_node(AudioNode const& audio_node)
+    {
+        if (auto it = m_node_indices.find(&audio_node); it != m_node_indices.end())
+            return it->value;
+
+        // FIXME: Cycles are only allowed if they contain a DelayNode, which we can't render yet, so we always break them.
+        m_node_indices.set(&audio_node, {});
+
+        RenderGraph::Node node;
+        node.id = bit_cast<RenderNodeID>(&audio_node);
+
+        size_t maximum_input_channel_count = 0;
+        for (auto const& connection : audio_node.input_connections()) {
+            // NOTE: For input connections, the "destination" node is the node on the other end of the connection.
+            if (auto input = compile_node(*connection.destination_node); input.has_value()) {
+                node.input_nodes.append(*input);
+                maximum_input_channel_count = max(maximum_input_channel_count, m_graph.m_nodes[*input].channel_count);
+            }
+        }
+
+        // https://webaudio.github.io/web-audio-api/#channel-up-mixing-and-down-mixing
+        switch (audio_node.channel_count_mode()) {
+        case Bindings::ChannelCountMode::Max:
+            node.channel_count = max<size_t>(maximum_input_channel_count, 1);
+            break;
+        case Bindings::ChannelCountMode::ClampedMax:
+            node.channel_count = clamp<size_t>(maximum_input_channel_count, 1, audio_node.channel_count());
+            break;
+        case Bindings::ChannelCountMode::Explicit:
+            node.channel_count = audio_node.channel_count();
+            break;
+        }
+
+        if (is<AudioDestinationNode>(audio_node)) {
+            node.kind = RenderGraph::Node::Kind::Destination;
+        } else if (auto const* gain_node = as_if<GainNode>(audio_node)) {
+            node.kind = RenderGraph::Node::Kind::Gain;
+            node.params.append(compile_param(*gain_node->gain()));
+        } else if (auto const* biquad_filter_node = as_if<BiquadFilterNode>(audio_node)) {
+            node.kind = RenderGraph::Node::Kind::BiquadFilter;
+            node.biquad_filter_type = biquad_filter_node->type();
+            node.params.append(compile_param(*biquad_filter_node->frequency()));
+            node.params.append(compile_param(*biquad_filter_node->detune()));
+            node.params.append(compile_param(*biquad_filter_node->q()));
+            node.params.append(compile_param(*biquad_filter_node->gain()));
+            node.biquad_states.resize(node.channel_count);
+        } else if (auto const* oscillator_node = as_if<OscillatorNode>(audio_node)) {
+            node.kind = RenderGraph::Node::Kind::Oscillator;
+            node.oscillator_type = oscillator_node->type();
+            node.params.append(compile_param(*oscillator_node->frequency()));
+            node.params.append(compile_param(*oscillator_node->detune()));
+            // FIXME: Render custom PeriodicWaves.
+            if (node.oscillator_type == Bindings::OscillatorType::Custom)
+                node.kind = RenderGraph::Node::Kind::Silent;
+        } else if (auto const* constant_source_node = as_if<ConstantSourceNode>(audio_node)) {
+            node.kind = RenderGraph::Node::Kind::ConstantSource;
+            node.params.append(compile_param(*constant_source_node->offset()));
+        } else {
+            // FIXME: Render all the other kinds of nodes.
+            node.kind = RenderGraph::Node::Kind::Silent;
+        }
+
+        if (auto const* scheduled_source_node = as_if<AudioScheduledSourceNode>(audio_node)) {
+            // Source nodes have no inputs, and a single mono output.
+            node.channel_count = 1;
+            node.start_time = scheduled_source_node->start_time();
+            node.stop_time = scheduled_source_node->stop_time();
+            if (node.start_time.has_value() && node.kind != RenderGraph::Node::Kind::Silent)
+                m_graph.m_has_scheduled_sources = true;
+        }
+
+        node.output.resize(node.channel_count * render_quantum_size);
+
+        auto index = m_graph.m_nodes.size();
+        m_graph.m_node_index_by_id.set(node.id, index);
+        m_graph.m_nodes.append(move(node));
+        m_node_indices.set(&audio_node, index);
+        return index;
+    }
+
+private:
+    size_t compile_param(AudioParam const& audio_param)
+    {
+        RenderGraph::Param param;
+        param.id = bit_cast<RenderParamID>(&audio_param);
+        param.value = audio_param.value();
+        param.min_value = audio_param.min_value();
+        param.max_value = audio_param.max_value();
+
+        for (auto const& input : audio_param.input_nodes()) {
+            if (auto input_index = compile_node(*input); input_index.has_value())
+                param.input_nodes.append(*input_index);
+        }
+
+        auto index = m_graph.m_params.size();
+        m_graph.m_param_index_by_id.set(param.id, index);
+        m_graph.m_params.append(move(param));
+        return index;
+    }
+
+    RenderGraph& m_graph;
+    HashMap<AudioNode const*, Optional<size_t>> m_node_indices;
+};
+
+NonnullOwnPtr<RenderGraph> RenderGraph::compile(AudioDestinationNode const& destination)
+{
+    auto graph = adopt_own(*new RenderGraph);
+    RenderGraphCompiler compiler { *graph };
+    (void)compiler.compile_node(destination);
+    return graph;
+}
+
+void RenderGraph::adopt_state_from(RenderGraph const& old_graph)
+{
+    for (auto& node : m_nodes) {
+        auto old_index = old_graph.m_node_index_by_id.get(node.id);
+        if (!old_index.has_value())
+            continue;
+        auto const& old_node = old_graph.m_nodes[*old_index];
+        node.phase = old_node.phase;
+        // NOTE: The filter memory only makes sense for the same channels, so it's dropped if the channel count changed.
+        if (node.biquad_states.size() == old_node.biquad_states.size()) {
+            for (size_t i = 0; i < node.biquad_states.size(); ++i)
+                node.biquad_states[i] = old_node.biquad_states[i];
+        }
+    }
+}
+
+void RenderGraph::set_param_value(RenderParamID id, float value)
+{
+    if (auto index = m_param_index_by_id.get(id); index.has_value())
+        m_params[*index].value = value;
+}
+
+// https://webaudio.github.io/web-audio-api/#channel-up-mixing-and-down-mixing
+static void mix_channels_into(Span<float> destination, size_t destination_channel_count, Span<float const> source, size_t source_channel_count)
+{
+    auto channel = [](auto span, size_t index) { return span.slice(index * render_quantum_size, render_quantum_size); };
+
+    if (source_channel_count == destination_channel_count) {
+        Audio::add(destination.trim(destination_channel_count * render_quantum_size), source.trim(source_channel_count * render_quantum_size));
+    } else if (source_channel_count == 1 && destination_channel_count == 2) {
+        // Mono up-mix: output.L = input; output.R = input;
+        Audio::add(channel(destination, 0), channel(source, 0));
+        Audio::add(channel(destination, 1), channel(source, 0));
+    } else if (source_channel_count == 2 && destination_channel_count == 1) {
+        // Mono down-mix: output = 0.5 * (input.L + input.R);
+        Audio::add_scaled(channel(destination, 0), channel(source, 0), 0.5f);
+        Audio::add_scaled(channel(destination, 0), channel(source, 1), 0.5f);
+    } else {
+        // FIXME: Implement the remaining speaker layouts. For now, mix them like discrete channels.
+        for (size_t i = 0; i < min(source_channel_count, destination_channel_count); ++i)
+            Audio::add(channel(destination, i), channel(source, i));
+    }
+}
+
+void RenderGraph::mix_inputs_into_output(Node& node)
+{
+    for (auto input_index : node.input_nodes) {
+        auto const& input = m_nodes[input_index];
+        mix_channels_into(node.output.span(), node.channel_count, input.output.span(), input.channel_count);
+    }
+}
+
+void RenderGraph::compute_param_values(Param& param)
+{
+    // https://webaudio.github.io/web-audio-api/#computation-of-value
+    // FIXME: Apply automation events.
+    param.values.fill(param.value);
+
+    for (auto input_index : param.input_nodes) {
+        auto const& input = m_nodes[input_index];
+        // The output of the connected nodes is down-mixed to mono and added to the value.
+        Array<float, render_quantum_size> mono {};
+        mix_channels_into(mono.span(), 1, input.output.span(), input.channel_count);
+        Audio::add(param.values.span(), mono.span());
+    }
+
+    Audio::clamp(param.values.span(), param.min_value, param.max_value);
+}
+
+// https://webaudio.github.io/web-audio-api/#filters-characteristics
+static Audio::BiquadCoefficients biquad_coefficients(Bindings::BiquadFilterType type, float frequency, float detune, float q, float gain, float sample_rate)
+{
+    auto computed_frequency = static_cast<double>(frequency) * AK::pow(2.0, static_cast<double>(detune) / 1200.0);
+    auto big_g = static_cast<double>(gain);
+    auto big_q = static_cast<double>(q);
+
+    auto a = AK::pow(10.0, big_g / 40.0);
+    auto omega_0 = 2 * AK::Pi<double> * computed_frequency / static_cast<double>(sample_rate);
+    auto sin_omega_0 = AK::sin(omega_0);
+    auto cos_omega_0 = AK::cos(omega_0);
+    auto alpha_q = sin_omega_0 / (2 * big_q);
+    auto alpha_q_db = sin_omega_0 / (2 * AK::pow(10.0, big_q / 20.0));
+    // NOTE: The shelf slope S is always 1, which turns the square root in the definition of alpha_S into sqrt(2).
+    auto alpha_s = sin_omega_0 / 2 * AK::sqrt(2.0);
+    auto two_sqrt_a_alpha_s = 2 * AK::sqrt(a) * alpha_s;
+
+    double b0 = 1, b1 = 0, b2 = 0, a0 = 1, a1 = 0, a2 = 0;
+    switch (type) {
+    case Bindings::BiquadFilterType::Lowpass:
+        b0 = (1 - cos_omega_0) / 2;
+        b1 = 1 - cos_omega_0;
+        b2 = (1 - cos_omega_0) / 2;
+        a0 = 1 + alpha_q_db;
+        a1 = -2 * cos_omega_0;
+        a2 = 1 - alpha_q_db;
+        break;
+    case Bindings::BiquadFilterType::Highpass:
+        b0 = (1 + cos_omega_0) / 2;
+        b1 = -(1 + cos_omega_0);
+        b2 = (1 + cos_omega_0) / 2;
+        a0 = 1 + alpha_q_db;
+        a1 = -2 * cos_omega_0;
+        a2 = 1 - alpha_q_db;
+        break;
+    case Bindings::BiquadFilterType::Bandpass:
+        b0 = alpha_q;
+        b1 = 0;
+        b2 = -alpha_q;
+        a0 = 1 + alpha_q;
+        a1 = -2 * cos_omega_0;
+        a2 = 1 - alpha_q;
+        break;
+    case Bindings::BiquadFilterType::Notch:
+        b0 = 1;
+        b1 = -2 * cos_omega_0;
+        b2 = 1;
+        a0 = 1 + alpha_q;
+        a1 = -2 * cos_omega_0;
+        a2 = 1 - alpha_q;
+        break;
+    case Bindings::BiquadFilterType::Allpass:
+        b0 = 1 - alpha_q;
+        b1 = -2 * cos_omega_0;
+        b2 = 1 + alpha_q;
+        a0 = 1 + alpha_q;
+        a1 = -2 * cos_omega_0;
+        a2 = 1 - alpha_q;
+        break;
+    case Bindings::BiquadFilterType::Peaking:
+        b0 = 1 + alpha_q * a;
+        b1 = -2 * cos_omega_0;
+        b2 = 1 - alpha_q * a;
+        a0 = 1 + alpha_q / a;
+        a1 = -2 * cos_omega_0;
+        a2 = 1 - alpha_q / a;
+        break;
+    case Bindings::BiquadFilterType::Lowshelf:
+        b0 = a * ((a + 1) - (a - 1) * cos_omega_0 + two_sqrt_a_alpha_s);
+        b1 = 2 * a * ((a - 1) - (a + 1) * cos_omega_0);
+        b2 = a * ((a + 1) - (a - 1) * cos_omega_0 - two_sqrt_a_alpha_s);
+        a0 = (a + 1) + (a - 1) * cos_omega_0 + two_sqrt_a_alpha_s;
+        a1 = -2 * ((a - 1) + (a + 1) * cos_omega_0);
+        a2 = (a + 1) + (a - 1) * cos_omega_0 - two_sqrt_a_alpha_s;
+        break;
+    case Bindings::BiquadFilterType::Highshelf:
+        b0 = a * ((a + 1) + (a - 1) * cos_omega_0 + two_sqrt_a_alpha_s);
+        b1 = -2 * a * ((a - 1) + (a + 1) * cos_omega_0);
+        b2 = a * ((a + 1) + (a - 1) * cos_omega_0 - two_sqrt_a_alpha_s);
+        a0 = (a + 1) - (a - 1) * cos_omega_0 + two_sqrt_a_alpha_s;
+        a1 = 2 * ((a - 1) - (a + 1) * cos_omega_0);
+        a2 = (a + 1) - (a - 1) * cos_omega_0 - two_sqrt_a_alpha_s;
+        break;
+    }
+
+    Audio::BiquadCoefficients coefficients {
+        .b0 = static_cast<float>(b0 / a0),
+        .b1 = static_cast<float>(b1 / a0),
+        .b2 = static_cast<float>(b2 / a0),
+        .a1 = static_cast<float>(a1 / a0),
+        .a2 = static_cast<float>(a2 / a0),
+    };
+
+    // FIXME: Implement the special cases the spec describes for frequencies of 0 and the Nyquist frequency, and for
+    //        a Q of 0. Until then, pass the signal through unchanged instead of filling the filter memory with NaNs.
+    if (!isfinite(coefficients.b0) || !isfinite(coefficients.b1) || !isfinite(coefficients.b2) || !isfinite(coefficients.a1) || !isfinite(coefficients.a2))
+        return {};
+    return coefficients;
+}
+
+static float oscillator_sample(Bindings::OscillatorType type, double phase)
+{
+    // NOTE: All waveforms start at zero, and rise towards their maximum during the first quarter of their period.
+    // FIXME: The non-sine waveforms should be band-limited to avoid aliasing.
+    switch (type) {
+    case Bindings::OscillatorType::Sine:
+        return static_cast<float>(AK::sin(2 * AK::Pi<double> * phase));
+    case Bindings::OscillatorType::Square:
+        return phase < 0.5 ? 1.0f : -1.0f;
+    case Bindings::OscillatorType::Sawtooth: {
+        auto shifted_phase = phase + 0.5;
+        return static_cast<float>(2 * (shifted_phase - AK::floor(shifted_phase)) - 1);
+    }
+    case Bindings::OscillatorType::Triangle: {
+        auto shifted_phase = phase + 0.25;
+        return static_cast<float>(1 - 4 * AK::fabs(shifted_phase - AK::floor(shifted_phase) - 0.5));
+    }
+    case Bindings::OscillatorType::Custom:
+        break;
+    }
+    return 0;
+}
+
+void RenderGraph::render_node(Node& node, u64 first_frame, float sample_rate)
+{
+    node.output.fill(0);
+
+    for (auto param_index : node.params)
+        compute_param_values(m_params[param_index]);
+
+    auto is_playing_at = [&](size_t frame_in_quantum) {
+        if (!node.start_time.has_value())
+            return false;
+        auto time = static_cast<double>(first_frame + frame_in_quantum) / sample_rate;
+        return time >= *node.start_time && (!node.stop_time.has_value() || time < *node.stop_time);
+    };
+
+    switch (node.kind) {
+    case Node::Kind::Destination:
+        mix_inputs_into_output(node);
+        break;
+    case Node::Kind::Gain: {
+        mix_inputs_into_output(node);
+        auto const& gain = m_params[node.params[0]].values;
+        for (size_t channel = 0; channel < node.channel_count; ++channel)
+            Audio::multiply(node.output_channel(channel), gain.span());
+        break;
+    }
+    case Node::Kind::BiquadFilter: {
+        mix_inputs_into_output(node);
+        // FIXME: The params are a-rate, so the coefficients should be computed for every frame their values change in.
+        //        We only compute them once per render quantum, as if they were k-rate.
+        auto coefficients = biquad_coefficients(node.biquad_filter_type,
+            m_params[node.params[0]].values[0],
+            m_params[node.params[1]].values[0],
+            m_params[node.params[2]].values[0],
+            m_params[node.params[3]].values[0],
+            sample_rate);
+        for (size_t channel = 0; channel < node.channel_count; ++channel)
+            Audio::process_biquad_cascade(node.output_channel(channel), { &coefficients, 1 }, node.biquad_states.span().slice(channel, 1));
+        break;
+    }
+    case Node::Kind::Oscillator: {
+        // https://webaudio.github.io/web-audio-api/#dom-oscillatornode-frequency
+        auto const& frequency = m_params[node.params[0]].values;
+        auto const& detune = m_params[node.params[1]].values;
+        auto samples = node.output_channel(0);
+        for (size_t i = 0; i < render_quantum_size; ++i) {
+            if (!is_playing_at(i))
+                continue;
+            samples[i] = oscillator_sample(node.oscillator_type, node.phase);
+            auto computed_frequency = frequency[i] * AK::pow(2.0, detune[i] / 1200.0);
+            node.phase += computed_frequency / sample_rate;
+            node.phase -= AK::floor(node.phase);
+        }
+        break;
+    }
+    case Node::Kind::ConstantSource: {
+        auto const& offset = m_params[node.params[0]].values;
+        auto samples = node.output_channel(0);
+        for (size_t i = 0; i < render_quantum_size; ++i) {
+            if (is_playing_at(i))
+                samples[i] = offset[i];
+        }
+        break;
+    }
+    case Node::Kind::Silent:
+        break;
+    }
+}
+
+void RenderGraph::render_quantum(u64 first_frame, float sample_rate, Span<float> output)
+{
+    VERIFY(output.size() == render_quantum_size * 2);
+
+    for (auto& node : m_nodes)
+        render_node(node, first_frame, sample_rate);
+
+    // The destination is compiled last, as everything else is one of its (indirect) inputs.
+    Array<float, render_quantum_size * 2> stereo {};
+    if (!m_nodes.is_empty()) {
+        auto const& destination = m_nodes.last();
+        mix_channels_into(stereo.span(), 2, destination.output.span(), destination.channel_count);
+    }
+
+    Audio::interleave_stereo(stereo.span().trim(render_quantum_size), stereo.span().slice(render_quantum_size), output);
+}
+
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibMedia/Audio/DSP.h>
+#include <LibWeb/Bindings/BiquadFilterNodePrototype.h>
+#include <LibWeb/Bindings/OscillatorNodePrototype.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::WebAudio {
+
+// https://webaudio.github.io/web-audio-api/#render-quantum-size
+static constexpr size_t render_quantum_size = 128;
+
+// Render nodes and params are identified by the address of the AudioNode or AudioParam they were compiled from.
+using RenderNodeID = FlatPtr;
+using RenderParamID = FlatPtr;
+
+// A snapshot of the part of an audio graph that is connected to its destination, compiled into a form that can be
+// rendered without touching any GC objects. It is built on the control thread and then handed to the rendering thread,
+// which is the only one to touch it from then on, and which never allocates while rendering it.
+class RenderGraph {
+public:
+    static NonnullOwnPtr<RenderGraph> compile(AudioDestinationNode const&);
+
+    // Whether anything in the graph will ever produce sound, i.e. whether it's worth keeping an output device open.
+    bool has_scheduled_sources() const { return m_has_scheduled_sources; }
+
+    // The rest must only be called from the rendering thread.
+
+    // Carries over the state of the nodes that are still part of the graph, like the phase of oscillators.
+    void adopt_state_from(RenderGraph const&);
+
+    void set_param_value(RenderParamID, float);
+
+    // Renders the render quantum starting at the given frame, and writes it to the output as interleaved stereo.
+    void render_quantum(u64 first_frame, float sample_rate, Span<float> output);
+
+private:
+    friend class RenderGraphCompiler;
+
+    struct Param {
+        RenderParamID id { 0 };
+        float value { 0 };
+        float min_value { 0 };
+        float max_value { 0 };
+        // Nodes whose output is added to the value of the param.
+        Vector<size_t> input_nodes;
+        Array<float, render_quantum_size> values {};
+    };
+
+    struct Node {
+        enum class Kind : u8 {
+            Destination,
+            Gain,
+            BiquadFilter,
+            Oscillator,
+            ConstantSource,
+            // Nodes that we can't render yet. They produce silence.
+            Silent,
+        };
+
+        RenderNodeID id { 0 };
+        Kind kind { Kind::Silent };
+        size_t channel_count { 1 };
+        Vector<size_t> input_nodes;
+        Vector<size_t> params;
+
+        Bindings::OscillatorType oscillator_type { Bindings::OscillatorType::Sine };
+        Bindings::BiquadFilterType biquad_filter_type { Bindings::BiquadFilterType::Lowpass };
+
+        // Scheduled source nodes only produce output in [start_time, stop_time).
+        Optional<double> start_time;
+        Optional<double> stop_time;
+
+        // State that survives recompiling the graph.
+        double phase { 0 };
+        // One per output channel, allocated up front so that rendering never has to.
+        Vector<Audio::BiquadState> biquad_states;
+
+        // channel_count channels of render_quantum_size frames each.
+        Vector<float> output;
+
+        Span<float> output_channel(size_t channel) { return output.span().slice(channel * render_quantum_size, render_quantum_size); }
+        Span<float const> output_channel(size_t channel) const { return output.span().slice(channel * render_quantum_size, render_quantum_size); }
+    };
+
+    RenderGraph() = default;
+
+    void mix_inputs_into_output(Node&);
+    void compute_param_values(Param&);
+    void render_node(Node&, u64 first_frame, float sample_rate);
+
+    // Nodes are in rendering order, so the inputs of a node (and of its params) always come before the node itself.
+    Vector<Node> m_nodes;
+    Vector<Param> m_params;
+    HashMap<RenderNodeID, size_t> m_node_index_by_id;
+    HashMap<RenderParamID, size_t> m_param_index_by_id;
+    bool m_has_scheduled_sources { false };
+};
+
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <LibWeb/WebAudio/RenderingThread.h>
+
+namespace Web::WebAudio {
+
+NonnullRefPtr<RenderingThread> RenderingThread::create(float sample_rate)
+{
+    return adopt_ref(*new RenderingThread(sample_rate));
+}
+
+RenderingThread::RenderingThread(float sample_rate)
+    : m_sample_rate(sample_rate)
+{
+}
+
+RenderingThread::~RenderingThread() = default;
+
+bool RenderingThread::replace_graph(NonnullOwnPtr<RenderGraph> graph)
+{
+    return m_control_messages.try_enqueue(ReplaceGraph { move(graph) });
+}
+
+bool RenderingThread::set_param_value(RenderParamID id, float value)
+{
+    return m_control_messages.try_enqueue(SetParamValue { id, value });
+}
+
+void RenderingThread::collect_retired_graphs()
+{
+    while (m_retired_graphs.try_dequeue().has_value())
+        ;
+}
+
+void RenderingThread::process_control_messages()
+{
+    // NOTE: If the control thread hasn't collected the graphs we retired in a while, we leave the remaining messages in
+    //       the queue until it has. That's better than freeing them here.
+    while (!m_retired_graphs.is_full()) {
+        auto message = m_control_messages.try_dequeue();
+        if (!message.has_value())
+            return;
+
+        message->visit(
+            [&](ReplaceGraph& replace_graph) {
+                if (m_graph)
+                    replace_graph.graph->adopt_state_from(*m_graph);
+                auto old_graph = exchange(m_graph, move(replace_graph.graph));
+                if (old_graph) {
+                    auto was_retired = m_retired_graphs.try_enqueue(move(old_graph));
+                    VERIFY(was_retired);
+                }
+            },
+            [&](SetParamValue const& set_param_value) {
+                if (m_graph)
+                    m_graph->set_param_value(set_param_value.id, set_param_value.value);
+            });
+    }
+}
+
+ReadonlyBytes RenderingThread::render(Bytes buffer, Audio::PcmSampleFormat format, size_t sample_count)
+{
+    VERIFY(format == Audio::PcmSampleFormat::Float32);
+
+    process_control_messages();
+
+    FixedMemoryStream stream { buffer };
+    for (size_t frame = 0; frame < sample_count; ++frame) {
+        if (m_frames_left_in_quantum == 0) {
+            auto first_frame = m_rendered_frame_count.load(AK::MemoryOrder::memory_order_relaxed);
+            if (m_graph)
+                m_graph->render_quantum(first_frame, m_sample_rate, m_quantum.span());
+            else
+                m_quantum.fill(0);
+            m_rendered_frame_count.store(first_frame + render_quantum_size, AK::MemoryOrder::memory_order_relaxed);
+            m_frames_left_in_quantum = render_quantum_size;
+        }
+
+        auto index = (render_quantum_size - m_frames_left_in_quantum) * output_channel_count;
+        for (size_t channel = 0; channel < output_channel_count; ++channel) {
+            if (stream.write_value(m_quantum[index + channel]).is_error())
+                return buffer.trim(stream.offset());
+        }
+        --m_frames_left_in_quantum;
+    }
+
+    return buffer.trim(stream.offset());
+}
+
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/OwnPtr.h>
+#include <AK/SPSCQueue.h>
+#include <AK/Variant.h>
+#include <LibMedia/Audio/SampleFormats.h>
+#include <LibWeb/WebAudio/RenderGraph.h>
+
+namespace Web::WebAudio {
+
+// https://webaudio.github.io/web-audio-api/#rendering-thread
+// The rendering side of an AudioContext. Its render() is called by the audio output stream's real-time thread, and
+// pulls render quanta out of the most recent RenderGraph the control thread sent it. The two threads only talk through
+// wait-free queues, so the control thread being busy never makes the audio glitch, and the rendering thread never
+// takes a lock or allocates.
+class RenderingThread final : public AtomicRefCounted<RenderingThread> {
+public:
+    static constexpr u8 output_channel_count = 2;
+
+    static NonnullRefPtr<RenderingThread> create(float sample_rate);
+    ~RenderingThread();
+
+    // These must only be called from the control thread. They return false if the rendering thread is too far behind
+    // to accept the message right now.
+    [[nodiscard]] bool replace_graph(NonnullOwnPtr<RenderGraph>);
+    [[nodiscard]] bool set_param_value(RenderParamID, float);
+
+    // Frees the graphs that the rendering thread no longer uses. Must only be called from the control thread.
+    void collect_retired_graphs();
+
+    // The number of frames rendered so far, which is what the context's currentTime is based on.
+    u64 rendered_frame_count() const { return m_rendered_frame_count.load(AK::MemoryOrder::memory_order_relaxed); }
+
+    // Must only be called from the rendering thread.
+    ReadonlyBytes render(Bytes buffer, Audio::PcmSampleFormat, size_t sample_count);
+
+private:
+    explicit RenderingThread(float sample_rate);
+
+    struct ReplaceGraph {
+        OwnPtr<RenderGraph> graph;
+    };
+    struct SetParamValue {
+        RenderParamID id;
+        float value;
+    };
+    using ControlMessage = Variant<ReplaceGraph, SetParamValue>;
+
+    void process_control_messages();
+
+    static constexpr size_t control_message_queue_capacity = 256;
+
+    SPSCQueue<ControlMessage, control_message_queue_capacity> m_control_messages;
+    // NOTE: Graphs are never freed on the rendering thread, but returned to the control thread through this queue.
+    SPSCQueue<OwnPtr<RenderGraph>, control_message_queue_capacity> m_retired_graphs;
+
+    float const m_sample_rate;
+    Atomic<u64> m_rendered_frame_count { 0 };
+
+    // Only touched by the rendering thread.
+    OwnPtr<RenderGraph> m_graph;
+    Array<float, render_quantum_size * output_channel_count> m_quantum {};
+    size_t m_frames_left_in_quantum { 0 };
+};
+
+}
@@ -11,6 +11,7 @@
 enum class ResponseType : u8 {
     Success,
     Error,
+    Pending,
 };
 
 namespace Web::WebDriver {
@@ -31,7 +32,10 @@ template<>
 ErrorOr<void> IPC::encode(Encoder& encoder, Web::WebDriver::Response const& response)
 {
     return response.visit(
-        [](Empty) -> ErrorOr<void> { VERIFY_NOT_REACHED(); },
+        [&](Empty) -> ErrorOr<void> {
+            TRY(encoder.encode(ResponseType::Pending));
+            return {};
+        },
         [&](JsonValue const& value) -> ErrorOr<void> {
             TRY(encoder.encode(ResponseType::Success));
             TRY(encoder.encode(value));
@@ -64,6 +68,9 @@ ErrorOr<Web::WebDriver::Response> IPC::decode(Decoder& decoder)
 
         return Web::WebDriver::Error { http_status, move(error), move(message), move(data) };
     }
+
+    case ResponseType::Pending:
+        return Web::WebDriver::Response {};
     }
 
     VERIFY_NOT_REACHED();
@@ -28,6 +28,9 @@ struct [[nodiscard]] Response {
 
     bool is_error() const { return m_value_or_error.template has<Error>(); }
 
+    // A default-constructed response stands for a result that isn't available yet, and will be delivered separately.
+    bool is_pending() const { return m_value_or_error.template has<Empty>(); }
+
     JsonValue release_value() { return move(value()); }
     Error release_error() { return move(error()); }
 
@@ -38,7 +41,7 @@ struct [[nodiscard]] Response {
     }
 
 private:
-    // Note: Empty is only a possible state until the Response has been decoded by IPC.
+    // Note: Empty is the state of a pending response, and of any response until it has been decoded by IPC.
     Variant<Empty, JsonValue, Error> m_value_or_error;
 };
 
@@ -39,6 +39,24 @@ struct OpenGLContext::Impl {
 #endif
 };
 
+#ifdef AK_OS_MACOS
+// The context and surface that were last made current on this thread.
+static thread_local EGLContext s_current_context { EGL_NO_CONTEXT };
+static thread_local EGLSurface s_current_surface { EGL_NO_SURFACE };
+
+static void make_egl_context_current(EGLDisplay display, EGLSurface surface, EGLContext context)
+{
+    // OPTIMIZATION: Every WebGL call makes its context current before doing anything else, but eglMakeCurrent() goes
+    //               through the driver even if nothing changes. As this is the only place that switches contexts, we
+    //               can skip the call when the same context and surface are already current.
+    if (s_current_context == context && s_current_surface == surface)
+        return;
+    eglMakeCurrent(display, surface, surface, context);
+    s_current_context = context;
+    s_current_surface = surface;
+}
+#endif
+
 OpenGLContext::OpenGLContext(NonnullRefPtr<Gfx::SkiaBackendContext> skia_backend_context, Impl impl, WebGLVersion webgl_version)
     : m_skia_backend_context(move(skia_backend_context))
     , m_impl(make<Impl>(impl))
@@ -49,7 +67,7 @@ OpenGLContext::OpenGLContext(NonnullRefPtr<Gfx::SkiaBackendContext> skia_backend
 OpenGLContext::~OpenGLContext()
 {
 #ifdef AK_OS_MACOS
-    eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    make_egl_context_current(m_impl->display, EGL_NO_SURFACE, EGL_NO_CONTEXT);
     glDeleteFramebuffers(1, &m_impl->framebuffer);
     glDeleteRenderbuffers(1, &m_impl->depth_buffer);
     eglDestroyContext(m_impl->display, m_impl->context);
@@ -206,7 +224,7 @@ void OpenGLContext::allocate_painting_surface_if_needed()
     };
     m_impl->surface = eglCreatePbufferFromClientBuffer(display, EGL_IOSURFACE_ANGLE, iosurface.core_foundation_pointer(), config, surface_attributes);
 
-    eglMakeCurrent(m_impl->display, m_impl->surface, m_impl->surface, m_impl->context);
+    make_egl_context_current(m_impl->display, m_impl->surface, m_impl->context);
 
     EGLint texture_target_name = 0;
     eglGetConfigAttrib(display, config, EGL_BIND_TO_TEXTURE_TARGET_ANGLE, &texture_target_name);
@@ -245,7 +263,7 @@ void OpenGLContext::make_current()
 {
 #ifdef AK_OS_MACOS
     allocate_painting_surface_if_needed();
-    eglMakeCurrent(m_impl->display, m_impl->surface, m_impl->surface, m_impl->context);
+    make_egl_context_current(m_impl->display, m_impl->surface, m_impl->context);
 #endif
 }
 
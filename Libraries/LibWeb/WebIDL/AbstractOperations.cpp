@@ -8,11 +8,13 @@
 
 #include <AK/ByteBuffer.h>
 #include <AK/Enumerate.h>
+#include <AK/FlyString.h>
 #include <AK/NumericLimits.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/DataView.h>
 #include <LibJS/Runtime/FunctionObject.h>
+#include <LibJS/Runtime/PrimitiveString.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/ValueInlines.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
@@ -234,6 +236,15 @@ JS::ThrowCompletionOr<String> to_string(JS::VM& vm, JS::Value value)
     return value.to_string(vm);
 }
 
+JS::ThrowCompletionOr<FlyString> to_fly_string(JS::VM& vm, JS::Value value)
+{
+    // OPTIMIZATION: Arguments that are already strings are interned in place, so that passing the same JS string again
+    //               (e.g. a literal in a loop) doesn't have to look it up in the FlyString table every time.
+    if (value.is_string())
+        return value.as_string().utf8_fly_string();
+    return FlyString { TRY(value.to_string(vm)) };
+}
+
 JS::ThrowCompletionOr<String> to_usv_string(JS::VM& vm, JS::Value value)
 {
     return value.to_well_formed_string(vm);
@@ -206,7 +206,7 @@ ErrorOr<void> WebSocket::establish_web_socket_connection(URL::URL const& url_rec
             return String {};
 
         // NOTE: The WebSocket handshake is sent as an HTTP request, so the source should be Http.
-        return document->page().client().page_did_request_cookie(url_record, Cookie::Source::Http);
+        return document->page().client().page_did_request_cookie(url_record, Cookie::Source::Http).value;
     })();
 
     if (!cookies.is_empty()) {
@@ -26,8 +26,13 @@ public:
 
     IPC::File clone_transport();
 
+    pid_t pid() const { return m_pid; }
+    void set_pid(pid_t pid) { m_pid = pid; }
+
 private:
     virtual void die() override;
+
+    pid_t m_pid { -1 };
 };
 
 }
@@ -259,6 +259,7 @@ libweb_js_bindings(HTML/ToggleEvent)
 libweb_js_bindings(HTML/TrackEvent)
 libweb_js_bindings(HTML/UserActivation)
 libweb_js_bindings(HTML/ValidityState)
+libweb_js_bindings(HTML/VideoPlaybackQuality)
 libweb_js_bindings(HTML/VideoTrack)
 libweb_js_bindings(HTML/VideoTrackList)
 libweb_js_bindings(HTML/Window GLOBAL)
@@ -304,6 +305,8 @@ libweb_js_bindings(ResizeObserver/ResizeObserver)
 libweb_js_bindings(ResizeObserver/ResizeObserverEntry)
 libweb_js_bindings(ResizeObserver/ResizeObserverSize)
 libweb_js_bindings(ResourceTiming/PerformanceResourceTiming)
+libweb_js_bindings(Scheduling/Scheduler)
+libweb_js_bindings(ServiceWorker/Cache)
 libweb_js_bindings(ServiceWorker/CacheStorage)
 libweb_js_bindings(ServiceWorker/ServiceWorker)
 libweb_js_bindings(ServiceWorker/ServiceWorkerContainer)
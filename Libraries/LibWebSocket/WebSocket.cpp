@@ -151,7 +151,28 @@ void WebSocket::drain_read()
         }
         auto bytes = result.release_value();
         m_buffered_data.append(bytes.data(), bytes.size());
-        read_frame();
+
+        if (m_buffered_data.size() < 2) {
+            // The connection got closed.
+            set_state(WebSocket::InternalState::Closed);
+            notify_close(m_last_close_code, m_last_close_message, true);
+            discard_connection();
+            return;
+        }
+
+        // OPTIMIZATION: A single read often contains many frames. Handle all of them now, rather than leaving them in
+        //               the buffer until the socket becomes readable again, and only drop the consumed bytes from the
+        //               buffer once at the end.
+        size_t cursor = 0;
+        while (m_buffered_data.size() - cursor >= 2 && (m_state == InternalState::Open || m_state == InternalState::Closing)) {
+            if (!read_frame(cursor))
+                break;
+        }
+
+        if (cursor == m_buffered_data.size())
+            m_buffered_data.clear_with_capacity();
+        else if (cursor != 0)
+            m_buffered_data.remove(0, cursor);
     } break;
     case InternalState::Closed:
     case InternalState::Errored: {
@@ -388,12 +409,12 @@ void WebSocket::read_server_handshake()
     // If needed, we will keep reading the header on the next drain_read call
 }
 
-void WebSocket::read_frame()
+bool WebSocket::read_frame(size_t& frame_start)
 {
     VERIFY(m_impl);
     VERIFY(m_state == WebSocket::InternalState::Open || m_state == WebSocket::InternalState::Closing);
 
-    size_t cursor = 0;
+    size_t cursor = frame_start;
     auto get_buffered_bytes = [&](size_t count) -> ReadonlyBytes {
         if (cursor + count > m_buffered_data.size())
             return {};
@@ -403,13 +424,8 @@ void WebSocket::read_frame()
     };
 
     auto head_bytes = get_buffered_bytes(2);
-    if (head_bytes.is_null() || head_bytes.is_empty()) {
-        // The connection got closed.
-        set_state(WebSocket::InternalState::Closed);
-        notify_close(m_last_close_code, m_last_close_message, true);
-        discard_connection();
-        return;
-    }
+    if (head_bytes.is_null() || head_bytes.is_empty())
+        return false;
 
     auto op_code = (WebSocket::OpCode)(head_bytes[0] & 0x0f);
     bool is_final_frame = head_bytes[0] & 0x80;
@@ -422,7 +438,7 @@ void WebSocket::read_frame()
         // A code of 127 means that the next 8 bytes contains the payload length
         auto actual_bytes = get_buffered_bytes(8);
         if (actual_bytes.is_null())
-            return;
+            return false;
         u64 full_payload_length = (u64)((u64)(actual_bytes[0] & 0xff) << 56)
             | (u64)((u64)(actual_bytes[1] & 0xff) << 48)
             | (u64)((u64)(actual_bytes[2] & 0xff) << 40)
@@ -437,7 +453,7 @@ void WebSocket::read_frame()
         // A code of 126 means that the next 2 bytes contains the payload length
         auto actual_bytes = get_buffered_bytes(2);
         if (actual_bytes.is_null())
-            return;
+            return false;
         payload_length = (size_t)((size_t)(actual_bytes[0] & 0xff) << 8)
             | (size_t)((size_t)(actual_bytes[1] & 0xff) << 0);
     } else {
@@ -454,7 +470,7 @@ void WebSocket::read_frame()
     if (is_masked) {
         auto masking_key_data = get_buffered_bytes(4);
         if (masking_key_data.is_null())
-            return;
+            return false;
         masking_key[0] = masking_key_data[0];
         masking_key[1] = masking_key_data[1];
         masking_key[2] = masking_key_data[2];
@@ -466,19 +482,13 @@ void WebSocket::read_frame()
     while (read_length < payload_length) {
         auto payload_part = get_buffered_bytes(payload_length - read_length);
         if (payload_part.is_null())
-            return;
+            return false;
         // We read at most "actual_length - read" bytes, so this is safe to do.
         payload.overwrite(read_length, payload_part.data(), payload_part.size());
         read_length += payload_part.size();
     }
 
-    if (cursor == m_buffered_data.size()) {
-        m_buffered_data.clear();
-    } else {
-        Vector<u8> new_buffered_data;
-        new_buffered_data.append(m_buffered_data.data() + cursor, m_buffered_data.size() - cursor);
-        m_buffered_data = move(new_buffered_data);
-    }
+    frame_start = cursor;
 
     if (is_masked) {
         // Unmask the payload
@@ -496,16 +506,16 @@ void WebSocket::read_frame()
             m_last_close_message = {};
         }
         close(m_last_close_code, m_last_close_message);
-        return;
+        return true;
     }
     if (op_code == WebSocket::OpCode::Ping) {
         // Immediately send a pong frame as a reply, with the given payload.
         send_frame(WebSocket::OpCode::Pong, payload, true);
-        return;
+        return true;
     }
     if (op_code == WebSocket::OpCode::Pong) {
         // We can safely ignore the pong
-        return;
+        return true;
     }
     if (!is_final_frame) {
         if (op_code != WebSocket::OpCode::Continuation) {
@@ -514,7 +524,7 @@ void WebSocket::read_frame()
         }
         // First and next fragmented message
         m_fragmented_data_buffer.append(payload.data(), payload_length);
-        return;
+        return true;
     }
     if (is_final_frame && op_code == WebSocket::OpCode::Continuation) {
         // Last fragmented message
@@ -526,13 +536,14 @@ void WebSocket::read_frame()
     }
     if (op_code == WebSocket::OpCode::Text) {
         notify_message(Message(move(payload), true));
-        return;
+        return true;
     }
     if (op_code == WebSocket::OpCode::Binary) {
         notify_message(Message(move(payload), false));
-        return;
+        return true;
     }
     dbgln("Websocket: Found unknown opcode {}", (u8)op_code);
+    return true;
 }
 
 void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, bool is_final)
@@ -89,7 +89,9 @@ private:
     void send_client_handshake();
     void read_server_handshake();
 
-    void read_frame();
+    // Reads the frame that starts at the given offset into the buffered data, and advances the offset past it. Returns
+    // false if the buffered data doesn't contain the whole frame yet.
+    bool read_frame(size_t& frame_start);
     void send_frame(OpCode, ReadonlyBytes, bool is_final);
 
     void notify_open();
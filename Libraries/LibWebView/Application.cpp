@@ -5,14 +5,22 @@
  */
 
 #include <AK/Debug.h>
+#include <AK/Time.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/Environment.h>
+#include <LibCore/File.h>
+#include <LibCore/Promise.h>
 #include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
+#include <LibCore/MemoryPressureWatcher.h>
 #include <LibCore/TimeZoneWatcher.h>
+#include <LibCore/Timer.h>
 #include <LibDevTools/DevToolsServer.h>
 #include <LibFileSystem/FileSystem.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/ImageFormats/PNGWriter.h>
 #include <LibImageDecoderClient/Client.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/CSS/PropertyID.h>
 #include <LibWebView/Application.h>
 #include <LibWebView/CookieJar.h>
@@ -96,6 +104,8 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     Optional<HeadlessMode> headless_mode;
     Optional<int> window_width;
     Optional<int> window_height;
+    Optional<double> device_pixel_ratio;
+    Optional<int> screenshot_compression_level;
     bool new_window = false;
     bool force_new_process = false;
     bool allow_popups = false;
@@ -115,11 +125,14 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     bool disable_site_isolation = false;
     bool enable_idl_tracing = false;
     bool enable_http_cache = false;
+    bool enable_http_disk_cache = false;
+    bool enable_web_content_zygote = false;
     bool enable_autoplay = false;
     bool expose_internals_object = false;
     bool force_cpu_painting = false;
     bool force_fontconfig = false;
     bool collect_garbage_on_every_allocation = false;
+    bool track_allocation_sites = false;
     bool disable_scrollbar_painting = false;
 
     Core::ArgsParser args_parser;
@@ -148,6 +161,8 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
 
     args_parser.add_option(window_width, "Set viewport width in pixels (default: 800) (currently only supported for headless mode)", "window-width", 0, "pixels");
     args_parser.add_option(window_height, "Set viewport height in pixels (default: 600) (currently only supported for headless mode)", "window-height", 0, "pixels");
+    args_parser.add_option(device_pixel_ratio, "Set the device pixel ratio (default: 1) (currently only supported for headless mode)", "device-pixel-ratio", 0, "ratio");
+    args_parser.add_option(screenshot_compression_level, "Set the PNG compression level of screenshots, from 0 (uncompressed) to 9", "screenshot-compression-level", 0, "level");
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
     args_parser.add_option(new_window, "Force opening in a new window", "new-window", 'n');
     args_parser.add_option(force_new_process, "Force creation of a new browser process", "force-new-process");
@@ -162,11 +177,14 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(disable_site_isolation, "Disable site isolation", "disable-site-isolation");
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
     args_parser.add_option(enable_http_cache, "Enable HTTP cache", "enable-http-cache");
+    args_parser.add_option(enable_http_disk_cache, "Enable persistent HTTP disk cache", "enable-http-disk-cache");
+    args_parser.add_option(enable_web_content_zygote, "Fork WebContent processes from a pre-initialized one (Linux only)", "enable-web-content-zygote");
     args_parser.add_option(enable_autoplay, "Enable multimedia autoplay", "enable-autoplay");
     args_parser.add_option(expose_internals_object, "Expose internals object", "expose-internals-object");
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
     args_parser.add_option(collect_garbage_on_every_allocation, "Collect garbage after every JS heap allocation", "collect-garbage-on-every-allocation", 'g');
+    args_parser.add_option(track_allocation_sites, "Record the JS source location of every JS heap allocation in GC graph dumps", "track-allocation-sites");
     args_parser.add_option(disable_scrollbar_painting, "Don't paint horizontal or vertical scrollbars on the main viewport", "disable-scrollbar-painting");
     args_parser.add_option(dns_server_address, "Set the DNS server address", "dns-server", 0, "host|address");
     args_parser.add_option(dns_server_port, "Set the DNS server port", "dns-port", 0, "port (default: 53 or 853 if --dot)");
@@ -232,6 +250,8 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .allow_popups = allow_popups ? AllowPopups::Yes : AllowPopups::No,
         .disable_scripting = disable_scripting ? DisableScripting::Yes : DisableScripting::No,
         .disable_sql_database = disable_sql_database ? DisableSQLDatabase::Yes : DisableSQLDatabase::No,
+        .enable_http_disk_cache = enable_http_disk_cache ? EnableHTTPDiskCache::Yes : EnableHTTPDiskCache::No,
+        .enable_web_content_zygote = enable_web_content_zygote ? EnableWebContentZygote::Yes : EnableWebContentZygote::No,
         .debug_helper_process = move(debug_process_type),
         .profile_helper_process = move(profile_process_type),
         .dns_settings = (dns_server_address.has_value()
@@ -246,6 +266,9 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         m_browser_options.window_width = *window_width;
     if (window_height.has_value())
         m_browser_options.window_height = *window_height;
+    if (device_pixel_ratio.has_value())
+        m_browser_options.device_pixel_ratio = static_cast<float>(*device_pixel_ratio);
+    m_browser_options.screenshot_compression_level = screenshot_compression_level;
 
     if (webdriver_content_ipc_path.has_value())
         m_browser_options.webdriver_content_ipc_path = *webdriver_content_ipc_path;
@@ -264,6 +287,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .force_fontconfig = force_fontconfig ? ForceFontconfig::Yes : ForceFontconfig::No,
         .enable_autoplay = enable_autoplay ? EnableAutoplay::Yes : EnableAutoplay::No,
         .collect_garbage_on_every_allocation = collect_garbage_on_every_allocation ? CollectGarbageOnEveryAllocation::Yes : CollectGarbageOnEveryAllocation::No,
+        .track_allocation_sites = track_allocation_sites ? TrackAllocationSites::Yes : TrackAllocationSites::No,
         .paint_viewport_scrollbars = disable_scrollbar_painting ? PaintViewportScrollbars::No : PaintViewportScrollbars::Yes,
     };
 
@@ -287,8 +311,8 @@ static ErrorOr<NonnullRefPtr<WebContentClient>> create_web_content_client(Option
 
 ErrorOr<NonnullRefPtr<WebContentClient>> Application::launch_web_content_process(ViewImplementation& view)
 {
-    if (m_spare_web_content_process) {
-        auto web_content_client = m_spare_web_content_process.release_nonnull();
+    if (!m_spare_web_content_processes.is_empty()) {
+        auto web_content_client = m_spare_web_content_processes.take_first();
         launch_spare_web_content_process();
 
         web_content_client->assign_view({}, view);
@@ -310,8 +334,12 @@ void Application::launch_spare_web_content_process()
 
     if (m_has_queued_task_to_launch_spare_web_content_process)
         return;
+    if (m_spare_web_content_processes.size() >= spare_web_content_process_pool_size)
+        return;
     m_has_queued_task_to_launch_spare_web_content_process = true;
 
+    // NOTE: The pool is refilled one process per event loop iteration, so that launching it doesn't hold up whatever
+    //       claimed the last spare.
     Core::deferred_invoke([this]() {
         m_has_queued_task_to_launch_spare_web_content_process = false;
 
@@ -321,10 +349,59 @@ void Application::launch_spare_web_content_process()
             return;
         }
 
-        m_spare_web_content_process = web_content_client.release_value();
+        m_spare_web_content_processes.append(web_content_client.release_value());
+
+        if (auto process = find_process(m_spare_web_content_processes.last()->pid()); process.has_value())
+            process->set_title("(spare)"_string);
+
+        launch_spare_web_content_process();
+    });
+}
+
+ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> Application::launch_web_worker_process(Web::Bindings::AgentType type)
+{
+    if (type != Web::Bindings::AgentType::DedicatedWorker)
+        return WebView::launch_web_worker_process(type);
+
+    if (!m_spare_dedicated_worker_processes.is_empty()) {
+        auto web_worker_client = m_spare_dedicated_worker_processes.take_first();
+        launch_spare_dedicated_worker_process();
+        return web_worker_client;
+    }
+
+    launch_spare_dedicated_worker_process();
+    return WebView::launch_web_worker_process(type);
+}
+
+void Application::launch_spare_dedicated_worker_process()
+{
+    // Disable spare processes when debugging or profiling WebWorker, for the same reasons as for WebContent.
+    if (browser_options().debug_helper_process == ProcessType::WebWorker)
+        return;
+    if (browser_options().profile_helper_process == ProcessType::WebWorker)
+        return;
+
+    if (m_has_queued_task_to_launch_spare_dedicated_worker_process)
+        return;
+    if (m_spare_dedicated_worker_processes.size() >= spare_dedicated_worker_process_pool_size)
+        return;
+    m_has_queued_task_to_launch_spare_dedicated_worker_process = true;
+
+    Core::deferred_invoke([this]() {
+        m_has_queued_task_to_launch_spare_dedicated_worker_process = false;
+
+        auto web_worker_client = WebView::launch_web_worker_process(Web::Bindings::AgentType::DedicatedWorker);
+        if (web_worker_client.is_error()) {
+            dbgln("Unable to create spare web worker client: {}", web_worker_client.error());
+            return;
+        }
+
+        m_spare_dedicated_worker_processes.append(web_worker_client.release_value());
 
-        if (auto process = find_process(m_spare_web_content_process->pid()); process.has_value())
+        if (auto process = find_process(m_spare_dedicated_worker_processes.last()->pid()); process.has_value())
             process->set_title("(spare)"_string);
+
+        launch_spare_dedicated_worker_process();
     });
 }
 
@@ -346,6 +423,13 @@ ErrorOr<void> Application::launch_services()
         m_storage_jar = StorageJar::create();
     }
 
+    m_cookie_jar->on_cookies_changed = []() {
+        WebContentClient::for_each_client([&](WebView::WebContentClient& client) {
+            client.async_cookies_did_change();
+            return IterationDecision::Continue;
+        });
+    };
+
     // No need to monitor the system time zone if the TZ environment variable is set, as it overrides system preferences.
     if (!Core::Environment::has("TZ"sv)) {
         if (auto time_zone_watcher = Core::TimeZoneWatcher::create(); time_zone_watcher.is_error()) {
@@ -362,8 +446,19 @@ ErrorOr<void> Application::launch_services()
         }
     }
 
+    if (auto memory_pressure_watcher = Core::MemoryPressureWatcher::create(); memory_pressure_watcher.is_error()) {
+        warnln("Unable to monitor system memory pressure: {}", memory_pressure_watcher.error());
+    } else {
+        m_memory_pressure_watcher = memory_pressure_watcher.release_value();
+
+        m_memory_pressure_watcher->on_memory_pressure = [this](Core::MemoryPressureLevel level) {
+            handle_memory_pressure(level);
+        };
+    }
+
     TRY(launch_request_server());
     TRY(launch_image_decoder_server());
+    launch_web_content_zygote();
 
     if (m_browser_options.devtools_port.has_value())
         TRY(launch_devtools_server());
@@ -371,6 +466,66 @@ ErrorOr<void> Application::launch_services()
     return {};
 }
 
+void Application::handle_memory_pressure(Core::MemoryPressureLevel level)
+{
+    WebContentClient::for_each_client([&](WebView::WebContentClient& client) {
+        client.async_handle_memory_pressure(level);
+        return IterationDecision::Continue;
+    });
+
+    if (level != Core::MemoryPressureLevel::Critical || m_browser_options.headless_mode.has_value())
+        return;
+
+    auto now = MonotonicTime::now();
+    if (m_last_view_discard_time.has_value() && now - *m_last_view_discard_time < minimum_time_between_discarded_views)
+        return;
+
+    // Discard the view that has gone the longest without being looked at.
+    ViewImplementation* least_recently_visible_view = nullptr;
+
+    ViewImplementation::for_each_view([&](ViewImplementation& view) {
+        if (!view.can_be_discarded())
+            return IterationDecision::Continue;
+        if (!least_recently_visible_view || view.last_visible_time() < least_recently_visible_view->last_visible_time())
+            least_recently_visible_view = &view;
+        return IterationDecision::Continue;
+    });
+
+    if (!least_recently_visible_view)
+        return;
+
+    dbgln("Discarding {} due to critical memory pressure", least_recently_visible_view->url());
+    least_recently_visible_view->discard();
+
+    m_last_view_discard_time = now;
+}
+
+void Application::launch_web_content_zygote()
+{
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+    if (m_browser_options.enable_web_content_zygote == EnableWebContentZygote::No)
+        return;
+    // Processes forked from the zygote aren't started with the debugger or profiler wrapped around them.
+    if (m_browser_options.debug_helper_process == ProcessType::WebContent || m_browser_options.profile_helper_process == ProcessType::WebContent)
+        return;
+
+    auto zygote = launch_web_content_zygote_process();
+    if (zygote.is_error()) {
+        dbgln("Unable to launch WebContent zygote: {}", zygote.error());
+        return;
+    }
+
+    m_web_content_zygote = zygote.release_value();
+#endif
+}
+
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+void Application::discard_web_content_zygote()
+{
+    m_web_content_zygote.clear();
+}
+#endif
+
 ErrorOr<void> Application::launch_request_server()
 {
     // FIXME: Create an abstraction to re-spawn the RequestServer and re-hook up its client hooks to each tab on crash
@@ -445,6 +600,113 @@ static NonnullRefPtr<Core::Timer> load_page_for_screenshot_and_exit(Core::EventL
     return timer;
 }
 
+// Takes a screenshot of each of a queue of URLs. The URLs are loaded one after another in the same view, so they all
+// reuse its WebContent process instead of each paying for a new one. Each screenshot is encoded and written to disk on
+// a background thread while the next URL is loading.
+class ScreenshotBatch : public RefCounted<ScreenshotBatch> {
+public:
+    static NonnullRefPtr<ScreenshotBatch> create(Core::EventLoop& event_loop, HeadlessWebView& view, Vector<URL::URL> urls, int screenshot_timeout)
+    {
+        return adopt_ref(*new ScreenshotBatch(event_loop, view, move(urls), screenshot_timeout));
+    }
+
+    void start()
+    {
+        outln("Taking {} screenshots, {} seconds after loading each URL", m_urls.size(), m_screenshot_timeout);
+        load_next_url();
+    }
+
+private:
+    ScreenshotBatch(Core::EventLoop& event_loop, HeadlessWebView& view, Vector<URL::URL> urls, int screenshot_timeout)
+        : m_event_loop(event_loop)
+        , m_view(view)
+        , m_urls(move(urls))
+        , m_screenshot_timeout(screenshot_timeout)
+        , m_file_prefix(AK::UnixDateTime::now().to_byte_string("screenshot-%Y-%m-%d-%H-%M-%S"sv))
+    {
+    }
+
+    void load_next_url()
+    {
+        if (m_next_url_index == m_urls.size()) {
+            m_took_all_screenshots = true;
+            quit_if_finished();
+            return;
+        }
+
+        auto index = m_next_url_index++;
+
+        m_timer = Core::Timer::create_single_shot(m_screenshot_timeout * 1000, [this, index]() {
+            m_view.take_screenshot_bitmap()
+                ->when_resolved([this, index](auto const& bitmap) {
+                    save_screenshot(index, *bitmap);
+                    load_next_url();
+                })
+                .when_rejected([this, index](auto const& error) {
+                    warnln("Unable to take screenshot of {}: {}", m_urls[index], error);
+                    load_next_url();
+                });
+        });
+
+        m_view.load(m_urls[index]);
+        m_timer->start();
+    }
+
+    void save_screenshot(size_t index, Gfx::Bitmap const& bitmap)
+    {
+        auto path = Application::the().path_for_downloaded_file(ByteString::formatted("{}-{}.png", m_file_prefix, index + 1));
+        if (path.is_error()) {
+            warnln("Unable to save screenshot of {}: {}", m_urls[index], path.error());
+            return;
+        }
+
+        ++m_pending_saves;
+
+        (void)Threading::BackgroundAction<LexicalPath>::construct(
+            [bitmap = NonnullRefPtr { bitmap }, path = path.release_value()](auto&) -> ErrorOr<LexicalPath> {
+                auto encoded = TRY(Gfx::PNGWriter::encode(*bitmap, { .compression_level = Application::browser_options().screenshot_compression_level }));
+
+                auto file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
+                TRY(file->write_until_depleted(encoded));
+
+                return path;
+            },
+            [this](LexicalPath path) -> ErrorOr<void> {
+                outln("Saved screenshot to: {}", path);
+                did_finish_saving_screenshot();
+                return {};
+            },
+            [this, url = m_urls[index]](Error error) {
+                warnln("Unable to save screenshot of {}: {}", url, error);
+                did_finish_saving_screenshot();
+            });
+    }
+
+    void did_finish_saving_screenshot()
+    {
+        --m_pending_saves;
+        quit_if_finished();
+    }
+
+    void quit_if_finished()
+    {
+        if (m_took_all_screenshots && m_pending_saves == 0)
+            m_event_loop.quit(0);
+    }
+
+    Core::EventLoop& m_event_loop;
+    HeadlessWebView& m_view;
+
+    Vector<URL::URL> m_urls;
+    size_t m_next_url_index { 0 };
+    size_t m_pending_saves { 0 };
+    bool m_took_all_screenshots { false };
+
+    int m_screenshot_timeout { 0 };
+    ByteString m_file_prefix;
+    RefPtr<Core::Timer> m_timer;
+};
+
 static void load_page_for_info_and_exit(Core::EventLoop& event_loop, HeadlessWebView& view, URL::URL const& url, WebView::PageInfoType type)
 {
     view.on_load_finish = [&view, &event_loop, url, type](auto const& loaded_url) {
@@ -464,20 +726,35 @@ ErrorOr<int> Application::execute()
 {
     OwnPtr<HeadlessWebView> view;
     RefPtr<Core::Timer> screenshot_timer;
+    RefPtr<ScreenshotBatch> screenshot_batch;
 
     if (m_browser_options.headless_mode.has_value()) {
         auto theme_path = LexicalPath::join(WebView::s_ladybird_resource_root, "themes"sv, "Default.ini"sv);
         auto theme = TRY(Gfx::load_system_theme(theme_path.string()));
 
-        view = HeadlessWebView::create(move(theme), { m_browser_options.window_width, m_browser_options.window_height });
+        // The window size is given in CSS pixels, so the view has to be scaled up to keep the same layout viewport.
+        auto device_pixel_ratio = m_browser_options.device_pixel_ratio;
+        Web::DevicePixelSize viewport_size {
+            static_cast<int>(m_browser_options.window_width * device_pixel_ratio),
+            static_cast<int>(m_browser_options.window_height * device_pixel_ratio),
+        };
+
+        view = HeadlessWebView::create(move(theme), viewport_size);
+        if (device_pixel_ratio != 1.0f)
+            view->set_device_pixel_ratio(device_pixel_ratio);
 
         if (!m_browser_options.webdriver_content_ipc_path.has_value()) {
-            if (m_browser_options.urls.size() != 1)
-                return Error::from_string_literal("Headless mode currently only supports exactly one URL");
+            if (m_browser_options.urls.is_empty() || (m_browser_options.urls.size() != 1 && *m_browser_options.headless_mode != HeadlessMode::Screenshot))
+                return Error::from_string_literal("Headless mode currently only supports exactly one URL, except for screenshots");
 
             switch (*m_browser_options.headless_mode) {
             case HeadlessMode::Screenshot:
-                screenshot_timer = load_page_for_screenshot_and_exit(*m_event_loop, *view, m_browser_options.urls.first(), 1);
+                if (m_browser_options.urls.size() == 1) {
+                    screenshot_timer = load_page_for_screenshot_and_exit(*m_event_loop, *view, m_browser_options.urls.first(), 1);
+                } else {
+                    screenshot_batch = ScreenshotBatch::create(*m_event_loop, *view, m_browser_options.urls, 1);
+                    screenshot_batch->start();
+                }
                 break;
             case HeadlessMode::LayoutTree:
                 load_page_for_info_and_exit(*m_event_loop, *view, m_browser_options.urls.first(), WebView::PageInfoType::LayoutTree | WebView::PageInfoType::PaintTree);
@@ -538,6 +815,11 @@ void Application::process_did_exit(Process&& process)
         dbgln_if(WEBVIEW_PROCESS_DEBUG, "FIXME: Restart request server");
         break;
     case ProcessType::WebContent:
+        if (m_spare_web_content_processes.remove_first_matching([&](auto const& spare) { return spare->pid() == process.pid(); })) {
+            dbgln_if(WEBVIEW_PROCESS_DEBUG, "Replace spare WebContent process");
+            launch_spare_web_content_process();
+            break;
+        }
         if (auto client = process.client<WebContentClient>(); client.has_value()) {
             dbgln_if(WEBVIEW_PROCESS_DEBUG, "Restart WebContent process");
             if (auto on_web_content_process_crash = move(client->on_web_content_process_crash))
@@ -545,6 +827,11 @@ void Application::process_did_exit(Process&& process)
         }
         break;
     case ProcessType::WebWorker:
+        if (m_spare_dedicated_worker_processes.remove_first_matching([&](auto const& spare) { return spare->pid() == process.pid(); })) {
+            dbgln_if(WEBVIEW_PROCESS_DEBUG, "Replace spare WebWorker process");
+            launch_spare_dedicated_worker_process();
+            break;
+        }
         dbgln_if(WEBVIEW_PROCESS_DEBUG, "WebWorker {} died, not sure what to do.", process.pid());
         break;
     case ProcessType::Browser:
@@ -905,4 +1192,35 @@ void Application::request_console_messages(DevTools::TabDescription const& descr
     view->js_console_request_messages(start_index);
 }
 
+void Application::start_javascript_profiler(DevTools::TabDescription const& description) const
+{
+    auto view = ViewImplementation::find_view_by_id(description.id);
+    if (!view.has_value())
+        return;
+
+    view->start_javascript_profiler();
+}
+
+void Application::stop_javascript_profiler(DevTools::TabDescription const& description, OnJavaScriptProfileReceived on_complete) const
+{
+    auto view = ViewImplementation::find_view_by_id(description.id);
+    if (!view.has_value()) {
+        on_complete(Error::from_string_literal("Unable to locate tab"));
+        return;
+    }
+
+    view->on_received_javascript_profile = [&view = *view, on_complete = move(on_complete)](String profile) {
+        view.on_received_javascript_profile = nullptr;
+
+        if (profile.is_empty()) {
+            on_complete(Error::from_string_literal("The JavaScript profiler was not running"));
+            return;
+        }
+
+        on_complete(JsonValue::from_string(profile));
+    };
+
+    view->stop_javascript_profiler();
+}
+
 }
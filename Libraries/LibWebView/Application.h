@@ -10,6 +10,7 @@
 #include <AK/LexicalPath.h>
 #include <AK/Optional.h>
 #include <AK/Swift.h>
+#include <AK/Time.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Forward.h>
 #include <LibDevTools/DevToolsDelegate.h>
@@ -18,6 +19,7 @@
 #include <LibMain/Main.h>
 #include <LibRequests/RequestClient.h>
 #include <LibURL/URL.h>
+#include <LibWeb/Worker/WebWorkerClient.h>
 #include <LibWebView/Options.h>
 #include <LibWebView/Process.h>
 #include <LibWebView/ProcessManager.h>
@@ -52,6 +54,12 @@ public:
     static ProcessManager& process_manager() { return *the().m_process_manager; }
 
     ErrorOr<NonnullRefPtr<WebContentClient>> launch_web_content_process(ViewImplementation&);
+    ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> launch_web_worker_process(Web::Bindings::AgentType);
+
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+    WebContentZygote* web_content_zygote() { return m_web_content_zygote.ptr(); }
+    void discard_web_content_zygote();
+#endif
 
     void add_child_process(Process&&);
 
@@ -88,10 +96,14 @@ protected:
 private:
     ErrorOr<void> launch_services();
     void launch_spare_web_content_process();
+    void launch_spare_dedicated_worker_process();
+    void launch_web_content_zygote();
     ErrorOr<void> launch_request_server();
     ErrorOr<void> launch_image_decoder_server();
     ErrorOr<void> launch_devtools_server();
 
+    void handle_memory_pressure(Core::MemoryPressureLevel);
+
     virtual Vector<DevTools::TabDescription> tab_list() const override;
     virtual Vector<DevTools::CSSProperty> css_property_list() const override;
     virtual void inspect_tab(DevTools::TabDescription const&, OnTabInspectionComplete) const override;
@@ -122,6 +134,8 @@ private:
     virtual void listen_for_console_messages(DevTools::TabDescription const&, OnConsoleMessageAvailable, OnReceivedConsoleMessages) const override;
     virtual void stop_listening_for_console_messages(DevTools::TabDescription const&) const override;
     virtual void request_console_messages(DevTools::TabDescription const&, i32) const override;
+    virtual void start_javascript_profiler(DevTools::TabDescription const&) const override;
+    virtual void stop_javascript_profiler(DevTools::TabDescription const&, OnJavaScriptProfileReceived) const override;
 
     static Application* s_the;
 
@@ -135,15 +149,34 @@ private:
     RefPtr<Requests::RequestClient> m_request_server_client;
     RefPtr<ImageDecoderClient::Client> m_image_decoder_client;
 
-    RefPtr<WebContentClient> m_spare_web_content_process;
+    // A few WebContent processes are kept warm, so that bursts of new tabs and cross-site navigations don't have to
+    // wait for a process to start up.
+    static constexpr size_t spare_web_content_process_pool_size = 2;
+    Vector<NonnullRefPtr<WebContentClient>> m_spare_web_content_processes;
     bool m_has_queued_task_to_launch_spare_web_content_process { false };
 
+    // Likewise for dedicated workers, which pages tend to create several of at once. The pool is only filled once a
+    // page has asked for its first worker, so that we don't keep processes around that are never going to be used.
+    static constexpr size_t spare_dedicated_worker_process_pool_size = 2;
+    Vector<NonnullRefPtr<Web::HTML::WebWorkerClient>> m_spare_dedicated_worker_processes;
+    bool m_has_queued_task_to_launch_spare_dedicated_worker_process { false };
+
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+    OwnPtr<WebContentZygote> m_web_content_zygote;
+#endif
+
     RefPtr<Database> m_database;
     OwnPtr<CookieJar> m_cookie_jar;
     OwnPtr<StorageJar> m_storage_jar;
 
     OwnPtr<Core::TimeZoneWatcher> m_time_zone_watcher;
 
+    // Under critical memory pressure, we discard background tabs one at a time, giving the system a chance to recover
+    // in between.
+    static constexpr auto minimum_time_between_discarded_views = AK::Duration::from_seconds(10);
+    OwnPtr<Core::MemoryPressureWatcher> m_memory_pressure_watcher;
+    Optional<MonotonicTime> m_last_view_discard_time;
+
     OwnPtr<Core::EventLoop> m_event_loop;
     OwnPtr<ProcessManager> m_process_manager;
     bool m_in_shutdown { false };
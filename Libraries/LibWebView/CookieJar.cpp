@@ -67,11 +67,15 @@ CookieJar::CookieJar(Optional<PersistedStorage> persisted_storage)
     m_persisted_storage->synchronization_timer = Core::Timer::create_repeating(
         static_cast<int>(DATABASE_SYNCHRONIZATION_TIMER.to_milliseconds()),
         [this]() {
-            for (auto const& it : m_transient_storage.take_dirty_cookies())
-                m_persisted_storage->insert_cookie(it.value);
-
+            auto dirty_cookies = m_transient_storage.take_dirty_cookies();
             auto now = m_transient_storage.purge_expired_cookies();
-            m_persisted_storage->database.execute_statement(m_persisted_storage->statements.expire_cookie, {}, now);
+
+            m_persisted_storage->database.execute_in_transaction([&] {
+                for (auto const& it : dirty_cookies)
+                    m_persisted_storage->insert_cookie(it.value);
+
+                m_persisted_storage->database.execute_statement(m_persisted_storage->statements.expire_cookie, {}, now);
+            });
         });
     m_persisted_storage->synchronization_timer->start();
 }
@@ -86,7 +90,7 @@ CookieJar::~CookieJar()
 }
 
 // https://www.ietf.org/archive/id/draft-ietf-httpbis-rfc6265bis-15.html#section-5.8.3
-String CookieJar::get_cookie(const URL::URL& url, Web::Cookie::Source source)
+Web::Cookie::CookieString CookieJar::get_cookie(const URL::URL& url, Web::Cookie::Source source)
 {
     m_transient_storage.purge_expired_cookies();
 
@@ -98,11 +102,14 @@ String CookieJar::get_cookie(const URL::URL& url, Web::Cookie::Source source)
 
     // 4. Serialize the cookie-list into a cookie-string by processing each cookie in the cookie-list in order:
     StringBuilder builder;
+    auto expiry_time = UnixDateTime::latest();
 
     for (auto const& cookie : cookie_list) {
         if (!builder.is_empty())
             builder.append("; "sv);
 
+        expiry_time = min(expiry_time, cookie.expiry_time);
+
         // 1. If the cookies' name is not empty, output the cookie's name followed by the %x3D ("=") character.
         if (!cookie.name.is_empty())
             builder.appendff("{}=", cookie.name);
@@ -114,7 +121,7 @@ String CookieJar::get_cookie(const URL::URL& url, Web::Cookie::Source source)
         // 3. If there is an unprocessed cookie in the cookie-list, output the characters %x3B and %x20 ("; ").
     }
 
-    return MUST(builder.to_string());
+    return { MUST(builder.to_string()), expiry_time };
 }
 
 void CookieJar::set_cookie(const URL::URL& url, Web::Cookie::ParsedCookie const& parsed_cookie, Web::Cookie::Source source)
@@ -145,6 +152,9 @@ void CookieJar::update_cookie(Web::Cookie::Cookie cookie)
     m_transient_storage.set_cookie(move(key), move(cookie));
 
     m_transient_storage.purge_expired_cookies();
+
+    if (on_cookies_changed)
+        on_cookies_changed();
 }
 
 void CookieJar::dump_cookies()
@@ -177,6 +187,9 @@ void CookieJar::dump_cookies()
 void CookieJar::clear_all_cookies()
 {
     m_transient_storage.expire_and_purge_all_cookies();
+
+    if (on_cookies_changed)
+        on_cookies_changed();
 }
 
 Vector<Web::Cookie::Cookie> CookieJar::get_all_cookies()
@@ -220,6 +233,9 @@ Optional<Web::Cookie::Cookie> CookieJar::get_named_cookie(URL::URL const& url, S
 void CookieJar::expire_cookies_with_time_offset(AK::Duration offset)
 {
     m_transient_storage.purge_expired_cookies(offset);
+
+    if (on_cookies_changed)
+        on_cookies_changed();
 }
 
 // https://www.ietf.org/archive/id/draft-ietf-httpbis-rfc6265bis-15.html#section-5.1.2
@@ -528,6 +544,9 @@ void CookieJar::store_cookie(Web::Cookie::ParsedCookie const& parsed_cookie, con
     m_transient_storage.set_cookie(move(key), move(cookie));
 
     m_transient_storage.purge_expired_cookies();
+
+    if (on_cookies_changed)
+        on_cookies_changed();
 }
 
 // https://www.ietf.org/archive/id/draft-ietf-httpbis-rfc6265bis-15.html#section-5.8.3
@@ -538,7 +557,9 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
     // 1. Let cookie-list be the set of cookies from the cookie store that meets all of the following requirements:
     Vector<Web::Cookie::Cookie> cookie_list;
 
-    m_transient_storage.for_each_cookie([&](Web::Cookie::Cookie& cookie) {
+    // NOTE: Neither condition below can hold unless the cookie's domain is the canonicalized host or one of its parent
+    //       domains, so the other cookies aren't even looked at.
+    m_transient_storage.for_each_cookie_for_domain(canonicalized_domain, [&](Web::Cookie::Cookie& cookie) {
         // * Either:
         //     The cookie's host-only-flag is true and the canonicalized host of the retrieval's URI is identical to
         //     the cookie's domain.
@@ -612,15 +633,37 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
 void CookieJar::TransientStorage::set_cookies(Cookies cookies)
 {
     m_cookies = move(cookies);
+
+    m_keys_by_domain.clear();
+    for (auto const& it : m_cookies)
+        index_cookie(it.key);
+
     purge_expired_cookies();
 }
 
 void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, Web::Cookie::Cookie cookie)
 {
     m_cookies.set(key, cookie);
+    index_cookie(key);
     m_dirty_cookies.set(move(key), move(cookie));
 }
 
+void CookieJar::TransientStorage::index_cookie(CookieStorageKey const& key)
+{
+    m_keys_by_domain.ensure(key.domain).set(key);
+}
+
+void CookieJar::TransientStorage::unindex_cookie(CookieStorageKey const& key)
+{
+    auto keys = m_keys_by_domain.find(key.domain);
+    if (keys == m_keys_by_domain.end())
+        return;
+
+    keys->value.remove(key);
+    if (keys->value.is_empty())
+        m_keys_by_domain.remove(keys);
+}
+
 Optional<Web::Cookie::Cookie const&> CookieJar::TransientStorage::get_cookie(CookieStorageKey const& key)
 {
     return m_cookies.get(key);
@@ -636,8 +679,13 @@ UnixDateTime CookieJar::TransientStorage::purge_expired_cookies(Optional<AK::Dur
             cookie.value.expiry_time -= *offset;
     }
 
-    auto is_expired = [&](auto const&, auto const& cookie) { return cookie.expiry_time < now; };
-    m_cookies.remove_all_matching(is_expired);
+    m_cookies.remove_all_matching([&](auto const& key, auto const& cookie) {
+        if (cookie.expiry_time >= now)
+            return false;
+
+        unindex_cookie(key);
+        return true;
+    });
 
     return now;
 }
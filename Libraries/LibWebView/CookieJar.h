@@ -8,6 +8,7 @@
 
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/Optional.h>
 #include <AK/String.h>
 #include <AK/StringView.h>
@@ -67,9 +68,35 @@ class CookieJar {
             }
         }
 
+        // Invokes the callback for every cookie whose domain is the given domain or one of its parent domains, which is
+        // a superset of the cookies whose domain the given domain domain-matches. The callback may not modify the store.
+        template<typename Callback>
+        void for_each_cookie_for_domain(StringView domain, Callback callback)
+        {
+            while (true) {
+                if (auto keys = m_keys_by_domain.find(domain); keys != m_keys_by_domain.end()) {
+                    for (auto const& key : keys->value)
+                        callback(m_cookies.find(key)->value);
+                }
+
+                auto dot = domain.find('.');
+                if (!dot.has_value())
+                    return;
+                domain = domain.substring_view(*dot + 1);
+            }
+        }
+
     private:
+        void index_cookie(CookieStorageKey const&);
+        void unindex_cookie(CookieStorageKey const&);
+
         Cookies m_cookies;
         Cookies m_dirty_cookies;
+
+        // OPTIMIZATION: The keys of all cookies in the store, grouped by the domain of the cookie. Retrieving the cookies
+        //               for a URL only has to look at the groups of the URL's host and its parent domains this way,
+        //               rather than at every cookie in the store.
+        HashMap<String, HashTable<CookieStorageKey>> m_keys_by_domain;
     };
 
     struct PersistedStorage {
@@ -87,7 +114,7 @@ public:
 
     ~CookieJar();
 
-    String get_cookie(const URL::URL& url, Web::Cookie::Source source);
+    Web::Cookie::CookieString get_cookie(const URL::URL& url, Web::Cookie::Source source);
     void set_cookie(const URL::URL& url, Web::Cookie::ParsedCookie const& parsed_cookie, Web::Cookie::Source source);
     void update_cookie(Web::Cookie::Cookie);
     void dump_cookies();
@@ -97,6 +124,9 @@ public:
     Optional<Web::Cookie::Cookie> get_named_cookie(URL::URL const& url, StringView name);
     void expire_cookies_with_time_offset(AK::Duration);
 
+    // Invoked whenever cookies are added, changed, or removed, other than by reaching their expiry time.
+    Function<void()> on_cookies_changed;
+
 private:
     explicit CookieJar(Optional<PersistedStorage>);
 
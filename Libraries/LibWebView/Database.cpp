@@ -50,7 +50,14 @@ ErrorOr<NonnullRefPtr<Database>> Database::create()
     sqlite3* m_database { nullptr };
     SQL_TRY(sqlite3_open(database_file.characters(), &m_database));
 
-    return adopt_nonnull_ref_or_enomem(new (nothrow) Database(m_database));
+    // With a write-ahead log, writers don't block readers and committing a transaction only needs to sync the log.
+    SQL_TRY(sqlite3_exec(m_database, "PRAGMA journal_mode = WAL; PRAGMA synchronous = NORMAL;", nullptr, nullptr, nullptr));
+
+    auto database = TRY(adopt_nonnull_ref_or_enomem(new (nothrow) Database(m_database)));
+    database->m_begin_transaction = TRY(database->prepare_statement("BEGIN TRANSACTION;"sv));
+    database->m_commit_transaction = TRY(database->prepare_statement("COMMIT TRANSACTION;"sv));
+
+    return database;
 }
 
 Database::Database(sqlite3* database)
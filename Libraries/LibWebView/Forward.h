@@ -20,6 +20,7 @@ class ProcessManager;
 class Settings;
 class ViewImplementation;
 class WebContentClient;
+class WebContentZygote;
 class WebUI;
 
 #if defined(AK_OS_MACOS)
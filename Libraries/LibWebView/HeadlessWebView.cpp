@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/Promise.h>
+#include <LibGfx/ShareableBitmap.h>
 #include <LibWebView/HeadlessWebView.h>
 
 namespace WebView {
@@ -168,6 +170,42 @@ void HeadlessWebView::initialize_client(CreateNewClient create_new_client)
     client().async_update_screen_rects(m_client_state.page_index, { { screen_rect } }, 0);
 }
 
+void HeadlessWebView::set_device_pixel_ratio(float device_pixel_ratio)
+{
+    m_device_pixel_ratio = device_pixel_ratio;
+    update_zoom();
+}
+
+NonnullRefPtr<Core::Promise<RefPtr<Gfx::Bitmap const>>> HeadlessWebView::take_screenshot_bitmap()
+{
+    auto promise = Core::Promise<RefPtr<Gfx::Bitmap const>>::construct();
+
+    if (m_pending_screenshot_bitmap) {
+        promise->reject(Error::from_string_literal("A screenshot request is already in progress"));
+        return promise;
+    }
+
+    m_pending_screenshot_bitmap = promise;
+    client().async_take_document_screenshot(page_id());
+
+    return promise;
+}
+
+void HeadlessWebView::did_receive_screenshot(Badge<WebContentClient> badge, Gfx::ShareableBitmap const& screenshot)
+{
+    if (!m_pending_screenshot_bitmap) {
+        ViewImplementation::did_receive_screenshot(badge, screenshot);
+        return;
+    }
+
+    auto pending_screenshot = move(m_pending_screenshot_bitmap);
+
+    if (auto bitmap = screenshot.bitmap())
+        pending_screenshot->resolve(bitmap);
+    else
+        pending_screenshot->reject(Error::from_string_literal("Failed to take a screenshot"));
+}
+
 void HeadlessWebView::update_zoom()
 {
     client().async_set_device_pixels_per_css_pixel(m_client_state.page_index, m_device_pixel_ratio * m_zoom_level);
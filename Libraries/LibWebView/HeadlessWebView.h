@@ -19,12 +19,20 @@ public:
     static NonnullOwnPtr<HeadlessWebView> create(Core::AnonymousBuffer theme, Web::DevicePixelSize window_size);
     static NonnullOwnPtr<HeadlessWebView> create_child(HeadlessWebView&, u64 page_index);
 
+    void set_device_pixel_ratio(float);
+
+    // Takes a screenshot of the whole document and hands back the bitmap, rather than encoding and saving it here. This
+    // lets callers that take many screenshots encode them elsewhere, e.g. on a background thread.
+    NonnullRefPtr<Core::Promise<RefPtr<Gfx::Bitmap const>>> take_screenshot_bitmap();
+
 protected:
     HeadlessWebView(Core::AnonymousBuffer theme, Web::DevicePixelSize viewport_size);
 
     void initialize_client(CreateNewClient) override;
     void update_zoom() override;
 
+    virtual void did_receive_screenshot(Badge<WebContentClient>, Gfx::ShareableBitmap const&) override;
+
     virtual Web::DevicePixelSize viewport_size() const override { return m_viewport_size; }
     virtual Gfx::IntPoint to_content_position(Gfx::IntPoint widget_position) const override { return widget_position; }
     virtual Gfx::IntPoint to_widget_position(Gfx::IntPoint content_position) const override { return content_position; }
@@ -39,6 +47,8 @@ protected:
     Optional<Web::Clipboard::SystemClipboardItem> m_clipboard;
 
     Vector<NonnullOwnPtr<HeadlessWebView>> m_child_web_views;
+
+    RefPtr<Core::Promise<RefPtr<Gfx::Bitmap const>>> m_pending_screenshot_bitmap;
 };
 
 }
@@ -12,6 +12,23 @@
 
 namespace WebView {
 
+template<typename ClientType>
+static NonnullRefPtr<ClientType> register_server_process(WebView::Process::ProcessAndClient<ClientType> process_and_client)
+{
+    auto&& [process, client] = move(process_and_client);
+
+    if constexpr (requires { client->set_pid(pid_t {}); })
+        client->set_pid(process.pid());
+
+    if constexpr (requires { client->transport().set_peer_pid(0); } && !IsSame<ClientType, Web::HTML::WebWorkerClient>) {
+        auto response = client->template send_sync<typename ClientType::InitTransport>(Core::System::getpid());
+        client->transport().set_peer_pid(response->peer_pid());
+    }
+
+    WebView::Application::the().add_child_process(move(process));
+    return client;
+}
+
 template<typename ClientType, typename... ClientArguments>
 static ErrorOr<NonnullRefPtr<ClientType>> launch_server_process(
     StringView server_name,
@@ -48,17 +65,7 @@ static ErrorOr<NonnullRefPtr<ClientType>> launch_server_process(
         auto result = WebView::Process::spawn<ClientType>(process_type, move(options), forward<ClientArguments>(client_arguments)...);
 
         if (!result.is_error()) {
-            auto&& [process, client] = result.release_value();
-
-            if constexpr (requires { client->set_pid(pid_t {}); })
-                client->set_pid(process.pid());
-
-            if constexpr (requires { client->transport().set_peer_pid(0); } && !IsSame<ClientType, Web::HTML::WebWorkerClient>) {
-                auto response = client->template send_sync<typename ClientType::InitTransport>(Core::System::getpid());
-                client->transport().set_peer_pid(response->peer_pid());
-            }
-
-            WebView::Application::the().add_child_process(move(process));
+            auto client = register_server_process(result.release_value());
 
             if (browser_options.profile_helper_process == process_type) {
                 dbgln();
@@ -79,11 +86,8 @@ static ErrorOr<NonnullRefPtr<ClientType>> launch_server_process(
     VERIFY_NOT_REACHED();
 }
 
-template<typename... ClientArguments>
-static ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process_impl(
-    IPC::File image_decoder_socket,
-    Optional<IPC::File> request_server_socket,
-    ClientArguments&&... client_arguments)
+// The arguments shared by every WebContent process, i.e. everything but its connections to other processes.
+static Vector<ByteString> web_content_process_arguments()
 {
     auto const& browser_options = WebView::Application::browser_options();
     auto const& web_content_options = WebView::Application::web_content_options();
@@ -120,6 +124,8 @@ static ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_proc
         arguments.append("--force-fontconfig"sv);
     if (web_content_options.collect_garbage_on_every_allocation == WebView::CollectGarbageOnEveryAllocation::Yes)
         arguments.append("--collect-garbage-on-every-allocation"sv);
+    if (web_content_options.track_allocation_sites == WebView::TrackAllocationSites::Yes)
+        arguments.append("--track-allocation-sites"sv);
     if (web_content_options.paint_viewport_scrollbars == PaintViewportScrollbars::No)
         arguments.append("--disable-scrollbar-painting"sv);
 
@@ -132,6 +138,34 @@ static ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_proc
         arguments.append("--mach-server-name"sv);
         arguments.append(server.value());
     }
+
+    return arguments;
+}
+
+template<typename... ClientArguments>
+static ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process_impl(
+    IPC::File image_decoder_socket,
+    Optional<IPC::File> request_server_socket,
+    ClientArguments&&... client_arguments)
+{
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+    if (auto* zygote = WebView::Application::the().web_content_zygote()) {
+        Optional<int> request_server_fd;
+        if (request_server_socket.has_value())
+            request_server_fd = request_server_socket->fd();
+
+        auto result = WebView::Process::fork_from_zygote<WebView::WebContentClient>(*zygote, image_decoder_socket.fd(), request_server_fd, forward<ClientArguments>(client_arguments)...);
+        if (!result.is_error())
+            return register_server_process(result.release_value());
+
+        // NOTE: Forking only fails if the zygote went away or is in a bad state, so don't try it again.
+        dbgln("Unable to fork WebContent process from zygote, spawning it instead: {}", result.error());
+        WebView::Application::the().discard_web_content_zygote();
+    }
+#endif
+
+    auto arguments = web_content_process_arguments();
+
     if (request_server_socket.has_value()) {
         arguments.append("--request-server-socket"sv);
         arguments.append(ByteString::number(request_server_socket->fd()));
@@ -143,6 +177,27 @@ static ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_proc
     return launch_server_process<WebView::WebContentClient>("WebContent"sv, move(arguments), forward<ClientArguments>(client_arguments)...);
 }
 
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+ErrorOr<NonnullOwnPtr<WebContentZygote>> launch_web_content_zygote_process()
+{
+    auto candidate_server_paths = TRY(get_paths_for_helper_process("WebContent"sv));
+    auto arguments = web_content_process_arguments();
+
+    for (auto [i, path] : enumerate(candidate_server_paths)) {
+        auto result = WebContentZygote::launch(path, arguments);
+        if (!result.is_error())
+            return result.release_value();
+
+        if (i == candidate_server_paths.size() - 1) {
+            warnln("Could not launch any of {}: {}", candidate_server_paths, result.error());
+            return result.release_error();
+        }
+    }
+
+    VERIFY_NOT_REACHED();
+}
+#endif
+
 ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
     WebView::ViewImplementation& view,
     IPC::File image_decoder_socket,
@@ -206,6 +261,9 @@ ErrorOr<NonnullRefPtr<Requests::RequestClient>> launch_request_server_process()
     for (auto const& certificate : WebView::Application::browser_options().certificates)
         arguments.append(ByteString::formatted("--certificate={}", certificate));
 
+    if (WebView::Application::browser_options().enable_http_disk_cache == WebView::EnableHTTPDiskCache::Yes)
+        arguments.append("--enable-http-disk-cache"sv);
+
     if (auto server = mach_server_name(); server.has_value()) {
         arguments.append("--mach-server-name"sv);
         arguments.append(server.value());
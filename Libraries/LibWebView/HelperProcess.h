@@ -14,6 +14,7 @@
 #include <LibWeb/Worker/WebWorkerClient.h>
 #include <LibWebView/ViewImplementation.h>
 #include <LibWebView/WebContentClient.h>
+#include <LibWebView/WebContentZygote.h>
 
 namespace WebView {
 
@@ -26,6 +27,10 @@ ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_spare_web_content_proce
     IPC::File image_decoder_socket,
     Optional<IPC::File> request_server_socket = {});
 
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+ErrorOr<NonnullOwnPtr<WebContentZygote>> launch_web_content_zygote_process();
+#endif
+
 ErrorOr<NonnullRefPtr<ImageDecoderClient::Client>> launch_image_decoder_process();
 ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> launch_web_worker_process(Web::Bindings::AgentType);
 ErrorOr<NonnullRefPtr<Requests::RequestClient>> launch_request_server_process();
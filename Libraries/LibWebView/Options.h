@@ -52,6 +52,16 @@ enum class EnableAutoplay {
     Yes,
 };
 
+enum class EnableHTTPDiskCache {
+    No,
+    Yes,
+};
+
+enum class EnableWebContentZygote {
+    No,
+    Yes,
+};
+
 struct SystemDNS { };
 struct DNSOverTLS {
     ByteString server_address;
@@ -74,12 +84,16 @@ struct BrowserOptions {
     Optional<HeadlessMode> headless_mode;
     int window_width { 800 };
     int window_height { 600 };
+    float device_pixel_ratio { 1.0f };
+    Optional<int> screenshot_compression_level {};
     Vector<ByteString> certificates {};
     NewWindow new_window { NewWindow::No };
     ForceNewProcess force_new_process { ForceNewProcess::No };
     AllowPopups allow_popups { AllowPopups::No };
     DisableScripting disable_scripting { DisableScripting::No };
     DisableSQLDatabase disable_sql_database { DisableSQLDatabase::No };
+    EnableHTTPDiskCache enable_http_disk_cache { EnableHTTPDiskCache::No };
+    EnableWebContentZygote enable_web_content_zygote { EnableWebContentZygote::No };
     Optional<ProcessType> debug_helper_process {};
     Optional<ProcessType> profile_helper_process {};
     Optional<ByteString> webdriver_content_ipc_path {};
@@ -132,6 +146,11 @@ enum class CollectGarbageOnEveryAllocation {
     Yes,
 };
 
+enum class TrackAllocationSites {
+    No,
+    Yes,
+};
+
 enum class PaintViewportScrollbars {
     Yes,
     No,
@@ -152,6 +171,7 @@ struct WebContentOptions {
     ForceFontconfig force_fontconfig { ForceFontconfig::No };
     EnableAutoplay enable_autoplay { EnableAutoplay::No };
     CollectGarbageOnEveryAllocation collect_garbage_on_every_allocation { CollectGarbageOnEveryAllocation::No };
+    TrackAllocationSites track_allocation_sites { TrackAllocationSites::No };
     Optional<u16> echo_server_port {};
     PaintViewportScrollbars paint_viewport_scrollbars { PaintViewportScrollbars::Yes };
 };
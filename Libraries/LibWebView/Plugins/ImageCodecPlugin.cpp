@@ -31,7 +31,85 @@ void ImageCodecPlugin::set_client(NonnullRefPtr<ImageDecoderClient::Client> clie
 
 ImageCodecPlugin::~ImageCodecPlugin() = default;
 
-NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected)
+class AnimationFrameSource final : public Web::Platform::AnimationFrameSource {
+public:
+    AnimationFrameSource(NonnullRefPtr<ImageDecoderClient::Client> client, i64 animation_id)
+        : m_client(move(client))
+        , m_animation_id(animation_id)
+    {
+    }
+
+    virtual ~AnimationFrameSource() override
+    {
+        m_client->release_animation(m_animation_id);
+    }
+
+    virtual void request_frames(size_t first_frame_index, size_t count, FramesCallback callback) override
+    {
+        m_client->request_animation_frames(m_animation_id, first_frame_index, count, [callback = move(callback)](u32 first_frame_index, Vector<RefPtr<Gfx::Bitmap>> bitmaps, Vector<u32> durations) {
+            Vector<Web::Platform::Frame> frames;
+            frames.ensure_capacity(bitmaps.size());
+            for (size_t i = 0; i < bitmaps.size(); ++i)
+                frames.unchecked_append({ move(bitmaps[i]), i < durations.size() ? durations[i] : 0 });
+
+            callback(first_frame_index, move(frames));
+        });
+    }
+
+private:
+    NonnullRefPtr<ImageDecoderClient::Client> m_client;
+    i64 m_animation_id { 0 };
+};
+
+class IncrementalImageDecoder final : public Web::Platform::IncrementalImageDecoder {
+public:
+    IncrementalImageDecoder(NonnullRefPtr<ImageDecoderClient::Client> client, i64 session_id)
+        : m_client(move(client))
+        , m_session_id(session_id)
+    {
+    }
+
+    virtual ~IncrementalImageDecoder() override
+    {
+        m_client->end_incremental_decode(m_session_id);
+    }
+
+    virtual void append_data(ReadonlyBytes data) override
+    {
+        m_client->append_incremental_decode_data(m_session_id, data);
+    }
+
+private:
+    NonnullRefPtr<ImageDecoderClient::Client> m_client;
+    i64 m_session_id { 0 };
+};
+
+RefPtr<Web::Platform::IncrementalImageDecoder> ImageCodecPlugin::start_incremental_decode(PartialImageCallback on_partial_image)
+{
+    if (!m_client)
+        return nullptr;
+
+    auto session_id = m_client->start_incremental_decode(move(on_partial_image));
+    if (!session_id.has_value())
+        return nullptr;
+
+    return adopt_ref(*new IncrementalImageDecoder(*m_client, *session_id));
+}
+
+static ImageDecoderClient::DecodePriority decode_priority_for(Web::Platform::ImageDecodePriority priority)
+{
+    switch (priority) {
+    case Web::Platform::ImageDecodePriority::Offscreen:
+        return ImageDecoderClient::DecodePriority::Offscreen;
+    case Web::Platform::ImageDecodePriority::NearViewport:
+        return ImageDecoderClient::DecodePriority::NearViewport;
+    case Web::Platform::ImageDecodePriority::Visible:
+        return ImageDecoderClient::DecodePriority::Visible;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Web::Platform::ImageDecodePriority priority)
 {
     auto promise = Core::Promise<Web::Platform::DecodedImage>::construct();
     if (on_resolved)
@@ -46,11 +124,14 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
 
     auto image_decoder_promise = m_client->decode_image(
         bytes,
-        [promise](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
+        [promise, client = NonnullRefPtr { *m_client }](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
             // FIXME: Remove this codec plugin and just use the ImageDecoderClient directly to avoid these copies
             Web::Platform::DecodedImage decoded_image;
             decoded_image.is_animated = result.is_animated;
             decoded_image.loop_count = result.loop_count;
+            decoded_image.frame_count = result.frame_count;
+            if (result.animation_id.has_value())
+                decoded_image.frame_source = adopt_ref(*new AnimationFrameSource(client, *result.animation_id));
             for (auto& frame : result.frames) {
                 decoded_image.frames.empend(move(frame.bitmap), frame.duration);
             }
@@ -60,7 +141,8 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
         },
         [promise](auto& error) {
             promise->reject(Error::copy(error));
-        });
+        },
+        {}, {}, decode_priority_for(priority));
 
     return promise;
 }
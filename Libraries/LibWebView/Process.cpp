@@ -4,11 +4,13 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ScopeGuard.h>
 #include <LibCore/Environment.h>
 #include <LibCore/Process.h>
 #include <LibCore/Socket.h>
 #include <LibCore/StandardPaths.h>
 #include <LibWebView/Process.h>
+#include <LibWebView/WebContentZygote.h>
 
 namespace WebView {
 
@@ -50,6 +52,27 @@ ErrorOr<Process::ProcessAndIPCTransport> Process::spawn_and_connect_to_process(C
     return ProcessAndIPCTransport { move(process), make<IPC::Transport>(move(ipc_socket)) };
 }
 
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+ErrorOr<Process::ProcessAndIPCTransport> Process::fork_and_connect_to_process(WebContentZygote& zygote, int image_decoder_socket, Optional<int> request_server_socket)
+{
+    int socket_fds[2] {};
+    TRY(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, socket_fds));
+
+    ArmedScopeGuard guard_fd_0 { [&] { MUST(Core::System::close(socket_fds[0])); } };
+    ScopeGuard guard_fd_1 { [&] { MUST(Core::System::close(socket_fds[1])); } };
+
+    TRY(Core::System::set_close_on_exec(socket_fds[0], true));
+
+    auto process = TRY(zygote.fork_process(socket_fds[1], image_decoder_socket, request_server_socket));
+
+    auto ipc_socket = TRY(Core::LocalSocket::adopt_fd(socket_fds[0]));
+    guard_fd_0.disarm();
+    TRY(ipc_socket->set_blocking(true));
+
+    return ProcessAndIPCTransport { move(process), make<IPC::Transport>(move(ipc_socket)) };
+}
+#endif
+
 #ifdef AK_OS_WINDOWS
 // FIXME: Implement WebView::Process::get_process_pid on Windows
 ErrorOr<Optional<pid_t>> Process::get_process_pid(StringView, StringView)
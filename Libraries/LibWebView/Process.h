@@ -11,6 +11,7 @@
 #include <LibCore/Process.h>
 #include <LibIPC/Connection.h>
 #include <LibIPC/Transport.h>
+#include <LibWebView/Forward.h>
 #include <LibWebView/ProcessType.h>
 
 namespace WebView {
@@ -29,6 +30,11 @@ public:
     template<typename ClientType, typename... ClientArguments>
     static ErrorOr<ProcessAndClient<ClientType>> spawn(ProcessType type, Core::ProcessSpawnOptions const& options, ClientArguments&&... client_arguments);
 
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+    template<typename ClientType, typename... ClientArguments>
+    static ErrorOr<ProcessAndClient<ClientType>> fork_from_zygote(WebContentZygote&, int image_decoder_socket, Optional<int> request_server_socket, ClientArguments&&... client_arguments);
+#endif
+
     ProcessType type() const { return m_type; }
     Optional<String> const& title() const { return m_title; }
     void set_title(Optional<String> title) { m_title = move(title); }
@@ -57,6 +63,9 @@ private:
         NonnullOwnPtr<IPC::Transport> transport;
     };
     static ErrorOr<ProcessAndIPCTransport> spawn_and_connect_to_process(Core::ProcessSpawnOptions const& options);
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+    static ErrorOr<ProcessAndIPCTransport> fork_and_connect_to_process(WebContentZygote&, int image_decoder_socket, Optional<int> request_server_socket);
+#endif
 
     Core::Process m_process;
     ProcessType m_type;
@@ -79,4 +88,15 @@ ErrorOr<Process::ProcessAndClient<ClientType>> Process::spawn(ProcessType type,
     return ProcessAndClient<ClientType> { Process { type, client, move(core_process) }, client };
 }
 
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+template<typename ClientType, typename... ClientArguments>
+ErrorOr<Process::ProcessAndClient<ClientType>> Process::fork_from_zygote(WebContentZygote& zygote, int image_decoder_socket, Optional<int> request_server_socket, ClientArguments&&... client_arguments)
+{
+    auto [core_process, transport] = TRY(fork_and_connect_to_process(zygote, image_decoder_socket, request_server_socket));
+    auto client = TRY(adopt_nonnull_ref_or_enomem(new (nothrow) ClientType { move(transport), forward<ClientArguments>(client_arguments)... }));
+
+    return ProcessAndClient<ClientType> { Process { ProcessType::WebContent, client, move(core_process) }, client };
+}
+#endif
+
 }
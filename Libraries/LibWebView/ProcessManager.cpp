@@ -9,7 +9,9 @@
 #include <AK/String.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/System.h>
+#include <LibIPC/MessageStatistics.h>
 #include <LibWebView/ProcessManager.h>
+#include <LibWebView/WebContentClient.h>
 
 namespace WebView {
 
@@ -63,6 +65,17 @@ ProcessManager::ProcessManager()
             result = Core::System::waitpid(-1, WNOHANG);
         }
     });
+
+    // Asking the browser process for its IPC statistics also asks every process it has spawned.
+    if (IPC::MessageStatistics::is_enabled()) {
+        m_ipc_statistics_signal_handle = Core::EventLoop::register_signal(SIGUSR1, [this](int) {
+            Threading::MutexLocker locker { m_lock };
+            for (auto const& [pid, process] : m_processes) {
+                if (pid != Core::System::getpid())
+                    (void)Core::System::kill(pid, SIGUSR1);
+            }
+        });
+    }
 #endif
 
     add_process(Process(WebView::ProcessType::Browser, nullptr, Core::Process::current()));
@@ -80,6 +93,8 @@ ProcessManager::~ProcessManager()
     // FIXME: Handle exiting child processes on Windows
 #ifndef AK_OS_WINDOWS
     Core::EventLoop::unregister_signal(m_signal_handle);
+    if (m_ipc_statistics_signal_handle != -1)
+        Core::EventLoop::unregister_signal(m_ipc_statistics_signal_handle);
 #endif
 }
 
@@ -113,11 +128,25 @@ void ProcessManager::set_process_mach_port(pid_t pid, Core::MachPort&& port)
 
 Optional<Process> ProcessManager::remove_process(pid_t pid)
 {
-    Threading::MutexLocker locker { m_lock };
-    m_statistics.processes.remove_first_matching([&](auto const& info) {
-        return (info->pid == pid);
-    });
-    return m_processes.take(pid);
+    Optional<Process> process;
+    {
+        Threading::MutexLocker locker { m_lock };
+        m_statistics.processes.remove_first_matching([&](auto const& info) {
+            return (info->pid == pid);
+        });
+        process = m_processes.take(pid);
+    }
+
+    // A process that exited won't answer our requests for its memory reports.
+    Vector<u64> request_ids;
+    for (auto& [request_id, request] : m_memory_report_requests) {
+        if (request.pending_processes.remove(pid))
+            request_ids.append(request_id);
+    }
+    for (auto request_id : request_ids)
+        complete_memory_report_request_if_done(request_id);
+
+    return process;
 }
 
 void ProcessManager::update_all_process_statistics()
@@ -126,6 +155,16 @@ void ProcessManager::update_all_process_statistics()
     (void)update_process_statistics(m_statistics);
 }
 
+static String process_name(Process const& process)
+{
+    auto type = WebView::process_name_from_type(process.type());
+    auto const& title = process.title();
+
+    return title.has_value()
+        ? MUST(String::formatted("{} - {}", type, *title))
+        : String::from_utf8_without_validation(type.bytes());
+}
+
 JsonValue ProcessManager::serialize_json()
 {
     Threading::MutexLocker locker { m_lock };
@@ -134,15 +173,8 @@ JsonValue ProcessManager::serialize_json()
     m_statistics.for_each_process([&](auto const& process) {
         auto& process_handle = find_process(process.pid).value();
 
-        auto type = WebView::process_name_from_type(process_handle.type());
-        auto const& title = process_handle.title();
-
-        auto process_name = title.has_value()
-            ? MUST(String::formatted("{} - {}", type, *title))
-            : String::from_utf8_without_validation(type.bytes());
-
         JsonObject object;
-        object.set("name"sv, move(process_name));
+        object.set("name"sv, process_name(process_handle));
         object.set("pid"sv, process.pid);
         object.set("cpu"sv, process.cpu_percent);
         object.set("memory"sv, process.memory_usage_bytes);
@@ -152,4 +184,77 @@ JsonValue ProcessManager::serialize_json()
     return serialized;
 }
 
+static JsonObject serialize_memory_reports(pid_t pid, String process_name, Vector<Core::MemoryReport> const& reports)
+{
+    JsonArray serialized_reports;
+    serialized_reports.ensure_capacity(reports.size());
+
+    for (auto const& report : reports) {
+        JsonObject object;
+        object.set("path"sv, report.path);
+        object.set("bytes"sv, report.bytes);
+        object.set("count"sv, report.count);
+        serialized_reports.must_append(move(object));
+    }
+
+    JsonObject object;
+    object.set("name"sv, move(process_name));
+    object.set("pid"sv, pid);
+    object.set("reports"sv, move(serialized_reports));
+    return object;
+}
+
+void ProcessManager::collect_memory_reports(Function<void(JsonValue)> on_complete)
+{
+    auto request_id = ++m_next_memory_report_request_id;
+    MemoryReportRequest request { .on_complete = move(on_complete), .pending_processes = {}, .processes = {} };
+
+    {
+        Threading::MutexLocker locker { m_lock };
+
+        for (auto& [pid, process] : m_processes) {
+            if (process.type() == ProcessType::Browser) {
+                request.processes.must_append(serialize_memory_reports(pid, process_name(process), Core::MemoryReporting::collect_reports()));
+                continue;
+            }
+
+            // FIXME: Ask our other helper processes for their memory reports as well.
+            if (process.type() != ProcessType::WebContent)
+                continue;
+
+            if (auto client = process.client<WebContentClient>(); client.has_value()) {
+                client->async_request_memory_reports(request_id);
+                request.pending_processes.set(pid, process_name(process));
+            }
+        }
+    }
+
+    m_memory_report_requests.set(request_id, move(request));
+    complete_memory_report_request_if_done(request_id);
+}
+
+void ProcessManager::did_collect_memory_reports(Badge<WebContentClient>, pid_t pid, u64 request_id, Vector<Core::MemoryReport> reports)
+{
+    auto request = m_memory_report_requests.get(request_id);
+    if (!request.has_value())
+        return;
+
+    auto process_name = request->pending_processes.take(pid);
+    if (!process_name.has_value())
+        return;
+
+    request->processes.must_append(serialize_memory_reports(pid, process_name.release_value(), reports));
+    complete_memory_report_request_if_done(request_id);
+}
+
+void ProcessManager::complete_memory_report_request_if_done(u64 request_id)
+{
+    auto request = m_memory_report_requests.get(request_id);
+    if (!request.has_value() || !request->pending_processes.is_empty())
+        return;
+
+    auto completed_request = m_memory_report_requests.take(request_id).release_value();
+    completed_request.on_complete(move(completed_request.processes));
+}
+
 }
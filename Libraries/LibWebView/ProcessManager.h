@@ -6,8 +6,12 @@
 
 #pragma once
 
+#include <AK/Badge.h>
+#include <AK/HashMap.h>
+#include <AK/JsonArray.h>
 #include <AK/JsonValue.h>
 #include <AK/Types.h>
+#include <LibCore/MemoryReporting.h>
 #include <LibCore/Platform/ProcessStatistics.h>
 #include <LibThreading/Mutex.h>
 #include <LibWebView/Forward.h>
@@ -37,13 +41,29 @@ public:
     void update_all_process_statistics();
     JsonValue serialize_json();
 
+    // Collects the memory reports of this process and of every WebContent process, and invokes the callback once they
+    // have all answered. Processes that exit in the meantime are left out.
+    void collect_memory_reports(Function<void(JsonValue)>);
+    void did_collect_memory_reports(Badge<WebContentClient>, pid_t, u64 request_id, Vector<Core::MemoryReport>);
+
     Function<void(Process&&)> on_process_exited;
 
 private:
+    struct MemoryReportRequest {
+        Function<void(JsonValue)> on_complete;
+        HashMap<pid_t, String> pending_processes;
+        JsonArray processes;
+    };
+    void complete_memory_report_request_if_done(u64 request_id);
+
     Core::Platform::ProcessStatistics m_statistics;
     HashMap<pid_t, Process> m_processes;
     int m_signal_handle { -1 };
+    int m_ipc_statistics_signal_handle { -1 };
     Threading::Mutex m_lock;
+
+    HashMap<u64, MemoryReportRequest> m_memory_report_requests;
+    u64 m_next_memory_report_request_id { 0 };
 };
 
 }
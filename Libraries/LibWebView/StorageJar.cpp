@@ -6,6 +6,7 @@
 
 #include <AK/NonnullOwnPtr.h>
 #include <AK/StdLibExtras.h>
+#include <AK/Time.h>
 #include <LibWebView/StorageJar.h>
 
 namespace WebView {
@@ -13,6 +14,9 @@ namespace WebView {
 // Quota size is specified in https://storage.spec.whatwg.org/#registered-storage-endpoints
 static constexpr size_t LOCAL_STORAGE_QUOTA = 5 * MiB;
 
+// How long writes are collected before they are written to the database together.
+static constexpr auto DATABASE_SYNCHRONIZATION_DELAY = AK::Duration::from_milliseconds(500);
+
 ErrorOr<NonnullOwnPtr<StorageJar>> StorageJar::create(Database& database)
 {
     Statements statements {};
@@ -29,10 +33,8 @@ ErrorOr<NonnullOwnPtr<StorageJar>> StorageJar::create(Database& database)
 
     statements.set_item = TRY(database.prepare_statement("INSERT OR REPLACE INTO WebStorage VALUES (?, ?, ?, ?);"sv));
     statements.delete_item = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key = ?;"sv));
-    statements.get_item = TRY(database.prepare_statement("SELECT bottle_value FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key = ?;"sv));
     statements.clear = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
-    statements.get_keys = TRY(database.prepare_statement("SELECT bottle_key FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
-    statements.calculate_size_excluding_key = TRY(database.prepare_statement("SELECT SUM(LENGTH(bottle_key) + LENGTH(bottle_value)) FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key != ?;"sv));
+    statements.get_items = TRY(database.prepare_statement("SELECT bottle_key, bottle_value FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
 
     return adopt_own(*new StorageJar { PersistedStorage { database, statements } });
 }
@@ -45,9 +47,24 @@ NonnullOwnPtr<StorageJar> StorageJar::create()
 StorageJar::StorageJar(Optional<PersistedStorage> persisted_storage)
     : m_persisted_storage(move(persisted_storage))
 {
+    if (!m_persisted_storage.has_value())
+        return;
+
+    m_persisted_storage->synchronization_timer = Core::Timer::create_single_shot(
+        static_cast<int>(DATABASE_SYNCHRONIZATION_DELAY.to_milliseconds()),
+        [this]() {
+            m_persisted_storage->synchronize();
+        });
 }
 
-StorageJar::~StorageJar() = default;
+StorageJar::~StorageJar()
+{
+    if (!m_persisted_storage.has_value())
+        return;
+
+    m_persisted_storage->synchronization_timer->stop();
+    m_persisted_storage->synchronize();
+}
 
 Optional<String> StorageJar::get_item(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key)
 {
@@ -84,85 +101,132 @@ void StorageJar::clear_storage_key(StorageEndpointType storage_endpoint, String
     }
 }
 
-Vector<String> StorageJar::get_all_keys(StorageEndpointType storage_endpoint, String const& storage_key)
+OrderedHashMap<String, String> StorageJar::get_all_items(StorageEndpointType storage_endpoint, String const& storage_key)
 {
     if (m_persisted_storage.has_value())
-        return m_persisted_storage->get_keys(storage_endpoint, storage_key);
-    return m_transient_storage.get_keys(storage_endpoint, storage_key);
+        return m_persisted_storage->get_items(storage_endpoint, storage_key);
+    return m_transient_storage.get_items(storage_endpoint, storage_key);
+}
+
+static size_t size_of_item(String const& key, String const& value)
+{
+    return key.bytes().size() + value.bytes().size();
+}
+
+StorageJar::PersistedStorage::StorageArea& StorageJar::PersistedStorage::area(StorageEndpointType storage_endpoint, String const& storage_key)
+{
+    return areas[to_underlying(storage_endpoint)].ensure(storage_key, [&] {
+        StorageArea area;
+        database.execute_statement(
+            statements.get_items,
+            [&](auto statement_id) {
+                auto key = database.result_column<String>(statement_id, 0);
+                auto value = database.result_column<String>(statement_id, 1);
+                area.size_in_bytes += size_of_item(key, value);
+                area.items.set(move(key), move(value));
+            },
+            static_cast<int>(to_underlying(storage_endpoint)),
+            storage_key);
+        return area;
+    });
+}
+
+void StorageJar::PersistedStorage::enqueue(Operation operation)
+{
+    pending_operations.append(move(operation));
+
+    if (!synchronization_timer->is_active())
+        synchronization_timer->start();
+}
+
+void StorageJar::PersistedStorage::synchronize()
+{
+    if (pending_operations.is_empty())
+        return;
+
+    database.execute_in_transaction([&] {
+        for (auto const& operation : pending_operations) {
+            operation.visit(
+                [&](SetItem const& set_item) {
+                    database.execute_statement(
+                        statements.set_item,
+                        {},
+                        static_cast<int>(to_underlying(set_item.key.storage_endpoint)),
+                        set_item.key.storage_key,
+                        set_item.key.bottle_key,
+                        set_item.value);
+                },
+                [&](DeleteItem const& delete_item) {
+                    database.execute_statement(
+                        statements.delete_item,
+                        {},
+                        static_cast<int>(to_underlying(delete_item.key.storage_endpoint)),
+                        delete_item.key.storage_key,
+                        delete_item.key.bottle_key);
+                },
+                [&](Clear const& clear) {
+                    database.execute_statement(
+                        statements.clear,
+                        {},
+                        static_cast<int>(to_underlying(clear.storage_endpoint)),
+                        clear.storage_key);
+                });
+        }
+    });
+
+    pending_operations.clear();
 }
 
 StorageOperationError StorageJar::PersistedStorage::set_item(StorageLocation const& key, String const& value)
 {
-    size_t current_size = 0;
-    database.execute_statement(
-        statements.calculate_size_excluding_key,
-        [&](auto statement_id) {
-            current_size = database.result_column<int>(statement_id, 0);
-        },
-        static_cast<int>(to_underlying(key.storage_endpoint)),
-        key.storage_key,
-        key.bottle_key);
+    auto& area = this->area(key.storage_endpoint, key.storage_key);
 
-    auto new_size = key.bottle_key.bytes().size() + value.bytes().size();
+    auto current_size = area.size_in_bytes;
+    if (auto existing_value = area.items.get(key.bottle_key); existing_value.has_value())
+        current_size -= size_of_item(key.bottle_key, *existing_value);
+
+    auto new_size = size_of_item(key.bottle_key, value);
     if (current_size + new_size > LOCAL_STORAGE_QUOTA) {
         return StorageOperationError::QuotaExceededError;
     }
 
-    database.execute_statement(
-        statements.set_item,
-        {},
-        static_cast<int>(to_underlying(key.storage_endpoint)),
-        key.storage_key,
-        key.bottle_key,
-        value);
+    area.items.set(key.bottle_key, value);
+    area.size_in_bytes = current_size + new_size;
 
+    enqueue(SetItem { key, value });
     return StorageOperationError::None;
 }
 
 void StorageJar::PersistedStorage::delete_item(StorageLocation const& key)
 {
-    database.execute_statement(
-        statements.delete_item,
-        {},
-        static_cast<int>(to_underlying(key.storage_endpoint)),
-        key.storage_key,
-        key.bottle_key);
+    auto& area = this->area(key.storage_endpoint, key.storage_key);
+
+    auto existing_value = area.items.take(key.bottle_key);
+    if (!existing_value.has_value())
+        return;
+    area.size_in_bytes -= size_of_item(key.bottle_key, *existing_value);
+
+    enqueue(DeleteItem { key });
 }
 
 Optional<String> StorageJar::PersistedStorage::get_item(StorageLocation const& key)
 {
-    Optional<String> result;
-    database.execute_statement(
-        statements.get_item,
-        [&](auto statement_id) {
-            result = database.result_column<String>(statement_id, 0);
-        },
-        static_cast<int>(to_underlying(key.storage_endpoint)),
-        key.storage_key,
-        key.bottle_key);
-    return result;
+    if (auto value = area(key.storage_endpoint, key.storage_key).items.get(key.bottle_key); value.has_value())
+        return value.value();
+    return OptionalNone {};
 }
 
 void StorageJar::PersistedStorage::clear(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    database.execute_statement(
-        statements.clear,
-        {},
-        static_cast<int>(to_underlying(storage_endpoint)),
-        storage_key);
+    // NOTE: There is no need to read the items of the area from the database just to drop them.
+    areas[to_underlying(storage_endpoint)].set(storage_key, {});
+
+    enqueue(Clear { storage_endpoint, storage_key });
 }
 
-Vector<String> StorageJar::PersistedStorage::get_keys(StorageEndpointType storage_endpoint, String const& storage_key)
+OrderedHashMap<String, String> StorageJar::PersistedStorage::get_items(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    Vector<String> keys;
-    database.execute_statement(
-        statements.get_keys,
-        [&](auto statement_id) {
-            keys.append(database.result_column<String>(statement_id, 0));
-        },
-        static_cast<int>(to_underlying(storage_endpoint)),
-        storage_key);
-    return keys;
+    return area(storage_endpoint, storage_key).items;
 }
 
 StorageOperationError StorageJar::TransientStorage::set_item(StorageLocation const& key, String const& value)
@@ -209,14 +273,14 @@ void StorageJar::TransientStorage::clear(StorageEndpointType storage_endpoint, S
     }
 }
 
-Vector<String> StorageJar::TransientStorage::get_keys(StorageEndpointType storage_endpoint, String const& storage_key)
+OrderedHashMap<String, String> StorageJar::TransientStorage::get_items(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    Vector<String> keys;
+    OrderedHashMap<String, String> items;
     for (auto const& [key, value] : m_storage_items) {
         if (key.storage_endpoint == storage_endpoint && key.storage_key == storage_key)
-            keys.append(key.bottle_key);
+            items.set(key.bottle_key, value);
     }
-    return keys;
+    return items;
 }
 
 }
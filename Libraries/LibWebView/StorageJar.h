@@ -6,9 +6,12 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/HashMap.h>
 #include <AK/String.h>
 #include <AK/Traits.h>
+#include <AK/Variant.h>
+#include <LibCore/Timer.h>
 #include <LibWeb/StorageAPI/StorageEndpoint.h>
 #include <LibWebView/Database.h>
 #include <LibWebView/Forward.h>
@@ -40,16 +43,14 @@ public:
     StorageOperationError set_item(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key, String const& bottle_value);
     void remove_item(StorageEndpointType storage_endpoint, String const& storage_key, String const& key);
     void clear_storage_key(StorageEndpointType storage_endpoint, String const& storage_key);
-    Vector<String> get_all_keys(StorageEndpointType storage_endpoint, String const& storage_key);
+    OrderedHashMap<String, String> get_all_items(StorageEndpointType storage_endpoint, String const& storage_key);
 
 private:
     struct Statements {
         Database::StatementID set_item { 0 };
         Database::StatementID delete_item { 0 };
-        Database::StatementID get_item { 0 };
         Database::StatementID clear { 0 };
-        Database::StatementID get_keys { 0 };
-        Database::StatementID calculate_size_excluding_key { 0 };
+        Database::StatementID get_items { 0 };
     };
 
     class TransientStorage {
@@ -58,21 +59,51 @@ private:
         Optional<String> get_item(StorageLocation const& key);
         void delete_item(StorageLocation const& key);
         void clear(StorageEndpointType storage_endpoint, String const& storage_key);
-        Vector<String> get_keys(StorageEndpointType storage_endpoint, String const& storage_key);
+        OrderedHashMap<String, String> get_items(StorageEndpointType storage_endpoint, String const& storage_key);
 
     private:
         HashMap<StorageLocation, String> m_storage_items;
     };
 
+    // The items of a storage key are read from the database the first time they are used. After that, reads are
+    // answered from memory, and writes are applied to memory right away and queued up to be written to the database
+    // in a single transaction a little later. This way, a burst of writes doesn't stall the UI with a disk sync each.
     struct PersistedStorage {
         StorageOperationError set_item(StorageLocation const& key, String const& value);
         Optional<String> get_item(StorageLocation const& key);
         void delete_item(StorageLocation const& key);
         void clear(StorageEndpointType storage_endpoint, String const& storage_key);
-        Vector<String> get_keys(StorageEndpointType storage_endpoint, String const& storage_key);
+        OrderedHashMap<String, String> get_items(StorageEndpointType storage_endpoint, String const& storage_key);
+
+        // Writes all pending operations to the database.
+        void synchronize();
+
+        struct StorageArea {
+            OrderedHashMap<String, String> items;
+            size_t size_in_bytes { 0 };
+        };
+        StorageArea& area(StorageEndpointType storage_endpoint, String const& storage_key);
+
+        struct SetItem {
+            StorageLocation key;
+            String value;
+        };
+        struct DeleteItem {
+            StorageLocation key;
+        };
+        struct Clear {
+            StorageEndpointType storage_endpoint;
+            String storage_key;
+        };
+        using Operation = Variant<SetItem, DeleteItem, Clear>;
+        void enqueue(Operation);
 
         Database& database;
         Statements statements;
+
+        Array<HashMap<String, StorageArea>, to_underlying(StorageEndpointType::Count)> areas {};
+        Vector<Operation> pending_operations {};
+        RefPtr<Core::Timer> synchronization_timer {};
     };
 
     explicit StorageJar(Optional<PersistedStorage>);
@@ -55,6 +55,15 @@ ViewImplementation::ViewImplementation()
         this->m_crash_count = 0;
     });
 
+    m_resize_coalescing_timer = Core::Timer::create_single_shot(resize_coalescing_interval_ms, [this] {
+        if (!m_has_coalesced_resize)
+            return;
+        m_has_coalesced_resize = false;
+
+        client().async_set_viewport_size(page_id(), this->viewport_size());
+        m_resize_coalescing_timer->start();
+    });
+
     on_request_file = [this](auto const& path, auto request_id) {
         auto file = Core::File::open(path, Core::File::OpenMode::Read);
 
@@ -137,12 +146,50 @@ void ViewImplementation::did_update_window_rect()
 
 void ViewImplementation::set_system_visibility_state(Web::HTML::VisibilityState visibility_state)
 {
+    // NOTE: A view stops being visible when it's hidden, so a hidden view was last visible when it was hidden.
+    if (m_system_visibility_state != visibility_state)
+        m_last_visible_time = MonotonicTime::now();
+
     m_system_visibility_state = visibility_state;
     client().async_set_system_visibility_state(m_client_state.page_index, m_system_visibility_state);
+
+    if (m_url_of_discarded_page.has_value() && m_system_visibility_state == Web::HTML::VisibilityState::Visible)
+        load(m_url_of_discarded_page.release_value());
+}
+
+bool ViewImplementation::can_be_discarded() const
+{
+    if (is_discarded() || m_system_visibility_state == Web::HTML::VisibilityState::Visible)
+        return false;
+
+    // Discarding a view that is playing audio would be noticed right away.
+    if (m_audio_play_state == Web::HTML::AudioPlayState::Playing)
+        return false;
+
+    return m_url.scheme().is_one_of("http"sv, "https"sv, "file"sv);
+}
+
+void ViewImplementation::discard()
+{
+    VERIFY(can_be_discarded());
+    auto url = m_url;
+
+    // NOTE: This is just like moving to a new process for a cross-site navigation, except that we hold off on loading
+    //       the page until the view is shown again.
+    client().async_close_server();
+
+    initialize_client();
+    VERIFY(m_client_state.client);
+
+    m_backup_bitmap = nullptr;
+    handle_resize();
+
+    m_url_of_discarded_page = move(url);
 }
 
 void ViewImplementation::load(URL::URL const& url)
 {
+    m_url_of_discarded_page.clear();
     m_url = url;
     client().async_load_url(page_id(), url);
 }
@@ -195,7 +242,42 @@ void ViewImplementation::reset_zoom()
     update_zoom();
 }
 
+static bool is_coalescible_mouse_event(Web::MouseEvent const& event)
+{
+    return event.type == Web::MouseEvent::Type::MouseMove || event.type == Web::MouseEvent::Type::MouseWheel;
+}
+
 void ViewImplementation::enqueue_input_event(Web::InputEvent event)
+{
+    // OPTIMIZATION: While WebContent is still busy with a mouse move or wheel event, hold back further events of the
+    //               same type, merging them into one that we send once WebContent has caught up.
+    if (auto* mouse_event = event.get_pointer<Web::MouseEvent>(); mouse_event && is_coalescible_mouse_event(*mouse_event)) {
+        if (m_coalesced_mouse_event.has_value() && m_coalesced_mouse_event->type == mouse_event->type) {
+            mouse_event->wheel_delta_x += m_coalesced_mouse_event->wheel_delta_x;
+            mouse_event->wheel_delta_y += m_coalesced_mouse_event->wheel_delta_y;
+            m_coalesced_mouse_event = move(*mouse_event);
+            return;
+        }
+
+        if (!m_coalesced_mouse_event.has_value() && !m_pending_input_events.is_empty()) {
+            if (auto const* pending_mouse_event = m_pending_input_events.tail().get_pointer<Web::MouseEvent>(); pending_mouse_event && pending_mouse_event->type == mouse_event->type) {
+                m_coalesced_mouse_event = move(*mouse_event);
+                return;
+            }
+        }
+    }
+
+    send_coalesced_mouse_event();
+    send_input_event(move(event));
+}
+
+void ViewImplementation::send_coalesced_mouse_event()
+{
+    if (m_coalesced_mouse_event.has_value())
+        send_input_event(m_coalesced_mouse_event.release_value());
+}
+
+void ViewImplementation::send_input_event(Web::InputEvent event)
 {
     // Send the next event over to the WebContent to be handled by JS. We'll later get a message to say whether JS
     // prevented the default event behavior, at which point we either discard or handle that event, and then try to
@@ -221,6 +303,9 @@ void ViewImplementation::did_finish_handling_input_event(Badge<WebContentClient>
 {
     auto event = m_pending_input_events.dequeue();
 
+    if (m_pending_input_events.is_empty())
+        send_coalesced_mouse_event();
+
     if (event_result == Web::EventResult::Handled)
         return;
 
@@ -426,6 +511,16 @@ void ViewImplementation::js_console_request_messages(i32 start_index)
     client().async_js_console_request_messages(page_id(), start_index);
 }
 
+void ViewImplementation::start_javascript_profiler()
+{
+    client().async_start_javascript_profiler(page_id());
+}
+
+void ViewImplementation::stop_javascript_profiler()
+{
+    client().async_stop_javascript_profiler(page_id());
+}
+
 void ViewImplementation::alert_closed()
 {
     client().async_alert_closed(page_id());
@@ -562,11 +657,22 @@ void ViewImplementation::did_allocate_iosurface_backing_stores(i32 front_id, Cor
 
 void ViewImplementation::handle_resize()
 {
+    // OPTIMIZATION: Resizing a window can produce several resize events per frame. Send the first one right away, but
+    //               hold back the rest for a frame and then only send the size we ended up at.
+    if (m_resize_coalescing_timer->is_active()) {
+        m_has_coalesced_resize = true;
+        return;
+    }
+
     client().async_set_viewport_size(page_id(), this->viewport_size());
+    m_resize_coalescing_timer->start();
 }
 
 void ViewImplementation::initialize_client(CreateNewClient create_new_client)
 {
+    m_resize_coalescing_timer->stop();
+    m_has_coalesced_resize = false;
+
     if (create_new_client == CreateNewClient::Yes) {
         m_client_state = {};
 
@@ -681,7 +787,7 @@ static ErrorOr<LexicalPath> save_screenshot(Gfx::Bitmap const* bitmap)
     auto file = AK::UnixDateTime::now().to_byte_string("screenshot-%Y-%m-%d-%H-%M-%S.png"sv);
     auto path = TRY(Application::the().path_for_downloaded_file(file));
 
-    auto encoded = TRY(Gfx::PNGWriter::encode(*bitmap));
+    auto encoded = TRY(Gfx::PNGWriter::encode(*bitmap, { .compression_level = Application::browser_options().screenshot_compression_level }));
 
     auto dump_file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
     TRY(dump_file->write_until_depleted(encoded));
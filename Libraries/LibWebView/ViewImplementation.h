@@ -13,6 +13,7 @@
 #include <AK/LexicalPath.h>
 #include <AK/Queue.h>
 #include <AK/String.h>
+#include <AK/Time.h>
 #include <LibCore/Forward.h>
 #include <LibCore/Promise.h>
 #include <LibGfx/Cursor.h>
@@ -59,6 +60,13 @@ public:
     void did_update_window_rect();
 
     void set_system_visibility_state(Web::HTML::VisibilityState);
+    MonotonicTime last_visible_time() const { return m_last_visible_time; }
+
+    // Gives the memory used by a hidden view back to the system, by moving it to a new WebContent process that hasn't
+    // loaded anything. The page is loaded again once the view is shown.
+    bool can_be_discarded() const;
+    void discard();
+    bool is_discarded() const { return m_url_of_discarded_page.has_value(); }
 
     void load(URL::URL const&);
     void load_html(StringView);
@@ -123,6 +131,9 @@ public:
     void js_console_input(String const&);
     void js_console_request_messages(i32 start_index);
 
+    void start_javascript_profiler();
+    void stop_javascript_profiler();
+
     void alert_closed();
     void confirm_closed(bool accepted);
     void prompt_closed(Optional<String> const& response);
@@ -208,6 +219,7 @@ public:
     Function<void(Vector<Web::CSS::StyleSheetIdentifier>)> on_received_style_sheet_list;
     Function<void(Web::CSS::StyleSheetIdentifier const&, URL::URL const&, String const&)> on_received_style_sheet_source;
     Function<void(JsonValue)> on_received_js_console_result;
+    Function<void(String)> on_received_javascript_profile;
     Function<void(i32 message_id)> on_console_message_available;
     Function<void(i32 start_index, Vector<ConsoleOutput>)> on_received_console_messages;
     Function<void(i32 count_waiting)> on_resource_status_change;
@@ -251,6 +263,9 @@ protected:
 
     void handle_resize();
 
+    void send_input_event(Web::InputEvent);
+    void send_coalesced_mouse_event();
+
     enum class CreateNewClient {
         No,
         Yes,
@@ -289,6 +304,11 @@ protected:
     float m_device_pixel_ratio { 1.0 };
 
     Queue<Web::InputEvent> m_pending_input_events;
+    Optional<Web::MouseEvent> m_coalesced_mouse_event;
+
+    static constexpr int resize_coalescing_interval_ms = 16;
+    RefPtr<Core::Timer> m_resize_coalescing_timer;
+    bool m_has_coalesced_resize { false };
 
     RefPtr<Core::Timer> m_backing_store_shrink_timer;
 
@@ -302,6 +322,8 @@ protected:
     RefPtr<Core::Promise<String>> m_pending_info_request;
 
     Web::HTML::VisibilityState m_system_visibility_state { Web::HTML::VisibilityState::Hidden };
+    MonotonicTime m_last_visible_time { MonotonicTime::now() };
+    Optional<URL::URL> m_url_of_discarded_page;
 
     Web::HTML::AudioPlayState m_audio_play_state { Web::HTML::AudioPlayState::Paused };
     size_t m_number_of_elements_playing_audio { 0 };
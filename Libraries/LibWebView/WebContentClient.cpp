@@ -16,6 +16,9 @@ namespace WebView {
 
 HashTable<WebContentClient*> WebContentClient::s_clients;
 
+// The number of the last local storage change (or rejected change) sent to WebContent processes.
+static u64 s_storage_sequence_number = 0;
+
 Optional<ViewImplementation&> WebContentClient::view_for_pid_and_page_id(pid_t pid, u64 page_id)
 {
     for (auto* client : s_clients) {
@@ -148,6 +151,11 @@ void WebContentClient::did_find_in_page(u64 page_id, size_t current_match_index,
     }
 }
 
+void WebContentClient::did_collect_memory_reports(u64 request_id, Vector<Core::MemoryReport> reports)
+{
+    Application::process_manager().did_collect_memory_reports({}, m_process_handle.pid, request_id, move(reports));
+}
+
 void WebContentClient::did_request_refresh(u64 page_id)
 {
     if (auto view = view_for_page_id(page_id); view.has_value())
@@ -398,6 +406,14 @@ void WebContentClient::did_execute_js_console_input(u64 page_id, JsonValue resul
     }
 }
 
+void WebContentClient::did_finish_javascript_profile(u64 page_id, String profile)
+{
+    if (auto view = view_for_page_id(page_id); view.has_value()) {
+        if (view->on_received_javascript_profile)
+            view->on_received_javascript_profile(move(profile));
+    }
+}
+
 void WebContentClient::did_output_js_console_message(u64 page_id, i32 message_index)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
@@ -487,7 +503,8 @@ Messages::WebContentClient::DidRequestNamedCookieResponse WebContentClient::did_
 
 Messages::WebContentClient::DidRequestCookieResponse WebContentClient::did_request_cookie(URL::URL url, Web::Cookie::Source source)
 {
-    return Application::cookie_jar().get_cookie(url, source);
+    auto cookie = Application::cookie_jar().get_cookie(url, source);
+    return { move(cookie.value), cookie.expiry_time };
 }
 
 void WebContentClient::did_set_cookie(URL::URL url, Web::Cookie::ParsedCookie cookie, Web::Cookie::Source source)
@@ -505,29 +522,46 @@ void WebContentClient::did_expire_cookies_with_time_offset(AK::Duration offset)
     Application::cookie_jar().expire_cookies_with_time_offset(offset);
 }
 
-Messages::WebContentClient::DidRequestStorageItemResponse WebContentClient::did_request_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key)
+Messages::WebContentClient::DidRequestStorageAreaResponse WebContentClient::did_request_storage_area(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key)
 {
-    return Application::storage_jar().get_item(storage_endpoint, storage_key, bottle_key);
+    return { Application::storage_jar().get_all_items(storage_endpoint, storage_key), s_storage_sequence_number };
 }
 
-Messages::WebContentClient::DidSetStorageItemResponse WebContentClient::did_set_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key, String value)
+// WebContent processes keep a copy of the storage areas they use, so every change is sent to all of them, numbered in
+// the order it was applied in. That includes the process that made the change, which is how it learns where its own
+// write landed relative to everyone else's.
+void WebContentClient::broadcast_storage_change(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, Optional<String> const& bottle_key, Optional<String> const& value)
 {
-    return Application::storage_jar().set_item(storage_endpoint, storage_key, bottle_key, value);
+    auto sequence_number = ++s_storage_sequence_number;
+
+    for_each_client([&](WebContentClient& client) {
+        client.async_storage_did_change(storage_endpoint, storage_key, sequence_number, bottle_key, value, &client == this);
+        return IterationDecision::Continue;
+    });
 }
 
-void WebContentClient::did_remove_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key)
+void WebContentClient::did_set_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key, String value)
 {
-    Application::storage_jar().remove_item(storage_endpoint, storage_key, bottle_key);
+    // NOTE: The WebContent process has already checked the quota against its copy of the storage area. Should another
+    //       process have filled the area in the meantime, the write is dropped here.
+    if (Application::storage_jar().set_item(storage_endpoint, storage_key, bottle_key, value) != StorageOperationError::None) {
+        dbgln("Dropping storage write to {} that exceeds the quota", storage_key);
+        async_storage_change_was_rejected(storage_endpoint, storage_key, ++s_storage_sequence_number);
+        return;
+    }
+    broadcast_storage_change(storage_endpoint, storage_key, bottle_key, value);
 }
 
-Messages::WebContentClient::DidRequestStorageKeysResponse WebContentClient::did_request_storage_keys(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key)
+void WebContentClient::did_remove_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key)
 {
-    return Application::storage_jar().get_all_keys(storage_endpoint, storage_key);
+    Application::storage_jar().remove_item(storage_endpoint, storage_key, bottle_key);
+    broadcast_storage_change(storage_endpoint, storage_key, bottle_key, {});
 }
 
 void WebContentClient::did_clear_storage(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key)
 {
     Application::storage_jar().clear_storage_key(storage_endpoint, storage_key);
+    broadcast_storage_change(storage_endpoint, storage_key, {}, {});
 }
 
 Messages::WebContentClient::DidRequestNewWebViewResponse WebContentClient::did_request_new_web_view(u64 page_id, Web::HTML::ActivateTab activate_tab, Web::HTML::WebViewHints hints, Optional<u64> page_index)
@@ -695,7 +729,7 @@ void WebContentClient::did_allocate_backing_stores(u64 page_id, i32 front_bitmap
 Messages::WebContentClient::RequestWorkerAgentResponse WebContentClient::request_worker_agent(u64 page_id, Web::Bindings::AgentType worker_type)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
-        auto worker_client = MUST(WebView::launch_web_worker_process(worker_type));
+        auto worker_client = MUST(Application::the().launch_web_worker_process(worker_type));
         return worker_client->clone_transport();
     }
 
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ScopeGuard.h>
+#include <LibCore/Socket.h>
+#include <LibCore/System.h>
+#include <LibWebView/WebContentZygote.h>
+#include <sys/prctl.h>
+#include <sys/socket.h>
+
+namespace WebView {
+
+ErrorOr<NonnullOwnPtr<WebContentZygote>> WebContentZygote::launch(ByteString executable, Vector<ByteString> arguments)
+{
+    // The processes the zygote forks are orphaned right away, so have them reparented to us rather than to init. This
+    // lets ProcessManager wait for them like for any process we spawned ourselves.
+    if (prctl(PR_SET_CHILD_SUBREAPER, 1) < 0)
+        return Error::from_syscall("prctl"sv, errno);
+
+    int socket_fds[2] {};
+    TRY(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, socket_fds));
+
+    ArmedScopeGuard guard_fd_0 { [&] { MUST(Core::System::close(socket_fds[0])); } };
+    ScopeGuard guard_fd_1 { [&] { MUST(Core::System::close(socket_fds[1])); } };
+
+    TRY(Core::System::set_close_on_exec(socket_fds[0], true));
+
+    arguments.append("--zygote-socket"sv);
+    arguments.append(ByteString::number(socket_fds[1]));
+
+    auto process = TRY(Core::Process::spawn({
+        .name = "WebContent"sv,
+        .executable = move(executable),
+        .arguments = arguments,
+    }));
+
+    auto socket = TRY(Core::LocalSocket::adopt_fd(socket_fds[0]));
+    guard_fd_0.disarm();
+    TRY(socket->set_blocking(true));
+
+    return adopt_nonnull_own_or_enomem(new (nothrow) WebContentZygote(move(process), move(socket)));
+}
+
+WebContentZygote::WebContentZygote(Core::Process process, NonnullOwnPtr<Core::LocalSocket> socket)
+    : m_process(move(process))
+    , m_socket(move(socket))
+{
+}
+
+// NOTE: The zygote exits once it notices that we closed our end of the socket.
+WebContentZygote::~WebContentZygote() = default;
+
+ErrorOr<Core::Process> WebContentZygote::fork_process(int ipc_socket, int image_decoder_socket, Optional<int> request_server_socket)
+{
+    Vector<int, 1> fds { ipc_socket, image_decoder_socket };
+    if (request_server_socket.has_value())
+        fds.append(*request_server_socket);
+
+    u8 request = 0;
+    TRY(m_socket->send_message({ &request, sizeof(request) }, 0, move(fds)));
+
+    // The zygote replies with the new process's PID, or with -1 if it couldn't fork.
+    pid_t pid = -1;
+    TRY(m_socket->read_until_filled({ &pid, sizeof(pid) }));
+    if (pid <= 0)
+        return Error::from_string_literal("The WebContent zygote failed to fork");
+
+    return Core::Process::adopt_child(pid);
+}
+
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/Error.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibCore/Forward.h>
+#include <LibCore/Process.h>
+
+namespace WebView {
+
+// A WebContent process that does the start-up work every WebContent process needs, and then does nothing but fork
+// copies of itself on request. The copies share the memory of that work copy-on-write, rather than each redoing it.
+class WebContentZygote {
+    AK_MAKE_NONCOPYABLE(WebContentZygote);
+    AK_MAKE_NONMOVABLE(WebContentZygote);
+
+public:
+    static ErrorOr<NonnullOwnPtr<WebContentZygote>> launch(ByteString executable, Vector<ByteString> arguments);
+    ~WebContentZygote();
+
+    // The new process is a child of this process, not of the zygote, so it's reaped and reported like any other.
+    ErrorOr<Core::Process> fork_process(int ipc_socket, int image_decoder_socket, Optional<int> request_server_socket);
+
+private:
+    WebContentZygote(Core::Process, NonnullOwnPtr<Core::LocalSocket>);
+
+    Core::Process m_process;
+    NonnullOwnPtr<Core::LocalSocket> m_socket;
+};
+
+}
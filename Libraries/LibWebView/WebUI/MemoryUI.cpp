@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWebView/Application.h>
+#include <LibWebView/ProcessManager.h>
+#include <LibWebView/WebUI/MemoryUI.h>
+
+namespace WebView {
+
+void MemoryUI::register_interfaces()
+{
+    register_interface("collectMemoryReports"sv, [this](auto const&) {
+        collect_memory_reports();
+    });
+}
+
+void MemoryUI::collect_memory_reports()
+{
+    Application::process_manager().collect_memory_reports([weak_this = make_weak_ptr<MemoryUI>()](JsonValue reports) {
+        if (weak_this)
+            weak_this->async_send_message("loadMemoryReports"sv, move(reports));
+    });
+}
+
+}
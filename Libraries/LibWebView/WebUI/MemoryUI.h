@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWebView/WebUI.h>
+
+namespace WebView {
+
+class MemoryUI : public WebUI {
+    WEB_UI(MemoryUI);
+
+private:
+    virtual void register_interfaces() override;
+
+    void collect_memory_reports();
+};
+
+}
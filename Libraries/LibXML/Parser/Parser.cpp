@@ -231,6 +231,320 @@ ErrorOr<void, ParseError> Parser::parse_internal()
     return {};
 }
 
+ErrorOr<void, ParseError> Parser::append_input(StringView input)
+{
+    VERIFY(m_is_incremental);
+    VERIFY(!m_input_closed);
+
+    if (m_incremental_error.has_value())
+        return m_incremental_error.value();
+
+    m_incremental_input.append(input.bytes());
+    return parse_incremental_input();
+}
+
+ErrorOr<void, ParseError> Parser::close_input()
+{
+    VERIFY(m_is_incremental);
+    VERIFY(!m_input_closed);
+
+    m_input_closed = true;
+    if (m_incremental_error.has_value())
+        return m_incremental_error.value();
+
+    return parse_incremental_input();
+}
+
+// Returns the length of the markup at the start of the input, or nothing if the input ends before the markup does.
+// This only looks for where the markup ends, whether it is well-formed is left to the rules that parse it.
+static Optional<size_t> length_of_markup(StringView input)
+{
+    auto length_through = [&](StringView terminator, size_t start) -> Optional<size_t> {
+        return input.find(terminator, start).map([&](auto index) { return index + terminator.length(); });
+    };
+
+    // Finds the '>' that ends a tag, skipping over quoted attribute values (and quoted strings and the internal
+    // subset of a doctype).
+    auto length_through_tag_end = [&]() -> Optional<size_t> {
+        char quote = 0;
+        size_t bracket_depth = 0;
+        for (size_t i = 1; i < input.length(); ++i) {
+            auto ch = input[i];
+            if (quote != 0) {
+                if (ch == quote)
+                    quote = 0;
+            } else if (ch == '"' || ch == '\'') {
+                quote = ch;
+            } else if (ch == '[') {
+                ++bracket_depth;
+            } else if (ch == ']' && bracket_depth > 0) {
+                --bracket_depth;
+            } else if (ch == '>' && bracket_depth == 0) {
+                return i + 1;
+            }
+        }
+        return {};
+    };
+
+    if (input.starts_with('&')) {
+        auto end = input.find_any_of(";<"sv);
+        if (!end.has_value())
+            return {};
+        return *end + (input[*end] == ';' ? 1 : 0);
+    }
+
+    if (input.starts_with("<!--"sv))
+        return length_through("-->"sv, 4);
+    if (input.starts_with("<![CDATA["sv))
+        return length_through("]]>"sv, 9);
+    if (input.starts_with("<?"sv))
+        return length_through("?>"sv, 2);
+
+    // We can't tell what kind of markup this is yet.
+    auto is_start_of = [&](StringView prefix) { return input.length() < prefix.length() && prefix.starts_with(input); };
+    if (is_start_of("<!--"sv) || is_start_of("<![CDATA["sv) || is_start_of("<!DOCTYPE"sv))
+        return {};
+
+    return length_through_tag_end();
+}
+
+// Returns how much of the end of a run of character data has to wait for more input: a ']' that might begin a ']]>',
+// or the first bytes of a code point.
+static size_t length_of_unfinished_char_data(StringView text)
+{
+    size_t brackets = 0;
+    while (brackets < min(text.length(), 2uz) && text[text.length() - brackets - 1] == ']')
+        ++brackets;
+    if (brackets > 0)
+        return brackets;
+
+    for (size_t i = 1; i <= min(text.length(), 3uz); ++i) {
+        auto byte = static_cast<u8>(text[text.length() - i]);
+        if ((byte & 0xc0) == 0x80)
+            continue;
+
+        size_t code_point_length = 1;
+        if ((byte & 0xe0) == 0xc0)
+            code_point_length = 2;
+        else if ((byte & 0xf0) == 0xe0)
+            code_point_length = 3;
+        else if ((byte & 0xf8) == 0xf0)
+            code_point_length = 4;
+        return code_point_length > i ? i : 0;
+    }
+    return 0;
+}
+
+Parser::IncrementalMatch Parser::incremental_match(StringView expected) const
+{
+    auto remaining = m_lexer.remaining();
+    if (remaining.starts_with(expected))
+        return IncrementalMatch::Yes;
+    if (!m_input_closed && remaining.length() < expected.length() && expected.starts_with(remaining))
+        return IncrementalMatch::NeedMoreInput;
+    return IncrementalMatch::No;
+}
+
+ErrorOr<void, ParseError> Parser::parse_incremental_input()
+{
+    if (!m_has_started_document) {
+        m_has_started_document = true;
+        m_listener->document_start();
+    }
+
+    m_source = StringView { m_incremental_input.bytes() };
+    m_lexer = LineTrackingLexer(m_source, m_incremental_input_position);
+
+    auto result = [&]() -> ErrorOr<void, ParseError> {
+        while (TRY(parse_incremental_unit())) { }
+
+        // document ::= ( prolog element Misc* ) - ( Char* RestrictedChar Char* )
+        auto matched_source = m_source.substring_view(0, m_lexer.tell());
+        if (auto it = find_if(matched_source.begin(), matched_source.end(), s_restricted_characters); !it.is_end()) {
+            return parse_error(
+                m_lexer.position_for(it.index()),
+                ByteString::formatted("Invalid character #{:x} used in document", *it));
+        }
+        return {};
+    }();
+
+    if (result.is_error()) {
+        m_incremental_error = result.error();
+        m_incremental_stage = IncrementalStage::Done;
+        m_listener->error(result.error());
+    }
+
+    if (m_incremental_stage == IncrementalStage::Done) {
+        m_source = {};
+        m_lexer = LineTrackingLexer(m_source);
+        m_incremental_input.clear();
+        m_listener->document_end();
+        return result;
+    }
+
+    // Only keep the input that hasn't been parsed yet.
+    m_incremental_input_position = m_lexer.current_position();
+    auto unparsed_input = MUST(ByteBuffer::copy(m_lexer.remaining().bytes()));
+    m_source = {};
+    m_lexer = LineTrackingLexer(m_source);
+    m_incremental_input = move(unparsed_input);
+    return {};
+}
+
+// Parses the next complete unit of the document (a tag, a run of character data, a comment, ...) from the input that
+// has been received so far. Returns false if there is not enough input to do so yet, or the document has ended.
+ErrorOr<bool, ParseError> Parser::parse_incremental_unit()
+{
+    auto rule = enter_rule();
+
+    if (m_incremental_stage == IncrementalStage::Done)
+        return false;
+
+    auto remaining = m_lexer.remaining();
+    if (remaining.is_empty()) {
+        if (!m_input_closed)
+            return false;
+
+        switch (m_incremental_stage) {
+        case IncrementalStage::XMLDeclaration:
+        case IncrementalStage::Prolog:
+            return parse_error(m_lexer.current_position(), Expectation { "<"sv });
+        case IncrementalStage::Content:
+            return parse_error(m_lexer.current_position(), Expectation { "</"sv });
+        case IncrementalStage::Epilogue:
+            m_incremental_stage = IncrementalStage::Done;
+            return false;
+        case IncrementalStage::Done:
+            VERIFY_NOT_REACHED();
+        }
+    }
+
+    auto is_markup = remaining.starts_with('<') || (m_incremental_stage == IncrementalStage::Content && remaining.starts_with('&'));
+    if (is_markup && !m_input_closed && !length_of_markup(remaining).has_value())
+        return false;
+
+    switch (m_incremental_stage) {
+    case IncrementalStage::XMLDeclaration: {
+        // prolog ::= XMLDecl? Misc* (doctypedecl Misc*)?
+        auto match = incremental_match("<?xml"sv);
+        if (match == IncrementalMatch::NeedMoreInput)
+            return false;
+        if (match == IncrementalMatch::No || parse_xml_decl().is_error()) {
+            m_version = Version::Version10;
+            m_in_compatibility_mode = true;
+        }
+        m_incremental_stage = IncrementalStage::Prolog;
+        return true;
+    }
+    case IncrementalStage::Prolog:
+    case IncrementalStage::Epilogue:
+        // Misc ::= Comment | PI | S
+        if (remaining.starts_with("<!--"sv)) {
+            TRY(parse_comment());
+            return true;
+        }
+        if (remaining.starts_with("<?"sv)) {
+            TRY(parse_processing_instruction());
+            return true;
+        }
+        if (is_any_of("\x20\x09\x0d\x0a"sv)(remaining[0])) {
+            TRY(skip_whitespace());
+            return true;
+        }
+        if (m_incremental_stage == IncrementalStage::Epilogue)
+            return parse_error(m_lexer.current_position(), ByteString { "Garbage after document"sv });
+        if (remaining.starts_with("<!DOCTYPE"sv) && !m_has_seen_doctype) {
+            TRY(parse_doctype_decl());
+            m_has_seen_doctype = true;
+            return true;
+        }
+        m_incremental_stage = IncrementalStage::Content;
+        return true;
+    case IncrementalStage::Content:
+        break;
+    case IncrementalStage::Done:
+        VERIFY_NOT_REACHED();
+    }
+
+    // element ::= EmptyElemTag
+    //           | STag content ETag
+    auto unit_start = m_lexer.tell();
+    if (m_open_element_names.is_empty()) {
+        if (!remaining.starts_with('<') || remaining.starts_with("</"sv) || remaining.starts_with("<!"sv) || remaining.starts_with("<?"sv))
+            return parse_error(m_lexer.current_position(), Expectation { "an element"sv });
+    }
+
+    if (remaining.starts_with("</"sv)) {
+        auto closing_name = TRY(parse_end_tag());
+
+        // Well-formedness constraint: The Name in an element's end-tag MUST match the element type in the start-tag.
+        if (m_options.treat_errors_as_fatal && closing_name != m_open_element_names.last())
+            return parse_error(m_lexer.position_for(unit_start), ByteString { "Invalid closing tag"sv });
+
+        m_listener->element_end(m_open_element_names.take_last());
+        if (m_open_element_names.is_empty())
+            m_incremental_stage = IncrementalStage::Epilogue;
+        return true;
+    }
+
+    // content ::= CharData? ((element | Reference | CDSect | PI | Comment) CharData?)*
+    if (remaining.starts_with("<!--"sv)) {
+        TRY(parse_comment());
+        return true;
+    }
+    if (remaining.starts_with("<![CDATA["sv)) {
+        auto text = TRY(parse_cdata_section());
+        if (m_options.preserve_cdata)
+            append_text(text, m_lexer.position_for(unit_start));
+        return true;
+    }
+    if (remaining.starts_with("<?"sv)) {
+        TRY(parse_processing_instruction());
+        return true;
+    }
+
+    if (remaining.starts_with('<')) {
+        if (auto result = parse_empty_element_tag(); !result.is_error()) {
+            auto& element = result.value()->content.get<Node::Element>();
+            m_listener->element_start(element.name, element.attributes);
+            m_listener->element_end(element.name);
+            if (m_open_element_names.is_empty())
+                m_incremental_stage = IncrementalStage::Epilogue;
+            return true;
+        }
+
+        auto start_tag = TRY(parse_start_tag());
+        auto& element = start_tag->content.get<Node::Element>();
+        m_listener->element_start(element.name, element.attributes);
+        m_open_element_names.append(move(element.name));
+        return true;
+    }
+
+    if (remaining.starts_with('&')) {
+        auto reference = TRY(parse_reference());
+        auto reference_offset = m_lexer.position_for(unit_start);
+        if (auto char_reference = reference.get_pointer<ByteString>())
+            append_text(*char_reference, reference_offset);
+        else
+            append_text(TRY(resolve_reference(reference.get<EntityReference>(), ReferencePlacement::Content)), reference_offset);
+        return true;
+    }
+
+    auto text = TRY(parse_char_data());
+    if (!m_input_closed && m_lexer.is_eof()) {
+        auto unfinished_length = length_of_unfinished_char_data(text);
+        m_lexer.retreat(unfinished_length);
+        text = text.substring_view(0, text.length() - unfinished_length);
+        if (text.is_empty())
+            return false;
+    } else if (text.is_empty()) {
+        return parse_error(m_lexer.current_position(), ByteString { "']]>' is not allowed in character data"sv });
+    }
+
+    append_text(text, m_lexer.position_for(unit_start));
+    return true;
+}
+
 ErrorOr<void, ParseError> Parser::expect(StringView expected)
 {
     auto rollback = rollback_point();
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <AK/ByteString.h>
 #include <AK/Debug.h>
 #include <AK/Function.h>
@@ -66,9 +67,30 @@ public:
     {
     }
 
+    // Creates a parser that is given its input in chunks with append_input() instead of all at once. Everything that is
+    // parsed is reported to the listener as soon as it has been received in full, and only the input that hasn't been
+    // parsed yet is kept in memory. No document is built, and the listener is not told about the source.
+    Parser(Listener& listener, Options options)
+        : m_lexer(StringView {})
+        , m_options(move(options))
+        , m_listener(&listener)
+        , m_is_incremental(true)
+    {
+    }
+
+    explicit Parser(Listener& listener)
+        : m_lexer(StringView {})
+        , m_listener(&listener)
+        , m_is_incremental(true)
+    {
+    }
+
     ErrorOr<Document, ParseError> parse();
     ErrorOr<void, ParseError> parse_with_listener(Listener&);
 
+    ErrorOr<void, ParseError> append_input(StringView);
+    ErrorOr<void, ParseError> close_input();
+
     Vector<ParseError> const& parse_error_causes() const { return m_parse_errors; }
 
     ErrorOr<Vector<MarkupDeclaration>, ParseError> parse_external_subset();
@@ -79,6 +101,22 @@ private:
     };
 
     ErrorOr<void, ParseError> parse_internal();
+
+    enum class IncrementalStage {
+        XMLDeclaration,
+        Prolog,
+        Content,
+        Epilogue,
+        Done,
+    };
+    enum class IncrementalMatch {
+        No,
+        Yes,
+        NeedMoreInput,
+    };
+    ErrorOr<void, ParseError> parse_incremental_input();
+    ErrorOr<bool, ParseError> parse_incremental_unit();
+    IncrementalMatch incremental_match(StringView) const;
     void append_node(NonnullOwnPtr<Node>);
     void append_text(StringView, LineTrackingLexer::Position);
     void append_comment(StringView, LineTrackingLexer::Position);
@@ -221,6 +259,16 @@ private:
     Vector<ParseError> m_parse_errors;
 
     Optional<Doctype> m_doctype;
+
+    bool m_is_incremental { false };
+    bool m_has_started_document { false };
+    bool m_input_closed { false };
+    bool m_has_seen_doctype { false };
+    IncrementalStage m_incremental_stage { IncrementalStage::XMLDeclaration };
+    ByteBuffer m_incremental_input;
+    LineTrackingLexer::Position m_incremental_input_position { 0, 1, 1 };
+    Vector<Name> m_open_element_names;
+    Optional<ParseError> m_incremental_error;
 };
 
 }
@@ -397,12 +397,14 @@ static void emit_includes_for_all_imports(auto& interface, auto& generator, bool
 }
 
 template<typename ParameterType>
-static void generate_to_string(SourceGenerator& scoped_generator, ParameterType const& parameter, bool variadic, bool optional, Optional<ByteString> const& optional_default_value)
+static void generate_to_string(SourceGenerator& scoped_generator, ParameterType const& parameter, bool variadic, bool optional, Optional<ByteString> const& optional_default_value, bool fly_string)
 {
     if (parameter.type->name() == "USVString") {
         scoped_generator.set("to_string", "to_usv_string"sv);
     } else if (parameter.type->name() == "ByteString") {
         scoped_generator.set("to_string", "to_byte_string"sv);
+    } else if (fly_string && !variadic) {
+        scoped_generator.set("to_string", "to_fly_string"sv);
     } else {
         scoped_generator.set("to_string", "to_string"sv);
     }
@@ -604,7 +606,7 @@ static void generate_to_cpp(SourceGenerator& generator, ParameterType& parameter
 
     // FIXME: Add support for optional, variadic, nullable and default values to all types
     if (parameter.type->is_string()) {
-        generate_to_string(scoped_generator, parameter, variadic, optional, optional_default_value);
+        generate_to_string(scoped_generator, parameter, variadic, optional, optional_default_value, string_to_fly_string);
     } else if (parameter.type->is_boolean() || parameter.type->is_integer()) {
         generate_to_integral(scoped_generator, parameter, optional, optional_default_value);
     } else if (parameter.type->name().is_one_of("EventListener", "NodeFilter")) {
@@ -3748,6 +3750,20 @@ static void generate_prototype_or_global_mixin_definitions(IDL::Interface const&
 [[maybe_unused]] static JS::ThrowCompletionOr<@fully_qualified_name@*> impl_from(JS::VM& vm)
 {
     auto this_value = vm.this_value();
+)~~~");
+
+        // OPTIMIZATION: Almost every call has an object of the right type as its this value, which we can return without
+        //               going through ToObject. Window and EventTarget have to look through the WindowProxy first.
+        if (!interface.name.is_one_of("EventTarget", "Window")) {
+            generator.append(R"~~~(
+    if (this_value.is_object()) [[likely]] {
+        if (auto* impl = as_if<@fully_qualified_name@>(this_value.as_object()))
+            return impl;
+    }
+)~~~");
+        }
+
+        generator.append(R"~~~(
     JS::Object* this_object = nullptr;
     if (this_value.is_nullish())
         this_object = &vm.current_realm()->global_object();
@@ -4778,6 +4794,7 @@ using namespace Web::PerformanceTimeline;
 using namespace Web::RequestIdleCallback;
 using namespace Web::ResizeObserver;
 using namespace Web::ResourceTiming;
+using namespace Web::Scheduling;
 using namespace Web::Selection;
 using namespace Web::ServiceWorker;
 using namespace Web::StorageAPI;
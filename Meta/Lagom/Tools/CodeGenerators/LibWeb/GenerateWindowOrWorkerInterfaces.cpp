@@ -228,6 +228,7 @@ static ErrorOr<void> generate_exposed_interface_implementation(StringView class_
     generator.set("global_object_snake_name", ByteString(class_name).to_snakecase());
 
     generator.append(R"~~~(
+#include <AK/Array.h>
 #include <LibJS/Runtime/Object.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/@global_object_name@ExposedInterfaces.h>
@@ -261,14 +262,16 @@ namespace Web::Bindings {
 void add_@global_object_snake_name@_exposed_interfaces(JS::Object& global)
 {
     static constexpr u8 attr = JS::Attribute::Writable | JS::Attribute::Configurable;
-)~~~");
+
+    // NOTE: The interface objects themselves are only created once the global property is first accessed.
+    static auto const intrinsic_accessors = to_array<JS::Object::IntrinsicAccessorDefinition>({)~~~");
 
     auto add_interface = [](SourceGenerator& gen, StringView name, StringView prototype_class, Optional<LegacyConstructor> const& legacy_constructor, Optional<ByteString const&> legacy_alias_name) {
         gen.set("interface_name", name);
         gen.set("prototype_class", prototype_class);
 
         gen.append(R"~~~(
-    global.define_intrinsic_accessor("@interface_name@"_fly_string, attr, [](auto& realm) -> JS::Value { return &ensure_web_constructor<@prototype_class@>(realm, "@interface_name@"_fly_string); });)~~~");
+        { "@interface_name@"_fly_string, [](auto& realm) -> JS::Value { return &ensure_web_constructor<@prototype_class@>(realm, "@interface_name@"_fly_string); } },)~~~");
 
         // https://webidl.spec.whatwg.org/#LegacyWindowAlias
         if (legacy_alias_name.has_value()) {
@@ -277,19 +280,19 @@ void add_@global_object_snake_name@_exposed_interfaces(JS::Object& global)
                 for (auto legacy_alias_name : legacy_alias_names) {
                     gen.set("interface_alias_name", legacy_alias_name.trim_whitespace());
                     gen.append(R"~~~(
-    global.define_intrinsic_accessor("@interface_alias_name@"_fly_string, attr, [](auto& realm) -> JS::Value { return &ensure_web_constructor<@prototype_class@>(realm, "@interface_name@"_fly_string); });)~~~");
+        { "@interface_alias_name@"_fly_string, [](auto& realm) -> JS::Value { return &ensure_web_constructor<@prototype_class@>(realm, "@interface_name@"_fly_string); } },)~~~");
                 }
             } else {
                 gen.set("interface_alias_name", *legacy_alias_name);
                 gen.append(R"~~~(
-    global.define_intrinsic_accessor("@interface_alias_name@"_fly_string, attr, [](auto& realm) -> JS::Value { return &ensure_web_constructor<@prototype_class@>(realm, "@interface_name@"_fly_string); });)~~~");
+        { "@interface_alias_name@"_fly_string, [](auto& realm) -> JS::Value { return &ensure_web_constructor<@prototype_class@>(realm, "@interface_name@"_fly_string); } },)~~~");
             }
         }
 
         if (legacy_constructor.has_value()) {
             gen.set("legacy_interface_name", legacy_constructor->name);
             gen.append(R"~~~(
-    global.define_intrinsic_accessor("@legacy_interface_name@"_fly_string, attr, [](auto& realm) -> JS::Value { return &ensure_web_constructor<@prototype_class@>(realm, "@legacy_interface_name@"_fly_string); });)~~~");
+        { "@legacy_interface_name@"_fly_string, [](auto& realm) -> JS::Value { return &ensure_web_constructor<@prototype_class@>(realm, "@legacy_interface_name@"_fly_string); } },)~~~");
         }
     };
 
@@ -298,7 +301,7 @@ void add_@global_object_snake_name@_exposed_interfaces(JS::Object& global)
         gen.set("namespace_class", namespace_class);
 
         gen.append(R"~~~(
-    global.define_intrinsic_accessor("@interface_name@"_fly_string, attr, [](auto& realm) -> JS::Value { return &ensure_web_namespace<@namespace_class@>(realm, "@interface_name@"_fly_string); });)~~~");
+        { "@interface_name@"_fly_string, [](auto& realm) -> JS::Value { return &ensure_web_namespace<@namespace_class@>(realm, "@interface_name@"_fly_string); } },)~~~");
     };
 
     for (auto& interface : exposed_interfaces) {
@@ -319,6 +322,9 @@ void add_@global_object_snake_name@_exposed_interfaces(JS::Object& global)
     }
 
     generator.append(R"~~~(
+    });
+
+    global.define_intrinsic_accessors(intrinsic_accessors, attr);
 }
 
 }
@@ -30,6 +30,18 @@ void ConnectionFromClient::die()
     }
     m_pending_jobs.clear();
 
+    for (auto& [_, animation] : m_active_animations) {
+        if (animation.pending_job)
+            animation.pending_job->cancel();
+    }
+    m_active_animations.clear();
+
+    for (auto& [_, incremental_decode] : m_incremental_decodes) {
+        if (incremental_decode.pending_job)
+            incremental_decode.pending_job->cancel();
+    }
+    m_incremental_decodes.clear();
+
     auto client_id = this->client_id();
     s_connections.remove(client_id);
     s_client_ids.deallocate(client_id);
@@ -84,11 +96,26 @@ Messages::ImageDecoderServer::ConnectNewClientsResponse ConnectionFromClient::co
     return files;
 }
 
-static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, Vector<RefPtr<Gfx::Bitmap>>& bitmaps, Vector<u32>& durations)
+// Animations whose frames would take up more than this much memory once decoded are decoded on demand instead.
+static constexpr size_t maximum_fully_decoded_animation_size = 64 * MiB;
+
+// How many frames are decoded at a time for animations that are decoded on demand.
+static constexpr u32 animation_frames_decoded_ahead = 8;
+
+static bool should_decode_frames_on_demand(Gfx::ImageDecoder const& decoder)
+{
+    if (!decoder.is_animated() || decoder.frame_count() <= animation_frames_decoded_ahead)
+        return false;
+
+    auto decoded_size = Checked<size_t>(decoder.width()) * decoder.height() * sizeof(Gfx::ARGB32) * decoder.frame_count();
+    return decoded_size.has_overflow() || decoded_size.value() > maximum_fully_decoded_animation_size;
+}
+
+static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, size_t first_frame_index, size_t count, Vector<RefPtr<Gfx::Bitmap>>& bitmaps, Vector<u32>& durations)
 {
-    bitmaps.ensure_capacity(decoder.frame_count());
-    durations.ensure_capacity(decoder.frame_count());
-    for (size_t i = 0; i < decoder.frame_count(); ++i) {
+    bitmaps.ensure_capacity(count);
+    durations.ensure_capacity(count);
+    for (size_t i = first_frame_index; i < first_frame_index + count; ++i) {
         auto frame_or_error = decoder.frame(i, ideal_size);
         if (frame_or_error.is_error()) {
             bitmaps.unchecked_append({});
@@ -134,7 +161,14 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
         }
     }
 
-    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, move(ideal_size), bitmaps, result.durations);
+    result.frame_count = decoder->frame_count();
+    auto frames_to_decode = decoder->frame_count();
+    if (should_decode_frames_on_demand(*decoder)) {
+        frames_to_decode = animation_frames_decoded_ahead;
+        result.animation_session = adopt_ref(*new ConnectionFromClient::AnimationSession(encoded_buffer, *decoder, ideal_size));
+    }
+
+    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, ideal_size, 0, frames_to_decode, bitmaps, result.durations);
 
     if (bitmaps.is_empty())
         return Error::from_string_literal("Could not decode image");
@@ -144,14 +178,31 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
     return result;
 }
 
-NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image_job(i64 image_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+static Threading::BackgroundActionPriority background_action_priority_for(ImageDecoderClient::DecodePriority priority)
+{
+    switch (priority) {
+    case ImageDecoderClient::DecodePriority::Offscreen:
+        return Threading::BackgroundActionPriority::Low;
+    case ImageDecoderClient::DecodePriority::NearViewport:
+        return Threading::BackgroundActionPriority::Normal;
+    case ImageDecoderClient::DecodePriority::Visible:
+        return Threading::BackgroundActionPriority::High;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image_job(i64 image_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, ImageDecoderClient::DecodePriority priority)
 {
     return Job::construct(
         [encoded_buffer = move(encoded_buffer), ideal_size = move(ideal_size), mime_type = move(mime_type)](auto&) -> ErrorOr<DecodeResult> {
             return TRY(decode_image_to_details(encoded_buffer, ideal_size, mime_type));
         },
         [strong_this = NonnullRefPtr(*this), image_id](DecodeResult result) -> ErrorOr<void> {
-            strong_this->async_did_decode_image(image_id, result.is_animated, result.loop_count, move(result.bitmaps), move(result.durations), result.scale, move(result.color_profile));
+            auto decodes_frames_on_demand = result.animation_session != nullptr;
+            if (decodes_frames_on_demand)
+                strong_this->m_active_animations.set(image_id, { result.animation_session.release_nonnull(), nullptr, {} });
+
+            strong_this->async_did_decode_image(image_id, result.is_animated, result.loop_count, result.frame_count, decodes_frames_on_demand, move(result.bitmaps), move(result.durations), result.scale, move(result.color_profile));
             strong_this->m_pending_jobs.remove(image_id);
             return {};
         },
@@ -159,10 +210,11 @@ NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image
             if (strong_this->is_open())
                 strong_this->async_did_fail_to_decode_image(image_id, MUST(String::formatted("Decoding failed: {}", error)));
             strong_this->m_pending_jobs.remove(image_id);
-        });
+        },
+        background_action_priority_for(priority));
 }
 
-Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, ImageDecoderClient::DecodePriority priority)
 {
     auto image_id = m_next_image_id++;
 
@@ -172,7 +224,7 @@ Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_i
         return image_id;
     }
 
-    m_pending_jobs.set(image_id, make_decode_image_job(image_id, move(encoded_buffer), ideal_size, move(mime_type)));
+    m_pending_jobs.set(image_id, make_decode_image_job(image_id, move(encoded_buffer), ideal_size, move(mime_type), priority));
 
     return image_id;
 }
@@ -184,4 +236,174 @@ void ConnectionFromClient::cancel_decoding(i64 image_id)
     }
 }
 
+NonnullRefPtr<ConnectionFromClient::FrameJob> ConnectionFromClient::make_decode_animation_frames_job(i64 image_id, NonnullRefPtr<AnimationSession> session, FrameRange range)
+{
+    return FrameJob::construct(
+        [session = move(session), range](auto&) -> ErrorOr<DecodedFrames> {
+            DecodedFrames result;
+            result.first_frame_index = range.first_frame_index;
+
+            Vector<RefPtr<Gfx::Bitmap>> bitmaps;
+            decode_image_to_bitmaps_and_durations_with_decoder(*session->decoder, session->ideal_size, range.first_frame_index, range.count, bitmaps, result.durations);
+            result.bitmaps = Gfx::BitmapSequence { move(bitmaps) };
+
+            return result;
+        },
+        [strong_this = NonnullRefPtr(*this), image_id](DecodedFrames result) -> ErrorOr<void> {
+            auto animation = strong_this->m_active_animations.get(image_id);
+            if (!animation.has_value())
+                return {};
+
+            strong_this->async_did_decode_animation_frames(image_id, result.first_frame_index, move(result.bitmaps), move(result.durations));
+
+            animation->pending_job = nullptr;
+            if (auto queued_request = animation->queued_request; queued_request.has_value()) {
+                animation->queued_request.clear();
+                animation->pending_job = strong_this->make_decode_animation_frames_job(image_id, animation->session, *queued_request);
+            }
+            return {};
+        },
+        [strong_this = NonnullRefPtr(*this), image_id](Error error) -> void {
+            dbgln("Failed to decode animation frames for image {}: {}", image_id, error);
+            if (auto animation = strong_this->m_active_animations.get(image_id); animation.has_value())
+                animation->pending_job = nullptr;
+        },
+        // NOTE: Frames are only requested for animations that are being painted.
+        Threading::BackgroundActionPriority::High);
+}
+
+void ConnectionFromClient::request_animation_frames(i64 image_id, u32 first_frame_index, u32 count)
+{
+    auto animation = m_active_animations.get(image_id);
+    if (!animation.has_value())
+        return;
+
+    auto frame_count = animation->session->decoder->frame_count();
+    if (first_frame_index >= frame_count)
+        return;
+
+    FrameRange range { first_frame_index, min(min(count, animation_frames_decoded_ahead), static_cast<u32>(frame_count - first_frame_index)) };
+    if (range.count == 0)
+        return;
+
+    // Only the most recent request matters once the decoder is free again, as older ones are for frames that have
+    // probably been shown already.
+    if (animation->pending_job) {
+        animation->queued_request = range;
+        return;
+    }
+
+    animation->pending_job = make_decode_animation_frames_job(image_id, animation->session, range);
+}
+
+void ConnectionFromClient::release_animation(i64 image_id)
+{
+    if (auto animation = m_active_animations.take(image_id); animation.has_value()) {
+        if (animation->pending_job)
+            animation->pending_job->cancel();
+    }
+}
+
+// Every partial decode starts over from the beginning of the data, so an image is only decoded again once a good chunk
+// of new data has arrived. Growing that chunk with the data keeps the total work linear in the size of the image.
+static constexpr size_t minimum_new_data_for_partial_decode = 16 * KiB;
+
+static bool has_enough_new_data_for_partial_decode(size_t decoded_size, size_t available_size)
+{
+    auto new_data_size = available_size - decoded_size;
+    return new_data_size >= max(minimum_new_data_for_partial_decode, decoded_size / 4);
+}
+
+static ErrorOr<ConnectionFromClient::PartialDecodeResult> decode_partial_image(ReadonlyBytes encoded_data)
+{
+    auto decoder = TRY(Gfx::ImageDecoder::try_create_for_partial_raw_bytes(encoded_data));
+    if (!decoder)
+        return Error::from_string_literal("Could not find image decoder plugin that supports partial data");
+
+    auto frame = TRY(decoder->frame(0));
+
+    ConnectionFromClient::PartialDecodeResult result;
+    if (auto color_space = decoder->color_space(); !color_space.is_error())
+        result.color_profile = color_space.release_value();
+
+    Vector<RefPtr<Gfx::Bitmap>> bitmaps;
+    bitmaps.append(move(frame.image));
+    result.bitmaps = Gfx::BitmapSequence { move(bitmaps) };
+    return result;
+}
+
+NonnullRefPtr<ConnectionFromClient::PartialJob> ConnectionFromClient::make_partial_decode_job(i64 session_id, ByteBuffer encoded_data)
+{
+    return PartialJob::construct(
+        [encoded_data = move(encoded_data)](auto&) -> ErrorOr<PartialDecodeResult> {
+            return TRY(decode_partial_image(encoded_data));
+        },
+        [strong_this = NonnullRefPtr(*this), session_id](PartialDecodeResult result) -> ErrorOr<void> {
+            if (!strong_this->m_incremental_decodes.contains(session_id))
+                return {};
+
+            strong_this->async_did_decode_partial_image(session_id, move(result.bitmaps), move(result.color_profile));
+            strong_this->m_incremental_decodes.get(session_id)->pending_job = nullptr;
+            strong_this->start_partial_decode_if_needed(session_id);
+            return {};
+        },
+        [strong_this = NonnullRefPtr(*this), session_id](Error error) -> void {
+            // NOTE: Not having enough data yet is expected early on, so simply try again once more has arrived.
+            dbgln_if(IMAGE_DECODER_DEBUG, "Partial decode of session {} failed: {}", session_id, error);
+            if (auto incremental_decode = strong_this->m_incremental_decodes.get(session_id); incremental_decode.has_value()) {
+                incremental_decode->pending_job = nullptr;
+                strong_this->start_partial_decode_if_needed(session_id);
+            }
+        });
+}
+
+void ConnectionFromClient::start_partial_decode_if_needed(i64 session_id)
+{
+    auto incremental_decode = m_incremental_decodes.get(session_id);
+    if (!incremental_decode.has_value() || incremental_decode->pending_job)
+        return;
+
+    auto& encoded_data = incremental_decode->encoded_data;
+    if (!has_enough_new_data_for_partial_decode(incremental_decode->decoded_size, encoded_data.size()))
+        return;
+
+    auto encoded_data_copy = ByteBuffer::copy(encoded_data.bytes());
+    if (encoded_data_copy.is_error()) {
+        dbgln("Could not copy encoded data for partial decode: {}", encoded_data_copy.error());
+        return;
+    }
+
+    incremental_decode->decoded_size = encoded_data.size();
+    incremental_decode->pending_job = make_partial_decode_job(session_id, encoded_data_copy.release_value());
+}
+
+Messages::ImageDecoderServer::StartIncrementalDecodeResponse ConnectionFromClient::start_incremental_decode()
+{
+    auto session_id = m_next_image_id++;
+    m_incremental_decodes.set(session_id, {});
+    return session_id;
+}
+
+void ConnectionFromClient::append_incremental_decode_data(i64 session_id, Core::AnonymousBuffer data)
+{
+    auto incremental_decode = m_incremental_decodes.get(session_id);
+    if (!incremental_decode.has_value() || !data.is_valid())
+        return;
+
+    if (auto result = incremental_decode->encoded_data.try_append(data.data<u8>(), data.size()); result.is_error()) {
+        dbgln("Could not append encoded data to incremental decode: {}", result.error());
+        return;
+    }
+
+    start_partial_decode_if_needed(session_id);
+}
+
+void ConnectionFromClient::end_incremental_decode(i64 session_id)
+{
+    if (auto incremental_decode = m_incremental_decodes.take(session_id); incremental_decode.has_value()) {
+        if (incremental_decode->pending_job)
+            incremental_decode->pending_job->cancel();
+    }
+}
+
 }
@@ -6,12 +6,14 @@
 
 #pragma once
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/HashMap.h>
 #include <ImageDecoder/Forward.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
 #include <LibGfx/BitmapSequence.h>
 #include <LibGfx/ColorSpace.h>
+#include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibThreading/BackgroundAction.h>
 
@@ -26,31 +28,91 @@ public:
 
     virtual void die() override;
 
+    // Large animations are not decoded all at once. Instead, the decoder is kept around so that the client can ask for
+    // frames shortly before it needs to show them.
+    struct AnimationSession : public AtomicRefCounted<AnimationSession> {
+        AnimationSession(Core::AnonymousBuffer encoded_buffer, NonnullRefPtr<Gfx::ImageDecoder> decoder, Optional<Gfx::IntSize> ideal_size)
+            : encoded_buffer(move(encoded_buffer))
+            , decoder(move(decoder))
+            , ideal_size(ideal_size)
+        {
+        }
+
+        Core::AnonymousBuffer encoded_buffer;
+        NonnullRefPtr<Gfx::ImageDecoder> decoder;
+        Optional<Gfx::IntSize> ideal_size;
+    };
+
     struct DecodeResult {
         bool is_animated = false;
         u32 loop_count = 0;
+        u32 frame_count = 0;
         Gfx::FloatPoint scale { 1, 1 };
         Gfx::BitmapSequence bitmaps;
         Vector<u32> durations;
         Gfx::ColorSpace color_profile;
+        RefPtr<AnimationSession> animation_session;
+    };
+
+    struct DecodedFrames {
+        u32 first_frame_index = 0;
+        Gfx::BitmapSequence bitmaps;
+        Vector<u32> durations;
+    };
+
+    struct PartialDecodeResult {
+        Gfx::BitmapSequence bitmaps;
+        Gfx::ColorSpace color_profile;
     };
 
 private:
     using Job = Threading::BackgroundAction<DecodeResult>;
+    using FrameJob = Threading::BackgroundAction<DecodedFrames>;
+    using PartialJob = Threading::BackgroundAction<PartialDecodeResult>;
+
+    struct FrameRange {
+        u32 first_frame_index { 0 };
+        u32 count { 0 };
+    };
+
+    // Frames of one animation are decoded one request at a time, as the decoder isn't safe to use from two threads.
+    struct ActiveAnimation {
+        NonnullRefPtr<AnimationSession> session;
+        RefPtr<FrameJob> pending_job;
+        Optional<FrameRange> queued_request;
+    };
+
+    // The encoded data of an image that is still being downloaded. Whatever has arrived so far is decoded into a
+    // partial bitmap for the client to paint, one decode at a time.
+    struct IncrementalDecode {
+        ByteBuffer encoded_data;
+        size_t decoded_size { 0 };
+        RefPtr<PartialJob> pending_job;
+    };
 
     explicit ConnectionFromClient(NonnullOwnPtr<IPC::Transport>);
 
-    virtual Messages::ImageDecoderServer::DecodeImageResponse decode_image(Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type) override;
+    virtual Messages::ImageDecoderServer::DecodeImageResponse decode_image(Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, ImageDecoderClient::DecodePriority) override;
     virtual void cancel_decoding(i64 image_id) override;
+    virtual void request_animation_frames(i64 image_id, u32 first_frame_index, u32 count) override;
+    virtual void release_animation(i64 image_id) override;
+    virtual Messages::ImageDecoderServer::StartIncrementalDecodeResponse start_incremental_decode() override;
+    virtual void append_incremental_decode_data(i64 session_id, Core::AnonymousBuffer) override;
+    virtual void end_incremental_decode(i64 session_id) override;
     virtual Messages::ImageDecoderServer::ConnectNewClientsResponse connect_new_clients(size_t count) override;
     virtual Messages::ImageDecoderServer::InitTransportResponse init_transport(int peer_pid) override;
 
     ErrorOr<IPC::File> connect_new_client();
 
-    NonnullRefPtr<Job> make_decode_image_job(i64 image_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type);
+    NonnullRefPtr<Job> make_decode_image_job(i64 image_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, ImageDecoderClient::DecodePriority);
+    NonnullRefPtr<FrameJob> make_decode_animation_frames_job(i64 image_id, NonnullRefPtr<AnimationSession>, FrameRange);
+    NonnullRefPtr<PartialJob> make_partial_decode_job(i64 session_id, ByteBuffer encoded_data);
+    void start_partial_decode_if_needed(i64 session_id);
 
     i64 m_next_image_id { 0 };
     HashMap<i64, NonnullRefPtr<Job>> m_pending_jobs;
+    HashMap<i64, ActiveAnimation> m_active_animations;
+    HashMap<i64, IncrementalDecode> m_incremental_decodes;
 };
 
 }
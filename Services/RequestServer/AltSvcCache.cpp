@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <RequestServer/AltSvcCache.h>
+
+namespace RequestServer {
+
+// https://httpwg.org/specs/rfc7838.html#alt-svc
+static constexpr i64 default_max_age_seconds = 24 * 60 * 60;
+
+static Optional<i64> http3_max_age_for_same_authority(StringView alt_svc, URL::URL const& url)
+{
+    auto host = url.serialized_host().to_byte_string();
+    auto port = url.port_or_default();
+
+    for (auto alternative : alt_svc.split_view(',')) {
+        auto parts = alternative.split_view(';');
+        if (parts.is_empty())
+            continue;
+
+        auto protocol_and_authority = parts[0].trim_whitespace();
+        auto equals = protocol_and_authority.find('=');
+        if (!equals.has_value())
+            continue;
+
+        // NOTE: Only the final version of HTTP/3 is supported, not any of the drafts that preceded it.
+        if (protocol_and_authority.substring_view(0, *equals) != "h3"sv)
+            continue;
+
+        auto authority = protocol_and_authority.substring_view(*equals + 1).trim("\""sv);
+        auto colon = authority.find_last(':');
+        if (!colon.has_value())
+            continue;
+
+        // We can only ask curl to use HTTP/3 for the origin's own host and port, so alternatives that point elsewhere
+        // are ignored.
+        auto alternative_host = authority.substring_view(0, *colon);
+        auto alternative_port = authority.substring_view(*colon + 1).to_number<u16>();
+        if (!alternative_host.is_empty() && !alternative_host.equals_ignoring_ascii_case(host))
+            continue;
+        if (alternative_port != port)
+            continue;
+
+        auto max_age = default_max_age_seconds;
+        for (auto parameter : parts.span().slice(1)) {
+            auto name_and_value = parameter.trim_whitespace();
+            if (!name_and_value.starts_with("ma="sv))
+                continue;
+            if (auto value = name_and_value.substring_view(3).trim("\""sv).to_number<i64>(); value.has_value())
+                max_age = *value;
+        }
+
+        return max_age;
+    }
+
+    return {};
+}
+
+void AltSvcCache::note_response(URL::URL const& url, HTTP::HeaderMap const& response_headers)
+{
+    if (url.scheme() != "https"sv)
+        return;
+
+    auto alt_svc = response_headers.get("Alt-Svc"sv);
+    if (!alt_svc.has_value())
+        return;
+
+    auto origin = url.origin().serialize().to_byte_string();
+
+    // A new advertisement replaces whatever the origin told us before, including the special value "clear".
+    auto max_age = http3_max_age_for_same_authority(*alt_svc, url);
+    if (!max_age.has_value() || *max_age <= 0) {
+        m_http3_origins.remove(origin);
+        return;
+    }
+
+    if (m_http3_origins.size() >= maximum_origins && !m_http3_origins.contains(origin)) {
+        auto soonest_expiring = m_http3_origins.begin();
+        for (auto it = m_http3_origins.begin(); it != m_http3_origins.end(); ++it) {
+            if (it->value < soonest_expiring->value)
+                soonest_expiring = it;
+        }
+        m_http3_origins.remove(soonest_expiring);
+    }
+
+    m_http3_origins.set(move(origin), UnixDateTime::now() + AK::Duration::from_seconds(*max_age));
+}
+
+bool AltSvcCache::should_attempt_http3(URL::URL const& url)
+{
+    if (url.scheme() != "https"sv)
+        return false;
+
+    auto it = m_http3_origins.find(url.origin().serialize().to_byte_string());
+    if (it == m_http3_origins.end())
+        return false;
+
+    if (it->value < UnixDateTime::now()) {
+        m_http3_origins.remove(it);
+        return false;
+    }
+
+    return true;
+}
+
+}
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/Time.h>
+#include <LibHTTP/HeaderMap.h>
+#include <LibURL/URL.h>
+
+namespace RequestServer {
+
+// Remembers which origins have advertised an HTTP/3 endpoint, so that later requests to them can be made over QUIC.
+// https://httpwg.org/specs/rfc7838.html
+class AltSvcCache {
+public:
+    void note_response(URL::URL const&, HTTP::HeaderMap const& response_headers);
+    bool should_attempt_http3(URL::URL const&);
+
+private:
+    static constexpr size_t maximum_origins = 1024;
+
+    HashMap<ByteString, UnixDateTime> m_http3_origins;
+};
+
+}
@@ -11,8 +11,10 @@
 #include <AK/NonnullOwnPtr.h>
 #include <LibCore/ElapsedTimer.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
 #include <LibCore/Proxy.h>
 #include <LibCore/Socket.h>
+#include <LibCore/System.h>
 #include <LibRequests/NetworkError.h>
 #include <LibRequests/RequestTimingInfo.h>
 #include <LibRequests/WebSocket.h>
@@ -20,7 +22,10 @@
 #include <LibTextCodec/Decoder.h>
 #include <LibWebSocket/ConnectionInfo.h>
 #include <LibWebSocket/Message.h>
+#include <RequestServer/AltSvcCache.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/ConnectionPredictor.h>
+#include <RequestServer/DiskCache.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #ifdef AK_OS_WINDOWS
 // needed because curl.h includes winsock2.h
@@ -31,9 +36,48 @@
 namespace RequestServer {
 
 ByteString g_default_certificate_path;
+OwnPtr<DiskCache> g_disk_cache;
+OwnPtr<ConnectionPredictor> g_connection_predictor;
+Optional<ByteString> g_dns_cache_path;
 static HashMap<int, RefPtr<ConnectionFromClient>> s_connections;
+static AltSvcCache s_alt_svc_cache;
 static IDAllocator s_client_ids;
 static long s_connect_timeout_seconds = 90L;
+
+// Low priority requests (images, media) are held back while other requests are in flight, so that they don't compete
+// with the resources the page needs to render for bandwidth or, over HTTP/1.1, for the few connections curl makes to
+// each host.
+static constexpr size_t maximum_delayable_requests = 10;
+static constexpr size_t maximum_delayable_requests_per_host = 6;
+static constexpr size_t maximum_delayable_requests_while_render_blocking = 2;
+
+static bool is_delayable(RequestPriority priority)
+{
+    return priority <= RequestPriority::Low;
+}
+
+// Once this much response data is waiting for the client to read it, we stop receiving that response until the client
+// catches up. Otherwise a client that can't keep up with a bulk download would have us decrypt and decompress all of it
+// up front, at the expense of every other request we're serving.
+static constexpr size_t maximum_buffered_response_size = 1 * MiB;
+
+// https://httpwg.org/specs/rfc7540.html#StreamPriority
+static long http2_stream_weight_for(RequestPriority priority)
+{
+    switch (priority) {
+    case RequestPriority::Highest:
+        return 256;
+    case RequestPriority::High:
+        return 220;
+    case RequestPriority::Medium:
+        return 183;
+    case RequestPriority::Low:
+        return 147;
+    case RequestPriority::Lowest:
+        return 110;
+    }
+    VERIFY_NOT_REACHED();
+}
 static struct {
     Optional<Core::SocketAddress> server_address;
     Optional<ByteString> server_hostname;
@@ -42,6 +86,123 @@ static struct {
     bool validate_dnssec_locally = false;
 } g_dns_info;
 
+// The DNS cache is stored as "<name>\t<address>\t<expiration>" lines, so that a restarted RequestServer can connect
+// to recently used hosts straight away. Expired addresses are still useful, as the resolver will answer with them
+// while it looks up fresh ones.
+static void load_dns_cache(DNS::Resolver& resolver)
+{
+    if (!g_dns_cache_path.has_value())
+        return;
+
+    auto file = Core::File::open(*g_dns_cache_path, Core::File::OpenMode::Read);
+    if (file.is_error())
+        return;
+
+    auto contents = file.value()->read_until_eof();
+    if (contents.is_error())
+        return;
+
+    HashMap<ByteString, Vector<DNS::CachedAddress>> cached_addresses;
+    for (auto line : StringView { contents.value() }.split_view('\n')) {
+        auto parts = line.split_view('\t');
+        if (parts.size() != 3)
+            continue;
+
+        auto expiration = parts[2].to_number<i64>();
+        if (!expiration.has_value())
+            continue;
+
+        Optional<Variant<IPv4Address, IPv6Address>> address;
+        if (auto v4 = IPv4Address::from_string(parts[1]); v4.has_value())
+            address = v4.release_value();
+        else if (auto v6 = IPv6Address::from_string(parts[1]); v6.has_value())
+            address = v6.release_value();
+        if (!address.has_value())
+            continue;
+
+        cached_addresses.ensure(parts[0]).append({ address.release_value(), UnixDateTime::from_seconds_since_epoch(*expiration) });
+    }
+
+    for (auto const& [name, addresses] : cached_addresses)
+        resolver.add_cached_addresses(name, addresses);
+}
+
+static void save_dns_cache(DNS::Resolver& resolver)
+{
+    if (!g_dns_cache_path.has_value())
+        return;
+
+    StringBuilder builder;
+    for (auto const& [name, addresses] : resolver.cached_addresses_with_expiration()) {
+        for (auto const& cached_address : addresses) {
+            auto formatted_address = cached_address.address.visit(
+                [](IPv4Address const& ipv4) { return ipv4.to_byte_string(); },
+                [](IPv6Address const& ipv6) { return MUST(ipv6.to_string()).to_byte_string(); });
+            builder.appendff("{}\t{}\t{}\n", name, formatted_address, cached_address.expiration.seconds_since_epoch());
+        }
+    }
+
+    auto result = [&]() -> ErrorOr<void> {
+        auto temporary_path = ByteString::formatted("{}.tmp", *g_dns_cache_path);
+        {
+            auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+            TRY(file->write_until_depleted(builder.string_view().bytes()));
+        }
+        TRY(Core::System::rename(temporary_path, *g_dns_cache_path));
+        return {};
+    }();
+
+    if (result.is_error())
+        dbgln("Unable to write DNS cache: {}", result.error());
+}
+
+// TLS sessions are shared between every client loading resources for the same top-level site, so that reconnecting to
+// an origin from any tab can resume an earlier session rather than doing a full handshake. Keeping them per site means
+// a resumed session can't be used to link visits to different sites.
+static constexpr size_t maximum_tls_session_shares = 64;
+static HashMap<ByteString, CURLSH*> s_tls_session_shares;
+
+static CURLSH* tls_session_share_for(ByteString const& partition_key)
+{
+    if (partition_key.is_empty())
+        return nullptr;
+
+    if (auto share = s_tls_session_shares.get(partition_key); share.has_value())
+        return *share;
+
+    // Make room by dropping a share that no request is using anymore.
+    if (s_tls_session_shares.size() >= maximum_tls_session_shares) {
+        Optional<ByteString> unused_partition_key;
+        for (auto const& [key, share] : s_tls_session_shares) {
+            if (curl_share_cleanup(share) == CURLSHE_OK) {
+                unused_partition_key = key;
+                break;
+            }
+        }
+        if (!unused_partition_key.has_value())
+            return nullptr;
+        s_tls_session_shares.remove(*unused_partition_key);
+    }
+
+    auto* share = curl_share_init();
+    if (!share)
+        return nullptr;
+
+    if (curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION) != CURLSHE_OK) {
+        curl_share_cleanup(share);
+        return nullptr;
+    }
+
+    s_tls_session_shares.set(partition_key, share);
+    return share;
+}
+
+static bool curl_supports_http3()
+{
+    static bool const supports_http3 = (curl_version_info(CURLVERSION_NOW)->features & CURL_VERSION_HTTP3) != 0;
+    return supports_http3;
+}
+
 static WeakPtr<Resolver> s_resolver {};
 static NonnullRefPtr<Resolver> default_resolver()
 {
@@ -77,16 +238,43 @@ static NonnullRefPtr<Resolver> default_resolver()
         };
     });
 
+    load_dns_cache(resolver->dns);
+
     s_resolver = resolver;
     return resolver;
 }
 
+// https://www.rfc-editor.org/rfc/rfc8305#section-4
+static Vector<Variant<IPv4Address, IPv6Address>> sort_addresses_for_connection_attempts(Vector<Variant<IPv4Address, IPv6Address>> const& addresses)
+{
+    Vector<Variant<IPv4Address, IPv6Address>> ipv6_addresses;
+    Vector<Variant<IPv4Address, IPv6Address>> ipv4_addresses;
+    for (auto const& address : addresses) {
+        if (address.has<IPv6Address>())
+            ipv6_addresses.append(address);
+        else
+            ipv4_addresses.append(address);
+    }
+
+    // Interleave the address families, starting with IPv6. curl attempts the family of the first address first, and
+    // only falls back to the other one if that hasn't connected within the happy eyeballs timeout.
+    Vector<Variant<IPv4Address, IPv6Address>> result;
+    result.ensure_capacity(addresses.size());
+    for (size_t i = 0; i < max(ipv6_addresses.size(), ipv4_addresses.size()); ++i) {
+        if (i < ipv6_addresses.size())
+            result.unchecked_append(ipv6_addresses[i]);
+        if (i < ipv4_addresses.size())
+            result.unchecked_append(ipv4_addresses[i]);
+    }
+    return result;
+}
+
 ByteString build_curl_resolve_list(DNS::LookupResult const& dns_result, StringView host, u16 port)
 {
     StringBuilder resolve_opt_builder;
     resolve_opt_builder.appendff("{}:{}:", host, port);
     auto first = true;
-    for (auto& addr : dns_result.cached_addresses()) {
+    for (auto& addr : sort_addresses_for_connection_attempts(dns_result.cached_addresses())) {
         auto formatted_address = addr.visit(
             [&](IPv4Address const& ipv4) { return ipv4.to_byte_string(); },
             [&](IPv6Address const& ipv6) { return MUST(ipv6.to_string()).to_byte_string(); });
@@ -117,6 +305,26 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
     NonnullRefPtr<Core::Notifier> write_notifier;
     bool done_fetching { false };
 
+    RequestPriority priority { RequestPriority::Medium };
+    ByteString host;
+    bool is_added_to_multi { false };
+    bool is_paused_until_client_catches_up { false };
+
+    // These measure what happens before curl sees the request, in microseconds since start_request.
+    MonotonicTime start_time { MonotonicTime::now() };
+    i64 domain_lookup_end_microseconds { 0 };
+    i64 transfer_start_microseconds { 0 };
+
+    ByteString cache_partition_key;
+    URL::URL cache_url;
+    bool may_store_in_disk_cache { false };
+    u32 status_code { 0 };
+    ByteBuffer disk_cache_body;
+    Optional<DiskCacheEntry> cache_entry;
+    ReadonlyBytes cached_body_to_send;
+
+    OwnPtr<Core::LocalSocket> request_body_stream;
+
     ActiveRequest(ConnectionFromClient& client, CURLM* multi, CURL* easy, i32 request_id, int writer_fd)
         : multi(multi)
         , easy(easy)
@@ -145,8 +353,15 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
 
     ErrorOr<void> write_queued_bytes_without_blocking()
     {
-        Vector<u8> bytes_to_send;
-        bytes_to_send.resize(send_buffer.used_buffer_size());
+        if (send_buffer.is_eof() && !cached_body_to_send.is_empty())
+            return write_cached_body_without_blocking();
+
+        // NOTE: The pipe to the client only accepts a limited amount of data per write, so we only gather that much of
+        //       the queued data rather than copying all of it out every time the pipe becomes writable.
+        static constexpr size_t maximum_write_size = 256 * KiB;
+        static u8 buffer[maximum_write_size];
+
+        Bytes bytes_to_send { buffer, min(send_buffer.used_buffer_size(), maximum_write_size) };
         send_buffer.peek_some(bytes_to_send);
         auto result = Core::System::write(this->writer_fd, bytes_to_send);
         if (result.is_error()) {
@@ -162,13 +377,48 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         if (send_buffer.is_eof() && done_fetching)
             schedule_self_destruction();
 
+        if (is_paused_until_client_catches_up && send_buffer.used_buffer_size() < maximum_buffered_response_size / 2) {
+            is_paused_until_client_catches_up = false;
+            auto pause_result = curl_easy_pause(easy, CURLPAUSE_CONT);
+            VERIFY(pause_result == CURLE_OK);
+        }
+
         return {};
     }
 
+    // Bodies served from the disk cache are written to the client straight out of the entry's file mapping, rather
+    // than being copied into the send buffer first.
+    ErrorOr<void> write_cached_body_without_blocking()
+    {
+        auto result = Core::System::write(this->writer_fd, cached_body_to_send);
+        if (result.is_error()) {
+            if (result.error().code() != EAGAIN) {
+                return result.release_error();
+            }
+            write_notifier->set_enabled(true);
+            return {};
+        }
+
+        cached_body_to_send = cached_body_to_send.slice(result.value());
+        write_notifier->set_enabled(!cached_body_to_send.is_empty());
+        if (cached_body_to_send.is_empty() && done_fetching)
+            schedule_self_destruction();
+
+        return {};
+    }
+
+    void add_to_multi()
+    {
+        transfer_start_microseconds = (MonotonicTime::now() - start_time).to_microseconds();
+        auto result = curl_multi_add_handle(multi, easy);
+        VERIFY(result == CURLM_OK);
+        is_added_to_multi = true;
+    }
+
     void notify_about_fetching_completion()
     {
         done_fetching = true;
-        if (send_buffer.is_eof())
+        if (send_buffer.is_eof() && cached_body_to_send.is_empty())
             schedule_self_destruction();
     }
 
@@ -181,9 +431,12 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         if (writer_fd > 0)
             MUST(Core::System::close(writer_fd));
 
-        auto result = curl_multi_remove_handle(multi, easy);
-        VERIFY(result == CURLM_OK);
-        curl_easy_cleanup(easy);
+        // NOTE: Requests served from the disk cache never had an easy handle.
+        if (easy) {
+            auto result = curl_multi_remove_handle(multi, easy);
+            VERIFY(result == CURLM_OK);
+            curl_easy_cleanup(easy);
+        }
 
         for (auto* string_list : curl_string_lists)
             curl_slist_free_all(string_list);
@@ -197,8 +450,48 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         long http_status_code = 0;
         auto result = curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &http_status_code);
         VERIFY(result == CURLE_OK);
+        status_code = static_cast<u32>(http_status_code);
+
+        s_alt_svc_cache.note_response(cache_url, headers);
+
+        if (cache_entry.has_value()) {
+            // The server confirmed our stale entry is still good, so we serve its body from the disk cache.
+            if (status_code == 304) {
+                // The entry was refreshed in place, and there is no body to store over it.
+                may_store_in_disk_cache = false;
+                g_disk_cache->update_entry_after_revalidation(*cache_entry, headers);
+                client->async_headers_became_available(request_id, cache_entry->response_headers(), cache_entry->status_code(), cache_entry->reason_phrase());
+
+                cached_body_to_send = cache_entry->body();
+                downloaded_so_far = cached_body_to_send.size();
+                if (auto maybe_error = write_queued_bytes_without_blocking(); maybe_error.is_error())
+                    dbgln("Warning: Failed to write cached response data (it's likely the client disappeared): {}", maybe_error.error());
+                return;
+            }
+
+            cache_entry.clear();
+        }
+
+        if (may_store_in_disk_cache && !DiskCache::is_storable_response(status_code, headers))
+            may_store_in_disk_cache = false;
+
         client->async_headers_became_available(request_id, headers, http_status_code, reason_phrase);
     }
+
+    void resume_upload()
+    {
+        request_body_stream->set_notifications_enabled(false);
+        auto result = curl_easy_pause(easy, CURLPAUSE_CONT);
+        VERIFY(result == CURLE_OK);
+    }
+
+    void store_in_disk_cache_if_needed()
+    {
+        if (!may_store_in_disk_cache)
+            return;
+        may_store_in_disk_cache = false;
+        g_disk_cache->store_entry(cache_partition_key, cache_url, status_code, reason_phrase, headers, disk_cache_body);
+    }
 };
 
 size_t ConnectionFromClient::on_header_received(void* buffer, size_t size, size_t nmemb, void* user_data)
@@ -238,12 +531,35 @@ size_t ConnectionFromClient::on_data_received(void* buffer, size_t size, size_t
     auto* request = static_cast<ActiveRequest*>(user_data);
     request->flush_headers_if_needed();
 
+    // NOTE: curl holds on to this data while we're paused and hands it to us again once we resume.
+    if (request->send_buffer.used_buffer_size() >= maximum_buffered_response_size) {
+        request->is_paused_until_client_catches_up = true;
+        return CURL_WRITEFUNC_PAUSE;
+    }
+
     size_t total_size = size * nmemb;
     ReadonlyBytes bytes { static_cast<u8 const*>(buffer), total_size };
 
     auto maybe_write_error = [&] -> ErrorOr<void> {
-        TRY(request->send_buffer.write_some(bytes));
-        return request->write_queued_bytes_without_blocking();
+        // If nothing is queued ahead of this data, hand it to the client straight from curl's buffer, and only queue
+        // whatever the pipe doesn't take right away.
+        auto unwritten_bytes = bytes;
+        if (request->send_buffer.is_eof()) {
+            auto result = Core::System::write(request->writer_fd, unwritten_bytes);
+            if (result.is_error()) {
+                if (result.error().code() != EAGAIN)
+                    return result.release_error();
+            } else {
+                unwritten_bytes = unwritten_bytes.slice(result.value());
+            }
+        }
+
+        if (unwritten_bytes.is_empty())
+            return {};
+
+        TRY(request->send_buffer.write_until_depleted(unwritten_bytes));
+        request->write_notifier->set_enabled(true);
+        return {};
     }();
 
     if (maybe_write_error.is_error()) {
@@ -251,10 +567,36 @@ size_t ConnectionFromClient::on_data_received(void* buffer, size_t size, size_t
         return CURL_WRITEFUNC_ERROR;
     }
 
+    if (request->may_store_in_disk_cache) {
+        if (request->disk_cache_body.size() + total_size > DiskCache::maximum_entry_size || request->disk_cache_body.try_append(bytes).is_error()) {
+            request->may_store_in_disk_cache = false;
+            request->disk_cache_body.clear();
+        }
+    }
+
     request->downloaded_so_far += total_size;
     return total_size;
 }
 
+size_t ConnectionFromClient::on_request_body_requested(char* buffer, size_t size, size_t nmemb, void* user_data)
+{
+    auto* request = static_cast<ActiveRequest*>(user_data);
+
+    auto result = request->request_body_stream->read_some({ buffer, size * nmemb });
+    if (result.is_error()) {
+        // The client hasn't written the next part of the body yet, so we pause the upload until it has.
+        if (result.error().is_errno() && result.error().code() == EAGAIN) {
+            request->request_body_stream->set_notifications_enabled(true);
+            return CURL_READFUNC_PAUSE;
+        }
+
+        dbgln("ConnectionFromClient::on_request_body_requested: Aborting request because error occurred whilst reading the request body: {}", result.error());
+        return CURL_READFUNC_ABORT;
+    }
+
+    return result.value().size();
+}
+
 int ConnectionFromClient::on_socket_callback(CURL*, int sockfd, int what, void* user_data, void*)
 {
     auto* client = static_cast<ConnectionFromClient*>(user_data);
@@ -348,8 +690,14 @@ void ConnectionFromClient::die()
     s_connections.remove(client_id);
     s_client_ids.deallocate(client_id);
 
-    if (s_connections.is_empty())
+    if (s_connections.is_empty()) {
+        save_dns_cache(m_resolver->dns);
+        if (g_disk_cache)
+            g_disk_cache->flush_index();
+        if (g_connection_predictor)
+            g_connection_predictor->flush();
         Core::EventLoop::current().quit(0);
+    }
 }
 
 Messages::RequestServer::InitTransportResponse ConnectionFromClient::init_transport([[maybe_unused]] int peer_pid)
@@ -426,14 +774,41 @@ void ConnectionFromClient::set_use_system_dns()
 }
 
 #ifdef AK_OS_WINDOWS
-void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData)
+void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Optional<IPC::File>, u64, Core::ProxyData, ByteString, RequestPriority, bool)
 {
     VERIFY(0 && "RequestServer::ConnectionFromClient::start_request is not implemented");
 }
 #else
-void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data)
+void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Optional<IPC::File> request_body_stream, u64 request_body_stream_size, Core::ProxyData proxy_data, ByteString cache_partition_key, RequestPriority priority, bool allow_tls_early_data)
 {
+    // If this starts a navigation to a site we've seen before, warm up the origins it is likely to fetch from next.
+    // Resolving through our own resolver primes the DNS cache that requests use; the connect-only request warms up the
+    // TCP and TLS handshakes.
+    if (g_connection_predictor) {
+        for (auto const& origin : g_connection_predictor->note_request(cache_partition_key, url)) {
+            ensure_connection(origin, CacheLevel::ResolveOnly);
+            ensure_connection(origin, CacheLevel::CreateConnection);
+        }
+    }
+
+    auto may_use_disk_cache = g_disk_cache && DiskCache::is_cacheable_request(cache_partition_key, method, request_headers);
+
+    Optional<DiskCacheEntry> cache_entry;
+    if (may_use_disk_cache) {
+        cache_entry = g_disk_cache->open_entry(cache_partition_key, url);
+
+        if (cache_entry.has_value() && cache_entry->is_fresh() && !DiskCache::request_requires_revalidation(request_headers)) {
+            serve_from_disk_cache(request_id, url, cache_entry.release_value());
+            return;
+        }
+
+        // A stale entry is only useful if we can ask the server whether it's still valid.
+        if (cache_entry.has_value() && !cache_entry->has_validators())
+            cache_entry.clear();
+    }
+
     auto host = url.serialized_host().to_byte_string();
+    auto start_time = MonotonicTime::now();
 
     m_resolver->dns.lookup(host, DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA }, { .validate_dnssec_locally = g_dns_info.validate_dnssec_locally })
         ->when_rejected([this, request_id](auto const& error) {
@@ -441,7 +816,7 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             // FIXME: Implement timing info for DNS lookup failure.
             async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
         })
-        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data](auto const& dns_result) mutable {
+        .when_resolved([this, request_id, start_time, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_body_stream = move(request_body_stream), request_body_stream_size, request_headers = move(request_headers), proxy_data, cache_partition_key = move(cache_partition_key), may_use_disk_cache, cache_entry = move(cache_entry), priority](auto const& dns_result) mutable {
             if (dns_result->records().is_empty() || dns_result->cached_addresses().is_empty()) {
                 dbgln("StartRequest: DNS lookup failed for '{}'", host);
                 // FIXME: Implement timing info for DNS lookup failure.
@@ -449,6 +824,17 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
                 return;
             }
 
+            OwnPtr<Core::LocalSocket> request_body_socket;
+            if (request_body_stream.has_value()) {
+                auto socket = Core::LocalSocket::adopt_fd(request_body_stream->take_fd());
+                if (socket.is_error() || socket.value()->set_blocking(false).is_error()) {
+                    dbgln("StartRequest: Failed to set up request body stream");
+                    async_request_finished(request_id, 0, {}, Requests::NetworkError::Unknown);
+                    return;
+                }
+                request_body_socket = socket.release_value();
+            }
+
             auto* easy = curl_easy_init();
             if (!easy) {
                 dbgln("StartRequest: Failed to initialize curl easy handle");
@@ -467,7 +853,22 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             async_request_started(request_id, IPC::File::adopt_fd(reader_fd));
 
             auto request = make<ActiveRequest>(*this, m_curl_multi, easy, request_id, writer_fd);
+            request->start_time = start_time;
+            request->domain_lookup_end_microseconds = (MonotonicTime::now() - start_time).to_microseconds();
             request->url = url.to_string();
+            request->cache_url = url;
+            request->priority = priority;
+            request->host = host;
+
+            if (may_use_disk_cache) {
+                request->cache_partition_key = cache_partition_key;
+                request->may_store_in_disk_cache = true;
+
+                if (cache_entry.has_value()) {
+                    cache_entry->add_revalidation_headers(request_headers);
+                    request->cache_entry = move(cache_entry);
+                }
+            }
 
             auto set_option = [easy](auto option, auto value) {
                 auto result = curl_easy_setopt(easy, option, value);
@@ -488,15 +889,53 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             set_option(CURLOPT_PORT, url.port_or_default());
             set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
             set_option(CURLOPT_PIPEWAIT, 1L);
+            set_option(CURLOPT_STREAM_WEIGHT, http2_stream_weight_for(priority));
+
+            if (auto* share = tls_session_share_for(cache_partition_key))
+                set_option(CURLOPT_SHARE, share);
+
+            long ssl_options = 0;
+
+#ifdef CURLSSLOPT_EARLYDATA
+            // Requests sent as TLS 1.3 early data can be replayed by an attacker, so clients have to ask for it, and even
+            // then we only allow it for requests that are safe to repeat.
+            // https://www.rfc-editor.org/rfc/rfc8470#section-4
+            if (allow_tls_early_data && method.is_one_of("GET"sv, "HEAD"sv) && request_body.is_empty() && !request_body_socket)
+                ssl_options |= CURLSSLOPT_EARLYDATA;
+#else
+            (void)allow_tls_early_data;
+#endif
+
+            if (ssl_options != 0)
+                set_option(CURLOPT_SSL_OPTIONS, ssl_options);
+
+            // NOTE: curl races the QUIC connection against a TCP one and falls back to the latter if HTTP/3 fails.
+            if (curl_supports_http3() && s_alt_svc_cache.should_attempt_http3(url))
+                set_option(CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_3);
 
             bool did_set_body = false;
 
             if (method == "GET"sv) {
                 set_option(CURLOPT_HTTPGET, 1L);
             } else if (method.is_one_of("POST"sv, "PUT"sv, "PATCH"sv, "DELETE"sv)) {
-                request->body = move(request_body);
-                set_option(CURLOPT_POSTFIELDSIZE, request->body.size());
-                set_option(CURLOPT_POSTFIELDS, request->body.data());
+                if (request_body_socket) {
+                    // NOTE: Large bodies are streamed to us by the client. curl pulls them through our read callback as
+                    //       fast as it can upload them, and we pause the upload whenever the client hasn't caught up.
+                    request->request_body_stream = move(request_body_socket);
+                    request->request_body_stream->set_notifications_enabled(false);
+                    request->request_body_stream->on_ready_to_read = [request = request.ptr()] {
+                        request->resume_upload();
+                    };
+
+                    set_option(CURLOPT_POST, 1L);
+                    set_option(CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(request_body_stream_size));
+                    set_option(CURLOPT_READFUNCTION, &on_request_body_requested);
+                    set_option(CURLOPT_READDATA, reinterpret_cast<void*>(request.ptr()));
+                } else {
+                    request->body = move(request_body);
+                    set_option(CURLOPT_POSTFIELDSIZE, request->body.size());
+                    set_option(CURLOPT_POSTFIELDS, request->body.data());
+                }
                 did_set_body = true;
             } else if (method == "HEAD") {
                 set_option(CURLOPT_NOBODY, 1L);
@@ -543,6 +982,9 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             set_option(CURLOPT_HEADERFUNCTION, &on_header_received);
             set_option(CURLOPT_HEADERDATA, reinterpret_cast<void*>(request.ptr()));
 
+            // https://www.rfc-editor.org/rfc/rfc8305#section-5
+            set_option(CURLOPT_HAPPY_EYEBALLS_TIMEOUT_MS, 250L);
+
             auto formatted_address = build_curl_resolve_list(*dns_result, host, url.port_or_default());
             if (curl_slist* resolve_list = curl_slist_append(nullptr, formatted_address.characters())) {
                 set_option(CURLOPT_RESOLVE, resolve_list);
@@ -550,14 +992,114 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             } else
                 VERIFY_NOT_REACHED();
 
-            auto result = curl_multi_add_handle(m_curl_multi, easy);
-            VERIFY(result == CURLM_OK);
-
-            m_active_requests.set(request_id, move(request));
+            start_or_delay_request(move(request));
         });
 }
 #endif
 
+bool ConnectionFromClient::can_start_request_now(ActiveRequest const& request) const
+{
+    if (!is_delayable(request.priority))
+        return true;
+
+    size_t delayable_requests_in_flight = 0;
+    size_t delayable_requests_in_flight_to_host = 0;
+    bool render_blocking_request_in_flight = false;
+
+    for (auto const& [id, other] : m_active_requests) {
+        if (!other->is_added_to_multi || other->is_connect_only || other->done_fetching)
+            continue;
+
+        if (other->priority == RequestPriority::Highest)
+            render_blocking_request_in_flight = true;
+
+        if (is_delayable(other->priority)) {
+            ++delayable_requests_in_flight;
+            if (other->host == request.host)
+                ++delayable_requests_in_flight_to_host;
+        }
+    }
+
+    if (render_blocking_request_in_flight && delayable_requests_in_flight >= maximum_delayable_requests_while_render_blocking)
+        return false;
+
+    return delayable_requests_in_flight < maximum_delayable_requests
+        && delayable_requests_in_flight_to_host < maximum_delayable_requests_per_host;
+}
+
+void ConnectionFromClient::start_or_delay_request(NonnullOwnPtr<ActiveRequest> request)
+{
+    auto request_id = request->request_id;
+
+    if (can_start_request_now(*request)) {
+        request->add_to_multi();
+    } else {
+        // Keep delayed requests ordered by priority, and by arrival within the same priority.
+        auto insertion_index = m_delayed_requests.size();
+        for (size_t i = 0; i < m_delayed_requests.size(); ++i) {
+            auto other = m_active_requests.find(m_delayed_requests[i]);
+            if (other != m_active_requests.end() && other->value->priority < request->priority) {
+                insertion_index = i;
+                break;
+            }
+        }
+        m_delayed_requests.insert(insertion_index, request_id);
+    }
+
+    m_active_requests.set(request_id, move(request));
+}
+
+void ConnectionFromClient::start_delayed_requests()
+{
+    for (size_t i = 0; i < m_delayed_requests.size();) {
+        auto request = m_active_requests.find(m_delayed_requests[i]);
+        if (request == m_active_requests.end()) {
+            m_delayed_requests.remove(i);
+            continue;
+        }
+
+        if (!can_start_request_now(*request->value)) {
+            ++i;
+            continue;
+        }
+
+        m_delayed_requests.remove(i);
+        request->value->add_to_multi();
+    }
+}
+
+void ConnectionFromClient::serve_from_disk_cache(i32 request_id, URL::URL const& url, DiskCacheEntry cache_entry)
+{
+    auto fds_or_error = Core::System::pipe2(O_NONBLOCK);
+    if (fds_or_error.is_error()) {
+        dbgln("StartRequest: Failed to create pipe: {}", fds_or_error.error());
+        return;
+    }
+
+    auto fds = fds_or_error.release_value();
+    auto writer_fd = fds[1];
+    auto reader_fd = fds[0];
+    async_request_started(request_id, IPC::File::adopt_fd(reader_fd));
+
+    auto request = make<ActiveRequest>(*this, m_curl_multi, nullptr, request_id, writer_fd);
+    request->url = url.to_string();
+    request->got_all_headers = true;
+
+    async_headers_became_available(request_id, cache_entry.response_headers(), cache_entry.status_code(), cache_entry.reason_phrase());
+
+    request->cache_entry = move(cache_entry);
+    request->cached_body_to_send = request->cache_entry->body();
+    request->downloaded_so_far = request->cached_body_to_send.size();
+
+    if (auto maybe_error = request->write_queued_bytes_without_blocking(); maybe_error.is_error())
+        dbgln("Warning: Failed to write cached response data (it's likely the client disappeared): {}", maybe_error.error());
+
+    async_request_finished(request_id, request->downloaded_so_far, {}, {});
+    request->notify_about_fetching_completion();
+
+    m_active_requests.set(request_id, move(request));
+}
+
 static Requests::NetworkError map_curl_code_to_network_error(CURLcode const& code)
 {
     switch (code) {
@@ -584,7 +1126,9 @@ static Requests::NetworkError map_curl_code_to_network_error(CURLcode const& cod
     }
 }
 
-static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* easy_handle)
+// The DNS lookup and any delay from request scheduling happen before curl starts its clock, so the times curl reports
+// are offset by when we handed the request to it.
+static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* easy_handle, i64 domain_lookup_end_microseconds, i64 transfer_start_microseconds)
 {
     /*
      *   curl_easy_perform()
@@ -598,6 +1142,8 @@ static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* e
      *       |--|--|--|--|--|--|--STARTTRANSFER
      *       |--|--|--|--|--|--|--|--TOTAL
      *       |--|--|--|--|--|--|--|--REDIRECT
+     *
+     * NOTE: Each of these is measured from the start of the transfer, i.e. they include the phases before them.
      */
 
     auto get_timing_info = [easy_handle](auto option) {
@@ -607,7 +1153,6 @@ static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* e
         return time_value;
     };
 
-    auto queue_time = get_timing_info(CURLINFO_QUEUE_TIME_T);
     auto domain_lookup_time = get_timing_info(CURLINFO_NAMELOOKUP_TIME_T);
     auto connect_time = get_timing_info(CURLINFO_CONNECT_TIME_T);
     auto secure_connect_time = get_timing_info(CURLINFO_APPCONNECT_TIME_T);
@@ -639,15 +1184,31 @@ static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* e
         break;
     }
 
+    long new_connections = 0;
+    auto get_connections_result = curl_easy_getinfo(easy_handle, CURLINFO_NUM_CONNECTS, &new_connections);
+    VERIFY(get_connections_result == CURLE_OK);
+
+    auto offset = [&](curl_off_t time_value) { return static_cast<long>(transfer_start_microseconds + time_value); };
+
+    // https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-connectstart
+    // If a persistent connection was reused, the connection phases take no time at all.
+    auto connect_start = offset(domain_lookup_time);
+    auto secure_connect_start = connect_start;
+    auto connect_end = connect_start;
+    if (new_connections != 0) {
+        secure_connect_start = offset(connect_time);
+        connect_end = offset(secure_connect_time != 0 ? secure_connect_time : connect_time);
+    }
+
     return Requests::RequestTimingInfo {
-        .domain_lookup_start_microseconds = queue_time,
-        .domain_lookup_end_microseconds = queue_time + domain_lookup_time,
-        .connect_start_microseconds = queue_time + domain_lookup_time,
-        .connect_end_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time,
-        .secure_connect_start_microseconds = queue_time + domain_lookup_time + connect_time,
-        .request_start_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time + request_start_time,
-        .response_start_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time + response_start_time,
-        .response_end_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time + response_end_time,
+        .domain_lookup_start_microseconds = 0,
+        .domain_lookup_end_microseconds = static_cast<long>(domain_lookup_end_microseconds),
+        .connect_start_microseconds = connect_start,
+        .connect_end_microseconds = connect_end,
+        .secure_connect_start_microseconds = secure_connect_start,
+        .request_start_microseconds = offset(request_start_time),
+        .response_start_microseconds = offset(response_start_time),
+        .response_end_microseconds = offset(response_end_time),
         .encoded_body_size = encoded_body_size,
         .http_version_alpn_identifier = http_version_alpn,
     };
@@ -680,7 +1241,7 @@ void ConnectionFromClient::check_active_requests()
         auto* request = static_cast<ActiveRequest*>(application_private);
 
         if (!request->is_connect_only) {
-            auto timing_info = get_timing_info_from_curl_easy_handle(msg->easy_handle);
+            auto timing_info = get_timing_info_from_curl_easy_handle(msg->easy_handle, request->domain_lookup_end_microseconds, request->transfer_start_microseconds);
             request->flush_headers_if_needed();
 
             auto result_code = msg->data.result;
@@ -703,11 +1264,18 @@ void ConnectionFromClient::check_active_requests()
                 }
             }
 
+            // NOTE: We only store complete responses, so we check the unadjusted result code here.
+            if (msg->data.result == CURLE_OK)
+                request->store_in_disk_cache_if_needed();
+
             async_request_finished(request->request_id, request->downloaded_so_far, timing_info, network_error);
         }
 
         request->notify_about_fetching_completion();
     }
+
+    if (!m_delayed_requests.is_empty())
+        start_delayed_requests();
 }
 
 Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(i32 request_id)
@@ -718,6 +1286,10 @@ Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(
         return false;
     }
 
+    m_delayed_requests.remove_first_matching([&](auto id) { return id == request_id; });
+    if (request.value()->is_added_to_multi)
+        start_delayed_requests();
+
     return true;
 }
 
@@ -761,9 +1333,10 @@ void ConnectionFromClient::ensure_connection(URL::URL url, ::RequestServer::Cach
         set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
         set_option(CURLOPT_CONNECT_ONLY, 1L);
 
-        auto const result = curl_multi_add_handle(m_curl_multi, easy);
-        VERIFY(result == CURLM_OK);
+        if (curl_supports_http3() && s_alt_svc_cache.should_attempt_http3(url))
+            set_option(CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_3);
 
+        request->add_to_multi();
         m_active_requests.set(connect_only_request_id, move(request));
 
         return;
@@ -816,15 +1389,24 @@ void ConnectionFromClient::websocket_connect(i64 websocket_id, URL::URL url, Byt
                 async_websocket_connected(websocket_id);
             };
             connection->on_message = [this, websocket_id](auto message) {
-                async_websocket_received(websocket_id, message.is_text(), message.data());
+                // OPTIMIZATION: A single read from the socket often yields many messages. Rather than sending each of
+                //               them to the client on its own, send them all at once when we're done reading.
+                auto& pending_messages = m_pending_websocket_messages.ensure(websocket_id);
+                if (pending_messages.is_empty())
+                    deferred_invoke([this, websocket_id]() { flush_websocket_messages(websocket_id); });
+
+                pending_messages.append({ .data = message.release_data(), .is_text = message.is_text() });
             };
             connection->on_error = [this, websocket_id](auto message) {
+                flush_websocket_messages(websocket_id);
                 async_websocket_errored(websocket_id, (i32)message);
             };
             connection->on_close = [this, websocket_id](u16 code, ByteString reason, bool was_clean) {
+                flush_websocket_messages(websocket_id);
                 async_websocket_closed(websocket_id, code, move(reason), was_clean);
             };
             connection->on_ready_state_change = [this, websocket_id](auto state) {
+                flush_websocket_messages(websocket_id);
                 async_websocket_ready_state_changed(websocket_id, (u32)state);
             };
 
@@ -833,6 +1415,12 @@ void ConnectionFromClient::websocket_connect(i64 websocket_id, URL::URL url, Byt
         });
 }
 
+void ConnectionFromClient::flush_websocket_messages(i64 websocket_id)
+{
+    if (auto messages = m_pending_websocket_messages.take(websocket_id); messages.has_value() && !messages->is_empty())
+        async_websocket_received(websocket_id, messages.release_value());
+}
+
 void ConnectionFromClient::websocket_send(i64 websocket_id, bool is_text, ByteBuffer data)
 {
     if (auto connection = m_websockets.get(websocket_id).value_or({}); connection && connection->ready_state() == WebSocket::ReadyState::Open)
@@ -9,12 +9,16 @@
 #include <AK/HashMap.h>
 #include <LibDNS/Resolver.h>
 #include <LibIPC/ConnectionFromClient.h>
+#include <LibRequests/WebSocket.h>
 #include <LibWebSocket/WebSocket.h>
 #include <RequestServer/RequestClientEndpoint.h>
+#include <RequestServer/RequestPriority.h>
 #include <RequestServer/RequestServerEndpoint.h>
 
 namespace RequestServer {
 
+class DiskCacheEntry;
+
 struct Resolver : public RefCounted<Resolver>
     , Weakable<Resolver> {
     Resolver(Function<ErrorOr<DNS::Resolver::SocketResult>()> create_socket)
@@ -42,7 +46,7 @@ private:
     virtual Messages::RequestServer::IsSupportedProtocolResponse is_supported_protocol(ByteString) override;
     virtual void set_dns_server(ByteString host_or_address, u16 port, bool use_tls, bool validate_dnssec_locally) override;
     virtual void set_use_system_dns() override;
-    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData) override;
+    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Optional<IPC::File> request_body_stream, u64 request_body_stream_size, Core::ProxyData, ByteString cache_partition_key, RequestPriority, bool allow_tls_early_data) override;
     virtual Messages::RequestServer::StopRequestResponse stop_request(i32) override;
     virtual Messages::RequestServer::SetCertificateResponse set_certificate(i32, ByteString, ByteString) override;
     virtual void ensure_connection(URL::URL url, ::RequestServer::CacheLevel cache_level) override;
@@ -52,8 +56,13 @@ private:
     virtual void websocket_close(i64 websocket_id, u16, ByteString) override;
     virtual Messages::RequestServer::WebsocketSetCertificateResponse websocket_set_certificate(i64, ByteString, ByteString) override;
 
+    void flush_websocket_messages(i64 websocket_id);
+
     HashMap<i32, RefPtr<WebSocket::WebSocket>> m_websockets;
 
+    // Messages that have been received on a WebSocket, but not yet sent to the client.
+    HashMap<i64, Vector<Requests::WebSocket::Message>> m_pending_websocket_messages;
+
     struct ActiveRequest;
     friend struct ActiveRequest;
 
@@ -61,10 +70,16 @@ private:
     static int on_timeout_callback(void*, long timeout_ms, void* user_data);
     static size_t on_header_received(void* buffer, size_t size, size_t nmemb, void* user_data);
     static size_t on_data_received(void* buffer, size_t size, size_t nmemb, void* user_data);
+    static size_t on_request_body_requested(char* buffer, size_t size, size_t nmemb, void* user_data);
 
     HashMap<i32, NonnullOwnPtr<ActiveRequest>> m_active_requests;
+    Vector<i32> m_delayed_requests;
 
     void check_active_requests();
+    bool can_start_request_now(ActiveRequest const&) const;
+    void start_or_delay_request(NonnullOwnPtr<ActiveRequest>);
+    void start_delayed_requests();
+    void serve_from_disk_cache(i32 request_id, URL::URL const&, DiskCacheEntry);
     void* m_curl_multi { nullptr };
     RefPtr<Core::Timer> m_timer;
     HashMap<int, NonnullRefPtr<Core::Notifier>> m_read_notifiers;
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NumericLimits.h>
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibCore/Timer.h>
+#include <LibURL/Parser.h>
+#include <RequestServer/ConnectionPredictor.h>
+
+namespace RequestServer {
+
+// Requests to a site's own origin this soon after we last preconnected for it are treated as part of the same
+// navigation, e.g. its same-origin subresources.
+static constexpr i64 navigation_window_seconds = 30;
+
+// Origins that haven't been seen for this long are no longer worth connecting to.
+static constexpr i64 origin_expiry_seconds = 30 * 24 * 60 * 60;
+
+static constexpr int flush_delay_ms = 10000;
+
+ErrorOr<NonnullOwnPtr<ConnectionPredictor>> ConnectionPredictor::create(Optional<ByteString> storage_path)
+{
+    auto predictor = adopt_own(*new ConnectionPredictor(move(storage_path)));
+    TRY(predictor->load());
+    return predictor;
+}
+
+ConnectionPredictor::ConnectionPredictor(Optional<ByteString> storage_path)
+    : m_storage_path(move(storage_path))
+    , m_flush_timer(Core::Timer::create_single_shot(flush_delay_ms, [this] { flush(); }))
+{
+}
+
+ConnectionPredictor::~ConnectionPredictor() = default;
+
+Vector<URL::URL> ConnectionPredictor::note_request(ByteString const& partition_key, URL::URL const& url)
+{
+    if (partition_key.is_empty() || !url.scheme().is_one_of("http"sv, "https"sv))
+        return {};
+
+    auto now = UnixDateTime::now().seconds_since_epoch();
+    auto origin = url.origin().serialize().to_byte_string();
+
+    if (origin != partition_key) {
+        auto& partition = m_partitions.ensure(partition_key);
+        partition.last_used = now;
+        record_subresource_origin(partition, move(origin), now);
+        evict_partitions_if_needed();
+        return {};
+    }
+
+    auto partition = m_partitions.find(partition_key);
+    if (partition == m_partitions.end())
+        return {};
+
+    auto& history = partition->value;
+    history.last_used = now;
+    if (now - history.last_preconnect < navigation_window_seconds)
+        return {};
+    history.last_preconnect = now;
+
+    history.origins.remove_all_matching([&](auto const& subresource_origin) {
+        return now - subresource_origin.last_seen > origin_expiry_seconds;
+    });
+
+    Vector<SubresourceOrigin const*> candidates;
+    for (auto const& subresource_origin : history.origins)
+        candidates.append(&subresource_origin);
+    quick_sort(candidates, [](auto const* a, auto const* b) { return a->hit_count > b->hit_count; });
+
+    Vector<URL::URL> urls;
+    for (auto const* candidate : candidates) {
+        if (urls.size() == maximum_preconnects_per_navigation)
+            break;
+        if (auto candidate_url = URL::Parser::basic_parse(candidate->origin); candidate_url.has_value())
+            urls.append(candidate_url.release_value());
+    }
+
+    return urls;
+}
+
+void ConnectionPredictor::record_subresource_origin(PartitionHistory& partition, ByteString origin, i64 now)
+{
+    mark_dirty();
+
+    for (auto& subresource_origin : partition.origins) {
+        if (subresource_origin.origin == origin) {
+            ++subresource_origin.hit_count;
+            subresource_origin.last_seen = now;
+            return;
+        }
+    }
+
+    // Make room by forgetting the origin we've seen least often.
+    if (partition.origins.size() == maximum_origins_per_partition) {
+        size_t least_seen_index = 0;
+        for (size_t i = 1; i < partition.origins.size(); ++i) {
+            if (partition.origins[i].hit_count < partition.origins[least_seen_index].hit_count)
+                least_seen_index = i;
+        }
+        partition.origins.remove(least_seen_index);
+    }
+
+    partition.origins.append({ move(origin), 1, now });
+}
+
+void ConnectionPredictor::evict_partitions_if_needed()
+{
+    if (m_partitions.size() <= maximum_partitions)
+        return;
+
+    Optional<ByteString> least_recently_used;
+    i64 least_recent_use = NumericLimits<i64>::max();
+    for (auto const& [partition_key, partition] : m_partitions) {
+        if (partition.last_used < least_recent_use) {
+            least_recent_use = partition.last_used;
+            least_recently_used = partition_key;
+        }
+    }
+
+    if (least_recently_used.has_value())
+        m_partitions.remove(*least_recently_used);
+}
+
+ErrorOr<void> ConnectionPredictor::load()
+{
+    if (!m_storage_path.has_value())
+        return {};
+
+    auto file = Core::File::open(*m_storage_path, Core::File::OpenMode::Read);
+    if (file.is_error())
+        return {};
+
+    auto contents = TRY(file.value()->read_until_eof());
+
+    for (auto line : StringView { contents }.split_view('\n')) {
+        auto parts = line.split_view('\t');
+        if (parts.size() != 4)
+            continue;
+
+        auto hit_count = parts[2].to_number<u32>();
+        auto last_seen = parts[3].to_number<i64>();
+        if (!hit_count.has_value() || !last_seen.has_value())
+            continue;
+
+        auto& partition = m_partitions.ensure(parts[0]);
+        partition.last_used = max(partition.last_used, *last_seen);
+        if (partition.origins.size() < maximum_origins_per_partition)
+            partition.origins.append({ parts[1], *hit_count, *last_seen });
+    }
+
+    return {};
+}
+
+void ConnectionPredictor::mark_dirty()
+{
+    if (!m_storage_path.has_value())
+        return;
+
+    m_is_dirty = true;
+    if (!m_flush_timer->is_active())
+        m_flush_timer->start();
+}
+
+void ConnectionPredictor::flush()
+{
+    if (!m_is_dirty)
+        return;
+    m_is_dirty = false;
+    m_flush_timer->stop();
+
+    StringBuilder builder;
+    for (auto const& [partition_key, partition] : m_partitions) {
+        for (auto const& subresource_origin : partition.origins)
+            builder.appendff("{}\t{}\t{}\t{}\n", partition_key, subresource_origin.origin, subresource_origin.hit_count, subresource_origin.last_seen);
+    }
+
+    auto result = [&]() -> ErrorOr<void> {
+        auto temporary_path = ByteString::formatted("{}.tmp", *m_storage_path);
+        {
+            auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+            TRY(file->write_until_depleted(builder.string_view().bytes()));
+        }
+        TRY(Core::System::rename(temporary_path, *m_storage_path));
+        return {};
+    }();
+
+    if (result.is_error())
+        dbgln("ConnectionPredictor: Unable to write connection history: {}", result.error());
+}
+
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/RefPtr.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibCore/Forward.h>
+#include <LibURL/URL.h>
+
+namespace RequestServer {
+
+// Learns which other origins each site fetches subresources from, so that the next navigation to that site can
+// resolve and connect to them while the document itself is still loading.
+class ConnectionPredictor {
+public:
+    // If a storage path is given, what was learned is kept there across restarts.
+    static ErrorOr<NonnullOwnPtr<ConnectionPredictor>> create(Optional<ByteString> storage_path = {});
+    ~ConnectionPredictor();
+
+    // Records a request made within the given network partition. If the request looks like the start of a navigation
+    // to that partition's site, returns the origins worth connecting to ahead of time.
+    Vector<URL::URL> note_request(ByteString const& partition_key, URL::URL const&);
+
+    void flush();
+
+private:
+    static constexpr size_t maximum_partitions = 512;
+    static constexpr size_t maximum_origins_per_partition = 32;
+    static constexpr size_t maximum_preconnects_per_navigation = 6;
+
+    struct SubresourceOrigin {
+        ByteString origin;
+        u32 hit_count { 0 };
+        i64 last_seen { 0 };
+    };
+
+    struct PartitionHistory {
+        Vector<SubresourceOrigin> origins;
+        i64 last_used { 0 };
+        i64 last_preconnect { 0 };
+    };
+
+    explicit ConnectionPredictor(Optional<ByteString> storage_path);
+
+    void record_subresource_origin(PartitionHistory&, ByteString origin, i64 now);
+    void evict_partitions_if_needed();
+
+    ErrorOr<void> load();
+    void mark_dirty();
+
+    Optional<ByteString> m_storage_path;
+    HashMap<ByteString, PartitionHistory> m_partitions;
+    bool m_is_dirty { false };
+    RefPtr<Core::Timer> m_flush_timer;
+};
+
+}
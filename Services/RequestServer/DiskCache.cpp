@@ -0,0 +1,487 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Endian.h>
+#include <AK/Hex.h>
+#include <AK/MemoryStream.h>
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <LibCore/DateTime.h>
+#include <LibCore/DirIterator.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibCore/Timer.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <RequestServer/DiskCache.h>
+
+namespace RequestServer {
+
+static constexpr u32 entry_file_magic = 0x4c424843; // "LBHC"
+static constexpr u32 entry_file_version = 1;
+static constexpr StringView index_file_name = "index"sv;
+static constexpr int flush_index_delay_ms = 5000;
+
+static Optional<i64> parse_http_date(StringView value)
+{
+    auto date_time = Core::DateTime::parse("%a, %d %b %Y %H:%M:%S %Z"sv, value);
+    if (!date_time.has_value())
+        return {};
+    return date_time->timestamp();
+}
+
+// Returns the value of the given Cache-Control directive, or an empty string if the directive has no value.
+static Optional<StringView> cache_control_directive(HTTP::HeaderMap const& headers, StringView name)
+{
+    auto cache_control = headers.get("Cache-Control"sv);
+    if (!cache_control.has_value())
+        return {};
+
+    for (auto directive : cache_control->split_view(',')) {
+        directive = directive.trim_whitespace();
+
+        auto equals_index = directive.find('=');
+        auto directive_name = equals_index.has_value() ? directive.substring_view(0, *equals_index).trim_whitespace() : directive;
+        if (!directive_name.equals_ignoring_ascii_case(name))
+            continue;
+
+        if (!equals_index.has_value())
+            return ""sv;
+        return directive.substring_view(*equals_index + 1).trim_whitespace().trim("\""sv);
+    }
+
+    return {};
+}
+
+static i64 date_value_of(HTTP::HeaderMap const& headers, i64 response_time)
+{
+    if (auto date = headers.get("Date"sv); date.has_value())
+        return parse_http_date(*date).value_or(response_time);
+    return response_time;
+}
+
+// https://httpwg.org/specs/rfc9111.html#calculating.freshness.lifetime
+static Optional<i64> freshness_lifetime_of(HTTP::HeaderMap const& headers, i64 response_time)
+{
+    // NOTE: We are a private cache, so s-maxage does not apply.
+    if (auto max_age = cache_control_directive(headers, "max-age"sv); max_age.has_value())
+        return max_age->to_number<i64>().value_or(0);
+
+    auto date_value = date_value_of(headers, response_time);
+
+    if (auto expires = headers.get("Expires"sv); expires.has_value()) {
+        // An invalid Expires value represents a time in the past.
+        auto expires_value = parse_http_date(*expires);
+        if (!expires_value.has_value())
+            return 0;
+        return *expires_value - date_value;
+    }
+
+    // https://httpwg.org/specs/rfc9111.html#heuristic.freshness
+    if (auto last_modified = headers.get("Last-Modified"sv); last_modified.has_value()) {
+        if (auto last_modified_value = parse_http_date(*last_modified); last_modified_value.has_value() && *last_modified_value < date_value)
+            return (date_value - *last_modified_value) / 10;
+    }
+
+    return {};
+}
+
+// https://httpwg.org/specs/rfc9111.html#age.calculations
+static i64 current_age_of(HTTP::HeaderMap const& headers, i64 response_time)
+{
+    i64 age_value = 0;
+    if (auto age = headers.get("Age"sv); age.has_value())
+        age_value = age->to_number<i64>().value_or(0);
+
+    auto apparent_age = max<i64>(0, response_time - date_value_of(headers, response_time));
+    auto corrected_initial_age = max(apparent_age, age_value);
+    auto resident_time = UnixDateTime::now().seconds_since_epoch() - response_time;
+    return corrected_initial_age + resident_time;
+}
+
+bool DiskCacheEntry::is_fresh() const
+{
+    if (cache_control_directive(m_response_headers, "no-cache"sv).has_value())
+        return false;
+
+    auto response_time = m_response_time.seconds_since_epoch();
+    auto freshness_lifetime = freshness_lifetime_of(m_response_headers, response_time);
+    if (!freshness_lifetime.has_value())
+        return false;
+
+    return *freshness_lifetime > current_age_of(m_response_headers, response_time);
+}
+
+bool DiskCacheEntry::has_validators() const
+{
+    return m_response_headers.contains("ETag"sv) || m_response_headers.contains("Last-Modified"sv);
+}
+
+// https://httpwg.org/specs/rfc9111.html#validation.sent
+void DiskCacheEntry::add_revalidation_headers(HTTP::HeaderMap& request_headers) const
+{
+    if (auto etag = m_response_headers.get("ETag"sv); etag.has_value())
+        request_headers.set("If-None-Match"sv, *etag);
+    if (auto last_modified = m_response_headers.get("Last-Modified"sv); last_modified.has_value())
+        request_headers.set("If-Modified-Since"sv, *last_modified);
+}
+
+bool DiskCache::is_cacheable_request(ByteString const& partition_key, ByteString const& method, HTTP::HeaderMap const& request_headers)
+{
+    if (partition_key.is_empty() || method != "GET"sv)
+        return false;
+
+    // Requests that carry credentials or their own conditions are passed through to the network untouched.
+    for (auto header : { "Authorization"sv, "Range"sv, "If-Match"sv, "If-None-Match"sv, "If-Modified-Since"sv, "If-Unmodified-Since"sv, "If-Range"sv }) {
+        if (request_headers.contains(header))
+            return false;
+    }
+
+    return !cache_control_directive(request_headers, "no-store"sv).has_value();
+}
+
+bool DiskCache::request_requires_revalidation(HTTP::HeaderMap const& request_headers)
+{
+    if (cache_control_directive(request_headers, "no-cache"sv).has_value())
+        return true;
+    if (auto max_age = cache_control_directive(request_headers, "max-age"sv); max_age.has_value() && max_age->to_number<i64>().value_or(0) == 0)
+        return true;
+
+    auto pragma = request_headers.get("Pragma"sv);
+    return pragma.has_value() && pragma->contains("no-cache"sv, CaseSensitivity::CaseInsensitive);
+}
+
+// https://httpwg.org/specs/rfc9111.html#response.cacheability
+bool DiskCache::is_storable_response(u32 status_code, HTTP::HeaderMap const& response_headers)
+{
+    if (status_code != 200)
+        return false;
+    if (cache_control_directive(response_headers, "no-store"sv).has_value())
+        return false;
+
+    // We don't store request headers with the entry, so we can only honor a Vary on Accept-Encoding, which curl always
+    // sends the same way.
+    if (auto vary = response_headers.get("Vary"sv); vary.has_value()) {
+        for (auto field : vary->split_view(',')) {
+            if (!field.trim_whitespace().equals_ignoring_ascii_case("Accept-Encoding"sv))
+                return false;
+        }
+    }
+
+    // A response without freshness information or validators could never be used again.
+    auto now = UnixDateTime::now().seconds_since_epoch();
+    if (freshness_lifetime_of(response_headers, now).value_or(0) > 0)
+        return true;
+    return response_headers.contains("ETag"sv) || response_headers.contains("Last-Modified"sv);
+}
+
+ErrorOr<NonnullOwnPtr<DiskCache>> DiskCache::create(ByteString directory, u64 maximum_size)
+{
+    TRY(Core::Directory::create(directory, Core::Directory::CreateDirectories::Yes));
+
+    auto cache = adopt_own(*new DiskCache(move(directory), maximum_size));
+    TRY(cache->load_index());
+    cache->evict_if_needed();
+
+    return cache;
+}
+
+DiskCache::DiskCache(ByteString directory, u64 maximum_size)
+    : m_directory(move(directory))
+    , m_maximum_size(maximum_size)
+    , m_flush_index_timer(Core::Timer::create_single_shot(flush_index_delay_ms, [this] { flush_index(); }))
+{
+}
+
+DiskCache::~DiskCache() = default;
+
+ByteString DiskCache::cache_key_for(ByteString const& partition_key, URL::URL const& url)
+{
+    return ByteString::formatted("{} {}", partition_key, url.serialize(URL::ExcludeFragment::Yes));
+}
+
+ByteString DiskCache::file_name_for(StringView cache_key)
+{
+    return encode_hex(Crypto::Hash::SHA256::hash(cache_key).bytes());
+}
+
+ByteString DiskCache::path_for(StringView file_name) const
+{
+    return ByteString::formatted("{}/{}", m_directory, file_name);
+}
+
+// https://httpwg.org/specs/rfc9111.html#storing.fields
+// Cookies are handled by the cookie jar when the response first arrives. Replaying them on every cache hit would
+// resurrect cookies that have since been changed or deleted.
+static bool should_store_header(StringView name)
+{
+    return !name.equals_ignoring_ascii_case("Set-Cookie"sv) && !name.equals_ignoring_ascii_case("Set-Cookie2"sv);
+}
+
+static ErrorOr<void> write_string(Stream& stream, StringView string)
+{
+    TRY(stream.write_value<LittleEndian<u32>>(static_cast<u32>(string.length())));
+    TRY(stream.write_until_depleted(string.bytes()));
+    return {};
+}
+
+static ErrorOr<StringView> read_string(FixedMemoryStream& stream)
+{
+    u32 length = TRY(stream.read_value<LittleEndian<u32>>());
+    auto bytes = TRY(stream.read_in_place<u8 const>(length));
+    return StringView { bytes };
+}
+
+Optional<DiskCacheEntry> DiskCache::open_entry(ByteString const& partition_key, URL::URL const& url)
+{
+    auto cache_key = cache_key_for(partition_key, url);
+    auto file_name = file_name_for(cache_key);
+
+    auto index_entry = m_index.find(file_name);
+    if (index_entry == m_index.end())
+        return {};
+
+    auto entry = [&]() -> ErrorOr<DiskCacheEntry> {
+        auto file = TRY(Core::MappedFile::map(path_for(file_name)));
+        FixedMemoryStream stream { file->bytes() };
+
+        u32 magic = TRY(stream.read_value<LittleEndian<u32>>());
+        u32 version = TRY(stream.read_value<LittleEndian<u32>>());
+        if (magic != entry_file_magic || version != entry_file_version)
+            return Error::from_string_literal("Unrecognized cache entry format");
+
+        if (TRY(read_string(stream)) != cache_key.view())
+            return Error::from_string_literal("Cache entry belongs to a different key");
+
+        u32 status_code = TRY(stream.read_value<LittleEndian<u32>>());
+
+        auto has_reason_phrase = TRY(stream.read_value<u8>()) != 0;
+        auto reason_phrase_string = TRY(read_string(stream));
+        Optional<String> reason_phrase;
+        if (has_reason_phrase)
+            reason_phrase = TRY(String::from_utf8(reason_phrase_string));
+
+        HTTP::HeaderMap response_headers;
+        u32 header_count = TRY(stream.read_value<LittleEndian<u32>>());
+        for (u32 i = 0; i < header_count; ++i) {
+            auto name = TRY(read_string(stream));
+            auto value = TRY(read_string(stream));
+            response_headers.set(name, value);
+        }
+
+        i64 response_time = TRY(stream.read_value<LittleEndian<i64>>());
+        u64 body_size = TRY(stream.read_value<LittleEndian<u64>>());
+        if (body_size != stream.remaining())
+            return Error::from_string_literal("Cache entry is truncated");
+
+        auto body_offset = stream.offset();
+        return DiskCacheEntry { move(cache_key), status_code, move(reason_phrase), move(response_headers), UnixDateTime::from_seconds_since_epoch(response_time), move(file), body_offset, body_size };
+    }();
+
+    if (entry.is_error()) {
+        dbgln("DiskCache: Discarding unreadable entry for {}: {}", url, entry.error());
+        remove_entry(file_name);
+        return {};
+    }
+
+    index_entry->value.last_access_time = UnixDateTime::now();
+    mark_index_dirty();
+
+    return entry.release_value();
+}
+
+void DiskCache::store_entry(ByteString const& partition_key, URL::URL const& url, u32 status_code, Optional<String> const& reason_phrase, HTTP::HeaderMap const& response_headers, ReadonlyBytes body)
+{
+    if (body.size() > maximum_entry_size || !is_storable_response(status_code, response_headers))
+        return;
+
+    auto cache_key = cache_key_for(partition_key, url);
+
+    if (auto result = write_entry(cache_key, status_code, reason_phrase, response_headers, UnixDateTime::now(), body); result.is_error()) {
+        dbgln("DiskCache: Unable to store entry for {}: {}", url, result.error());
+        remove_entry(file_name_for(cache_key));
+        return;
+    }
+
+    evict_if_needed();
+}
+
+void DiskCache::update_entry_after_revalidation(DiskCacheEntry& entry, HTTP::HeaderMap const& not_modified_response_headers)
+{
+    // Headers in the 304 response replace the stored ones, except for Content-Length, which describes the (empty)
+    // 304 body rather than the stored one.
+    auto is_content_length = [](ByteString const& name) { return name.equals_ignoring_ascii_case("Content-Length"sv); };
+
+    HTTP::HeaderMap updated_headers;
+    for (auto const& header : entry.m_response_headers.headers()) {
+        if (is_content_length(header.name) || !not_modified_response_headers.contains(header.name))
+            updated_headers.set(header.name, header.value);
+    }
+    for (auto const& header : not_modified_response_headers.headers()) {
+        if (!is_content_length(header.name))
+            updated_headers.set(header.name, header.value);
+    }
+
+    entry.m_response_headers = move(updated_headers);
+    entry.m_response_time = UnixDateTime::now();
+
+    // NOTE: The entry's file is replaced by rename, so the mapping we're about to serve the body from stays valid.
+    if (auto result = write_entry(entry.m_key, entry.m_status_code, entry.m_reason_phrase, entry.m_response_headers, entry.m_response_time, entry.body()); result.is_error()) {
+        dbgln("DiskCache: Unable to update revalidated entry: {}", result.error());
+        remove_entry(file_name_for(entry.m_key));
+    }
+}
+
+ErrorOr<void> DiskCache::write_entry(ByteString const& cache_key, u32 status_code, Optional<String> const& reason_phrase, HTTP::HeaderMap const& response_headers, UnixDateTime response_time, ReadonlyBytes body)
+{
+    AllocatingMemoryStream header_stream;
+    TRY(header_stream.write_value<LittleEndian<u32>>(entry_file_magic));
+    TRY(header_stream.write_value<LittleEndian<u32>>(entry_file_version));
+    TRY(write_string(header_stream, cache_key));
+    TRY(header_stream.write_value<LittleEndian<u32>>(status_code));
+    TRY(header_stream.write_value<u8>(reason_phrase.has_value() ? 1 : 0));
+    TRY(write_string(header_stream, reason_phrase.has_value() ? reason_phrase->bytes_as_string_view() : ""sv));
+    u32 header_count = 0;
+    for (auto const& header : response_headers.headers()) {
+        if (should_store_header(header.name))
+            ++header_count;
+    }
+    TRY(header_stream.write_value<LittleEndian<u32>>(header_count));
+    for (auto const& header : response_headers.headers()) {
+        if (!should_store_header(header.name))
+            continue;
+        TRY(write_string(header_stream, header.name));
+        TRY(write_string(header_stream, header.value));
+    }
+    TRY(header_stream.write_value<LittleEndian<i64>>(response_time.seconds_since_epoch()));
+    TRY(header_stream.write_value<LittleEndian<u64>>(body.size()));
+    auto header_bytes = TRY(header_stream.read_until_eof());
+
+    auto file_name = file_name_for(cache_key);
+    auto path = path_for(file_name);
+
+    // Write to a temporary file and rename it into place, so that a partially written entry is never observed.
+    auto temporary_path = ByteString::formatted("{}.tmp", path);
+    {
+        auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+        TRY(file->write_until_depleted(header_bytes));
+        TRY(file->write_until_depleted(body));
+    }
+    TRY(Core::System::rename(temporary_path, path));
+
+    auto entry_size = header_bytes.size() + body.size();
+    auto& index_entry = m_index.ensure(file_name);
+    m_total_size = m_total_size - index_entry.size + entry_size;
+    index_entry.size = entry_size;
+    index_entry.last_access_time = UnixDateTime::now();
+    mark_index_dirty();
+
+    return {};
+}
+
+void DiskCache::remove_entry(ByteString const& file_name)
+{
+    if (auto index_entry = m_index.take(file_name); index_entry.has_value()) {
+        m_total_size -= index_entry->size;
+        mark_index_dirty();
+    }
+
+    (void)Core::System::unlink(path_for(file_name));
+}
+
+void DiskCache::evict_if_needed()
+{
+    if (m_total_size <= m_maximum_size)
+        return;
+
+    Vector<ByteString> file_names;
+    file_names.ensure_capacity(m_index.size());
+    for (auto const& it : m_index)
+        file_names.unchecked_append(it.key);
+
+    quick_sort(file_names, [&](auto const& a, auto const& b) {
+        return m_index.find(a)->value.last_access_time < m_index.find(b)->value.last_access_time;
+    });
+
+    // Evict down to a little below the limit, so that a full cache doesn't evict on every store.
+    auto target_size = m_maximum_size / 10 * 9;
+
+    for (auto const& file_name : file_names) {
+        if (m_total_size <= target_size)
+            break;
+        remove_entry(file_name);
+    }
+}
+
+ErrorOr<void> DiskCache::load_index()
+{
+    if (auto file = Core::File::open(path_for(index_file_name), Core::File::OpenMode::Read); !file.is_error()) {
+        auto contents = TRY(file.value()->read_until_eof());
+
+        for (auto line : StringView { contents }.split_view('\n')) {
+            auto parts = line.split_view(' ');
+            if (parts.size() != 3)
+                continue;
+
+            auto size = parts[1].to_number<u64>();
+            auto last_access_time = parts[2].to_number<i64>();
+            if (!size.has_value() || !last_access_time.has_value())
+                continue;
+
+            m_index.set(parts[0], { *size, UnixDateTime::from_seconds_since_epoch(*last_access_time) });
+            m_total_size += *size;
+        }
+    }
+
+    // Remove files the index doesn't know about, e.g. entries written after the index was last flushed, or temporary
+    // files left behind by a crash.
+    Vector<ByteString> orphaned_files;
+    Core::DirIterator iterator { m_directory, Core::DirIterator::SkipDots };
+    while (iterator.has_next()) {
+        auto name = iterator.next_path();
+        if (name != index_file_name && !m_index.contains(name))
+            orphaned_files.append(move(name));
+    }
+    for (auto const& name : orphaned_files)
+        (void)Core::System::unlink(path_for(name));
+
+    return {};
+}
+
+void DiskCache::mark_index_dirty()
+{
+    m_index_is_dirty = true;
+    if (!m_flush_index_timer->is_active())
+        m_flush_index_timer->start();
+}
+
+void DiskCache::flush_index()
+{
+    if (!m_index_is_dirty)
+        return;
+    m_index_is_dirty = false;
+    m_flush_index_timer->stop();
+
+    StringBuilder builder;
+    for (auto const& [file_name, index_entry] : m_index)
+        builder.appendff("{} {} {}\n", file_name, index_entry.size, index_entry.last_access_time.seconds_since_epoch());
+
+    auto result = [&]() -> ErrorOr<void> {
+        auto path = path_for(index_file_name);
+        auto temporary_path = ByteString::formatted("{}.tmp", path);
+        {
+            auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+            TRY(file->write_until_depleted(builder.string_view().bytes()));
+        }
+        TRY(Core::System::rename(temporary_path, path));
+        return {};
+    }();
+
+    if (result.is_error())
+        dbgln("DiskCache: Unable to write index: {}", result.error());
+}
+
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/RefPtr.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <LibCore/Forward.h>
+#include <LibCore/MappedFile.h>
+#include <LibHTTP/HeaderMap.h>
+#include <LibURL/URL.h>
+
+namespace RequestServer {
+
+// A response stored in the disk cache. The body is not read into memory; it is handed out straight from a read-only
+// mapping of the entry's file.
+class DiskCacheEntry {
+public:
+    u32 status_code() const { return m_status_code; }
+    Optional<String> const& reason_phrase() const { return m_reason_phrase; }
+    HTTP::HeaderMap const& response_headers() const { return m_response_headers; }
+    ReadonlyBytes body() const { return m_file->bytes().slice(m_body_offset, m_body_size); }
+
+    // https://httpwg.org/specs/rfc9111.html#expiration.model
+    bool is_fresh() const;
+
+    bool has_validators() const;
+    void add_revalidation_headers(HTTP::HeaderMap&) const;
+
+private:
+    friend class DiskCache;
+
+    DiskCacheEntry(ByteString key, u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap response_headers, UnixDateTime response_time, NonnullOwnPtr<Core::MappedFile> file, size_t body_offset, size_t body_size)
+        : m_key(move(key))
+        , m_status_code(status_code)
+        , m_reason_phrase(move(reason_phrase))
+        , m_response_headers(move(response_headers))
+        , m_response_time(response_time)
+        , m_file(move(file))
+        , m_body_offset(body_offset)
+        , m_body_size(body_size)
+    {
+    }
+
+    ByteString m_key;
+    u32 m_status_code { 0 };
+    Optional<String> m_reason_phrase;
+    HTTP::HeaderMap m_response_headers;
+    UnixDateTime m_response_time;
+    NonnullOwnPtr<Core::MappedFile> m_file;
+    size_t m_body_offset { 0 };
+    size_t m_body_size { 0 };
+};
+
+// A persistent HTTP cache shared by every client of this RequestServer. Entries are keyed by network partition and
+// URL, stored one file per entry, and evicted in least-recently-used order once the cache grows past its size limit.
+class DiskCache {
+public:
+    static constexpr u64 default_maximum_size = 256 * MiB;
+    static constexpr size_t maximum_entry_size = 16 * MiB;
+
+    static ErrorOr<NonnullOwnPtr<DiskCache>> create(ByteString directory, u64 maximum_size = default_maximum_size);
+    ~DiskCache();
+
+    static bool is_cacheable_request(ByteString const& partition_key, ByteString const& method, HTTP::HeaderMap const& request_headers);
+    static bool request_requires_revalidation(HTTP::HeaderMap const& request_headers);
+    static bool is_storable_response(u32 status_code, HTTP::HeaderMap const& response_headers);
+
+    Optional<DiskCacheEntry> open_entry(ByteString const& partition_key, URL::URL const&);
+    void store_entry(ByteString const& partition_key, URL::URL const&, u32 status_code, Optional<String> const& reason_phrase, HTTP::HeaderMap const& response_headers, ReadonlyBytes body);
+
+    // https://httpwg.org/specs/rfc9111.html#freshening.responses
+    void update_entry_after_revalidation(DiskCacheEntry&, HTTP::HeaderMap const& not_modified_response_headers);
+
+    void flush_index();
+
+private:
+    struct IndexEntry {
+        u64 size { 0 };
+        UnixDateTime last_access_time;
+    };
+
+    DiskCache(ByteString directory, u64 maximum_size);
+
+    static ByteString cache_key_for(ByteString const& partition_key, URL::URL const&);
+    static ByteString file_name_for(StringView cache_key);
+    ByteString path_for(StringView file_name) const;
+
+    ErrorOr<void> write_entry(ByteString const& cache_key, u32 status_code, Optional<String> const& reason_phrase, HTTP::HeaderMap const& response_headers, UnixDateTime response_time, ReadonlyBytes body);
+    void remove_entry(ByteString const& file_name);
+    void evict_if_needed();
+
+    ErrorOr<void> load_index();
+    void mark_index_dirty();
+
+    ByteString m_directory;
+    u64 m_maximum_size { 0 };
+    u64 m_total_size { 0 };
+
+    HashMap<ByteString, IndexEntry> m_index;
+    bool m_index_is_dirty { false };
+    RefPtr<Core::Timer> m_flush_index_timer;
+};
+
+}
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace RequestServer {
+
+// The order in which RequestServer should get requests onto the network, from least to most urgent.
+enum class RequestPriority : u8 {
+    Lowest,
+    Low,
+    Medium,
+    High,
+    Highest,
+};
+
+}
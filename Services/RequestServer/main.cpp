@@ -12,9 +12,12 @@
 #include <LibCore/ArgsParser.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Process.h>
+#include <LibCore/StandardPaths.h>
 #include <LibIPC/SingleServer.h>
 #include <LibMain/Main.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/ConnectionPredictor.h>
+#include <RequestServer/DiskCache.h>
 
 #if defined(AK_OS_MACOS)
 #    include <LibCore/Platform/ProcessStatisticsMach.h>
@@ -23,6 +26,9 @@
 namespace RequestServer {
 
 extern ByteString g_default_certificate_path;
+extern OwnPtr<DiskCache> g_disk_cache;
+extern OwnPtr<ConnectionPredictor> g_connection_predictor;
+extern Optional<ByteString> g_dns_cache_path;
 
 }
 
@@ -33,11 +39,13 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     Vector<ByteString> certificates;
     StringView mach_server_name;
     bool wait_for_debugger = false;
+    bool enable_http_disk_cache = false;
 
     Core::ArgsParser args_parser;
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
     args_parser.add_option(wait_for_debugger, "Wait for debugger", "wait-for-debugger");
+    args_parser.add_option(enable_http_disk_cache, "Enable persistent HTTP disk cache", "enable-http-disk-cache");
     args_parser.parse(arguments);
 
     if (wait_for_debugger)
@@ -49,6 +57,25 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
     Core::EventLoop event_loop;
 
+    // FIXME: Move this to a generic "Ladybird data directory" helper.
+    auto data_directory = ByteString::formatted("{}/Ladybird", Core::StandardPaths::user_data_directory());
+
+    if (enable_http_disk_cache) {
+        if (auto disk_cache = RequestServer::DiskCache::create(ByteString::formatted("{}/Cache", data_directory)); disk_cache.is_error())
+            dbgln("Unable to create HTTP disk cache: {}", disk_cache.error());
+        else
+            RequestServer::g_disk_cache = disk_cache.release_value();
+    }
+
+    // NOTE: What the predictor learns and which hosts we have resolved reveal browsing history just like cached
+    //       responses do, so we only keep them on disk if the disk cache is enabled.
+    Optional<ByteString> connection_history_path;
+    if (RequestServer::g_disk_cache) {
+        connection_history_path = ByteString::formatted("{}/ConnectionHistory", data_directory);
+        RequestServer::g_dns_cache_path = ByteString::formatted("{}/DNSCache", data_directory);
+    }
+    RequestServer::g_connection_predictor = TRY(RequestServer::ConnectionPredictor::create(move(connection_history_path)));
+
 #if defined(AK_OS_MACOS)
     if (!mach_server_name.is_empty())
         Core::Platform::register_with_mach_server(mach_server_name);
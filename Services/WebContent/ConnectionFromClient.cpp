@@ -12,17 +12,25 @@
 #include <AK/JsonObject.h>
 #include <AK/QuickSort.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
+#include <LibCore/MemoryReporting.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/SystemTheme.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibURL/Parser.h>
 #include <LibUnicode/TimeZone.h>
 #include <LibWeb/ARIA/RoleType.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/CSS/ComputedProperties.h>
+#include <LibWeb/CSS/DecodedFontCache.h>
+#include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/StyleComputer.h>
+#include <LibWeb/Cookie/Cookie.h>
 #include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/CharacterData.h>
 #include <LibWeb/DOM/Document.h>
@@ -31,7 +39,9 @@
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/Dump.h>
+#include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
 #include <LibWeb/HTML/BrowsingContext.h>
+#include <LibWeb/HTML/EventLoop/FrameTimings.h>
 #include <LibWeb/HTML/HTMLInputElement.h>
 #include <LibWeb/HTML/SelectedFile.h>
 #include <LibWeb/HTML/Storage.h>
@@ -48,6 +58,9 @@
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/ServiceWorker/CacheStorage.h>
+#include <LibWeb/StorageAPI/LocalStorageCache.h>
+#include <LibWeb/WebAssembly/WebAssembly.h>
 #include <LibWebView/Attribute.h>
 #include <WebContent/ConnectionFromClient.h>
 #include <WebContent/PageClient.h>
@@ -196,7 +209,7 @@ void ConnectionFromClient::ready_to_paint(u64 page_id)
 
 void ConnectionFromClient::key_event(u64 page_id, Web::KeyEvent event)
 {
-    enqueue_input_event({ page_id, move(event), 0 });
+    enqueue_input_event({ page_id, move(event), 0, {} });
 }
 
 void ConnectionFromClient::mouse_event(u64 page_id, Web::MouseEvent event)
@@ -223,18 +236,22 @@ void ConnectionFromClient::mouse_event(u64 page_id, Web::MouseEvent event)
         event.wheel_delta_x += last_mouse_event->wheel_delta_x;
         event.wheel_delta_y += last_mouse_event->wheel_delta_y;
 
-        m_input_event_queue.tail().event = move(event);
-        ++m_input_event_queue.tail().coalesced_event_count;
+        auto& queued_event = m_input_event_queue.tail();
+        if (event.type == Web::MouseEvent::Type::MouseMove)
+            queued_event.coalesced_mouse_moves.append({ last_mouse_event->position, last_mouse_event->screen_position });
+
+        queued_event.event = move(event);
+        ++queued_event.coalesced_event_count;
 
         return;
     }
 
-    enqueue_input_event({ page_id, move(event), 0 });
+    enqueue_input_event({ page_id, move(event), 0, {} });
 }
 
 void ConnectionFromClient::drag_event(u64 page_id, Web::DragEvent event)
 {
-    enqueue_input_event({ page_id, move(event), 0 });
+    enqueue_input_event({ page_id, move(event), 0, {} });
 }
 
 void ConnectionFromClient::enqueue_input_event(Web::QueuedInputEvent event)
@@ -302,6 +319,42 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString request, ByteSt
         return;
     }
 
+    if (request == "dump-style-update-statistics") {
+        if (auto* doc = page->page().top_level_browsing_context().active_document()) {
+            auto const& statistics = doc->style_computer().last_style_update_statistics();
+            dbgln("=== Last style update: ===");
+            dbgln("Elements restyled: {} (inherited style only: {})", statistics.elements_restyled, statistics.elements_with_inherited_style_recomputed);
+            dbgln("Author rules tested: {}, matched: {}", statistics.author_rules.rules_tested, statistics.author_rules.rules_matched);
+            dbgln("User rules tested: {}, matched: {}", statistics.user_rules.rules_tested, statistics.user_rules.rules_matched);
+            dbgln("User agent rules tested: {}, matched: {}", statistics.user_agent_rules.rules_tested, statistics.user_agent_rules.rules_matched);
+            dbgln("Ancestor filter checks: {}, rejects: {}", statistics.ancestor_filter_checks, statistics.ancestor_filter_rejects);
+            dbgln("Time in collect_matching_rules: {}us, compute_font: {}us", statistics.time_in_collect_matching_rules.to_microseconds(), statistics.time_in_compute_font.to_microseconds());
+
+            auto const& invalidation_counts = doc->style_invalidations_before_last_style_update();
+            for (size_t i = 0; i < invalidation_counts.size(); ++i) {
+                if (invalidation_counts[i] != 0)
+                    dbgln("Invalidations ({}): {}", Web::DOM::to_string(static_cast<Web::DOM::StyleInvalidationReason>(i)), invalidation_counts[i]);
+            }
+        }
+        return;
+    }
+
+    if (request == "dump-frame-timings") {
+        auto trace = Web::HTML::FrameTimings::the().to_chrome_trace_json();
+        if (argument.is_empty()) {
+            dbgln("{}", trace);
+            return;
+        }
+        auto write_trace = [&]() -> ErrorOr<void> {
+            auto file = TRY(Core::File::open(argument, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+            TRY(file->write_until_depleted(trace.bytes()));
+            return {};
+        };
+        if (auto result = write_trace(); result.is_error())
+            dbgln("Failed to write frame timings to {}: {}", argument, result.error());
+        return;
+    }
+
     if (request == "dump-all-resolved-styles") {
         if (auto* doc = page->page().top_level_browsing_context().active_document()) {
             Queue<Web::DOM::Node*> elements_to_visit;
@@ -964,8 +1017,7 @@ static void append_paint_tree(Web::Page& page, StringBuilder& builder)
 
 static void append_gc_graph(StringBuilder& builder)
 {
-    auto gc_graph = Web::Bindings::main_thread_vm().heap().dump_graph();
-    gc_graph.serialize(builder);
+    Web::Bindings::main_thread_vm().heap().dump_graph(builder);
 }
 
 void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::PageInfoType type)
@@ -1194,6 +1246,23 @@ void ConnectionFromClient::run_javascript(u64 page_id, String js_source)
         page->run_javascript(js_source);
 }
 
+void ConnectionFromClient::start_javascript_profiler(u64 page_id)
+{
+    if (!this->page(page_id).has_value())
+        return;
+
+    // NOTE: All pages in this process share one VM, so this samples JS from all of them.
+    Web::Bindings::main_thread_vm().start_sampling_profiler(JS::SamplingProfiler::default_sampling_interval);
+}
+
+void ConnectionFromClient::stop_javascript_profiler(u64 page_id)
+{
+    auto profiler = Web::Bindings::main_thread_vm().stop_sampling_profiler();
+    auto profile = profiler ? profiler->to_cpuprofile_json() : String {};
+
+    async_did_finish_javascript_profile(page_id, move(profile));
+}
+
 void ConnectionFromClient::js_console_request_messages(u64 page_id, i32 start_index)
 {
     if (auto page = this->page(page_id); page.has_value())
@@ -1284,4 +1353,75 @@ void ConnectionFromClient::system_time_zone_changed()
     Unicode::clear_system_time_zone_cache();
 }
 
+void ConnectionFromClient::handle_memory_pressure(Core::MemoryPressureLevel level)
+{
+    if (level == Core::MemoryPressureLevel::Normal)
+        return;
+
+    // Start by dropping what can be rebuilt from data we still have around.
+    Web::HTML::AnimatedBitmapDecodedImageData::evict_all_evictable_images();
+    Web::CSS::DecodedFontCache::the().clear();
+
+    // The parse caches only hold on to work that is redone the next time the same input is seen.
+    Web::Bindings::main_thread_vm().clear_script_cache();
+    Web::WebAssembly::clear_compiled_module_cache();
+    Web::CSS::Parser::Parser::clear_style_sheet_cache();
+    URL::Parser::clear_parsed_url_cache();
+
+    // Under critical pressure, also drop what hidden pages are holding on to for when they are shown again. They will
+    // record their display lists again, and load documents from session history again.
+    if (level == Core::MemoryPressureLevel::Critical) {
+        Vector<GC::Root<Web::HTML::TraversableNavigable>> traversables;
+
+        for (auto navigable : Web::HTML::all_navigables()) {
+            if (auto* traversable = as_if<Web::HTML::TraversableNavigable>(*navigable); traversable && traversable->is_top_level_traversable())
+                traversables.append(*traversable);
+
+            if (auto traversable = navigable->traversable_navigable(); !traversable || traversable->system_visibility_state() == Web::HTML::VisibilityState::Visible)
+                continue;
+            if (auto document = navigable->active_document())
+                document->invalidate_cached_display_list();
+        }
+
+        for (auto& traversable : traversables)
+            traversable->evict_documents_from_back_forward_cache(0);
+
+        // NOTE: The Cache API only keeps its caches in memory, so this loses them. Sites have to be prepared for their
+        //       caches to be evicted anyway.
+        Web::ServiceWorker::CacheStorage::clear_all_caches();
+    }
+
+    // NOTE: We use deferred_invoke here to ensure that GC runs with as little on the stack as possible.
+    Core::deferred_invoke([] {
+        Web::Bindings::main_thread_vm().heap().collect_garbage();
+    });
+}
+
+void ConnectionFromClient::request_memory_reports(u64 request_id)
+{
+    async_did_collect_memory_reports(request_id, Core::MemoryReporting::collect_reports());
+}
+
+void ConnectionFromClient::cookies_did_change()
+{
+    Web::Cookie::cookie_store_did_change();
+}
+
+void ConnectionFromClient::storage_did_change(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, u64 sequence_number, Optional<String> bottle_key, Optional<String> value, bool is_own_change)
+{
+    // NOTE: Session storage is never shared between processes, so only local storage has to be kept in sync.
+    if (storage_endpoint != Web::StorageAPI::StorageEndpointType::LocalStorage)
+        return;
+
+    Web::StorageAPI::LocalStorageCache::the().did_change(storage_key, sequence_number, bottle_key, value, is_own_change);
+}
+
+void ConnectionFromClient::storage_change_was_rejected(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, u64 sequence_number)
+{
+    if (storage_endpoint != Web::StorageAPI::StorageEndpointType::LocalStorage)
+        return;
+
+    Web::StorageAPI::LocalStorageCache::the().did_reject_change(storage_key, sequence_number);
+}
+
 }
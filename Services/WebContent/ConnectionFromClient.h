@@ -120,6 +120,8 @@ private:
 
     virtual void js_console_input(u64 page_id, String) override;
     virtual void run_javascript(u64 page_id, String) override;
+    virtual void start_javascript_profiler(u64 page_id) override;
+    virtual void stop_javascript_profiler(u64 page_id) override;
     virtual void js_console_request_messages(u64 page_id, i32) override;
 
     virtual void alert_closed(u64 page_id) override;
@@ -155,6 +157,12 @@ private:
     virtual void paste(u64 page_id, String text) override;
 
     virtual void system_time_zone_changed() override;
+    virtual void handle_memory_pressure(Core::MemoryPressureLevel) override;
+    virtual void request_memory_reports(u64 request_id) override;
+
+    virtual void cookies_did_change() override;
+    virtual void storage_did_change(Web::StorageAPI::StorageEndpointType, String storage_key, u64 sequence_number, Optional<String> bottle_key, Optional<String> value, bool is_own_change) override;
+    virtual void storage_change_was_rejected(Web::StorageAPI::StorageEndpointType, String storage_key, u64 sequence_number) override;
 
     NonnullOwnPtr<PageHost> m_page_host;
 
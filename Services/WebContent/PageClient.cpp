@@ -483,16 +483,18 @@ Optional<Web::Cookie::Cookie> PageClient::page_did_request_named_cookie(URL::URL
     return client().did_request_named_cookie(url, name);
 }
 
-String PageClient::page_did_request_cookie(URL::URL const& url, Web::Cookie::Source source)
+Web::Cookie::CookieString PageClient::page_did_request_cookie(URL::URL const& url, Web::Cookie::Source source)
 {
     auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestCookie>(url, source);
     if (!response) {
         dbgln("WebContent client disconnected during DidRequestCookie. Exiting peacefully.");
         exit(0);
     }
-    return response->take_cookie();
+    return { response->take_cookie(), response->expiry_time() };
 }
 
+// NOTE: The browser process tells every WebContent process about changes to the cookie store, but we don't want to wait
+//       for that to learn about our own.
 void PageClient::page_did_set_cookie(URL::URL const& url, Web::Cookie::ParsedCookie const& cookie, Web::Cookie::Source source)
 {
     auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidSetCookie>(url, cookie, source);
@@ -500,64 +502,44 @@ void PageClient::page_did_set_cookie(URL::URL const& url, Web::Cookie::ParsedCoo
         dbgln("WebContent client disconnected during DidSetCookie. Exiting peacefully.");
         exit(0);
     }
+    Web::Cookie::cookie_store_did_change();
 }
 
 void PageClient::page_did_update_cookie(Web::Cookie::Cookie const& cookie)
 {
     client().async_did_update_cookie(cookie);
+    Web::Cookie::cookie_store_did_change();
 }
 
 void PageClient::page_did_expire_cookies_with_time_offset(AK::Duration offset)
 {
     client().async_did_expire_cookies_with_time_offset(offset);
+    Web::Cookie::cookie_store_did_change();
 }
 
-Optional<String> PageClient::page_did_request_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key)
+Web::StorageAPI::LocalStorageSnapshot PageClient::page_did_request_storage_area(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestStorageItem>(storage_endpoint, storage_key, bottle_key);
+    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestStorageArea>(storage_endpoint, storage_key);
     if (!response) {
-        dbgln("WebContent client disconnected during DidRequestStorageItem. Exiting peacefully.");
+        dbgln("WebContent client disconnected during DidRequestStorageArea. Exiting peacefully.");
         exit(0);
     }
-    return response->take_value();
+    return { response->take_items(), response->sequence_number() };
 }
 
-WebView::StorageOperationError PageClient::page_did_set_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key, String const& value)
+void PageClient::page_did_set_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key, String const& value)
 {
-    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidSetStorageItem>(storage_endpoint, storage_key, bottle_key, value);
-    if (!response) {
-        dbgln("WebContent client disconnected during DidSetStorageItem. Exiting peacefully.");
-        exit(0);
-    }
-    return response->error();
+    client().async_did_set_storage_item(storage_endpoint, storage_key, bottle_key, value);
 }
 
 void PageClient::page_did_remove_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key)
 {
-    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRemoveStorageItem>(storage_endpoint, storage_key, bottle_key);
-    if (!response) {
-        dbgln("WebContent client disconnected during DidRemoveStorageItem. Exiting peacefully.");
-        exit(0);
-    }
-}
-
-Vector<String> PageClient::page_did_request_storage_keys(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key)
-{
-    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestStorageKeys>(storage_endpoint, storage_key);
-    if (!response) {
-        dbgln("WebContent client disconnected during DidRequestStorageKeys. Exiting peacefully.");
-        exit(0);
-    }
-    return response->take_keys();
+    client().async_did_remove_storage_item(storage_endpoint, storage_key, bottle_key);
 }
 
 void PageClient::page_did_clear_storage(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidClearStorage>(storage_endpoint, storage_key);
-    if (!response) {
-        dbgln("WebContent client disconnected during DidClearStorage. Exiting peacefully.");
-        exit(0);
-    }
+    client().async_did_clear_storage(storage_endpoint, storage_key);
 }
 
 void PageClient::page_did_update_resource_count(i32 count_waiting)
@@ -11,6 +11,7 @@
 #include <AK/JsonObject.h>
 #include <AK/JsonValue.h>
 #include <AK/LexicalPath.h>
+#include <AK/TemporaryChange.h>
 #include <AK/Time.h>
 #include <AK/Vector.h>
 #include <LibCore/File.h>
@@ -73,7 +74,7 @@ namespace WebContent {
         static_assert(!::AK::Detail::IsLvalueReference<decltype(_temporary_result.release_value())>, \
             "Do not return a reference from a fallible expression");                                 \
         if (_temporary_result.is_error()) [[unlikely]] {                                             \
-            async_driver_execution_complete({ _temporary_result.release_error() });                  \
+            driver_execution_complete({ _temporary_result.release_error() });                  \
             return;                                                                                  \
         }                                                                                            \
         _temporary_result.release_value();                                                           \
@@ -218,6 +219,40 @@ void WebDriverConnection::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_navigation_timer);
 }
 
+ErrorOr<OwnPtr<IPC::MessageBuffer>> WebDriverConnection::handle(NonnullOwnPtr<IPC::Message> message)
+{
+    TemporaryChange is_handling_command { m_is_handling_command, true };
+    auto result = ClientStub::handle(move(message));
+
+    // A command may also complete while we are handling some other message, which won't return its response.
+    if (m_completed_response.has_value())
+        async_driver_execution_complete(m_completed_response.release_value());
+
+    return result;
+}
+
+void WebDriverConnection::driver_execution_complete(Web::WebDriver::Response response)
+{
+    // OPTIMIZATION: Most commands complete before their handler even returns. Rather than sending the response in a
+    //               separate message that WebDriver has to wait for, hand it to async_command_response() so it can be
+    //               returned as the reply to the command itself.
+    if (m_is_handling_command && !m_completed_response.has_value()) {
+        m_completed_response = move(response);
+        return;
+    }
+
+    async_driver_execution_complete(move(response));
+}
+
+Web::WebDriver::Response WebDriverConnection::async_command_response()
+{
+    if (m_completed_response.has_value())
+        return m_completed_response.release_value();
+
+    // The command will complete later, and its response is sent with driver_execution_complete then.
+    return {};
+}
+
 // https://w3c.github.io/webdriver/#dfn-close-the-session
 void WebDriverConnection::close_session()
 {
@@ -309,7 +344,7 @@ Messages::WebDriverClient::NavigateToResponse WebDriverConnection::navigate_to(J
 
             // FIXME: 10. If the current top-level browsing context contains a refresh state pragma directive of time 1 second or less, wait until the refresh timeout has elapsed, a new navigate has begun, and return to the first step of this algorithm.
 
-            async_driver_execution_complete(move(result));
+            driver_execution_complete(move(result));
         });
 
         // 8. If url is special except for file and current URL and URL do not have the same absolute URL:
@@ -327,7 +362,7 @@ Messages::WebDriverClient::NavigateToResponse WebDriverConnection::navigate_to(J
     });
 
     // 11. Return success with data null.
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 10.2 Get Current URL, https://w3c.github.io/webdriver/#get-current-url
@@ -342,10 +377,10 @@ Messages::WebDriverClient::GetCurrentUrlResponse WebDriverConnection::get_curren
         auto url = current_top_level_browsing_context()->active_document()->url();
 
         // 4. Return success with data url.
-        async_driver_execution_complete({ url.to_string() });
+        driver_execution_complete({ url.to_string() });
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 10.3 Back, https://w3c.github.io/webdriver/#dfn-back
@@ -377,14 +412,14 @@ Messages::WebDriverClient::BackResponse WebDriverConnection::back()
                 // 1. Handle any user prompts.
                 handle_any_user_prompts([this]() {
                     // 2. Return error with error code timeout.
-                    async_driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::Timeout, "Navigation timed out"sv));
+                    driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::Timeout, "Navigation timed out"sv));
                 });
 
                 return;
             }
 
             // 9. Return success with data null.
-            async_driver_execution_complete(JsonValue {});
+            driver_execution_complete(JsonValue {});
         });
 
         // 5. If timeout is not null:
@@ -415,7 +450,7 @@ Messages::WebDriverClient::BackResponse WebDriverConnection::back()
         }));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 10.4 Forward, https://w3c.github.io/webdriver/#dfn-forward
@@ -447,14 +482,14 @@ Messages::WebDriverClient::ForwardResponse WebDriverConnection::forward()
                 // 1. Handle any user prompts.
                 handle_any_user_prompts([this]() {
                     // 2. Return error with error code timeout.
-                    async_driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::Timeout, "Navigation timed out"sv));
+                    driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::Timeout, "Navigation timed out"sv));
                 });
 
                 return;
             }
 
             // 9. Return success with data null.
-            async_driver_execution_complete(JsonValue {});
+            driver_execution_complete(JsonValue {});
         });
 
         // 5. If timeout is not null:
@@ -485,7 +520,7 @@ Messages::WebDriverClient::ForwardResponse WebDriverConnection::forward()
         }));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 10.5 Refresh, https://w3c.github.io/webdriver/#dfn-refresh
@@ -507,10 +542,10 @@ Messages::WebDriverClient::RefreshResponse WebDriverConnection::refresh()
         set_current_browsing_context(*current_top_level_browsing_context());
 
         // 6. Return success with data null.
-        async_driver_execution_complete(JsonValue {});
+        driver_execution_complete(JsonValue {});
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 10.6 Get Title, https://w3c.github.io/webdriver/#dfn-get-title
@@ -525,10 +560,10 @@ Messages::WebDriverClient::GetTitleResponse WebDriverConnection::get_title()
         auto title = current_top_level_browsing_context()->active_document()->title();
 
         // 4. Return success with data title.
-        async_driver_execution_complete({ move(title) });
+        driver_execution_complete({ move(title) });
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 11.1 Get Window Handle, https://w3c.github.io/webdriver/#get-window-handle
@@ -558,10 +593,10 @@ Messages::WebDriverClient::CloseWindowResponse WebDriverConnection::close_window
             current_top_level_browsing_context()->top_level_traversable()->close_top_level_traversable();
         }));
 
-        async_driver_execution_complete(JsonValue {});
+        driver_execution_complete(JsonValue {});
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 11.3 Switch to Window, https://w3c.github.io/webdriver/#dfn-switch-to-window
@@ -606,14 +641,14 @@ Messages::WebDriverClient::NewWindowResponse WebDriverConnection::new_window(Jso
     handle_any_user_prompts([this, payload = move(payload)]() {
         // 4. Let type hint be the result of getting the property "type" from the parameters argument.
         if (!payload.is_object()) {
-            async_driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::InvalidArgument, "Payload is not a JSON object"sv));
+            driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::InvalidArgument, "Payload is not a JSON object"sv));
             return;
         }
 
         // FIXME: Actually use this value to decide between an OS window or tab.
         auto type_hint = payload.as_object().get("type"sv);
         if (type_hint.has_value() && !type_hint->is_null() && !type_hint->is_string()) {
-            async_driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::InvalidArgument, "Payload property `type` is not null or a string"sv));
+            driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::InvalidArgument, "Payload property `type` is not null or a string"sv));
             return;
         }
 
@@ -643,10 +678,10 @@ Messages::WebDriverClient::NewWindowResponse WebDriverConnection::new_window(Jso
         result.set("type"sv, JsonValue { type });
 
         // 9. Return success with data result.
-        async_driver_execution_complete({ move(result) });
+        driver_execution_complete({ move(result) });
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 11.6 Switch To Frame, https://w3c.github.io/webdriver/#dfn-switch-to-frame
@@ -674,7 +709,7 @@ Messages::WebDriverClient::SwitchToFrameResponse WebDriverConnection::switch_to_
             // 3. Set the current browsing context with session and session's current top-level browsing context.
             set_current_browsing_context(*current_top_level_browsing_context());
 
-            async_driver_execution_complete(JsonValue {});
+            driver_execution_complete(JsonValue {});
         });
     }
 
@@ -700,7 +735,7 @@ Messages::WebDriverClient::SwitchToFrameResponse WebDriverConnection::switch_to_
             auto property = window->get(id);
 
             if (property.is_error() || !property.value().is_object() || !is<Web::HTML::WindowProxy>(property.value().as_object())) {
-                async_driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::NoSuchFrame, MUST(String::formatted("Frame ID {} not found", id))));
+                driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::NoSuchFrame, MUST(String::formatted("Frame ID {} not found", id))));
                 return;
             }
 
@@ -710,7 +745,7 @@ Messages::WebDriverClient::SwitchToFrameResponse WebDriverConnection::switch_to_
             // 7. Set the current browsing context with session and child window's browsing context.
             set_current_browsing_context(child_window.associated_browsing_context());
 
-            async_driver_execution_complete(JsonValue {});
+            driver_execution_complete(JsonValue {});
         });
     }
 
@@ -728,7 +763,7 @@ Messages::WebDriverClient::SwitchToFrameResponse WebDriverConnection::switch_to_
 
             // 4. If element is not a frame or iframe element, return error with error code no such frame.
             if (!is<Web::HTML::HTMLFrameElement>(*element) && !is<Web::HTML::HTMLIFrameElement>(*element)) {
-                async_driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::NoSuchFrame, "element is not a frame"sv));
+                driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::NoSuchFrame, "element is not a frame"sv));
                 return;
             }
 
@@ -736,14 +771,14 @@ Messages::WebDriverClient::SwitchToFrameResponse WebDriverConnection::switch_to_
             auto& navigable_container = static_cast<Web::HTML::NavigableContainer&>(*element);
             set_current_browsing_context(*navigable_container.content_navigable()->active_browsing_context());
 
-            async_driver_execution_complete(JsonValue {});
+            driver_execution_complete(JsonValue {});
         });
     }
 
     // FIXME: 4. Update any implementation-specific state that would result from the user selecting session's current browsing context for interaction, without altering OS-level focus.
 
     // 5. Return success with data null
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 11.7 Switch To Parent Frame, https://w3c.github.io/webdriver/#dfn-switch-to-parent-frame
@@ -755,8 +790,8 @@ Messages::WebDriverClient::SwitchToParentFrameResponse WebDriverConnection::swit
         TRY(ensure_current_browsing_context_is_open());
 
         // 2. Return success with data null.
-        async_driver_execution_complete(JsonValue {});
-        return JsonValue {};
+        driver_execution_complete(JsonValue {});
+        return async_command_response();
     }
 
     // 2. If session's current parent browsing context is no longer open, return error with error code no such window.
@@ -772,10 +807,10 @@ Messages::WebDriverClient::SwitchToParentFrameResponse WebDriverConnection::swit
         // FIXME: 5. Update any implementation-specific state that would result from the user selecting session's current browsing context for interaction, without altering OS-level focus.
 
         // 6. Return success with data null.
-        async_driver_execution_complete(JsonValue {});
+        driver_execution_complete(JsonValue {});
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 11.8.1 Get Window Rect, https://w3c.github.io/webdriver/#dfn-get-window-rect
@@ -788,10 +823,10 @@ Messages::WebDriverClient::GetWindowRectResponse WebDriverConnection::get_window
     handle_any_user_prompts([this]() {
         // 3. Return success with data set to the WindowRect object for the current top-level browsing context.
         auto serialized_rect = serialize_rect(compute_window_rect(current_top_level_browsing_context()->page()));
-        async_driver_execution_complete(move(serialized_rect));
+        driver_execution_complete(move(serialized_rect));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 11.8.2 Set Window Rect, https://w3c.github.io/webdriver/#dfn-set-window-rect
@@ -866,12 +901,12 @@ Messages::WebDriverClient::SetWindowRectResponse WebDriverConnection::set_window
             }
 
             if (m_pending_window_rect_requests == 0)
-                async_driver_execution_complete(serialize_rect(compute_window_rect(page)));
+                driver_execution_complete(serialize_rect(compute_window_rect(page)));
         }));
     });
 
     // 14. Return success with data set to the WindowRect object for the current top-level browsing context.
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 11.8.3 Maximize Window, https://w3c.github.io/webdriver/#dfn-maximize-window
@@ -894,7 +929,7 @@ Messages::WebDriverClient::MaximizeWindowResponse WebDriverConnection::maximize_
     });
 
     // 7. Return success with data set to the WindowRect object for the current top-level browsing context.
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 11.8.4 Minimize Window, https://w3c.github.io/webdriver/#minimize-window
@@ -912,12 +947,12 @@ Messages::WebDriverClient::MinimizeWindowResponse WebDriverConnection::minimize_
         // 5. Iconify the window.
         iconify_the_window(GC::create_function(current_top_level_browsing_context()->heap(), [this]() {
             auto& page = current_top_level_browsing_context()->page();
-            async_driver_execution_complete(serialize_rect(compute_window_rect(page)));
+            driver_execution_complete(serialize_rect(compute_window_rect(page)));
         }));
     });
 
     // 6. Return success with data set to the WindowRect object for the current top-level browsing context.
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 11.8.5 Fullscreen Window, https://w3c.github.io/webdriver/#dfn-fullscreen-window
@@ -941,7 +976,7 @@ Messages::WebDriverClient::FullscreenWindowResponse WebDriverConnection::fullscr
     });
 
     // 6. Return success with data set to the WindowRect object for the current top-level browsing context.
-    return JsonValue {};
+    return async_command_response();
 }
 
 // Extension Consume User Activation, https://html.spec.whatwg.org/multipage/interaction.html#user-activation-user-agent-automation
@@ -1011,11 +1046,11 @@ Messages::WebDriverClient::FindElementResponse WebDriverConnection::find_element
         // 9. Let result be the result of trying to Find with session, start node, location strategy, and selector.
         find(*location_strategy, move(selector), get_start_node, GC::create_function(current_browsing_context().heap(), [this](Web::WebDriver::Response result) {
             // 10. If result is empty, return error with error code no such element. Otherwise, return the first element of result.
-            async_driver_execution_complete(extract_first_element(move(result)));
+            driver_execution_complete(extract_first_element(move(result)));
         }));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.3.3 Find Elements, https://w3c.github.io/webdriver/#dfn-find-elements
@@ -1052,11 +1087,11 @@ Messages::WebDriverClient::FindElementsResponse WebDriverConnection::find_elemen
 
         // 9. Return the result of trying to Find with session, start node, location strategy, and selector.
         find(*location_strategy, move(selector), get_start_node, GC::create_function(current_browsing_context().heap(), [this](Web::WebDriver::Response result) {
-            async_driver_execution_complete(move(result));
+            driver_execution_complete(move(result));
         }));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.3.4 Find Element From Element, https://w3c.github.io/webdriver/#dfn-find-element-from-element
@@ -1087,11 +1122,11 @@ Messages::WebDriverClient::FindElementFromElementResponse WebDriverConnection::f
         // 8. Let result be the value of trying to Find with session, start node, location strategy, and selector.
         find(*location_strategy, move(selector), get_start_node, GC::create_function(current_browsing_context().heap(), [this](Web::WebDriver::Response result) {
             // 9. If result is empty, return error with error code no such element. Otherwise, return the first element of result.
-            async_driver_execution_complete(extract_first_element(move(result)));
+            driver_execution_complete(extract_first_element(move(result)));
         }));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.3.5 Find Elements From Element, https://w3c.github.io/webdriver/#dfn-find-elements-from-element
@@ -1121,11 +1156,11 @@ Messages::WebDriverClient::FindElementsFromElementResponse WebDriverConnection::
 
         // 8. Return the result of trying to Find with session, start node, location strategy, and selector.
         find(*location_strategy, move(selector), get_start_node, GC::create_function(current_browsing_context().heap(), [this](Web::WebDriver::Response result) {
-            async_driver_execution_complete(move(result));
+            driver_execution_complete(move(result));
         }));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.3.6 Find Element From Shadow Root, https://w3c.github.io/webdriver/#find-element-from-shadow-root
@@ -1156,11 +1191,11 @@ Messages::WebDriverClient::FindElementFromShadowRootResponse WebDriverConnection
         // 8. Let result be the value of trying to Find with session, start node, location strategy, and selector.
         find(*location_strategy, move(selector), get_start_node, GC::create_function(current_browsing_context().heap(), [this](Web::WebDriver::Response result) {
             // 9. If result is empty, return error with error code no such element. Otherwise, return the first element of result.
-            async_driver_execution_complete(extract_first_element(move(result)));
+            driver_execution_complete(extract_first_element(move(result)));
         }));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.3.7 Find Elements From Shadow Root, https://w3c.github.io/webdriver/#find-elements-from-shadow-root
@@ -1190,11 +1225,11 @@ Messages::WebDriverClient::FindElementsFromShadowRootResponse WebDriverConnectio
 
         // 8. Return the result of trying to Find with session, start node, location strategy, and selector.
         find(*location_strategy, move(selector), get_start_node, GC::create_function(current_browsing_context().heap(), [this](Web::WebDriver::Response result) {
-            async_driver_execution_complete(move(result));
+            driver_execution_complete(move(result));
         }));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.3.8 Get Active Element, https://w3c.github.io/webdriver/#get-active-element
@@ -1212,14 +1247,14 @@ Messages::WebDriverClient::GetActiveElementResponse WebDriverConnection::get_act
         //    Otherwise, return error with error code no such element.
         if (active_element) {
             auto serialized = Web::WebDriver::web_element_reference_object(current_browsing_context(), *active_element);
-            async_driver_execution_complete({ move(serialized) });
+            driver_execution_complete({ move(serialized) });
             return;
         }
 
-        async_driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::NoSuchElement, "The current document does not have an active element"sv));
+        driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::NoSuchElement, "The current document does not have an active element"sv));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.3.9 Get Element Shadow Root, https://w3c.github.io/webdriver/#get-element-shadow-root
@@ -1238,7 +1273,7 @@ Messages::WebDriverClient::GetElementShadowRootResponse WebDriverConnection::get
 
         // 5. If shadow root is null, return error with error code no such shadow root.
         if (!shadow_root) {
-            async_driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::NoSuchShadowRoot, MUST(String::formatted("Element with ID '{}' does not have a shadow root", element_id))));
+            driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::NoSuchShadowRoot, MUST(String::formatted("Element with ID '{}' does not have a shadow root", element_id))));
             return;
         }
 
@@ -1246,10 +1281,10 @@ Messages::WebDriverClient::GetElementShadowRootResponse WebDriverConnection::get
         auto serialized = Web::WebDriver::shadow_root_reference_object(current_browsing_context(), *shadow_root);
 
         // 7. Return success with data serialized.
-        async_driver_execution_complete({ move(serialized) });
+        driver_execution_complete({ move(serialized) });
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.4.1 Is Element Selected, https://w3c.github.io/webdriver/#dfn-is-element-selected
@@ -1284,10 +1319,10 @@ Messages::WebDriverClient::IsElementSelectedResponse WebDriverConnection::is_ele
         //   -> False.
 
         // 5. Return success with data selected.
-        async_driver_execution_complete({ selected });
+        driver_execution_complete({ selected });
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.4.2 Get Element Attribute, https://w3c.github.io/webdriver/#dfn-get-element-attribute
@@ -1319,10 +1354,10 @@ Messages::WebDriverClient::GetElementAttributeResponse WebDriverConnection::get_
         }
 
         // 5. Return success with data result.
-        async_driver_execution_complete({ move(result) });
+        driver_execution_complete({ move(result) });
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.4.3 Get Element Property, https://w3c.github.io/webdriver/#dfn-get-element-property
@@ -1351,10 +1386,10 @@ Messages::WebDriverClient::GetElementPropertyResponse WebDriverConnection::get_e
         }
 
         // 7. Return success with data result.
-        async_driver_execution_complete(move(result));
+        driver_execution_complete(move(result));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.4.4 Get Element CSS Value, https://w3c.github.io/webdriver/#dfn-get-element-css-value
@@ -1385,10 +1420,10 @@ Messages::WebDriverClient::GetElementCssValueResponse WebDriverConnection::get_e
         //     "" (empty string)
 
         // 5. Return success with data computed value.
-        async_driver_execution_complete({ move(computed_value) });
+        driver_execution_complete({ move(computed_value) });
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.4.5 Get Element Text, https://w3c.github.io/webdriver/#dfn-get-element-text
@@ -1407,10 +1442,10 @@ Messages::WebDriverClient::GetElementTextResponse WebDriverConnection::get_eleme
         auto rendered_text = Web::WebDriver::element_rendered_text(element);
 
         // 5. Return success with data rendered text.
-        async_driver_execution_complete({ move(rendered_text) });
+        driver_execution_complete({ move(rendered_text) });
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.4.6 Get Element Tag Name, https://w3c.github.io/webdriver/#dfn-get-element-tag-name
@@ -1430,10 +1465,10 @@ Messages::WebDriverClient::GetElementTagNameResponse WebDriverConnection::get_el
         auto qualified_name = element->local_name();
 
         // 5. Return success with data qualified name.
-        async_driver_execution_complete({ qualified_name.to_string() });
+        driver_execution_complete({ qualified_name.to_string() });
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.4.7 Get Element Rect, https://w3c.github.io/webdriver/#dfn-get-element-rect
@@ -1463,10 +1498,10 @@ Messages::WebDriverClient::GetElementRectResponse WebDriverConnection::get_eleme
         auto body = serialize_rect(rect);
 
         // 7. Return success with data body.
-        async_driver_execution_complete(move(body));
+        driver_execution_complete(move(body));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.4.8 Is Element Enabled, https://w3c.github.io/webdriver/#dfn-is-element-enabled
@@ -1491,10 +1526,10 @@ Messages::WebDriverClient::IsElementEnabledResponse WebDriverConnection::is_elem
         }
 
         // 7. Return success with data enabled.
-        async_driver_execution_complete({ enabled });
+        driver_execution_complete({ enabled });
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.4.9 Get Computed Role, https://w3c.github.io/webdriver/#dfn-get-computed-role
@@ -1513,13 +1548,13 @@ Messages::WebDriverClient::GetComputedRoleResponse WebDriverConnection::get_comp
 
         // 5. Return success with data role.
         if (role.has_value()) {
-            async_driver_execution_complete({ Web::ARIA::role_name(*role) });
+            driver_execution_complete({ Web::ARIA::role_name(*role) });
             return;
         }
-        async_driver_execution_complete(JsonValue {});
+        driver_execution_complete(JsonValue {});
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.4.10 Get Computed Label, https://w3c.github.io/webdriver/#get-computed-label
@@ -1537,10 +1572,10 @@ Messages::WebDriverClient::GetComputedLabelResponse WebDriverConnection::get_com
         auto label = element->accessible_name(element->document()).release_value_but_fixme_should_propagate_errors();
 
         // 5. Return success with data label.
-        async_driver_execution_complete({ move(label) });
+        driver_execution_complete({ move(label) });
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 12.5.1 Element Click, https://w3c.github.io/webdriver/#element-click
@@ -1554,7 +1589,7 @@ Messages::WebDriverClient::ElementClickResponse WebDriverConnection::element_cli
         WEBDRIVER_TRY(element_click_impl(element_id));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 Web::WebDriver::Response WebDriverConnection::element_click_impl(StringView element_id)
@@ -1599,7 +1634,7 @@ Web::WebDriver::Response WebDriverConnection::element_click_impl(StringView elem
 
             // FIXME: 12. Try to run the post-navigation checks.
 
-            async_driver_execution_complete(move(result));
+            driver_execution_complete(move(result));
         }));
     });
 
@@ -1731,10 +1766,10 @@ Messages::WebDriverClient::ElementClearResponse WebDriverConnection::element_cle
 
     // 2. Try to handle any user prompts with session.
     handle_any_user_prompts([this, element_id = move(element_id)]() {
-        async_driver_execution_complete(element_clear_impl(element_id));
+        driver_execution_complete(element_clear_impl(element_id));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 Web::WebDriver::Response WebDriverConnection::element_clear_impl(StringView element_id)
@@ -1850,7 +1885,7 @@ Messages::WebDriverClient::ElementSendKeysResponse WebDriverConnection::element_
         WEBDRIVER_TRY(element_send_keys_impl(element_id, text));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 Web::WebDriver::Response WebDriverConnection::element_send_keys_impl(StringView element_id, String const& text)
@@ -1932,7 +1967,7 @@ Web::WebDriver::Response WebDriverConnection::element_send_keys_impl(StringView
         // NOTE: These events are fired by `did_select_files` as an element task. So instead of firing them here, we spin
         //       the event loop once before informing the client that the action is complete.
         Web::HTML::queue_a_task(Web::HTML::Task::Source::Unspecified, nullptr, nullptr, GC::create_function(current_browsing_context().heap(), [this]() {
-            async_driver_execution_complete(JsonValue {});
+            driver_execution_complete(JsonValue {});
         }));
 
         // 8. Return success with data null.
@@ -1956,7 +1991,7 @@ Web::WebDriver::Response WebDriverConnection::element_send_keys_impl(StringView
         // FIXME: 4. If element is suffering from bad input return an error with error code invalid argument.
 
         // 5. Return success with data null.
-        async_driver_execution_complete(JsonValue {});
+        driver_execution_complete(JsonValue {});
         return JsonValue {};
     }
     // -> element is content editable
@@ -2012,7 +2047,7 @@ Web::WebDriver::Response WebDriverConnection::element_send_keys_impl(StringView
         // 14. Remove an input source with input state and input id.
         Web::WebDriver::remove_input_source(input_state, input_id);
 
-        async_driver_execution_complete(move(result));
+        driver_execution_complete(move(result));
     }));
 
     // 15. Return success with data null.
@@ -2042,10 +2077,10 @@ Messages::WebDriverClient::GetSourceResponse WebDriverConnection::get_source()
             source = MUST(document->serialize_fragment(Web::HTML::RequireWellFormed::No));
 
         // 5. Return success with data source.
-        async_driver_execution_complete({ source.release_value() });
+        driver_execution_complete({ source.release_value() });
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 13.2.1 Execute Script, https://w3c.github.io/webdriver/#dfn-execute-script
@@ -2075,7 +2110,7 @@ Messages::WebDriverClient::ExecuteScriptResponse WebDriverConnection::execute_sc
         }));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 13.2.2 Execute Async Script, https://w3c.github.io/webdriver/#dfn-execute-async-script
@@ -2105,7 +2140,7 @@ Messages::WebDriverClient::ExecuteAsyncScriptResponse WebDriverConnection::execu
         }));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 void WebDriverConnection::handle_script_response(Web::WebDriver::ExecutionResult result, size_t script_execution_id)
@@ -2137,7 +2172,7 @@ void WebDriverConnection::handle_script_response(Web::WebDriver::ExecutionResult
         VERIFY_NOT_REACHED();
     }();
 
-    async_driver_execution_complete(move(response));
+    driver_execution_complete(move(response));
 }
 
 // 14.1 Get All Cookies, https://w3c.github.io/webdriver/#dfn-get-all-cookies
@@ -2163,10 +2198,10 @@ Messages::WebDriverClient::GetAllCookiesResponse WebDriverConnection::get_all_co
         }
 
         // 5. Return success with data cookies.
-        async_driver_execution_complete({ move(cookies) });
+        driver_execution_complete({ move(cookies) });
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 14.2 Get Named Cookie, https://w3c.github.io/webdriver/#dfn-get-named-cookie
@@ -2182,15 +2217,15 @@ Messages::WebDriverClient::GetNamedCookieResponse WebDriverConnection::get_named
 
         if (auto cookie = current_browsing_context().page().client().page_did_request_named_cookie(document->url(), name); cookie.has_value()) {
             auto serialized_cookie = serialize_cookie(*cookie);
-            async_driver_execution_complete(move(serialized_cookie));
+            driver_execution_complete(move(serialized_cookie));
             return;
         }
 
         // 4. Otherwise, return error with error code no such cookie.
-        async_driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::NoSuchCookie, MUST(String::formatted("Cookie '{}' not found", name))));
+        driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::NoSuchCookie, MUST(String::formatted("Cookie '{}' not found", name))));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 14.3 Add Cookie, https://w3c.github.io/webdriver/#dfn-adding-a-cookie
@@ -2207,10 +2242,10 @@ Messages::WebDriverClient::AddCookieResponse WebDriverConnection::add_cookie(Jso
 
     // 4. Handle any user prompts, and return its value if it is an error.
     handle_any_user_prompts([this, data = move(const_cast<JsonObject&>(data))]() {
-        async_driver_execution_complete(add_cookie_impl(data));
+        driver_execution_complete(add_cookie_impl(data));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 Web::WebDriver::Response WebDriverConnection::add_cookie_impl(JsonObject const& data)
@@ -2300,10 +2335,10 @@ Messages::WebDriverClient::DeleteCookieResponse WebDriverConnection::delete_cook
         delete_cookies(name);
 
         // 4. Return success with data null.
-        async_driver_execution_complete(JsonValue {});
+        driver_execution_complete(JsonValue {});
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 14.5 Delete All Cookies, https://w3c.github.io/webdriver/#dfn-delete-all-cookies
@@ -2318,10 +2353,10 @@ Messages::WebDriverClient::DeleteAllCookiesResponse WebDriverConnection::delete_
         delete_cookies();
 
         // 4. Return success with data null.
-        async_driver_execution_complete(JsonValue {});
+        driver_execution_complete(JsonValue {});
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 15.7 Perform Actions, https://w3c.github.io/webdriver/#perform-actions
@@ -2350,14 +2385,14 @@ Messages::WebDriverClient::PerformActionsResponse WebDriverConnection::perform_a
         //    results in an error return that error.
         auto on_complete = GC::create_function(current_browsing_context().heap(), [this](Web::WebDriver::Response result) {
             m_action_executor = nullptr;
-            async_driver_execution_complete(move(result));
+            driver_execution_complete(move(result));
         });
 
         m_action_executor = Web::WebDriver::dispatch_actions(input_state, move(actions_by_tick), current_browsing_context(), move(actions_options), on_complete);
     });
 
     // 7. Return success with data null.
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 15.8 Release Actions, https://w3c.github.io/webdriver/#release-actions
@@ -2397,14 +2432,14 @@ Messages::WebDriverClient::ReleaseActionsResponse WebDriverConnection::release_a
             // 8. Reset the input state with session and session's current top-level browsing context.
             Web::WebDriver::reset_input_state(*current_top_level_browsing_context());
 
-            async_driver_execution_complete(move(result));
+            driver_execution_complete(move(result));
         });
 
         m_action_executor = Web::WebDriver::dispatch_actions(input_state, { move(undo_actions) }, current_browsing_context(), move(actions_options), on_complete);
     });
 
     // 9. Return success with data null.
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 16.1 Dismiss Alert, https://w3c.github.io/webdriver/#dismiss-alert
@@ -2419,11 +2454,11 @@ Messages::WebDriverClient::DismissAlertResponse WebDriverConnection::dismiss_ale
 
     // 3. Dismiss the current user prompt.
     current_browsing_context().page().dismiss_dialog(GC::create_function(current_browsing_context().heap(), [this]() {
-        async_driver_execution_complete(JsonValue {});
+        driver_execution_complete(JsonValue {});
     }));
 
     // 4. Return success with data null.
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 16.2 Accept Alert, https://w3c.github.io/webdriver/#accept-alert
@@ -2438,11 +2473,11 @@ Messages::WebDriverClient::AcceptAlertResponse WebDriverConnection::accept_alert
 
     // 3. Accept the current user prompt.
     current_browsing_context().page().accept_dialog(GC::create_function(current_browsing_context().heap(), [this]() {
-        async_driver_execution_complete(JsonValue {});
+        driver_execution_complete(JsonValue {});
     }));
 
     // 4. Return success with data null.
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 16.3 Get Alert Text, https://w3c.github.io/webdriver/#get-alert-text
@@ -2531,11 +2566,11 @@ Messages::WebDriverClient::TakeScreenshotResponse WebDriverConnection::take_scre
             auto encoded_string = Web::WebDriver::encode_canvas_element(canvas);
 
             // 3. Return success with data encoded string.
-            async_driver_execution_complete(move(encoded_string));
+            driver_execution_complete(move(encoded_string));
         }));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 17.2 Take Element Screenshot, https://w3c.github.io/webdriver/#dfn-take-element-screenshot
@@ -2569,11 +2604,11 @@ Messages::WebDriverClient::TakeElementScreenshotResponse WebDriverConnection::ta
             auto encoded_string = Web::WebDriver::encode_canvas_element(canvas);
 
             // 6. Return success with data encoded string.
-            async_driver_execution_complete(move(encoded_string));
+            driver_execution_complete(move(encoded_string));
         }));
     });
 
-    return JsonValue {};
+    return async_command_response();
 }
 
 // 18.1 Print Page, https://w3c.github.io/webdriver/#dfn-print-page
@@ -2612,7 +2647,7 @@ void WebDriverConnection::set_current_top_level_browsing_context(Web::HTML::Brow
     if (m_current_top_level_browsing_context) {
         m_current_top_level_browsing_context->page().set_window_rect_observer(GC::create_function(m_current_top_level_browsing_context->heap(), [this](Web::DevicePixelRect rect) {
             if (m_pending_window_rect_requests > 0 && --m_pending_window_rect_requests == 0)
-                async_driver_execution_complete(serialize_rect(rect.to_type<int>()));
+                driver_execution_complete(serialize_rect(rect.to_type<int>()));
         }));
     }
 
@@ -2720,7 +2755,7 @@ void WebDriverConnection::handle_any_user_prompts(Function<void()> on_dialog_clo
     auto on_complete = GC::create_function(heap, [this, notify = handler.notify, pending_dialog_text = page.pending_dialog_text(), on_dialog_closed = GC::create_function(heap, move(on_dialog_closed))]() {
         // 5. If handler's notify is true, return annotated unexpected alert open error.
         if (notify == Web::WebDriver::PromptHandlerConfiguration::Notify::Yes) {
-            async_driver_execution_complete(create_annotated_unexpected_alert_open_error(pending_dialog_text));
+            driver_execution_complete(create_annotated_unexpected_alert_open_error(pending_dialog_text));
             return;
         }
 
@@ -2853,7 +2888,7 @@ void WebDriverConnection::page_did_open_dialog(Badge<PageClient>)
     // [[Value]]: null, [[Target]]: empty }, but continue to run the other steps of this algorithm in parallel.
     if (m_current_script_execution_id.has_value()) {
         m_current_script_execution_id.clear();
-        async_driver_execution_complete(JsonValue {});
+        driver_execution_complete(JsonValue {});
     }
 }
 
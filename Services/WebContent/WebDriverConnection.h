@@ -46,6 +46,13 @@ private:
 
     virtual void die() override { }
 
+    virtual ErrorOr<OwnPtr<IPC::MessageBuffer>> handle(NonnullOwnPtr<IPC::Message>) override;
+
+    // Commands that WebDriver performs asynchronously return async_command_response() from their handler, and report
+    // their result with driver_execution_complete().
+    void driver_execution_complete(Web::WebDriver::Response);
+    Web::WebDriver::Response async_command_response();
+
     virtual void close_session() override;
     virtual void set_page_load_strategy(Web::WebDriver::PageLoadStrategy page_load_strategy) override;
     virtual void set_user_prompt_handler(Web::WebDriver::UserPromptHandler user_prompt_handler) override;
@@ -184,6 +191,9 @@ private:
     GC::Ptr<Web::DOM::DocumentObserver> m_document_observer;
     GC::Ptr<Web::HTML::NavigationObserver> m_navigation_observer;
     GC::Ptr<Web::WebDriver::HeapTimer> m_navigation_timer;
+
+    bool m_is_handling_command { false };
+    Optional<Web::WebDriver::Response> m_completed_response;
 };
 
 }
@@ -8,8 +8,10 @@
 #include <LibCore/ArgsParser.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/LocalServer.h>
+#include <LibCore/MemoryReporting.h>
 #include <LibCore/Process.h>
 #include <LibCore/Resource.h>
+#include <LibCore/System.h>
 #include <LibCore/SystemServerTakeover.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/PathFontProvider.h>
@@ -19,6 +21,8 @@
 #include <LibMedia/Audio/Loader.h>
 #include <LibRequests/RequestClient.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/CSS/DecodedFontCache.h>
+#include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Internals/Internals.h>
 #include <LibWeb/Loader/ContentFilter.h>
@@ -51,6 +55,15 @@ static ErrorOr<void> initialize_resource_loader(GC::Heap&, int request_server_so
 static ErrorOr<void> initialize_image_decoder(int image_decoder_socket);
 static ErrorOr<void> reinitialize_image_decoder(IPC::File const& image_decoder_socket);
 
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+struct ForkedProcessSockets {
+    int ipc_socket { -1 };
+    int image_decoder_socket { -1 };
+    int request_server_socket { -1 };
+};
+static ErrorOr<ForkedProcessSockets> serve_fork_requests(int zygote_socket);
+#endif
+
 namespace JS {
 
 extern bool g_log_all_js_exceptions;
@@ -73,25 +86,8 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 {
     AK::set_rich_debug_enabled(true);
 
-#if defined(HAVE_QT_MULTIMEDIA)
-    QCoreApplication app(arguments.argc, arguments.argv);
-
-    Core::EventLoopManager::install(*new WebView::EventLoopManagerQt);
-#endif
-    Core::EventLoop event_loop;
-
     WebView::platform_init();
 
-    Web::Platform::EventLoopPlugin::install(*new Web::Platform::EventLoopPluginSerenity);
-
-    Web::Platform::AudioCodecPlugin::install_creation_hook([](auto loader) {
-#if defined(HAVE_QT_MULTIMEDIA)
-        return Ladybird::AudioCodecPluginQt::create(move(loader));
-#else
-        return Web::Platform::AudioCodecPluginAgnostic::create(move(loader));
-#endif
-    });
-
     StringView command_line {};
     StringView executable_path {};
     auto config_path = ByteString::formatted("{}/ladybird/default-config", WebView::s_ladybird_resource_root);
@@ -99,6 +95,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     Vector<ByteString> certificates;
     int request_server_socket { -1 };
     int image_decoder_socket { -1 };
+    int zygote_socket { -1 };
     bool is_layout_test_mode = false;
     bool expose_internals_object = false;
     bool wait_for_debugger = false;
@@ -109,6 +106,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     bool force_cpu_painting = false;
     bool force_fontconfig = false;
     bool collect_garbage_on_every_allocation = false;
+    bool track_allocation_sites = false;
     bool is_headless = false;
     bool disable_scrollbar_painting = false;
     StringView echo_server_port_string_view {};
@@ -131,9 +129,11 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
     args_parser.add_option(collect_garbage_on_every_allocation, "Collect garbage after every JS heap allocation", "collect-garbage-on-every-allocation");
+    args_parser.add_option(track_allocation_sites, "Record the JS source location of every JS heap allocation in GC graph dumps", "track-allocation-sites");
     args_parser.add_option(disable_scrollbar_painting, "Don't paint horizontal or vertical viewport scrollbars", "disable-scrollbar-painting");
     args_parser.add_option(echo_server_port_string_view, "Echo server port used in test internals", "echo-server-port", 0, "echo_server_port");
     args_parser.add_option(is_headless, "Report that the browser is running in headless mode", "headless");
+    args_parser.add_option(zygote_socket, "File descriptor of the socket over which to serve requests to fork new WebContent processes", "zygote-socket", 0, "zygote_socket");
 
     args_parser.parse(arguments);
 
@@ -147,6 +147,40 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     }
     font_provider.load_all_fonts_from_uri("resource://fonts"sv);
 
+    auto maybe_content_filter_error = load_content_filters(config_path);
+    if (maybe_content_filter_error.is_error())
+        dbgln("Failed to load content filters: {}", maybe_content_filter_error.error());
+
+    Optional<int> webcontent_socket_fd;
+
+    // NOTE: Everything up to here is the same for every WebContent process, so a zygote does it once and then forks.
+    //       This has to happen before anything starts a thread or creates an event loop, as neither survive a fork.
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+    if (zygote_socket != -1) {
+        auto sockets = TRY(serve_fork_requests(zygote_socket));
+        webcontent_socket_fd = sockets.ipc_socket;
+        image_decoder_socket = sockets.image_decoder_socket;
+        request_server_socket = sockets.request_server_socket;
+    }
+#endif
+
+#if defined(HAVE_QT_MULTIMEDIA)
+    QCoreApplication app(arguments.argc, arguments.argv);
+
+    Core::EventLoopManager::install(*new WebView::EventLoopManagerQt);
+#endif
+    Core::EventLoop event_loop;
+
+    Web::Platform::EventLoopPlugin::install(*new Web::Platform::EventLoopPluginSerenity);
+
+    Web::Platform::AudioCodecPlugin::install_creation_hook([](auto loader) {
+#if defined(HAVE_QT_MULTIMEDIA)
+        return Ladybird::AudioCodecPluginQt::create(move(loader));
+#else
+        return Web::Platform::AudioCodecPluginAgnostic::create(move(loader));
+#endif
+    });
+
     // Layout test mode implies internals object is exposed and the Skia CPU backend is used
     if (is_layout_test_mode) {
         expose_internals_object = true;
@@ -200,8 +234,16 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     if (collect_garbage_on_every_allocation)
         Web::Bindings::main_thread_vm().heap().set_should_collect_on_every_allocation(true);
 
+    if (track_allocation_sites)
+        Web::Bindings::main_thread_vm().set_track_allocation_sites(true);
+
     TRY(initialize_resource_loader(Web::Bindings::main_thread_vm().heap(), request_server_socket));
 
+    Core::MemoryReporting::register_reporter([](Core::MemoryReports& reports) {
+        Web::CSS::DecodedFontCache::the().report_memory_usage(reports);
+        Web::HTML::AnimatedBitmapDecodedImageData::report_memory_usage(reports);
+    });
+
     if (log_all_js_exceptions) {
         JS::g_log_all_js_exceptions = true;
     }
@@ -210,13 +252,11 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         Web::WebIDL::g_enable_idl_tracing = true;
     }
 
-    auto maybe_content_filter_error = load_content_filters(config_path);
-    if (maybe_content_filter_error.is_error())
-        dbgln("Failed to load content filters: {}", maybe_content_filter_error.error());
-
     // TODO: Mach IPC
 
-    auto webcontent_socket = TRY(Core::take_over_socket_from_system_server("WebContent"sv));
+    auto webcontent_socket = webcontent_socket_fd.has_value()
+        ? TRY(Core::LocalSocket::adopt_fd(*webcontent_socket_fd))
+        : TRY(Core::take_over_socket_from_system_server("WebContent"sv));
     auto webcontent_client = TRY(WebContent::ConnectionFromClient::try_create(make<IPC::Transport>(move(webcontent_socket))));
 
     webcontent_client->on_image_decoder_connection = [&](auto& socket_file) {
@@ -252,6 +292,95 @@ static ErrorOr<void> load_content_filters(StringView config_path)
     return {};
 }
 
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+static void reply_to_fork_request(int zygote_socket, pid_t pid)
+{
+    if (auto result = Core::System::write(zygote_socket, { &pid, sizeof(pid) }); result.is_error())
+        dbgln("WebContent zygote: Unable to reply to fork request: {}", result.error());
+}
+
+// Serves requests to fork new WebContent processes until the browser closes its end of the socket. Only ever returns in
+// a newly forked process, with the sockets that process was asked for.
+ErrorOr<ForkedProcessSockets> serve_fork_requests(int zygote_socket)
+{
+    TRY(Core::System::set_close_on_exec(zygote_socket, true));
+
+    for (;;) {
+        u8 request = 0;
+        struct iovec iov {
+            .iov_base = &request,
+            .iov_len = sizeof(request),
+        };
+
+        alignas(struct cmsghdr) char control_buf[CMSG_SPACE(sizeof(int) * 3)] {};
+        struct msghdr message = {};
+        message.msg_iov = &iov;
+        message.msg_iovlen = 1;
+        message.msg_control = control_buf;
+        message.msg_controllen = sizeof(control_buf);
+
+        auto received = Core::System::recvmsg(zygote_socket, &message, 0);
+        if (received.is_error()) {
+            if (received.error().code() == EINTR)
+                continue;
+            return received.release_error();
+        }
+        if (received.value() == 0)
+            exit(0);
+
+        Vector<int, 3> fds;
+        for (auto* header = CMSG_FIRSTHDR(&message); header; header = CMSG_NXTHDR(&message, header)) {
+            if (header->cmsg_level != SOL_SOCKET || header->cmsg_type != SCM_RIGHTS)
+                continue;
+
+            auto fd_count = (header->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+            for (size_t i = 0; i < fd_count; ++i) {
+                int fd;
+                memcpy(&fd, CMSG_DATA(header) + (i * sizeof(int)), sizeof(int));
+                fds.append(fd);
+            }
+        }
+
+        if (fds.size() < 2 || fds.size() > 3 || (message.msg_flags & MSG_CTRUNC) != 0) {
+            dbgln("WebContent zygote: Received a fork request with {} file descriptors", fds.size());
+            for (auto fd : fds)
+                (void)Core::System::close(fd);
+            reply_to_fork_request(zygote_socket, -1);
+            continue;
+        }
+
+        // NOTE: We fork twice, so that the new process is orphaned right away and reparented to the browser, which
+        //       made itself a child subreaper. The browser can then wait for it like for any other helper process.
+        auto intermediate_pid = fork();
+        if (intermediate_pid == 0) {
+            auto pid = fork();
+            if (pid == 0) {
+                (void)Core::System::close(zygote_socket);
+                return ForkedProcessSockets {
+                    .ipc_socket = fds[0],
+                    .image_decoder_socket = fds[1],
+                    .request_server_socket = fds.size() > 2 ? fds[2] : -1,
+                };
+            }
+
+            reply_to_fork_request(zygote_socket, pid);
+            _exit(0);
+        }
+
+        for (auto fd : fds)
+            (void)Core::System::close(fd);
+
+        if (intermediate_pid < 0) {
+            dbgln("WebContent zygote: Unable to fork: {}", Error::from_errno(errno));
+            reply_to_fork_request(zygote_socket, -1);
+            continue;
+        }
+
+        (void)Core::System::waitpid(intermediate_pid);
+    }
+}
+#endif
+
 ErrorOr<void> initialize_resource_loader(GC::Heap& heap, int request_server_socket)
 {
     // TODO: Mach IPC
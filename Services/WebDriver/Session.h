@@ -74,7 +74,9 @@ public:
         ScopeGuard guard { [&]() { connection.on_driver_execution_complete = nullptr; } };
         connection.on_driver_execution_complete = [&](auto result) { response = move(result); };
 
-        TRY(action(connection));
+        // WebContent replies with the response right away if the command completed while it was being handled.
+        if (auto immediate_response = action(connection); !immediate_response.is_pending())
+            return immediate_response;
 
         Core::EventLoop::current().spin_until([&]() {
             return response.has_value();
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/Coroutine.h>
+#include <AK/String.h>
+
+namespace {
+
+struct ManualEvent {
+    bool await_ready() const { return is_set; }
+    void await_suspend(std::coroutine_handle<> handle) { waiter = handle; }
+    void await_resume() { }
+
+    void set()
+    {
+        is_set = true;
+        if (auto handle = AK::exchange(waiter, {}))
+            handle.resume();
+    }
+
+    bool is_set { false };
+    std::coroutine_handle<> waiter;
+};
+
+Coroutine<int> return_immediately(int value)
+{
+    co_return value;
+}
+
+Coroutine<int> wait_then_return(ManualEvent& event, int value)
+{
+    co_await event;
+    co_return value;
+}
+
+Coroutine<int> add_awaited_values(ManualEvent& event)
+{
+    auto first = co_await return_immediately(20);
+    auto second = co_await wait_then_return(event, 22);
+    co_return first + second;
+}
+
+Coroutine<void> set_flag_after(ManualEvent& event, bool& flag)
+{
+    co_await event;
+    flag = true;
+}
+
+}
+
+TEST_CASE(runs_eagerly)
+{
+    auto coroutine = return_immediately(42);
+    EXPECT(coroutine.is_done());
+    EXPECT_EQ(coroutine.take_return_value(), 42);
+}
+
+TEST_CASE(resumes_awaiting_coroutine)
+{
+    ManualEvent event;
+    auto coroutine = add_awaited_values(event);
+    EXPECT(!coroutine.is_done());
+
+    event.set();
+    EXPECT(coroutine.is_done());
+    EXPECT_EQ(coroutine.take_return_value(), 42);
+}
+
+TEST_CASE(move_only_return_value)
+{
+    auto coroutine = []() -> Coroutine<String> {
+        co_return "well hello friends"_string;
+    }();
+    EXPECT_EQ(coroutine.take_return_value(), "well hello friends"sv);
+}
+
+TEST_CASE(detached_coroutine_runs_to_completion)
+{
+    ManualEvent event;
+    bool flag = false;
+    set_flag_after(event, flag).detach();
+    EXPECT(!flag);
+
+    event.set();
+    EXPECT(flag);
+}
+
+TEST_CASE(destroying_suspended_coroutine)
+{
+    ManualEvent event;
+    bool flag = false;
+    {
+        auto coroutine = set_flag_after(event, flag);
+        EXPECT(!coroutine.is_done());
+    }
+    event.waiter = {};
+    event.set();
+    EXPECT(!flag);
+}
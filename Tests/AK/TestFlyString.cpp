@@ -8,6 +8,7 @@
 
 #include <AK/FlyString.h>
 #include <AK/String.h>
+#include <AK/Vector.h>
 #include <AK/Try.h>
 
 TEST_CASE(empty_string)
@@ -87,20 +88,20 @@ TEST_CASE(from_string_view)
 
 TEST_CASE(fly_string_keep_string_data_alive)
 {
-    EXPECT_EQ(FlyString::number_of_fly_strings(), 0u);
+    auto number_of_fly_strings = FlyString::number_of_fly_strings();
     {
         FlyString fly {};
         {
-            auto string = "thisisdefinitelymorethan7bytes"_string;
+            auto string = "thisisdefinitelymorethan7bytesaswell"_string;
             fly = FlyString { string };
-            EXPECT_EQ(FlyString::number_of_fly_strings(), 1u);
+            EXPECT_EQ(FlyString::number_of_fly_strings(), number_of_fly_strings + 1);
         }
 
-        EXPECT_EQ(fly, "thisisdefinitelymorethan7bytes"sv);
-        EXPECT_EQ(FlyString::number_of_fly_strings(), 1u);
+        EXPECT_EQ(fly, "thisisdefinitelymorethan7bytesaswell"sv);
+        EXPECT_EQ(FlyString::number_of_fly_strings(), number_of_fly_strings + 1);
     }
 
-    EXPECT_EQ(FlyString::number_of_fly_strings(), 0u);
+    EXPECT_EQ(FlyString::number_of_fly_strings(), number_of_fly_strings);
 }
 
 TEST_CASE(moved_fly_string_becomes_empty)
@@ -134,3 +135,38 @@ TEST_CASE(is_one_of)
     EXPECT(bar.is_one_of("bar"sv, "foo"sv));
     EXPECT(bar.is_one_of("bar"sv));
 }
+
+TEST_CASE(fly_string_literals_stay_interned)
+{
+    // The data of fly string literals is never freed, so it stays in the fly string table.
+    auto number_of_fly_strings = FlyString::number_of_fly_strings();
+    {
+        auto fly = "thisisafreshfly_stringliteral"_fly_string;
+        EXPECT_EQ(FlyString::number_of_fly_strings(), number_of_fly_strings + 1);
+    }
+    EXPECT_EQ(FlyString::number_of_fly_strings(), number_of_fly_strings + 1);
+
+    // Strings with the same contents created at runtime share the literal's data.
+    FlyString fly1 = "thisisafreshfly_stringliteral"_fly_string;
+    FlyString fly2 { "thisisafreshfly_stringliteral"_string };
+    EXPECT_EQ(fly1, fly2);
+    EXPECT_EQ(FlyString::number_of_fly_strings(), number_of_fly_strings + 1);
+
+    // And a literal whose contents were interned at runtime first shares the runtime data.
+    FlyString fly3 { "thiswasinternedbeforetheliteral"_string };
+    auto fly4 = "thiswasinternedbeforetheliteral"_fly_string;
+    EXPECT_EQ(fly3, fly4);
+    EXPECT_EQ(FlyString::number_of_fly_strings(), number_of_fly_strings + 2);
+}
+
+BENCHMARK_CASE(fly_string_from_string)
+{
+    Vector<String> strings;
+    for (int i = 0; i < 1'000; ++i)
+        strings.append(MUST(String::formatted("a long enough string to be interned {}", i)));
+
+    for (size_t i = 0; i < 1'000; ++i) {
+        for (auto const& string : strings)
+            (void)FlyString { string };
+    }
+}
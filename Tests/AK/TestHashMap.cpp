@@ -10,6 +10,7 @@
 #include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
 #include <AK/String.h>
+#include <AK/Vector.h>
 
 TEST_CASE(construct)
 {
@@ -327,3 +328,41 @@ TEST_CASE(move_assign)
     EXPECT_EQ(second.size(), static_cast<size_t>(3));
     EXPECT_EQ(second.get(2), Optional<int>(20));
 }
+
+BENCHMARK_CASE(hash_map_set_and_get_integers)
+{
+    for (size_t i = 0; i < 10; ++i) {
+        HashMap<int, int> map;
+        for (int j = 0; j < 100'000; ++j)
+            map.set(j, j);
+        for (int j = 0; j < 100'000; ++j)
+            EXPECT_EQ(map.get(j), j);
+    }
+}
+
+BENCHMARK_CASE(hash_map_set_and_get_strings)
+{
+    Vector<String> keys;
+    for (int i = 0; i < 10'000; ++i)
+        keys.append(MUST(String::formatted("key number {}", i)));
+
+    for (size_t i = 0; i < 10; ++i) {
+        HashMap<String, int> map;
+        for (auto const& key : keys)
+            map.set(key, 0);
+        for (auto const& key : keys)
+            EXPECT(map.contains(key));
+    }
+}
+
+BENCHMARK_CASE(hash_map_remove)
+{
+    for (size_t i = 0; i < 10; ++i) {
+        HashMap<int, int> map;
+        for (int j = 0; j < 100'000; ++j)
+            map.set(j, j);
+        for (int j = 0; j < 100'000; ++j)
+            map.remove(j);
+        EXPECT(map.is_empty());
+    }
+}
@@ -6,6 +6,7 @@
 
 #include <LibTest/TestCase.h>
 
+#include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonValue.h>
 #include <AK/StringBuilder.h>
@@ -639,3 +640,22 @@ TEST_CASE(json_object_move_from_value)
     EXPECT_EQ(array2->at(0).as_bool(), false);
     EXPECT_EQ(array2->at(1).as_string(), "string"sv);
 }
+
+BENCHMARK_CASE(parse_and_serialize)
+{
+    StringBuilder builder;
+    builder.append('[');
+    for (size_t i = 0; i < 1'000; ++i) {
+        if (i != 0)
+            builder.append(',');
+        builder.appendff(R"({{"id":{},"name":"item {}","price":{}.5,"tags":["a","b","c"],"available":true,"parent":null}})", i, i, i);
+    }
+    builder.append(']');
+    auto json = builder.to_byte_string();
+
+    for (size_t i = 0; i < 100; ++i) {
+        auto value = MUST(JsonValue::from_string(json));
+        EXPECT_EQ(value.as_array().size(), 1'000u);
+        (void)value.serialized();
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/ByteString.h>
+#include <AK/SPSCQueue.h>
+#include <LibThreading/Thread.h>
+
+TEST_CASE(basic)
+{
+    SPSCQueue<int, 4> ints;
+    EXPECT(ints.is_empty());
+    EXPECT(!ints.try_dequeue().has_value());
+
+    EXPECT(ints.try_enqueue(1));
+    EXPECT(ints.try_enqueue(2));
+    EXPECT(ints.try_enqueue(3));
+    EXPECT(ints.try_enqueue(4));
+    EXPECT(!ints.try_enqueue(5));
+    EXPECT(!ints.is_empty());
+    EXPECT(ints.is_full());
+
+    EXPECT_EQ(ints.try_dequeue(), 1);
+    EXPECT(!ints.is_full());
+    EXPECT(ints.try_enqueue(5));
+    EXPECT_EQ(ints.try_dequeue(), 2);
+    EXPECT_EQ(ints.try_dequeue(), 3);
+    EXPECT_EQ(ints.try_dequeue(), 4);
+    EXPECT_EQ(ints.try_dequeue(), 5);
+    EXPECT(!ints.try_dequeue().has_value());
+    EXPECT(ints.is_empty());
+}
+
+TEST_CASE(complex_type)
+{
+    SPSCQueue<ByteString, 2> strings;
+    EXPECT(strings.try_enqueue("ABC"sv));
+    EXPECT(strings.try_enqueue("DEF"sv));
+    EXPECT(!strings.try_enqueue("GHI"sv));
+
+    EXPECT_EQ(strings.try_dequeue(), "ABC");
+    EXPECT_EQ(strings.try_dequeue(), "DEF");
+}
+
+TEST_CASE(destroys_remaining_elements)
+{
+    struct Counted {
+        Counted(int& counter)
+            : counter(&counter)
+        {
+        }
+        Counted(Counted&& other)
+            : counter(exchange(other.counter, nullptr))
+        {
+        }
+        ~Counted()
+        {
+            if (counter)
+                ++*counter;
+        }
+        int* counter { nullptr };
+    };
+
+    int destroyed = 0;
+    {
+        SPSCQueue<Counted, 4> queue;
+        EXPECT(queue.try_enqueue(Counted { destroyed }));
+        EXPECT(queue.try_enqueue(Counted { destroyed }));
+        EXPECT_EQ(destroyed, 0);
+    }
+    EXPECT_EQ(destroyed, 2);
+}
+
+TEST_CASE(producer_and_consumer_threads)
+{
+    static constexpr u32 value_count = 100000;
+    IGNORE_USE_IN_ESCAPING_LAMBDA SPSCQueue<u32, 64> queue;
+
+    auto producer = Threading::Thread::construct([&]() {
+        for (u32 i = 0; i < value_count;) {
+            if (queue.try_enqueue(i))
+                ++i;
+        }
+        return 0;
+    });
+    producer->start();
+
+    u32 expected = 0;
+    while (expected < value_count) {
+        if (auto value = queue.try_dequeue(); value.has_value()) {
+            EXPECT_EQ(*value, expected);
+            ++expected;
+        }
+    }
+
+    MUST(producer->join());
+    EXPECT(queue.is_empty());
+}
@@ -442,6 +442,27 @@ TEST_CASE(to_lowercase_special_casing_i)
     EXPECT_EQ(result, "\u0131a\u0307"sv);
 }
 
+TEST_CASE(to_lowercase_ascii)
+{
+    auto result = MUST("Hello, WORLD! 123"_string.to_lowercase());
+    EXPECT_EQ(result, "hello, world! 123"sv);
+
+    result = MUST("HELLO"_string.to_lowercase("en-US"sv));
+    EXPECT_EQ(result, "hello"sv);
+
+    result = MUST("WIKI"_string.to_lowercase("tr-TR"sv));
+    EXPECT_EQ(result, "w\u0131k\u0131"sv);
+
+    result = MUST("WIKI"_string.to_lowercase("AZ_Latn"sv));
+    EXPECT_EQ(result, "w\u0131k\u0131"sv);
+
+    result = MUST("wiki"_string.to_uppercase("tr-TR"sv));
+    EXPECT_EQ(result, "W\u0130K\u0130"sv);
+
+    result = MUST("wiki"_string.to_uppercase("trv"sv));
+    EXPECT_EQ(result, "WIKI"sv);
+}
+
 TEST_CASE(to_lowercase_special_casing_more_above)
 {
     // LATIN CAPITAL LETTER I
@@ -1600,3 +1621,24 @@ BENCHMARK_CASE(string_number_i64)
         (void)String::number(static_cast<i64>(-123456789));
     }
 }
+
+BENCHMARK_CASE(string_from_utf8)
+{
+    for (size_t i = 0; i < 1'000'000; ++i) {
+        (void)MUST(String::from_utf8("short"sv));
+        (void)MUST(String::from_utf8("a string that is too long to be stored inline"sv));
+    }
+}
+
+BENCHMARK_CASE(string_builder_append)
+{
+    for (size_t i = 0; i < 1'000; ++i) {
+        StringBuilder builder;
+        for (size_t j = 0; j < 1'000; ++j) {
+            builder.append("text "sv);
+            builder.append_code_point(0x1F600);
+            builder.appendff("{}", j);
+        }
+        (void)builder.to_string_without_validation();
+    }
+}
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/OwnPtr.h>
+#include <AK/String.h>
+#include <AK/SwissHashTable.h>
+
+TEST_CASE(construct)
+{
+    using IntIntMap = SwissHashMap<int, int>;
+    EXPECT(IntIntMap().is_empty());
+    EXPECT_EQ(IntIntMap().size(), 0u);
+    EXPECT_EQ(IntIntMap().capacity(), 0u);
+    EXPECT(!IntIntMap().contains(1));
+}
+
+TEST_CASE(populate_and_get)
+{
+    SwissHashMap<int, ByteString> number_to_string {
+        { 1, "One" },
+        { 2, "Two" },
+    };
+    EXPECT_EQ(number_to_string.set(3, "Three"), AK::HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(number_to_string.set(3, "Drei"), AK::HashSetResult::ReplacedExistingEntry);
+    EXPECT_EQ(number_to_string.set(3, "Tres", AK::HashSetExistingEntryBehavior::Keep), AK::HashSetResult::KeptExistingEntry);
+
+    EXPECT_EQ(number_to_string.size(), 3u);
+    EXPECT_EQ(number_to_string.get(1).value(), "One");
+    EXPECT_EQ(number_to_string.get(2).value(), "Two");
+    EXPECT_EQ(number_to_string.get(3).value(), "Drei");
+    EXPECT(!number_to_string.get(4).has_value());
+}
+
+TEST_CASE(remove)
+{
+    SwissHashMap<int, ByteString> number_to_string;
+    number_to_string.set(1, "One");
+    number_to_string.set(2, "Two");
+    number_to_string.set(3, "Three");
+
+    EXPECT(number_to_string.remove(2));
+    EXPECT(!number_to_string.remove(2));
+    EXPECT_EQ(number_to_string.size(), 2u);
+    EXPECT(!number_to_string.contains(2));
+    EXPECT(number_to_string.contains(1));
+    EXPECT(number_to_string.contains(3));
+
+    EXPECT_EQ(number_to_string.take(3).value(), "Three");
+    EXPECT_EQ(number_to_string.size(), 1u);
+}
+
+TEST_CASE(remove_all_matching)
+{
+    SwissHashMap<int, int> map;
+    for (int i = 0; i < 1000; ++i)
+        map.set(i, i * 2);
+
+    EXPECT(map.remove_all_matching([](int key, int) { return key % 2 == 1; }));
+    EXPECT_EQ(map.size(), 500u);
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_EQ(map.contains(i), i % 2 == 0);
+
+    EXPECT(!map.remove_all_matching([](int key, int) { return key % 2 == 1; }));
+}
+
+TEST_CASE(ensure)
+{
+    SwissHashMap<String, int> map;
+    EXPECT_EQ(map.ensure("foo"_string, [] { return 1; }), 1);
+    EXPECT_EQ(map.ensure("foo"_string, [] { return 2; }), 1);
+    EXPECT_EQ(map.size(), 1u);
+    EXPECT_EQ(map.get("foo"sv).value(), 1);
+}
+
+TEST_CASE(range_loop)
+{
+    SwissHashMap<int, int> map;
+    for (int i = 0; i < 100; ++i)
+        map.set(i, i);
+
+    int sum = 0;
+    size_t count = 0;
+    for (auto& [key, value] : map) {
+        EXPECT_EQ(key, value);
+        sum += value;
+        ++count;
+    }
+    EXPECT_EQ(count, 100u);
+    EXPECT_EQ(sum, 4950);
+}
+
+TEST_CASE(many_collisions)
+{
+    struct ConstantTraits : DefaultTraits<int> {
+        static unsigned hash(int) { return 0; }
+    };
+
+    SwissHashMap<int, int, ConstantTraits> map;
+    for (int i = 0; i < 100; ++i)
+        map.set(i, -i);
+
+    EXPECT_EQ(map.size(), 100u);
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(map.get(i).value(), -i);
+
+    for (int i = 0; i < 100; i += 3)
+        EXPECT(map.remove(i));
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(map.contains(i), i % 3 != 0);
+}
+
+TEST_CASE(reuse_deleted_slots)
+{
+    SwissHashMap<int, int> map;
+    map.ensure_capacity(100);
+    auto capacity = map.capacity();
+
+    // Removing and adding new keys over and over leaves deleted slots behind, which have to be cleared out eventually
+    // instead of growing the table.
+    for (int i = 0; i < 100'000; ++i) {
+        map.set(i, i);
+        if (i >= 50)
+            EXPECT(map.remove(i - 50));
+    }
+
+    EXPECT_EQ(map.size(), 50u);
+    EXPECT_EQ(map.capacity(), capacity);
+    for (int i = 100'000 - 50; i < 100'000; ++i)
+        EXPECT_EQ(map.get(i).value(), i);
+}
+
+TEST_CASE(copy_and_move)
+{
+    SwissHashMap<int, ByteString> map;
+    for (int i = 0; i < 50; ++i)
+        map.set(i, ByteString::number(i));
+
+    auto copy = map;
+    EXPECT_EQ(copy.size(), 50u);
+    for (int i = 0; i < 50; ++i)
+        EXPECT_EQ(copy.get(i).value(), ByteString::number(i));
+
+    auto moved = move(map);
+    EXPECT(map.is_empty());
+    EXPECT_EQ(moved.size(), 50u);
+    EXPECT_EQ(moved.get(42).value(), "42");
+
+    auto clone = TRY_OR_FAIL(moved.clone());
+    EXPECT_EQ(clone.size(), 50u);
+}
+
+TEST_CASE(clear_with_capacity)
+{
+    SwissHashMap<int, NonnullOwnPtr<int>> map;
+    for (int i = 0; i < 100; ++i)
+        map.set(i, make<int>(i));
+
+    auto capacity = map.capacity();
+    map.clear_with_capacity();
+    EXPECT(map.is_empty());
+    EXPECT_EQ(map.capacity(), capacity);
+    EXPECT(!map.contains(1));
+
+    map.set(1, make<int>(2));
+    EXPECT_EQ(*map.get(1).value(), 2);
+
+    map.clear();
+    EXPECT_EQ(map.capacity(), 0u);
+}
+
+template<typename MapType>
+static void benchmark_lookups()
+{
+    MapType map;
+    for (int i = 0; i < 100'000; ++i)
+        map.set(i * 7, i);
+
+    size_t found = 0;
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 200'000; ++i) {
+            if (map.contains(i * 7))
+                ++found;
+        }
+    }
+    EXPECT_EQ(found, 1'000'000u);
+}
+
+BENCHMARK_CASE(hash_map_lookups)
+{
+    benchmark_lookups<HashMap<int, int>>();
+}
+
+BENCHMARK_CASE(swiss_hash_map_lookups)
+{
+    benchmark_lookups<SwissHashMap<int, int>>();
+}
+
+template<typename MapType>
+static void benchmark_string_lookups()
+{
+    Vector<String> keys;
+    for (int i = 0; i < 10'000; ++i)
+        keys.append(MUST(String::formatted("class-name-{}", i)));
+
+    MapType map;
+    for (auto const& key : keys)
+        map.set(key, 0);
+
+    for (int round = 0; round < 100; ++round) {
+        for (auto const& key : keys)
+            ++map.find(key)->value;
+    }
+    EXPECT_EQ(map.get(keys.first()).value(), 100);
+}
+
+BENCHMARK_CASE(hash_map_string_lookups)
+{
+    benchmark_string_lookups<HashMap<String, int>>();
+}
+
+BENCHMARK_CASE(swiss_hash_map_string_lookups)
+{
+    benchmark_string_lookups<SwissHashMap<String, int>>();
+}
+
+template<typename MapType>
+static void benchmark_insert_and_remove()
+{
+    MapType map;
+    for (int i = 0; i < 1'000'000; ++i) {
+        map.set(i, i);
+        if (i >= 1000)
+            map.remove(i - 1000);
+    }
+    EXPECT_EQ(map.size(), 1000u);
+}
+
+BENCHMARK_CASE(hash_map_insert_and_remove)
+{
+    benchmark_insert_and_remove<HashMap<int, int>>();
+}
+
+BENCHMARK_CASE(swiss_hash_map_insert_and_remove)
+{
+    benchmark_insert_and_remove<SwissHashMap<int, int>>();
+}
@@ -8,6 +8,7 @@
 
 #include <AK/Array.h>
 #include <AK/String.h>
+#include <AK/StringBuilder.h>
 #include <AK/StringView.h>
 #include <AK/Types.h>
 #include <AK/Utf16View.h>
@@ -431,3 +432,27 @@ TEST_CASE(find_code_unit_offset_ignoring_case)
     EXPECT_EQ(7u, view.find_code_unit_offset_ignoring_case(u"baR"sv).value());
     EXPECT(!view.find_code_unit_offset_ignoring_case(u"baz"sv).has_value());
 }
+
+BENCHMARK_CASE(utf16_view_iterate)
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < 10'000; ++i)
+        builder.append("Hello, wörld! 😀 "sv);
+    auto string = MUST(AK::utf8_to_utf16(builder.string_view()));
+
+    for (size_t i = 0; i < 100; ++i) {
+        Utf16View view { string };
+        EXPECT(view.validate());
+
+        u64 sum = 0;
+        for (auto code_point : view)
+            sum += code_point;
+        EXPECT_NE(sum, 0u);
+    }
+}
+
+BENCHMARK_CASE(utf16_view_from_utf8)
+{
+    for (size_t i = 0; i < 100'000; ++i)
+        (void)MUST(AK::utf8_to_utf16("Hello, wörld! 😀 This is a moderately long string."sv));
+}
@@ -7,6 +7,7 @@
 #include <LibTest/TestCase.h>
 
 #include <AK/ByteBuffer.h>
+#include <AK/StringBuilder.h>
 #include <AK/Utf8View.h>
 
 TEST_CASE(decode_ascii)
@@ -346,3 +347,21 @@ TEST_CASE(code_point_offset_of)
     EXPECT_EQ(2u, view.code_point_offset_of(5));
     EXPECT_EQ(3u, view.code_point_offset_of(6));
 }
+
+BENCHMARK_CASE(utf8_view_iterate)
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < 10'000; ++i)
+        builder.append("Hello, wörld! 😀 "sv);
+    auto text = builder.to_byte_string();
+
+    for (size_t i = 0; i < 100; ++i) {
+        Utf8View view { text };
+        EXPECT(view.validate());
+
+        u64 sum = 0;
+        for (auto code_point : view)
+            sum += code_point;
+        EXPECT_NE(sum, 0u);
+    }
+}
@@ -643,3 +643,21 @@ TEST_CASE(uses_inline_capacity_when_constructed_from_span)
     for (auto& el : v)
         EXPECT(is_inline_element(el, v));
 }
+
+BENCHMARK_CASE(vector_append_non_trivial)
+{
+    for (size_t i = 0; i < 10; ++i) {
+        Vector<String> strings;
+        for (int j = 0; j < 100'000; ++j)
+            strings.append("a string that is too long to be stored inline"_string);
+        EXPECT_EQ(strings.size(), 100'000u);
+    }
+}
+
+BENCHMARK_CASE(vector_insert_at_front)
+{
+    Vector<int> ints;
+    for (int i = 0; i < 10'000; ++i)
+        ints.prepend(i);
+    EXPECT_EQ(ints.size(), 10'000u);
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/MemoryStream.h>
+#include <AK/Random.h>
+#include <LibCompress/Brotli.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(brotli_decompress_simple)
+{
+    Array<u8, 23> const compressed {
+        0x0b, 0x09, 0x80, 0x57, 0x65, 0x6c, 0x6c, 0x20, 0x68, 0x65, 0x6c, 0x6c,
+        0x6f, 0x20, 0x66, 0x72, 0x69, 0x65, 0x6e, 0x64, 0x73, 0x21, 0x03
+    };
+
+    auto const decompressed = TRY_OR_FAIL(Compress::BrotliDecompressor::decompress_all(compressed));
+    EXPECT_EQ(StringView { decompressed.bytes() }, "Well hello friends!"sv);
+}
+
+TEST_CASE(brotli_decompress_truncated)
+{
+    Array<u8, 12> const compressed {
+        0x0b, 0x09, 0x80, 0x57, 0x65, 0x6c, 0x6c, 0x20, 0x68, 0x65, 0x6c, 0x6c
+    };
+
+    EXPECT(Compress::BrotliDecompressor::decompress_all(compressed).is_error());
+}
+
+TEST_CASE(brotli_decompress_stream_in_pieces)
+{
+    Array<u8, 23> const compressed {
+        0x0b, 0x09, 0x80, 0x57, 0x65, 0x6c, 0x6c, 0x20, 0x68, 0x65, 0x6c, 0x6c,
+        0x6f, 0x20, 0x66, 0x72, 0x69, 0x65, 0x6e, 0x64, 0x73, 0x21, 0x03
+    };
+
+    auto stream = make<AllocatingMemoryStream>();
+    auto decompressor = TRY_OR_FAIL(Compress::BrotliDecompressor::create(MaybeOwned<Stream> { *stream }));
+
+    ByteBuffer decompressed;
+    Array<u8, 64> buffer;
+    for (size_t offset = 0; offset < compressed.size(); offset += 5) {
+        TRY_OR_FAIL(stream->write_until_depleted(compressed.span().slice(offset, min<size_t>(5, compressed.size() - offset))));
+        while (true) {
+            auto output = TRY_OR_FAIL(decompressor->read_some_available(buffer));
+            if (output.is_empty())
+                break;
+            decompressed.append(output);
+        }
+    }
+    EXPECT(decompressor->is_eof());
+    EXPECT_EQ(StringView { decompressed.bytes() }, "Well hello friends!"sv);
+}
+
+TEST_CASE(brotli_round_trip)
+{
+    auto original = TRY_OR_FAIL(ByteBuffer::create_zeroed(256 * KiB));
+    fill_with_random(original.bytes().trim(64 * KiB));
+
+    for (auto level : { Compress::GenericZlibCompressionLevel::Fastest, Compress::GenericZlibCompressionLevel::Default }) {
+        auto compressed = TRY_OR_FAIL(Compress::BrotliCompressor::compress_all(original, level));
+        EXPECT(compressed.size() < original.size());
+        auto uncompressed = TRY_OR_FAIL(Compress::BrotliDecompressor::decompress_all(compressed));
+        EXPECT(uncompressed == original);
+    }
+}
@@ -149,6 +149,21 @@ TEST_CASE(deflate_round_trip_compress_large)
     EXPECT(uncompressed == original);
 }
 
+TEST_CASE(deflate_round_trip_compress_parallel)
+{
+    // Back references across the blocks that are compressed on different threads must still resolve.
+    auto original = TRY_OR_FAIL(ByteBuffer::create_uninitialized(Compress::minimum_size_for_parallel_compression + 64 * KiB));
+    auto pattern = TRY_OR_FAIL(ByteBuffer::create_uninitialized(20 * KiB));
+    fill_with_random(pattern);
+    for (size_t offset = 0; offset < original.size(); offset += pattern.size())
+        original.bytes().slice(offset).overwrite(0, pattern.data(), min(pattern.size(), original.size() - offset));
+
+    auto compressed = TRY_OR_FAIL(Compress::DeflateCompressor::compress_all(original));
+    EXPECT(compressed.size() < original.size() / 10);
+    auto uncompressed = TRY_OR_FAIL(Compress::DeflateDecompressor::decompress_all(compressed));
+    EXPECT(uncompressed == original);
+}
+
 TEST_CASE(deflate_compress_literals)
 {
     // This byte array is known to not produce any back references with our lz77 implementation even at the highest compression settings
@@ -91,6 +91,17 @@ TEST_CASE(gzip_round_trip)
     EXPECT(uncompressed == original);
 }
 
+TEST_CASE(gzip_round_trip_parallel)
+{
+    auto original = TRY_OR_FAIL(ByteBuffer::create_uninitialized(Compress::minimum_size_for_parallel_compression * 2 + 1));
+    fill_with_random(original.bytes().trim(original.size() / 2));
+    original.bytes().slice(original.size() / 2).fill('A');
+
+    auto compressed = TRY_OR_FAIL(Compress::GzipCompressor::compress_all(original));
+    auto uncompressed = TRY_OR_FAIL(Compress::GzipDecompressor::decompress_all(compressed));
+    EXPECT(uncompressed == original);
+}
+
 TEST_CASE(gzip_truncated_uncompressed_block)
 {
     Array<u8, 38> const compressed {
@@ -77,6 +77,50 @@ TEST_CASE(zlib_round_trip_simple_fastest)
     EXPECT(decompressed.bytes() == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
 }
 
+TEST_CASE(zlib_decompress_stream_in_pieces)
+{
+    Array<u8, 40> const compressed {
+        0x78, 0x01, 0x01, 0x1D, 0x00, 0xE2, 0xFF, 0x54, 0x68, 0x69, 0x73, 0x20,
+        0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x20,
+        0x74, 0x65, 0x78, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x3A, 0x29,
+        0x99, 0x5E, 0x09, 0xE8
+    };
+
+    u8 const uncompressed[] = "This is a simple text file :)";
+
+    auto stream = make<AllocatingMemoryStream>();
+    auto input = MaybeOwned<Stream> { *stream };
+    auto decompressor = TRY_OR_FAIL(Compress::ZlibDecompressor::create(move(input)));
+
+    ByteBuffer decompressed;
+    Array<u8, 64> buffer;
+    for (size_t offset = 0; offset < compressed.size(); offset += 8) {
+        TRY_OR_FAIL(stream->write_until_depleted(compressed.span().slice(offset, 8)));
+        while (true) {
+            auto output = TRY_OR_FAIL(decompressor->read_some_available(buffer));
+            if (output.is_empty())
+                break;
+            decompressed.append(output);
+        }
+    }
+    EXPECT(decompressor->is_eof());
+    EXPECT(decompressed.bytes() == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
+}
+
+TEST_CASE(zlib_round_trip_parallel)
+{
+    auto original = TRY_OR_FAIL(ByteBuffer::create_zeroed(Compress::minimum_size_for_parallel_compression * 3 + 123));
+    for (size_t i = 0; i < original.size(); ++i)
+        original[i] = static_cast<u8>((i * 7) ^ (i >> 9));
+
+    auto const compressed = TRY_OR_FAIL(Compress::ZlibCompressor::compress_all(original));
+    EXPECT(compressed.span().slice(0, 2) == ReadonlyBytes { { 0x78, 0x9C } });
+    EXPECT(compressed.size() < original.size());
+
+    auto const decompressed = TRY_OR_FAIL(Compress::ZlibDecompressor::decompress_all(compressed));
+    EXPECT(decompressed == original);
+}
+
 TEST_CASE(zlib_decompress_with_missing_end_bits)
 {
     // This test case has been extracted from compressed PNG data of `/res/icons/16x16/app-masterword.png`.
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/MemoryStream.h>
+#include <AK/Random.h>
+#include <LibCompress/Zstd.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(zstd_decompress_simple)
+{
+    Array<u8, 32> const compressed {
+        0x28, 0xb5, 0x2f, 0xfd, 0x04, 0x58, 0x99, 0x00, 0x00, 0x57, 0x65, 0x6c,
+        0x6c, 0x20, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x66, 0x72, 0x69, 0x65,
+        0x6e, 0x64, 0x73, 0x21, 0x17, 0xb4, 0x1e, 0xfd
+    };
+
+    auto const decompressed = TRY_OR_FAIL(Compress::ZstdDecompressor::decompress_all(compressed));
+    EXPECT_EQ(StringView { decompressed.bytes() }, "Well hello friends!"sv);
+}
+
+TEST_CASE(zstd_decompress_multiple_frames)
+{
+    // Two frames, each holding "abc" in a single raw block.
+    Array<u8, 24> const compressed {
+        0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x03, 0x19, 0x00, 0x00, 0x61, 0x62, 0x63,
+        0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x03, 0x19, 0x00, 0x00, 0x61, 0x62, 0x63
+    };
+
+    auto const decompressed = TRY_OR_FAIL(Compress::ZstdDecompressor::decompress_all(compressed));
+    EXPECT_EQ(StringView { decompressed.bytes() }, "abcabc"sv);
+}
+
+TEST_CASE(zstd_decompress_truncated)
+{
+    Array<u8, 16> const compressed {
+        0x28, 0xb5, 0x2f, 0xfd, 0x04, 0x58, 0x99, 0x00, 0x00, 0x57, 0x65, 0x6c,
+        0x6c, 0x20, 0x68, 0x65
+    };
+
+    EXPECT(Compress::ZstdDecompressor::decompress_all(compressed).is_error());
+    EXPECT(Compress::ZstdDecompressor::decompress_all({}).is_error());
+}
+
+TEST_CASE(zstd_decompress_stream_in_pieces)
+{
+    Array<u8, 32> const compressed {
+        0x28, 0xb5, 0x2f, 0xfd, 0x04, 0x58, 0x99, 0x00, 0x00, 0x57, 0x65, 0x6c,
+        0x6c, 0x20, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x66, 0x72, 0x69, 0x65,
+        0x6e, 0x64, 0x73, 0x21, 0x17, 0xb4, 0x1e, 0xfd
+    };
+
+    auto stream = make<AllocatingMemoryStream>();
+    auto decompressor = TRY_OR_FAIL(Compress::ZstdDecompressor::create(MaybeOwned<Stream> { *stream }));
+
+    ByteBuffer decompressed;
+    Array<u8, 64> buffer;
+    for (size_t offset = 0; offset < compressed.size(); offset += 8) {
+        TRY_OR_FAIL(stream->write_until_depleted(compressed.span().slice(offset, 8)));
+        while (true) {
+            auto output = TRY_OR_FAIL(decompressor->read_some_available(buffer));
+            if (output.is_empty())
+                break;
+            decompressed.append(output);
+        }
+    }
+    EXPECT(decompressor->is_eof());
+    EXPECT_EQ(StringView { decompressed.bytes() }, "Well hello friends!"sv);
+}
+
+TEST_CASE(zstd_round_trip)
+{
+    auto original = TRY_OR_FAIL(ByteBuffer::create_zeroed(256 * KiB));
+    fill_with_random(original.bytes().trim(64 * KiB));
+
+    for (auto level : { Compress::GenericZlibCompressionLevel::Fastest, Compress::GenericZlibCompressionLevel::Default, Compress::GenericZlibCompressionLevel::Best }) {
+        auto compressed = TRY_OR_FAIL(Compress::ZstdCompressor::compress_all(original, level));
+        EXPECT(compressed.span().slice(0, 4) == ReadonlyBytes { { 0x28, 0xb5, 0x2f, 0xfd } });
+        auto uncompressed = TRY_OR_FAIL(Compress::ZstdDecompressor::decompress_all(compressed));
+        EXPECT(uncompressed == original);
+    }
+}
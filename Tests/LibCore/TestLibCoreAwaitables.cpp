@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Coroutine.h>
+#include <AK/Time.h>
+#include <LibCore/Awaitables.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/System.h>
+#include <LibTest/TestCase.h>
+#include <fcntl.h>
+
+TEST_CASE(sleep_for)
+{
+    Core::EventLoop loop;
+
+    auto start = MonotonicTime::now();
+    auto coroutine = []() -> Coroutine<void> {
+        co_await Core::sleep_for(20);
+    }();
+    EXPECT(!coroutine.is_done());
+
+    while (!coroutine.is_done())
+        loop.pump();
+    EXPECT(MonotonicTime::now() - start >= AK::Duration::from_milliseconds(20));
+}
+
+TEST_CASE(sleep_for_from_a_nested_coroutine)
+{
+    Core::EventLoop loop;
+
+    auto sleep_and_return = [](int value) -> Coroutine<int> {
+        co_await Core::sleep_for(1);
+        co_return value;
+    };
+
+    auto coroutine = [&]() -> Coroutine<int> {
+        auto first = co_await sleep_and_return(1);
+        auto second = co_await sleep_and_return(2);
+        co_return first + second;
+    }();
+
+    while (!coroutine.is_done())
+        loop.pump();
+    EXPECT_EQ(coroutine.take_return_value(), 3);
+}
+
+TEST_CASE(wait_until_readable)
+{
+    Core::EventLoop loop;
+
+    auto fds = MUST(Core::System::pipe2(O_CLOEXEC));
+    auto read_fd = fds[0];
+    auto write_fd = fds[1];
+
+    auto coroutine = [](int fd) -> Coroutine<u8> {
+        co_await Core::wait_until_readable(fd);
+
+        u8 byte = 0;
+        MUST(Core::System::read(fd, { &byte, 1 }));
+        co_return byte;
+    }(read_fd);
+
+    // Nothing has been written yet, so the coroutine must still be waiting.
+    loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT(!coroutine.is_done());
+
+    u8 byte = 42;
+    MUST(Core::System::write(write_fd, { &byte, 1 }));
+
+    while (!coroutine.is_done())
+        loop.pump();
+    EXPECT_EQ(coroutine.take_return_value(), 42);
+
+    MUST(Core::System::close(read_fd));
+    MUST(Core::System::close(write_fd));
+}
+
+TEST_CASE(wait_until_writable)
+{
+    Core::EventLoop loop;
+
+    auto fds = MUST(Core::System::pipe2(O_CLOEXEC));
+
+    // An empty pipe is always writable, but the coroutine still only resumes from the event loop.
+    auto coroutine = [](int fd) -> Coroutine<void> {
+        co_await Core::wait_until_writable(fd);
+    }(fds[1]);
+    EXPECT(!coroutine.is_done());
+
+    while (!coroutine.is_done())
+        loop.pump();
+
+    MUST(Core::System::close(fds[0]));
+    MUST(Core::System::close(fds[1]));
+}
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Coroutine.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Promise.h>
 #include <LibCore/ThreadedPromise.h>
@@ -115,6 +116,65 @@ TEST_CASE(promise_map_already_resolved)
     EXPECT_EQ(result.value(), 42);
 }
 
+TEST_CASE(promise_co_await)
+{
+    Core::EventLoop loop;
+
+    auto promise = MUST(Core::Promise<int>::try_create());
+    auto coroutine = [](NonnullRefPtr<Core::Promise<int>> promise) -> Coroutine<int> {
+        auto result = co_await *promise;
+        co_return result.value() * 2;
+    }(promise);
+    EXPECT(!coroutine.is_done());
+
+    loop.deferred_invoke([=] {
+        promise->resolve(21);
+    });
+
+    while (!coroutine.is_done())
+        loop.pump();
+    EXPECT_EQ(coroutine.take_return_value(), 42);
+}
+
+TEST_CASE(promise_co_await_already_rejected)
+{
+    Core::EventLoop loop;
+
+    auto promise = MUST(Core::Promise<int>::try_create());
+    promise->reject(AK::Error::from_string_literal("lol no"));
+
+    auto coroutine = [](NonnullRefPtr<Core::Promise<int>> promise) -> Coroutine<ErrorOr<int>> {
+        co_return co_await *promise;
+    }(promise);
+    EXPECT(coroutine.is_done());
+
+    auto result = coroutine.take_return_value();
+    EXPECT(result.is_error());
+    EXPECT_EQ(result.error().string_literal(), "lol no"sv);
+}
+
+TEST_CASE(threaded_promise_co_await)
+{
+    Core::EventLoop loop;
+
+    auto promise = Core::ThreadedPromise<int>::create();
+    auto coroutine = [](NonnullRefPtr<Core::ThreadedPromise<int>> promise) -> Coroutine<int> {
+        auto result = co_await *promise;
+        co_return result.value();
+    }(promise);
+
+    auto thread = Threading::Thread::construct([promise] {
+        promise->resolve(42);
+        return 0;
+    });
+    thread->start();
+
+    while (!coroutine.is_done())
+        loop.pump();
+    EXPECT_EQ(coroutine.take_return_value(), 42);
+    MUST(thread->join());
+}
+
 TEST_CASE(threaded_promise_instantly_resolved)
 {
     Core::EventLoop loop;
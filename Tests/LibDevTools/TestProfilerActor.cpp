@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/Time.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/Socket.h>
+#include <LibDevTools/DevToolsDelegate.h>
+#include <LibDevTools/DevToolsServer.h>
+#include <LibTest/TestCase.h>
+
+class TestDelegate final : public DevTools::DevToolsDelegate {
+public:
+    virtual Vector<DevTools::TabDescription> tab_list() const override
+    {
+        return { { .id = 1, .title = "Test"_string, .url = "about:blank"_string } };
+    }
+
+    virtual void start_javascript_profiler(DevTools::TabDescription const& tab) const override
+    {
+        EXPECT_EQ(tab.id, 1u);
+        ++start_count;
+    }
+
+    virtual void stop_javascript_profiler(DevTools::TabDescription const& tab, OnJavaScriptProfileReceived on_complete) const override
+    {
+        EXPECT_EQ(tab.id, 1u);
+        ++stop_count;
+
+        JsonObject profile;
+        profile.set("samples"sv, JsonArray {});
+        on_complete(JsonValue { move(profile) });
+    }
+
+    mutable size_t start_count { 0 };
+    mutable size_t stop_count { 0 };
+};
+
+// Talks to a DevToolsServer in this process the way Firefox would, pumping our event loop while waiting for replies.
+class DevToolsClient {
+public:
+    DevToolsClient(Core::EventLoop& event_loop, u16 port)
+        : m_event_loop(event_loop)
+        , m_socket(MUST(Core::TCPSocket::connect("127.0.0.1"sv, port)))
+    {
+    }
+
+    void send(StringView to, StringView type, JsonObject message = {})
+    {
+        message.set("to"sv, to);
+        message.set("type"sv, type);
+
+        auto serialized = message.serialized();
+        MUST(m_socket->write_formatted("{}:{}", serialized.byte_count(), serialized));
+    }
+
+    JsonObject receive_from(StringView actor)
+    {
+        while (true) {
+            auto message = receive();
+            if (message.get_string("from"sv) == actor)
+                return message;
+        }
+    }
+
+    JsonObject request(StringView to, StringView type, JsonObject message = {})
+    {
+        send(to, type, move(message));
+        return receive_from(to);
+    }
+
+private:
+    JsonObject receive()
+    {
+        auto deadline = MonotonicTime::now() + AK::Duration::from_seconds(5);
+        while (!MUST(m_socket->can_read_without_blocking())) {
+            VERIFY(MonotonicTime::now() < deadline);
+            m_event_loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+        }
+
+        ByteBuffer length_buffer;
+        while (true) {
+            auto byte = MUST(m_socket->read_value<u8>());
+            if (byte == ':')
+                break;
+            length_buffer.append(byte);
+        }
+
+        ByteBuffer message_buffer;
+        message_buffer.resize(StringView { length_buffer }.to_number<size_t>().value());
+        MUST(m_socket->read_until_filled(message_buffer));
+
+        return MUST(JsonValue::from_string(message_buffer)).as_object();
+    }
+
+    Core::EventLoop& m_event_loop;
+    NonnullOwnPtr<Core::TCPSocket> m_socket;
+};
+
+struct ProfilerActorTest {
+    ProfilerActorTest()
+        : server(MUST(DevTools::DevToolsServer::create(delegate, 0)))
+        , client(event_loop, server->local_port().value())
+    {
+        (void)client.receive_from("root"sv);
+
+        auto tabs = client.request("root"sv, "listTabs"sv);
+        auto tab = tabs.get_array("tabs"sv)->at(0).as_object().get_string("actor"sv).value();
+
+        auto watcher = client.request(tab, "getWatcher"sv).get_string("actor"sv).value();
+
+        JsonObject watch_targets;
+        watch_targets.set("targetType"sv, "frame"sv);
+        auto targets = client.request(watcher, "watchTargets"sv, move(watch_targets));
+        profiler = targets.get_object("target"sv)->get_string("profilerActor"sv).value();
+    }
+
+    bool is_active()
+    {
+        return client.request(profiler, "isActive"sv).get_bool("isActive"sv).value();
+    }
+
+    Core::EventLoop event_loop;
+    TestDelegate delegate;
+    NonnullOwnPtr<DevTools::DevToolsServer> server;
+    DevToolsClient client;
+    String profiler;
+};
+
+TEST_CASE(profiler_starts_inactive)
+{
+    ProfilerActorTest test;
+    EXPECT(!test.is_active());
+    EXPECT_EQ(test.delegate.start_count, 0u);
+}
+
+TEST_CASE(start_and_get_profile)
+{
+    ProfilerActorTest test;
+
+    auto started = test.client.request(test.profiler, "startProfiler"sv);
+    EXPECT_EQ(started.get_bool("value"sv).value(), true);
+    EXPECT_EQ(test.delegate.start_count, 1u);
+    EXPECT(test.is_active());
+
+    auto stopped = test.client.request(test.profiler, "getProfileAndStopProfiler"sv);
+    EXPECT_EQ(test.delegate.stop_count, 1u);
+    EXPECT(stopped.get_object("profile"sv).has_value());
+    EXPECT(stopped.get_object("profile"sv)->get_array("samples"sv).has_value());
+    EXPECT(!test.is_active());
+}
+
+TEST_CASE(start_and_discard_profile)
+{
+    ProfilerActorTest test;
+
+    (void)test.client.request(test.profiler, "startProfiler"sv);
+    auto stopped = test.client.request(test.profiler, "stopProfilerAndDiscardProfile"sv);
+    EXPECT_EQ(test.delegate.stop_count, 1u);
+    EXPECT(!stopped.get_object("profile"sv).has_value());
+    EXPECT(!test.is_active());
+}
+
+TEST_CASE(stopping_an_inactive_profiler_does_nothing)
+{
+    ProfilerActorTest test;
+
+    auto stopped = test.client.request(test.profiler, "getProfileAndStopProfiler"sv);
+    EXPECT(!stopped.get_object("profile"sv).has_value());
+
+    (void)test.client.request(test.profiler, "stopProfilerAndDiscardProfile"sv);
+    EXPECT_EQ(test.delegate.stop_count, 0u);
+}
+
+TEST_CASE(unknown_packets_are_rejected)
+{
+    ProfilerActorTest test;
+
+    auto response = test.client.request(test.profiler, "notAProfilerPacket"sv);
+    EXPECT_EQ(response.get_string("error"sv).value(), "unrecognizedPacketType"sv);
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/Vector.h>
+#include <LibGC/Cell.h>
+#include <LibGC/CellAllocator.h>
+#include <LibGC/Heap.h>
+#include <LibGC/Root.h>
+#include <LibTest/TestCase.h>
+
+static constexpr size_t cell_count = 50'000;
+
+// Only cells with an id below this are reachable from the roots. The rest form small clusters that only refer to
+// each other, so a stray conservative root can keep at most a handful of them alive.
+static constexpr size_t reachable_cell_count = cell_count / 2;
+static constexpr size_t unreachable_cluster_size = 4;
+
+class TestCell final : public GC::Cell {
+    GC_CELL(TestCell, GC::Cell);
+    GC_DECLARE_ALLOCATOR(TestCell);
+
+public:
+    TestCell(size_t id, Vector<bool>& collected)
+        : m_id(id)
+        , m_collected(collected)
+    {
+    }
+
+    size_t id() const { return m_id; }
+    size_t visit_count() const { return m_visit_count.load(); }
+
+    void add_edge(TestCell& cell) { m_edges.append(cell); }
+
+private:
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        m_visit_count.fetch_add(1);
+        for (auto& edge : m_edges)
+            visitor.visit(edge);
+    }
+
+    virtual void finalize() override
+    {
+        Base::finalize();
+        m_collected[m_id] = true;
+    }
+
+    size_t m_id { 0 };
+    Vector<bool>& m_collected;
+    Vector<GC::Ptr<TestCell>> m_edges;
+    Atomic<size_t> m_visit_count { 0 };
+};
+
+GC_DEFINE_ALLOCATOR(TestCell);
+
+struct Graph {
+    Vector<TestCell*> cells;
+    Vector<GC::Root<TestCell>> roots;
+};
+
+// Every reachable cell hangs off a binary tree rooted at cell 0, and has a few more edges to other reachable cells,
+// so that several workers race to mark the same cells.
+[[gnu::noinline]] static Graph build_graph(GC::Heap& heap, Vector<bool>& collected)
+{
+    Graph graph;
+    graph.cells.ensure_capacity(cell_count);
+    for (size_t id = 0; id < cell_count; ++id)
+        graph.cells.unchecked_append(heap.allocate<TestCell>(id, collected).ptr());
+
+    u32 seed = 1;
+    auto next_random = [&] {
+        seed = seed * 1103515245 + 12345;
+        return seed >> 8;
+    };
+
+    for (size_t id = 1; id < reachable_cell_count; ++id) {
+        graph.cells[(id - 1) / 2]->add_edge(*graph.cells[id]);
+        for (size_t i = 0; i < 3; ++i)
+            graph.cells[id]->add_edge(*graph.cells[next_random() % reachable_cell_count]);
+    }
+
+    for (size_t id = reachable_cell_count; id < cell_count; ++id) {
+        auto cluster_start = id - (id - reachable_cell_count) % unreachable_cluster_size;
+        auto next_in_cluster = cluster_start + (id - cluster_start + 1) % unreachable_cluster_size;
+        if (next_in_cluster < cell_count)
+            graph.cells[id]->add_edge(*graph.cells[next_in_cluster]);
+        graph.cells[id]->add_edge(*graph.cells[next_random() % reachable_cell_count]);
+    }
+
+    graph.roots.append(GC::make_root(graph.cells[0]));
+    graph.roots.append(GC::make_root(graph.cells[reachable_cell_count / 3]));
+    return graph;
+}
+
+// Overwrite the stack below us, so that pointers left behind by build_graph() aren't found by conservative scanning.
+[[gnu::noinline]] static void clobber_stack()
+{
+    volatile u8 buffer[64 * KiB];
+    for (size_t i = 0; i < sizeof(buffer); ++i)
+        buffer[i] = 0;
+}
+
+struct MarkingResult {
+    Vector<bool> collected;
+    size_t marking_threads_used { 0 };
+};
+
+static MarkingResult collect_with_marking_threads(size_t marking_thread_count)
+{
+    MarkingResult result;
+    result.collected.resize(cell_count);
+
+    GC::Heap heap(nullptr, [](auto&) { });
+    heap.set_marking_thread_count(marking_thread_count);
+
+    auto graph = build_graph(heap, result.collected);
+    clobber_stack();
+    heap.collect_garbage();
+    result.marking_threads_used = heap.marking_threads_used_by_last_collection();
+
+    size_t unreachable_survivors = 0;
+    for (size_t id = 0; id < cell_count; ++id) {
+        if (id < reachable_cell_count) {
+            EXPECT(!result.collected[id]);
+            EXPECT_EQ(graph.cells[id]->visit_count(), 1u);
+        } else if (!result.collected[id]) {
+            ++unreachable_survivors;
+        }
+    }
+    EXPECT(unreachable_survivors <= unreachable_cluster_size);
+
+    // NOTE: Drop the roots and collect everything before the heap goes away, while the graph's cells are still valid.
+    graph.roots.clear();
+    heap.collect_garbage(GC::Heap::CollectionType::CollectEverything);
+    return result;
+}
+
+TEST_CASE(serial_marking)
+{
+    auto result = collect_with_marking_threads(1);
+    EXPECT_EQ(result.marking_threads_used, 1u);
+}
+
+TEST_CASE(parallel_marking)
+{
+    auto result = collect_with_marking_threads(4);
+    EXPECT_EQ(result.marking_threads_used, 4u);
+}
+
+TEST_CASE(parallel_marking_marks_the_same_cells_as_serial_marking)
+{
+    auto serial = collect_with_marking_threads(1);
+    auto parallel = collect_with_marking_threads(4);
+    for (size_t id = 0; id < reachable_cell_count; ++id)
+        EXPECT_EQ(parallel.collected[id], serial.collected[id]);
+}
+
+TEST_CASE(small_heaps_are_marked_on_the_collecting_thread)
+{
+    Vector<bool> collected;
+    collected.resize(1);
+
+    GC::Heap heap(nullptr, [](auto&) { });
+    heap.set_marking_thread_count(4);
+
+    auto root = GC::make_root(heap.allocate<TestCell>(0, collected));
+    heap.collect_garbage();
+    EXPECT_EQ(heap.marking_threads_used_by_last_collection(), 1u);
+    EXPECT(!collected[0]);
+    EXPECT_EQ(root->visit_count(), 1u);
+}
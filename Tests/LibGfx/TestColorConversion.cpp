@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Vector.h>
+#include <LibGfx/ColorConversion.h>
+#include <LibTest/TestCase.h>
+
+// Every combination of an alpha value and a channel value, with the channels being different from each other. The odd
+// pixel count makes sure that the pixels after the last full vector are converted too.
+static Vector<Gfx::ARGB32> all_alpha_and_channel_combinations()
+{
+    Vector<Gfx::ARGB32> pixels;
+    for (u32 alpha = 0; alpha < 256; ++alpha) {
+        for (u32 channel = 0; channel < 256; ++channel)
+            pixels.append((alpha << 24) | (channel << 16) | ((255 - channel) << 8) | (channel / 2));
+    }
+    pixels.take_last();
+    return pixels;
+}
+
+TEST_CASE(premultiply_alpha)
+{
+    auto pixels = all_alpha_and_channel_combinations();
+    auto expected = pixels;
+    for (auto& pixel : expected)
+        pixel = Color::from_argb(pixel).to_premultiplied().value();
+
+    Gfx::premultiply_alpha(pixels);
+    EXPECT_EQ(pixels, expected);
+}
+
+TEST_CASE(unpremultiply_alpha)
+{
+    auto pixels = all_alpha_and_channel_combinations();
+    auto expected = pixels;
+    for (auto& pixel : expected)
+        pixel = Color::from_argb(pixel).to_unpremultiplied().value();
+
+    Gfx::unpremultiply_alpha(pixels);
+    EXPECT_EQ(pixels, expected);
+}
+
+TEST_CASE(convert_cmyk_to_bgrx)
+{
+    Vector<Gfx::CMYK> cmyk;
+    for (u32 k = 0; k < 256; ++k) {
+        for (u32 c = 0; c < 256; ++c)
+            cmyk.append({ static_cast<u8>(c), static_cast<u8>(255 - c), static_cast<u8>(c / 3), static_cast<u8>(k) });
+    }
+    cmyk.take_last();
+
+    Vector<Gfx::ARGB32> expected;
+    for (auto const& pixel : cmyk) {
+        u8 k = 255 - pixel.k;
+        expected.append(Color((255 - pixel.c) * k / 255, (255 - pixel.m) * k / 255, (255 - pixel.y) * k / 255).value());
+    }
+
+    Vector<Gfx::ARGB32> rgb;
+    rgb.resize(cmyk.size());
+    Gfx::convert_cmyk_to_bgrx(cmyk, rgb);
+    EXPECT_EQ(rgb, expected);
+}
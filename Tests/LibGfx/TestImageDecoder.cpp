@@ -339,6 +339,32 @@ TEST_CASE(test_jpeg_sof2_successive_aproximation)
     TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 600, 800 }));
 }
 
+TEST_CASE(test_jpeg_partial_data)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/rgb24.jpg"sv)));
+    auto partial_data = file->bytes().trim(file->size() * 6 / 10);
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create_for_partial_data(partial_data));
+
+    auto frame = TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 64, 64 }));
+
+    // Rows that have been received are decoded top-down, the rest are left transparent.
+    EXPECT_EQ(frame.image->get_pixel(0, 0).alpha(), 255);
+    EXPECT_EQ(frame.image->get_pixel(0, 63), Gfx::Color::NamedColor::Transparent);
+}
+
+TEST_CASE(test_jpeg_partial_data_progressive)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/spectral_selection.jpg"sv)));
+    auto partial_data = file->bytes().trim(file->size() * 6 / 10);
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create_for_partial_data(partial_data));
+
+    auto frame = TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 592, 800 }));
+
+    // The first scans cover the whole image, so even the last row is there already.
+    EXPECT_EQ(frame.image->get_pixel(0, 0).alpha(), 255);
+    EXPECT_EQ(frame.image->get_pixel(0, 799).alpha(), 255);
+}
+
 TEST_CASE(test_jpeg_empty_icc)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/gradient_empty_icc.jpg"sv)));
@@ -404,6 +430,25 @@ TEST_CASE(test_png)
     TRY_OR_FAIL(expect_single_frame(*plugin_decoder));
 }
 
+TEST_CASE(test_png_partial_data)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/buggie.png"sv)));
+    auto full_decoder = TRY_OR_FAIL(Gfx::PNGImageDecoderPlugin::create(file->bytes()));
+    auto full_frame = TRY_OR_FAIL(expect_single_frame_of_size(*full_decoder, { 64, 138 }));
+
+    auto partial_data = file->bytes().trim(file->size() * 95 / 100);
+    auto decoder = TRY_OR_FAIL(Gfx::ImageDecoder::try_create_for_partial_raw_bytes(partial_data));
+    EXPECT(decoder);
+    auto frame = TRY_OR_FAIL(decoder->frame(0));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(64, 138));
+
+    // Rows that have been received match the complete image, the rest are left transparent.
+    for (int x = 0; x < 64; ++x) {
+        EXPECT_EQ(frame.image->get_pixel(x, 60), full_frame.image->get_pixel(x, 60));
+        EXPECT_EQ(frame.image->get_pixel(x, 137), Gfx::Color::NamedColor::Transparent);
+    }
+}
+
 TEST_CASE(test_apng)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/apng-1-frame.png"sv)));
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/YUVData.h>
+#include <LibTest/TestCase.h>
+
+static NonnullRefPtr<Gfx::YUVData> create_solid_yuv_data(u8 y, u8 u, u8 v, Gfx::YUVMatrixCoefficients matrix_coefficients, Gfx::YUVRange range)
+{
+    auto yuv_data = MUST(Gfx::YUVData::create({ 4, 4 }, 8, true, true));
+    yuv_data->set_matrix_coefficients(matrix_coefficients);
+    yuv_data->set_range(range);
+    yuv_data->plane_data(0).fill(y);
+    yuv_data->plane_data(1).fill(u);
+    yuv_data->plane_data(2).fill(v);
+    return yuv_data;
+}
+
+static void expect_color_near(Color actual, Color expected)
+{
+    constexpr int tolerance = 2;
+    EXPECT(abs(actual.red() - expected.red()) <= tolerance);
+    EXPECT(abs(actual.green() - expected.green()) <= tolerance);
+    EXPECT(abs(actual.blue() - expected.blue()) <= tolerance);
+}
+
+TEST_CASE(chroma_size)
+{
+    auto yuv_data = MUST(Gfx::YUVData::create({ 5, 3 }, 8, true, false));
+    EXPECT_EQ(yuv_data->chroma_size(), Gfx::IntSize(3, 3));
+
+    yuv_data = MUST(Gfx::YUVData::create({ 5, 3 }, 10, true, true));
+    EXPECT_EQ(yuv_data->chroma_size(), Gfx::IntSize(3, 2));
+    EXPECT_EQ(yuv_data->plane_pitch(0), 10u);
+}
+
+TEST_CASE(limited_range_greys)
+{
+    auto black = MUST(create_solid_yuv_data(16, 128, 128, Gfx::YUVMatrixCoefficients::BT709, Gfx::YUVRange::Limited)->to_bitmap());
+    expect_color_near(black->get_pixel(1, 1), Color::Black);
+
+    auto white = MUST(create_solid_yuv_data(235, 128, 128, Gfx::YUVMatrixCoefficients::BT709, Gfx::YUVRange::Limited)->to_bitmap());
+    expect_color_near(white->get_pixel(1, 1), Color::White);
+
+    auto grey = MUST(create_solid_yuv_data(126, 128, 128, Gfx::YUVMatrixCoefficients::BT709, Gfx::YUVRange::Limited)->to_bitmap());
+    expect_color_near(grey->get_pixel(1, 1), Color(128, 128, 128));
+}
+
+TEST_CASE(full_range_red)
+{
+    // Y, U and V of pure red under BT.601.
+    auto red = MUST(create_solid_yuv_data(76, 85, 255, Gfx::YUVMatrixCoefficients::BT601, Gfx::YUVRange::Full)->to_bitmap());
+    expect_color_near(red->get_pixel(2, 2), Color(254, 0, 0));
+}
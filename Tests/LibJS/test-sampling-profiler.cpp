@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashTable.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+// Keeps calling hotFunction() until at least 50ms have passed, so that plenty of samples land inside it.
+static constexpr auto busy_script = R"~~~(
+function hotFunction() {
+    let sum = 0;
+    for (let i = 0; i < 1000; ++i)
+        sum += i;
+    return sum;
+}
+
+const start = Date.now();
+while (Date.now() - start < 50)
+    hotFunction();
+)~~~"sv;
+
+struct SamplingProfilerTest {
+    SamplingProfilerTest()
+        : vm(JS::VM::create())
+        , execution_context(JS::create_simple_execution_context<JS::GlobalObject>(*vm))
+    {
+    }
+
+    void run(StringView source_text)
+    {
+        auto script = MUST(JS::Script::parse(source_text, *execution_context->realm, "test.js"sv));
+        EXPECT(!vm->bytecode_interpreter().run(*script).is_error());
+    }
+
+    NonnullRefPtr<JS::VM> vm;
+    NonnullOwnPtr<JS::ExecutionContext> execution_context;
+};
+
+TEST_CASE(nothing_is_sampled_without_a_profiler)
+{
+    SamplingProfilerTest test;
+    EXPECT(!test.vm->sampling_profiler());
+
+    test.run(busy_script);
+    EXPECT(!test.vm->stop_sampling_profiler());
+}
+
+TEST_CASE(samples_are_collected_while_running)
+{
+    SamplingProfilerTest test;
+    test.vm->start_sampling_profiler(AK::Duration::from_microseconds(100));
+    EXPECT(test.vm->sampling_profiler());
+
+    test.run(busy_script);
+
+    auto profiler = test.vm->stop_sampling_profiler();
+    EXPECT(profiler);
+    EXPECT(!test.vm->sampling_profiler());
+    EXPECT(profiler->sample_count() > 0);
+
+    auto folded_stacks = profiler->to_folded_stacks();
+    EXPECT(folded_stacks.contains("hotFunction@test.js:"sv));
+}
+
+TEST_CASE(no_samples_are_collected_after_stopping)
+{
+    SamplingProfilerTest test;
+    test.vm->start_sampling_profiler(AK::Duration::from_microseconds(100));
+    test.run(busy_script);
+
+    auto profiler = test.vm->stop_sampling_profiler();
+    auto sample_count = profiler->sample_count();
+
+    test.run(busy_script);
+    EXPECT_EQ(profiler->sample_count(), sample_count);
+}
+
+TEST_CASE(cpuprofile_has_a_node_for_every_sample)
+{
+    SamplingProfilerTest test;
+    test.vm->start_sampling_profiler(AK::Duration::from_microseconds(100));
+    test.run(busy_script);
+    auto profiler = test.vm->stop_sampling_profiler();
+
+    auto json = MUST(JsonValue::from_string(profiler->to_cpuprofile_json()));
+    EXPECT(json.is_object());
+    auto const& profile = json.as_object();
+
+    auto samples = profile.get_array("samples"sv);
+    auto time_deltas = profile.get_array("timeDeltas"sv);
+    auto nodes = profile.get_array("nodes"sv);
+    EXPECT(samples.has_value() && time_deltas.has_value() && nodes.has_value());
+    EXPECT_EQ(samples->size(), profiler->sample_count());
+    EXPECT_EQ(time_deltas->size(), profiler->sample_count());
+
+    // Every sample refers to a node by its id, and one of the nodes is our hot function.
+    HashTable<i64> node_ids;
+    bool found_hot_function = false;
+    nodes->for_each([&](JsonValue const& node) {
+        node_ids.set(node.as_object().get_integer<i64>("id"sv).value());
+        auto function_name = node.as_object().get_object("callFrame"sv)->get_string("functionName"sv);
+        if (function_name == "hotFunction"sv)
+            found_hot_function = true;
+    });
+    EXPECT(found_hot_function);
+
+    samples->for_each([&](JsonValue const& sample) {
+        EXPECT(node_ids.contains(sample.get_integer<i64>().value()));
+    });
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibJS/AST.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+static ByteString large_script(StringView statement)
+{
+    StringBuilder builder;
+    while (builder.length() < JS::VM::minimum_cached_script_size)
+        builder.appendff("{}\n", statement);
+    return builder.to_byte_string();
+}
+
+struct ScriptCacheTest {
+    ScriptCacheTest()
+        : vm(JS::VM::create())
+        , execution_context(JS::create_simple_execution_context<JS::GlobalObject>(*vm))
+    {
+    }
+
+    JS::Realm& realm() { return *execution_context->realm; }
+
+    // NOTE: The parse nodes are kept alive here, so that a new one can't end up at the address of an old one.
+    NonnullRefPtr<JS::Program const> parse(StringView source_text, JS::Realm& realm)
+    {
+        return JS::Script::parse(source_text, realm, "test.js"sv).release_value()->parse_node();
+    }
+
+    NonnullRefPtr<JS::Program const> parse(StringView source_text) { return parse(source_text, realm()); }
+
+    NonnullRefPtr<JS::VM> vm;
+    NonnullOwnPtr<JS::ExecutionContext> execution_context;
+};
+
+TEST_CASE(identical_source_reuses_parse_node)
+{
+    ScriptCacheTest test;
+    auto source = large_script("var a = 1 + 2;"sv);
+
+    auto first = test.parse(source);
+    auto second = test.parse(source);
+    EXPECT_EQ(first.ptr(), second.ptr());
+    EXPECT_EQ(test.vm->script_cache_entry_count(), 1u);
+}
+
+TEST_CASE(changed_source_is_parsed_again)
+{
+    ScriptCacheTest test;
+    auto source = large_script("var a = 1 + 2;"sv);
+    auto changed_source = ByteString::formatted("{}var b;\n", source);
+
+    auto first = test.parse(source);
+    auto second = test.parse(changed_source);
+    EXPECT_NE(first.ptr(), second.ptr());
+    EXPECT_EQ(second->source_code().code(), changed_source.view());
+    EXPECT_EQ(test.vm->script_cache_entry_count(), 2u);
+}
+
+TEST_CASE(small_scripts_are_not_cached)
+{
+    ScriptCacheTest test;
+
+    auto first = test.parse("var a = 1;"sv);
+    auto second = test.parse("var a = 1;"sv);
+    EXPECT_NE(first.ptr(), second.ptr());
+    EXPECT_EQ(test.vm->script_cache_entry_count(), 0u);
+}
+
+TEST_CASE(partitions_do_not_share_parse_nodes)
+{
+    ScriptCacheTest test;
+    auto other_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*test.vm);
+    auto& other_realm = *other_execution_context->realm;
+
+    test.vm->host_get_script_cache_partition = [&](JS::Realm& realm) -> Optional<String> {
+        if (&realm == &other_realm)
+            return "https://other.example"_string;
+        return "https://example.com"_string;
+    };
+
+    auto source = large_script("var a = 1 + 2;"sv);
+    auto first = test.parse(source);
+    auto other = test.parse(source, other_realm);
+    EXPECT_NE(first.ptr(), other.ptr());
+    EXPECT_EQ(test.parse(source).ptr(), first.ptr());
+    EXPECT_EQ(test.parse(source, other_realm).ptr(), other.ptr());
+}
+
+TEST_CASE(unpartitioned_realms_are_not_cached)
+{
+    ScriptCacheTest test;
+    test.vm->host_get_script_cache_partition = [](JS::Realm&) -> Optional<String> { return {}; };
+
+    auto source = large_script("var a = 1 + 2;"sv);
+    auto first = test.parse(source);
+    auto second = test.parse(source);
+    EXPECT_NE(first.ptr(), second.ptr());
+    EXPECT_EQ(test.vm->script_cache_entry_count(), 0u);
+}
+
+TEST_CASE(least_recently_used_scripts_are_evicted)
+{
+    ScriptCacheTest test;
+    auto oldest_source = large_script("var oldest;"sv);
+    auto oldest = test.parse(oldest_source);
+
+    for (size_t i = 0; i < JS::VM::maximum_script_cache_entry_count; ++i)
+        test.parse(large_script(ByteString::formatted("var a{};", i)));
+
+    EXPECT(test.vm->script_cache_entry_count() <= JS::VM::maximum_script_cache_entry_count);
+    EXPECT_NE(test.parse(oldest_source).ptr(), oldest.ptr());
+}
+
+TEST_CASE(clearing_the_cache_drops_all_entries)
+{
+    ScriptCacheTest test;
+    auto source = large_script("var a = 1 + 2;"sv);
+
+    auto first = test.parse(source);
+    test.vm->clear_script_cache();
+    EXPECT_EQ(test.vm->script_cache_entry_count(), 0u);
+    EXPECT_NE(test.parse(source).ptr(), first.ptr());
+}
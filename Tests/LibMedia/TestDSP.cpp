@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/Math.h>
+#include <LibMedia/Audio/DSP.h>
+#include <LibTest/TestCase.h>
+
+// An odd size, so both the vectorized loops and the scalar tails are exercised.
+static constexpr size_t block_size = 13;
+
+TEST_CASE(add_and_scale)
+{
+    Array<float, block_size> destination {};
+    Array<float, block_size> source {};
+    for (size_t i = 0; i < block_size; ++i) {
+        destination[i] = static_cast<float>(i);
+        source[i] = 1.0f + static_cast<float>(i) * 0.5f;
+    }
+
+    Audio::add(destination.span(), source.span());
+    for (size_t i = 0; i < block_size; ++i)
+        EXPECT_APPROXIMATE(destination[i], 1.0f + static_cast<float>(i) * 1.5f);
+
+    Audio::add_scaled(destination.span(), source.span(), -2.0f);
+    for (size_t i = 0; i < block_size; ++i)
+        EXPECT_APPROXIMATE(destination[i], -1.0f + static_cast<float>(i) * 0.5f);
+
+    Audio::multiply(destination.span(), source.span());
+    for (size_t i = 0; i < block_size; ++i)
+        EXPECT_APPROXIMATE(destination[i], (-1.0f + static_cast<float>(i) * 0.5f) * source[i]);
+
+    Audio::scale(source.span(), 4.0f);
+    for (size_t i = 0; i < block_size; ++i)
+        EXPECT_APPROXIMATE(source[i], 4.0f + static_cast<float>(i) * 2.0f);
+}
+
+TEST_CASE(linear_gain_ramp)
+{
+    Array<float, block_size> samples {};
+    samples.fill(2.0f);
+
+    Audio::apply_linear_gain_ramp(samples.span(), 1.0f, 0.0f);
+    for (size_t i = 0; i < block_size; ++i)
+        EXPECT_APPROXIMATE(samples[i], 2.0f * (1.0f - static_cast<float>(i) / block_size));
+}
+
+TEST_CASE(clamp)
+{
+    Array<float, block_size> samples {};
+    for (size_t i = 0; i < block_size; ++i)
+        samples[i] = static_cast<float>(i) - 6.0f;
+
+    Audio::clamp(samples.span(), -2.0f, 3.0f);
+    for (size_t i = 0; i < block_size; ++i)
+        EXPECT_EQ(samples[i], AK::clamp(static_cast<float>(i) - 6.0f, -2.0f, 3.0f));
+}
+
+TEST_CASE(interleave_and_deinterleave_stereo)
+{
+    Array<float, block_size> left {};
+    Array<float, block_size> right {};
+    for (size_t i = 0; i < block_size; ++i) {
+        left[i] = static_cast<float>(i);
+        right[i] = -static_cast<float>(i);
+    }
+
+    Array<float, block_size * 2> interleaved {};
+    Audio::interleave_stereo(left.span(), right.span(), interleaved.span());
+    for (size_t i = 0; i < block_size; ++i) {
+        EXPECT_EQ(interleaved[i * 2], left[i]);
+        EXPECT_EQ(interleaved[i * 2 + 1], right[i]);
+    }
+
+    Array<float, block_size> new_left {};
+    Array<float, block_size> new_right {};
+    Audio::deinterleave_stereo(interleaved.span(), new_left.span(), new_right.span());
+    EXPECT_EQ(new_left, left);
+    EXPECT_EQ(new_right, right);
+}
+
+TEST_CASE(biquad_cascade)
+{
+    // A section that only delays by two samples, followed by one that halves.
+    Array<Audio::BiquadCoefficients, 2> sections {
+        Audio::BiquadCoefficients { .b0 = 0, .b1 = 0, .b2 = 1, .a1 = 0, .a2 = 0 },
+        Audio::BiquadCoefficients { .b0 = 0.5f, .b1 = 0, .b2 = 0, .a1 = 0, .a2 = 0 },
+    };
+    Array<Audio::BiquadState, 2> states {};
+
+    Array<float, 4> first_block { 1, 2, 3, 4 };
+    Audio::process_biquad_cascade(first_block.span(), sections.span(), states.span());
+    EXPECT_EQ(first_block, (Array<float, 4> { 0, 0, 0.5f, 1 }));
+
+    // The state carries the last two samples over into the next block.
+    Array<float, 4> second_block { 0, 0, 0, 0 };
+    Audio::process_biquad_cascade(second_block.span(), sections.span(), states.span());
+    EXPECT_EQ(second_block, (Array<float, 4> { 1.5f, 2, 0, 0 }));
+}
+
+TEST_CASE(biquad_feedback)
+{
+    // y[n] = x[n] + 0.5 * y[n - 1], so an impulse decays by half every sample.
+    Array<Audio::BiquadCoefficients, 1> sections { Audio::BiquadCoefficients { .b0 = 1, .b1 = 0, .b2 = 0, .a1 = -0.5f, .a2 = 0 } };
+    Array<Audio::BiquadState, 1> states {};
+
+    Array<float, 4> samples { 1, 0, 0, 0 };
+    Audio::process_biquad_cascade(samples.span(), sections.span(), states.span());
+    EXPECT_EQ(samples, (Array<float, 4> { 1, 0.5f, 0.25f, 0.125f }));
+}
+
+TEST_CASE(fft_rejects_bad_sizes)
+{
+    EXPECT(Audio::FFT::create(0).is_error());
+    EXPECT(Audio::FFT::create(1).is_error());
+    EXPECT(Audio::FFT::create(12).is_error());
+}
+
+TEST_CASE(fft_matches_dft)
+{
+    for (size_t size : { 2, 4, 8, 32, 256 }) {
+        auto fft = TRY_OR_FAIL(Audio::FFT::create(size));
+        EXPECT_EQ(fft.size(), size);
+
+        Vector<float> real;
+        Vector<float> imaginary;
+        real.resize(size);
+        imaginary.resize(size);
+        for (size_t i = 0; i < size; ++i) {
+            real[i] = AK::sin(static_cast<float>(i) * 0.3f) + static_cast<float>(i % 3) * 0.25f;
+            imaginary[i] = AK::cos(static_cast<float>(i) * 0.7f) * 0.5f;
+        }
+
+        Vector<double> expected_real;
+        Vector<double> expected_imaginary;
+        for (size_t k = 0; k < size; ++k) {
+            double sum_real = 0;
+            double sum_imaginary = 0;
+            for (size_t n = 0; n < size; ++n) {
+                auto angle = -2 * AK::Pi<double> * static_cast<double>(k * n) / static_cast<double>(size);
+                sum_real += real[n] * AK::cos(angle) - imaginary[n] * AK::sin(angle);
+                sum_imaginary += real[n] * AK::sin(angle) + imaginary[n] * AK::cos(angle);
+            }
+            expected_real.append(sum_real);
+            expected_imaginary.append(sum_imaginary);
+        }
+
+        fft.transform(real.span(), imaginary.span());
+        for (size_t k = 0; k < size; ++k) {
+            EXPECT(AK::fabs(real[k] - expected_real[k]) < 1e-3);
+            EXPECT(AK::fabs(imaginary[k] - expected_imaginary[k]) < 1e-3);
+        }
+    }
+}
+
+TEST_CASE(magnitudes)
+{
+    Array<float, 5> real { 3, 0, -5, 1, 0 };
+    Array<float, 5> imaginary { 4, 2, 12, 0, 0 };
+    Array<float, 5> magnitudes {};
+
+    Audio::compute_magnitudes(real.span(), imaginary.span(), magnitudes.span());
+    EXPECT_EQ(magnitudes, (Array<float, 5> { 5, 2, 13, 1, 0 }));
+}
@@ -1312,3 +1312,63 @@ TEST_CASE(zero_width_backreference)
         EXPECT_EQ(result.capture_group_matches.first()[0].view.to_byte_string(), ""sv);
     }
 }
+
+TEST_CASE(optimizer_pure_substring)
+{
+    {
+        // A pattern that's just a string of characters is matched without the bytecode VM.
+        Regex<ECMA262> re("abc"sv, ECMAScriptFlags::Global);
+        EXPECT(re.parser_result.optimization_data.pure_substring_search.has_value());
+        auto result = re.match("xxabcabxabc"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].column, 2u);
+        EXPECT_EQ(result.matches[1].column, 8u);
+    }
+    {
+        // A class of characters matches just one of them, so it's not a substring.
+        Regex<ECMA262> re("[ab]c"sv);
+        EXPECT(!re.parser_result.optimization_data.pure_substring_search.has_value());
+        EXPECT_EQ(re.match("bc"sv).success, true);
+        EXPECT_EQ(re.match("ac"sv).success, true);
+        EXPECT_EQ(re.match("abc"sv).success, false);
+    }
+    {
+        // Case-insensitive matching still goes through the VM.
+        Regex<ECMA262> re("abc"sv, ECMAScriptFlags::Global | ECMAScriptFlags::Insensitive);
+        EXPECT_EQ(re.match("xABC"sv).success, true);
+    }
+}
+
+TEST_CASE(optimizer_candidate_scanning)
+{
+    // Patterns starting with one of a few characters skip ahead to them; make sure matches spread across vector-sized
+    // chunks (and the scalar tail) are all found, for both UTF-8 and UTF-16 input.
+    auto subject = "xxxxxxxxxxxxxxxxxxaxbxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxcxxab"sv;
+
+    auto check = [](auto const& result) {
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 5u);
+        EXPECT_EQ(result.matches[0].column, 18u);
+        EXPECT_EQ(result.matches[1].column, 20u);
+        EXPECT_EQ(result.matches[2].column, 51u);
+        EXPECT_EQ(result.matches[3].column, 54u);
+        EXPECT_EQ(result.matches[4].column, 55u);
+    };
+
+    {
+        Regex<ECMA262> re("[abc]x?"sv, ECMAScriptFlags::Global);
+        check(re.match(subject));
+
+        Utf16Data utf16_subject;
+        for (auto ch : subject)
+            utf16_subject.append(ch);
+        check(re.match(Utf16View { utf16_subject }));
+    }
+    {
+        Regex<ECMA262> re("ab"sv, ECMAScriptFlags::Global);
+        auto result = re.match(subject);
+        EXPECT_EQ(result.matches.size(), 1u);
+        EXPECT_EQ(result.matches[0].column, 54u);
+    }
+}
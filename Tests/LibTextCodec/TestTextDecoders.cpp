@@ -48,3 +48,38 @@ TEST_CASE(test_utf16le_decode)
     auto utf8 = MUST(decoder.to_utf8(test_string));
     EXPECT_EQ(utf8, "säk😀"sv);
 }
+
+TEST_CASE(test_windows1252_decode)
+{
+    auto decoder = TextCodec::decoder_for_exact_name("windows-1252"sv);
+    VERIFY(decoder.has_value());
+
+    // Long enough runs of ASCII in between the windows-1252 specific bytes to go through the vectorized scan.
+    auto test_string = "Caf\xe9 \x80 and na\xefve, all the way to the end of a longer line of text\x85"sv;
+
+    EXPECT(decoder->validate(test_string));
+    auto utf8 = MUST(decoder->to_utf8(test_string));
+    EXPECT_EQ(utf8, "Café € and naïve, all the way to the end of a longer line of text…"sv);
+
+    EXPECT_EQ(MUST(decoder->to_utf8("only ASCII in here"sv)), "only ASCII in here"sv);
+    EXPECT_EQ(MUST(decoder->to_utf8(""sv)), ""sv);
+}
+
+TEST_CASE(test_single_byte_decode_unmapped_byte)
+{
+    // 0xDB is not mapped in the index of windows-874.
+    auto decoder = TextCodec::decoder_for_exact_name("windows-874"sv);
+    VERIFY(decoder.has_value());
+
+    EXPECT(!decoder->validate("abc\xdb"sv));
+    EXPECT_EQ(MUST(decoder->to_utf8("abc\xdb"sv)), "abc\xef\xbf\xbd"sv);
+}
+
+TEST_CASE(test_latin1_decode)
+{
+    auto decoder = TextCodec::Latin1Decoder();
+    auto test_string = "s\xe4k \xff"sv;
+
+    EXPECT(decoder.validate(test_string));
+    EXPECT_EQ(MUST(decoder.to_utf8(test_string)), "säk ÿ"sv);
+}
@@ -578,6 +578,62 @@ TEST_CASE(ascii_only_url)
     }
 }
 
+TEST_CASE(canonical_urls)
+{
+    {
+        auto url = URL::Parser::basic_parse("https://example.com/a//b/?q=1&r=?#frag?#"sv);
+        EXPECT(url.has_value());
+        EXPECT_EQ(url->scheme(), "https");
+        EXPECT_EQ(url->serialized_host(), "example.com"sv);
+        EXPECT_EQ(url->path_segment_count(), 4u);
+        EXPECT_EQ(url->serialize_path(), "/a//b/");
+        EXPECT_EQ(url->query().value(), "q=1&r=?"sv);
+        EXPECT_EQ(url->fragment().value(), "frag?#"sv);
+        EXPECT_EQ(url->serialize(), "https://example.com/a//b/?q=1&r=?#frag?#");
+    }
+    {
+        auto url = URL::Parser::basic_parse("wss://example.com?#"sv);
+        EXPECT(url.has_value());
+        EXPECT_EQ(url->path_segment_count(), 1u);
+        EXPECT_EQ(url->query().value(), ""sv);
+        EXPECT_EQ(url->fragment().value(), ""sv);
+        EXPECT_EQ(url->serialize(), "wss://example.com/?#");
+    }
+
+    // Inputs that look canonical at first glance, but aren't.
+    EXPECT_EQ(URL::Parser::basic_parse("https://example.com/a/./b/%2e%2E/c"sv)->serialize(), "https://example.com/a/c");
+    EXPECT_EQ(URL::Parser::basic_parse("https://example.com/a\\b"sv)->serialize(), "https://example.com/a/b");
+    EXPECT_EQ(URL::Parser::basic_parse("https://example.com/{a}?'b'#`c`"sv)->serialize(), "https://example.com/%7Ba%7D?%27b%27#%60c%60");
+    EXPECT_EQ(URL::Parser::basic_parse("https://127.0.0.1/"sv)->serialized_host(), "127.0.0.1"sv);
+    EXPECT_EQ(URL::Parser::basic_parse("https://0x7f.1/"sv)->serialized_host(), "127.0.0.1"sv);
+    EXPECT_EQ(URL::Parser::basic_parse("https://xn--caf-dma.com/"sv)->serialized_host(), "xn--caf-dma.com"sv);
+    EXPECT(!URL::Parser::basic_parse("https://1.2.3.4.5/"sv).has_value());
+}
+
+TEST_CASE(parsed_url_cache)
+{
+    auto base_url = URL::Parser::basic_parse("https://example.com/a/b"sv);
+    auto other_base_url = URL::Parser::basic_parse("https://example.org/c/d"sv);
+
+    auto first = URL::Parser::basic_parse("e/f?g"sv, *base_url);
+    EXPECT_EQ(first->serialize(), "https://example.com/a/e/f?g");
+
+    // Modifying a result must not affect later results for the same input.
+    first->set_query("h"_string);
+    EXPECT_EQ(URL::Parser::basic_parse("e/f?g"sv, *base_url)->serialize(), "https://example.com/a/e/f?g");
+
+    EXPECT_EQ(URL::Parser::basic_parse("e/f?g"sv, *other_base_url)->serialize(), "https://example.org/c/e/f?g");
+    EXPECT(!URL::Parser::basic_parse("e/f?g"sv).has_value());
+
+    // Neither must modifying the base URL.
+    base_url->set_fragment("i"_string);
+    base_url->set_query("j"_string);
+    auto copy_of_base_url = *base_url;
+    copy_of_base_url.set_paths({ "k" });
+    EXPECT_EQ(URL::Parser::basic_parse("e/f?g"sv, copy_of_base_url)->serialize(), "https://example.com/e/f?g");
+    EXPECT_EQ(URL::Parser::basic_parse("?l"sv, *base_url)->serialize(), "https://example.com/a/b?l");
+}
+
 TEST_CASE(invalid_domain_code_points)
 {
     {
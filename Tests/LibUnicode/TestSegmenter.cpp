@@ -77,6 +77,42 @@ TEST_CASE(grapheme_segmentation_indic_conjunct_break)
     test_grapheme_segmentation("\u0915\u09BC\u09CD\u09BC\u09CD\u094D\u09BC\u09CD\u09BC\u09CD\u0916"sv, { 0u, 33u });
 }
 
+TEST_CASE(grapheme_segmentation_ascii)
+{
+    auto test = [](auto const& text) {
+        auto segmenter = Unicode::Segmenter::create(Unicode::SegmenterGranularity::Grapheme);
+        segmenter->set_segmented_text(text);
+
+        EXPECT_EQ(segmenter->next_boundary(0), 1u);
+        EXPECT_EQ(segmenter->next_boundary(1), 3u);
+        EXPECT_EQ(segmenter->next_boundary(2), 3u);
+        EXPECT_EQ(segmenter->next_boundary(2, Unicode::Segmenter::Inclusive::Yes), 3u);
+        EXPECT_EQ(segmenter->next_boundary(3, Unicode::Segmenter::Inclusive::Yes), 3u);
+        EXPECT_EQ(segmenter->next_boundary(4), 6u);
+        EXPECT_EQ(segmenter->next_boundary(5), 6u);
+        EXPECT(!segmenter->next_boundary(6).has_value());
+        EXPECT_EQ(segmenter->next_boundary(6, Unicode::Segmenter::Inclusive::Yes), 6u);
+        EXPECT_EQ(segmenter->current_boundary(), 6u);
+
+        EXPECT(!segmenter->previous_boundary(0).has_value());
+        EXPECT_EQ(segmenter->previous_boundary(0, Unicode::Segmenter::Inclusive::Yes), 0u);
+        EXPECT_EQ(segmenter->previous_boundary(2), 1u);
+        EXPECT_EQ(segmenter->previous_boundary(3), 1u);
+        EXPECT_EQ(segmenter->previous_boundary(5), 4u);
+        EXPECT_EQ(segmenter->previous_boundary(6), 4u);
+        EXPECT_EQ(segmenter->previous_boundary(7), 4u);
+        EXPECT_EQ(segmenter->current_boundary(), 4u);
+        EXPECT(!segmenter->is_current_boundary_word_like());
+    };
+
+    test("a\r\nb\r\n"_string);
+
+    auto utf16_text = MUST(AK::utf8_to_utf16("a\r\nb\r\n"sv));
+    test(Utf16View { utf16_text });
+
+    test_grapheme_segmentation("\r\n\r\r\n\n"sv, { 0u, 2u, 3u, 5u, 6u });
+}
+
 template<size_t N>
 static void test_word_segmentation(StringView string, size_t const (&expected_boundaries)[N])
 {
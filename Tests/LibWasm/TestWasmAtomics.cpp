@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/MemoryStream.h>
+#include <AK/StackInfo.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/Thread.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
+#include <LibWasm/AbstractMachine/Configuration.h>
+#include <LibWasm/AbstractMachine/Validator.h>
+#include <LibWasm/Types.h>
+#include <unistd.h>
+
+static constexpr i32 ok = 0;
+static constexpr i32 timed_out = 2;
+
+// A module with one shared page of memory, exporting:
+//     wait(address: i32, expected: i32, timeout: i64) -> i32, i.e. memory.atomic.wait32
+//     notify(address: i32, count: i32) -> i32, i.e. memory.atomic.notify
+// clang-format off
+static constexpr u8 s_module_bytes[] = {
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x0e, 0x02, 0x60, 0x03, 0x7f, 0x7f, 0x7e, 0x01, 0x7f, 0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f,
+    0x03, 0x03, 0x02, 0x00, 0x01,
+    0x05, 0x04, 0x01, 0x03, 0x01, 0x01,
+    0x07, 0x11, 0x02, 0x04, 'w', 'a', 'i', 't', 0x00, 0x00, 0x06, 'n', 'o', 't', 'i', 'f', 'y', 0x00, 0x01,
+    0x0a, 0x19, 0x02,
+    0x0c, 0x00, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xfe, 0x01, 0x02, 0x00, 0x0b,
+    0x0a, 0x00, 0x20, 0x00, 0x20, 0x01, 0xfe, 0x00, 0x02, 0x00, 0x0b,
+};
+// clang-format on
+
+struct AtomicsModule {
+    AtomicsModule()
+    {
+        FixedMemoryStream stream { ReadonlyBytes { s_module_bytes, sizeof(s_module_bytes) } };
+        module = MUST(Wasm::Module::parse(stream));
+        VERIFY(!machine.validate(*module).is_error());
+        instance = MUST(machine.instantiate(*module, {}));
+    }
+
+    Wasm::FunctionAddress function(StringView name) const
+    {
+        for (auto& entry : instance->exports()) {
+            if (entry.name() == name)
+                return entry.value().get<Wasm::FunctionAddress>();
+        }
+        VERIFY_NOT_REACHED();
+    }
+
+    Wasm::Result wait(i32 address, i32 expected, i64 timeout)
+    {
+        Wasm::Value arguments[] = { Wasm::Value(address), Wasm::Value(expected), Wasm::Value(timeout) };
+        return machine.invoke(function("wait"sv), arguments);
+    }
+
+    Wasm::Result notify(i32 address, i32 count)
+    {
+        Wasm::Value arguments[] = { Wasm::Value(address), Wasm::Value(count) };
+        return machine.invoke(function("notify"sv), arguments);
+    }
+
+    Wasm::AbstractMachine machine;
+    RefPtr<Wasm::Module> module;
+    OwnPtr<Wasm::ModuleInstance> instance;
+};
+
+TEST_CASE(wait_traps_if_the_agent_cannot_block)
+{
+    AtomicsModule atomics;
+
+    auto result = atomics.wait(0, 0, 0);
+    EXPECT(result.is_trap());
+}
+
+TEST_CASE(wait_times_out)
+{
+    AtomicsModule atomics;
+    atomics.machine.enable_blocking();
+
+    auto result = atomics.wait(0, 0, 1'000'000);
+    EXPECT(!result.is_trap());
+    EXPECT_EQ(result.values()[0].to<i32>(), timed_out);
+}
+
+TEST_CASE(notify_wakes_a_waiter)
+{
+    AtomicsModule atomics;
+    auto wait = atomics.function("wait"sv);
+    Atomic<i32> wait_result { -1 };
+
+    // The waiting thread gets its own configuration, so the two threads never share any interpreter state.
+    auto waiter = Threading::Thread::construct([&]() -> intptr_t {
+        StackInfo stack_info;
+        Wasm::BytecodeInterpreter interpreter { stack_info };
+        Wasm::Configuration configuration { atomics.machine.store() };
+        configuration.enable_blocking();
+
+        Wasm::Value arguments[] = { Wasm::Value(0), Wasm::Value(0), Wasm::Value(static_cast<i64>(-1)) };
+        auto result = configuration.call(interpreter, wait, arguments);
+        if (!result.is_trap())
+            wait_result = result.values()[0].to<i32>();
+        return 0;
+    });
+    waiter->start();
+
+    // Keep notifying until the waiter has gone to sleep and been woken up.
+    i32 woken = 0;
+    for (size_t attempt = 0; attempt < 10'000 && woken == 0; ++attempt) {
+        auto result = atomics.notify(0, 1);
+        EXPECT(!result.is_trap());
+        woken = result.values()[0].to<i32>();
+        if (woken == 0)
+            usleep(1000);
+    }
+    EXPECT_EQ(woken, 1);
+
+    (void)waiter->join();
+    EXPECT_EQ(wait_result.load(), ok);
+}
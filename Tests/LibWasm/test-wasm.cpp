@@ -48,6 +48,7 @@ public:
         : JS::Object(ConstructWithPrototypeTag::Tag, prototype)
     {
         m_machine.enable_instruction_count_limit();
+        m_machine.enable_blocking();
     }
 
     static Wasm::AbstractMachine& machine() { return m_machine; }
@@ -0,0 +1,43 @@
+// Runs a rendering benchmark and reports the results to test-web as JSON.
+//
+// The page calls benchmark() with a function that dirties the document in some way. After a few warmup
+// iterations, each iteration calls that function and then forces a full style, layout and paint update
+// through internals.measureRenderingUpdate(), which times each phase. The median and 95th percentile of
+// every phase are reported once all iterations have run.
+//
+// Run the whole corpus with: test-web --benchmark
+
+function __percentile(sortedValues, fraction) {
+    const index = Math.min(sortedValues.length - 1, Math.ceil(sortedValues.length * fraction) - 1);
+    return sortedValues[Math.max(0, index)];
+}
+
+function __summarize(values) {
+    const sorted = [...values].sort((a, b) => a - b);
+    return {
+        median: __percentile(sorted, 0.5),
+        p95: __percentile(sorted, 0.95),
+    };
+}
+
+function benchmark(invalidate, { iterations = 30, warmupIterations = 3 } = {}) {
+    window.addEventListener("load", () => {
+        const phases = ["style", "layout", "paint"];
+        const timings = { style: [], layout: [], paint: [] };
+
+        for (let i = 0; i < warmupIterations + iterations; ++i) {
+            invalidate(i);
+            const result = internals.measureRenderingUpdate();
+            if (i < warmupIterations) continue;
+            for (const phase of phases) timings[phase].push(result[phase]);
+        }
+
+        const report = {
+            name: location.pathname.split("/").pop(),
+            iterations,
+        };
+        for (const phase of phases) report[phase] = __summarize(timings[phase]);
+
+        internals.signalTestIsDone(JSON.stringify(report));
+    });
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/FlyString.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/CSS/Parser/Tokenizer.h>
+
+namespace Web::CSS::Parser {
+
+TEST_CASE(original_source_text)
+{
+    auto tokens = Tokenizer::tokenize("a\\62 c:\"quoted\"  12.5px url(foo.png)"sv, "utf-8"sv);
+    EXPECT_EQ(tokens.size(), 8u);
+
+    EXPECT(tokens[0].is(Token::Type::Ident));
+    EXPECT_EQ(tokens[0].ident(), "abc"_fly_string);
+    EXPECT_EQ(tokens[0].original_source_text(), "a\\62 c"sv);
+
+    EXPECT(tokens[1].is(Token::Type::Colon));
+    EXPECT_EQ(tokens[1].original_source_text(), ":"sv);
+
+    EXPECT(tokens[2].is(Token::Type::String));
+    EXPECT_EQ(tokens[2].string(), "quoted"_fly_string);
+    EXPECT_EQ(tokens[2].original_source_text(), "\"quoted\""sv);
+
+    EXPECT(tokens[3].is(Token::Type::Whitespace));
+    EXPECT_EQ(tokens[3].original_source_text(), "  "sv);
+
+    EXPECT(tokens[4].is(Token::Type::Dimension));
+    EXPECT_EQ(tokens[4].original_source_text(), "12.5px"sv);
+
+    EXPECT(tokens[5].is(Token::Type::Whitespace));
+
+    EXPECT(tokens[6].is(Token::Type::Url));
+    EXPECT_EQ(tokens[6].url(), "foo.png"_fly_string);
+
+    EXPECT(tokens[7].is(Token::Type::EndOfFile));
+    EXPECT(tokens[7].original_source_text().is_empty());
+}
+
+TEST_CASE(original_source_text_outlives_input)
+{
+    Vector<Token> tokens;
+    {
+        auto input = MUST(String::formatted("{} {}", "first-identifier-that-is-long"sv, "second-identifier-that-is-long"sv));
+        tokens = Tokenizer::tokenize(input, "utf-8"sv);
+    }
+    EXPECT_EQ(tokens.size(), 4u);
+    EXPECT_EQ(tokens[0].original_source_text(), "first-identifier-that-is-long"sv);
+    EXPECT_EQ(tokens[2].original_source_text(), "second-identifier-that-is-long"sv);
+}
+
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <AK/Queue.h>
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
+#include <LibIPC/File.h>
+#include <LibIPC/Message.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/DisplayList.h>
+
+namespace Web::Painting {
+
+static NonnullRefPtr<DisplayList> round_trip(DisplayList const& display_list)
+{
+    IPC::MessageBuffer buffer;
+    IPC::Encoder encoder(buffer);
+    MUST(encoder.encode(display_list));
+
+    FixedMemoryStream stream { buffer.data().span() };
+    Queue<IPC::File> files;
+    IPC::Decoder decoder(stream, files);
+    return MUST(decoder.decode<NonnullRefPtr<DisplayList>>());
+}
+
+TEST_CASE(round_trip_preserves_commands_and_scroll_frames)
+{
+    auto display_list = DisplayList::create();
+    display_list->set_device_pixels_per_css_pixel(2);
+    display_list->append(Save {}, {});
+    display_list->append(AddClipRect { .rect = { 0, 0, 100, 100 } }, {});
+    display_list->append(FillRect { .rect = { 10, 20, 30, 40 }, .color = Color::Red }, 3);
+    display_list->append(FillRectWithRoundedCorners { .rect = { 1, 2, 3, 4 }, .color = Color::Blue, .corner_radii = { .top_left = { 5, 6 } } }, {});
+    display_list->append(Restore {}, {});
+
+    auto decoded = round_trip(*display_list);
+    EXPECT_EQ(decoded->device_pixels_per_css_pixel(), 2.0);
+    EXPECT_EQ(decoded->commands().size(), 5u);
+
+    auto const& fill_rect_item = decoded->commands()[2];
+    EXPECT_EQ(fill_rect_item.scroll_frame_id, Optional<i32> { 3 });
+    auto const& fill_rect = fill_rect_item.command.get<FillRect>();
+    EXPECT_EQ(fill_rect.rect, Gfx::IntRect(10, 20, 30, 40));
+    EXPECT_EQ(fill_rect.color, Color(Color::Red));
+
+    auto const& rounded_rect = decoded->commands()[3].command.get<FillRectWithRoundedCorners>();
+    EXPECT_EQ(rounded_rect.corner_radii.top_left.horizontal_radius, 5);
+    EXPECT_EQ(rounded_rect.corner_radii.top_left.vertical_radius, 6);
+    EXPECT(decoded->commands()[4].command.has<Restore>());
+}
+
+TEST_CASE(round_trip_preserves_nested_display_lists)
+{
+    auto mask = DisplayList::create();
+    mask->set_device_pixels_per_css_pixel(1);
+    mask->append(FillRect { .rect = { 0, 0, 8, 8 }, .color = Color::White }, {});
+
+    auto display_list = DisplayList::create();
+    display_list->set_device_pixels_per_css_pixel(1);
+    display_list->append(AddMask { .display_list = mask, .rect = { 0, 0, 8, 8 } }, {});
+
+    auto decoded = round_trip(*display_list);
+    auto const& add_mask = decoded->commands()[0].command.get<AddMask>();
+    EXPECT_EQ(add_mask.rect, Gfx::IntRect(0, 0, 8, 8));
+    EXPECT_EQ(add_mask.display_list->commands().size(), 1u);
+}
+
+}
@@ -199,6 +199,27 @@ TEST_CASE(character_reference_in_attribute)
     END_ENUMERATION();
 }
 
+TEST_CASE(long_quoted_attributes)
+{
+    auto tokens = run_tokenizer("<p foo=\"abcdefghijkl&amp;mnop'qrstuvwxyz\" bar='0123456789\"abcdef'>"sv);
+    BEGIN_ENUMERATION(tokens);
+    EXPECT_START_TAG_TOKEN(p, 1u, 65u);
+    EXPECT_TAG_TOKEN_ATTRIBUTE_COUNT(2);
+    EXPECT_TAG_TOKEN_ATTRIBUTE(foo, "abcdefghijkl&mnop'qrstuvwxyz", 3u, 6u, 7u, 41u);
+    EXPECT_TAG_TOKEN_ATTRIBUTE(bar, "0123456789\"abcdef", 42u, 45u, 46u, 65u);
+    EXPECT_END_OF_FILE_TOKEN();
+    END_ENUMERATION();
+}
+
+TEST_CASE(newlines_and_nulls_in_long_quoted_attribute)
+{
+    auto tokens = run_tokenizer("<p foo=\"abcdefgh\r\nijklmnop\rqrstuvwx\0yz\">"sv);
+    EXPECT_EQ(tokens.size(), 2u);
+    auto foo = tokens[0].attribute("foo"_fly_string);
+    VERIFY(foo.has_value());
+    EXPECT_EQ(*foo, "abcdefgh\nijklmnop\nqrstuvwx\uFFFDyz"sv);
+}
+
 TEST_CASE(named_character_reference)
 {
     auto tokens = run_tokenizer("&notinvc;&notit;&cz"sv);
@@ -38,6 +38,7 @@ void Application::create_platform_arguments(Core::ArgsParser& args_parser)
     args_parser.add_option(dump_gc_graph, "Dump GC graph", "dump-gc-graph", 'G');
     args_parser.add_option(test_dry_run, "List the tests that would be run, without running them", "dry-run");
     args_parser.add_option(rebaseline, "Rebaseline any executed layout or text tests", "rebaseline");
+    args_parser.add_option(run_benchmarks, "Run the benchmarks in the Benchmark directory instead of the tests", "benchmark");
     args_parser.add_option(per_test_timeout_in_seconds, "Per-test timeout (default: 30)", "per-test-timeout", 't', "seconds");
 
     args_parser.add_option(Core::ArgsParser::Option {
@@ -76,6 +77,11 @@ void Application::create_platform_options(WebView::BrowserOptions& browser_optio
         // Force all tests to run in serial if we are interested in the GC graph.
         test_concurrency = 1;
     }
+
+    if (run_benchmarks) {
+        // Benchmarks running in parallel would compete for the CPU and skew each other's timings.
+        test_concurrency = 1;
+    }
 }
 
 ErrorOr<void> Application::launch_test_fixtures()
@@ -20,6 +20,7 @@ enum class TestMode {
     Text,
     Ref,
     Crash,
+    Benchmark,
 };
 
 enum class TestResult {
@@ -128,7 +128,7 @@ static ErrorOr<void> collect_ref_tests(Application const& app, Vector<Test>& tes
     return {};
 }
 
-static ErrorOr<void> collect_crash_tests(Application const& app, Vector<Test>& tests, StringView path, StringView trail)
+static ErrorOr<void> collect_tests_without_expectations(Application const& app, Vector<Test>& tests, StringView path, StringView trail, TestMode mode)
 {
     Core::DirIterator it(ByteString::formatted("{}/{}", path, trail), Core::DirIterator::Flags::SkipDots);
     while (it.has_next()) {
@@ -136,14 +136,14 @@ static ErrorOr<void> collect_crash_tests(Application const& app, Vector<Test>& t
         auto input_path = TRY(FileSystem::real_path(ByteString::formatted("{}/{}/{}", path, trail, name)));
 
         if (FileSystem::is_directory(input_path)) {
-            TRY(collect_crash_tests(app, tests, path, ByteString::formatted("{}/{}", trail, name)));
+            TRY(collect_tests_without_expectations(app, tests, path, ByteString::formatted("{}/{}", trail, name), mode));
             continue;
         }
         if (!is_valid_test_name(name))
             continue;
 
         auto relative_path = LexicalPath::relative_path(input_path, app.test_root_path).release_value();
-        tests.append({ TestMode::Crash, input_path, {}, move(relative_path) });
+        tests.append({ mode, input_path, {}, move(relative_path) });
     }
 
     return {};
@@ -291,6 +291,12 @@ static void run_dump_test(TestWebView& view, Test& test, URL::URL const& url, in
                 return;
             on_test_complete();
         };
+    } else if (test.mode == TestMode::Benchmark) {
+        // Benchmarks report their results as JSON through internals.signalTestIsDone(), which we print as-is.
+        view.on_test_finish = [&test, on_test_complete = move(on_test_complete)](auto const& text) {
+            test.text = text;
+            on_test_complete();
+        };
     }
 
     view.on_set_test_timeout = [timer, timeout_in_milliseconds](double milliseconds) {
@@ -454,6 +460,7 @@ static void run_test(TestWebView& view, Test& test, Application& app)
 
         switch (test.mode) {
         case TestMode::Crash:
+        case TestMode::Benchmark:
         case TestMode::Text:
         case TestMode::Layout:
             run_dump_test(view, test, url, app.per_test_timeout_in_seconds * 1000);
@@ -530,13 +537,17 @@ static ErrorOr<int> run_tests(Core::AnonymousBuffer const& theme, Web::DevicePix
     if (app.test_globs.is_empty())
         app.test_globs.append("*"sv);
 
-    TRY(collect_dump_tests(app, tests, ByteString::formatted("{}/Layout", app.test_root_path), "."sv, TestMode::Layout));
-    TRY(collect_dump_tests(app, tests, ByteString::formatted("{}/Text", app.test_root_path), "."sv, TestMode::Text));
-    TRY(collect_ref_tests(app, tests, ByteString::formatted("{}/Ref", app.test_root_path), "."sv));
-    TRY(collect_crash_tests(app, tests, ByteString::formatted("{}/Crash", app.test_root_path), "."sv));
+    if (app.run_benchmarks) {
+        TRY(collect_tests_without_expectations(app, tests, ByteString::formatted("{}/Benchmark", app.test_root_path), "."sv, TestMode::Benchmark));
+    } else {
+        TRY(collect_dump_tests(app, tests, ByteString::formatted("{}/Layout", app.test_root_path), "."sv, TestMode::Layout));
+        TRY(collect_dump_tests(app, tests, ByteString::formatted("{}/Text", app.test_root_path), "."sv, TestMode::Text));
+        TRY(collect_ref_tests(app, tests, ByteString::formatted("{}/Ref", app.test_root_path), "."sv));
+        TRY(collect_tests_without_expectations(app, tests, ByteString::formatted("{}/Crash", app.test_root_path), "."sv, TestMode::Crash));
 #if defined(AK_OS_LINUX) && ARCH(X86_64)
-    TRY(collect_ref_tests(app, tests, ByteString::formatted("{}/Screenshot", app.test_root_path), "."sv));
+        TRY(collect_ref_tests(app, tests, ByteString::formatted("{}/Screenshot", app.test_root_path), "."sv));
 #endif
+    }
 
     tests.remove_all_matching([&](auto const& test) {
         static constexpr Array support_file_patterns {
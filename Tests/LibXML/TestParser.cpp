@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
 #include <LibTest/TestCase.h>
 #include <LibXML/Parser/Parser.h>
 
@@ -45,3 +47,117 @@ TEST_CASE(unicode_name)
     XML::Parser parser("<div 中文=\"\"></div>"sv);
     TRY_OR_FAIL(parser.parse());
 }
+
+struct RecordingListener final : public XML::Listener {
+    virtual void document_start() override { events.append("document_start"); }
+    virtual void document_end() override
+    {
+        flush_text();
+        events.append("document_end");
+    }
+    virtual void element_start(XML::Name const& name, HashMap<XML::Name, ByteString> const& attributes) override
+    {
+        flush_text();
+        StringBuilder builder;
+        builder.appendff("<{}", name);
+        auto keys = attributes.keys();
+        quick_sort(keys);
+        for (auto const& key : keys)
+            builder.appendff(" {}={}", key, attributes.get(key).value());
+        builder.append('>');
+        events.append(builder.to_byte_string());
+    }
+    virtual void element_end(XML::Name const& name) override
+    {
+        flush_text();
+        events.append(ByteString::formatted("</{}>", name));
+    }
+    virtual void text(StringView text) override { pending_text.append(text); }
+    virtual void comment(StringView text) override
+    {
+        flush_text();
+        events.append(ByteString::formatted("<!--{}-->", text));
+    }
+    virtual void error(XML::ParseError const&) override
+    {
+        flush_text();
+        events.append("error");
+    }
+
+    void flush_text()
+    {
+        if (!pending_text.is_empty())
+            events.append(pending_text.to_byte_string());
+        pending_text.clear();
+    }
+
+    Vector<ByteString> events;
+    StringBuilder pending_text;
+};
+
+static constexpr auto incremental_test_document = R"~~~(<?xml version="1.0" encoding="UTF-8"?>
+<!-- Before the root -->
+<!DOCTYPE root>
+<root a="1" b='x>y'><child>Some text &amp; a reference, ]] brackets and ünicode 中文</child><![CDATA[<cdata>]]><empty/><!--inside--><?target data?></root>
+)~~~"sv;
+
+static Vector<ByteString> parse_incrementally(StringView source, size_t chunk_size, XML::Parser::Options options = {})
+{
+    RecordingListener listener;
+    XML::Parser parser(listener, move(options));
+    for (size_t i = 0; i < source.length(); i += chunk_size) {
+        if (parser.append_input(source.substring_view(i, min(chunk_size, source.length() - i))).is_error())
+            return move(listener.events);
+    }
+    (void)parser.close_input();
+    return move(listener.events);
+}
+
+TEST_CASE(incremental_parsing)
+{
+    Vector<ByteString> expected_events {
+        "document_start",
+        "<root a=1 b=x>y>",
+        "<child>",
+        "Some text & a reference, ]] brackets and ünicode 中文",
+        "</child>",
+        "<cdata>",
+        "<empty>",
+        "</empty>",
+        "</root>",
+        "document_end",
+    };
+
+    for (size_t chunk_size : { 1uz, 2uz, 3uz, 7uz, 64uz, incremental_test_document.length() })
+        EXPECT_EQ(parse_incrementally(incremental_test_document, chunk_size), expected_events);
+
+    XML::Parser::Options options;
+    options.preserve_comments = true;
+    auto events = parse_incrementally(incremental_test_document, 1, move(options));
+    EXPECT_EQ(events.size(), expected_events.size() + 2);
+    EXPECT_EQ(events[1], "<!-- Before the root -->");
+    EXPECT_EQ(events[9], "<!--inside-->");
+}
+
+TEST_CASE(incremental_parsing_errors)
+{
+    // The document is not finished when the input is closed.
+    EXPECT_EQ(parse_incrementally("<a><b>text</b>"sv, 1), (Vector<ByteString> { "document_start", "<a>", "<b>", "text", "</b>", "error", "document_end" }));
+
+    // The end tag doesn't match the start tag.
+    EXPECT_EQ(parse_incrementally("<a><b></a></b>"sv, 1), (Vector<ByteString> { "document_start", "<a>", "<b>", "error", "document_end" }));
+
+    // ']]>' is split across chunks.
+    EXPECT_EQ(parse_incrementally("<a>text]]>more</a>"sv, 1), (Vector<ByteString> { "document_start", "<a>", "text", "error", "document_end" }));
+
+    // There is something other than misc after the root element.
+    EXPECT_EQ(parse_incrementally("<a/><b/>"sv, 2), (Vector<ByteString> { "document_start", "<a>", "</a>", "error", "document_end" }));
+
+    RecordingListener listener;
+    XML::Parser parser(listener);
+    EXPECT(!parser.append_input("<a>"sv).is_error());
+    EXPECT(parser.append_input("</b>"sv).is_error());
+    EXPECT(parser.append_input("</a>"sv).is_error());
+    EXPECT(parser.close_input().is_error());
+    EXPECT_EQ(listener.events.size(), 4u);
+}
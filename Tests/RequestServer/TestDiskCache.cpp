@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/EventLoop.h>
+#include <LibFileSystem/TempFile.h>
+#include <LibTest/TestCase.h>
+#include <LibURL/Parser.h>
+#include <RequestServer/DiskCache.h>
+
+static constexpr auto partition_key = "https://example.com"sv;
+
+static URL::URL url_for(StringView path)
+{
+    return URL::Parser::basic_parse(ByteString::formatted("https://example.com/{}", path)).release_value();
+}
+
+static HTTP::HeaderMap cacheable_headers()
+{
+    HTTP::HeaderMap headers;
+    headers.set("Content-Type", "text/plain");
+    headers.set("Cache-Control", "max-age=3600");
+    headers.set("ETag", "\"v1\"");
+    return headers;
+}
+
+TEST_CASE(stored_entry_is_a_fresh_hit)
+{
+    Core::EventLoop loop;
+    auto directory = MUST(FileSystem::TempFile::create_temp_directory());
+    auto cache = MUST(RequestServer::DiskCache::create(directory->path().to_byte_string()));
+
+    EXPECT(!cache->open_entry(partition_key, url_for("a"sv)).has_value());
+
+    cache->store_entry(partition_key, url_for("a"sv), 200, "OK"_string, cacheable_headers(), "hello"sv.bytes());
+
+    auto entry = cache->open_entry(partition_key, url_for("a"sv));
+    VERIFY(entry.has_value());
+    EXPECT_EQ(entry->status_code(), 200u);
+    EXPECT_EQ(entry->reason_phrase(), "OK"_string);
+    EXPECT_EQ(StringView { entry->body() }, "hello"sv);
+    EXPECT_EQ(entry->response_headers().get("Content-Type"sv), "text/plain"sv);
+    EXPECT(entry->is_fresh());
+
+    // Entries are partitioned, and keyed by the URL without its fragment.
+    EXPECT(!cache->open_entry("https://other.example"sv, url_for("a"sv)).has_value());
+    EXPECT(cache->open_entry(partition_key, url_for("a#fragment"sv)).has_value());
+}
+
+TEST_CASE(entries_persist_across_instances)
+{
+    Core::EventLoop loop;
+    auto directory = MUST(FileSystem::TempFile::create_temp_directory());
+    auto path = directory->path().to_byte_string();
+
+    {
+        auto cache = MUST(RequestServer::DiskCache::create(path));
+        cache->store_entry(partition_key, url_for("a"sv), 200, {}, cacheable_headers(), "hello"sv.bytes());
+        cache->flush_index();
+    }
+
+    auto cache = MUST(RequestServer::DiskCache::create(path));
+    auto entry = cache->open_entry(partition_key, url_for("a"sv));
+    VERIFY(entry.has_value());
+    EXPECT_EQ(StringView { entry->body() }, "hello"sv);
+}
+
+TEST_CASE(set_cookie_is_not_stored)
+{
+    Core::EventLoop loop;
+    auto directory = MUST(FileSystem::TempFile::create_temp_directory());
+    auto cache = MUST(RequestServer::DiskCache::create(directory->path().to_byte_string()));
+
+    auto headers = cacheable_headers();
+    headers.set("Set-Cookie", "session=1234");
+    cache->store_entry(partition_key, url_for("a"sv), 200, {}, headers, "hello"sv.bytes());
+
+    auto entry = cache->open_entry(partition_key, url_for("a"sv));
+    VERIFY(entry.has_value());
+    EXPECT(!entry->response_headers().contains("Set-Cookie"sv));
+    EXPECT(entry->response_headers().contains("ETag"sv));
+}
+
+TEST_CASE(unstorable_responses_are_not_stored)
+{
+    Core::EventLoop loop;
+    auto directory = MUST(FileSystem::TempFile::create_temp_directory());
+    auto cache = MUST(RequestServer::DiskCache::create(directory->path().to_byte_string()));
+
+    cache->store_entry(partition_key, url_for("not-modified"sv), 304, {}, cacheable_headers(), {});
+    EXPECT(!cache->open_entry(partition_key, url_for("not-modified"sv)).has_value());
+
+    auto no_store_headers = cacheable_headers();
+    no_store_headers.set("Cache-Control", "no-store");
+    cache->store_entry(partition_key, url_for("no-store"sv), 200, {}, no_store_headers, "hello"sv.bytes());
+    EXPECT(!cache->open_entry(partition_key, url_for("no-store"sv)).has_value());
+
+    HTTP::HeaderMap no_validator_headers;
+    no_validator_headers.set("Content-Type", "text/plain");
+    cache->store_entry(partition_key, url_for("no-validators"sv), 200, {}, no_validator_headers, "hello"sv.bytes());
+    EXPECT(!cache->open_entry(partition_key, url_for("no-validators"sv)).has_value());
+}
+
+TEST_CASE(revalidation_updates_headers_and_keeps_the_body)
+{
+    Core::EventLoop loop;
+    auto directory = MUST(FileSystem::TempFile::create_temp_directory());
+    auto cache = MUST(RequestServer::DiskCache::create(directory->path().to_byte_string()));
+
+    HTTP::HeaderMap headers;
+    headers.set("Content-Type", "text/plain");
+    headers.set("Content-Length", "5");
+    headers.set("Cache-Control", "no-cache");
+    headers.set("ETag", "\"v1\"");
+    cache->store_entry(partition_key, url_for("a"sv), 200, {}, headers, "hello"sv.bytes());
+
+    auto entry = cache->open_entry(partition_key, url_for("a"sv));
+    VERIFY(entry.has_value());
+    EXPECT(!entry->is_fresh());
+    EXPECT(entry->has_validators());
+
+    HTTP::HeaderMap revalidation_headers;
+    entry->add_revalidation_headers(revalidation_headers);
+    EXPECT_EQ(revalidation_headers.get("If-None-Match"sv), "\"v1\""sv);
+
+    HTTP::HeaderMap not_modified_headers;
+    not_modified_headers.set("Cache-Control", "max-age=3600");
+    not_modified_headers.set("Content-Length", "0");
+    not_modified_headers.set("Set-Cookie", "session=1234");
+    cache->update_entry_after_revalidation(*entry, not_modified_headers);
+
+    auto refreshed_entry = cache->open_entry(partition_key, url_for("a"sv));
+    VERIFY(refreshed_entry.has_value());
+    EXPECT(refreshed_entry->is_fresh());
+    EXPECT_EQ(refreshed_entry->status_code(), 200u);
+    EXPECT_EQ(StringView { refreshed_entry->body() }, "hello"sv);
+    EXPECT_EQ(refreshed_entry->response_headers().get("Content-Length"sv), "5"sv);
+    EXPECT_EQ(refreshed_entry->response_headers().get("Content-Type"sv), "text/plain"sv);
+    EXPECT(!refreshed_entry->response_headers().contains("Set-Cookie"sv));
+}
+
+TEST_CASE(least_recently_used_entries_are_evicted)
+{
+    Core::EventLoop loop;
+    auto directory = MUST(FileSystem::TempFile::create_temp_directory());
+    // Room for a few entries of this size, headers included.
+    auto cache = MUST(RequestServer::DiskCache::create(directory->path().to_byte_string(), 4 * KiB));
+
+    auto body = MUST(ByteBuffer::create_zeroed(1 * KiB));
+    cache->store_entry(partition_key, url_for("a"sv), 200, {}, cacheable_headers(), body);
+    cache->store_entry(partition_key, url_for("b"sv), 200, {}, cacheable_headers(), body);
+    cache->store_entry(partition_key, url_for("c"sv), 200, {}, cacheable_headers(), body);
+
+    // Touch "a" so that "b" becomes the least recently used entry.
+    EXPECT(cache->open_entry(partition_key, url_for("a"sv)).has_value());
+
+    cache->store_entry(partition_key, url_for("d"sv), 200, {}, cacheable_headers(), body);
+
+    EXPECT(!cache->open_entry(partition_key, url_for("b"sv)).has_value());
+    EXPECT(cache->open_entry(partition_key, url_for("a"sv)).has_value());
+    EXPECT(cache->open_entry(partition_key, url_for("d"sv)).has_value());
+}
@@ -409,6 +409,19 @@ BrowserWindow::BrowserWindow(Vector<URL::URL> const& initial_urls, IsPopupWindow
         debug_request("dump-style-sheets");
     });
 
+    auto* dump_style_update_statistics_action = new QAction("Dump Style Update Statistics", this);
+    dump_style_update_statistics_action->setIcon(load_icon_from_uri("resource://icons/16x16/filetype-css.png"sv));
+    debug_menu->addAction(dump_style_update_statistics_action);
+    QObject::connect(dump_style_update_statistics_action, &QAction::triggered, this, [this] {
+        debug_request("dump-style-update-statistics");
+    });
+
+    auto* dump_frame_timings_action = new QAction("Dump Frame Timings", this);
+    debug_menu->addAction(dump_frame_timings_action);
+    QObject::connect(dump_frame_timings_action, &QAction::triggered, this, [this] {
+        debug_request("dump-frame-timings");
+    });
+
     auto* dump_styles_action = new QAction("Dump &All Resolved Styles", this);
     dump_styles_action->setIcon(load_icon_from_uri("resource://icons/16x16/filetype-css.png"sv));
     debug_menu->addAction(dump_styles_action);
@@ -25,6 +25,7 @@
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/JSONObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/StringPrototype.h>
 #include <LibJS/Runtime/ValueInlines.h>
 #include <LibJS/SourceTextModule.h>
@@ -792,6 +793,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     bool disable_debug_printing = false;
     bool use_test262_global = false;
     StringView evaluate_script;
+    StringView profile_path;
     Vector<StringView> script_paths;
 
     Core::ArgsParser args_parser;
@@ -808,6 +810,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_option(disable_debug_printing, "Disable debug output", "disable-debug-output", {});
     args_parser.add_option(evaluate_script, "Evaluate argument as a script", "evaluate", 'c', "script");
     args_parser.add_option(use_test262_global, "Use test262 global ($262)", "use-test262-global", {});
+    args_parser.add_option(profile_path, "Sample the running script and write a .cpuprofile (or folded stacks for any other extension) to the given path", "profile", {}, "path");
     args_parser.add_positional_argument(script_paths, "Path to script files", "scripts", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
@@ -892,7 +895,19 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
         // We resolve modules as if it is the first file
 
-        if (!TRY(parse_and_run(realm, builder.string_view(), source_name)))
+        if (!profile_path.is_empty())
+            g_vm->start_sampling_profiler(JS::SamplingProfiler::default_sampling_interval);
+
+        auto success = TRY(parse_and_run(realm, builder.string_view(), source_name));
+
+        if (auto profiler = g_vm->stop_sampling_profiler()) {
+            auto profile = profile_path.ends_with(".cpuprofile"sv) ? profiler->to_cpuprofile_json() : profiler->to_folded_stacks();
+            auto file = TRY(Core::File::open(profile_path, Core::File::OpenMode::Write));
+            TRY(file->write_until_depleted(profile.bytes()));
+            warnln("Wrote {} samples to {}", profiler->sample_count(), profile_path);
+        }
+
+        if (!success)
             return 1;
     }
 
@@ -17,6 +17,7 @@
 #include <LibMain/Main.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
 #include <LibWasm/Printer/Printer.h>
 #include <LibWasm/Types.h>
 #include <LibWasm/Wasi.h>
@@ -450,7 +451,7 @@ static bool pre_interpret_hook(Wasm::Configuration& config, Wasm::InstructionPoi
             Wasm::Result result { Wasm::Trap::from_string("") };
             {
                 Wasm::BytecodeInterpreter::CallFrameHandle handle { g_interpreter, config };
-                result = config.call(g_interpreter, *address, move(values));
+                result = config.call(g_interpreter, *address, values);
             }
             if (result.is_trap()) {
                 warnln("Execution trapped: {}", result.trap().format());
@@ -525,6 +526,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     bool shell_mode = false;
     bool wasi = false;
     ByteString exported_function_to_execute;
+    StringView profile_path;
     Vector<ParsedValue> values_to_push;
     Vector<ByteString> modules_to_link_in;
     Vector<StringView> args_if_wasi;
@@ -539,6 +541,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     parser.add_option(export_all_imports, "Export noop functions corresponding to imports", "export-noop");
     parser.add_option(shell_mode, "Launch a REPL in the module's context (implies -i)", "shell", 's');
     parser.add_option(wasi, "Enable WASI", "wasi", 'w');
+    parser.add_option(profile_path, "Profile the executed function and write a .cpuprofile (or folded stacks for any other extension) to the given path", "profile", {}, "path");
     parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Required,
         .help_string = "Directory mappings to expose via WASI",
@@ -834,7 +837,23 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
                 outln();
             }
 
-            auto result = machine.invoke(g_interpreter, run_address.value(), move(values));
+            OwnPtr<Wasm::Profiler> profiler;
+            if (!profile_path.is_empty()) {
+                profiler = make<Wasm::Profiler>(machine.store());
+                g_interpreter.profiler = profiler.ptr();
+            }
+
+            auto result = machine.invoke(g_interpreter, run_address.value(), values);
+
+            if (profiler) {
+                g_interpreter.profiler = nullptr;
+                profiler->stop();
+                auto profile = profile_path.ends_with(".cpuprofile"sv) ? profiler->to_cpuprofile_json() : profiler->to_folded_stacks();
+                auto file = TRY(Core::File::open(profile_path, Core::File::OpenMode::Write));
+                TRY(file->write_until_depleted(profile.bytes()));
+                warn("{}", profiler->to_summary());
+                warnln("Wrote {} samples to {}", profiler->sample_count(), profile_path);
+            }
 
             if (debug)
                 launch_repl();